@@ -69,3 +69,27 @@ export async function getSources (args: Electron.SourcesOptions) {
 
   return getSources;
 }
+
+export function watchSources (args: Electron.WatchSourcesOptions, listener: (details: Electron.DesktopCapturerSourceUpdate) => void) {
+  if (!isValid(args)) throw new Error('Invalid options');
+  if (typeof listener !== 'function') throw new TypeError('listener must be a function');
+
+  const { thumbnailSize = { width: 150, height: 150 } } = args;
+  const { fetchWindowIcons = false } = args;
+  const { thumbnailUpdateInterval = 1000 } = args;
+  if (!(thumbnailUpdateInterval > 0)) throw new RangeError('thumbnailUpdateInterval must be greater than 0');
+
+  const capturer = createDesktopCapturer();
+  capturer._onsourceupdated = (type, source) => listener({ type, id: source.id, source });
+  capturer._onsourceremoved = (id) => listener({ type: 'removed', id, source: null });
+
+  const started = capturer.startWatching(args.types.includes('window'), args.types.includes('screen'),
+    thumbnailSize, fetchWindowIcons, Math.round(thumbnailUpdateInterval));
+  if (!started) throw new Error('Failed to watch sources');
+
+  return () => {
+    delete capturer._onsourceupdated;
+    delete capturer._onsourceremoved;
+    capturer.stopWatching();
+  };
+}
@@ -289,6 +289,11 @@ export function showErrorBox (...args: any[]) {
   return dialogBinding.showErrorBox(...args);
 }
 
+export function prewarmDirectory (path: string) {
+  if (typeof path !== 'string') throw new TypeError('path must be a string');
+  if (process.platform === 'linux') dialogBinding.prewarmDirectory(path);
+}
+
 export function showCertificateTrustDialog (windowOrOptions: BrowserWindow | CertificateTrustDialogOptions, maybeOptions?: CertificateTrustDialogOptions) {
   const window = (windowOrOptions && !(windowOrOptions instanceof BrowserWindow) ? null : windowOrOptions);
   const options = (windowOrOptions && !(windowOrOptions instanceof BrowserWindow) ? windowOrOptions : maybeOptions);
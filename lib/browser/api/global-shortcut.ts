@@ -1,2 +1,19 @@
 const { globalShortcut } = process._linkedBinding('electron_browser_global_shortcut');
+
+globalShortcut.update = function (changes: Parameters<Electron.GlobalShortcut['update']>[0]) {
+  if (changes == null || typeof changes !== 'object') {
+    throw new TypeError('changes must be an object');
+  }
+  const { unregister = [], register = [] } = changes;
+  if (!Array.isArray(unregister) || !Array.isArray(register)) {
+    throw new TypeError('unregister and register must be arrays');
+  }
+  for (const shortcut of register) {
+    if (shortcut == null || typeof shortcut.callback !== 'function') {
+      throw new TypeError('each shortcut to register must have a callback');
+    }
+  }
+  return (this as any)._update(unregister, register.map(s => s.accelerator), register.map(s => s.callback));
+};
+
 export default globalShortcut;
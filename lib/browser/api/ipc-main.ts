@@ -1,5 +1,29 @@
 import { IpcMainImpl } from '@electron/internal/browser/ipc-main-impl';
 
+const binding = process._linkedBinding('electron_browser_ipc_main');
+
 const ipcMain = new IpcMainImpl();
 
+// The replies are held natively for the whole process so that
+// ipcRenderer.sendSync() calls on these channels from any webContents are
+// answered on receipt, without entering JavaScript.
+ipcMain.setSyncReply = (channel, value) => {
+  if (typeof channel !== 'string') {
+    throw new TypeError('Expected channel to be a string');
+  }
+  binding.setSyncReply(channel, value);
+};
+
+ipcMain.removeSyncReply = (channel) => {
+  binding.removeSyncReply(channel);
+};
+
+// Metrics are collected for messages from all renderers, see
+// shell/browser/api/electron_api_ipc_main.cc.
+ipcMain.getMetrics = () => binding.getMetrics();
+
+ipcMain.resetMetrics = () => {
+  binding.resetMetrics();
+};
+
 export default ipcMain;
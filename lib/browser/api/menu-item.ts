@@ -28,9 +28,9 @@ const MenuItem = function (this: any, options: any) {
   this.overrideReadOnlyProperty('icon');
   this.overrideReadOnlyProperty('submenu');
 
-  this.overrideProperty('label', roles.getDefaultLabel(this.role));
-  this.overrideProperty('sublabel', '');
-  this.overrideProperty('toolTip', '');
+  this.overrideMenuProperty('label', roles.getDefaultLabel(this.role), 'setLabel');
+  this.overrideMenuProperty('sublabel', '', 'setSublabel');
+  this.overrideMenuProperty('toolTip', '', 'setToolTip');
   this.overrideProperty('enabled', true);
   this.overrideProperty('visible', true);
   this.overrideProperty('checked', false);
@@ -96,4 +96,21 @@ MenuItem.prototype.overrideReadOnlyProperty = function (name: string, defaultVal
   });
 };
 
+// Like overrideProperty, but changes are also applied in place to the menu the
+// item is in, so that updating it doesn't require rebuilding the whole menu.
+MenuItem.prototype.overrideMenuProperty = function (name: string, defaultValue: string, setter: 'setLabel' | 'setSublabel' | 'setToolTip') {
+  this.overrideProperty(name, defaultValue);
+  let value = this[name];
+  Object.defineProperty(this, name, {
+    enumerable: true,
+    get: () => value,
+    set: (newValue: string) => {
+      value = newValue;
+      if (!this.menu) return;
+      const index = this.menu.items.indexOf(this);
+      if (index !== -1) this.menu[setter](index, newValue);
+    }
+  });
+};
+
 module.exports = MenuItem;
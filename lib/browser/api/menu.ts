@@ -151,6 +151,25 @@ Menu.prototype.insert = function (pos, item) {
   this.commandsMap[item.commandId] = item;
 };
 
+Menu.prototype.remove = function (pos) {
+  if (pos < 0) {
+    throw new RangeError(`Position ${pos} cannot be less than 0`);
+  } else if (pos >= this.getItemCount()) {
+    throw new RangeError(`Position ${pos} must be less than the total MenuItem count`);
+  }
+
+  this.removeItem(pos);
+
+  // Forget the item.
+  const [item] = this.items.splice(pos, 1);
+  delete this.commandsMap[item.commandId];
+  if (item.type === 'radio') {
+    const group = this.groupsMap[item.groupId];
+    group.splice(group.indexOf(item), 1);
+    if (group.length === 0) delete this.groupsMap[item.groupId];
+  }
+};
+
 Menu.prototype._callMenuWillShow = function () {
   if (this.delegate) this.delegate.menuWillShow(this);
   for (const item of this.items) {
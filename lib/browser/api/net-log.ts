@@ -12,11 +12,33 @@ const stopLogging: typeof session.defaultSession.netLog.stopLogging = async () =
   return session.defaultSession.netLog.stopLogging();
 };
 
+const startRecording: typeof session.defaultSession.netLog.startRecording = (options) => {
+  if (!app.isReady()) return;
+  return session.defaultSession.netLog.startRecording(options);
+};
+
+const dumpRecording: typeof session.defaultSession.netLog.dumpRecording = async (path) => {
+  if (!app.isReady()) return;
+  return session.defaultSession.netLog.dumpRecording(path);
+};
+
+const stopRecording: typeof session.defaultSession.netLog.stopRecording = () => {
+  if (!app.isReady()) return;
+  return session.defaultSession.netLog.stopRecording();
+};
+
 export default {
   startLogging,
   stopLogging,
+  startRecording,
+  dumpRecording,
+  stopRecording,
   get currentlyLogging (): boolean {
     if (!app.isReady()) return false;
     return session.defaultSession.netLog.currentlyLogging;
+  },
+  get currentlyRecording (): boolean {
+    if (!app.isReady()) return false;
+    return session.defaultSession.netLog.currentlyRecording;
   }
 };
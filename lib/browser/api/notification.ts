@@ -1,8 +1,10 @@
 const {
   Notification: ElectronNotification,
-  isSupported
+  isSupported,
+  setMaxRate
 } = process._linkedBinding('electron_browser_notification');
 
 ElectronNotification.isSupported = isSupported;
+ElectronNotification.setMaxRate = setMaxRate;
 
 export default ElectronNotification;
@@ -1,3 +1,5 @@
+import { setPoolSizeLimit } from '@electron/internal/browser/api/utility-process';
+
 import { EventEmitter } from 'events';
 
 const {
@@ -5,7 +7,9 @@ const {
   getSystemIdleState,
   getSystemIdleTime,
   getCurrentThermalState,
-  isOnBatteryPower
+  isOnBatteryPower,
+  isPowerSaving,
+  setPowerSavingPolicy
 } = process._linkedBinding('electron_browser_power_monitor');
 
 class PowerMonitor extends EventEmitter implements Electron.PowerMonitor {
@@ -56,6 +60,23 @@ class PowerMonitor extends EventEmitter implements Electron.PowerMonitor {
   get onBatteryPower () {
     return this.isOnBatteryPower();
   }
+
+  setPowerSavingPolicy (policy: Electron.PowerSavingPolicy | null) {
+    if (policy !== null && typeof policy !== 'object') {
+      throw new TypeError('policy must be an object or null');
+    }
+    const poolSize = policy?.utilityProcessPoolSize;
+    if (poolSize != null && (!Number.isInteger(poolSize) || poolSize < 1)) {
+      throw new TypeError('utilityProcessPoolSize must be a positive integer');
+    }
+    setPowerSavingPolicy(policy, (active: boolean) => {
+      setPoolSizeLimit(active ? poolSize ?? 0 : 0);
+    });
+  }
+
+  isPowerSaving () {
+    return isPowerSaving();
+  }
 }
 
 module.exports = new PowerMonitor();
@@ -1,3 +1,5 @@
+import { makeStreamFromPipe } from '@electron/internal/browser/api/session';
+
 import { ProtocolRequest, session } from 'electron/main';
 import { createReadStream } from 'fs';
 import { Readable } from 'stream';
@@ -11,24 +13,6 @@ const ERR_UNEXPECTED = -9;
 
 const isBuiltInScheme = (scheme: string) => ['http', 'https', 'file'].includes(scheme);
 
-function makeStreamFromPipe (pipe: any): ReadableStream {
-  const buf = new Uint8Array(1024 * 1024 /* 1 MB */);
-  return new ReadableStream({
-    async pull (controller) {
-      try {
-        const rv = await pipe.read(buf);
-        if (rv > 0) {
-          controller.enqueue(buf.slice(0, rv));
-        } else {
-          controller.close();
-        }
-      } catch (e) {
-        controller.error(e);
-      }
-    }
-  });
-}
-
 function makeStreamFromFileInfo ({
   filePath,
   offset = 0,
@@ -74,12 +58,10 @@ function convertToRequestBody (uploadData: ProtocolRequest['uploadData']): Reque
           current = makeStreamFromPipe(chunk.body).getReader();
           return this.pull!(controller);
         } else if (chunk.type === 'blob') {
-          // Note that even though `getBlobData()` is a `Session` API, it doesn't
-          // actually use the `Session` context. Its implementation solely relies
-          // on global variables which allows us to implement this feature without
-          // knowledge of the `Session` associated with the current request by
-          // always pulling `Blob` data out of the default `Session`.
-          controller.enqueue(await session.defaultSession.getBlobData(chunk.blobUUID));
+          // Stream the blob like the other chunk types instead of reading it
+          // into memory in full.
+          current = makeStreamFromPipe(chunk.dataPipe).getReader();
+          return this.pull!(controller);
         } else {
           throw new Error(`Unknown upload data chunk type: ${chunk.type}`);
         }
@@ -145,6 +127,29 @@ Protocol.prototype.handle = function (this: Electron.Protocol, scheme: string, h
   if (!success) throw new Error(`Failed to register protocol: ${scheme}`);
 };
 
+// Only the request and the response pass through the main process, the pool
+// decides what the response is.
+Protocol.prototype.handleWithPool = function (this: Electron.Protocol, scheme: string, pool: Electron.UtilityProcessPool) {
+  if (pool == null || typeof pool.run !== 'function') {
+    throw new TypeError('Expected pool to be a UtilityProcessPool');
+  }
+  this.handle(scheme, async (req) => {
+    const body = req.body ? new Uint8Array(await req.arrayBuffer()) : null;
+    const res = await pool.run({
+      url: req.url,
+      method: req.method,
+      headers: Object.fromEntries(req.headers),
+      body
+    });
+    if (res == null || typeof res !== 'object') return Response.error();
+    return new Response(res.body ?? null, {
+      status: res.status,
+      statusText: res.statusText,
+      headers: res.headers
+    });
+  });
+};
+
 Protocol.prototype.unhandle = function (this: Electron.Protocol, scheme: string) {
   const unregister = isBuiltInScheme(scheme) ? this.uninterceptProtocol : this.unregisterProtocol;
   if (!unregister.call(this, scheme)) { throw new Error(`Failed to unhandle protocol: ${scheme}`); }
@@ -175,6 +180,8 @@ const protocol = {
   uninterceptProtocol: (...args) => session.defaultSession.protocol.uninterceptProtocol(...args),
   isProtocolIntercepted: (...args) => session.defaultSession.protocol.isProtocolIntercepted(...args),
   handle: (...args) => session.defaultSession.protocol.handle(...args),
+  handleDirectory: (...args) => session.defaultSession.protocol.handleDirectory(...args),
+  handleWithPool: (...args) => session.defaultSession.protocol.handleWithPool(...args),
   unhandle: (...args) => session.defaultSession.protocol.unhandle(...args),
   isProtocolHandled: (...args) => session.defaultSession.protocol.isProtocolHandled(...args)
 } as typeof Electron.protocol;
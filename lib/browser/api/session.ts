@@ -1,11 +1,57 @@
 import { fetchWithSession } from '@electron/internal/browser/api/net-fetch';
 import { net } from 'electron/main';
+import { ReadableStream } from 'stream/web';
+
 const { fromPartition, fromPath, Session } = process._linkedBinding('electron_browser_session');
 
+// Wraps a native pipe with a `read(buffer)` method, e.g. a blob's DataPipeHolder,
+// in a stream that only reads from it as the consumer pulls.
+export function makeStreamFromPipe (pipe: { read(buf: Uint8Array): Promise<number> }): ReadableStream {
+  const buf = new Uint8Array(1024 * 1024 /* 1 MB */);
+  return new ReadableStream({
+    async pull (controller) {
+      try {
+        const rv = await pipe.read(buf);
+        if (rv > 0) {
+          controller.enqueue(buf.slice(0, rv));
+        } else {
+          controller.close();
+        }
+      } catch (e) {
+        controller.error(e);
+      }
+    }
+  });
+}
+
 Session.prototype.fetch = function (input: RequestInfo, init?: RequestInit) {
   return fetchWithSession(input, init, this, net.request);
 };
 
+Session.prototype.getBlobStream = function (identifier: string) {
+  const pipe = this._getBlobDataPipe(String(identifier));
+  if (!pipe) throw new Error('Could not get blob data handle');
+  return makeStreamFromPipe(pipe) as any;
+};
+
+Session.prototype.loadExtensions = function (paths: string[], options?: Electron.LoadExtensionOptions) {
+  // Each load is read and validated on the thread pool, so starting them all
+  // at once lets them run in parallel.
+  return Promise.all(paths.map(path => this.loadExtension(path, options)));
+};
+
+// Sessions whose <webview> guests are created ahead of time, see
+// guest-view-manager.ts.
+export const webviewPreallocationSessions = new WeakSet<Electron.Session>();
+
+Session.prototype.setWebviewPreallocationEnabled = function (enabled: boolean) {
+  if (enabled) {
+    webviewPreallocationSessions.add(this);
+  } else {
+    webviewPreallocationSessions.delete(this);
+  }
+};
+
 export default {
   fromPartition,
   fromPath,
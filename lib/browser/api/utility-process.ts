@@ -1,13 +1,16 @@
 import { EventEmitter } from 'events';
 import { Duplex, PassThrough } from 'stream';
 import { Socket } from 'net';
+import * as os from 'os';
 import { MessagePortMain } from '@electron/internal/browser/message-port-main';
+import MessageChannelMain from '@electron/internal/browser/api/message-channel';
 const { _fork } = process._linkedBinding('electron_browser_utility_process');
 
 class ForkUtilityProcess extends EventEmitter implements Electron.UtilityProcess {
   #handle: ElectronInternal.UtilityProcessWrapper | null;
   #stdout: Duplex | null = null;
   #stderr: Duplex | null = null;
+  #sharedMemory: Electron.SharedMemory | null = null;
   constructor (modulePath: string, args?: string[], options?: Electron.ForkOptions) {
     super();
 
@@ -50,6 +53,12 @@ class ForkUtilityProcess extends EventEmitter implements Electron.UtilityProcess
       }
     }
 
+    if (options.sharedMemorySize != null) {
+      if (!Number.isInteger(options.sharedMemorySize) || options.sharedMemorySize <= 0) {
+        throw new TypeError('sharedMemorySize must be a positive integer.');
+      }
+    }
+
     if (typeof options.stdio === 'string') {
       const stdio : Array<'pipe' | 'ignore' | 'inherit'> = [];
       switch (options.stdio) {
@@ -89,6 +98,7 @@ class ForkUtilityProcess extends EventEmitter implements Electron.UtilityProcess
     }
 
     this.#handle = _fork({ options, modulePath, args });
+    this.#sharedMemory = this.#handle!.sharedMemory;
     this.#handle!.emit = (channel: string | symbol, ...args: any[]) => {
       if (channel === 'exit') {
         try {
@@ -121,6 +131,10 @@ class ForkUtilityProcess extends EventEmitter implements Electron.UtilityProcess
     return this.#handle?.pid;
   }
 
+  get sharedMemory () {
+    return this.#sharedMemory;
+  }
+
   get stdout () {
     return this.#stdout;
   }
@@ -129,7 +143,7 @@ class ForkUtilityProcess extends EventEmitter implements Electron.UtilityProcess
     return this.#stderr;
   }
 
-  postMessage (message: any, transfer?: MessagePortMain[]) {
+  postMessage (message: any, transfer?: (MessagePortMain | ArrayBuffer)[]) {
     if (Array.isArray(transfer)) {
       transfer = transfer.map((o: any) => o instanceof MessagePortMain ? o._internalPort : o);
       return this.#handle?.postMessage(message, transfer);
@@ -145,6 +159,183 @@ class ForkUtilityProcess extends EventEmitter implements Electron.UtilityProcess
   }
 }
 
+type PoolTask = {
+  message: any;
+  transfer: MessagePortMain[];
+  resolve: (result: any) => void;
+  reject: (error: Error) => void;
+  port?: MessagePortMain;
+};
+
+type PoolWorker = {
+  child: ForkUtilityProcess;
+  active: Set<PoolTask>;
+  // Set when the pool shrank, the worker exits once its tasks are done.
+  retiring: boolean;
+};
+
+class UtilityProcessPool extends EventEmitter implements Electron.UtilityProcessPool {
+  static #pools = new Set<UtilityProcessPool>();
+  // Upper bound on the workers of every pool while power saving, 0 for none.
+  static #sizeLimit = 0;
+
+  static setSizeLimit (limit: number) {
+    UtilityProcessPool.#sizeLimit = limit;
+    for (const pool of UtilityProcessPool.#pools) {
+      pool.#resize();
+    }
+  }
+
+  #modulePath: string;
+  #args: string[];
+  #options: Electron.ForkOptions;
+  #size: number;
+  #concurrency: number;
+  #workers: PoolWorker[] = [];
+  #queue: PoolTask[] = [];
+  #closed = false;
+
+  constructor (modulePath: string, args?: string[], options?: Electron.CreatePoolOptions & Electron.ForkOptions) {
+    super();
+
+    if (args != null && typeof args === 'object' && !Array.isArray(args)) {
+      options = args;
+      args = [];
+    }
+    const { size, concurrency, ...forkOptions } = options ?? {};
+
+    if (size != null && (!Number.isInteger(size) || size < 1)) {
+      throw new TypeError('size must be a positive integer.');
+    }
+    if (concurrency != null && (!Number.isInteger(concurrency) || concurrency < 1)) {
+      throw new TypeError('concurrency must be a positive integer.');
+    }
+
+    this.#modulePath = modulePath;
+    this.#args = args ?? [];
+    this.#options = forkOptions;
+    this.#size = size ?? os.cpus().length;
+    this.#concurrency = concurrency ?? 1;
+
+    UtilityProcessPool.#pools.add(this);
+    // Spawn every worker upfront so the first tasks don't pay for startup.
+    this.#resize();
+  }
+
+  get size () {
+    return this.#size;
+  }
+
+  get pendingTasks () {
+    return this.#queue.length;
+  }
+
+  run (message: any, transfer?: MessagePortMain[]): Promise<any> {
+    if (this.#closed) {
+      return Promise.reject(new Error('The utility process pool has been closed.'));
+    }
+    return new Promise((resolve, reject) => {
+      this.#queue.push({ message, transfer: transfer ?? [], resolve, reject });
+      this.#dispatch();
+    });
+  }
+
+  close () {
+    if (this.#closed) return;
+    this.#closed = true;
+    UtilityProcessPool.#pools.delete(this);
+    const error = new Error('The utility process pool has been closed.');
+    for (const task of this.#queue.splice(0)) {
+      task.reject(error);
+    }
+    for (const worker of this.#workers) {
+      worker.child.kill();
+    }
+  }
+
+  // Spawns or retires workers until the pool has its configured size, or the
+  // power saving limit when that is lower.
+  #resize () {
+    const limit = UtilityProcessPool.#sizeLimit;
+    const target = limit > 0 ? Math.min(this.#size, limit) : this.#size;
+    const live = this.#workers.filter(worker => !worker.retiring);
+    // The least busy workers are retired first, idle ones exit right away.
+    live.sort((a, b) => a.active.size - b.active.size);
+    for (const worker of live.splice(0, Math.max(0, live.length - target))) {
+      worker.retiring = true;
+      if (worker.active.size === 0) worker.child.kill();
+    }
+    for (let i = live.length; i < target; i++) {
+      this.#workers.push(this.#spawnWorker());
+    }
+    this.#dispatch();
+  }
+
+  #spawnWorker (): PoolWorker {
+    const worker: PoolWorker = {
+      child: new ForkUtilityProcess(this.#modulePath, this.#args, this.#options),
+      active: new Set(),
+      retiring: false
+    };
+    worker.child.once('exit', (code: number) => {
+      const index = this.#workers.indexOf(worker);
+      if (index !== -1) this.#workers.splice(index, 1);
+      const error = new Error(`Utility process exited with code ${code} while running the task.`);
+      for (const task of worker.active) {
+        task.port?.close();
+        task.reject(error);
+      }
+      worker.active.clear();
+      if (worker.retiring) return;
+      this.emit('worker-exit', code);
+      if (!this.#closed) {
+        this.#workers.push(this.#spawnWorker());
+        this.#dispatch();
+      }
+    });
+    return worker;
+  }
+
+  // Workers pull from a single queue, so a task always goes to whichever
+  // worker has the most free capacity when it is dispatched.
+  #dispatch () {
+    while (this.#queue.length > 0) {
+      let target: PoolWorker | null = null;
+      for (const worker of this.#workers) {
+        if (!worker.retiring && worker.active.size < this.#concurrency &&
+            (!target || worker.active.size < target.active.size)) {
+          target = worker;
+        }
+      }
+      if (!target) return;
+      this.#runTask(target, this.#queue.shift()!);
+    }
+  }
+
+  #runTask (worker: PoolWorker, task: PoolTask) {
+    const { port1, port2 } = new MessageChannelMain();
+    task.port = port1;
+    worker.active.add(task);
+    port1.once('message', (event: { data: any }) => {
+      port1.close();
+      if (!worker.active.delete(task)) return;
+      task.resolve(event.data);
+      if (worker.retiring && worker.active.size === 0) worker.child.kill();
+      this.#dispatch();
+    });
+    port1.start();
+    worker.child.postMessage(task.message, [port2, ...task.transfer]);
+  }
+}
+
 export function fork (modulePath: string, args?: string[], options?: Electron.ForkOptions) {
   return new ForkUtilityProcess(modulePath, args, options);
 }
+
+export function setPoolSizeLimit (limit: number) {
+  UtilityProcessPool.setSizeLimit(limit);
+}
+
+export function createPool (modulePath: string, args?: string[], options?: Electron.CreatePoolOptions & Electron.ForkOptions) {
+  return new UtilityProcessPool(modulePath, args, options);
+}
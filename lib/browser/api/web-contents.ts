@@ -196,6 +196,79 @@ function checkType<T> (value: T, type: 'number' | 'boolean' | 'string' | 'object
   return value;
 }
 
+// Scrolling for capturePageTiles runs in its own world so that page scripts
+// can't get in the way.
+const kCaptureWorldId = 998;
+
+const kDefaultTileSize = 1024;
+
+WebContents.prototype.capturePageTiles = async function (rect: Electron.Rectangle, options: any, callback?: (tile: Electron.CapturedTile) => any) {
+  if (typeof options === 'function') {
+    callback = options;
+    options = {};
+  }
+  options = options ?? {};
+  checkType(rect, 'object', 'rect');
+  checkType(options, 'object', 'options');
+  if (typeof callback !== 'function') {
+    throw new TypeError('callback must be a function');
+  }
+  const tileWidth = options.tileSize?.width ?? kDefaultTileSize;
+  const tileHeight = options.tileSize?.height ?? kDefaultTileSize;
+  if (!(tileWidth > 0 && tileHeight > 0)) {
+    throw new RangeError('tileSize must not be empty');
+  }
+  const { format, quality } = options;
+  if (format !== undefined && !['png', 'jpeg', 'webp'].includes(format)) {
+    throw new TypeError(`Unsupported format: ${format}`);
+  }
+
+  const run = (code: string) => this.executeJavaScriptInIsolatedWorld(kCaptureWorldId, [{ code }]);
+  const release = this._holdCapturer({ stayHidden: options.stayHidden, stayAwake: options.stayAwake });
+  try {
+    const page = await run(`({
+      scrollX, scrollY,
+      viewportWidth: document.documentElement.clientWidth,
+      viewportHeight: document.documentElement.clientHeight,
+      width: document.documentElement.scrollWidth,
+      height: document.documentElement.scrollHeight
+    })`);
+    const left = Math.max(0, Math.floor(rect.x));
+    const top = Math.max(0, Math.floor(rect.y));
+    const right = Math.min(page.width, Math.ceil(rect.x + rect.width));
+    const bottom = Math.min(page.height, Math.ceil(rect.y + rect.height));
+    // A tile has to fit in the viewport to be captured in one copy.
+    const width = Math.min(tileWidth, page.viewportWidth);
+    const height = Math.min(tileHeight, page.viewportHeight);
+    const zoom = this.getZoomFactor();
+
+    try {
+      for (let y = top; y < bottom; y += height) {
+        for (let x = left; x < right; x += width) {
+          const tile = { x, y, width: Math.min(width, right - x), height: Math.min(height, bottom - y) };
+          // Wait for the scrolled frame to be produced before copying it.
+          const [scrollX, scrollY] = await run(`new Promise(resolve => {
+            scrollTo(${x}, ${y});
+            requestAnimationFrame(() => requestAnimationFrame(() => resolve([scrollX, scrollY])));
+          })`);
+          const image = await this.capturePage({
+            x: Math.round((tile.x - scrollX) * zoom),
+            y: Math.round((tile.y - scrollY) * zoom),
+            width: Math.round(tile.width * zoom),
+            height: Math.round(tile.height * zoom)
+          });
+          const data = format ? await image.encode({ format, quality }) : image;
+          await callback({ rect: tile, data });
+        }
+      }
+    } finally {
+      await run(`scrollTo(${page.scrollX}, ${page.scrollY})`);
+    }
+  } finally {
+    release();
+  }
+};
+
 function parsePageSize (pageSize: string | ElectronInternal.PageSize) {
   if (typeof pageSize === 'string') {
     const format = paperFormats[pageSize.toLowerCase()];
@@ -217,8 +290,7 @@ function parsePageSize (pageSize: string | ElectronInternal.PageSize) {
 
 // Translate the options of printToPDF.
 
-let pendingPromise: Promise<any> | undefined;
-WebContents.prototype.printToPDF = async function (options) {
+function parsePrintToPDFOptions (options: Electron.PrintToPDFOptions) {
   const margins = checkType(options.margins ?? {}, 'object', 'margins');
   const pageSize = parsePageSize(options.pageSize ?? 'letter');
 
@@ -230,7 +302,7 @@ WebContents.prototype.printToPDF = async function (options) {
     throw new Error('margins must be less than or equal to pageSize');
   }
 
-  const printSettings = {
+  return {
     requestID: getNextId(),
     landscape: checkType(options.landscape ?? false, 'boolean', 'landscape'),
     displayHeaderFooter: checkType(options.displayHeaderFooter ?? false, 'boolean', 'displayHeaderFooter'),
@@ -248,17 +320,32 @@ WebContents.prototype.printToPDF = async function (options) {
     generateDocumentOutline: checkType(options.generateDocumentOutline ?? false, 'boolean', 'generateDocumentOutline'),
     ...pageSize
   };
+}
 
-  if (this._printToPDF) {
-    if (pendingPromise) {
-      pendingPromise = pendingPromise.then(() => this._printToPDF(printSettings));
-    } else {
-      pendingPromise = this._printToPDF(printSettings);
-    }
-    return pendingPromise;
+// Print jobs are serialized per WebContents, since its print manager only
+// tracks one headless job at a time. Different WebContents print in parallel.
+const pendingPrints = new WeakMap<Electron.WebContents, Promise<any>>();
+function queuePrintToPDF (webContents: Electron.WebContents, printSettings: any) {
+  if (webContents._printToPDF) {
+    const print = () => webContents._printToPDF(printSettings);
+    const pending = pendingPrints.get(webContents);
+    const promise = pending ? pending.then(print, print) : print();
+    pendingPrints.set(webContents, promise);
+    return promise;
   } else {
     throw new Error('Printing feature is disabled');
   }
+}
+
+WebContents.prototype.printToPDF = async function (options) {
+  return queuePrintToPDF(this, parsePrintToPDFOptions(options));
+};
+
+WebContents.prototype.printToPDFFile = async function (filePath, options = {}) {
+  if (typeof filePath !== 'string' || !path.isAbsolute(filePath)) {
+    throw new TypeError('filePath must be an absolute path');
+  }
+  await queuePrintToPDF(this, { ...parsePrintToPDFOptions(options), filePath });
 };
 
 // TODO(codebytere): deduplicate argument sanitization by moving rest of
@@ -345,6 +432,10 @@ WebContents.prototype.loadFile = function (filePath, options = {}) {
 type LoadError = { errorCode: number, errorDescription: string, url: string };
 
 WebContents.prototype.loadURL = function (url, options) {
+  // A load deferred until the window is shown is replaced by this one. Abort
+  // it before listening for the events of this load, so that only the
+  // promise of the replaced load is rejected.
+  this._abortDeferredLoad();
   const p = new Promise<void>((resolve, reject) => {
     const resolveAndCleanup = () => {
       removeListeners();
@@ -545,7 +636,7 @@ WebContents.prototype._init = function () {
   });
 
   // Dispatch IPC messages to the ipc module.
-  this.on('-ipc-message' as any, function (this: Electron.WebContents, event: Electron.IpcMainEvent, internal: boolean, channel: string, args: any[]) {
+  const dispatchIpcMessage = (event: Electron.IpcMainEvent, internal: boolean, channel: string, args: any[]) => {
     addSenderToEvent(event, this);
     if (internal) {
       ipcMainInternal.emit(channel, event, ...args);
@@ -557,6 +648,16 @@ WebContents.prototype._init = function () {
       ipc.emit(channel, event, ...args);
       ipcMain.emit(channel, event, ...args);
     }
+  };
+
+  this.on('-ipc-message' as any, function (event: Electron.IpcMainEvent, internal: boolean, channel: string, args: any[]) {
+    dispatchIpcMessage(event, internal, channel, args);
+  });
+
+  this.on('-ipc-message-batch' as any, function (batch: [Electron.IpcMainEvent, boolean, string, any[]][]) {
+    for (const [event, internal, channel, args] of batch) {
+      dispatchIpcMessage(event, internal, channel, args);
+    }
   });
 
   this.on('-ipc-invoke' as any, async function (this: Electron.WebContents, event: Electron.IpcMainInvokeEvent, internal: boolean, channel: string, args: any[]) {
@@ -898,3 +999,62 @@ export function getFocusedWebContents () {
 export function getAllWebContents () {
   return binding.getAllWebContents();
 }
+
+type PrintToPDFBatchJob = { url: string, options?: Electron.PrintToPDFOptions, filePath?: string };
+type PrintToPDFBatchOptions = { concurrency?: number, webPreferences?: Electron.WebPreferences };
+
+export async function printToPDFBatch (jobs: PrintToPDFBatchJob[], options: PrintToPDFBatchOptions = {}) {
+  if (!Array.isArray(jobs)) {
+    throw new TypeError('jobs must be an array');
+  }
+  const concurrency = checkType(options.concurrency ?? 2, 'number', 'concurrency');
+  if (!Number.isInteger(concurrency) || concurrency < 1) {
+    throw new TypeError('concurrency must be a positive integer');
+  }
+  const webPreferences = checkType(options.webPreferences ?? {}, 'object', 'webPreferences');
+
+  // Each worker owns one offscreen WebContents and pulls the next job as soon
+  // as its previous one is printed, so loading and layout in one WebContents
+  // overlap with PDF compositing in the others.
+  const results: Electron.PrintToPDFBatchResult[] = new Array(jobs.length);
+  let nextJob = 0;
+  const runWorker = async () => {
+    let contents: Electron.WebContents | undefined;
+    try {
+      while (nextJob < jobs.length) {
+        const index = nextJob++;
+        const job = jobs[index];
+        if (!contents || contents.isDestroyed() || contents.isCrashed()) {
+          if (contents && !contents.isDestroyed()) contents.destroy();
+          contents = create({ ...webPreferences, offscreen: true });
+        }
+
+        const result: Electron.PrintToPDFBatchResult = { loadTime: 0, printTime: 0 };
+        const loadStart = performance.now();
+        try {
+          await contents.loadURL(job.url);
+          const printStart = performance.now();
+          result.loadTime = printStart - loadStart;
+          if (job.filePath) {
+            await contents.printToPDFFile(job.filePath, job.options);
+          } else {
+            result.data = await contents.printToPDF(job.options ?? {});
+          }
+          result.printTime = performance.now() - printStart;
+        } catch (error) {
+          result.error = error instanceof Error ? error.message : String(error);
+        }
+        results[index] = result;
+      }
+    } finally {
+      if (contents && !contents.isDestroyed()) contents.destroy();
+    }
+  };
+
+  const workers = [];
+  for (let i = 0; i < Math.min(concurrency, jobs.length); i++) {
+    workers.push(runWorker());
+  }
+  await Promise.all(workers);
+  return results;
+}
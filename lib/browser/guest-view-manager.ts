@@ -5,6 +5,7 @@ import { parseWebViewWebPreferences } from '@electron/internal/browser/parse-fea
 import { syncMethods, asyncMethods, properties } from '@electron/internal/common/web-view-methods';
 import { webViewEvents } from '@electron/internal/browser/web-view-events';
 import { IPC_MESSAGES } from '@electron/internal/common/ipc-messages';
+import { webviewPreallocationSessions } from '@electron/internal/browser/api/session';
 
 interface GuestInstance {
   elementInstanceId: number;
@@ -21,6 +22,46 @@ const supportedWebViewEvents = Object.keys(webViewEvents);
 const guestInstances = new Map<number, GuestInstance>();
 const embedderElementsMap = new Map<string, number>();
 
+// Unattached guests created ahead of time for the next <webview> of an
+// embedder, keyed by the embedder and the web preferences they were created
+// with, see Session.setWebviewPreallocationEnabled.
+const preallocatedGuests = new Map<string, Electron.WebContents>();
+
+const getPreallocationKey = function (embedder: Electron.WebContents, webPreferences: Electron.WebPreferences) {
+  return `${embedder.id}-${JSON.stringify(webPreferences)}`;
+};
+
+const takePreallocatedGuest = function (key: string) {
+  const guest = preallocatedGuests.get(key);
+  if (!guest) return null;
+  preallocatedGuests.delete(key);
+  if (guest.isDestroyed()) return null;
+  if (!webviewPreallocationSessions.has(guest.session)) {
+    guest.destroy();
+    return null;
+  }
+  return guest;
+};
+
+const preallocateGuest = function (embedder: Electron.WebContents, webPreferences: Electron.WebPreferences, key: string) {
+  if (embedder.isDestroyed() || preallocatedGuests.has(key)) return;
+  const guest = (webContents as typeof ElectronInternal.WebContents).create({
+    ...webPreferences,
+    type: 'webview',
+    embedder
+  });
+  preallocatedGuests.set(key, guest);
+};
+
+const destroyPreallocatedGuests = function (embedder: Electron.WebContents) {
+  for (const [key, guest] of preallocatedGuests) {
+    if (key.startsWith(`${embedder.id}-`)) {
+      preallocatedGuests.delete(key);
+      if (!guest.isDestroyed()) guest.destroy();
+    }
+  }
+};
+
 function makeWebPreferences (embedder: Electron.WebContents, params: Record<string, any>) {
   // parse the 'webpreferences' attribute string, if set
   // this uses the same parsing rules as window.open uses for its features
@@ -96,13 +137,16 @@ const createGuest = function (embedder: Electron.WebContents, embedderFrameId: n
     return -1;
   }
 
-  const guest = (webContents as typeof ElectronInternal.WebContents).create({
-    ...webPreferences,
-    type: 'webview',
-    embedder
-  });
+  const preallocationKey = getPreallocationKey(embedder, webPreferences);
+  const guest = takePreallocatedGuest(preallocationKey) ??
+    (webContents as typeof ElectronInternal.WebContents).create({
+      ...webPreferences,
+      type: 'webview',
+      embedder
+    });
 
   const guestInstanceId = guest.id;
+  const guestSession = guest.session;
   guestInstances.set(guestInstanceId, {
     elementInstanceId,
     guest,
@@ -114,6 +158,11 @@ const createGuest = function (embedder: Electron.WebContents, embedderFrameId: n
     if (guestInstances.has(guestInstanceId)) {
       detachGuest(embedder, guestInstanceId);
     }
+    // Have a guest ready in case the <webview> is being recreated, e.g. when
+    // the user switches between panes of the embedder.
+    if (webviewPreallocationSessions.has(guestSession)) {
+      setImmediate(() => preallocateGuest(embedder, webPreferences, preallocationKey));
+    }
   });
 
   // Init guest web view after attached.
@@ -248,6 +297,7 @@ const watchEmbedder = function (embedder: Electron.WebContents) {
         detachGuest(embedder, guestInstanceId);
       }
     }
+    destroyPreallocatedGuests(embedder);
     // Clear the listeners.
     embedder.removeListener('-window-visibility-change' as any, onVisibilityChange);
     watchedEmbedders.delete(embedder);
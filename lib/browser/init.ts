@@ -3,6 +3,7 @@ import * as fs from 'fs';
 import * as path from 'path';
 
 import type * as defaultMenuModule from '@electron/internal/browser/default-menu';
+import type * as definePropertiesModule from '@electron/internal/common/define-properties';
 import type * as url from 'url';
 import type * as v8 from 'v8';
 
@@ -69,6 +70,20 @@ if (process.platform === 'win32') {
   }
 }
 
+// Report which built-in modules were needed to get through startup.
+if (process.env.ELECTRON_LOG_MODULE_LOADS) {
+  app.once('ready', () => {
+    setImmediate(() => {
+      const { getLoadedModules } = require('@electron/internal/common/define-properties') as typeof definePropertiesModule;
+      const modules = getLoadedModules();
+      console.log(`Electron loaded ${modules.length} built-in modules during startup:`);
+      for (const { name, loadTime } of modules) {
+        console.log(`  ${name}: ${loadTime.toFixed(2)}ms`);
+      }
+    });
+  });
+}
+
 // Map process.exit to app.exit, which quits gracefully.
 process.exit = app.exit as () => never;
 
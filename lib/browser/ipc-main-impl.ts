@@ -28,7 +28,34 @@ export class IpcMainImpl extends EventEmitter implements Electron.IpcMain {
     });
   };
 
+  // The pool runs the handler, the main process only forwards the arguments
+  // to it and the result back.
+  handleWithPool: Electron.IpcMain['handleWithPool'] = (method, pool) => {
+    if (pool == null || typeof pool.run !== 'function') {
+      throw new TypeError('Expected pool to be a UtilityProcessPool');
+    }
+    this.handle(method, (e, ...args) => pool.run({ channel: method, args }));
+  };
+
   removeHandler (method: string) {
     this._invokeHandlers.delete(method);
   }
+
+  // Only ipcMain itself supports sync replies and metrics, see
+  // api/ipc-main.ts.
+  setSyncReply: Electron.IpcMain['setSyncReply'] = () => {
+    throw new Error('setSyncReply() is only supported on ipcMain');
+  };
+
+  removeSyncReply: Electron.IpcMain['removeSyncReply'] = () => {
+    throw new Error('removeSyncReply() is only supported on ipcMain');
+  };
+
+  getMetrics: Electron.IpcMain['getMetrics'] = () => {
+    throw new Error('getMetrics() is only supported on ipcMain');
+  };
+
+  resetMetrics: Electron.IpcMain['resetMetrics'] = () => {
+    throw new Error('resetMetrics() is only supported on ipcMain');
+  };
 }
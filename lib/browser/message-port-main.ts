@@ -1,18 +1,23 @@
 import { EventEmitter } from 'events';
 
+const wrapMessageEvent = (event: { ports: any[] }) => {
+  return { ...event, ports: event.ports.map(p => new MessagePortMain(p)) };
+};
+
 export class MessagePortMain extends EventEmitter implements Electron.MessagePortMain {
   _internalPort: any;
   constructor (internalPort: any) {
     super();
     this._internalPort = internalPort;
-    this._internalPort.emit = (channel: string, event: {ports: any[]}) => {
-      if (channel === 'message') { event = { ...event, ports: event.ports.map(p => new MessagePortMain(p)) }; }
+    this._internalPort.emit = (channel: string, event: any) => {
+      if (channel === 'message') { event = wrapMessageEvent(event); }
+      if (channel === 'message-batch') { event = event.map(wrapMessageEvent); }
       this.emit(channel, event);
     };
   }
 
-  start () {
-    return this._internalPort.start();
+  start (options?: Electron.StartOptions) {
+    return this._internalPort.start(options);
   }
 
   close () {
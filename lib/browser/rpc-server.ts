@@ -1,5 +1,7 @@
 import { clipboard } from 'electron/common';
+import * as crypto from 'crypto';
 import * as fs from 'fs';
+import * as path from 'path';
 import { ipcMainInternal } from '@electron/internal/browser/ipc-main-internal';
 import * as ipcMainUtils from '@electron/internal/browser/ipc-main-internal-utils';
 import { IPC_MESSAGES } from '@electron/internal/common/ipc-messages';
@@ -41,22 +43,83 @@ ipcMainUtils.handleSync(IPC_MESSAGES.BROWSER_CLIPBOARD_SYNC, function (event, me
   return (clipboard as any)[method](...args);
 });
 
-const getPreloadScript = async function (preloadPath: string) {
+// Renderers send code caches of their preload scripts back to be stored here,
+// so a cache that is larger than this is very unlikely to be genuine.
+const kMaxPreloadCodeCacheSize = 64 * 1024 * 1024;
+
+// Identifies a version of a preload script. Code caches are only valid for the
+// same V8 as well. A code cache is trusted bytecode produced by a renderer, so
+// it is also keyed by the origin of the frame that produced it and is only
+// ever used by frames of that same origin.
+const getPreloadCacheKey = async function (preloadPath: string, origin: string) {
+  const stat = await fs.promises.stat(preloadPath);
+  return crypto.createHash('sha256')
+    .update(`${preloadPath}\0${stat.mtimeMs}\0${stat.size}\0${process.versions.v8}\0${origin}`)
+    .digest('hex');
+};
+
+// Returns the origin that code caches of |frame| are keyed by, or null when
+// they must not be stored, e.g. for opaque origins, which don't identify a
+// principal other renderers could share.
+const getPreloadCacheOrigin = function (frame: Electron.WebFrameMain | null) {
+  const origin = frame?.origin;
+  return origin && origin !== 'null' ? origin : null;
+};
+
+const readPreloadCodeCache = async function (codeCacheDir: string, cacheKey: string) {
+  try {
+    return await fs.promises.readFile(path.join(codeCacheDir, cacheKey));
+  } catch {
+    return null;
+  }
+};
+
+const writePreloadCodeCache = async function (codeCacheDir: string, preloadPath: string, origin: string, codeCache: Uint8Array) {
+  const file = path.join(codeCacheDir, await getPreloadCacheKey(preloadPath, origin));
+  // Write to a temporary file first so that other renderers never read a
+  // partially written cache.
+  const tempFile = `${file}.${process.pid}.${crypto.randomBytes(4).toString('hex')}.tmp`;
+  await fs.promises.mkdir(codeCacheDir, { recursive: true });
+  try {
+    await fs.promises.writeFile(tempFile, codeCache);
+    await fs.promises.rename(tempFile, file);
+  } catch (error) {
+    await fs.promises.rm(tempFile, { force: true });
+    throw error;
+  }
+};
+
+// |cachedKeys| are the preload scripts the renderer process already has from
+// loading an earlier frame, those are not read or sent again.
+const getPreloadScript = async function (preloadPath: string, origin: string, codeCacheDir: string | null, cachedKeys: Set<string>) {
+  let cacheKey = null;
+  let cached = false;
   let preloadSrc = null;
   let preloadError = null;
+  let codeCache = null;
   try {
-    preloadSrc = await fs.promises.readFile(preloadPath, 'utf8');
+    cacheKey = await getPreloadCacheKey(preloadPath, origin);
+    cached = cachedKeys.has(cacheKey);
+    if (!cached) {
+      preloadSrc = await fs.promises.readFile(preloadPath, 'utf8');
+      if (codeCacheDir) {
+        codeCache = await readPreloadCodeCache(codeCacheDir, cacheKey);
+      }
+    }
   } catch (error) {
     preloadError = error;
   }
-  return { preloadPath, preloadSrc, preloadError };
+  return { preloadPath, cacheKey, cached, preloadSrc, preloadError, codeCacheEnabled: !!codeCacheDir, codeCache };
 };
 
-ipcMainUtils.handleSync(IPC_MESSAGES.BROWSER_SANDBOX_LOAD, async function (event) {
+ipcMainUtils.handleSync(IPC_MESSAGES.BROWSER_SANDBOX_LOAD, async function (event, cachedKeys: unknown) {
   const preloadPaths = event.sender._getPreloadPaths();
+  const origin = getPreloadCacheOrigin(event.senderFrame);
+  const codeCacheDir = origin ? event.sender.session._getPreloadCodeCachePath() : null;
+  const cachedKeySet = new Set(Array.isArray(cachedKeys) ? cachedKeys.filter(key => typeof key === 'string') : []);
 
   return {
-    preloadScripts: await Promise.all(preloadPaths.map(path => getPreloadScript(path))),
+    preloadScripts: await Promise.all(preloadPaths.map(path => getPreloadScript(path, origin ?? '', codeCacheDir, cachedKeySet))),
     process: {
       arch: process.arch,
       platform: process.platform,
@@ -75,3 +138,17 @@ ipcMainUtils.handleSync(IPC_MESSAGES.BROWSER_NONSANDBOX_LOAD, function (event) {
 ipcMainInternal.on(IPC_MESSAGES.BROWSER_PRELOAD_ERROR, function (event, preloadPath: string, error: Error) {
   event.sender.emit('preload-error', event, preloadPath, error);
 });
+
+ipcMainInternal.on(IPC_MESSAGES.BROWSER_PRELOAD_CODE_CACHE, function (event, preloadPath: string, codeCache: Uint8Array) {
+  const codeCacheDir = event.sender.session._getPreloadCodeCachePath();
+  if (!codeCacheDir || !(codeCache instanceof Uint8Array) || codeCache.byteLength > kMaxPreloadCodeCacheSize) return;
+  // Only accept caches for the preload scripts of the sender, and store them
+  // where only frames of the sender's origin will read them.
+  if (!event.sender._getPreloadPaths().includes(preloadPath)) return;
+  const origin = getPreloadCacheOrigin(event.senderFrame);
+  if (!origin) return;
+
+  writePreloadCodeCache(codeCacheDir, preloadPath, origin, codeCache).catch(error => {
+    console.warn(`Failed to write the code cache for ${preloadPath}: ${error}`);
+  });
+});
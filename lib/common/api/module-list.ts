@@ -1,5 +1,7 @@
 // Common modules, please sort alphabetically
 export const commonModuleList: ElectronInternal.ModuleEntry[] = [
   { name: 'nativeImage', loader: () => require('./native-image') },
-  { name: 'shell', loader: () => require('./shell') }
+  { name: 'sharedMemory', loader: () => require('./shared-memory') },
+  { name: 'shell', loader: () => require('./shell') },
+  { name: 'traceEvents', loader: () => require('./trace-events') }
 ];
@@ -12,6 +12,7 @@ const {
 } = process._linkedBinding('electron_common_net');
 
 const kHttpProtocols = new Set(['http:', 'https:']);
+const kRequestPriorities = new Set(['throttled', 'idle', 'lowest', 'low', 'medium', 'highest']);
 
 // set of headers that Node.js discards duplicates for
 // see https://nodejs.org/api/http.html#http_message_headers
@@ -287,8 +288,17 @@ function parseOptions (optionsIn: ClientRequestConstructorOptions | string): Nod
     origin: options.origin,
     referrerPolicy: options.referrerPolicy,
     cache: options.cache,
+    responseBufferSize: options.responseBufferSize,
+    priority: options.priority,
     allowNonHttpProtocols: Object.hasOwn(options, kAllowNonHttpProtocols)
   };
+  if (options.responseBufferSize !== undefined &&
+      (!Number.isSafeInteger(options.responseBufferSize) || options.responseBufferSize < 0 || options.responseBufferSize > 0xFFFFFFFF)) {
+    throw new TypeError('`responseBufferSize` should be a non-negative integer');
+  }
+  if (options.priority !== undefined && !kRequestPriorities.has(options.priority)) {
+    throw new TypeError(`Invalid request priority '${options.priority}'`);
+  }
   const headers: Record<string, string | string[]> = options.headers || {};
   for (const [name, value] of Object.entries(headers)) {
     validateHeader(name, value);
@@ -440,7 +450,9 @@ export class ClientRequest extends Writable implements Electron.ClientRequest {
       this.emit('response', response);
     });
     this._urlLoader.on('data', (event, data, resume) => {
-      this._response!._storeInternalData(Buffer.from(data), resume);
+      // Buffered responses arrive as views into larger ArrayBuffers.
+      const chunk = ArrayBuffer.isView(data) ? Buffer.from(data.buffer, data.byteOffset, data.byteLength) : Buffer.from(data);
+      this._response!._storeInternalData(chunk, resume);
     });
     this._urlLoader.on('complete', () => {
       if (this._response) { this._response._storeInternalData(null, null); }
@@ -0,0 +1,3 @@
+const { sharedMemory } = process._linkedBinding('electron_common_shared_memory');
+
+export default sharedMemory;
@@ -0,0 +1,3 @@
+const { traceEvents } = process._linkedBinding('electron_common_trace_events');
+
+export default traceEvents;
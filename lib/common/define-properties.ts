@@ -1,16 +1,35 @@
-const handleESModule = (loader: ElectronInternal.ModuleLoader) => () => {
-  const value = loader();
-  if (value.__esModule && value.default) return value.default;
-  return value;
+const loadedModules: ElectronInternal.LoadedModule[] = [];
+
+const handleESModule = (name: string, loader: ElectronInternal.ModuleLoader) => {
+  let loaded = false;
+  return () => {
+    // The loader is called on every access rather than caching its result
+    // here, since during a circular require it can return a partially
+    // evaluated module. Node's require cache makes repeated calls cheap.
+    const start = loaded ? 0 : performance.now();
+    const value = loader();
+    if (!loaded) {
+      loaded = true;
+      loadedModules.push({ name, loadTime: performance.now() - start });
+    }
+    if (value.__esModule && value.default) return value.default;
+    return value;
+  };
 };
 
+// Returns the built-in modules that have been accessed so far, in the order
+// they were first accessed.
+export function getLoadedModules () {
+  return loadedModules.slice();
+}
+
 // Attaches properties to |targetExports|.
 export function defineProperties (targetExports: Object, moduleList: ElectronInternal.ModuleEntry[]) {
   const descriptors: PropertyDescriptorMap = {};
   for (const module of moduleList) {
     descriptors[module.name] = {
       enumerable: true,
-      get: handleESModule(module.loader)
+      get: handleESModule(module.name, module.loader)
     };
   }
   return Object.defineProperties(targetExports, descriptors);
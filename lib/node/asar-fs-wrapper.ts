@@ -111,6 +111,9 @@ enum AsarFileType {
   kLink = (constants as any).UV_DIRENT_LINK,
 }
 
+// Reported by readdirWithTypes() for entries that could not be found.
+const UV_DIRENT_UNKNOWN = (constants as any).UV_DIRENT_UNKNOWN;
+
 const fileTypeToMode = new Map<AsarFileType, number>([
   [AsarFileType.kFile, constants.S_IFREG],
   [AsarFileType.kDirectory, constants.S_IFDIR],
@@ -200,7 +203,10 @@ const overrideAPISync = function (module: Record<string, any>, name: string, pat
   module[name] = func;
 };
 
-const overrideAPI = function (module: Record<string, any>, name: string, pathArgumentIndex?: number | null) {
+// Copying out a compressed file decompresses it, which is done off the main
+// thread unless |copyOutAsync| is false because the overridden API has to
+// return its result synchronously.
+const overrideAPI = function (module: Record<string, any>, name: string, pathArgumentIndex?: number | null, copyOutAsync: boolean = true) {
   if (pathArgumentIndex == null) pathArgumentIndex = 0;
   const old = module[name];
   module[name] = function (this: any, ...args: any[]) {
@@ -221,6 +227,18 @@ const overrideAPI = function (module: Record<string, any>, name: string, pathArg
       return;
     }
 
+    if (copyOutAsync && archive.getFileInfo(filePath)?.compressed) {
+      archive.copyFileOutAsync(filePath, (newPath) => {
+        if (!newPath) {
+          callback(createError(AsarError.NOT_FOUND, { asarPath, filePath }));
+          return;
+        }
+        args[pathArgumentIndex!] = newPath;
+        old.apply(this, args);
+      });
+      return;
+    }
+
     const newPath = archive.copyFileOut(filePath);
     if (!newPath) {
       const error = createError(AsarError.NOT_FOUND, { asarPath, filePath });
@@ -233,14 +251,18 @@ const overrideAPI = function (module: Record<string, any>, name: string, pathArg
   };
 
   if (old[util.promisify.custom]) {
-    module[name][util.promisify.custom] = makePromiseFunction(old[util.promisify.custom], pathArgumentIndex);
+    module[name][util.promisify.custom] = makePromiseFunction(old[util.promisify.custom], pathArgumentIndex, copyOutAsync);
   }
 
   if (module.promises && module.promises[name]) {
-    module.promises[name] = makePromiseFunction(module.promises[name], pathArgumentIndex);
+    module.promises[name] = makePromiseFunction(module.promises[name], pathArgumentIndex, copyOutAsync);
   }
 };
 
+function isUtf8Encoding (encoding: BufferEncoding | null | undefined) {
+  return encoding === 'utf8' || encoding === 'utf-8';
+}
+
 let crypto: typeof Crypto;
 function validateBufferIntegrity (buffer: Buffer, integrity: NodeJS.AsarFileInfo['integrity']) {
   if (!integrity) return;
@@ -255,7 +277,7 @@ function validateBufferIntegrity (buffer: Buffer, integrity: NodeJS.AsarFileInfo
   }
 }
 
-const makePromiseFunction = function (orig: Function, pathArgumentIndex: number) {
+const makePromiseFunction = function (orig: Function, pathArgumentIndex: number, copyOutAsync: boolean) {
   return function (this: any, ...args: any[]) {
     const pathArgument = args[pathArgumentIndex];
     const pathInfo = splitPath(pathArgument);
@@ -267,6 +289,21 @@ const makePromiseFunction = function (orig: Function, pathArgumentIndex: number)
       return Promise.reject(createError(AsarError.INVALID_ARCHIVE, { asarPath }));
     }
 
+    if (copyOutAsync && archive.getFileInfo(filePath)?.compressed) {
+      return new Promise<string>((resolve, reject) => {
+        archive.copyFileOutAsync(filePath, (newPath) => {
+          if (newPath) {
+            resolve(newPath);
+          } else {
+            reject(createError(AsarError.NOT_FOUND, { asarPath, filePath }));
+          }
+        });
+      }).then((newPath) => {
+        args[pathArgumentIndex] = newPath;
+        return orig.apply(this, args);
+      });
+    }
+
     const newPath = archive.copyFileOut(filePath);
     if (!newPath) {
       return Promise.reject(createError(AsarError.NOT_FOUND, { asarPath, filePath }));
@@ -458,7 +495,7 @@ export const wrapFsWithAsar = (fs: Record<string, any>) => {
       return;
     }
 
-    const pathExists = (archive.stat(filePath) !== false);
+    const pathExists = (archive.getType(filePath) !== -1);
     nextTick(callback, [pathExists]);
   };
 
@@ -473,7 +510,7 @@ export const wrapFsWithAsar = (fs: Record<string, any>) => {
       return Promise.reject(error);
     }
 
-    return Promise.resolve(archive.stat(filePath) !== false);
+    return Promise.resolve(archive.getType(filePath) !== -1);
   };
 
   const { existsSync } = fs;
@@ -490,7 +527,7 @@ export const wrapFsWithAsar = (fs: Record<string, any>) => {
     const archive = getOrCreateArchive(asarPath);
     if (!archive) return false;
 
-    return archive.stat(filePath) !== false;
+    return archive.getType(filePath) !== -1;
   };
 
   const { access } = fs;
@@ -615,6 +652,20 @@ export const wrapFsWithAsar = (fs: Record<string, any>) => {
         return fs.readFile(realPath, options, callback);
       }
 
+      // Compressed files are decompressed natively off the main thread, the
+      // fd only has the compressed bytes.
+      if (info.compressed) {
+        logASARAccess(asarPath, filePath, info.offset);
+        archive.readCompressed(filePath, isUtf8Encoding(encoding), (contents) => {
+          if (contents === undefined) {
+            callback(createError(AsarError.INVALID_ARCHIVE, { asarPath }));
+            return;
+          }
+          callback(null, (encoding && typeof contents !== 'string') ? contents.toString(encoding) : contents);
+        });
+        return;
+      }
+
       const buffer = Buffer.alloc(info.size);
       const fd = archive.getFdAndValidateIntegrityLater();
       if (!(fd >= 0)) {
@@ -679,6 +730,13 @@ export const wrapFsWithAsar = (fs: Record<string, any>) => {
     }
 
     const { encoding } = options;
+    const mapped = archive.readMapped(filePath, isUtf8Encoding(encoding));
+    if (mapped !== undefined) {
+      logASARAccess(asarPath, filePath, info.offset);
+      return (encoding && typeof mapped !== 'string') ? mapped.toString(encoding) : mapped;
+    }
+    if (info.compressed) throw createError(AsarError.INVALID_ARCHIVE, { asarPath });
+
     const buffer = Buffer.alloc(info.size);
     const fd = archive.getFdAndValidateIntegrityLater();
     if (!(fd >= 0)) throw createError(AsarError.NOT_FOUND, { asarPath, filePath });
@@ -720,30 +778,29 @@ export const wrapFsWithAsar = (fs: Record<string, any>) => {
       return;
     }
 
-    const files = archive.readdir(filePath);
-    if (!files) {
+    const result = options?.withFileTypes ? archive.readdirWithTypes(filePath) : archive.readdir(filePath);
+    if (!result) {
       const error = createError(AsarError.NOT_FOUND, { asarPath, filePath });
       nextTick(callback!, [error]);
       return;
     }
 
     if (options?.withFileTypes) {
+      const [files, types] = result as [string[], Uint8Array];
       const dirents = [];
-      for (const file of files) {
-        const childPath = path.join(filePath, file);
-        const stats = archive.stat(childPath);
-        if (!stats) {
-          const error = createError(AsarError.NOT_FOUND, { asarPath, filePath: childPath });
+      for (let i = 0; i < files.length; i++) {
+        if (types[i] === UV_DIRENT_UNKNOWN) {
+          const error = createError(AsarError.NOT_FOUND, { asarPath, filePath: path.join(filePath, files[i]) });
           nextTick(callback!, [error]);
           return;
         }
-        dirents.push(new fs.Dirent(file, stats.type));
+        dirents.push(new fs.Dirent(files[i], types[i]));
       }
       nextTick(callback!, [null, dirents]);
       return;
     }
 
-    nextTick(callback!, [null, files]);
+    nextTick(callback!, [null, result]);
   };
 
   const { readdir: readdirPromise } = require('fs').promises;
@@ -768,25 +825,24 @@ export const wrapFsWithAsar = (fs: Record<string, any>) => {
       return Promise.reject(createError(AsarError.INVALID_ARCHIVE, { asarPath }));
     }
 
-    const files = archive.readdir(filePath);
-    if (!files) {
+    const result = options?.withFileTypes ? archive.readdirWithTypes(filePath) : archive.readdir(filePath);
+    if (!result) {
       return Promise.reject(createError(AsarError.NOT_FOUND, { asarPath, filePath }));
     }
 
     if (options?.withFileTypes) {
+      const [files, types] = result as [string[], Uint8Array];
       const dirents = [];
-      for (const file of files) {
-        const childPath = path.join(filePath, file);
-        const stats = archive.stat(childPath);
-        if (!stats) {
-          throw createError(AsarError.NOT_FOUND, { asarPath, filePath: childPath });
+      for (let i = 0; i < files.length; i++) {
+        if (types[i] === UV_DIRENT_UNKNOWN) {
+          throw createError(AsarError.NOT_FOUND, { asarPath, filePath: path.join(filePath, files[i]) });
         }
-        dirents.push(new fs.Dirent(file, stats.type));
+        dirents.push(new fs.Dirent(files[i], types[i]));
       }
       return Promise.resolve(dirents);
     }
 
-    return Promise.resolve(files);
+    return Promise.resolve(result);
   };
 
   const { readdirSync } = fs;
@@ -811,25 +867,24 @@ export const wrapFsWithAsar = (fs: Record<string, any>) => {
       throw createError(AsarError.INVALID_ARCHIVE, { asarPath });
     }
 
-    const files = archive.readdir(filePath);
-    if (!files) {
+    const result = options?.withFileTypes ? archive.readdirWithTypes(filePath) : archive.readdir(filePath);
+    if (!result) {
       throw createError(AsarError.NOT_FOUND, { asarPath, filePath });
     }
 
     if (options?.withFileTypes) {
+      const [files, types] = result as [string[], Uint8Array];
       const dirents = [];
-      for (const file of files) {
-        const childPath = path.join(filePath, file);
-        const stats = archive.stat(childPath);
-        if (!stats) {
-          throw createError(AsarError.NOT_FOUND, { asarPath, filePath: childPath });
+      for (let i = 0; i < files.length; i++) {
+        if (types[i] === UV_DIRENT_UNKNOWN) {
+          throw createError(AsarError.NOT_FOUND, { asarPath, filePath: path.join(filePath, files[i]) });
         }
-        dirents.push(new fs.Dirent(file, stats.type));
+        dirents.push(new fs.Dirent(files[i], types[i]));
       }
       return dirents;
     }
 
-    return files;
+    return result;
   };
 
   const binding = internalBinding('fs');
@@ -842,6 +897,10 @@ export const wrapFsWithAsar = (fs: Record<string, any>) => {
     const archive = getOrCreateArchive(asarPath);
     if (!archive) return [];
 
+    // Most package.json lookups during module resolution are for files that
+    // do not exist, which getType() answers from its cache.
+    if (archive.getType(filePath) === -1) return [];
+
     const info = archive.getFileInfo(filePath);
     if (!info) return [];
     if (info.size === 0) return ['', false];
@@ -851,6 +910,13 @@ export const wrapFsWithAsar = (fs: Record<string, any>) => {
       return [str, str.length > 0];
     }
 
+    const mapped = archive.readMapped(filePath, true);
+    if (typeof mapped === 'string') {
+      logASARAccess(asarPath, filePath, info.offset);
+      return [mapped, mapped.length > 0];
+    }
+    if (info.compressed) return [];
+
     const buffer = Buffer.alloc(info.size);
     const fd = archive.getFdAndValidateIntegrityLater();
     if (!(fd >= 0)) return [];
@@ -873,10 +939,10 @@ export const wrapFsWithAsar = (fs: Record<string, any>) => {
     if (!archive) return -34;
 
     // -ENOENT
-    const stats = archive.stat(filePath);
-    if (!stats) return -34;
+    const type = archive.getType(filePath);
+    if (type === -1) return -34;
 
-    return (stats.type === AsarFileType.kDirectory) ? 1 : 0;
+    return (type === AsarFileType.kDirectory) ? 1 : 0;
   };
 
   async function readdirRecursive (originalPath: string, options: ReaddirOptions) {
@@ -1113,6 +1179,48 @@ export const wrapFsWithAsar = (fs: Record<string, any>) => {
   overrideAPISync(Module._extensions, '.node', 1);
   overrideAPISync(fs, 'openSync');
 
+  // An archive can carry a V8 code cache for each of its JavaScript files,
+  // written by a build step. Modules that have one are compiled with it, which
+  // skips parsing and compiling their top-level code. V8 rejects a cache that
+  // does not match the source or the running V8 version, in which case the
+  // module is simply compiled from source.
+  //
+  // This only does what Node.js does for a plain CommonJS module. Modules are
+  // left to Node.js when it would do more: while an inspector is attached,
+  // which Node.js reports the scripts it compiles to; when source maps are
+  // enabled, which Node.js registers for each module; when a policy manifest
+  // checks the integrity of modules; and when it is told the module's format.
+  const { _compile } = Module.prototype as any;
+  const { getOptionValue } = __non_webpack_require__('internal/options');
+  const canUseCodeCache = (args: any[]) => {
+    return (args[0] === undefined || args[0] === 'commonjs') &&
+      require('inspector').url() === undefined &&
+      !((process as any).sourceMapsEnabled ?? getOptionValue('--enable-source-maps')) &&
+      !getOptionValue('--experimental-policy');
+  };
+  (Module.prototype as any)._compile = function (this: NodeJS.Module, content: string, filename: string, ...args: any[]) {
+    const pathInfo = splitPath(filename);
+    const cachedData = pathInfo.isAsar ? getOrCreateArchive(pathInfo.asarPath)?.readCodeCache(pathInfo.filePath) : undefined;
+    if (!cachedData || !canUseCodeCache(args)) {
+      return Reflect.apply(_compile, this, [content, filename, ...args]);
+    }
+
+    const vm = require('vm') as typeof import('vm');
+    const { makeRequireFunction, setHasStartedUserCJSExecution } = __non_webpack_require__('internal/modules/helpers');
+    // V8 only accepts a hashbang at the very start of a script, which the
+    // wrapper moves it away from. It is blanked out, keeping line numbers.
+    const script = new vm.Script(Module.wrap(content.replace(/^#!.*/, '')), {
+      filename,
+      cachedData,
+      importModuleDynamically: (vm as any).constants.USE_MAIN_CONTEXT_DEFAULT_LOADER
+    });
+    const compiledWrapper = script.runInThisContext({ displayErrors: true });
+    setHasStartedUserCJSExecution?.();
+    return Reflect.apply(compiledWrapper, this.exports, [
+      this.exports, makeRequireFunction(this), this, filename, path.dirname(filename), process, global, Buffer
+    ]);
+  };
+
   const overrideChildProcess = (childProcess: Record<string, any>) => {
     // Executing a command string containing a path to an asar archive
     // confuses `childProcess.execFile`, which is internally called by
@@ -1123,7 +1231,8 @@ export const wrapFsWithAsar = (fs: Record<string, any>) => {
     childProcess.exec[util.promisify.custom] = invokeWithNoAsar(exec[util.promisify.custom]);
     childProcess.execSync = invokeWithNoAsar(execSync);
 
-    overrideAPI(childProcess, 'execFile');
+    // execFile() returns the child process, so it has to copy out synchronously.
+    overrideAPI(childProcess, 'execFile', 0, false);
     overrideAPISync(childProcess, 'execFileSync');
   };
 
@@ -3,9 +3,25 @@ import { EventEmitter } from 'events';
 const { ipc } = process._linkedBinding('electron_renderer_ipc');
 
 const internal = false;
+
+// Pages that do not render, e.g. hidden ones, get no animation frames.
+const kFrameAlignedFallbackDelay = 100;
+
+type IpcMessageEvent = { sender: Electron.IpcRenderer, ports: MessagePort[] };
+
+const channelPriorities = new Map<string, 'urgent' | 'bulk'>();
+const frameAlignedChannels = new Set<string>();
+let pendingMessages: [string, IpcMessageEvent, any[]][] = [];
+let pendingFrame: number | null = null;
+let pendingTimeout: ReturnType<typeof setTimeout> | null = null;
+
 class IpcRenderer extends EventEmitter implements Electron.IpcRenderer {
   send (channel: string, ...args: any[]) {
-    return ipc.send(internal, channel, args);
+    return ipc.send(internal, channel, args, channelPriorities.get(channel));
+  }
+
+  sendBatched (channel: string, ...args: any[]) {
+    return ipc.sendBatched(internal, channel, args);
   }
 
   sendSync (channel: string, ...args: any[]) {
@@ -27,6 +43,58 @@ class IpcRenderer extends EventEmitter implements Electron.IpcRenderer {
   postMessage (channel: string, message: any, transferables: any) {
     return ipc.postMessage(channel, message, transferables);
   }
+
+  setChannelPriority (channel: string, priority: 'urgent' | 'normal' | 'bulk') {
+    if (typeof channel !== 'string') {
+      throw new TypeError('channel must be a string');
+    }
+    if (priority === 'urgent' || priority === 'bulk') {
+      channelPriorities.set(channel, priority);
+    } else if (priority === 'normal') {
+      channelPriorities.delete(channel);
+    } else {
+      throw new TypeError('priority must be one of \'urgent\', \'normal\' or \'bulk\'');
+    }
+  }
+
+  setFrameAligned (channel: string, aligned: boolean = true) {
+    if (typeof channel !== 'string') {
+      throw new TypeError('channel must be a string');
+    }
+    if (aligned) {
+      frameAlignedChannels.add(channel);
+    } else {
+      frameAlignedChannels.delete(channel);
+    }
+  }
+}
+
+const ipcRenderer = new IpcRenderer();
+
+function flushPendingMessages () {
+  if (pendingFrame !== null) cancelAnimationFrame(pendingFrame);
+  if (pendingTimeout !== null) clearTimeout(pendingTimeout);
+  pendingFrame = pendingTimeout = null;
+
+  const messages = pendingMessages;
+  pendingMessages = [];
+  for (const [channel, event, args] of messages) {
+    ipcRenderer.emit(channel, event, ...args);
+  }
+}
+
+// Emits a message received from the main process, or holds it until right
+// before the next animation frame when its channel is frame aligned.
+export function emitMessage (channel: string, event: IpcMessageEvent, args: any[]) {
+  if (!frameAlignedChannels.has(channel)) {
+    ipcRenderer.emit(channel, event, ...args);
+    return;
+  }
+  pendingMessages.push([channel, event, args]);
+  if (pendingMessages.length === 1) {
+    pendingFrame = requestAnimationFrame(flushPendingMessages);
+    pendingTimeout = setTimeout(flushPendingMessages, kFrameAlignedFallbackDelay);
+  }
 }
 
-export default new IpcRenderer();
+export default ipcRenderer;
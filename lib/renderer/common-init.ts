@@ -1,4 +1,5 @@
 import { ipcRenderer } from 'electron/renderer';
+import { emitMessage } from '@electron/internal/renderer/api/ipc-renderer';
 import { ipcRendererInternal } from '@electron/internal/renderer/ipc-renderer-internal';
 
 import type * as webViewInitModule from '@electron/internal/renderer/web-view/web-view-init';
@@ -18,8 +19,11 @@ const isWebView = mainFrame.getWebPreference('isWebView');
 // invoking the 'onMessage' callback.
 v8Util.setHiddenValue(global, 'ipcNative', {
   onMessage (internal: boolean, channel: string, ports: MessagePort[], args: any[]) {
-    const sender = internal ? ipcRendererInternal : ipcRenderer;
-    sender.emit(channel, { sender, ports }, ...args);
+    if (internal) {
+      ipcRendererInternal.emit(channel, { sender: ipcRendererInternal, ports }, ...args);
+    } else {
+      emitMessage(channel, { sender: ipcRenderer, ports }, args);
+    }
   }
 });
 
@@ -15,6 +15,10 @@ export const moduleList: ElectronInternal.ModuleEntry[] = [
     name: 'nativeImage',
     loader: () => require('@electron/internal/common/api/native-image')
   },
+  {
+    name: 'traceEvents',
+    loader: () => require('@electron/internal/common/api/trace-events')
+  },
   {
     name: 'webFrame',
     loader: () => require('@electron/internal/renderer/api/web-frame')
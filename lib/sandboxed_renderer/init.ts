@@ -8,7 +8,15 @@ import type * as ipcRendererInternalModule from '@electron/internal/renderer/ipc
 declare const binding: {
   get: (name: string) => any;
   process: NodeJS.Process;
-  createPreloadScript: (src: string) => Function
+  createPreloadScript: (src: string, params: string[], codeCache: Uint8Array | null) => {
+    preloadFn: Function;
+    codeCacheRejected: boolean;
+  };
+  createPreloadCodeCache: (fn: Function) => Uint8Array | null;
+  getCachedPreloadKeys: () => string[];
+  getCachedPreload: (key: string) => { preloadSrc: string; codeCache: Uint8Array | null } | null;
+  setCachedPreload: (key: string, src: string, codeCache: Uint8Array | null) => void;
+  setCachedPreloadCodeCache: (key: string, codeCache: Uint8Array) => void;
 };
 
 const { EventEmitter } = events;
@@ -37,11 +45,34 @@ const {
 } = ipcRendererUtils.invokeSync<{
   preloadScripts: {
     preloadPath: string;
+    cacheKey: string | null;
+    cached: boolean;
     preloadSrc: string | null;
     preloadError: null | Error;
+    codeCacheEnabled: boolean;
+    codeCache: Uint8Array | null;
   }[];
   process: NodeJS.Process;
-}>(IPC_MESSAGES.BROWSER_SANDBOX_LOAD);
+}>(IPC_MESSAGES.BROWSER_SANDBOX_LOAD, binding.getCachedPreloadKeys());
+
+// Take the scripts this process already has out of its cache before adding
+// the new ones, which could evict them.
+for (const script of preloadScripts) {
+  if (script.cached) {
+    const cachedPreload = binding.getCachedPreload(script.cacheKey!);
+    if (cachedPreload) {
+      script.preloadSrc = cachedPreload.preloadSrc;
+      script.codeCache = cachedPreload.codeCache;
+    } else {
+      script.preloadError = new Error('Preload script is missing from the cache');
+    }
+  }
+}
+for (const { cacheKey, cached, preloadSrc, codeCache } of preloadScripts) {
+  if (!cached && cacheKey && preloadSrc) {
+    binding.setCachedPreload(cacheKey, preloadSrc, codeCache);
+  }
+}
 
 const electron = require('electron');
 
@@ -113,29 +144,39 @@ if (hasSwitch('unsafely-expose-electron-internals-for-testing')) {
 // Common renderer initialization
 require('@electron/internal/renderer/common-init');
 
-// Wrap the script into a function executed in global scope. It won't have
+// Compile the script as a function executed in global scope. It won't have
 // access to the current scope, so we'll expose a few objects as arguments:
 //
 // - `require`: The `preloadRequire` function
 // - `process`: The `preloadProcess` object
 // - `Buffer`: Shim of `Buffer` implementation
 // - `global`: The window object, which is aliased to `global` by webpack.
-function runPreloadScript (preloadSrc: string) {
-  const preloadWrapperSrc = `(function(require, process, Buffer, global, setImmediate, clearImmediate, exports, module) {
-  ${preloadSrc}
-  })`;
+const preloadParams = ['require', 'process', 'Buffer', 'global', 'setImmediate', 'clearImmediate', 'exports', 'module'];
 
+function runPreloadScript (preloadPath: string, cacheKey: string | null, preloadSrc: string, codeCacheEnabled: boolean, codeCache: Uint8Array | null) {
   // eval in window scope
-  const preloadFn = binding.createPreloadScript(preloadWrapperSrc);
+  const { preloadFn, codeCacheRejected } = binding.createPreloadScript(preloadSrc, preloadParams, codeCache);
   const exports = {};
 
   preloadFn(preloadRequire, preloadProcess, Buffer, global, setImmediate, clearImmediate, exports, { exports });
+
+  // The other frames of this process use the code cache even when it is not
+  // stored on disk.
+  if (cacheKey && (!codeCache || codeCacheRejected)) {
+    const newCodeCache = binding.createPreloadCodeCache(preloadFn);
+    if (newCodeCache) {
+      binding.setCachedPreloadCodeCache(cacheKey, newCodeCache);
+      if (codeCacheEnabled) {
+        ipcRendererInternal.send(IPC_MESSAGES.BROWSER_PRELOAD_CODE_CACHE, preloadPath, newCodeCache);
+      }
+    }
+  }
 }
 
-for (const { preloadPath, preloadSrc, preloadError } of preloadScripts) {
+for (const { preloadPath, cacheKey, preloadSrc, preloadError, codeCacheEnabled, codeCache } of preloadScripts) {
   try {
     if (preloadSrc) {
-      runPreloadScript(preloadSrc);
+      runPreloadScript(preloadPath, cacheKey, preloadSrc, codeCacheEnabled, codeCache);
     } else if (preloadError) {
       throw preloadError;
     }
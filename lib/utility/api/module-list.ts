@@ -1,4 +1,6 @@
 // Utility side modules, please sort alphabetically.
 export const utilityNodeModuleList: ElectronInternal.ModuleEntry[] = [
-  { name: 'net', loader: () => require('./net') }
+  { name: 'net', loader: () => require('./net') },
+  { name: 'sharedMemory', loader: () => require('@electron/internal/common/api/shared-memory') },
+  { name: 'traceEvents', loader: () => require('@electron/internal/common/api/trace-events') }
 ];
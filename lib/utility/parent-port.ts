@@ -16,6 +16,10 @@ export class ParentPort extends EventEmitter implements Electron.ParentPort {
     };
   }
 
+  get sharedMemory () : Electron.SharedMemory | null {
+    return this.#port.sharedMemory;
+  }
+
   start () : void {
     this.#port.start();
   }
@@ -24,7 +28,10 @@ export class ParentPort extends EventEmitter implements Electron.ParentPort {
     this.#port.pause();
   }
 
-  postMessage (message: any) : void {
+  postMessage (message: any, transfer?: ArrayBuffer[]) : void {
+    if (Array.isArray(transfer)) {
+      return this.#port.postMessage(message, transfer);
+    }
     this.#port.postMessage(message);
   }
 }
@@ -40,3 +40,40 @@ if (typeof self !== 'undefined' && self.location.protocol === 'file:') {
     global.module.paths = Module._nodeModulePaths(appPath);
   }
 }
+
+// Every worker compiles the modules it requires in its own isolate. Share the
+// V8 code cache of the modules between the workers of the renderer process,
+// so that only the first one to load a module pays the full compile cost.
+//
+// Modules in asar archives are left to the previous _compile, which uses the
+// code cache the archive may carry, and so is everything while an inspector
+// is attached, so that Node.js reports the scripts it compiles to it.
+const codeCache = process._linkedBinding('electron_renderer_code_cache');
+const { splitPath } = process._linkedBinding('electron_common_asar');
+const vm = require('vm') as typeof import('vm');
+const inspector = require('inspector') as typeof import('inspector');
+const importModuleDynamically = (vm as any).constants.USE_MAIN_CONTEXT_DEFAULT_LOADER;
+
+const { _compile } = Module.prototype as any;
+(Module.prototype as any)._compile = function (this: NodeJS.Module, content: string, filename: string, ...args: any[]) {
+  if (inspector.url() !== undefined || splitPath(filename).isAsar) {
+    return Reflect.apply(_compile, this, [content, filename, ...args]);
+  }
+  const cachedData = codeCache.get(filename, content);
+  const script = new vm.Script(Module.wrap(content), {
+    filename,
+    cachedData,
+    importModuleDynamically
+  });
+  const compiledWrapper = script.runInThisContext({ displayErrors: true });
+  const dirname = path.dirname(filename);
+  const result = Reflect.apply(compiledWrapper, this.exports, [
+    this.exports, makeRequireFunction(this), this, filename, dirname, process, global, Buffer
+  ]);
+  // Created once the module has run, so that the functions it called while
+  // loading are in the cache too.
+  if (cachedData === undefined || script.cachedDataRejected) {
+    codeCache.set(filename, content, script.createCachedData());
+  }
+  return result;
+};
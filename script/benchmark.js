@@ -0,0 +1,161 @@
+#!/usr/bin/env node
+
+// Runs the benchmarks in spec/benchmarks against the local build.
+//
+// By default the IPC benchmarks are run once, with the arguments passed
+// through, e.g.
+//   node script/benchmark.js --filter=ipc --iterations=10000 --json-output=out.json
+//
+// With --startup the startup benchmark app is launched --runs times (after
+// --warmup-runs discarded launches) and the statistics of each startup phase
+// and of the memory used per window are reported, e.g.
+//   node script/benchmark.js --startup --runs=30 --json-output=out.json
+//
+// With --asar synthetic archives of varying size, depth and with or without
+// integrity are generated in a temporary directory, and header parsing,
+// lookups, reads and require() inside them are measured, e.g.
+//   node script/benchmark.js --asar --json-output=out.json
+//
+// With --net page fetches are measured against a local server and through
+// each kind of protocol handler, with and without webRequest listeners, e.g.
+//   node script/benchmark.js --net --filter=handle --json-output=out.json
+//
+// With --osr an offscreen window is driven with synthetic input and
+// animation to measure input-to-paint latency, the frame rate achieved for
+// each requested one and the bytes copied per frame, e.g.
+//   node script/benchmark.js --osr --frame-rates=30,60 --json-output=out.json
+const cp = require('node:child_process');
+const fs = require('node:fs');
+const os = require('node:os');
+const path = require('node:path');
+const utils = require('./lib/utils');
+
+const electronPath = utils.getAbsoluteElectronExec();
+const benchmarksPath = path.resolve(__dirname, '../spec/benchmarks');
+
+const kResultMarker = 'STARTUP BENCHMARK RESULT: ';
+
+function runBenchmarkApp (appPath, args) {
+  const child = cp.spawn(electronPath, [appPath, ...args], { stdio: 'inherit' });
+  child.on('close', (code) => process.exit(code));
+}
+
+function parseStartupArgs (argv) {
+  const options = { runs: 20, warmupRuns: 2, jsonOutput: null };
+  for (const arg of argv) {
+    const [key, value] = arg.replace(/^--/, '').split('=');
+    if (key === 'runs') options.runs = parseInt(value, 10);
+    else if (key === 'warmup-runs') options.warmupRuns = parseInt(value, 10);
+    else if (key === 'json-output') options.jsonOutput = path.resolve(value);
+  }
+  return options;
+}
+
+function launchOnce (userDataPath) {
+  const { status, stdout, stderr } = cp.spawnSync(electronPath, [
+    path.join(benchmarksPath, 'startup'),
+    `--bench-user-data=${userDataPath}`
+  ], { encoding: 'utf8', timeout: 60000 });
+  const line = stdout.split('\n').find(line => line.startsWith(kResultMarker));
+  if (status !== 0 || !line) {
+    throw new Error(`Startup benchmark app failed (exit code ${status}):\n${stdout}${stderr}`);
+  }
+  return JSON.parse(line.slice(kResultMarker.length));
+}
+
+function summarize (values) {
+  const sorted = Float64Array.from(values).sort();
+  const percentile = (p) => sorted[Math.min(sorted.length - 1, Math.floor(sorted.length * p))];
+  return {
+    min: sorted[0],
+    mean: sorted.reduce((sum, value) => sum + value, 0) / sorted.length,
+    p50: percentile(0.5),
+    p90: percentile(0.9),
+    max: sorted[sorted.length - 1]
+  };
+}
+
+function runStartupBenchmark () {
+  const options = parseStartupArgs(process.argv.slice(2));
+  // Every launch shares one profile, so the measured runs see warm caches
+  // like a normal app launch does after the first one.
+  const userDataPath = fs.mkdtempSync(path.join(os.tmpdir(), 'electron-startup-benchmark-'));
+
+  const runs = [];
+  try {
+    for (let i = 0; i < options.warmupRuns + options.runs; i++) {
+      const result = launchOnce(userDataPath);
+      if (i >= options.warmupRuns) runs.push(result);
+    }
+  } finally {
+    fs.rmSync(userDataPath, { recursive: true, force: true });
+  }
+
+  // Phases that were not reached in every run are left out, since their
+  // statistics would not be comparable.
+  const phases = Object.keys(runs[0].timeline)
+    .filter(name => runs.every(run => name in run.timeline));
+  const metrics = {};
+  for (const name of phases) {
+    metrics[name] = summarize(runs.map(run => run.timeline[name]));
+  }
+  metrics.rendererMemory = summarize(runs.map(run => run.rendererMemory));
+  metrics.totalMemory = summarize(runs.map(run => run.totalMemory));
+
+  for (const [name, stats] of Object.entries(metrics)) {
+    const unit = name.endsWith('Memory') ? 'KB' : 'ms';
+    const format = (value) => `${value.toFixed(1)}${unit}`.padStart(12);
+    console.log(`${name.padEnd(28)} min${format(stats.min)}  p50${format(stats.p50)}` +
+      `  p90${format(stats.p90)}  max${format(stats.max)}`);
+  }
+
+  if (options.jsonOutput) {
+    fs.mkdirSync(path.dirname(options.jsonOutput), { recursive: true });
+    fs.writeFileSync(options.jsonOutput, JSON.stringify({
+      platform: process.platform,
+      arch: process.arch,
+      date: new Date().toISOString(),
+      options: { runs: options.runs, warmupRuns: options.warmupRuns },
+      // Times are milliseconds since the process was launched.
+      metrics,
+      runs
+    }, null, 2));
+  }
+}
+
+function runAsarBenchmark () {
+  const { generate } = require(path.join(benchmarksPath, 'asar', 'generate'));
+  const archivesPath = fs.mkdtempSync(path.join(os.tmpdir(), 'electron-asar-benchmark-'));
+  const cleanup = () => fs.rmSync(archivesPath, { recursive: true, force: true });
+
+  let manifestPath;
+  try {
+    manifestPath = generate(archivesPath);
+  } catch (error) {
+    cleanup();
+    throw error;
+  }
+
+  const args = process.argv.slice(2).filter(arg => arg !== '--asar');
+  const child = cp.spawn(electronPath, [
+    path.join(benchmarksPath, 'asar'),
+    `--manifest=${manifestPath}`,
+    ...args
+  ], { stdio: 'inherit' });
+  child.on('close', (code) => {
+    cleanup();
+    process.exit(code);
+  });
+}
+
+if (process.argv.includes('--startup')) {
+  runStartupBenchmark();
+} else if (process.argv.includes('--asar')) {
+  runAsarBenchmark();
+} else if (process.argv.includes('--net')) {
+  runBenchmarkApp(path.join(benchmarksPath, 'net'), process.argv.slice(2).filter(arg => arg !== '--net'));
+} else if (process.argv.includes('--osr')) {
+  runBenchmarkApp(path.join(benchmarksPath, 'osr'), process.argv.slice(2).filter(arg => arg !== '--osr'));
+} else {
+  runBenchmarkApp(benchmarksPath, process.argv.slice(2));
+}
@@ -5,6 +5,7 @@
 #include "shell/app/electron_main_delegate.h"
 
 #include <iostream>
+#include <limits>
 #include <memory>
 #include <string>
 #include <string_view>
@@ -16,8 +17,10 @@
 #include "base/debug/stack_trace.h"
 #include "base/environment.h"
 #include "base/files/file_util.h"
+#include "base/functional/bind.h"
 #include "base/logging.h"
 #include "base/path_service.h"
+#include "base/task/thread_pool.h"
 #include "base/strings/string_split.h"
 #include "chrome/common/chrome_paths.h"
 #include "chrome/common/chrome_switches.h"
@@ -36,6 +39,8 @@
 #include "shell/browser/electron_gpu_client.h"
 #include "shell/browser/feature_list.h"
 #include "shell/browser/relauncher.h"
+#include "shell/browser/single_instance_handoff.h"
+#include "shell/browser/startup_timeline.h"
 #include "shell/common/application_info.h"
 #include "shell/common/electron_paths.h"
 #include "shell/common/logging.h"
@@ -207,13 +212,7 @@ void RegisterPathProvider() {
                                       PATH_END);
 }
 
-}  // namespace
-
-std::string LoadResourceBundle(const std::string& locale) {
-  const bool initialized = ui::ResourceBundle::HasSharedInstance();
-  DCHECK(!initialized);
-
-  // Load other resource files.
+base::FilePath GetPakDirectory() {
   base::FilePath pak_dir;
 #if BUILDFLAG(IS_MAC)
   pak_dir =
@@ -221,6 +220,35 @@ std::string LoadResourceBundle(const std::string& locale) {
 #else
   base::PathService::Get(base::DIR_MODULE, &pak_dir);
 #endif
+  return pak_dir;
+}
+
+}  // namespace
+
+void PreReadResourceBundle() {
+  const base::FilePath pak_dir = GetPakDirectory();
+  // The locale pak isn't included since the locale is only known once the
+  // app has had a chance to change it, it is also by far the smallest one.
+  for (const auto* name :
+       {FILE_PATH_LITERAL("resources.pak"),
+        FILE_PATH_LITERAL("chrome_100_percent.pak"),
+        FILE_PATH_LITERAL("chrome_200_percent.pak")}) {
+    // Each file gets its own task so that they are read concurrently.
+    base::ThreadPool::PostTask(
+        FROM_HERE, {base::MayBlock(), base::TaskPriority::USER_BLOCKING},
+        base::BindOnce(base::IgnoreResult(&base::PreReadFile),
+                       pak_dir.Append(name), /*is_executable=*/false,
+                       /*sequential=*/true,
+                       std::numeric_limits<int64_t>::max()));
+  }
+}
+
+std::string LoadResourceBundle(const std::string& locale) {
+  const bool initialized = ui::ResourceBundle::HasSharedInstance();
+  DCHECK(!initialized);
+
+  // Load other resource files.
+  const base::FilePath pak_dir = GetPakDirectory();
 
   std::string loaded_locale = ui::ResourceBundle::InitSharedInstanceWithLocale(
       locale, nullptr, ui::ResourceBundle::LOAD_COMMON_RESOURCES);
@@ -312,6 +340,16 @@ std::optional<int> ElectronMainDelegate::BasicStartupComplete() {
       ::switches::kDisableGpuMemoryBufferCompositorResources);
 #endif
 
+  if (IsBrowserProcess()) {
+    // A running instance that asked for an early handoff gets the command
+    // line of this one before anything else is loaded.
+    if (electron::single_instance_handoff::NotifyRecordedInstance())
+      return 0;
+
+    electron::startup_timeline::Record(
+        electron::startup_timeline::Phase::kBasicStartupComplete);
+  }
+
   return std::nullopt;
 }
 
@@ -17,6 +17,11 @@ class TracingSamplerProfiler;
 
 namespace electron {
 
+// Reads the pak files LoadResourceBundle() maps into the page cache on the
+// thread pool, so that the main thread doesn't fault them in from disk when
+// the resources are first used.
+void PreReadResourceBundle();
+
 std::string LoadResourceBundle(const std::string& locale);
 
 class ElectronMainDelegate : public content::ContentMainDelegate {
@@ -28,6 +28,7 @@
 #include "shell/app/uv_task_runner.h"
 #include "shell/browser/javascript_environment.h"
 #include "shell/common/api/electron_bindings.h"
+#include "shell/common/electron_constants.h"
 #include "shell/common/gin_helper/dictionary.h"
 #include "shell/common/node_bindings.h"
 #include "shell/common/node_includes.h"
@@ -99,10 +100,17 @@ bool UnsetHijackableEnvs(base::Environment* env) {
 }
 #endif
 
-#if IS_MAS_BUILD()
 void SetCrashKeyStub(const std::string& key, const std::string& value) {}
 void ClearCrashKeyStub(const std::string& key) {}
-#endif
+
+// Returns true if the process should skip every Chromium subsystem that is
+// not required to run plain Node.js code, i.e. the crash reporter, the
+// feature list and the base::ThreadPool.
+bool IsMinimalBootstrap(base::Environment* env) {
+  std::string value;
+  return env->GetVar(electron::kRunAsNodeMinimal, &value) && !value.empty() &&
+         value != "0";
+}
 
 }  // namespace
 
@@ -124,6 +132,8 @@ int NodeMain(int argc, char* argv[]) {
   }
 
   auto os_env = base::Environment::Create();
+  const bool minimal = IsMinimalBootstrap(os_env.get());
+
   bool node_options_enabled = electron::fuses::IsNodeOptionsEnabled();
   if (!node_options_enabled) {
     os_env->UnSetVar("NODE_OPTIONS");
@@ -150,7 +160,8 @@ int NodeMain(int argc, char* argv[]) {
 #endif  // BUILDFLAG(IS_MAC)
 
 #if BUILDFLAG(IS_WIN)
-  v8_crashpad_support::SetUp();
+  if (!minimal)
+    v8_crashpad_support::SetUp();
 #endif
 
 #if BUILDFLAG(IS_LINUX)
@@ -175,13 +186,21 @@ int NodeMain(int argc, char* argv[]) {
     auto uv_task_runner = base::MakeRefCounted<UvTaskRunner>(loop);
     base::SingleThreadTaskRunner::CurrentDefaultHandle handle(uv_task_runner);
 
-    // Initialize feature list.
-    auto feature_list = std::make_unique<base::FeatureList>();
-    feature_list->InitFromCommandLine("", "");
-    base::FeatureList::SetInstance(std::move(feature_list));
+    // Initialize feature list. Nothing reachable from pure Node.js code
+    // queries features, so the minimal bootstrap relies on their defaults.
+    if (!minimal) {
+      auto feature_list = std::make_unique<base::FeatureList>();
+      feature_list->InitFromCommandLine("", "");
+      base::FeatureList::SetInstance(std::move(feature_list));
+    }
 
-    // Explicitly register electron's builtin bindings.
-    NodeBindings::RegisterBuiltinBindings();
+    // Explicitly register electron's builtin bindings. Most of them post to
+    // base::ThreadPool or query features, so the minimal bootstrap only
+    // registers the ones plain Node.js code needs.
+    if (minimal)
+      NodeBindings::RegisterMinimalBuiltinBindings();
+    else
+      NodeBindings::RegisterBuiltinBindings();
 
     // Hack around with the argv pointer. Used for process.title = "blah".
     argv = uv_setup_args(argc, argv);
@@ -206,7 +225,7 @@ int NodeMain(int argc, char* argv[]) {
 #if BUILDFLAG(IS_LINUX)
     // On Linux, initialize crashpad after Nodejs init phase so that
     // crash and termination signal handlers can be set by the crashpad client.
-    if (!pid_string.empty()) {
+    if (!minimal && !pid_string.empty()) {
       auto* command_line = base::CommandLine::ForCurrentProcess();
       command_line->AppendSwitchASCII(
           crash_reporter::switches::kCrashpadHandlerPid, pid_string);
@@ -219,18 +238,23 @@ int NodeMain(int argc, char* argv[]) {
       command_line->RemoveSwitch(crash_reporter::switches::kCrashpadHandlerPid);
     }
 #elif BUILDFLAG(IS_WIN) || (BUILDFLAG(IS_MAC) && !IS_MAS_BUILD())
-    ElectronCrashReporterClient::Create();
-    crash_reporter::InitializeCrashpad(false, "node");
-    crash_keys::SetCrashKeysFromCommandLine(
-        *base::CommandLine::ForCurrentProcess());
-    crash_keys::SetPlatformCrashKey();
+    if (!minimal) {
+      ElectronCrashReporterClient::Create();
+      crash_reporter::InitializeCrashpad(false, "node");
+      crash_keys::SetCrashKeysFromCommandLine(
+          *base::CommandLine::ForCurrentProcess());
+      crash_keys::SetPlatformCrashKey();
+    }
 #endif
 
     gin::V8Initializer::LoadV8Snapshot(
         gin::V8SnapshotFileType::kWithAdditionalContext);
 
-    // V8 requires a task scheduler.
-    base::ThreadPoolInstance::CreateAndStartWithDefaultParams("Electron");
+    // V8 requires a task scheduler. The minimal bootstrap runs V8 on top of
+    // Node.js' own platform only, and none of the bindings it registers post
+    // to base::ThreadPool.
+    if (!minimal)
+      base::ThreadPoolInstance::CreateAndStartWithDefaultParams("Electron");
 
     // Allow Node.js to track the amount of time the event loop has spent
     // idle in the kernel’s event provider .
@@ -275,10 +299,15 @@ int NodeMain(int argc, char* argv[]) {
       reporter.SetMethod("addExtraParameter", &SetCrashKeyStub);
       reporter.SetMethod("removeExtraParameter", &ClearCrashKeyStub);
 #else
-      reporter.SetMethod("addExtraParameter",
-                         &electron::crash_keys::SetCrashKey);
-      reporter.SetMethod("removeExtraParameter",
-                         &electron::crash_keys::ClearCrashKey);
+      if (minimal) {
+        reporter.SetMethod("addExtraParameter", &SetCrashKeyStub);
+        reporter.SetMethod("removeExtraParameter", &ClearCrashKeyStub);
+      } else {
+        reporter.SetMethod("addExtraParameter",
+                           &electron::crash_keys::SetCrashKey);
+        reporter.SetMethod("removeExtraParameter",
+                           &electron::crash_keys::ClearCrashKey);
+      }
 #endif
 
       process.Set("crashReporter", reporter);
@@ -304,7 +333,8 @@ int NodeMain(int argc, char* argv[]) {
   // gin::IsolateHolder waits for tasks running in ThreadPool in its
   // destructor and thus must be destroyed before ThreadPool starts skipping
   // CONTINUE_ON_SHUTDOWN tasks.
-  base::ThreadPoolInstance::Get()->Shutdown();
+  if (auto* thread_pool = base::ThreadPoolInstance::Get())
+    thread_pool->Shutdown();
 
   v8::V8::Dispose();
 
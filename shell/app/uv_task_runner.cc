@@ -11,23 +11,56 @@
 
 namespace electron {
 
-UvTaskRunner::UvTaskRunner(uv_loop_t* loop) : loop_(loop) {}
+namespace {
+
+// Timers beyond this many idle ones are closed instead of being kept.
+constexpr size_t kMaxFreeDelayedTasks = 32;
+
+}  // namespace
+
+UvTaskRunner::UvTaskRunner(uv_loop_t* loop) : loop_(loop) {
+  uv_idle_init(loop_, idle_.get());
+  idle_.get()->data = this;
+}
 
 UvTaskRunner::~UvTaskRunner() {
-  for (auto& iter : tasks_) {
-    uv_unref(reinterpret_cast<uv_handle_t*>(iter.first));
-    delete iter.first;
+  while (!delayed_tasks_.empty()) {
+    DelayedTask* delayed_task = delayed_tasks_.head()->value();
+    delayed_task->RemoveFromList();
+    free_delayed_tasks_.push_back(delayed_task);
+  }
+  for (DelayedTask* delayed_task : free_delayed_tasks_) {
+    delayed_task->runner = nullptr;
+    delayed_task->task.Reset();
+    uv_close(reinterpret_cast<uv_handle_t*>(&delayed_task->timer),
+             UvTaskRunner::OnClose);
   }
 }
 
 bool UvTaskRunner::PostDelayedTask(const base::Location& from_here,
                                    base::OnceClosure task,
                                    base::TimeDelta delay) {
-  auto* timer = new uv_timer_t;
-  timer->data = this;
-  uv_timer_init(loop_, timer);
-  uv_timer_start(timer, UvTaskRunner::OnTimeout, delay.InMilliseconds(), 0);
-  tasks_[timer] = std::move(task);
+  if (!delay.is_positive()) {
+    if (immediate_tasks_.empty())
+      uv_idle_start(idle_.get(), UvTaskRunner::OnIdle);
+    immediate_tasks_.push_back(std::move(task));
+    return true;
+  }
+
+  DelayedTask* delayed_task;
+  if (free_delayed_tasks_.empty()) {
+    delayed_task = new DelayedTask;
+    uv_timer_init(loop_, &delayed_task->timer);
+    delayed_task->timer.data = delayed_task;
+    delayed_task->runner = this;
+  } else {
+    delayed_task = free_delayed_tasks_.back();
+    free_delayed_tasks_.pop_back();
+  }
+  delayed_task->task = std::move(task);
+  delayed_tasks_.Append(delayed_task);
+  uv_timer_start(&delayed_task->timer, UvTaskRunner::OnTimeout,
+                 delay.InMilliseconds(), 0);
   return true;
 }
 
@@ -41,22 +74,41 @@ bool UvTaskRunner::PostNonNestableDelayedTask(const base::Location& from_here,
   return PostDelayedTask(from_here, std::move(task), delay);
 }
 
+// static
+void UvTaskRunner::OnIdle(uv_idle_t* idle) {
+  auto* self = static_cast<UvTaskRunner*>(idle->data);
+
+  // Tasks posted while these run wait for the next loop iteration, so that
+  // they can't starve I/O.
+  for (size_t count = self->immediate_tasks_.size(); count > 0; --count) {
+    base::OnceClosure task = std::move(self->immediate_tasks_.front());
+    self->immediate_tasks_.pop_front();
+    std::move(task).Run();
+  }
+
+  if (self->immediate_tasks_.empty())
+    uv_idle_stop(idle);
+}
+
 // static
 void UvTaskRunner::OnTimeout(uv_timer_t* timer) {
-  auto& tasks = static_cast<UvTaskRunner*>(timer->data)->tasks_;
-  const auto iter = tasks.find(timer);
-  if (iter == std::end(tasks))
-    return;
+  auto* delayed_task = static_cast<DelayedTask*>(timer->data);
+  UvTaskRunner* self = delayed_task->runner;
+
+  delayed_task->RemoveFromList();
+  base::OnceClosure task = std::move(delayed_task->task);
+  if (self->free_delayed_tasks_.size() < kMaxFreeDelayedTasks) {
+    self->free_delayed_tasks_.push_back(delayed_task);
+  } else {
+    uv_close(reinterpret_cast<uv_handle_t*>(timer), UvTaskRunner::OnClose);
+  }
 
-  std::move(iter->second).Run();
-  tasks.erase(iter);
-  uv_timer_stop(timer);
-  uv_close(reinterpret_cast<uv_handle_t*>(timer), UvTaskRunner::OnClose);
+  std::move(task).Run();
 }
 
 // static
 void UvTaskRunner::OnClose(uv_handle_t* handle) {
-  delete reinterpret_cast<uv_timer_t*>(handle);
+  delete static_cast<DelayedTask*>(handle->data);
 }
 
 }  // namespace electron
@@ -5,11 +5,14 @@
 #ifndef ELECTRON_SHELL_APP_UV_TASK_RUNNER_H_
 #define ELECTRON_SHELL_APP_UV_TASK_RUNNER_H_
 
-#include <map>
+#include <vector>
 
+#include "base/containers/circular_deque.h"
+#include "base/containers/linked_list.h"
 #include "base/functional/callback.h"
 #include "base/memory/raw_ptr.h"
 #include "base/task/single_thread_task_runner.h"
+#include "shell/common/node_bindings.h"
 #include "uv.h"  // NOLINT(build/include_directory)
 
 namespace base {
@@ -38,13 +41,27 @@ class UvTaskRunner : public base::SingleThreadTaskRunner {
                                   base::TimeDelta delay) override;
 
  private:
+  // A delayed task and the timer that runs it. These are kept in a pool when
+  // they are idle, so posting a delayed task doesn't allocate a new timer.
+  struct DelayedTask : public base::LinkNode<DelayedTask> {
+    uv_timer_t timer;
+    raw_ptr<UvTaskRunner> runner;
+    base::OnceClosure task;
+  };
+
   ~UvTaskRunner() override;
+  static void OnIdle(uv_idle_t* idle);
   static void OnTimeout(uv_timer_t* timer);
   static void OnClose(uv_handle_t* handle);
 
   raw_ptr<uv_loop_t> loop_;
 
-  std::map<uv_timer_t*, base::OnceClosure> tasks_;
+  // Tasks without a delay, run from |idle_| in the order they were posted.
+  base::circular_deque<base::OnceClosure> immediate_tasks_;
+  UvHandle<uv_idle_t> idle_;
+
+  base::LinkedList<DelayedTask> delayed_tasks_;
+  std::vector<DelayedTask*> free_delayed_tasks_;
 };
 
 }  // namespace electron
@@ -4,6 +4,7 @@
 
 #include "shell/browser/api/electron_api_app.h"
 
+#include <limits>
 #include <memory>
 #include <optional>
 #include <string>
@@ -11,6 +12,7 @@
 #include <utility>
 #include <vector>
 
+#include "base/barrier_callback.h"
 #include "base/command_line.h"
 #include "base/containers/fixed_flat_map.h"
 #include "base/containers/span.h"
@@ -19,7 +21,9 @@
 #include "base/files/file_util.h"
 #include "base/functional/callback_helpers.h"
 #include "base/path_service.h"
+#include "base/strings/strcat.h"
 #include "base/system/sys_info.h"
+#include "base/task/sequenced_task_runner.h"
 #include "base/values.h"
 #include "base/win/windows_version.h"
 #include "chrome/browser/browser_process.h"
@@ -40,6 +44,7 @@
 #include "content/public/browser/render_frame_host.h"
 #include "content/public/common/content_switches.h"
 #include "crypto/crypto_buildflags.h"
+#include "electron/electron_version.h"
 #include "media/audio/audio_manager.h"
 #include "net/dns/public/dns_over_https_config.h"
 #include "net/dns/public/dns_over_https_server_config.h"
@@ -61,8 +66,11 @@
 #include "shell/browser/javascript_environment.h"
 #include "shell/browser/login_handler.h"
 #include "shell/browser/relauncher.h"
+#include "shell/browser/single_instance_handoff.h"
+#include "shell/browser/startup_timeline.h"
 #include "shell/common/application_info.h"
 #include "shell/common/electron_command_line.h"
+#include "shell/common/electron_constants.h"
 #include "shell/common/electron_paths.h"
 #include "shell/common/gin_converters/base_converter.h"
 #include "shell/common/gin_converters/blink_converter.h"
@@ -524,6 +532,96 @@ void OnIconDataAvailable(gin_helper::Promise<gfx::Image> promise,
   }
 }
 
+using IndexedIcon = std::pair<size_t, gfx::Image>;
+
+void OnIconsDataAvailable(gin_helper::Promise<std::vector<gfx::Image>> promise,
+                          std::vector<IndexedIcon> results) {
+  std::vector<gfx::Image> icons(results.size());
+  for (auto& [index, icon] : results)
+    icons[index] = std::move(icon);
+  promise.Resolve(icons);
+}
+
+IconLoader::IconSize GetIconSizeFromOptions(gin::Arguments* args) {
+  gin_helper::Dictionary options;
+  if (!args->GetNext(&options))
+    return IconLoader::IconSize::NORMAL;
+  std::string icon_size_string;
+  options.Get("size", &icon_size_string);
+  return GetIconSizeByString(icon_size_string);
+}
+
+gin_helper::Dictionary CreateMemoryInfoDict(v8::Isolate* isolate,
+                                            const ProcessMemoryInfo& info) {
+  auto memory_dict = gin_helper::Dictionary::CreateEmpty(isolate);
+  memory_dict.Set("workingSetSize",
+                  static_cast<double>(info.working_set_size >> 10));
+  memory_dict.Set("peakWorkingSetSize",
+                  static_cast<double>(info.peak_working_set_size >> 10));
+#if BUILDFLAG(IS_WIN) || BUILDFLAG(IS_LINUX)
+  memory_dict.Set("privateBytes",
+                  static_cast<double>(info.private_bytes >> 10));
+#endif
+#if BUILDFLAG(IS_LINUX)
+  memory_dict.Set("proportionalSetSize",
+                  static_cast<double>(info.proportional_set_size >> 10));
+#endif
+  return memory_dict;
+}
+
+// Copies the shader caches recorded in |seed_path| into the session data
+// directory, unless the same seed was already copied for this version of the
+// app. The caches key their entries by GPU, driver and Chromium version
+// themselves, so entries recorded on different hardware are only misses.
+bool SeedShaderCache(const base::FilePath& seed_path, std::string* error) {
+  base::FilePath session_data;
+  if (!base::PathService::Get(DIR_SESSION_DATA, &session_data)) {
+    *error = "Failed to get the session data path";
+    return false;
+  }
+
+  ScopedAllowBlockingForElectron allow_blocking;
+  const base::FilePath stamp_path =
+      session_data.Append(FILE_PATH_LITERAL("ShaderCacheSeed"));
+  const std::string stamp =
+      base::StrCat({ELECTRON_VERSION_STRING, "\n", Browser::Get()->GetVersion(),
+                    "\n", seed_path.AsUTF8Unsafe()});
+  std::string current_stamp;
+  if (base::ReadFileToString(stamp_path, &current_stamp) &&
+      current_stamp == stamp)
+    return true;
+
+  if (!base::DirectoryExists(seed_path)) {
+    *error = "Shader cache seed " + seed_path.AsUTF8Unsafe() +
+             " is not a directory";
+    return false;
+  }
+  if (!base::CreateDirectory(session_data)) {
+    *error = "Failed to create " + session_data.AsUTF8Unsafe();
+    return false;
+  }
+  // GPUCache is the cache of the default session's pages, e.g. their WebGL
+  // programs; the others are the browser-wide caches.
+  for (const base::FilePath::CharType* dirname :
+       {FILE_PATH_LITERAL("GPUCache"), kShaderCacheDirname,
+        kGrShaderCacheDirname, kGraphiteDawnCacheDirname}) {
+    const base::FilePath from = seed_path.Append(dirname);
+    if (!base::DirectoryExists(from))
+      continue;
+    const base::FilePath to = session_data.Append(dirname);
+    if (!base::DeletePathRecursively(to) ||
+        !base::CopyDirectory(from, to, /* recursive= */ true)) {
+      *error = "Failed to copy " + from.AsUTF8Unsafe();
+      return false;
+    }
+  }
+  if (!base::WriteFile(stamp_path, stamp)) {
+    *error = "Failed to write " + stamp_path.AsUTF8Unsafe();
+    return false;
+  }
+  return true;
+}
+
 }  // namespace
 
 App::App() {
@@ -567,6 +665,7 @@ void App::OnQuit() {
   Emit("quit", exitCode);
 
   if (process_singleton_) {
+    single_instance_handoff::Clear();
     process_singleton_->Cleanup();
     process_singleton_.reset();
   }
@@ -1015,6 +1114,10 @@ bool App::RequestSingleInstanceLock(gin::Arguments* args) {
 
   blink::CloneableMessage additional_data_message;
   args->GetNext(&additional_data_message);
+  bool early_handoff = false;
+  gin_helper::Dictionary options;
+  if (args->GetNext(&options))
+    options.Get("earlyHandoff", &early_handoff);
 #if BUILDFLAG(IS_WIN)
   bool app_is_sandboxed =
       IsSandboxEnabled(base::CommandLine::ForCurrentProcess());
@@ -1029,6 +1132,8 @@ bool App::RequestSingleInstanceLock(gin::Arguments* args) {
 
   switch (process_singleton_->NotifyOtherProcessOrCreate()) {
     case ProcessSingleton::NotifyResult::PROCESS_NONE:
+      if (early_handoff)
+        single_instance_handoff::Record(program_name, user_dir);
       if (content::BrowserThread::IsThreadInitialized(
               content::BrowserThread::IO)) {
         process_singleton_->StartWatching();
@@ -1047,6 +1152,7 @@ bool App::RequestSingleInstanceLock(gin::Arguments* args) {
 
 void App::ReleaseSingleInstanceLock() {
   if (process_singleton_) {
+    single_instance_handoff::Clear();
     process_singleton_->Cleanup();
     process_singleton_.reset();
   }
@@ -1102,6 +1208,23 @@ void App::DisableHardwareAcceleration(gin_helper::ErrorThrower thrower) {
   }
 }
 
+void App::SetShaderCacheSeed(gin_helper::ErrorThrower thrower,
+                             const base::FilePath& seed_path) {
+  if (Browser::Get()->is_ready()) {
+    thrower.ThrowError(
+        "app.setShaderCacheSeed() can only be called "
+        "before app is ready");
+    return;
+  }
+  if (!seed_path.IsAbsolute()) {
+    thrower.ThrowError("Path must be absolute");
+    return;
+  }
+  std::string error;
+  if (!SeedShaderCache(seed_path, &error))
+    thrower.ThrowError(error);
+}
+
 void App::DisableDomainBlockingFor3DAPIs(gin_helper::ErrorThrower thrower) {
   if (Browser::Get()->is_ready()) {
     thrower.ThrowError(
@@ -1209,30 +1332,90 @@ JumpListResult App::SetJumpList(v8::Local<v8::Value> val,
     return JumpListResult::kArgumentError;
   }
 
-  JumpList jump_list(Browser::Get()->GetAppUserModelID());
+  // The update runs behind any asynchronous one that is already running, and
+  // supersedes those that haven't started.
+  auto superseded = DropPendingJumpListUpdates();
+  JumpListResult result = JumpListResult::kGenericError;
+  RunOnJumpListTaskRunnerAndWait(base::BindOnce(
+      [](const std::wstring& app_id,
+         const std::optional<std::vector<JumpListCategory>>& categories,
+         JumpListResult* result) {
+        *result = UpdateJumpList(app_id, categories);
+      },
+      std::wstring(Browser::Get()->GetAppUserModelID()),
+      delete_jump_list ? std::nullopt : std::make_optional(categories),
+      &result));
+  for (auto& promise : superseded)
+    promise.Resolve(result);
+  return result;
+}
 
-  if (delete_jump_list) {
-    return jump_list.Delete() ? JumpListResult::kSuccess
-                              : JumpListResult::kGenericError;
+bool App::SetUserTasks(const std::vector<Browser::UserTask>& tasks) {
+  // The user tasks replace the whole Jump List, so the asynchronous updates
+  // that haven't started are superseded as well.
+  auto superseded = DropPendingJumpListUpdates();
+  bool result = Browser::Get()->SetUserTasks(tasks);
+  for (auto& promise : superseded) {
+    promise.Resolve(result ? JumpListResult::kSuccess
+                           : JumpListResult::kGenericError);
   }
+  return result;
+}
 
-  // Start a transaction that updates the JumpList of this application.
-  if (!jump_list.Begin())
-    return JumpListResult::kGenericError;
+std::vector<gin_helper::Promise<JumpListResult>>
+App::DropPendingJumpListUpdates() {
+  pending_jump_list_.reset();
+  has_pending_jump_list_ = false;
+  return std::exchange(pending_jump_list_promises_, {});
+}
 
-  JumpListResult result = jump_list.AppendCategories(categories);
-  // AppendCategories may have failed to add some categories, but it's better
-  // to have something than nothing so try to commit the changes anyway.
-  if (!jump_list.Commit()) {
-    LOG(ERROR) << "Failed to commit changes to custom Jump List.";
-    // It's more useful to return the earlier error code that might give
-    // some indication as to why the transaction actually failed, so don't
-    // overwrite it with a "generic error" code here.
-    if (result == JumpListResult::kSuccess)
-      result = JumpListResult::kGenericError;
+v8::Local<v8::Promise> App::SetJumpListAsync(v8::Local<v8::Value> val,
+                                             gin::Arguments* args) {
+  gin_helper::Promise<JumpListResult> promise(args->isolate());
+  v8::Local<v8::Promise> handle = promise.GetHandle();
+
+  std::vector<JumpListCategory> categories;
+  bool delete_jump_list = val->IsNull();
+  if (!delete_jump_list &&
+      !gin::ConvertFromV8(args->isolate(), val, &categories)) {
+    promise.RejectWithErrorMessage(
+        "Argument must be null or an array of categories");
+    return handle;
   }
 
-  return result;
+  // An update that has not started yet is superseded by this one, and its
+  // promise settles with the result of this one.
+  if (delete_jump_list)
+    pending_jump_list_.reset();
+  else
+    pending_jump_list_ = std::move(categories);
+  has_pending_jump_list_ = true;
+  pending_jump_list_promises_.push_back(std::move(promise));
+  if (!jump_list_update_running_)
+    StartPendingJumpListUpdate();
+  return handle;
+}
+
+void App::StartPendingJumpListUpdate() {
+  jump_list_update_running_ = true;
+  has_pending_jump_list_ = false;
+  GetJumpListTaskRunner()->PostTaskAndReplyWithResult(
+      FROM_HERE,
+      base::BindOnce(&UpdateJumpList,
+                     std::wstring(Browser::Get()->GetAppUserModelID()),
+                     std::exchange(pending_jump_list_, std::nullopt)),
+      base::BindOnce(&App::OnJumpListUpdated, weak_factory_.GetWeakPtr(),
+                     std::exchange(pending_jump_list_promises_, {})));
+}
+
+void App::OnJumpListUpdated(
+    std::vector<gin_helper::Promise<JumpListResult>> promises,
+    JumpListResult result) {
+  jump_list_update_running_ = false;
+  for (auto& promise : promises)
+    promise.Resolve(result);
+  if (has_pending_jump_list_)
+    StartPendingJumpListUpdate();
 }
 #endif  // BUILDFLAG(IS_WIN)
 
@@ -1242,16 +1425,7 @@ v8::Local<v8::Promise> App::GetFileIcon(const base::FilePath& path,
   gin_helper::Promise<gfx::Image> promise(isolate);
   v8::Local<v8::Promise> handle = promise.GetHandle();
   base::FilePath normalized_path = path.NormalizePathSeparators();
-
-  IconLoader::IconSize icon_size;
-  gin_helper::Dictionary options;
-  if (!args->GetNext(&options)) {
-    icon_size = IconLoader::IconSize::NORMAL;
-  } else {
-    std::string icon_size_string;
-    options.Get("size", &icon_size_string);
-    icon_size = GetIconSizeByString(icon_size_string);
-  }
+  IconLoader::IconSize icon_size = GetIconSizeFromOptions(args);
 
   auto* icon_manager = ElectronBrowserMainParts::Get()->GetIconManager();
   gfx::Image* icon =
@@ -1267,6 +1441,43 @@ v8::Local<v8::Promise> App::GetFileIcon(const base::FilePath& path,
   return handle;
 }
 
+v8::Local<v8::Promise> App::GetFileIcons(
+    const std::vector<base::FilePath>& paths,
+    gin::Arguments* args) {
+  v8::Isolate* isolate = JavascriptEnvironment::GetIsolate();
+  gin_helper::Promise<std::vector<gfx::Image>> promise(isolate);
+  v8::Local<v8::Promise> handle = promise.GetHandle();
+  IconLoader::IconSize icon_size = GetIconSizeFromOptions(args);
+
+  if (paths.empty()) {
+    promise.Resolve({});
+    return handle;
+  }
+
+  // Icons that are not cached yet are all loaded at once on the thread pool.
+  // Failures become empty images so that one path does not fail the batch.
+  auto barrier = base::BarrierCallback<IndexedIcon>(
+      paths.size(), base::BindOnce(&OnIconsDataAvailable, std::move(promise)));
+  auto* icon_manager = ElectronBrowserMainParts::Get()->GetIconManager();
+  for (size_t i = 0; i < paths.size(); ++i) {
+    base::FilePath normalized_path = paths[i].NormalizePathSeparators();
+    gfx::Image* icon =
+        icon_manager->LookupIconFromFilepath(normalized_path, icon_size, 1.0f);
+    if (icon) {
+      barrier.Run({i, *icon});
+      continue;
+    }
+    icon_manager->LoadIcon(
+        normalized_path, icon_size, 1.0f,
+        base::BindOnce(
+            [](size_t index, base::RepeatingCallback<void(IndexedIcon)> barrier,
+               gfx::Image icon) { barrier.Run({index, std::move(icon)}); },
+            i, barrier),
+        &cancelable_task_tracker_);
+  }
+  return handle;
+}
+
 std::vector<gin_helper::Dictionary> App::GetAppMetrics(v8::Isolate* isolate) {
   std::vector<gin_helper::Dictionary> result;
   result.reserve(app_metrics_.size());
@@ -1306,23 +1517,9 @@ std::vector<gin_helper::Dictionary> App::GetAppMetrics(v8::Isolate* isolate) {
       pid_dict.Set("name", process_metric.second->name);
     }
 
-#if !BUILDFLAG(IS_LINUX)
-    auto memory_info = process_metric.second->GetMemoryInfo();
-
-    auto memory_dict = gin_helper::Dictionary::CreateEmpty(isolate);
-    memory_dict.Set("workingSetSize",
-                    static_cast<double>(memory_info.working_set_size >> 10));
-    memory_dict.Set(
-        "peakWorkingSetSize",
-        static_cast<double>(memory_info.peak_working_set_size >> 10));
-
-#if BUILDFLAG(IS_WIN)
-    memory_dict.Set("privateBytes",
-                    static_cast<double>(memory_info.private_bytes >> 10));
-#endif
-
-    pid_dict.Set("memory", memory_dict);
-#endif
+    pid_dict.Set("memory",
+                 CreateMemoryInfoDict(isolate,
+                                      process_metric.second->GetMemoryInfo()));
 
 #if BUILDFLAG(IS_MAC)
     pid_dict.Set("sandboxed", process_metric.second->IsSandboxed());
@@ -1339,12 +1536,186 @@ std::vector<gin_helper::Dictionary> App::GetAppMetrics(v8::Isolate* isolate) {
   return result;
 }
 
+void App::StartMetricsSampling(gin::Arguments* args) {
+  double interval = 1000;
+  double buffer_size = 3600;
+  gin_helper::Dictionary options;
+  if (args->GetNext(&options)) {
+    options.Get("interval", &interval);
+    options.Get("bufferSize", &buffer_size);
+  }
+  if (!(interval >= 100)) {
+    args->ThrowTypeError("interval must be at least 100 milliseconds");
+    return;
+  }
+  if (!(buffer_size >= 1) || !(buffer_size <= 1'000'000)) {
+    args->ThrowTypeError("bufferSize must be between 1 and 1000000");
+    return;
+  }
+
+  if (!metrics_sampler_)
+    metrics_sampler_ = std::make_unique<ProcessMetricsSampler>(app_metrics_);
+  metrics_sampler_->Start(base::Milliseconds(interval),
+                          static_cast<size_t>(buffer_size));
+}
+
+void App::StopMetricsSampling() {
+  if (metrics_sampler_)
+    metrics_sampler_->Stop();
+}
+
+std::vector<gin_helper::Dictionary> App::GetMetricsSamples(
+    gin::Arguments* args) {
+  std::vector<gin_helper::Dictionary> result;
+  if (!metrics_sampler_)
+    return result;
+
+  double since = 0;
+  args->GetNext(&since);
+
+  v8::Isolate* isolate = args->isolate();
+  std::vector<ProcessMetricSample> samples = metrics_sampler_->GetSamples(
+      base::Time::FromMillisecondsSinceUnixEpoch(since));
+  result.reserve(samples.size());
+  for (const auto& sample : samples) {
+    auto sample_dict = gin_helper::Dictionary::CreateEmpty(isolate);
+    sample_dict.Set("pid", sample.pid);
+    sample_dict.Set("type", content::GetProcessTypeNameInEnglish(sample.type));
+    sample_dict.Set("timestamp", sample.time.InMillisecondsFSinceUnixEpoch());
+
+    auto cpu_dict = gin_helper::Dictionary::CreateEmpty(isolate);
+    cpu_dict.Set("percentCPUUsage", sample.cpu_usage);
+    cpu_dict.Set("idleWakeupsPerSecond", sample.idle_wakeups_per_second);
+    sample_dict.Set("cpu", cpu_dict);
+
+    sample_dict.Set("memory", CreateMemoryInfoDict(isolate, sample.memory));
+    if (sample.gpu_memory)
+      sample_dict.Set("gpuMemory",
+                      static_cast<double>(*sample.gpu_memory >> 10));
+    result.push_back(sample_dict);
+  }
+  return result;
+}
+
+void App::StartEventLoopMonitoring(gin::Arguments* args) {
+  double sample_interval = 100;
+  double long_task_threshold = 50;
+  double max_long_tasks = 100;
+  bool trace_events = false;
+  gin_helper::Dictionary options;
+  if (args->GetNext(&options)) {
+    options.Get("sampleInterval", &sample_interval);
+    options.Get("longTaskThreshold", &long_task_threshold);
+    options.Get("maxLongTasks", &max_long_tasks);
+    options.Get("traceEvents", &trace_events);
+  }
+  if (!(sample_interval >= 10)) {
+    args->ThrowTypeError("sampleInterval must be at least 10 milliseconds");
+    return;
+  }
+  if (!(long_task_threshold > 0)) {
+    args->ThrowTypeError("longTaskThreshold must be a positive number");
+    return;
+  }
+  if (!(max_long_tasks >= 1) || !(max_long_tasks <= 10'000)) {
+    args->ThrowTypeError("maxLongTasks must be between 1 and 10000");
+    return;
+  }
+
+  EventLoopMonitor::Options monitor_options;
+  monitor_options.sample_interval = base::Milliseconds(sample_interval);
+  monitor_options.long_task_threshold = base::Milliseconds(long_task_threshold);
+  monitor_options.max_long_tasks = static_cast<size_t>(max_long_tasks);
+  monitor_options.trace_events = trace_events;
+
+  if (!event_loop_monitor_)
+    event_loop_monitor_ = std::make_unique<EventLoopMonitor>();
+  event_loop_monitor_->Start(monitor_options);
+}
+
+void App::StopEventLoopMonitoring() {
+  if (event_loop_monitor_)
+    event_loop_monitor_->Stop();
+}
+
+v8::Local<v8::Value> App::GetEventLoopStats(v8::Isolate* isolate) {
+  if (!event_loop_monitor_)
+    return v8::Null(isolate);
+
+  auto histogram_to_dict = [isolate](const LatencyHistogram& histogram) {
+    std::vector<gin_helper::Dictionary> buckets;
+    buckets.reserve(LatencyHistogram::kBucketCount);
+    for (size_t i = 0; i < LatencyHistogram::kBucketCount; ++i) {
+      const base::TimeDelta upper_bound = LatencyHistogram::BucketUpperBound(i);
+      auto bucket = gin_helper::Dictionary::CreateEmpty(isolate);
+      bucket.Set("upperBound",
+                 upper_bound.is_max()
+                     ? std::numeric_limits<double>::infinity()
+                     : upper_bound.InMillisecondsF());
+      bucket.Set("count", static_cast<double>(histogram.buckets[i]));
+      buckets.push_back(bucket);
+    }
+    auto dict = gin_helper::Dictionary::CreateEmpty(isolate);
+    dict.Set("count", static_cast<double>(histogram.count));
+    dict.Set("mean", histogram.count
+                         ? histogram.total.InMillisecondsF() / histogram.count
+                         : 0.0);
+    dict.Set("max", histogram.max.InMillisecondsF());
+    dict.Set("buckets", buckets);
+    return dict;
+  };
+
+  std::vector<gin_helper::Dictionary> long_tasks;
+  for (const auto& task : event_loop_monitor_->GetLongTasks()) {
+    auto task_dict = gin_helper::Dictionary::CreateEmpty(isolate);
+    task_dict.Set("timestamp", task.time.InMillisecondsFSinceUnixEpoch());
+    task_dict.Set("duration", task.duration.InMillisecondsF());
+    task_dict.Set("functionName", task.posted_from.function_name()
+                                      ? task.posted_from.function_name()
+                                      : "");
+    task_dict.Set("fileName",
+                  task.posted_from.file_name() ? task.posted_from.file_name()
+                                               : "");
+    task_dict.Set("lineNumber", task.posted_from.line_number());
+    long_tasks.push_back(task_dict);
+  }
+
+  auto stats = gin_helper::Dictionary::CreateEmpty(isolate);
+  stats.Set("monitoring", event_loop_monitor_->IsRunning());
+  stats.Set("queueDelay", histogram_to_dict(event_loop_monitor_->queue_delay()));
+  stats.Set("uvRunDuration",
+            histogram_to_dict(event_loop_monitor_->uv_run_duration()));
+  stats.Set("longTasks", long_tasks);
+  return stats.GetHandle();
+}
+
+std::vector<gin_helper::Dictionary> App::GetStartupTimeline(
+    v8::Isolate* isolate) {
+  const std::vector<startup_timeline::Entry> entries =
+      startup_timeline::GetEntries();
+  std::vector<gin_helper::Dictionary> result;
+  if (entries.empty())
+    return result;
+
+  const base::TimeTicks origin =
+      startup_timeline::GetProcessStartTime().value_or(entries.front().time);
+  result.reserve(entries.size());
+  for (const auto& entry : entries) {
+    auto dict = gin_helper::Dictionary::CreateEmpty(isolate);
+    dict.Set("name", startup_timeline::GetPhaseName(entry.phase));
+    dict.Set("time", (entry.time - origin).InMillisecondsF());
+    result.push_back(dict);
+  }
+  return result;
+}
+
 v8::Local<v8::Value> App::GetGPUFeatureStatus(v8::Isolate* isolate) {
   return gin::ConvertToV8(isolate, content::GetFeatureStatus());
 }
 
 v8::Local<v8::Promise> App::GetGPUInfo(v8::Isolate* isolate,
-                                       const std::string& info_type) {
+                                       const std::string& info_type,
+                                       gin::Arguments* args) {
   auto* const gpu_data_manager = content::GpuDataManagerImpl::GetInstance();
   gin_helper::Promise<base::Value> promise(isolate);
   v8::Local<v8::Promise> handle = promise.GetHandle();
@@ -1359,15 +1730,23 @@ v8::Local<v8::Promise> App::GetGPUInfo(v8::Isolate* isolate,
     return handle;
   }
 
+  GPUInfoManager::Keys keys;
+  gin_helper::Dictionary options;
+  if (args->GetNext(&options)) {
+    std::vector<std::string> selected_keys;
+    if (options.Get("keys", &selected_keys))
+      keys = std::move(selected_keys);
+  }
+
   auto* const info_mgr = GPUInfoManager::GetInstance();
   if (info_type == "complete") {
 #if BUILDFLAG(IS_WIN) || BUILDFLAG(IS_MAC)
-    info_mgr->FetchCompleteInfo(std::move(promise));
+    info_mgr->FetchCompleteInfo(std::move(promise), std::move(keys));
 #else
-    info_mgr->FetchBasicInfo(std::move(promise));
+    info_mgr->FetchBasicInfo(std::move(promise), std::move(keys));
 #endif
   } else /* (info_type == "basic") */ {
-    info_mgr->FetchBasicInfo(std::move(promise));
+    info_mgr->FetchBasicInfo(std::move(promise), std::move(keys));
   }
   return handle;
 }
@@ -1460,16 +1839,17 @@ v8::Local<v8::Promise> App::SetProxy(gin::Arguments* args) {
       NOTIMPLEMENTED();
   }
 
-  static_cast<BrowserProcessImpl*>(g_browser_process)
-      ->in_memory_pref_store()
-      ->SetValue(proxy_config::prefs::kProxy,
-                 base::Value{std::move(proxy_config)},
-                 WriteablePrefStore::DEFAULT_PREF_WRITE_FLAGS);
+  auto* browser_process = static_cast<BrowserProcessImpl*>(g_browser_process);
+  browser_process->in_memory_pref_store()->SetValue(
+      proxy_config::prefs::kProxy, base::Value{std::move(proxy_config)},
+      WriteablePrefStore::DEFAULT_PREF_WRITE_FLAGS);
 
   g_browser_process->system_network_context_manager()
       ->GetContext()
-      ->ForceReloadProxyConfig(base::BindOnce(
-          gin_helper::Promise<void>::ResolvePromise, std::move(promise)));
+      ->ForceReloadProxyConfig(
+          browser_process->GetResolveProxyHelper()->ClearCacheBefore(
+              base::BindOnce(gin_helper::Promise<void>::ResolvePromise,
+                             std::move(promise))));
 
   return handle;
 }
@@ -1742,10 +2122,10 @@ gin::ObjectTemplateBuilder App::GetObjectTemplateBuilder(v8::Isolate* isolate) {
                  base::BindRepeating(&Browser::ShowEmojiPanel, browser))
 #endif
 #if BUILDFLAG(IS_WIN)
-      .SetMethod("setUserTasks",
-                 base::BindRepeating(&Browser::SetUserTasks, browser))
+      .SetMethod("setUserTasks", &App::SetUserTasks)
       .SetMethod("getJumpListSettings", &App::GetJumpListSettings)
       .SetMethod("setJumpList", &App::SetJumpList)
+      .SetMethod("setJumpListAsync", &App::SetJumpListAsync)
 #endif
 #if BUILDFLAG(IS_LINUX)
       .SetMethod("isUnityRunning",
@@ -1777,8 +2157,17 @@ gin::ObjectTemplateBuilder App::GetObjectTemplateBuilder(v8::Isolate* isolate) {
                  &App::DisableHardwareAcceleration)
       .SetMethod("disableDomainBlockingFor3DAPIs",
                  &App::DisableDomainBlockingFor3DAPIs)
+      .SetMethod("setShaderCacheSeed", &App::SetShaderCacheSeed)
       .SetMethod("getFileIcon", &App::GetFileIcon)
+      .SetMethod("getFileIcons", &App::GetFileIcons)
       .SetMethod("getAppMetrics", &App::GetAppMetrics)
+      .SetMethod("startMetricsSampling", &App::StartMetricsSampling)
+      .SetMethod("stopMetricsSampling", &App::StopMetricsSampling)
+      .SetMethod("getMetricsSamples", &App::GetMetricsSamples)
+      .SetMethod("startEventLoopMonitoring", &App::StartEventLoopMonitoring)
+      .SetMethod("stopEventLoopMonitoring", &App::StopEventLoopMonitoring)
+      .SetMethod("getEventLoopStats", &App::GetEventLoopStats)
+      .SetMethod("getStartupTimeline", &App::GetStartupTimeline)
       .SetMethod("getGPUFeatureStatus", &App::GetGPUFeatureStatus)
       .SetMethod("getGPUInfo", &App::GetGPUInfo)
 #if IS_MAS_BUILD()
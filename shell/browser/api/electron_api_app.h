@@ -11,6 +11,7 @@
 #include <vector>
 
 #include "base/containers/flat_map.h"
+#include "base/memory/weak_ptr.h"
 #include "base/task/cancelable_task_tracker.h"
 #include "chrome/browser/icon_manager.h"
 #include "chrome/browser/process_singleton.h"
@@ -23,6 +24,8 @@
 #include "net/base/completion_repeating_callback.h"
 #include "net/ssl/client_cert_identity.h"
 #include "shell/browser/api/process_metric.h"
+#include "shell/browser/api/event_loop_monitor.h"
+#include "shell/browser/api/process_metrics_sampler.h"
 #include "shell/browser/browser.h"
 #include "shell/browser/browser_observer.h"
 #include "shell/browser/electron_browser_client.h"
@@ -43,6 +46,7 @@ namespace electron {
 
 #if BUILDFLAG(IS_WIN)
 enum class JumpListResult : int;
+struct JumpListCategory;
 #endif
 
 namespace api {
@@ -203,6 +207,8 @@ class App : public ElectronBrowserClient::Delegate,
   bool Relaunch(gin::Arguments* args);
   void DisableHardwareAcceleration(gin_helper::ErrorThrower thrower);
   void DisableDomainBlockingFor3DAPIs(gin_helper::ErrorThrower thrower);
+  void SetShaderCacheSeed(gin_helper::ErrorThrower thrower,
+                          const base::FilePath& seed_path);
   bool IsAccessibilitySupportEnabled();
   void SetAccessibilitySupportEnabled(gin_helper::ErrorThrower thrower,
                                       bool enabled);
@@ -214,11 +220,21 @@ class App : public ElectronBrowserClient::Delegate,
 #endif
   v8::Local<v8::Promise> GetFileIcon(const base::FilePath& path,
                                      gin::Arguments* args);
+  v8::Local<v8::Promise> GetFileIcons(const std::vector<base::FilePath>& paths,
+                                      gin::Arguments* args);
 
   std::vector<gin_helper::Dictionary> GetAppMetrics(v8::Isolate* isolate);
+  void StartMetricsSampling(gin::Arguments* args);
+  void StopMetricsSampling();
+  std::vector<gin_helper::Dictionary> GetMetricsSamples(gin::Arguments* args);
+  void StartEventLoopMonitoring(gin::Arguments* args);
+  void StopEventLoopMonitoring();
+  v8::Local<v8::Value> GetEventLoopStats(v8::Isolate* isolate);
+  std::vector<gin_helper::Dictionary> GetStartupTimeline(v8::Isolate* isolate);
   v8::Local<v8::Value> GetGPUFeatureStatus(v8::Isolate* isolate);
   v8::Local<v8::Promise> GetGPUInfo(v8::Isolate* isolate,
-                                    const std::string& info_type);
+                                    const std::string& info_type,
+                                    gin::Arguments* args);
   void EnableSandbox(gin_helper::ErrorThrower thrower);
   void SetUserAgentFallback(const std::string& user_agent);
   std::string GetUserAgentFallback();
@@ -249,6 +265,19 @@ class App : public ElectronBrowserClient::Delegate,
 
   // Set or remove a custom Jump List for the application.
   JumpListResult SetJumpList(v8::Local<v8::Value> val, gin::Arguments* args);
+
+  // Like SetJumpList, but updates the Jump List off the UI thread. Updates
+  // requested while one is running are coalesced into a single next one.
+  v8::Local<v8::Promise> SetJumpListAsync(v8::Local<v8::Value> val,
+                                          gin::Arguments* args);
+  void StartPendingJumpListUpdate();
+  // Forgets the setJumpListAsync() updates that haven't started yet and
+  // returns their promises, for a synchronous update that supersedes them.
+  std::vector<gin_helper::Promise<JumpListResult>> DropPendingJumpListUpdates();
+  bool SetUserTasks(const std::vector<Browser::UserTask>& tasks);
+  void OnJumpListUpdated(
+      std::vector<gin_helper::Promise<JumpListResult>> promises,
+      JumpListResult result);
 #endif  // BUILDFLAG(IS_WIN)
 
   std::unique_ptr<ProcessSingleton> process_singleton_;
@@ -265,9 +294,26 @@ class App : public ElectronBrowserClient::Delegate,
   // pid -> electron::ProcessMetric
   base::flat_map<int, std::unique_ptr<electron::ProcessMetric>> app_metrics_;
 
+  // Created by the first app.startMetricsSampling() call.
+  std::unique_ptr<ProcessMetricsSampler> metrics_sampler_;
+
+  // Created by the first app.startEventLoopMonitoring() call.
+  std::unique_ptr<EventLoopMonitor> event_loop_monitor_;
+
   bool disable_hw_acceleration_ = false;
   bool disable_domain_blocking_for_3DAPIs_ = false;
   bool watch_singleton_socket_on_ready_ = false;
+
+#if BUILDFLAG(IS_WIN)
+  // The latest Jump List requested with setJumpListAsync() that has not been
+  // handed to the shell yet; nullopt deletes the custom Jump List.
+  std::optional<std::vector<JumpListCategory>> pending_jump_list_;
+  bool has_pending_jump_list_ = false;
+  std::vector<gin_helper::Promise<JumpListResult>> pending_jump_list_promises_;
+  bool jump_list_update_running_ = false;
+#endif
+
+  base::WeakPtrFactory<App> weak_factory_{this};
 };
 
 }  // namespace api
@@ -6,6 +6,7 @@
 
 #include <algorithm>
 #include <string>
+#include <tuple>
 #include <utility>
 #include <vector>
 
@@ -30,6 +31,7 @@
 #include "shell/common/gin_helper/persistent_dictionary.h"
 #include "shell/common/node_includes.h"
 #include "shell/common/options_switches.h"
+#include "ui/display/screen.h"
 
 #if defined(TOOLKIT_VIEWS)
 #include "shell/browser/native_window_views.h"
@@ -91,6 +93,8 @@ BaseWindow::BaseWindow(v8::Isolate* isolate,
     const_cast<gin_helper::Dictionary&>(options).Set(options::kFrame, false);
   }
 
+  options.Get(options::kCoalesceBoundsEvents, &coalesce_bounds_events_);
+
   // Creates NativeWindow.
   window_.reset(NativeWindow::Create(
       options, parent.IsEmpty() ? nullptr : parent->window_.get()));
@@ -149,6 +153,7 @@ void BaseWindow::OnWindowClosed() {
   // there might be some delayed emit events which shouldn't be
   // triggered after this.
   weak_factory_.InvalidateWeakPtrs();
+  bounds_events_timer_.Stop();
 
   RemoveFromWeakMap();
   window_->RemoveObserver(this);
@@ -216,10 +221,16 @@ void BaseWindow::OnWindowWillResize(const gfx::Rect& new_bounds,
 }
 
 void BaseWindow::OnWindowResize() {
-  Emit("resize");
+  if (!coalesce_bounds_events_) {
+    Emit("resize");
+    return;
+  }
+  pending_resize_event_ = true;
+  ScheduleBoundsEvents();
 }
 
 void BaseWindow::OnWindowResized() {
+  EmitPendingBoundsEvents();
   Emit("resized");
 }
 
@@ -231,10 +242,16 @@ void BaseWindow::OnWindowWillMove(const gfx::Rect& new_bounds,
 }
 
 void BaseWindow::OnWindowMove() {
-  Emit("move");
+  if (!coalesce_bounds_events_) {
+    Emit("move");
+    return;
+  }
+  pending_move_event_ = true;
+  ScheduleBoundsEvents();
 }
 
 void BaseWindow::OnWindowMoved() {
+  EmitPendingBoundsEvents();
   Emit("moved");
 }
 
@@ -295,13 +312,66 @@ void BaseWindow::OnSystemContextMenu(int x, int y, bool* prevent_default) {
 
 #if BUILDFLAG(IS_WIN)
 void BaseWindow::OnWindowMessage(UINT message, WPARAM w_param, LPARAM l_param) {
-  if (IsWindowMessageHooked(message)) {
-    v8::Isolate* isolate = JavascriptEnvironment::GetIsolate();
-    v8::HandleScope scope(isolate);
-    messages_callback_map_[message].Run(
-        ToBuffer(isolate, static_cast<void*>(&w_param), sizeof(WPARAM)),
-        ToBuffer(isolate, static_cast<void*>(&l_param), sizeof(LPARAM)));
+  auto iter = messages_callback_map_.find(message);
+  if (iter == messages_callback_map_.end())
+    return;
+
+  WindowMessageHook& hook = iter->second;
+  if (hook.w_param && (w_param & hook.w_param_mask) != *hook.w_param)
+    return;
+  if (hook.l_param && (l_param & hook.l_param_mask) != *hook.l_param)
+    return;
+
+  if (!hook.min_interval.is_zero()) {
+    const base::TimeTicks now = base::TimeTicks::Now();
+    if (now - hook.last_delivery < hook.min_interval)
+      return;
+    hook.last_delivery = now;
   }
+
+  if (!hook.batch_interval.is_zero()) {
+    hook.pending_w_params.push_back(w_param);
+    hook.pending_l_params.push_back(l_param);
+    if (!hook.batch_timer.IsRunning()) {
+      // Unretained() is safe since the timer is owned by the hook, which is
+      // owned by this.
+      hook.batch_timer.Start(
+          FROM_HERE, hook.batch_interval,
+          base::BindOnce(&BaseWindow::FlushWindowMessages,
+                         base::Unretained(this), message));
+    }
+    return;
+  }
+
+  v8::Isolate* isolate = JavascriptEnvironment::GetIsolate();
+  v8::HandleScope scope(isolate);
+  // Copied since the callback may unhook the message.
+  MessageCallback callback = hook.callback;
+  callback.Run(ToBuffer(isolate, static_cast<void*>(&w_param), sizeof(WPARAM)),
+               ToBuffer(isolate, static_cast<void*>(&l_param), sizeof(LPARAM)));
+}
+
+void BaseWindow::FlushWindowMessages(UINT message) {
+  auto iter = messages_callback_map_.find(message);
+  if (iter == messages_callback_map_.end())
+    return;
+
+  WindowMessageHook& hook = iter->second;
+  std::vector<WPARAM> w_params = std::move(hook.pending_w_params);
+  std::vector<LPARAM> l_params = std::move(hook.pending_l_params);
+  hook.pending_w_params.clear();
+  hook.pending_l_params.clear();
+  if (w_params.empty())
+    return;
+
+  v8::Isolate* isolate = JavascriptEnvironment::GetIsolate();
+  v8::HandleScope scope(isolate);
+  MessageCallback callback = hook.callback;
+  callback.Run(
+      ToBuffer(isolate, w_params.data(),
+               static_cast<int>(w_params.size() * sizeof(WPARAM))),
+      ToBuffer(isolate, l_params.data(),
+               static_cast<int>(l_params.size() * sizeof(LPARAM))));
 }
 #endif
 
@@ -992,9 +1062,36 @@ void BaseWindow::SetIconImpl(v8::Isolate* isolate,
 #endif
 
 #if BUILDFLAG(IS_WIN)
+BaseWindow::WindowMessageHook::WindowMessageHook() = default;
+BaseWindow::WindowMessageHook::~WindowMessageHook() = default;
+
 bool BaseWindow::HookWindowMessage(UINT message,
-                                   const MessageCallback& callback) {
-  messages_callback_map_[message] = callback;
+                                   const MessageCallback& callback,
+                                   gin_helper::Arguments* args) {
+  // Replacing the hook also drops the messages batched for the previous one.
+  messages_callback_map_.erase(message);
+  WindowMessageHook& hook = messages_callback_map_[message];
+  hook.callback = callback;
+
+  gin_helper::Dictionary options;
+  if (!args->GetNext(&options))
+    return true;
+
+  uint64_t value;
+  if (options.Get("wParamMask", &value))
+    hook.w_param_mask = static_cast<WPARAM>(value);
+  if (options.Get("wParam", &value))
+    hook.w_param = static_cast<WPARAM>(value) & hook.w_param_mask;
+  if (options.Get("lParamMask", &value))
+    hook.l_param_mask = static_cast<LPARAM>(value);
+  if (options.Get("lParam", &value))
+    hook.l_param = static_cast<LPARAM>(value) & hook.l_param_mask;
+
+  double interval;
+  if (options.Get("minInterval", &interval) && interval > 0)
+    hook.min_interval = base::Milliseconds(interval);
+  if (options.Get("batchInterval", &interval) && interval > 0)
+    hook.batch_interval = base::Milliseconds(interval);
   return true;
 }
 
@@ -1045,6 +1142,46 @@ int32_t BaseWindow::GetID() const {
   return weak_map_id();
 }
 
+// static
+void BaseWindow::BatchUpdates(gin_helper::Arguments* args) {
+  v8::Local<v8::Value> callback;
+  if (!args->GetNext(&callback) || !callback->IsFunction()) {
+    args->ThrowTypeError("callback must be a function");
+    return;
+  }
+
+  v8::Isolate* isolate = args->isolate();
+  NativeWindow::BeginBatchUpdate();
+  // An exception thrown by the callback propagates to the caller, the
+  // changes made until then are still committed.
+  std::ignore = callback.As<v8::Function>()->Call(
+      isolate->GetCurrentContext(), v8::Undefined(isolate), 0, nullptr);
+  NativeWindow::EndBatchUpdate();
+}
+
+void BaseWindow::ScheduleBoundsEvents() {
+  if (bounds_events_timer_.IsRunning())
+    return;
+
+  // The OS does not notify more often than the display the window is on
+  // refreshes, so that is the rate the events are coalesced to.
+  float frequency = display::Screen::GetScreen()
+                        ->GetDisplayNearestWindow(window_->GetNativeWindow())
+                        .display_frequency();
+  if (frequency <= 0)
+    frequency = 60;
+  bounds_events_timer_.Start(FROM_HERE, base::Seconds(1) / frequency, this,
+                             &BaseWindow::EmitPendingBoundsEvents);
+}
+
+void BaseWindow::EmitPendingBoundsEvents() {
+  bounds_events_timer_.Stop();
+  if (std::exchange(pending_resize_event_, false))
+    Emit("resize");
+  if (std::exchange(pending_move_event_, false))
+    Emit("move");
+}
+
 void BaseWindow::RemoveFromParentChildWindows() {
   if (parent_window_.IsEmpty())
     return;
@@ -1250,6 +1387,7 @@ void Initialize(v8::Local<v8::Object> exports,
                                          .ToLocalChecked());
   constructor.SetMethod("fromId", &BaseWindow::FromWeakMapID);
   constructor.SetMethod("getAllWindows", &BaseWindow::GetAll);
+  constructor.SetMethod("batchUpdates", &BaseWindow::BatchUpdates);
 
   gin_helper::Dictionary dict(isolate, exports);
   dict.Set("BaseWindow", constructor);
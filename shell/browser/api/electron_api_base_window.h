@@ -14,6 +14,7 @@
 
 #include "content/public/browser/browser_task_traits.h"
 #include "content/public/browser/browser_thread.h"
+#include "base/timer/timer.h"
 #include "gin/handle.h"
 #include "shell/browser/native_window.h"
 #include "shell/browser/native_window_observer.h"
@@ -30,6 +31,9 @@ class BaseWindow : public gin_helper::TrackableObject<BaseWindow>,
  public:
   static gin_helper::WrappableBase* New(gin_helper::Arguments* args);
 
+  // Runs |callback| inside a NativeWindow batch update.
+  static void BatchUpdates(gin_helper::Arguments* args);
+
   static void BuildPrototype(v8::Isolate* isolate,
                              v8::Local<v8::FunctionTemplate> prototype);
 
@@ -234,7 +238,9 @@ class BaseWindow : public gin_helper::TrackableObject<BaseWindow>,
   typedef base::RepeatingCallback<void(v8::Local<v8::Value>,
                                        v8::Local<v8::Value>)>
       MessageCallback;
-  bool HookWindowMessage(UINT message, const MessageCallback& callback);
+  bool HookWindowMessage(UINT message,
+                         const MessageCallback& callback,
+                         gin_helper::Arguments* args);
   bool IsWindowMessageHooked(UINT message);
   void UnhookWindowMessage(UINT message);
   void UnhookAllWindowMessages();
@@ -249,6 +255,11 @@ class BaseWindow : public gin_helper::TrackableObject<BaseWindow>,
   // Remove this window from parent window's |child_windows_|.
   void RemoveFromParentChildWindows();
 
+  // With |coalesce_bounds_events_|, emits the pending move and resize events
+  // once per frame of the window's display.
+  void ScheduleBoundsEvents();
+  void EmitPendingBoundsEvents();
+
   template <typename... Args>
   void EmitEventSoon(std::string_view eventName) {
     content::GetUIThreadTaskRunner({})->PostTask(
@@ -258,8 +269,33 @@ class BaseWindow : public gin_helper::TrackableObject<BaseWindow>,
   }
 
 #if BUILDFLAG(IS_WIN)
-  typedef std::map<UINT, MessageCallback> MessageCallbackMap;
-  MessageCallbackMap messages_callback_map_;
+  // A message hooked with hookWindowMessage(), and the options that decide
+  // which of its messages reach JS and how.
+  struct WindowMessageHook {
+    WindowMessageHook();
+    ~WindowMessageHook();
+
+    MessageCallback callback;
+    // Only messages whose params equal these under the masks are delivered.
+    std::optional<WPARAM> w_param;
+    WPARAM w_param_mask = ~WPARAM{0};
+    std::optional<LPARAM> l_param;
+    LPARAM l_param_mask = ~LPARAM{0};
+    // Messages arriving sooner than this after the last delivered one are
+    // dropped.
+    base::TimeDelta min_interval;
+    base::TimeTicks last_delivery;
+    // When set, messages are collected and delivered in one call this long
+    // after the first of them arrived.
+    base::TimeDelta batch_interval;
+    std::vector<WPARAM> pending_w_params;
+    std::vector<LPARAM> pending_l_params;
+    base::OneShotTimer batch_timer;
+  };
+
+  void FlushWindowMessages(UINT message);
+
+  std::map<UINT, WindowMessageHook> messages_callback_map_;
 #endif
 
   v8::Global<v8::Value> content_view_;
@@ -269,6 +305,11 @@ class BaseWindow : public gin_helper::TrackableObject<BaseWindow>,
 
   std::unique_ptr<NativeWindow> window_;
 
+  bool coalesce_bounds_events_ = false;
+  bool pending_move_event_ = false;
+  bool pending_resize_event_ = false;
+  base::OneShotTimer bounds_events_timer_;
+
   // Reference to JS wrapper to prevent garbage collection.
   v8::Global<v8::Value> self_ref_;
 
@@ -90,6 +90,15 @@ BrowserWindow::BrowserWindow(gin::Arguments* args,
   // Associate with BrowserWindow.
   web_contents->SetOwnerWindow(window());
 
+  // Pages of a hidden window are not loaded, and no renderer is started for
+  // it, until the window is shown for the first time.
+  bool defer_load = false;
+  bool show = true;
+  if (options.Get(options::kDeferLoadUntilShown, &defer_load) && defer_load &&
+      options.Get(options::kShow, &show) && !show) {
+    web_contents->DeferLoad();
+  }
+
   InitWithArgs(args);
 
   // Install the content view after BaseWindow's JS code is initialized.
@@ -336,6 +345,8 @@ void BrowserWindow::SetTitleBarOverlay(const gin_helper::Dictionary& options,
 
 void BrowserWindow::OnWindowShow() {
   web_contents()->WasShown();
+  if (api_web_contents_)
+    api_web_contents_->StopDeferringLoad();
   BaseWindow::OnWindowShow();
 }
 
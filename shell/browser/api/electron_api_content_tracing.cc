@@ -2,22 +2,36 @@
 // Use of this source code is governed by the MIT license that can be
 // found in the LICENSE file.
 
+#include <memory>
 #include <optional>
 #include <set>
 #include <string>
 #include <utility>
 
+#include "base/files/file.h"
 #include "base/files/file_util.h"
+#include "base/memory/weak_ptr.h"
+#include "base/no_destructor.h"
 #include "base/task/thread_pool.h"
+#include "base/threading/sequence_bound.h"
 #include "base/threading/thread_restrictions.h"
 #include "base/trace_event/trace_config.h"
+#include "content/public/browser/browser_task_traits.h"
+#include "content/public/browser/browser_thread.h"
 #include "content/public/browser/tracing_controller.h"
+#include "services/tracing/public/cpp/perfetto/perfetto_config.h"
 #include "shell/common/gin_converters/callback_converter.h"
 #include "shell/common/gin_converters/file_path_converter.h"
 #include "shell/common/gin_converters/value_converter.h"
 #include "shell/common/gin_helper/dictionary.h"
+#include "shell/common/gin_helper/error_thrower.h"
 #include "shell/common/gin_helper/promise.h"
 #include "shell/common/node_includes.h"
+#include "third_party/perfetto/include/perfetto/tracing/tracing.h"
+
+#if BUILDFLAG(IS_WIN)
+#include <io.h>
+#endif
 
 using content::TracingController;
 
@@ -169,6 +183,275 @@ v8::Local<v8::Promise> GetTraceBufferUsage(v8::Isolate* isolate) {
   return handle;
 }
 
+// Writes the trace data read back from a ring buffer session, on a sequence
+// that may block.
+class TraceFileWriter {
+ public:
+  explicit TraceFileWriter(base::File file) : file_(std::move(file)) {}
+
+  void Write(const std::string& data) {
+    if (!failed_ && !file_.WriteAtCurrentPosAndCheck(base::as_byte_span(data)))
+      failed_ = true;
+  }
+
+  bool Close() {
+    file_.Close();
+    return !failed_;
+  }
+
+ private:
+  base::File file_;
+  bool failed_ = false;
+};
+
+// Records a Perfetto trace straight into a file, so that the trace is never
+// held in memory as a whole. In long trace mode the tracing service drains its
+// buffer into the file every flush period. In ring mode the buffer keeps the
+// most recent data, and is written out chunk by chunk once tracing stops.
+class TraceFileSession {
+ public:
+  enum class Mode { kLongTrace, kRing };
+
+  static std::unique_ptr<TraceFileSession>& Current() {
+    static base::NoDestructor<std::unique_ptr<TraceFileSession>> session;
+    return *session;
+  }
+
+  TraceFileSession(base::FilePath path, perfetto::TraceConfig config, Mode mode)
+      : path_(std::move(path)), config_(std::move(config)), mode_(mode) {}
+
+  // disable copy
+  TraceFileSession(const TraceFileSession&) = delete;
+  TraceFileSession& operator=(const TraceFileSession&) = delete;
+
+  void Start(gin_helper::Promise<void> promise) {
+    start_promise_ = std::move(promise);
+    file_task_runner_->PostTaskAndReplyWithResult(
+        FROM_HERE,
+        base::BindOnce(
+            [](const base::FilePath& path) {
+              return base::File(path, base::File::FLAG_CREATE_ALWAYS |
+                                          base::File::FLAG_WRITE);
+            },
+            path_),
+        base::BindOnce(&TraceFileSession::OnFileOpened,
+                       weak_factory_.GetWeakPtr()));
+  }
+
+  void Stop(gin_helper::Promise<base::FilePath> promise) {
+    stop_promise_ = std::move(promise);
+    session_->Stop();
+  }
+
+  // Whether tracing has started and isn't being stopped yet.
+  bool IsRunning() const {
+    return session_ && !start_promise_ && !stop_promise_;
+  }
+
+ private:
+  // Invokes |method| on the UI thread for as long as this session is alive,
+  // perfetto calls back on its own thread.
+  template <typename... Args>
+  auto PostToUI(void (TraceFileSession::*method)(Args...)) {
+    return [task_runner = content::GetUIThreadTaskRunner({}),
+            weak = weak_factory_.GetWeakPtr(), method](Args... args) {
+      task_runner->PostTask(FROM_HERE,
+                            base::BindOnce(method, weak, std::move(args)...));
+    };
+  }
+
+  void OnFileOpened(base::File file) {
+    if (!file.IsValid()) {
+      Fail("Failed to open trace file " + path_.AsUTF8Unsafe());
+      return;
+    }
+
+    session_ = perfetto::Tracing::NewTrace();
+    session_->SetOnStartCallback(PostToUI(&TraceFileSession::OnStarted));
+    session_->SetOnStopCallback(PostToUI(&TraceFileSession::OnStopped));
+    session_->SetOnErrorCallback(
+        [post = PostToUI(&TraceFileSession::Fail)](perfetto::TracingError e) {
+          post(e.message);
+        });
+
+    if (mode_ == Mode::kLongTrace) {
+      // The tracing service writes to the file and closes it when done.
+#if BUILDFLAG(IS_WIN)
+      const int fd = _open_osfhandle(
+          reinterpret_cast<intptr_t>(file.TakePlatformFile()), 0);
+#else
+      const int fd = file.TakePlatformFile();
+#endif
+      session_->Setup(config_, fd);
+    } else {
+      writer_ = base::SequenceBound<TraceFileWriter>(file_task_runner_,
+                                                     std::move(file));
+      session_->Setup(config_);
+    }
+    session_->Start();
+  }
+
+  void OnStarted() {
+    if (start_promise_)
+      std::exchange(start_promise_, std::nullopt)->Resolve();
+  }
+
+  void OnStopped() {
+    if (mode_ == Mode::kLongTrace) {
+      Finish(true);
+      return;
+    }
+    session_->ReadTrace(
+        [post = PostToUI(&TraceFileSession::OnTraceData)](
+            perfetto::TracingSession::ReadTraceCallbackArgs args) {
+          post(std::string(args.data, args.size), args.has_more);
+        });
+  }
+
+  void OnTraceData(std::string data, bool has_more) {
+    writer_.AsyncCall(&TraceFileWriter::Write).WithArgs(std::move(data));
+    if (!has_more) {
+      writer_.AsyncCall(&TraceFileWriter::Close)
+          .Then(base::BindOnce(&TraceFileSession::Finish,
+                               weak_factory_.GetWeakPtr()));
+    }
+  }
+
+  void Finish(bool success) {
+    auto promise = std::exchange(stop_promise_, std::nullopt);
+    base::FilePath path = path_;
+    // Deletes |this|.
+    Current().reset();
+    if (!promise)
+      return;
+    if (success)
+      promise->Resolve(path);
+    else
+      promise->RejectWithErrorMessage("Failed to write trace file " +
+                                      path.AsUTF8Unsafe());
+  }
+
+  void Fail(std::string message) {
+    auto start_promise = std::exchange(start_promise_, std::nullopt);
+    auto stop_promise = std::exchange(stop_promise_, std::nullopt);
+    // Deletes |this|.
+    Current().reset();
+    if (start_promise)
+      start_promise->RejectWithErrorMessage(message);
+    if (stop_promise)
+      stop_promise->RejectWithErrorMessage(message);
+  }
+
+  const base::FilePath path_;
+  const perfetto::TraceConfig config_;
+  const Mode mode_;
+
+  const scoped_refptr<base::SequencedTaskRunner> file_task_runner_ =
+      base::ThreadPool::CreateSequencedTaskRunner(
+          {base::MayBlock(), base::TaskPriority::USER_VISIBLE});
+  std::unique_ptr<perfetto::TracingSession> session_;
+  base::SequenceBound<TraceFileWriter> writer_;
+
+  std::optional<gin_helper::Promise<void>> start_promise_;
+  std::optional<gin_helper::Promise<base::FilePath>> stop_promise_;
+
+  base::WeakPtrFactory<TraceFileSession> weak_factory_{this};
+};
+
+v8::Local<v8::Promise> StartStreaming(gin_helper::ErrorThrower thrower,
+                                      v8::Isolate* isolate,
+                                      const gin_helper::Dictionary& options) {
+  gin_helper::Promise<void> promise(isolate);
+  v8::Local<v8::Promise> handle = promise.GetHandle();
+
+  base::FilePath path;
+  if (!options.Get("path", &path) || path.empty()) {
+    thrower.ThrowTypeError("path must be a non-empty string");
+    return handle;
+  }
+
+  base::trace_event::TraceConfig trace_config;
+  v8::Local<v8::Value> trace_config_value;
+  if (options.Get("traceConfig", &trace_config_value) &&
+      !trace_config_value->IsUndefined() &&
+      !gin::ConvertFromV8(isolate, trace_config_value, &trace_config)) {
+    thrower.ThrowTypeError("traceConfig is invalid");
+    return handle;
+  }
+
+  std::string mode_string = "long-trace";
+  options.Get("mode", &mode_string);
+  TraceFileSession::Mode mode;
+  if (mode_string == "long-trace") {
+    mode = TraceFileSession::Mode::kLongTrace;
+  } else if (mode_string == "ring") {
+    mode = TraceFileSession::Mode::kRing;
+  } else {
+    thrower.ThrowTypeError("mode must be 'long-trace' or 'ring'");
+    return handle;
+  }
+
+  double buffer_size = 32 * 1024;
+  options.Get("bufferSize", &buffer_size);
+  if (!(buffer_size >= 1024) || !(buffer_size <= 4 * 1024 * 1024)) {
+    thrower.ThrowTypeError("bufferSize must be between 1024 and 4194304");
+    return handle;
+  }
+
+  double flush_period = 5000;
+  options.Get("flushPeriod", &flush_period);
+  if (!(flush_period >= 100)) {
+    thrower.ThrowTypeError("flushPeriod must be at least 100 milliseconds");
+    return handle;
+  }
+
+  double max_file_size = 0;
+  options.Get("maxFileSize", &max_file_size);
+  if (!(max_file_size >= 0)) {
+    thrower.ThrowTypeError("maxFileSize must be a non-negative number");
+    return handle;
+  }
+
+  auto& session = TraceFileSession::Current();
+  if (session) {
+    promise.RejectWithErrorMessage("A trace is already being streamed");
+    return handle;
+  }
+
+  perfetto::TraceConfig config = tracing::GetDefaultPerfettoConfig(
+      trace_config, /*privacy_filtering_enabled=*/false,
+      /*convert_to_legacy_json=*/false);
+  for (auto& buffer : *config.mutable_buffers()) {
+    buffer.set_size_kb(static_cast<uint32_t>(buffer_size));
+    buffer.set_fill_policy(perfetto::TraceConfig::BufferConfig::RING_BUFFER);
+  }
+  if (mode == TraceFileSession::Mode::kLongTrace) {
+    config.set_write_into_file(true);
+    config.set_file_write_period_ms(static_cast<uint32_t>(flush_period));
+    config.set_flush_period_ms(static_cast<uint32_t>(flush_period));
+    if (max_file_size > 0)
+      config.set_max_file_size_bytes(static_cast<uint64_t>(max_file_size));
+  }
+
+  session =
+      std::make_unique<TraceFileSession>(std::move(path), std::move(config), mode);
+  session->Start(std::move(promise));
+  return handle;
+}
+
+v8::Local<v8::Promise> StopStreaming(v8::Isolate* isolate) {
+  gin_helper::Promise<base::FilePath> promise(isolate);
+  v8::Local<v8::Promise> handle = promise.GetHandle();
+
+  auto& session = TraceFileSession::Current();
+  if (!session || !session->IsRunning()) {
+    promise.RejectWithErrorMessage("No trace is being streamed");
+    return handle;
+  }
+  session->Stop(std::move(promise));
+  return handle;
+}
+
 void Initialize(v8::Local<v8::Object> exports,
                 v8::Local<v8::Value> unused,
                 v8::Local<v8::Context> context,
@@ -178,6 +461,8 @@ void Initialize(v8::Local<v8::Object> exports,
   dict.SetMethod("startRecording", &StartTracing);
   dict.SetMethod("stopRecording", &StopRecording);
   dict.SetMethod("getTraceBufferUsage", &GetTraceBufferUsage);
+  dict.SetMethod("startStreaming", &StartStreaming);
+  dict.SetMethod("stopStreaming", &StopStreaming);
 }
 
 }  // namespace
@@ -4,16 +4,23 @@
 
 #include "shell/browser/api/electron_api_cookies.h"
 
+#include <algorithm>
+#include <memory>
+#include <optional>
 #include <string>
 #include <string_view>
 #include <utility>
+#include <vector>
 
+#include "base/barrier_callback.h"
+#include "base/task/sequenced_task_runner.h"
 #include "base/time/time.h"
 #include "base/values.h"
 #include "content/public/browser/browser_context.h"
 #include "content/public/browser/browser_task_traits.h"
 #include "content/public/browser/browser_thread.h"
 #include "content/public/browser/storage_partition.h"
+#include "gin/arguments.h"
 #include "gin/dictionary.h"
 #include "gin/object_template_builder.h"
 #include "net/cookies/canonical_cookie.h"
@@ -23,6 +30,7 @@
 #include "shell/browser/cookie_change_notifier.h"
 #include "shell/browser/electron_browser_context.h"
 #include "shell/browser/javascript_environment.h"
+#include "shell/common/gin_converters/callback_converter.h"
 #include "shell/common/gin_converters/gurl_converter.h"
 #include "shell/common/gin_converters/value_converter.h"
 #include "shell/common/gin_helper/dictionary.h"
@@ -97,6 +105,8 @@ namespace electron::api {
 
 namespace {
 
+constexpr uint32_t kDefaultCookieBatchSize = 1000;
+
 // Returns whether |domain| matches |filter|.
 bool MatchesDomain(std::string filter, const std::string& domain) {
   // Add a leading '.' character to the filter domain if it doesn't exist.
@@ -214,6 +224,90 @@ std::string StringToCookieSameSite(const std::string* str_ptr,
   return "";
 }
 
+// Creates the cookie described by |details|, in the format taken by
+// cookies.set(), along with the URL and options to set it with.
+std::unique_ptr<net::CanonicalCookie> CookieFromDetails(
+    const base::Value::Dict& details,
+    GURL* url,
+    net::CookieOptions* options,
+    std::string* error) {
+  const std::string* url_string = details.FindString("url");
+  if (!url_string) {
+    *error = "Missing required option 'url'";
+    return nullptr;
+  }
+  const std::string* name = details.FindString("name");
+  const std::string* value = details.FindString("value");
+  const std::string* domain = details.FindString("domain");
+  const std::string* path = details.FindString("path");
+  bool http_only = details.FindBool("httpOnly").value_or(false);
+  const std::string* same_site_string = details.FindString("sameSite");
+  net::CookieSameSite same_site;
+  *error = StringToCookieSameSite(same_site_string, &same_site);
+  if (!error->empty())
+    return nullptr;
+  bool secure = details.FindBool("secure").value_or(
+      same_site == net::CookieSameSite::NO_RESTRICTION);
+
+  *url = GURL(*url_string);
+  if (!url->is_valid()) {
+    *error = InclusionStatusToString(net::CookieInclusionStatus(
+        net::CookieInclusionStatus::EXCLUDE_INVALID_DOMAIN));
+    return nullptr;
+  }
+
+  net::CookieInclusionStatus status;
+  auto canonical_cookie = net::CanonicalCookie::CreateSanitizedCookie(
+      *url, name ? *name : "", value ? *value : "", domain ? *domain : "",
+      path ? *path : "", ParseTimeProperty(details.FindDouble("creationDate")),
+      ParseTimeProperty(details.FindDouble("expirationDate")),
+      ParseTimeProperty(details.FindDouble("lastAccessDate")), secure,
+      http_only, same_site, net::COOKIE_PRIORITY_DEFAULT, std::nullopt,
+      &status);
+
+  if (!canonical_cookie || !canonical_cookie->IsCanonical()) {
+    *error = InclusionStatusToString(
+        !status.IsInclude()
+            ? status
+            : net::CookieInclusionStatus(
+                  net::CookieInclusionStatus::EXCLUDE_FAILURE_TO_STORE));
+    return nullptr;
+  }
+
+  if (http_only)
+    options->set_include_httponly();
+  options->set_same_site_cookie_context(
+      net::CookieOptions::SameSiteCookieContext::MakeInclusive());
+  return canonical_cookie;
+}
+
+// Passes |cookies| to |callback| |batch_size| at a time, one batch per task,
+// so that only a single batch has to exist as JS objects at any time.
+void RunCookieBatches(std::shared_ptr<const net::CookieList> cookies,
+                      size_t offset,
+                      size_t batch_size,
+                      Cookies::BatchCallback callback,
+                      gin_helper::Promise<void> promise) {
+  if (offset >= cookies->size()) {
+    promise.Resolve();
+    return;
+  }
+  const size_t end = std::min(cookies->size(), offset + batch_size);
+  {
+    v8::Isolate* isolate = JavascriptEnvironment::GetIsolate();
+    v8::HandleScope scope(isolate);
+    std::vector<v8::Local<v8::Value>> batch;
+    batch.reserve(end - offset);
+    for (size_t i = offset; i < end; ++i)
+      batch.push_back(gin::ConvertToV8(isolate, (*cookies)[i]));
+    callback.Run(gin::ConvertToV8(isolate, batch));
+  }
+  base::SequencedTaskRunner::GetCurrentDefault()->PostTask(
+      FROM_HERE, base::BindOnce(&RunCookieBatches, std::move(cookies), end,
+                                batch_size, std::move(callback),
+                                std::move(promise)));
+}
+
 }  // namespace
 
 gin::WrapperInfo Cookies::kWrapperInfo = {gin::kEmbedderNativeGin};
@@ -289,58 +383,14 @@ v8::Local<v8::Promise> Cookies::Set(v8::Isolate* isolate,
   gin_helper::Promise<void> promise(isolate);
   v8::Local<v8::Promise> handle = promise.GetHandle();
 
-  const std::string* url_string = details.FindString("url");
-  if (!url_string) {
-    promise.RejectWithErrorMessage("Missing required option 'url'");
-    return handle;
-  }
-  const std::string* name = details.FindString("name");
-  const std::string* value = details.FindString("value");
-  const std::string* domain = details.FindString("domain");
-  const std::string* path = details.FindString("path");
-  bool http_only = details.FindBool("httpOnly").value_or(false);
-  const std::string* same_site_string = details.FindString("sameSite");
-  net::CookieSameSite same_site;
-  std::string error = StringToCookieSameSite(same_site_string, &same_site);
-  if (!error.empty()) {
+  GURL url;
+  net::CookieOptions options;
+  std::string error;
+  auto canonical_cookie = CookieFromDetails(details, &url, &options, &error);
+  if (!canonical_cookie) {
     promise.RejectWithErrorMessage(error);
     return handle;
   }
-  bool secure = details.FindBool("secure").value_or(
-      same_site == net::CookieSameSite::NO_RESTRICTION);
-
-  GURL url(url_string ? *url_string : "");
-  if (!url.is_valid()) {
-    promise.RejectWithErrorMessage(
-        InclusionStatusToString(net::CookieInclusionStatus(
-            net::CookieInclusionStatus::EXCLUDE_INVALID_DOMAIN)));
-    return handle;
-  }
-
-  net::CookieInclusionStatus status;
-  auto canonical_cookie = net::CanonicalCookie::CreateSanitizedCookie(
-      url, name ? *name : "", value ? *value : "", domain ? *domain : "",
-      path ? *path : "", ParseTimeProperty(details.FindDouble("creationDate")),
-      ParseTimeProperty(details.FindDouble("expirationDate")),
-      ParseTimeProperty(details.FindDouble("lastAccessDate")), secure,
-      http_only, same_site, net::COOKIE_PRIORITY_DEFAULT, std::nullopt,
-      &status);
-
-  if (!canonical_cookie || !canonical_cookie->IsCanonical()) {
-    promise.RejectWithErrorMessage(InclusionStatusToString(
-        !status.IsInclude()
-            ? status
-            : net::CookieInclusionStatus(
-                  net::CookieInclusionStatus::EXCLUDE_FAILURE_TO_STORE)));
-    return handle;
-  }
-
-  net::CookieOptions options;
-  if (http_only) {
-    options.set_include_httponly();
-  }
-  options.set_same_site_cookie_context(
-      net::CookieOptions::SameSiteCookieContext::MakeInclusive());
 
   auto* storage_partition = browser_context_->GetDefaultStoragePartition();
   auto* manager = storage_partition->GetCookieManagerForBrowserProcess();
@@ -359,6 +409,108 @@ v8::Local<v8::Promise> Cookies::Set(v8::Isolate* isolate,
   return handle;
 }
 
+v8::Local<v8::Promise> Cookies::SetMany(v8::Isolate* isolate,
+                                        base::Value::List details_list) {
+  gin_helper::Promise<base::Value::List> promise(isolate);
+  v8::Local<v8::Promise> handle = promise.GetHandle();
+
+  // Index and error message of each cookie that could not be set.
+  using Failure = std::pair<size_t, std::string>;
+  std::vector<Failure> failures;
+  std::vector<std::pair<size_t, net::CanonicalCookie>> cookies;
+  std::vector<std::pair<GURL, net::CookieOptions>> cookie_params;
+  for (size_t i = 0; i < details_list.size(); ++i) {
+    const base::Value::Dict* details = details_list[i].GetIfDict();
+    if (!details) {
+      failures.emplace_back(i, "Cookie details must be an object");
+      continue;
+    }
+    GURL url;
+    net::CookieOptions options;
+    std::string error;
+    auto canonical_cookie = CookieFromDetails(*details, &url, &options, &error);
+    if (!canonical_cookie) {
+      failures.emplace_back(i, std::move(error));
+      continue;
+    }
+    cookies.emplace_back(i, std::move(*canonical_cookie));
+    cookie_params.emplace_back(std::move(url), std::move(options));
+  }
+
+  auto on_done = base::BindOnce(
+      [](gin_helper::Promise<base::Value::List> promise, size_t count,
+         std::vector<Failure> failures, std::vector<Failure> set_failures) {
+        base::Value::List results;
+        results.reserve(count);
+        for (size_t i = 0; i < count; ++i)
+          results.Append(base::Value());
+        for (auto& [index, error] : failures)
+          results[index] = base::Value(std::move(error));
+        for (auto& [index, error] : set_failures) {
+          if (!error.empty())
+            results[index] = base::Value(std::move(error));
+        }
+        promise.Resolve(std::move(results));
+      },
+      std::move(promise), details_list.size(), std::move(failures));
+
+  if (cookies.empty()) {
+    std::move(on_done).Run({});
+    return handle;
+  }
+
+  // Every cookie still needs its own SetCanonicalCookie message, but they are
+  // all sent at once and settle a single promise.
+  auto barrier =
+      base::BarrierCallback<Failure>(cookies.size(), std::move(on_done));
+  auto* storage_partition = browser_context_->GetDefaultStoragePartition();
+  auto* manager = storage_partition->GetCookieManagerForBrowserProcess();
+  for (size_t i = 0; i < cookies.size(); ++i) {
+    manager->SetCanonicalCookie(
+        cookies[i].second, cookie_params[i].first, cookie_params[i].second,
+        base::BindOnce(
+            [](const base::RepeatingCallback<void(Failure)>& barrier,
+               size_t index, net::CookieAccessResult r) {
+              barrier.Run(
+                  {index, r.status.IsInclude()
+                              ? std::string()
+                              : std::string(InclusionStatusToString(r.status))});
+            },
+            barrier, cookies[i].first));
+  }
+
+  return handle;
+}
+
+v8::Local<v8::Promise> Cookies::GetAllInBatches(v8::Isolate* isolate,
+                                                BatchCallback callback,
+                                                gin::Arguments* args) {
+  gin_helper::Promise<void> promise(isolate);
+  v8::Local<v8::Promise> handle = promise.GetHandle();
+
+  uint32_t batch_size = kDefaultCookieBatchSize;
+  gin_helper::Dictionary options;
+  if (args->GetNext(&options))
+    options.Get("batchSize", &batch_size);
+  if (batch_size == 0) {
+    promise.RejectWithErrorMessage("'batchSize' must be a positive integer");
+    return handle;
+  }
+
+  auto* storage_partition = browser_context_->GetDefaultStoragePartition();
+  auto* manager = storage_partition->GetCookieManagerForBrowserProcess();
+  manager->GetAllCookies(base::BindOnce(
+      [](BatchCallback callback, size_t batch_size,
+         gin_helper::Promise<void> promise, const net::CookieList& cookies) {
+        RunCookieBatches(
+            std::make_shared<const net::CookieList>(cookies), 0, batch_size,
+            std::move(callback), std::move(promise));
+      },
+      std::move(callback), batch_size, std::move(promise)));
+
+  return handle;
+}
+
 v8::Local<v8::Promise> Cookies::FlushStore(v8::Isolate* isolate) {
   gin_helper::Promise<void> promise(isolate);
   v8::Local<v8::Promise> handle = promise.GetHandle();
@@ -372,7 +524,44 @@ v8::Local<v8::Promise> Cookies::FlushStore(v8::Isolate* isolate) {
   return handle;
 }
 
+void Cookies::SetChangeFilter(gin::Arguments* args) {
+  // Changes collected under the previous filter are still delivered.
+  EmitPendingChanges();
+  change_filter_.reset();
+  change_batch_interval_ = base::TimeDelta();
+
+  v8::Local<v8::Value> value;
+  if (!args->GetNext(&value) || value->IsNullOrUndefined())
+    return;
+
+  base::Value::Dict filter;
+  if (!gin::ConvertFromV8(args->isolate(), value, &filter)) {
+    args->ThrowTypeError("Must pass an object or null as the filter");
+    return;
+  }
+  if (std::optional<double> interval = filter.FindDouble("batchInterval")) {
+    if (*interval < 0) {
+      args->ThrowTypeError("'batchInterval' must be a non-negative number");
+      return;
+    }
+    change_batch_interval_ = base::Milliseconds(*interval);
+  }
+  change_filter_ = std::move(filter);
+}
+
 void Cookies::OnCookieChanged(const net::CookieChangeInfo& change) {
+  if (change_filter_ && !MatchesCookie(*change_filter_, change.cookie))
+    return;
+
+  if (change_batch_interval_.is_positive()) {
+    pending_changes_.push_back(change);
+    if (!change_batch_timer_.IsRunning()) {
+      change_batch_timer_.Start(FROM_HERE, change_batch_interval_, this,
+                                &Cookies::EmitPendingChanges);
+    }
+    return;
+  }
+
   v8::Isolate* isolate = JavascriptEnvironment::GetIsolate();
   v8::HandleScope scope(isolate);
   Emit("changed", gin::ConvertToV8(isolate, change.cookie),
@@ -381,6 +570,26 @@ void Cookies::OnCookieChanged(const net::CookieChangeInfo& change) {
                         change.cause != net::CookieChangeCause::INSERTED));
 }
 
+void Cookies::EmitPendingChanges() {
+  change_batch_timer_.Stop();
+  if (pending_changes_.empty())
+    return;
+
+  v8::Isolate* isolate = JavascriptEnvironment::GetIsolate();
+  v8::HandleScope scope(isolate);
+  std::vector<v8::Local<v8::Value>> changes;
+  changes.reserve(pending_changes_.size());
+  for (const auto& change : pending_changes_) {
+    gin::Dictionary dict(isolate, v8::Object::New(isolate));
+    dict.Set("cookie", change.cookie);
+    dict.Set("cause", change.cause);
+    dict.Set("removed", change.cause != net::CookieChangeCause::INSERTED);
+    changes.push_back(gin::ConvertToV8(isolate, dict));
+  }
+  pending_changes_.clear();
+  Emit("changed-batch", changes);
+}
+
 // static
 gin::Handle<Cookies> Cookies::Create(v8::Isolate* isolate,
                                      ElectronBrowserContext* browser_context) {
@@ -394,7 +603,10 @@ gin::ObjectTemplateBuilder Cookies::GetObjectTemplateBuilder(
       .SetMethod("get", &Cookies::Get)
       .SetMethod("remove", &Cookies::Remove)
       .SetMethod("set", &Cookies::Set)
-      .SetMethod("flushStore", &Cookies::FlushStore);
+      .SetMethod("setMany", &Cookies::SetMany)
+      .SetMethod("getAllInBatches", &Cookies::GetAllInBatches)
+      .SetMethod("flushStore", &Cookies::FlushStore)
+      .SetMethod("setChangeFilter", &Cookies::SetChangeFilter);
 }
 
 const char* Cookies::GetTypeName() {
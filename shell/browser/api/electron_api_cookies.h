@@ -5,10 +5,14 @@
 #ifndef ELECTRON_SHELL_BROWSER_API_ELECTRON_API_COOKIES_H_
 #define ELECTRON_SHELL_BROWSER_API_ELECTRON_API_COOKIES_H_
 
+#include <optional>
 #include <string>
+#include <vector>
 
 #include "base/callback_list.h"
 #include "base/memory/raw_ptr.h"
+#include "base/time/time.h"
+#include "base/timer/timer.h"
 #include "base/values.h"
 #include "gin/handle.h"
 #include "net/cookies/canonical_cookie.h"
@@ -17,6 +21,10 @@
 #include "shell/common/gin_helper/promise.h"
 #include "shell/common/gin_helper/trackable_object.h"
 
+namespace gin {
+class Arguments;
+}
+
 namespace gin_helper {
 class Dictionary;
 }
@@ -30,6 +38,8 @@ namespace api {
 class Cookies : public gin::Wrappable<Cookies>,
                 public gin_helper::EventEmitterMixin<Cookies> {
  public:
+  using BatchCallback = base::RepeatingCallback<void(v8::Local<v8::Value>)>;
+
   static gin::Handle<Cookies> Create(v8::Isolate* isolate,
                                      ElectronBrowserContext* browser_context);
 
@@ -50,17 +60,32 @@ class Cookies : public gin::Wrappable<Cookies>,
   v8::Local<v8::Promise> Get(v8::Isolate*,
                              const gin_helper::Dictionary& filter);
   v8::Local<v8::Promise> Set(v8::Isolate*, base::Value::Dict details);
+  v8::Local<v8::Promise> SetMany(v8::Isolate*, base::Value::List details_list);
+  v8::Local<v8::Promise> GetAllInBatches(v8::Isolate*,
+                                         BatchCallback callback,
+                                         gin::Arguments* args);
   v8::Local<v8::Promise> Remove(v8::Isolate*,
                                 const GURL& url,
                                 const std::string& name);
   v8::Local<v8::Promise> FlushStore(v8::Isolate*);
+  void SetChangeFilter(gin::Arguments* args);
 
   // CookieChangeNotifier subscription:
   void OnCookieChanged(const net::CookieChangeInfo& change);
 
  private:
+  void EmitPendingChanges();
+
   base::CallbackListSubscription cookie_change_subscription_;
 
+  // Changes of cookies not matching |change_filter_| are not emitted. When
+  // |change_batch_interval_| is set, changes are collected in
+  // |pending_changes_| and emitted together once it has elapsed.
+  std::optional<base::Value::Dict> change_filter_;
+  base::TimeDelta change_batch_interval_;
+  std::vector<net::CookieChangeInfo> pending_changes_;
+  base::OneShotTimer change_batch_timer_;
+
   // Weak reference; ElectronBrowserContext is guaranteed to outlive us.
   raw_ptr<ElectronBrowserContext> browser_context_;
 };
@@ -4,6 +4,7 @@
 
 #include "shell/browser/api/electron_api_data_pipe_holder.h"
 
+#include <algorithm>
 #include <utility>
 #include <vector>
 
@@ -12,6 +13,7 @@
 #include "base/no_destructor.h"
 #include "base/strings/string_number_conversions.h"
 #include "base/task/sequenced_task_runner.h"
+#include "gin/object_template_builder.h"
 #include "mojo/public/cpp/system/data_pipe.h"
 #include "mojo/public/cpp/system/simple_watcher.h"
 #include "net/base/net_errors.h"
@@ -142,8 +144,13 @@ class DataPipeReader {
 
 gin::WrapperInfo DataPipeHolder::kWrapperInfo = {gin::kEmbedderNativeGin};
 
-DataPipeHolder::DataPipeHolder(const network::DataElement& element)
-    : id_(base::NumberToString(++g_next_id)) {
+DataPipeHolder::DataPipeHolder(v8::Isolate* isolate,
+                               const network::DataElement& element)
+    : isolate_(isolate),
+      id_(base::NumberToString(++g_next_id)),
+      handle_watcher_(FROM_HERE,
+                      mojo::SimpleWatcher::ArmingPolicy::MANUAL,
+                      base::SequencedTaskRunner::GetCurrentDefault()) {
   data_pipe_.Bind(
       element.As<network::DataElementDataPipe>().CloneDataPipeGetter());
 }
@@ -153,7 +160,7 @@ DataPipeHolder::~DataPipeHolder() = default;
 v8::Local<v8::Promise> DataPipeHolder::ReadAll(v8::Isolate* isolate) {
   gin_helper::Promise<v8::Local<v8::Value>> promise(isolate);
   v8::Local<v8::Promise> handle = promise.GetHandle();
-  if (!data_pipe_) {
+  if (!data_pipe_ || reading_) {
     promise.RejectWithErrorMessage("Could not get blob data");
     return handle;
   }
@@ -162,6 +169,115 @@ v8::Local<v8::Promise> DataPipeHolder::ReadAll(v8::Isolate* isolate) {
   return handle;
 }
 
+v8::Local<v8::Promise> DataPipeHolder::Read(
+    v8::Local<v8::ArrayBufferView> buffer) {
+  gin_helper::Promise<int> promise(isolate_);
+  v8::Local<v8::Promise> handle = promise.GetHandle();
+  if (!buffer_.IsEmpty()) {
+    promise.RejectWithErrorMessage("A read is already in progress");
+    return handle;
+  }
+  if (buffer->ByteLength() == 0) {
+    promise.RejectWithErrorMessage("The buffer must not be empty");
+    return handle;
+  }
+
+  if (!reading_) {
+    if (!data_pipe_) {
+      promise.RejectWithErrorMessage("Could not get blob data");
+      return handle;
+    }
+    mojo::ScopedDataPipeProducerHandle producer_handle;
+    if (mojo::CreateDataPipe(nullptr, producer_handle, stream_) !=
+        MOJO_RESULT_OK) {
+      promise.RejectWithErrorMessage("Could not get blob data");
+      return handle;
+    }
+    reading_ = true;
+    data_pipe_->Read(std::move(producer_handle),
+                     base::BindOnce(&DataPipeHolder::OnSizeReceived,
+                                    weak_factory_.GetWeakPtr()));
+    handle_watcher_.Watch(
+        stream_.get(),
+        MOJO_HANDLE_SIGNAL_READABLE | MOJO_HANDLE_SIGNAL_PEER_CLOSED,
+        base::BindRepeating(&DataPipeHolder::OnHandleReadable,
+                            weak_factory_.GetWeakPtr()));
+  }
+
+  buffer_.Reset(isolate_, buffer);
+  promise_ = std::move(promise);
+  ContinueRead();
+  return handle;
+}
+
+void DataPipeHolder::ContinueRead() {
+  if (status_ != net::OK) {
+    CompleteRead(status_);
+    return;
+  }
+  if (size_ && bytes_read_ == *size_) {
+    CompleteRead(0);
+    return;
+  }
+  // The pipe was closed before the size arrived; OnSizeReceived() tells
+  // whether that was the end of the data.
+  if (!stream_.is_valid()) {
+    if (size_)
+      CompleteRead(net::ERR_FAILED);
+    return;
+  }
+
+  v8::HandleScope handle_scope(isolate_);
+  v8::Local<v8::ArrayBufferView> buffer = buffer_.Get(isolate_);
+  uint32_t num_bytes = buffer->ByteLength();
+  if (size_)
+    num_bytes = std::min<uint64_t>(num_bytes, *size_ - bytes_read_);
+  MojoResult result = stream_->ReadData(
+      static_cast<char*>(buffer->Buffer()->Data()) + buffer->ByteOffset(),
+      &num_bytes, MOJO_READ_DATA_FLAG_NONE);
+  if (result == MOJO_RESULT_OK) {
+    bytes_read_ += num_bytes;
+    CompleteRead(num_bytes);
+  } else if (result == MOJO_RESULT_SHOULD_WAIT) {
+    handle_watcher_.ArmOrNotify();
+  } else {
+    handle_watcher_.Cancel();
+    stream_.reset();
+    if (size_)
+      CompleteRead(net::ERR_FAILED);
+  }
+}
+
+void DataPipeHolder::CompleteRead(int result) {
+  buffer_.Reset();
+  if (result < 0)
+    std::move(promise_).RejectWithErrorMessage(net::ErrorToString(result));
+  else
+    std::move(promise_).Resolve(result);
+}
+
+void DataPipeHolder::OnSizeReceived(int32_t status, uint64_t size) {
+  status_ = status;
+  if (status == net::OK) {
+    size_ = size;
+    if (size < bytes_read_)
+      status_ = net::ERR_FAILED;
+  }
+  if (!buffer_.IsEmpty())
+    ContinueRead();
+}
+
+void DataPipeHolder::OnHandleReadable(MojoResult result) {
+  if (!buffer_.IsEmpty())
+    ContinueRead();
+}
+
+gin::ObjectTemplateBuilder DataPipeHolder::GetObjectTemplateBuilder(
+    v8::Isolate* isolate) {
+  return gin::Wrappable<DataPipeHolder>::GetObjectTemplateBuilder(isolate)
+      .SetMethod("read", &DataPipeHolder::Read);
+}
+
 const char* DataPipeHolder::GetTypeName() {
   return "DataPipeHolder";
 }
@@ -170,7 +286,8 @@ const char* DataPipeHolder::GetTypeName() {
 gin::Handle<DataPipeHolder> DataPipeHolder::Create(
     v8::Isolate* isolate,
     const network::DataElement& element) {
-  auto handle = gin::CreateHandle(isolate, new DataPipeHolder(element));
+  auto handle =
+      gin::CreateHandle(isolate, new DataPipeHolder(isolate, element));
   AllDataPipeHolders().Set(isolate, handle->id(),
                            handle->GetWrapper(isolate).ToLocalChecked());
   return handle;
@@ -5,13 +5,20 @@
 #ifndef ELECTRON_SHELL_BROWSER_API_ELECTRON_API_DATA_PIPE_HOLDER_H_
 #define ELECTRON_SHELL_BROWSER_API_ELECTRON_API_DATA_PIPE_HOLDER_H_
 
+#include <optional>
 #include <string>
 
+#include "base/memory/raw_ptr.h"
+#include "base/memory/weak_ptr.h"
 #include "gin/handle.h"
 #include "gin/wrappable.h"
 #include "mojo/public/cpp/bindings/remote.h"
+#include "mojo/public/cpp/system/data_pipe.h"
+#include "mojo/public/cpp/system/simple_watcher.h"
+#include "net/base/net_errors.h"
 #include "services/network/public/cpp/data_element.h"
 #include "services/network/public/mojom/data_pipe_getter.mojom.h"
+#include "shell/common/gin_helper/promise.h"
 
 namespace electron::api {
 
@@ -20,6 +27,8 @@ class DataPipeHolder : public gin::Wrappable<DataPipeHolder> {
  public:
   // gin::Wrappable
   static gin::WrapperInfo kWrapperInfo;
+  gin::ObjectTemplateBuilder GetObjectTemplateBuilder(
+      v8::Isolate* isolate) override;
   const char* GetTypeName() override;
 
   static gin::Handle<DataPipeHolder> Create(
@@ -34,6 +43,12 @@ class DataPipeHolder : public gin::Wrappable<DataPipeHolder> {
   // no one has complained about it yet.
   v8::Local<v8::Promise> ReadAll(v8::Isolate* isolate);
 
+  // Reads the next chunk of data into |buffer|. Resolves with the number of
+  // bytes read, or with 0 once all of the data has been read. Data is only
+  // pulled from the pipe as it is asked for, so a caller forwarding the chunks
+  // elsewhere never holds more than one of them.
+  v8::Local<v8::Promise> Read(v8::Local<v8::ArrayBufferView> buffer);
+
   // The unique ID that can be used to receive the object.
   const std::string& id() const { return id_; }
 
@@ -42,11 +57,32 @@ class DataPipeHolder : public gin::Wrappable<DataPipeHolder> {
   DataPipeHolder& operator=(const DataPipeHolder&) = delete;
 
  private:
-  explicit DataPipeHolder(const network::DataElement& element);
+  DataPipeHolder(v8::Isolate* isolate, const network::DataElement& element);
   ~DataPipeHolder() override;
 
+  // Fills the pending Read() buffer if data, the end of the data or an error
+  // is available, and otherwise waits for one of them.
+  void ContinueRead();
+  void CompleteRead(int result);
+  void OnSizeReceived(int32_t status, uint64_t size);
+  void OnHandleReadable(MojoResult result);
+
+  raw_ptr<v8::Isolate> isolate_;
   std::string id_;
   mojo::Remote<network::mojom::DataPipeGetter> data_pipe_;
+
+  // State of the reads started by Read().
+  bool reading_ = false;
+  mojo::ScopedDataPipeConsumerHandle stream_;
+  mojo::SimpleWatcher handle_watcher_;
+  int status_ = net::OK;
+  std::optional<uint64_t> size_;
+  uint64_t bytes_read_ = 0;
+  // Non-empty while a Read() is pending.
+  v8::Global<v8::ArrayBufferView> buffer_;
+  gin_helper::Promise<int> promise_;
+
+  base::WeakPtrFactory<DataPipeHolder> weak_factory_{this};
 };
 
 }  // namespace electron::api
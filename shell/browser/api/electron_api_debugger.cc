@@ -6,8 +6,8 @@
 
 #include <string>
 #include <utility>
+#include <vector>
 
-#include "base/json/json_reader.h"
 #include "base/json/json_writer.h"
 #include "content/public/browser/devtools_agent_host.h"
 #include "content/public/browser/web_contents.h"
@@ -15,12 +15,85 @@
 #include "gin/per_isolate_data.h"
 #include "shell/browser/javascript_environment.h"
 #include "shell/common/gin_converters/value_converter.h"
+#include "shell/common/gin_helper/dictionary.h"
 #include "shell/common/node_includes.h"
+#include "third_party/inspector_protocol/crdtp/cbor.h"
+#include "third_party/inspector_protocol/crdtp/json.h"
 
 using content::DevToolsAgentHost;
 
 namespace electron::api {
 
+namespace {
+
+using crdtp::cbor::CBORTokenizer;
+using crdtp::cbor::CBORTokenTag;
+
+// The top level fields of a binary protocol message that are needed to route
+// it, everything else is left encoded.
+struct BinaryMessageHeader {
+  std::optional<int> id;
+  std::string method;
+  std::string session_id;
+};
+
+std::string ToString(crdtp::span<uint8_t> bytes) {
+  return std::string(reinterpret_cast<const char*>(bytes.data()),
+                     bytes.size());
+}
+
+// Moves |tokenizer| past the value it points at. Envelopes are skipped at
+// once, arrays and maps outside of envelopes token by token.
+bool SkipValue(CBORTokenizer* tokenizer) {
+  int depth = 0;
+  do {
+    switch (tokenizer->TokenTag()) {
+      case CBORTokenTag::ARRAY_START:
+      case CBORTokenTag::MAP_START:
+        ++depth;
+        break;
+      case CBORTokenTag::STOP:
+        --depth;
+        break;
+      case CBORTokenTag::ERROR_VALUE:
+      case CBORTokenTag::DONE:
+        return false;
+      default:
+        break;
+    }
+    tokenizer->Next();
+  } while (depth > 0);
+  return true;
+}
+
+bool ParseBinaryMessageHeader(base::span<const uint8_t> message,
+                              BinaryMessageHeader* header) {
+  CBORTokenizer tokenizer(crdtp::SpanFrom(message));
+  if (tokenizer.TokenTag() == CBORTokenTag::ENVELOPE)
+    tokenizer.EnterEnvelope();
+  if (tokenizer.TokenTag() != CBORTokenTag::MAP_START)
+    return false;
+  tokenizer.Next();
+  while (tokenizer.TokenTag() != CBORTokenTag::STOP) {
+    if (tokenizer.TokenTag() != CBORTokenTag::STRING8)
+      return false;
+    const std::string key = ToString(tokenizer.GetString8());
+    tokenizer.Next();
+    const CBORTokenTag tag = tokenizer.TokenTag();
+    if (key == "id" && tag == CBORTokenTag::INT32)
+      header->id = tokenizer.GetInt32();
+    else if (key == "method" && tag == CBORTokenTag::STRING8)
+      header->method = ToString(tokenizer.GetString8());
+    else if (key == "sessionId" && tag == CBORTokenTag::STRING8)
+      header->session_id = ToString(tokenizer.GetString8());
+    if (!SkipValue(&tokenizer))
+      return false;
+  }
+  return true;
+}
+
+}  // namespace
+
 gin::WrapperInfo Debugger::kWrapperInfo = {gin::kEmbedderNativeGin};
 
 Debugger::Debugger(v8::Isolate* isolate, content::WebContents* web_contents)
@@ -31,6 +104,7 @@ Debugger::~Debugger() = default;
 void Debugger::AgentHostClosed(DevToolsAgentHost* agent_host) {
   DCHECK(agent_host == agent_host_);
   agent_host_ = nullptr;
+  event_filter_.reset();
   ClearPendingRequests();
   Emit("detach", "target closed");
 }
@@ -42,41 +116,107 @@ void Debugger::DispatchProtocolMessage(DevToolsAgentHost* agent_host,
   v8::Isolate* isolate = JavascriptEnvironment::GetIsolate();
   v8::HandleScope handle_scope(isolate);
 
-  base::StringPiece message_str(reinterpret_cast<const char*>(message.data()),
-                                message.size());
-  std::optional<base::Value> parsed_message = base::JSONReader::Read(
-      message_str, base::JSON_REPLACE_INVALID_CHARACTERS);
-  if (!parsed_message || !parsed_message->is_dict())
+  // The session always uses CBOR so that messages can be routed, and events
+  // filtered, by reading only their top level fields. Chromium would
+  // otherwise do the conversion to JSON for every message itself.
+  BinaryMessageHeader header;
+  if (!ParseBinaryMessageHeader(message, &header))
     return;
-  base::Value::Dict& dict = parsed_message->GetDict();
-  std::optional<int> id = dict.FindInt("id");
-  if (!id) {
-    std::string* method = dict.FindString("method");
-    if (!method)
+  if (!header.id) {
+    if (header.method.empty() || !ShouldEmitEvent(header.method))
       return;
-    std::string* session_id = dict.FindString("sessionId");
-    base::Value::Dict* params = dict.FindDict("params");
-    Emit("message", *method, params ? std::move(*params) : base::Value::Dict(),
-         session_id ? *session_id : "");
+    if (binary_messages_) {
+      Emit("binary-message", header.method,
+           node::Buffer::Copy(isolate,
+                              reinterpret_cast<const char*>(message.data()),
+                              message.size())
+               .ToLocalChecked(),
+           header.session_id);
+      return;
+    }
+  } else if (!pending_requests_.contains(*header.id)) {
+    return;
+  }
+
+  std::string json;
+  if (!crdtp::json::ConvertCBORToJSON(crdtp::SpanFrom(message), &json).ok())
+    return;
+
+  v8::Local<v8::Object> wrapper;
+  if (!GetWrapper(isolate).ToLocal(&wrapper))
+    return;
+  v8::Local<v8::Context> context = wrapper->GetCreationContextChecked();
+  v8::Context::Scope context_scope(context);
+
+  // Parsing straight into V8 values avoids building a base::Value tree that
+  // would only be converted again. Invalid UTF-8 is replaced like
+  // base::JSON_REPLACE_INVALID_CHARACTERS did.
+  v8::Local<v8::String> message_str;
+  v8::Local<v8::Value> parsed_message;
+  if (!v8::String::NewFromUtf8(isolate, json.data(),
+                               v8::NewStringType::kNormal, json.size())
+           .ToLocal(&message_str) ||
+      !v8::JSON::Parse(context, message_str).ToLocal(&parsed_message) ||
+      !parsed_message->IsObject())
+    return;
+  gin_helper::Dictionary dict(isolate, parsed_message.As<v8::Object>());
+
+  auto get_object = [&](std::string_view key) -> v8::Local<v8::Value> {
+    v8::Local<v8::Value> value;
+    if (dict.Get(key, &value) && value->IsObject())
+      return value;
+    return v8::Object::New(isolate);
+  };
+
+  if (!header.id) {
+    Emit("message", header.method, get_object("params"), header.session_id);
   } else {
-    auto it = pending_requests_.find(*id);
+    auto it = pending_requests_.find(*header.id);
     if (it == pending_requests_.end())
       return;
 
-    gin_helper::Promise<base::Value::Dict> promise = std::move(it->second);
+    gin_helper::Promise<v8::Local<v8::Value>> promise = std::move(it->second);
     pending_requests_.erase(it);
 
-    base::Value::Dict* error = dict.FindDict("error");
-    if (error) {
-      std::string* error_message = error->FindString("message");
-      promise.RejectWithErrorMessage(error_message ? *error_message : "");
+    v8::Local<v8::Value> error;
+    if (dict.Get("error", &error) && error->IsObject()) {
+      std::string error_message;
+      gin_helper::Dictionary(isolate, error.As<v8::Object>())
+          .Get("message", &error_message);
+      promise.RejectWithErrorMessage(error_message);
     } else {
-      base::Value::Dict* result = dict.FindDict("result");
-      promise.Resolve(result ? std::move(*result) : base::Value::Dict());
+      promise.Resolve(get_object("result"));
     }
   }
 }
 
+bool Debugger::UsesBinaryProtocol() {
+  return true;
+}
+
+bool Debugger::ShouldEmitEvent(const std::string& method) {
+  if (!event_filter_)
+    return true;
+  if (!event_filter_->methods.empty() &&
+      !event_filter_->methods.contains(method)) {
+    // "Domain.*" entries allow every event of a domain.
+    const size_t dot = method.find('.');
+    if (dot == std::string::npos ||
+        !event_filter_->methods.contains(method.substr(0, dot) + ".*"))
+      return false;
+  }
+  if (event_filter_->sample_rate >= 1)
+    return true;
+  // Emits a share of sample_rate of each method's events, evenly spaced
+  // rather than at random so that rare events are not starved.
+  double& credit = event_filter_->sample_credit[method];
+  credit += event_filter_->sample_rate;
+  if (credit < 1)
+    return false;
+  credit -= 1;
+  return true;
+}
+
 void Debugger::RenderFrameHostChanged(content::RenderFrameHost* old_rfh,
                                       content::RenderFrameHost* new_rfh) {
   if (agent_host_) {
@@ -90,6 +230,11 @@ void Debugger::Attach(gin::Arguments* args) {
   std::string protocol_version;
   args->GetNext(&protocol_version);
 
+  gin_helper::Dictionary options;
+  bool binary_messages = false;
+  if (args->GetNext(&options))
+    options.Get("binaryMessages", &binary_messages);
+
   if (agent_host_) {
     args->ThrowTypeError("Debugger is already attached to the target");
     return;
@@ -107,6 +252,7 @@ void Debugger::Attach(gin::Arguments* args) {
     return;
   }
 
+  binary_messages_ = binary_messages;
   agent_host_->AttachClient(this);
 }
 
@@ -123,7 +269,7 @@ void Debugger::Detach() {
 
 v8::Local<v8::Promise> Debugger::SendCommand(gin::Arguments* args) {
   v8::Isolate* isolate = args->isolate();
-  gin_helper::Promise<base::Value::Dict> promise(isolate);
+  gin_helper::Promise<v8::Local<v8::Value>> promise(isolate);
   v8::Local<v8::Promise> handle = promise.GetHandle();
 
   if (!agent_host_) {
@@ -159,13 +305,42 @@ v8::Local<v8::Promise> Debugger::SendCommand(gin::Arguments* args) {
     request.Set("sessionId", session_id);
   }
 
+  // WriteJson always produces valid JSON, which always converts.
   const auto json_args = base::WriteJson(request).value_or("");
-  agent_host_->DispatchProtocolMessage(
-      this, base::as_bytes(base::make_span(json_args)));
+  std::vector<uint8_t> cbor_args;
+  crdtp::json::ConvertJSONToCBOR(crdtp::SpanFrom(json_args), &cbor_args);
+  agent_host_->DispatchProtocolMessage(this, cbor_args);
 
   return handle;
 }
 
+void Debugger::SetEventFilter(gin::Arguments* args) {
+  gin_helper::Dictionary filter;
+  if (!args->GetNext(&filter)) {
+    event_filter_.reset();
+    return;
+  }
+
+  EventFilter event_filter;
+  std::vector<std::string> methods;
+  if (filter.Get("methods", &methods)) {
+    event_filter.methods = base::flat_set<std::string>(std::move(methods));
+  } else if (filter.Has("methods")) {
+    args->ThrowTypeError("methods must be an array of strings");
+    return;
+  }
+  if (filter.Has("sampleRate")) {
+    double sample_rate;
+    if (!filter.Get("sampleRate", &sample_rate) || !(sample_rate > 0) ||
+        sample_rate > 1) {
+      args->ThrowTypeError("sampleRate must be a number in the range (0, 1]");
+      return;
+    }
+    event_filter.sample_rate = sample_rate;
+  }
+  event_filter_ = std::move(event_filter);
+}
+
 void Debugger::ClearPendingRequests() {
   for (auto& it : pending_requests_)
     it.second.RejectWithErrorMessage("target closed while handling command");
@@ -185,7 +360,8 @@ gin::ObjectTemplateBuilder Debugger::GetObjectTemplateBuilder(
       .SetMethod("attach", &Debugger::Attach)
       .SetMethod("isAttached", &Debugger::IsAttached)
       .SetMethod("detach", &Debugger::Detach)
-      .SetMethod("sendCommand", &Debugger::SendCommand);
+      .SetMethod("sendCommand", &Debugger::SendCommand)
+      .SetMethod("setEventFilter", &Debugger::SetEventFilter);
 }
 
 const char* Debugger::GetTypeName() {
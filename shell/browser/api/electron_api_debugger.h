@@ -6,7 +6,11 @@
 #define ELECTRON_SHELL_BROWSER_API_ELECTRON_API_DEBUGGER_H_
 
 #include <map>
+#include <optional>
+#include <string>
 
+#include "base/containers/flat_map.h"
+#include "base/containers/flat_set.h"
 #include "base/functional/callback.h"
 #include "base/memory/raw_ptr.h"
 #include "base/values.h"
@@ -51,6 +55,7 @@ class Debugger : public gin::Wrappable<Debugger>,
   void AgentHostClosed(content::DevToolsAgentHost* agent_host) override;
   void DispatchProtocolMessage(content::DevToolsAgentHost* agent_host,
                                base::span<const uint8_t> message) override;
+  bool UsesBinaryProtocol() override;
 
   // content::WebContentsObserver:
   void RenderFrameHostChanged(content::RenderFrameHost* old_rfh,
@@ -58,19 +63,34 @@ class Debugger : public gin::Wrappable<Debugger>,
 
  private:
   using PendingRequestMap =
-      std::map<int, gin_helper::Promise<base::Value::Dict>>;
+      std::map<int, gin_helper::Promise<v8::Local<v8::Value>>>;
 
   void Attach(gin::Arguments* args);
   bool IsAttached();
   void Detach();
   v8::Local<v8::Promise> SendCommand(gin::Arguments* args);
+  void SetEventFilter(gin::Arguments* args);
   void ClearPendingRequests();
 
+  // Whether an event passes |event_filter_|.
+  bool ShouldEmitEvent(const std::string& method);
+
   raw_ptr<content::WebContents> web_contents_;  // Weak Reference.
   scoped_refptr<content::DevToolsAgentHost> agent_host_;
 
   PendingRequestMap pending_requests_;
   int previous_request_id_ = 0;
+
+  // Whether events are emitted still encoded, see attach().
+  bool binary_messages_ = false;
+
+  struct EventFilter {
+    // Allowed methods, or all of them when empty.
+    base::flat_set<std::string> methods;
+    double sample_rate = 1;
+    base::flat_map<std::string, double> sample_credit;
+  };
+  std::optional<EventFilter> event_filter_;
 };
 
 }  // namespace electron::api
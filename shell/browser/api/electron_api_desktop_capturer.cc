@@ -241,11 +241,7 @@ void DesktopCapturer::DesktopListListener::OnDelegatedSourceListDismissed() {
   std::move(failure_callback_).Run();
 }
 
-void DesktopCapturer::StartHandling(bool capture_window,
-                                    bool capture_screen,
-                                    const gfx::Size& thumbnail_size,
-                                    bool fetch_window_icons) {
-  fetch_window_icons_ = fetch_window_icons;
+void DesktopCapturer::DetectDirectXCapturer() {
 #if BUILDFLAG(IS_WIN)
   if (content::desktop_capture::CreateDesktopCaptureOptions()
           .allow_directx_capturer()) {
@@ -255,6 +251,48 @@ void DesktopCapturer::StartHandling(bool capture_window,
     using_directx_capturer_ = webrtc::ScreenCapturerWinDirectx::IsSupported();
   }
 #endif  // BUILDFLAG(IS_WIN)
+}
+
+DesktopCapturer::SourceListWatcher::SourceListWatcher(
+    DesktopCapturer* capturer,
+    std::unique_ptr<DesktopMediaList> list)
+    : capturer_(capturer), list_(std::move(list)) {}
+
+DesktopCapturer::SourceListWatcher::~SourceListWatcher() = default;
+
+void DesktopCapturer::SourceListWatcher::OnSourceAdded(int index) {
+  source_ids_.insert(source_ids_.begin() + index, list_->GetSource(index).id);
+  capturer_->EmitSourceUpdated(true, list_.get(), index);
+}
+
+void DesktopCapturer::SourceListWatcher::OnSourceRemoved(int index) {
+  const content::DesktopMediaID id = source_ids_[index];
+  source_ids_.erase(source_ids_.begin() + index);
+  capturer_->EmitSourceRemoved(id);
+}
+
+void DesktopCapturer::SourceListWatcher::OnSourceMoved(int old_index,
+                                                       int new_index) {
+  const content::DesktopMediaID id = source_ids_[old_index];
+  source_ids_.erase(source_ids_.begin() + old_index);
+  source_ids_.insert(source_ids_.begin() + new_index, id);
+}
+
+void DesktopCapturer::SourceListWatcher::OnSourceNameChanged(int index) {
+  capturer_->EmitSourceUpdated(false, list_.get(), index);
+}
+
+void DesktopCapturer::SourceListWatcher::OnSourceThumbnailChanged(int index) {
+  // The list only reports thumbnails whose content changed.
+  capturer_->EmitSourceUpdated(false, list_.get(), index);
+}
+
+void DesktopCapturer::StartHandling(bool capture_window,
+                                    bool capture_screen,
+                                    const gfx::Size& thumbnail_size,
+                                    bool fetch_window_icons) {
+  fetch_window_icons_ = fetch_window_icons;
+  DetectDirectXCapturer();
 
   // clear any existing captured sources.
   captured_sources_.clear();
@@ -381,46 +419,10 @@ void DesktopCapturer::UpdateSourcesList(DesktopMediaList* list) {
     for (int i = 0; i < list->GetSourceCount(); i++) {
       screen_sources.emplace_back(list->GetSource(i), std::string());
     }
-#if BUILDFLAG(IS_WIN)
-    // Gather the same unique screen IDs used by the electron.screen API in
-    // order to provide an association between it and
-    // desktopCapturer/getUserMedia. This is only required when using the
-    // DirectX capturer, otherwise the IDs across the APIs already match.
-    if (using_directx_capturer_) {
-      std::vector<std::string> device_names;
-      // Crucially, this list of device names will be in the same order as
-      // |media_list_sources|.
-      if (!webrtc::DxgiDuplicatorController::Instance()->GetDeviceNames(
-              &device_names)) {
-        HandleFailure();
-        return;
-      }
-
-      int device_name_index = 0;
-      for (auto& source : screen_sources) {
-        const auto& device_name = device_names[device_name_index++];
-        const int64_t device_id = base::PersistentHash(device_name);
-        source.display_id = base::NumberToString(device_id);
-      }
-    }
-#elif BUILDFLAG(IS_MAC)
-    // On Mac, the IDs across the APIs match.
-    for (auto& source : screen_sources) {
-      source.display_id = base::NumberToString(source.media_list_source.id.id);
-    }
-#elif BUILDFLAG(IS_OZONE_X11)
-    // On Linux, with X11, the source id is the numeric value of the
-    // display name atom and the display id is either the EDID or the
-    // loop index when that display was found (see
-    // BuildDisplaysFromXRandRInfo in ui/base/x/x11_display_util.cc)
-    const auto monitor_atom_to_display_id = MonitorAtomIdToDisplayId();
-    for (auto& source : screen_sources) {
-      auto display_id_iter =
-          monitor_atom_to_display_id.find(source.media_list_source.id.id);
-      if (display_id_iter != monitor_atom_to_display_id.end())
-        source.display_id = base::NumberToString(display_id_iter->second);
+    if (!AssignDisplayIds(&screen_sources)) {
+      HandleFailure();
+      return;
     }
-#endif
     std::move(screen_sources.begin(), screen_sources.end(),
               std::back_inserter(captured_sources_));
   }
@@ -437,6 +439,50 @@ void DesktopCapturer::UpdateSourcesList(DesktopMediaList* list) {
   }
 }
 
+bool DesktopCapturer::AssignDisplayIds(
+    std::vector<DesktopCapturer::Source>* screen_sources) {
+#if BUILDFLAG(IS_WIN)
+  // Gather the same unique screen IDs used by the electron.screen API in
+  // order to provide an association between it and
+  // desktopCapturer/getUserMedia. This is only required when using the
+  // DirectX capturer, otherwise the IDs across the APIs already match.
+  if (using_directx_capturer_) {
+    std::vector<std::string> device_names;
+    // Crucially, this list of device names will be in the same order as
+    // |media_list_sources|.
+    if (!webrtc::DxgiDuplicatorController::Instance()->GetDeviceNames(
+            &device_names)) {
+      return false;
+    }
+
+    int device_name_index = 0;
+    for (auto& source : *screen_sources) {
+      const auto& device_name = device_names[device_name_index++];
+      const int64_t device_id = base::PersistentHash(device_name);
+      source.display_id = base::NumberToString(device_id);
+    }
+  }
+#elif BUILDFLAG(IS_MAC)
+  // On Mac, the IDs across the APIs match.
+  for (auto& source : *screen_sources) {
+    source.display_id = base::NumberToString(source.media_list_source.id.id);
+  }
+#elif BUILDFLAG(IS_OZONE_X11)
+  // On Linux, with X11, the source id is the numeric value of the
+  // display name atom and the display id is either the EDID or the
+  // loop index when that display was found (see
+  // BuildDisplaysFromXRandRInfo in ui/base/x/x11_display_util.cc)
+  const auto monitor_atom_to_display_id = MonitorAtomIdToDisplayId();
+  for (auto& source : *screen_sources) {
+    auto display_id_iter =
+        monitor_atom_to_display_id.find(source.media_list_source.id.id);
+    if (display_id_iter != monitor_atom_to_display_id.end())
+      source.display_id = base::NumberToString(display_id_iter->second);
+  }
+#endif
+  return true;
+}
+
 void DesktopCapturer::HandleFailure() {
   v8::Isolate* isolate = JavascriptEnvironment::GetIsolate();
   v8::HandleScope scope(isolate);
@@ -448,6 +494,80 @@ void DesktopCapturer::HandleFailure() {
   Unpin();
 }
 
+bool DesktopCapturer::StartWatching(bool capture_window,
+                                    bool capture_screen,
+                                    const gfx::Size& thumbnail_size,
+                                    bool fetch_window_icons,
+                                    int update_interval_ms) {
+  fetch_window_icons_ = fetch_window_icons;
+  DetectDirectXCapturer();
+
+  for (const auto type :
+       {DesktopMediaList::Type::kWindow, DesktopMediaList::Type::kScreen}) {
+    const bool is_window = type == DesktopMediaList::Type::kWindow;
+    if (!(is_window ? capture_window : capture_screen))
+      continue;
+    auto capturer = is_window ? MakeWindowCapturer() : MakeScreenCapturer();
+    if (!capturer)
+      continue;
+    auto list =
+        std::make_unique<NativeDesktopMediaList>(type, std::move(capturer));
+    // Lists backed by a system picker only ever report the picked source.
+    if (list->IsSourceListDelegated())
+      continue;
+    list->SetThumbnailSize(thumbnail_size);
+    list->SetUpdatePeriod(base::Milliseconds(update_interval_ms));
+    watchers_.push_back(
+        std::make_unique<SourceListWatcher>(this, std::move(list)));
+  }
+
+  if (watchers_.empty()) {
+    Unpin();
+    return false;
+  }
+
+  for (auto& watcher : watchers_)
+    watcher->Start();
+  return true;
+}
+
+void DesktopCapturer::StopWatching() {
+  if (watchers_.empty())
+    return;
+  watchers_.clear();
+  Unpin();
+}
+
+void DesktopCapturer::EmitSourceUpdated(bool added,
+                                        DesktopMediaList* list,
+                                        int index) {
+  const bool is_window =
+      list->GetMediaListType() == DesktopMediaList::Type::kWindow;
+  // Icons rarely change, only fetch them for new windows.
+  DesktopCapturer::Source source{list->GetSource(index), std::string(),
+                                 is_window && added && fetch_window_icons_};
+  if (!is_window) {
+    // Display ids are assigned by position, so map the whole list.
+    std::vector<DesktopCapturer::Source> screen_sources;
+    screen_sources.reserve(list->GetSourceCount());
+    for (int i = 0; i < list->GetSourceCount(); i++)
+      screen_sources.emplace_back(list->GetSource(i), std::string());
+    if (AssignDisplayIds(&screen_sources))
+      source.display_id = screen_sources[index].display_id;
+  }
+
+  v8::Isolate* isolate = JavascriptEnvironment::GetIsolate();
+  v8::HandleScope scope(isolate);
+  gin_helper::CallMethod(this, "_onsourceupdated", added ? "added" : "updated",
+                         source);
+}
+
+void DesktopCapturer::EmitSourceRemoved(const content::DesktopMediaID& id) {
+  v8::Isolate* isolate = JavascriptEnvironment::GetIsolate();
+  v8::HandleScope scope(isolate);
+  gin_helper::CallMethod(this, "_onsourceremoved", id.ToString());
+}
+
 // static
 gin::Handle<DesktopCapturer> DesktopCapturer::Create(v8::Isolate* isolate) {
   auto handle = gin::CreateHandle(isolate, new DesktopCapturer(isolate));
@@ -461,7 +581,9 @@ gin::Handle<DesktopCapturer> DesktopCapturer::Create(v8::Isolate* isolate) {
 gin::ObjectTemplateBuilder DesktopCapturer::GetObjectTemplateBuilder(
     v8::Isolate* isolate) {
   return gin::Wrappable<DesktopCapturer>::GetObjectTemplateBuilder(isolate)
-      .SetMethod("startHandling", &DesktopCapturer::StartHandling);
+      .SetMethod("startHandling", &DesktopCapturer::StartHandling)
+      .SetMethod("startWatching", &DesktopCapturer::StartWatching)
+      .SetMethod("stopWatching", &DesktopCapturer::StopWatching);
 }
 
 const char* DesktopCapturer::GetTypeName() {
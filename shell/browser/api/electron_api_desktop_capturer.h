@@ -9,6 +9,7 @@
 #include <string>
 #include <vector>
 
+#include "base/memory/raw_ptr.h"
 #include "chrome/browser/media/webrtc/desktop_media_list_observer.h"
 #include "chrome/browser/media/webrtc/native_desktop_media_list.h"
 #include "gin/handle.h"
@@ -37,6 +38,15 @@ class DesktopCapturer : public gin::Wrappable<DesktopCapturer>,
                      const gfx::Size& thumbnail_size,
                      bool fetch_window_icons);
 
+  // Keeps the source lists alive and reports changes to them until
+  // StopWatching is called.
+  bool StartWatching(bool capture_window,
+                     bool capture_screen,
+                     const gfx::Size& thumbnail_size,
+                     bool fetch_window_icons,
+                     int update_interval_ms);
+  void StopWatching();
+
   // gin::Wrappable
   static gin::WrapperInfo kWrapperInfo;
   gin::ObjectTemplateBuilder GetObjectTemplateBuilder(
@@ -88,14 +98,44 @@ class DesktopCapturer : public gin::Wrappable<DesktopCapturer>,
     bool have_thumbnail_ = false;
   };
 
+  class SourceListWatcher : public DesktopMediaListObserver {
+   public:
+    SourceListWatcher(DesktopCapturer* capturer,
+                      std::unique_ptr<DesktopMediaList> list);
+    ~SourceListWatcher() override;
+
+    void Start() { list_->StartUpdating(this); }
+
+   protected:
+    void OnSourceAdded(int index) override;
+    void OnSourceRemoved(int index) override;
+    void OnSourceMoved(int old_index, int new_index) override;
+    void OnSourceNameChanged(int index) override;
+    void OnSourceThumbnailChanged(int index) override;
+    void OnSourcePreviewChanged(size_t index) override {}
+    void OnDelegatedSourceListSelection() override {}
+    void OnDelegatedSourceListDismissed() override {}
+
+   private:
+    raw_ptr<DesktopCapturer> capturer_;
+    std::unique_ptr<DesktopMediaList> list_;
+    // Mirrors the list, so that removed sources can still be identified.
+    std::vector<content::DesktopMediaID> source_ids_;
+  };
+
+  void DetectDirectXCapturer();
   void UpdateSourcesList(DesktopMediaList* list);
+  bool AssignDisplayIds(std::vector<DesktopCapturer::Source>* screen_sources);
   void HandleFailure();
+  void EmitSourceUpdated(bool added, DesktopMediaList* list, int index);
+  void EmitSourceRemoved(const content::DesktopMediaID& id);
 
   std::unique_ptr<DesktopListListener> window_listener_;
   std::unique_ptr<DesktopListListener> screen_listener_;
   std::unique_ptr<DesktopMediaList> window_capturer_;
   std::unique_ptr<DesktopMediaList> screen_capturer_;
   std::vector<DesktopCapturer::Source> captured_sources_;
+  std::vector<std::unique_ptr<SourceListWatcher>> watchers_;
   bool capture_window_ = false;
   bool capture_screen_ = false;
   bool fetch_window_icons_ = false;
@@ -101,6 +101,9 @@ void Initialize(v8::Local<v8::Object> exports,
   dict.SetMethod("showCertificateTrustDialog",
                  &certificate_trust::ShowCertificateTrust);
 #endif
+#if BUILDFLAG(IS_LINUX)
+  dict.SetMethod("prewarmDirectory", &file_dialog::PrewarmDirectory);
+#endif
 }
 
 }  // namespace
@@ -6,8 +6,10 @@
 
 #include <memory>
 
+#include "base/functional/bind.h"
 #include "base/strings/utf_string_conversions.h"
 #include "net/base/filename_util.h"
+#include "gin/arguments.h"
 #include "shell/browser/electron_browser_main_parts.h"
 #include "shell/common/gin_converters/file_dialog_converter.h"
 #include "shell/common/gin_converters/file_path_converter.h"
@@ -107,18 +109,57 @@ void DownloadItem::OnDownloadUpdated(download::DownloadItem* item) {
   if (!CheckAlive())
     return;
   if (download_item_->IsDone()) {
+    update_timer_.Stop();
     Emit("done", item->GetState());
     Unpin();
-  } else {
-    Emit("updated", item->GetState());
+    return;
+  }
+
+  // Progress updates are coalesced to at most one per |update_interval_|, but
+  // state changes such as pausing are always emitted right away.
+  const bool state_changed = item->GetState() != last_updated_state_ ||
+                             item->IsPaused() != last_updated_paused_;
+  if (!update_interval_.is_zero() && !state_changed) {
+    base::TimeDelta elapsed = base::TimeTicks::Now() - last_updated_time_;
+    if (elapsed < update_interval_) {
+      if (!update_timer_.IsRunning()) {
+        update_timer_.Start(FROM_HERE, update_interval_ - elapsed,
+                            base::BindOnce(&DownloadItem::EmitUpdated,
+                                           base::Unretained(this)));
+      }
+      return;
+    }
   }
+  EmitUpdated();
 }
 
 void DownloadItem::OnDownloadDestroyed(download::DownloadItem* /*item*/) {
+  update_timer_.Stop();
   download_item_ = nullptr;
   Unpin();
 }
 
+void DownloadItem::EmitUpdated() {
+  update_timer_.Stop();
+  last_updated_time_ = base::TimeTicks::Now();
+  last_updated_state_ = download_item_->GetState();
+  last_updated_paused_ = download_item_->IsPaused();
+  Emit("updated", last_updated_state_);
+}
+
+void DownloadItem::SetUpdateInterval(gin::Arguments* args) {
+  double interval = 0;
+  if (!args->GetNext(&interval) || interval < 0) {
+    args->ThrowTypeError("Interval must be a non-negative number");
+    return;
+  }
+  update_interval_ = base::Milliseconds(interval);
+}
+
+double DownloadItem::GetUpdateInterval() const {
+  return update_interval_.InMillisecondsF();
+}
+
 void DownloadItem::Pause() {
   if (!CheckAlive())
     return;
@@ -155,6 +196,27 @@ int64_t DownloadItem::GetReceivedBytes() const {
   return download_item_->GetReceivedBytes();
 }
 
+int64_t DownloadItem::GetCurrentBytesPerSecond() const {
+  if (!CheckAlive())
+    return 0;
+  return download_item_->CurrentSpeed();
+}
+
+int DownloadItem::GetPercentComplete() const {
+  if (!CheckAlive())
+    return 0;
+  return download_item_->PercentComplete();
+}
+
+double DownloadItem::GetTimeRemaining() const {
+  if (!CheckAlive())
+    return -1;
+  base::TimeDelta remaining;
+  if (!download_item_->TimeRemaining(&remaining))
+    return -1;
+  return remaining.InSecondsF();
+}
+
 int64_t DownloadItem::GetTotalBytes() const {
   if (!CheckAlive())
     return 0;
@@ -201,6 +263,22 @@ v8::Local<v8::Value> DownloadItem::GetURLChain() const {
   return gin::ConvertToV8(isolate_, download_item_->GetUrlChain());
 }
 
+v8::Local<v8::Value> DownloadItem::GetReceivedSlices() const {
+  if (!CheckAlive())
+    return v8::Local<v8::Value>();
+  const auto& slices = download_item_->GetReceivedSlices();
+  v8::Local<v8::Array> result = v8::Array::New(isolate_, slices.size());
+  v8::Local<v8::Context> context = isolate_->GetCurrentContext();
+  for (size_t i = 0; i < slices.size(); ++i) {
+    gin_helper::Dictionary slice = gin::Dictionary::CreateEmpty(isolate_);
+    slice.Set("offset", slices[i].offset);
+    slice.Set("receivedBytes", slices[i].received_bytes);
+    slice.Set("finished", slices[i].finished);
+    result->Set(context, i, slice.GetHandle()).Check();
+  }
+  return result;
+}
+
 download::DownloadItem::DownloadState DownloadItem::GetState() const {
   if (!CheckAlive())
     return download::DownloadItem::IN_PROGRESS;
@@ -260,12 +338,19 @@ gin::ObjectTemplateBuilder DownloadItem::GetObjectTemplateBuilder(
       .SetMethod("cancel", &DownloadItem::Cancel)
       .SetMethod("getReceivedBytes", &DownloadItem::GetReceivedBytes)
       .SetMethod("getTotalBytes", &DownloadItem::GetTotalBytes)
+      .SetMethod("getCurrentBytesPerSecond",
+                 &DownloadItem::GetCurrentBytesPerSecond)
+      .SetMethod("getPercentComplete", &DownloadItem::GetPercentComplete)
+      .SetMethod("getTimeRemaining", &DownloadItem::GetTimeRemaining)
+      .SetMethod("setUpdateInterval", &DownloadItem::SetUpdateInterval)
+      .SetMethod("getUpdateInterval", &DownloadItem::GetUpdateInterval)
       .SetMethod("getMimeType", &DownloadItem::GetMimeType)
       .SetMethod("hasUserGesture", &DownloadItem::HasUserGesture)
       .SetMethod("getFilename", &DownloadItem::GetFilename)
       .SetMethod("getContentDisposition", &DownloadItem::GetContentDisposition)
       .SetMethod("getURL", &DownloadItem::GetURL)
       .SetMethod("getURLChain", &DownloadItem::GetURLChain)
+      .SetMethod("getReceivedSlices", &DownloadItem::GetReceivedSlices)
       .SetMethod("getState", &DownloadItem::GetState)
       .SetMethod("isDone", &DownloadItem::IsDone)
       .SetMethod("setSavePath", &DownloadItem::SetSavePath)
@@ -10,6 +10,8 @@
 #include "base/files/file_path.h"
 #include "base/memory/raw_ptr.h"
 #include "base/memory/weak_ptr.h"
+#include "base/time/time.h"
+#include "base/timer/timer.h"
 #include "components/download/public/common/download_item.h"
 #include "gin/handle.h"
 #include "gin/wrappable.h"
@@ -19,6 +21,10 @@
 
 class GURL;
 
+namespace gin {
+class Arguments;
+}  // namespace gin
+
 namespace electron::api {
 
 class DownloadItem : public gin::Wrappable<DownloadItem>,
@@ -56,6 +62,8 @@ class DownloadItem : public gin::Wrappable<DownloadItem>,
   void OnDownloadUpdated(download::DownloadItem* item) override;
   void OnDownloadDestroyed(download::DownloadItem* item) override;
 
+  void EmitUpdated();
+
   // JS API
   void Pause();
   bool IsPaused() const;
@@ -64,12 +72,18 @@ class DownloadItem : public gin::Wrappable<DownloadItem>,
   void Cancel();
   int64_t GetReceivedBytes() const;
   int64_t GetTotalBytes() const;
+  int64_t GetCurrentBytesPerSecond() const;
+  int GetPercentComplete() const;
+  double GetTimeRemaining() const;
+  void SetUpdateInterval(gin::Arguments* args);
+  double GetUpdateInterval() const;
   std::string GetMimeType() const;
   bool HasUserGesture() const;
   std::string GetFilename() const;
   std::string GetContentDisposition() const;
   const GURL& GetURL() const;
   v8::Local<v8::Value> GetURLChain() const;
+  v8::Local<v8::Value> GetReceivedSlices() const;
   download::DownloadItem::DownloadState GetState() const;
   bool IsDone() const;
   void SetSaveDialogOptions(const file_dialog::DialogSettings& options);
@@ -83,6 +97,14 @@ class DownloadItem : public gin::Wrappable<DownloadItem>,
 
   raw_ptr<v8::Isolate> isolate_;
 
+  // Minimum time between two "updated" events reporting progress only.
+  base::TimeDelta update_interval_;
+  base::TimeTicks last_updated_time_;
+  download::DownloadItem::DownloadState last_updated_state_ =
+      download::DownloadItem::IN_PROGRESS;
+  bool last_updated_paused_ = false;
+  base::OneShotTimer update_timer_;
+
   base::WeakPtrFactory<DownloadItem> weak_factory_{this};
 };
 
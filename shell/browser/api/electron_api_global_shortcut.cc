@@ -4,6 +4,7 @@
 
 #include "shell/browser/api/electron_api_global_shortcut.h"
 
+#include <set>
 #include <vector>
 
 #include "base/containers/contains.h"
@@ -112,6 +113,50 @@ bool GlobalShortcut::Register(const ui::Accelerator& accelerator,
   return true;
 }
 
+bool GlobalShortcut::Update(
+    const std::vector<ui::Accelerator>& unregister,
+    const std::vector<ui::Accelerator>& accelerators,
+    const std::vector<base::RepeatingClosure>& callbacks) {
+  if (!electron::Browser::Get()->is_ready()) {
+    gin_helper::ErrorThrower(JavascriptEnvironment::GetIsolate())
+        .ThrowError("globalShortcut cannot be used before the app is ready");
+    return false;
+  }
+  DCHECK_EQ(accelerators.size(), callbacks.size());
+
+  // Shortcuts that stay registered only have their callback swapped, and new
+  // shortcuts are registered before old ones are removed, so the platform
+  // listener never stops and restarts listening in the middle of the update.
+  std::vector<ui::Accelerator> registered;
+  AcceleratorCallbackMap replaced;
+  for (size_t i = 0; i < accelerators.size(); ++i) {
+    const ui::Accelerator& accelerator = accelerators[i];
+    auto it = accelerator_callback_map_.find(accelerator);
+    if (it != accelerator_callback_map_.end()) {
+      if (!base::Contains(registered, accelerator))
+        replaced.emplace(accelerator, it->second);
+      it->second = callbacks[i];
+      continue;
+    }
+    if (!Register(accelerator, callbacks[i])) {
+      // Leave the shortcuts as they were if any registration failed.
+      UnregisterSome(registered);
+      for (auto& [replaced_accelerator, callback] : replaced)
+        accelerator_callback_map_[replaced_accelerator] = std::move(callback);
+      return false;
+    }
+    registered.push_back(accelerator);
+  }
+
+  const std::set<ui::Accelerator> kept(accelerators.begin(),
+                                       accelerators.end());
+  for (const auto& accelerator : unregister) {
+    if (!base::Contains(kept, accelerator))
+      Unregister(accelerator);
+  }
+  return true;
+}
+
 void GlobalShortcut::Unregister(const ui::Accelerator& accelerator) {
   if (!electron::Browser::Get()->is_ready()) {
     gin_helper::ErrorThrower(JavascriptEnvironment::GetIsolate())
@@ -164,6 +209,7 @@ gin::ObjectTemplateBuilder GlobalShortcut::GetObjectTemplateBuilder(
   return gin::Wrappable<GlobalShortcut>::GetObjectTemplateBuilder(isolate)
       .SetMethod("registerAll", &GlobalShortcut::RegisterAll)
       .SetMethod("register", &GlobalShortcut::Register)
+      .SetMethod("_update", &GlobalShortcut::Update)
       .SetMethod("isRegistered", &GlobalShortcut::IsRegistered)
       .SetMethod("unregister", &GlobalShortcut::Unregister)
       .SetMethod("unregisterAll", &GlobalShortcut::UnregisterAll);
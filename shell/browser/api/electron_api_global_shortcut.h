@@ -43,6 +43,9 @@ class GlobalShortcut : public extensions::GlobalShortcutListener::Observer,
                    const base::RepeatingClosure& callback);
   bool Register(const ui::Accelerator& accelerator,
                 const base::RepeatingClosure& callback);
+  bool Update(const std::vector<ui::Accelerator>& unregister,
+              const std::vector<ui::Accelerator>& accelerators,
+              const std::vector<base::RepeatingClosure>& callbacks);
   bool IsRegistered(const ui::Accelerator& accelerator);
   void Unregister(const ui::Accelerator& accelerator);
   void UnregisterSome(const std::vector<ui::Accelerator>& accelerators);
@@ -0,0 +1,196 @@
+// Copyright (c) 2024 Microsoft, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#include "shell/browser/api/electron_api_ipc_main.h"
+
+#include <algorithm>
+#include <array>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "base/functional/bind.h"
+#include "base/no_destructor.h"
+#include "base/trace_event/trace_event.h"
+#include "content/public/browser/browser_thread.h"
+#include "gin/data_object_builder.h"
+#include "gin/dictionary.h"
+#include "shell/common/gin_converters/blink_converter.h"
+#include "shell/common/gin_converters/callback_converter.h"
+#include "shell/common/node_includes.h"
+#include "third_party/blink/public/common/messaging/transferable_message.h"
+#include "third_party/blink/public/mojom/messaging/transferable_message.mojom.h"
+#include "v8/include/v8.h"
+
+namespace {
+
+using SyncReplyMap = std::map<std::string, blink::CloneableMessage, std::less<>>;
+
+SyncReplyMap& GetSyncReplies() {
+  DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
+  static base::NoDestructor<SyncReplyMap> sync_replies;
+  return *sync_replies;
+}
+
+void SetSyncReply(const std::string& channel, blink::CloneableMessage reply) {
+  GetSyncReplies().insert_or_assign(channel, std::move(reply));
+}
+
+void RemoveSyncReply(const std::string& channel) {
+  GetSyncReplies().erase(channel);
+}
+
+using electron::api::ipc_main::MessageKind;
+
+// Messages on channels beyond this many are counted under kOtherChannel, so
+// that apps generating channel names don't grow the table without bound.
+constexpr size_t kMaxRecordedChannels = 512;
+constexpr char kOtherChannel[] = "(other)";
+
+// Handler times are bucketed by powers of two milliseconds: < 1ms, < 2ms,
+// < 4ms, ... < 1024ms and everything slower in the last bucket.
+constexpr size_t kHandlerTimeBuckets = 12;
+
+struct ChannelMetrics {
+  uint64_t messages = 0;
+  uint64_t invokes = 0;
+  uint64_t sync_messages = 0;
+  uint64_t bytes = 0;
+  uint64_t max_bytes = 0;
+  uint64_t replies = 0;
+  uint64_t reply_bytes = 0;
+  base::TimeDelta total_handler_time;
+  base::TimeDelta max_handler_time;
+  std::array<uint64_t, kHandlerTimeBuckets> handler_time_histogram = {};
+};
+
+using ChannelMetricsMap = std::map<std::string, ChannelMetrics, std::less<>>;
+
+ChannelMetricsMap& GetChannelMetrics() {
+  DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
+  static base::NoDestructor<ChannelMetricsMap> channel_metrics;
+  return *channel_metrics;
+}
+
+ChannelMetrics& GetMetricsForChannel(std::string_view channel) {
+  ChannelMetricsMap& channel_metrics = GetChannelMetrics();
+  auto iter = channel_metrics.find(channel);
+  if (iter != channel_metrics.end())
+    return iter->second;
+  if (channel_metrics.size() >= kMaxRecordedChannels)
+    channel = kOtherChannel;
+  return channel_metrics[std::string(channel)];
+}
+
+size_t GetHandlerTimeBucket(base::TimeDelta handler_time) {
+  size_t bucket = 0;
+  for (int64_t bound = 1; bucket < kHandlerTimeBuckets - 1; bound *= 2) {
+    if (handler_time.InMilliseconds() < bound)
+      break;
+    ++bucket;
+  }
+  return bucket;
+}
+
+v8::Local<v8::Value> GetMetrics(v8::Isolate* isolate) {
+  std::vector<v8::Local<v8::Value>> result;
+  for (const auto& [channel, metrics] : GetChannelMetrics()) {
+    std::vector<double> histogram(metrics.handler_time_histogram.begin(),
+                                  metrics.handler_time_histogram.end());
+    result.push_back(
+        gin::DataObjectBuilder(isolate)
+            .Set("channel", channel)
+            .Set("messages", static_cast<double>(metrics.messages))
+            .Set("invokes", static_cast<double>(metrics.invokes))
+            .Set("syncMessages", static_cast<double>(metrics.sync_messages))
+            .Set("bytes", static_cast<double>(metrics.bytes))
+            .Set("maxBytes", static_cast<double>(metrics.max_bytes))
+            .Set("replies", static_cast<double>(metrics.replies))
+            .Set("replyBytes", static_cast<double>(metrics.reply_bytes))
+            .Set("totalHandlerTime",
+                 metrics.total_handler_time.InMillisecondsF())
+            .Set("maxHandlerTime", metrics.max_handler_time.InMillisecondsF())
+            .Set("handlerTimeHistogram", histogram)
+            .Build());
+  }
+  return gin::ConvertToV8(isolate, result);
+}
+
+void ResetMetrics() {
+  GetChannelMetrics().clear();
+}
+
+void Initialize(v8::Local<v8::Object> exports,
+                v8::Local<v8::Value> unused,
+                v8::Local<v8::Context> context,
+                void* priv) {
+  v8::Isolate* isolate = context->GetIsolate();
+
+  gin::Dictionary dict(isolate, exports);
+  dict.Set("setSyncReply", base::BindRepeating(&SetSyncReply));
+  dict.Set("removeSyncReply", base::BindRepeating(&RemoveSyncReply));
+  dict.Set("getMetrics", base::BindRepeating(&GetMetrics));
+  dict.Set("resetMetrics", base::BindRepeating(&ResetMetrics));
+}
+
+}  // namespace
+
+namespace electron::api::ipc_main {
+
+std::optional<blink::CloneableMessage> GetSyncReply(std::string_view channel) {
+  const SyncReplyMap& sync_replies = GetSyncReplies();
+  auto iter = sync_replies.find(channel);
+  if (iter == sync_replies.end())
+    return std::nullopt;
+  blink::CloneableMessage reply = iter->second.ShallowClone();
+  reply.EnsureDataIsOwned();
+  return reply;
+}
+
+void RecordMessage(MessageKind kind,
+                   std::string_view channel,
+                   const blink::TransferableMessage& arguments) {
+  const size_t size = GetMessageSize(arguments);
+  ChannelMetrics& metrics = GetMetricsForChannel(channel);
+  switch (kind) {
+    case MessageKind::kMessage:
+      ++metrics.messages;
+      break;
+    case MessageKind::kInvoke:
+      ++metrics.invokes;
+      break;
+    case MessageKind::kSync:
+      ++metrics.sync_messages;
+      break;
+  }
+  metrics.bytes += size;
+  metrics.max_bytes = std::max<uint64_t>(metrics.max_bytes, size);
+}
+
+void RecordReply(std::string_view channel,
+                 const blink::CloneableMessage& reply,
+                 base::TimeDelta handler_time) {
+  const size_t size = reply.encoded_message.size();
+  TRACE_EVENT_INSTANT2("electron", "ipc_main::RecordReply",
+                       TRACE_EVENT_SCOPE_THREAD, "channel",
+                       std::string(channel), "handler_time_us",
+                       handler_time.InMicroseconds());
+  ChannelMetrics& metrics = GetMetricsForChannel(channel);
+  ++metrics.replies;
+  metrics.reply_bytes += size;
+  metrics.total_handler_time += handler_time;
+  metrics.max_handler_time = std::max(metrics.max_handler_time, handler_time);
+  ++metrics.handler_time_histogram[GetHandlerTimeBucket(handler_time)];
+}
+
+size_t GetMessageSize(const blink::TransferableMessage& message) {
+  size_t size = message.encoded_message.size();
+  for (const auto& contents : message.array_buffer_contents_array)
+    size += contents->contents.size();
+  return size;
+}
+
+}  // namespace electron::api::ipc_main
+
+NODE_LINKED_BINDING_CONTEXT_AWARE(electron_browser_ipc_main, Initialize)
@@ -0,0 +1,41 @@
+// Copyright (c) 2024 Microsoft, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#ifndef ELECTRON_SHELL_BROWSER_API_ELECTRON_API_IPC_MAIN_H_
+#define ELECTRON_SHELL_BROWSER_API_ELECTRON_API_IPC_MAIN_H_
+
+#include <cstddef>
+#include <optional>
+#include <string_view>
+
+#include "base/time/time.h"
+#include "third_party/blink/public/common/messaging/cloneable_message.h"
+
+namespace blink {
+struct TransferableMessage;
+}
+
+namespace electron::api::ipc_main {
+
+// Returns a copy of the reply set with ipcMain.setSyncReply() for |channel|,
+// if any. Used to answer ipcRenderer.sendSync() without running JavaScript.
+std::optional<blink::CloneableMessage> GetSyncReply(std::string_view channel);
+
+enum class MessageKind { kMessage, kInvoke, kSync };
+
+// Per-channel counters reported by ipcMain.getMetrics(). Only messages from
+// ipcRenderer are recorded, Electron's internal channels are not.
+void RecordMessage(MessageKind kind,
+                   std::string_view channel,
+                   const blink::TransferableMessage& arguments);
+void RecordReply(std::string_view channel,
+                 const blink::CloneableMessage& reply,
+                 base::TimeDelta handler_time);
+
+// Size of the serialized message including any out of band ArrayBuffers.
+size_t GetMessageSize(const blink::TransferableMessage& message);
+
+}  // namespace electron::api::ipc_main
+
+#endif  // ELECTRON_SHELL_BROWSER_API_ELECTRON_API_IPC_MAIN_H_
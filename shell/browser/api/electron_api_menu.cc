@@ -194,6 +194,14 @@ void Menu::SetIcon(int index, const gfx::Image& image) {
   model_->SetIcon(index, ui::ImageModel::FromImage(image));
 }
 
+void Menu::RemoveItemAt(int index) {
+  model_->RemoveItemAt(index);
+}
+
+void Menu::SetLabel(int index, const std::u16string& label) {
+  model_->SetLabel(index, label);
+}
+
 void Menu::SetSublabel(int index, const std::u16string& sublabel) {
   model_->SetSecondaryLabel(index, sublabel);
 }
@@ -275,7 +283,9 @@ void Menu::FillObjectTemplate(v8::Isolate* isolate,
       .SetMethod("insertRadioItem", &Menu::InsertRadioItemAt)
       .SetMethod("insertSeparator", &Menu::InsertSeparatorAt)
       .SetMethod("insertSubMenu", &Menu::InsertSubMenuAt)
+      .SetMethod("removeItem", &Menu::RemoveItemAt)
       .SetMethod("setIcon", &Menu::SetIcon)
+      .SetMethod("setLabel", &Menu::SetLabel)
       .SetMethod("setSublabel", &Menu::SetSublabel)
       .SetMethod("setToolTip", &Menu::SetToolTip)
       .SetMethod("setRole", &Menu::SetRole)
@@ -15,6 +15,7 @@
 #include "shell/browser/event_emitter_mixin.h"
 #include "shell/browser/ui/electron_menu_model.h"
 #include "shell/common/gin_helper/constructible.h"
+#include "shell/common/gin_helper/live_object.h"
 #include "shell/common/gin_helper/pinnable.h"
 
 namespace electron::api {
@@ -107,6 +108,8 @@ class Menu : public gin::Wrappable<Menu>,
                        const std::u16string& label,
                        Menu* menu);
   void SetIcon(int index, const gfx::Image& image);
+  void RemoveItemAt(int index);
+  void SetLabel(int index, const std::u16string& label);
   void SetSublabel(int index, const std::u16string& sublabel);
   void SetToolTip(int index, const std::u16string& toolTip);
   void SetRole(int index, const std::u16string& role);
@@ -121,6 +124,8 @@ class Menu : public gin::Wrappable<Menu>,
   bool IsEnabledAt(int index) const;
   bool IsVisibleAt(int index) const;
   bool WorksWhenHiddenAt(int index) const;
+
+  gin_helper::LiveObject live_object_{"Menu"};
 };
 
 }  // namespace electron::api
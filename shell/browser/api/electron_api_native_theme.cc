@@ -32,10 +32,24 @@ NativeTheme::~NativeTheme() {
 }
 
 void NativeTheme::OnNativeThemeUpdatedOnUI() {
+  update_pending_ = false;
+  const State& state = GetState();
+  if (state == emitted_state_)
+    return;
+  emitted_state_ = state;
   Emit("updated");
 }
 
 void NativeTheme::OnNativeThemeUpdated(ui::NativeTheme* theme) {
+  // Compare against the values JS has already seen, if any.
+  if (!emitted_state_)
+    emitted_state_ = state_;
+  state_.reset();
+  // The OS often reports a single change several times in a row, only emit
+  // once for all of them.
+  if (update_pending_)
+    return;
+  update_pending_ = true;
   content::GetUIThreadTaskRunner({})->PostTask(
       FROM_HERE, base::BindOnce(&NativeTheme::OnNativeThemeUpdatedOnUI,
                                 base::Unretained(this)));
@@ -44,6 +58,7 @@ void NativeTheme::OnNativeThemeUpdated(ui::NativeTheme* theme) {
 void NativeTheme::SetThemeSource(ui::NativeTheme::ThemeSource override) {
   ui_theme_->set_theme_source(override);
   web_theme_->set_theme_source(override);
+  state_.reset();
 #if BUILDFLAG(IS_MAC)
   // Update the macOS appearance setting for this new override value
   UpdateMacOSAppearanceForOverrideValue(override);
@@ -56,16 +71,33 @@ ui::NativeTheme::ThemeSource NativeTheme::GetThemeSource() const {
   return ui_theme_->theme_source();
 }
 
+const NativeTheme::State& NativeTheme::GetState() {
+  if (!state_) {
+    state_ = State{
+        .should_use_dark_colors = ui_theme_->ShouldUseDarkColors(),
+        .should_use_high_contrast_colors =
+            ui_theme_->UserHasContrastPreference(),
+        .should_use_inverted_color_scheme = QueryInvertedColorScheme(),
+        .in_forced_colors_mode = ui_theme_->InForcedColorsMode(),
+    };
+  }
+  return *state_;
+}
+
 bool NativeTheme::ShouldUseDarkColors() {
-  return ui_theme_->ShouldUseDarkColors();
+  return GetState().should_use_dark_colors;
 }
 
 bool NativeTheme::ShouldUseHighContrastColors() {
-  return ui_theme_->UserHasContrastPreference();
+  return GetState().should_use_high_contrast_colors;
+}
+
+bool NativeTheme::ShouldUseInvertedColorScheme() {
+  return GetState().should_use_inverted_color_scheme;
 }
 
 bool NativeTheme::InForcedColorsMode() {
-  return ui_theme_->InForcedColorsMode();
+  return GetState().in_forced_colors_mode;
 }
 
 #if BUILDFLAG(IS_MAC)
@@ -74,7 +106,7 @@ const CFStringRef UniversalAccessDomain = CFSTR("com.apple.universalaccess");
 #endif
 
 // TODO(MarshallOfSound): Implement for Linux
-bool NativeTheme::ShouldUseInvertedColorScheme() {
+bool NativeTheme::QueryInvertedColorScheme() {
 #if BUILDFLAG(IS_MAC)
   CFPreferencesAppSynchronize(UniversalAccessDomain);
   Boolean keyExistsAndHasValidFormat = false;
@@ -5,6 +5,8 @@
 #ifndef ELECTRON_SHELL_BROWSER_API_ELECTRON_API_NATIVE_THEME_H_
 #define ELECTRON_SHELL_BROWSER_API_ELECTRON_API_NATIVE_THEME_H_
 
+#include <optional>
+
 #include "base/memory/raw_ptr.h"
 #include "gin/handle.h"
 #include "gin/wrappable.h"
@@ -52,8 +54,28 @@ class NativeTheme : public gin::Wrappable<NativeTheme>,
   void OnNativeThemeUpdatedOnUI();
 
  private:
+  // The values exposed to JS. They are read from the OS once per theme
+  // update instead of on every access.
+  struct State {
+    bool should_use_dark_colors = false;
+    bool should_use_high_contrast_colors = false;
+    bool should_use_inverted_color_scheme = false;
+    bool in_forced_colors_mode = false;
+
+    bool operator==(const State&) const = default;
+  };
+
+  const State& GetState();
+  bool QueryInvertedColorScheme();
+
   raw_ptr<ui::NativeTheme> ui_theme_;
   raw_ptr<ui::NativeTheme> web_theme_;
+
+  std::optional<State> state_;
+  // The state "updated" was last emitted for, so that repeated notifications
+  // for one change emit only once.
+  std::optional<State> emitted_state_;
+  bool update_pending_ = false;
 };
 
 }  // namespace electron::api
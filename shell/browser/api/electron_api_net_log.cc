@@ -18,6 +18,7 @@
 #include "gin/object_template_builder.h"
 #include "net/log/net_log_capture_mode.h"
 #include "shell/browser/electron_browser_context.h"
+#include "shell/browser/net/net_log_recorder.h"
 #include "shell/browser/net/system_network_context_manager.h"
 #include "shell/common/gin_converters/file_path_converter.h"
 #include "shell/common/gin_helper/dictionary.h"
@@ -67,6 +68,14 @@ base::File OpenFileForWriting(base::FilePath path) {
                     base::File::FLAG_CREATE_ALWAYS | base::File::FLAG_WRITE);
 }
 
+base::Value::Dict GetNetLogConstants() {
+  auto command_line_string =
+      base::CommandLine::ForCurrentProcess()->GetCommandLineString();
+  auto channel_string = std::string("Electron " ELECTRON_VERSION);
+  return net_log::GetPlatformConstantsForNetLog(command_line_string,
+                                                channel_string);
+}
+
 void ResolvePromiseWithNetError(gin_helper::Promise<void> promise,
                                 int32_t error) {
   if (error == net::OK) {
@@ -128,11 +137,7 @@ v8::Local<v8::Promise> NetLog::StartLogging(base::FilePath log_path,
       std::make_optional<gin_helper::Promise<void>>(args->isolate());
   v8::Local<v8::Promise> handle = pending_start_promise_->GetHandle();
 
-  auto command_line_string =
-      base::CommandLine::ForCurrentProcess()->GetCommandLineString();
-  auto channel_string = std::string("Electron " ELECTRON_VERSION);
-  base::Value::Dict custom_constants = net_log::GetPlatformConstantsForNetLog(
-      command_line_string, channel_string);
+  base::Value::Dict custom_constants = GetNetLogConstants();
 
   auto* network_context =
       browser_context_->GetDefaultStoragePartition()->GetNetworkContext();
@@ -215,12 +220,91 @@ v8::Local<v8::Promise> NetLog::StopLogging(gin::Arguments* args) {
   return handle;
 }
 
+void NetLog::StartRecording(gin::Arguments* args) {
+  net::NetLogCaptureMode capture_mode = net::NetLogCaptureMode::kDefault;
+  uint64_t max_size = 10 * 1024 * 1024;
+
+  gin_helper::Dictionary dict;
+  if (args->GetNext(&dict)) {
+    v8::Local<v8::Value> capture_mode_v8;
+    if (dict.Get("captureMode", &capture_mode_v8)) {
+      if (!gin::ConvertFromV8(args->isolate(), capture_mode_v8,
+                              &capture_mode)) {
+        args->ThrowTypeError("Invalid value for captureMode");
+        return;
+      }
+    }
+    v8::Local<v8::Value> max_size_v8;
+    if (dict.Get("maxSize", &max_size_v8)) {
+      if (!gin::ConvertFromV8(args->isolate(), max_size_v8, &max_size) ||
+          max_size == 0) {
+        args->ThrowTypeError("Invalid value for maxSize");
+        return;
+      }
+    }
+  }
+
+  if (recorder_) {
+    args->ThrowTypeError("There is already a net log recording running");
+    return;
+  }
+
+  recorder_ = std::make_unique<NetLogRecorder>(
+      browser_context_->GetDefaultStoragePartition(), capture_mode, max_size,
+      GetNetLogConstants());
+}
+
+v8::Local<v8::Promise> NetLog::DumpRecording(base::FilePath path,
+                                             gin::Arguments* args) {
+  if (path.empty()) {
+    args->ThrowTypeError("The first parameter must be a valid string");
+    return v8::Local<v8::Promise>();
+  }
+
+  gin_helper::Promise<void> promise(args->isolate());
+  v8::Local<v8::Promise> handle = promise.GetHandle();
+
+  if (!recorder_) {
+    promise.RejectWithErrorMessage("No net log recording in progress");
+    return handle;
+  }
+  if (recorder_->is_dumping()) {
+    promise.RejectWithErrorMessage(
+        "The net log recording is already being dumped");
+    return handle;
+  }
+
+  auto callback = base::BindOnce(
+      [](gin_helper::Promise<void> promise, bool success) {
+        if (success)
+          promise.Resolve();
+        else
+          promise.RejectWithErrorMessage("Failed to write the net log");
+      },
+      std::move(promise));
+  recorder_->Dump(path, std::move(callback));
+
+  return handle;
+}
+
+void NetLog::StopRecording() {
+  recorder_.reset();
+}
+
+bool NetLog::IsCurrentlyRecording() const {
+  return !!recorder_;
+}
+
 gin::ObjectTemplateBuilder NetLog::GetObjectTemplateBuilder(
     v8::Isolate* isolate) {
   return gin::Wrappable<NetLog>::GetObjectTemplateBuilder(isolate)
       .SetProperty("currentlyLogging", &NetLog::IsCurrentlyLogging)
       .SetMethod("startLogging", &NetLog::StartLogging)
-      .SetMethod("stopLogging", &NetLog::StopLogging);
+      .SetMethod("stopLogging", &NetLog::StopLogging)
+      .SetProperty("currentlyRecording", &NetLog::IsCurrentlyRecording)
+      .SetMethod("startRecording", &NetLog::StartRecording)
+      .SetMethod("dumpRecording", &NetLog::DumpRecording)
+      .SetMethod("stopRecording", &NetLog::StopRecording);
 }
 
 const char* NetLog::GetTypeName() {
@@ -5,6 +5,7 @@
 #ifndef ELECTRON_SHELL_BROWSER_API_ELECTRON_API_NET_LOG_H_
 #define ELECTRON_SHELL_BROWSER_API_ELECTRON_API_NET_LOG_H_
 
+#include <memory>
 #include <optional>
 
 #include "base/files/file_path.h"
@@ -26,6 +27,7 @@ class Arguments;
 namespace electron {
 
 class ElectronBrowserContext;
+class NetLogRecorder;
 
 namespace api {
 
@@ -40,6 +42,12 @@ class NetLog : public gin::Wrappable<NetLog> {
   v8::Local<v8::Promise> StopLogging(gin::Arguments* args);
   bool IsCurrentlyLogging() const;
 
+  void StartRecording(gin::Arguments* args);
+  v8::Local<v8::Promise> DumpRecording(base::FilePath path,
+                                       gin::Arguments* args);
+  void StopRecording();
+  bool IsCurrentlyRecording() const;
+
   // gin::Wrappable
   static gin::WrapperInfo kWrapperInfo;
   gin::ObjectTemplateBuilder GetObjectTemplateBuilder(
@@ -72,6 +80,8 @@ class NetLog : public gin::Wrappable<NetLog> {
 
   scoped_refptr<base::TaskRunner> file_task_runner_;
 
+  std::unique_ptr<NetLogRecorder> recorder_;
+
   base::WeakPtrFactory<NetLog> weak_ptr_factory_{this};
 };
 
@@ -167,6 +167,13 @@ void Notification::NotificationClosed() {
 
 void Notification::Close() {
   if (notification_) {
+    if (presenter_ &&
+        presenter_->CancelPendingNotification(notification_.get())) {
+      notification_->set_delegate(nullptr);
+      notification_->Destroy();
+      notification_.reset();
+      return;
+    }
     if (notification_->is_dismissed()) {
       notification_->Remove();
     } else {
@@ -199,7 +206,7 @@ void Notification::Show() {
       options.close_button_text = close_button_text_;
       options.urgency = urgency_;
       options.toast_xml = toast_xml_;
-      notification_->Show(options);
+      presenter_->ShowNotification(notification_.get(), options);
     }
   }
 }
@@ -209,6 +216,13 @@ bool Notification::IsSupported() {
                ->GetNotificationPresenter();
 }
 
+void Notification::SetMaxRate(int notifications_per_second) {
+  if (auto* presenter =
+          static_cast<ElectronBrowserClient*>(ElectronBrowserClient::Get())
+              ->GetNotificationPresenter())
+    presenter->set_max_rate(notifications_per_second);
+}
+
 void Notification::FillObjectTemplate(v8::Isolate* isolate,
                                       v8::Local<v8::ObjectTemplate> templ) {
   gin::ObjectTemplateBuilder(isolate, GetClassName(), templ)
@@ -253,6 +267,7 @@ void Initialize(v8::Local<v8::Object> exports,
   gin_helper::Dictionary dict(isolate, exports);
   dict.Set("Notification", Notification::GetConstructor(context));
   dict.SetMethod("isSupported", &Notification::IsSupported);
+  dict.SetMethod("setMaxRate", &Notification::SetMaxRate);
 }
 
 }  // namespace
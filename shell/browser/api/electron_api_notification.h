@@ -35,6 +35,7 @@ class Notification : public gin::Wrappable<Notification>,
                      public NotificationDelegate {
  public:
   static bool IsSupported();
+  static void SetMaxRate(int notifications_per_second);
 
   // gin_helper::Constructible
   static gin::Handle<Notification> New(gin_helper::ErrorThrower thrower,
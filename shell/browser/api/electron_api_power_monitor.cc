@@ -4,6 +4,10 @@
 
 #include "shell/browser/api/electron_api_power_monitor.h"
 
+#include <optional>
+#include <string>
+#include <utility>
+
 #include "base/power_monitor/power_monitor.h"
 #include "base/power_monitor/power_monitor_device_source.h"
 #include "base/power_monitor/power_observer.h"
@@ -11,6 +15,7 @@
 #include "gin/handle.h"
 #include "shell/browser/browser.h"
 #include "shell/browser/javascript_environment.h"
+#include "shell/browser/power_saving_policy.h"
 #include "shell/common/gin_converters/callback_converter.h"
 #include "shell/common/gin_helper/dictionary.h"
 #include "shell/common/gin_helper/object_template_builder.h"
@@ -182,6 +187,64 @@ base::PowerThermalObserver::DeviceThermalState GetCurrentThermalState() {
   return base::PowerMonitor::GetCurrentThermalState();
 }
 
+void SetPowerSavingPolicy(gin::Arguments* args) {
+  v8::Local<v8::Value> value;
+  electron::PowerSavingPolicy::ChangeCallback on_change;
+  if (!args->GetNext(&value) || !args->GetNext(&on_change)) {
+    args->ThrowTypeError("Expected a policy and a callback");
+    return;
+  }
+
+  std::optional<electron::PowerSavingPolicy::Options> options;
+  if (!value->IsNull()) {
+    gin_helper::Dictionary dict;
+    if (!gin::ConvertFromV8(args->isolate(), value, &dict)) {
+      args->ThrowTypeError("policy must be an object or null");
+      return;
+    }
+    options.emplace();
+    dict.Get("onBattery", &options->on_battery);
+
+    std::string thermal_state;
+    if (dict.Get("thermalState", &thermal_state)) {
+      using DeviceThermalState = base::PowerThermalObserver::DeviceThermalState;
+      if (thermal_state == "fair") {
+        options->thermal_state = DeviceThermalState::kFair;
+      } else if (thermal_state == "serious") {
+        options->thermal_state = DeviceThermalState::kSerious;
+      } else if (thermal_state == "critical") {
+        options->thermal_state = DeviceThermalState::kCritical;
+      } else {
+        args->ThrowTypeError(
+            "thermalState must be 'fair', 'serious' or 'critical'");
+        return;
+      }
+    }
+
+    if (dict.Has("speedLimit") &&
+        (!dict.Get("speedLimit", &options->speed_limit) ||
+         options->speed_limit < 0 ||
+         options->speed_limit > base::PowerThermalObserver::kSpeedLimitMax)) {
+      args->ThrowTypeError("speedLimit must be between 0 and 100");
+      return;
+    }
+    if (dict.Has("frameRate") &&
+        (!dict.Get("frameRate", &options->max_frame_rate) ||
+         options->max_frame_rate < 1)) {
+      args->ThrowTypeError("frameRate must be a positive number");
+      return;
+    }
+    dict.Get("backgroundThrottling", &options->background_throttling);
+  }
+
+  electron::PowerSavingPolicy::Get()->SetOptions(std::move(options),
+                                                 std::move(on_change));
+}
+
+bool IsPowerSaving() {
+  return electron::PowerSavingPolicy::Get()->is_active();
+}
+
 void Initialize(v8::Local<v8::Object> exports,
                 v8::Local<v8::Value> unused,
                 v8::Local<v8::Context> context,
@@ -196,6 +259,9 @@ void Initialize(v8::Local<v8::Object> exports,
                  base::BindRepeating(&GetCurrentThermalState));
   dict.SetMethod("getSystemIdleTime", base::BindRepeating(&GetSystemIdleTime));
   dict.SetMethod("isOnBatteryPower", base::BindRepeating(&IsOnBatteryPower));
+  dict.SetMethod("setPowerSavingPolicy",
+                 base::BindRepeating(&SetPowerSavingPolicy));
+  dict.SetMethod("isPowerSaving", base::BindRepeating(&IsPowerSaving));
 }
 
 }  // namespace
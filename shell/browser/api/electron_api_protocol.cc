@@ -16,6 +16,7 @@
 #include "shell/browser/electron_browser_context.h"
 #include "shell/browser/protocol_registry.h"
 #include "shell/common/gin_converters/callback_converter.h"
+#include "shell/common/gin_converters/file_path_converter.h"
 #include "shell/common/gin_converters/net_converter.h"
 #include "shell/common/gin_helper/dictionary.h"
 #include "shell/common/gin_helper/object_template_builder.h"
@@ -23,6 +24,7 @@
 #include "shell/common/node_includes.h"
 #include "shell/common/options_switches.h"
 #include "shell/common/process_util.h"
+#include "url/url_constants.h"
 #include "url/url_util.h"
 
 namespace {
@@ -115,7 +117,11 @@ void RegisterSchemesAsPrivileged(gin_helper::ErrorThrower thrower,
   }
 
   for (const auto& custom_scheme : custom_schemes) {
-    if (custom_scheme.options.codeCache && !custom_scheme.options.standard) {
+    // file: URLs, including those served from asar archives, are not standard
+    // but have no host to key the cache on either, so the source hash is
+    // enough to tell whether a cache entry belongs to the loaded file.
+    if (custom_scheme.options.codeCache && !custom_scheme.options.standard &&
+        custom_scheme.scheme != url::kFileScheme) {
       thrower.ThrowError(
           "Code cache can only be enabled when the custom scheme is registered "
           "as standard scheme.");
@@ -235,6 +241,19 @@ bool Protocol::IsProtocolRegistered(const std::string& scheme) {
   return protocol_registry_->IsProtocolRegistered(scheme);
 }
 
+void Protocol::HandleDirectory(gin_helper::ErrorThrower thrower,
+                               const std::string& scheme,
+                               const base::FilePath& directory) {
+  if (!directory.IsAbsolute()) {
+    thrower.ThrowTypeError("The directory must be an absolute path");
+    return;
+  }
+  if (base::Contains(kBuiltinSchemes, scheme) ||
+      !protocol_registry_->RegisterDirectory(scheme, directory)) {
+    thrower.ThrowError("Failed to register protocol: " + scheme);
+  }
+}
+
 ProtocolError Protocol::InterceptProtocol(ProtocolType type,
                                           const std::string& scheme,
                                           const ProtocolHandler& handler) {
@@ -323,6 +342,7 @@ v8::Local<v8::ObjectTemplate> Protocol::FillObjectTemplate(
                  &Protocol::RegisterProtocolFor<ProtocolType::kStream>)
       .SetMethod("registerProtocol",
                  &Protocol::RegisterProtocolFor<ProtocolType::kFree>)
+      .SetMethod("handleDirectory", &Protocol::HandleDirectory)
       .SetMethod("unregisterProtocol", &Protocol::UnregisterProtocol)
       .SetMethod("isProtocolRegistered", &Protocol::IsProtocolRegistered)
       .SetMethod("isProtocolHandled", &Protocol::IsProtocolHandled)
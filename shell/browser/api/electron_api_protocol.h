@@ -8,6 +8,7 @@
 #include <string>
 #include <vector>
 
+#include "base/files/file_path.h"
 #include "base/memory/raw_ptr.h"
 #include "content/public/browser/content_browser_client.h"
 #include "gin/handle.h"
@@ -71,6 +72,9 @@ class Protocol : public gin::Wrappable<Protocol>,
                                  const ProtocolHandler& handler);
   bool UnregisterProtocol(const std::string& scheme, gin::Arguments* args);
   bool IsProtocolRegistered(const std::string& scheme);
+  void HandleDirectory(gin_helper::ErrorThrower thrower,
+                       const std::string& scheme,
+                       const base::FilePath& directory);
 
   ProtocolError InterceptProtocol(ProtocolType type,
                                   const std::string& scheme,
@@ -5,13 +5,20 @@
 #include "shell/browser/api/electron_api_safe_storage.h"
 
 #include <string>
+#include <utility>
+#include <vector>
 
+#include "base/functional/bind.h"
+#include "base/no_destructor.h"
+#include "base/task/sequenced_task_runner.h"
+#include "base/task/thread_pool.h"
 #include "components/os_crypt/sync/os_crypt.h"
 #include "shell/browser/browser.h"
 #include "shell/browser/browser_process_impl.h"
 #include "shell/common/gin_converters/base_converter.h"
 #include "shell/common/gin_converters/callback_converter.h"
 #include "shell/common/gin_helper/dictionary.h"
+#include "shell/common/gin_helper/promise.h"
 #include "shell/common/node_includes.h"
 #include "shell/common/platform_util.h"
 
@@ -128,6 +135,188 @@ std::string DecryptString(v8::Isolate* isolate, v8::Local<v8::Value> buffer) {
   return plaintext;
 }
 
+namespace {
+
+// Every asynchronous operation runs on this one sequence, so only the first
+// batch waits for the OS to hand out the encryption key and batches complete
+// in the order they were started.
+scoped_refptr<base::SequencedTaskRunner> GetCryptoTaskRunner() {
+  static base::NoDestructor<scoped_refptr<base::SequencedTaskRunner>> runner(
+      base::ThreadPool::CreateSequencedTaskRunner(
+          {base::MayBlock(), base::TaskPriority::USER_BLOCKING,
+           base::TaskShutdownBehavior::SKIP_ON_SHUTDOWN}));
+  return *runner;
+}
+
+struct BatchResult {
+  bool available = true;
+  bool success = true;
+  std::vector<std::string> outputs;
+};
+
+// Runs on the crypto task runner. A batch either succeeds as a whole or
+// fails as a whole.
+BatchResult EncryptOrDecryptBatch(bool encrypt,
+                                  bool plain_text_available,
+                                  std::vector<std::string> inputs) {
+  BatchResult result;
+  if (!plain_text_available && !OSCrypt::IsEncryptionAvailable()) {
+    result.available = false;
+    return result;
+  }
+
+  result.outputs.reserve(inputs.size());
+  for (const std::string& input : inputs) {
+    std::string output;
+    bool success = encrypt ? OSCrypt::EncryptString(input, &output)
+                           : input.empty() ||
+                                 OSCrypt::DecryptString(input, &output);
+    if (!success) {
+      result.success = false;
+      result.outputs.clear();
+      return result;
+    }
+    result.outputs.push_back(std::move(output));
+  }
+  return result;
+}
+
+std::string GetErrorMessage(bool encrypt, const std::string& method) {
+  return encrypt ? "Error while encrypting the text provided to safeStorage." +
+                       method + "."
+                 : "Error while decrypting the ciphertext provided to "
+                   "safeStorage." +
+                       method + ".";
+}
+
+void OnBatchDone(gin_helper::Promise<v8::Local<v8::Value>> promise,
+                 bool encrypt,
+                 bool single,
+                 const std::string& method,
+                 BatchResult result) {
+  if (!result.available) {
+    promise.RejectWithErrorMessage(
+        GetErrorMessage(encrypt, method) +
+        (encrypt ? " Encryption is not available."
+                 : " Decryption is not available."));
+    return;
+  }
+  if (!result.success) {
+    promise.RejectWithErrorMessage(GetErrorMessage(encrypt, method));
+    return;
+  }
+
+  v8::Isolate* isolate = promise.isolate();
+  gin_helper::Locker locker(isolate);
+  v8::HandleScope handle_scope(isolate);
+  v8::Context::Scope context_scope(promise.GetContext());
+
+  std::vector<v8::Local<v8::Value>> values;
+  values.reserve(result.outputs.size());
+  for (const std::string& output : result.outputs) {
+    if (encrypt) {
+      values.push_back(
+          node::Buffer::Copy(isolate, output.data(), output.size())
+              .ToLocalChecked());
+    } else {
+      values.push_back(gin::StringToV8(isolate, output));
+    }
+  }
+
+  if (single)
+    promise.Resolve(values.front());
+  else
+    promise.Resolve(v8::Array::New(isolate, values.data(), values.size()));
+}
+
+v8::Local<v8::Promise> StartBatch(v8::Isolate* isolate,
+                                  bool encrypt,
+                                  bool single,
+                                  const std::string& method,
+                                  std::vector<std::string> inputs) {
+  gin_helper::Promise<v8::Local<v8::Value>> promise(isolate);
+  v8::Local<v8::Promise> handle = promise.GetHandle();
+
+  bool plain_text_available = false;
+#if BUILDFLAG(IS_LINUX)
+  // See IsEncryptionAvailable().
+  if (!Browser::Get()->is_ready()) {
+    promise.RejectWithErrorMessage(
+        "safeStorage cannot be used before app is ready");
+    return handle;
+  }
+  plain_text_available = use_password_v10 &&
+                         static_cast<BrowserProcessImpl*>(g_browser_process)
+                                 ->linux_storage_backend() == "basic_text";
+#endif
+
+  GetCryptoTaskRunner()->PostTaskAndReplyWithResult(
+      FROM_HERE,
+      base::BindOnce(&EncryptOrDecryptBatch, encrypt, plain_text_available,
+                     std::move(inputs)),
+      base::BindOnce(&OnBatchDone, std::move(promise), encrypt, single,
+                     method));
+  return handle;
+}
+
+// Copies the ciphertext out of |buffer| on the calling thread, so that the
+// buffer may be reused as soon as the call returns.
+bool GetCiphertext(v8::Local<v8::Value> buffer, std::string* ciphertext) {
+  if (!node::Buffer::HasInstance(buffer))
+    return false;
+  ciphertext->assign(node::Buffer::Data(buffer), node::Buffer::Length(buffer));
+  return ciphertext->empty() ||
+         ciphertext->find(kEncryptionVersionPrefixV10) == 0 ||
+         ciphertext->find(kEncryptionVersionPrefixV11) == 0;
+}
+
+}  // namespace
+
+v8::Local<v8::Promise> EncryptStringAsync(v8::Isolate* isolate,
+                                          const std::string& plaintext) {
+  return StartBatch(isolate, true, true, "encryptStringAsync", {plaintext});
+}
+
+v8::Local<v8::Promise> EncryptStringsAsync(
+    v8::Isolate* isolate,
+    std::vector<std::string> plaintexts) {
+  return StartBatch(isolate, true, false, "encryptStringsAsync",
+                    std::move(plaintexts));
+}
+
+v8::Local<v8::Promise> DecryptStringAsync(v8::Isolate* isolate,
+                                          v8::Local<v8::Value> buffer) {
+  std::string ciphertext;
+  if (!GetCiphertext(buffer, &ciphertext)) {
+    gin_helper::Promise<void> promise(isolate);
+    v8::Local<v8::Promise> handle = promise.GetHandle();
+    promise.RejectWithErrorMessage(
+        "Expected the first argument of decryptStringAsync() to be a buffer "
+        "returned by safeStorage");
+    return handle;
+  }
+  return StartBatch(isolate, false, true, "decryptStringAsync",
+                    {std::move(ciphertext)});
+}
+
+v8::Local<v8::Promise> DecryptStringsAsync(
+    v8::Isolate* isolate,
+    const std::vector<v8::Local<v8::Value>>& buffers) {
+  std::vector<std::string> ciphertexts(buffers.size());
+  for (size_t i = 0; i < buffers.size(); ++i) {
+    if (!GetCiphertext(buffers[i], &ciphertexts[i])) {
+      gin_helper::Promise<void> promise(isolate);
+      v8::Local<v8::Promise> handle = promise.GetHandle();
+      promise.RejectWithErrorMessage(
+          "Expected every element of the first argument of "
+          "decryptStringsAsync() to be a buffer returned by safeStorage");
+      return handle;
+    }
+  }
+  return StartBatch(isolate, false, false, "decryptStringsAsync",
+                    std::move(ciphertexts));
+}
+
 }  // namespace electron::safestorage
 
 void Initialize(v8::Local<v8::Object> exports,
@@ -140,6 +329,14 @@ void Initialize(v8::Local<v8::Object> exports,
                  &electron::safestorage::IsEncryptionAvailable);
   dict.SetMethod("encryptString", &electron::safestorage::EncryptString);
   dict.SetMethod("decryptString", &electron::safestorage::DecryptString);
+  dict.SetMethod("encryptStringAsync",
+                 &electron::safestorage::EncryptStringAsync);
+  dict.SetMethod("encryptStringsAsync",
+                 &electron::safestorage::EncryptStringsAsync);
+  dict.SetMethod("decryptStringAsync",
+                 &electron::safestorage::DecryptStringAsync);
+  dict.SetMethod("decryptStringsAsync",
+                 &electron::safestorage::DecryptStringsAsync);
   dict.SetMethod("setUsePlainTextEncryption",
                  &electron::safestorage::SetUsePasswordV10);
 #if BUILDFLAG(IS_LINUX)
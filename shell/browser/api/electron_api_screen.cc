@@ -4,6 +4,7 @@
 
 #include "shell/browser/api/electron_api_screen.h"
 
+#include <cmath>
 #include <string>
 #include <string_view>
 
@@ -88,6 +89,58 @@ gfx::Point Screen::GetCursorScreenPoint(v8::Isolate* isolate) {
   return screen_->GetCursorScreenPoint();
 }
 
+display::Display Screen::GetPrimaryDisplay() {
+  if (!primary_display_)
+    primary_display_ = screen_->GetPrimaryDisplay();
+  return *primary_display_;
+}
+
+const std::vector<display::Display>& Screen::GetAllDisplays() {
+  if (!all_displays_)
+    all_displays_ = screen_->GetAllDisplays();
+  return *all_displays_;
+}
+
+v8::Local<v8::Value> Screen::GetDisplayNearestPoints(
+    gin_helper::ErrorThrower thrower,
+    v8::Local<v8::Value> points) {
+  v8::Isolate* isolate = thrower.isolate();
+  if (!points->IsFloat64Array() ||
+      points.As<v8::Float64Array>()->Length() % 2 != 0) {
+    thrower.ThrowTypeError(
+        "points must be a Float64Array of x and y coordinate pairs");
+    return v8::Undefined(isolate);
+  }
+
+  auto input = points.As<v8::Float64Array>();
+  std::vector<double> coordinates(input->Length());
+  input->CopyContents(coordinates.data(),
+                      coordinates.size() * sizeof(double));
+
+  const std::vector<display::Display>& displays = GetAllDisplays();
+  const size_t count = coordinates.size() / 2;
+  auto buffer = v8::ArrayBuffer::New(isolate, count * sizeof(int32_t));
+  auto* indices = static_cast<int32_t*>(buffer->Data());
+  for (size_t i = 0; i < count; ++i) {
+    const gfx::Point point(static_cast<int>(std::round(coordinates[2 * i])),
+                           static_cast<int>(std::round(coordinates[2 * i + 1])));
+    const int64_t id = screen_->GetDisplayNearestPoint(point).id();
+    indices[i] = -1;
+    for (size_t j = 0; j < displays.size(); ++j) {
+      if (displays[j].id() == id) {
+        indices[i] = static_cast<int32_t>(j);
+        break;
+      }
+    }
+  }
+  return v8::Int32Array::New(buffer, 0, count);
+}
+
+void Screen::ClearDisplayCache() {
+  primary_display_.reset();
+  all_displays_.reset();
+}
+
 #if BUILDFLAG(IS_WIN)
 
 static gfx::Rect ScreenToDIPRect(electron::NativeWindow* window,
@@ -105,12 +158,14 @@ static gfx::Rect DIPToScreenRect(electron::NativeWindow* window,
 #endif
 
 void Screen::OnDisplayAdded(const display::Display& new_display) {
+  ClearDisplayCache();
   base::SingleThreadTaskRunner::GetCurrentDefault()->PostNonNestableTask(
       FROM_HERE, base::BindOnce(&DelayEmit, base::Unretained(this),
                                 "display-added", new_display));
 }
 
 void Screen::OnDisplayRemoved(const display::Display& old_display) {
+  ClearDisplayCache();
   base::SingleThreadTaskRunner::GetCurrentDefault()->PostNonNestableTask(
       FROM_HERE, base::BindOnce(&DelayEmit, base::Unretained(this),
                                 "display-removed", old_display));
@@ -118,6 +173,7 @@ void Screen::OnDisplayRemoved(const display::Display& old_display) {
 
 void Screen::OnDisplayMetricsChanged(const display::Display& display,
                                      uint32_t changed_metrics) {
+  ClearDisplayCache();
   base::SingleThreadTaskRunner::GetCurrentDefault()->PostNonNestableTask(
       FROM_HERE, base::BindOnce(&DelayEmitWithMetrics, base::Unretained(this),
                                 "display-metrics-changed", display,
@@ -151,6 +207,7 @@ gin::ObjectTemplateBuilder Screen::GetObjectTemplateBuilder(
       .SetMethod("getPrimaryDisplay", &Screen::GetPrimaryDisplay)
       .SetMethod("getAllDisplays", &Screen::GetAllDisplays)
       .SetMethod("getDisplayNearestPoint", &Screen::GetDisplayNearestPoint)
+      .SetMethod("getDisplayNearestPoints", &Screen::GetDisplayNearestPoints)
 #if BUILDFLAG(IS_WIN)
       .SetMethod("screenToDipPoint", &display::win::ScreenWin::ScreenToDIPPoint)
       .SetMethod("dipToScreenPoint", &display::win::ScreenWin::DIPToScreenPoint)
@@ -5,12 +5,14 @@
 #ifndef ELECTRON_SHELL_BROWSER_API_ELECTRON_API_SCREEN_H_
 #define ELECTRON_SHELL_BROWSER_API_ELECTRON_API_SCREEN_H_
 
+#include <optional>
 #include <vector>
 
 #include "base/memory/raw_ptr.h"
 #include "gin/wrappable.h"
 #include "shell/browser/event_emitter_mixin.h"
 #include "shell/common/gin_helper/error_thrower.h"
+#include "ui/display/display.h"
 #include "ui/display/display_observer.h"
 #include "ui/display/screen.h"
 
@@ -42,15 +44,14 @@ class Screen : public gin::Wrappable<Screen>,
   ~Screen() override;
 
   gfx::Point GetCursorScreenPoint(v8::Isolate* isolate);
-  display::Display GetPrimaryDisplay() const {
-    return screen_->GetPrimaryDisplay();
-  }
-  const std::vector<display::Display>& GetAllDisplays() const {
-    return screen_->GetAllDisplays();
-  }
+  display::Display GetPrimaryDisplay();
+  const std::vector<display::Display>& GetAllDisplays();
   display::Display GetDisplayNearestPoint(const gfx::Point& point) const {
     return screen_->GetDisplayNearestPoint(point);
   }
+  v8::Local<v8::Value> GetDisplayNearestPoints(
+      gin_helper::ErrorThrower thrower,
+      v8::Local<v8::Value> points);
   display::Display GetDisplayMatching(const gfx::Rect& match_rect) const {
     return screen_->GetDisplayMatching(match_rect);
   }
@@ -62,7 +63,15 @@ class Screen : public gin::Wrappable<Screen>,
                                uint32_t changed_metrics) override;
 
  private:
+  void ClearDisplayCache();
+
   raw_ptr<display::Screen> screen_;
+
+  // The displays as of their last change, so that polling callers don't ask
+  // the OS each time. Every call still converts them to new JS objects, which
+  // callers are free to modify.
+  std::optional<display::Display> primary_display_;
+  std::optional<std::vector<display::Display>> all_displays_;
 };
 
 }  // namespace electron::api
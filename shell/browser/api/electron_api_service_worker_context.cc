@@ -4,12 +4,18 @@
 
 #include "shell/browser/api/electron_api_service_worker_context.h"
 
+#include <optional>
 #include <string_view>
 #include <utility>
 
+#include "base/functional/bind.h"
+#include "base/functional/callback_helpers.h"
+#include "base/strings/strcat.h"
 #include "base/strings/string_number_conversions.h"
 #include "chrome/browser/browser_process.h"
 #include "content/public/browser/console_message.h"
+#include "content/public/browser/service_worker_external_request_result.h"
+#include "content/public/browser/service_worker_external_request_timeout_type.h"
 #include "content/public/browser/storage_partition.h"
 #include "gin/data_object_builder.h"
 #include "gin/handle.h"
@@ -20,7 +26,11 @@
 #include "shell/common/gin_converters/value_converter.h"
 #include "shell/common/gin_helper/dictionary.h"
 #include "shell/common/gin_helper/function_template_extensions.h"
+#include "shell/common/gin_helper/promise.h"
 #include "shell/common/node_includes.h"
+#include "third_party/blink/public/common/service_worker/service_worker_status_code.h"
+#include "third_party/blink/public/common/storage_key/storage_key.h"
+#include "url/origin.h"
 
 namespace electron::api {
 
@@ -68,6 +78,22 @@ v8::Local<v8::Value> ServiceWorkerRunningInfoToDict(
       .Build();
 }
 
+using StartWorkerResultCallback =
+    base::OnceCallback<void(std::optional<int64_t> version_id,
+                            blink::ServiceWorkerStatusCode status)>;
+
+void OnStartWorkerForScope(gin_helper::Promise<int64_t> promise,
+                           std::optional<int64_t> version_id,
+                           blink::ServiceWorkerStatusCode status) {
+  if (!version_id) {
+    promise.RejectWithErrorMessage(
+        base::StrCat({"Failed to start service worker: ",
+                      blink::ServiceWorkerStatusToString(status)}));
+    return;
+  }
+  promise.Resolve(*version_id);
+}
+
 }  // namespace
 
 gin::WrapperInfo ServiceWorkerContext::kWrapperInfo = {gin::kEmbedderNativeGin};
@@ -108,6 +134,33 @@ void ServiceWorkerContext::OnRegistrationCompleted(const GURL& scope) {
        gin::DataObjectBuilder(isolate).Set("scope", scope).Build());
 }
 
+void ServiceWorkerContext::OnVersionStartingRunning(int64_t version_id) {
+  worker_start_times_[version_id] = base::TimeTicks::Now();
+}
+
+void ServiceWorkerContext::OnVersionStartedRunning(
+    int64_t version_id,
+    const content::ServiceWorkerRunningInfo& running_info) {
+  auto iter = worker_start_times_.find(version_id);
+  if (iter == worker_start_times_.end())
+    return;
+  base::TimeDelta startup_time = base::TimeTicks::Now() - iter->second;
+  worker_start_times_.erase(iter);
+
+  v8::Isolate* isolate = JavascriptEnvironment::GetIsolate();
+  v8::HandleScope handle_scope(isolate);
+  Emit("worker-started", gin::DataObjectBuilder(isolate)
+                             .Set("versionId", version_id)
+                             .Set("scope", running_info.scope.spec())
+                             .Set("startupTime", startup_time.InMillisecondsF())
+                             .Build());
+}
+
+void ServiceWorkerContext::OnVersionStoppedRunning(int64_t version_id) {
+  worker_start_times_.erase(version_id);
+  keep_alive_requests_.erase(version_id);
+}
+
 void ServiceWorkerContext::OnDestruct(content::ServiceWorkerContext* context) {
   if (context == service_worker_context_) {
     delete this;
@@ -141,6 +194,63 @@ v8::Local<v8::Value> ServiceWorkerContext::GetWorkerInfoFromID(
                                         std::move(iter->second));
 }
 
+v8::Local<v8::Promise> ServiceWorkerContext::StartWorkerForScope(
+    v8::Isolate* isolate,
+    const GURL& scope) {
+  gin_helper::Promise<int64_t> promise(isolate);
+  v8::Local<v8::Promise> handle = promise.GetHandle();
+
+  if (!scope.is_valid()) {
+    promise.RejectWithErrorMessage("Invalid scope");
+    return handle;
+  }
+
+  // Exactly one of the two callbacks passed to StartWorkerForScope is run.
+  auto [on_started, on_failed] = base::SplitOnceCallback(
+      base::BindOnce(&OnStartWorkerForScope, std::move(promise)));
+  service_worker_context_->StartWorkerForScope(
+      scope, blink::StorageKey::CreateFirstParty(url::Origin::Create(scope)),
+      base::BindOnce(
+          [](StartWorkerResultCallback callback, int64_t version_id,
+             int process_id, int thread_id) {
+            std::move(callback).Run(version_id,
+                                    blink::ServiceWorkerStatusCode::kOk);
+          },
+          std::move(on_started)),
+      base::BindOnce(
+          [](StartWorkerResultCallback callback,
+             blink::ServiceWorkerStatusCode status) {
+            std::move(callback).Run(std::nullopt, status);
+          },
+          std::move(on_failed)));
+
+  return handle;
+}
+
+bool ServiceWorkerContext::StartKeepAlive(int64_t version_id) {
+  if (keep_alive_requests_.contains(version_id))
+    return true;
+  base::Uuid request_uuid = base::Uuid::GenerateRandomV4();
+  content::ServiceWorkerExternalRequestResult result =
+      service_worker_context_->StartingExternalRequest(
+          version_id,
+          content::ServiceWorkerExternalRequestTimeoutType::kDoesNotTimeout,
+          request_uuid);
+  if (result != content::ServiceWorkerExternalRequestResult::kOk)
+    return false;
+  keep_alive_requests_.emplace(version_id, std::move(request_uuid));
+  return true;
+}
+
+void ServiceWorkerContext::StopKeepAlive(int64_t version_id) {
+  auto iter = keep_alive_requests_.find(version_id);
+  if (iter == keep_alive_requests_.end())
+    return;
+  base::Uuid request_uuid = std::move(iter->second);
+  keep_alive_requests_.erase(iter);
+  service_worker_context_->FinishedExternalRequest(version_id, request_uuid);
+}
+
 // static
 gin::Handle<ServiceWorkerContext> ServiceWorkerContext::Create(
     v8::Isolate* isolate,
@@ -157,7 +267,11 @@ gin::ObjectTemplateBuilder ServiceWorkerContext::GetObjectTemplateBuilder(
       .SetMethod("getAllRunning",
                  &ServiceWorkerContext::GetAllRunningWorkerInfo)
       .SetMethod("getFromVersionID",
-                 &ServiceWorkerContext::GetWorkerInfoFromID);
+                 &ServiceWorkerContext::GetWorkerInfoFromID)
+      .SetMethod("startWorkerForScope",
+                 &ServiceWorkerContext::StartWorkerForScope)
+      .SetMethod("startKeepAlive", &ServiceWorkerContext::StartKeepAlive)
+      .SetMethod("stopKeepAlive", &ServiceWorkerContext::StopKeepAlive);
 }
 
 const char* ServiceWorkerContext::GetTypeName() {
@@ -5,7 +5,10 @@
 #ifndef ELECTRON_SHELL_BROWSER_API_ELECTRON_API_SERVICE_WORKER_CONTEXT_H_
 #define ELECTRON_SHELL_BROWSER_API_ELECTRON_API_SERVICE_WORKER_CONTEXT_H_
 
+#include "base/containers/flat_map.h"
 #include "base/memory/raw_ptr.h"
+#include "base/time/time.h"
+#include "base/uuid.h"
 #include "content/public/browser/service_worker_context.h"
 #include "content/public/browser/service_worker_context_observer.h"
 #include "gin/handle.h"
@@ -30,12 +33,21 @@ class ServiceWorkerContext
   v8::Local<v8::Value> GetAllRunningWorkerInfo(v8::Isolate* isolate);
   v8::Local<v8::Value> GetWorkerInfoFromID(gin_helper::ErrorThrower thrower,
                                            int64_t version_id);
+  v8::Local<v8::Promise> StartWorkerForScope(v8::Isolate* isolate,
+                                             const GURL& scope);
+  bool StartKeepAlive(int64_t version_id);
+  void StopKeepAlive(int64_t version_id);
 
   // content::ServiceWorkerContextObserver
   void OnReportConsoleMessage(int64_t version_id,
                               const GURL& scope,
                               const content::ConsoleMessage& message) override;
   void OnRegistrationCompleted(const GURL& scope) override;
+  void OnVersionStartingRunning(int64_t version_id) override;
+  void OnVersionStartedRunning(
+      int64_t version_id,
+      const content::ServiceWorkerRunningInfo& running_info) override;
+  void OnVersionStoppedRunning(int64_t version_id) override;
   void OnDestruct(content::ServiceWorkerContext* context) override;
 
   // gin::Wrappable
@@ -56,6 +68,12 @@ class ServiceWorkerContext
  private:
   raw_ptr<content::ServiceWorkerContext> service_worker_context_;
 
+  // When each starting worker began to start, to report its startup time.
+  base::flat_map<int64_t, base::TimeTicks> worker_start_times_;
+
+  // The external request holding each kept alive worker.
+  base::flat_map<int64_t, base::Uuid> keep_alive_requests_;
+
   base::WeakPtrFactory<ServiceWorkerContext> weak_ptr_factory_{this};
 };
 
@@ -11,6 +11,7 @@
 #include <utility>
 #include <vector>
 
+#include "base/barrier_callback.h"
 #include "base/command_line.h"
 #include "base/containers/fixed_flat_map.h"
 #include "base/files/file_enumerator.h"
@@ -20,6 +21,7 @@
 #include "base/scoped_observation.h"
 #include "base/strings/string_util.h"
 #include "base/strings/stringprintf.h"
+#include "base/task/bind_post_task.h"
 #include "base/uuid.h"
 #include "chrome/browser/browser_process.h"
 #include "chrome/common/chrome_switches.h"
@@ -47,6 +49,7 @@
 #include "net/base/completion_repeating_callback.h"
 #include "net/base/load_flags.h"
 #include "net/base/network_anonymization_key.h"
+#include "net/dns/public/host_resolver_source.h"
 #include "net/http/http_auth_handler_factory.h"
 #include "net/http/http_auth_preferences.h"
 #include "net/http/http_cache.h"
@@ -86,8 +89,10 @@
 #include "shell/common/node_includes.h"
 #include "shell/common/options_switches.h"
 #include "shell/common/process_util.h"
+#include "storage/browser/quota/quota_manager.h"
 #include "third_party/blink/public/common/storage_key/storage_key.h"
 #include "third_party/blink/public/mojom/mediastream/media_stream.mojom.h"
+#include "third_party/blink/public/mojom/quota/quota_types.mojom.h"
 #include "ui/base/l10n/l10n_util.h"
 #include "url/origin.h"
 
@@ -531,6 +536,148 @@ class DictionaryObserver final : public SpellcheckCustomDictionary::Observer {
 };
 #endif  // BUILDFLAG(ENABLE_BUILTIN_SPELLCHECKER)
 
+// Resolves the hosts passed to Session::PrefetchHosts. Each host is looked up
+// in local sources first so that the result can tell cache hits apart from
+// lookups that went to the network.
+class HostPrefetcher : public base::RefCounted<HostPrefetcher> {
+ public:
+  HostPrefetcher(ElectronBrowserContext* browser_context,
+                 network::mojom::ResolveHostParametersPtr params,
+                 gin_helper::Promise<gin_helper::Dictionary> promise)
+      : browser_context_(browser_context),
+        params_(std::move(params)),
+        promise_(std::move(promise)) {}
+
+  // disable copy
+  HostPrefetcher(const HostPrefetcher&) = delete;
+  HostPrefetcher& operator=(const HostPrefetcher&) = delete;
+
+  void Start(const std::vector<std::string>& hosts) {
+    pending_ = hosts.size();
+    if (!pending_) {
+      Finish();
+      return;
+    }
+    const bool use_cache =
+        params_->cache_usage !=
+        network::mojom::ResolveHostParameters::CacheUsage::DISALLOWED;
+    for (const auto& host : hosts) {
+      if (!use_cache) {
+        Resolve(host);
+        continue;
+      }
+      auto params = params_.Clone();
+      params->source = net::HostResolverSource::LOCAL_ONLY;
+      base::MakeRefCounted<ResolveHostFunction>(
+          browser_context_, host, std::move(params),
+          base::BindOnce(&HostPrefetcher::OnLocalLookupComplete, this, host))
+          ->Run();
+    }
+  }
+
+ private:
+  friend class base::RefCounted<HostPrefetcher>;
+  ~HostPrefetcher() = default;
+
+  void Resolve(const std::string& host) {
+    base::MakeRefCounted<ResolveHostFunction>(
+        browser_context_, host, params_.Clone(),
+        base::BindOnce(&HostPrefetcher::OnLookupComplete, this))
+        ->Run();
+  }
+
+  void OnLocalLookupComplete(const std::string& host,
+                             int64_t net_error,
+                             const std::optional<net::AddressList>& addrs) {
+    if (net_error < 0) {
+      Resolve(host);
+      return;
+    }
+    ++cache_hits_;
+    OnHostDone();
+  }
+
+  void OnLookupComplete(int64_t net_error,
+                        const std::optional<net::AddressList>& addrs) {
+    if (net_error < 0)
+      ++failed_;
+    else
+      ++resolved_;
+    OnHostDone();
+  }
+
+  void OnHostDone() {
+    if (--pending_ == 0)
+      Finish();
+  }
+
+  void Finish() {
+    v8::HandleScope handle_scope(promise_.isolate());
+    auto dict = gin_helper::Dictionary::CreateEmpty(promise_.isolate());
+    dict.Set("cacheHits", cache_hits_);
+    dict.Set("resolved", resolved_);
+    dict.Set("failed", failed_);
+    promise_.Resolve(dict);
+  }
+
+  raw_ptr<ElectronBrowserContext> browser_context_;
+  network::mojom::ResolveHostParametersPtr params_;
+  gin_helper::Promise<gin_helper::Dictionary> promise_;
+  size_t pending_ = 0;
+  size_t cache_hits_ = 0;
+  size_t resolved_ = 0;
+  size_t failed_ = 0;
+};
+
+// Quota managed usage of one storage key, as reported by the QuotaManager.
+struct StorageUsage {
+  std::string origin;
+  int64_t usage = 0;
+  int64_t indexed_db = 0;
+  int64_t cache_storage = 0;
+  int64_t service_worker = 0;
+  int64_t file_system = 0;
+};
+
+using StorageUsageCallback =
+    base::OnceCallback<void(std::vector<StorageUsage>)>;
+
+void GetStorageUsageOnIOThread(scoped_refptr<storage::QuotaManager> manager,
+                               StorageUsageCallback callback) {
+  DCHECK_CURRENTLY_ON(BrowserThread::IO);
+  manager->GetStorageKeysForType(
+      blink::mojom::StorageType::kTemporary,
+      base::BindOnce(
+          [](scoped_refptr<storage::QuotaManager> manager,
+             StorageUsageCallback callback,
+             const std::set<blink::StorageKey>& storage_keys) {
+            auto barrier = base::BarrierCallback<StorageUsage>(
+                storage_keys.size(), std::move(callback));
+            for (const auto& storage_key : storage_keys) {
+              manager->GetStorageKeyUsageWithBreakdown(
+                  storage_key, blink::mojom::StorageType::kTemporary,
+                  base::BindOnce(
+                      [](std::string origin,
+                         base::RepeatingCallback<void(StorageUsage)> barrier,
+                         int64_t usage,
+                         blink::mojom::UsageBreakdownPtr breakdown) {
+                        StorageUsage result;
+                        result.origin = std::move(origin);
+                        result.usage = usage;
+                        if (breakdown) {
+                          result.indexed_db = breakdown->indexedDatabase;
+                          result.cache_storage = breakdown->serviceWorkerCache;
+                          result.service_worker = breakdown->serviceWorker;
+                          result.file_system = breakdown->fileSystem;
+                        }
+                        barrier.Run(std::move(result));
+                      },
+                      storage_key.origin().Serialize(), barrier));
+            }
+          },
+          std::move(manager), std::move(callback)));
+}
+
 struct UserDataLink : base::SupportsUserData::Data {
   explicit UserDataLink(Session* ses) : session(ses) {}
 
@@ -665,6 +812,22 @@ v8::Local<v8::Promise> Session::ResolveHost(
   return handle;
 }
 
+v8::Local<v8::Promise> Session::PrefetchHosts(
+    const std::vector<std::string>& hosts,
+    std::optional<network::mojom::ResolveHostParametersPtr> params) {
+  gin_helper::Promise<gin_helper::Dictionary> promise(isolate_);
+  v8::Local<v8::Promise> handle = promise.GetHandle();
+
+  auto prefetcher = base::MakeRefCounted<HostPrefetcher>(
+      browser_context_,
+      params && *params ? std::move(params.value())
+                        : network::mojom::ResolveHostParameters::New(),
+      std::move(promise));
+  prefetcher->Start(hosts);
+
+  return handle;
+}
+
 v8::Local<v8::Promise> Session::GetCacheSize() {
   gin_helper::Promise<int64_t> promise(isolate_);
   auto handle = promise.GetHandle();
@@ -688,6 +851,46 @@ v8::Local<v8::Promise> Session::GetCacheSize() {
   return handle;
 }
 
+v8::Local<v8::Promise> Session::GetStorageUsage() {
+  gin_helper::Promise<v8::Local<v8::Value>> promise(isolate_);
+  auto handle = promise.GetHandle();
+
+  scoped_refptr<storage::QuotaManager> quota_manager =
+      browser_context_->GetDefaultStoragePartition()->GetQuotaManager();
+  content::GetIOThreadTaskRunner({})->PostTask(
+      FROM_HERE,
+      base::BindOnce(
+          &GetStorageUsageOnIOThread, std::move(quota_manager),
+          base::BindPostTaskToCurrentDefault(base::BindOnce(
+              [](gin_helper::Promise<v8::Local<v8::Value>> promise,
+                 std::vector<StorageUsage> usages) {
+                // Largest first, which is the order things get evicted in
+                // when trimming a profile down to a budget.
+                std::sort(usages.begin(), usages.end(),
+                          [](const StorageUsage& a, const StorageUsage& b) {
+                            return a.usage > b.usage;
+                          });
+                v8::Isolate* isolate = promise.isolate();
+                v8::HandleScope handle_scope(isolate);
+                std::vector<gin_helper::Dictionary> result;
+                result.reserve(usages.size());
+                for (const auto& usage : usages) {
+                  auto dict = gin_helper::Dictionary::CreateEmpty(isolate);
+                  dict.Set("origin", usage.origin);
+                  dict.Set("usage", usage.usage);
+                  dict.Set("indexedDB", usage.indexed_db);
+                  dict.Set("cacheStorage", usage.cache_storage);
+                  dict.Set("serviceWorker", usage.service_worker);
+                  dict.Set("fileSystem", usage.file_system);
+                  result.push_back(std::move(dict));
+                }
+                promise.Resolve(gin::ConvertToV8(isolate, result));
+              },
+              std::move(promise)))));
+
+  return handle;
+}
+
 v8::Local<v8::Promise> Session::ClearCache() {
   gin_helper::Promise<void> promise(isolate_);
   auto handle = promise.GetHandle();
@@ -772,8 +975,10 @@ v8::Local<v8::Promise> Session::SetProxy(gin::Arguments* args) {
       WriteablePrefStore::DEFAULT_PREF_WRITE_FLAGS);
 
   base::SingleThreadTaskRunner::GetCurrentDefault()->PostTask(
-      FROM_HERE, base::BindOnce(gin_helper::Promise<void>::ResolvePromise,
-                                std::move(promise)));
+      FROM_HERE,
+      browser_context_->GetResolveProxyHelper()->ClearCacheBefore(
+          base::BindOnce(gin_helper::Promise<void>::ResolvePromise,
+                         std::move(promise))));
 
   return handle;
 }
@@ -784,8 +989,10 @@ v8::Local<v8::Promise> Session::ForceReloadProxyConfig() {
 
   browser_context_->GetDefaultStoragePartition()
       ->GetNetworkContext()
-      ->ForceReloadProxyConfig(base::BindOnce(
-          gin_helper::Promise<void>::ResolvePromise, std::move(promise)));
+      ->ForceReloadProxyConfig(
+          browser_context_->GetResolveProxyHelper()->ClearCacheBefore(
+              base::BindOnce(gin_helper::Promise<void>::ResolvePromise,
+                             std::move(promise))));
 
   return handle;
 }
@@ -827,11 +1034,25 @@ void Session::SetCertVerifyProc(v8::Local<v8::Value> val,
     return;
   }
 
+  CertVerifierClient::Options client_options;
+  gin_helper::Dictionary options;
+  if (args->GetNext(&options)) {
+    double cache_ttl = 0;
+    if (options.Get("cacheTTL", &cache_ttl)) {
+      if (!(cache_ttl >= 0)) {
+        args->ThrowTypeError("'cacheTTL' must be a non-negative number");
+        return;
+      }
+      client_options.cache_ttl = base::Milliseconds(cache_ttl);
+    }
+    options.Get("reuseApprovedChains", &client_options.reuse_approved_chains);
+  }
+
   mojo::PendingRemote<network::mojom::CertVerifierClient>
       cert_verifier_client_remote;
   if (proc) {
     mojo::MakeSelfOwnedReceiver(
-        std::make_unique<CertVerifierClient>(proc),
+        std::make_unique<CertVerifierClient>(proc, client_options),
         cert_verifier_client_remote.InitWithNewPipeAndPassReceiver());
   }
   browser_context_->GetDefaultStoragePartition()
@@ -872,9 +1093,14 @@ void Session::SetPermissionCheckHandler(v8::Local<v8::Value> val,
     args->ThrowTypeError("Must pass null or function");
     return;
   }
+  int cache_duration = 0;
+  gin_helper::Dictionary options;
+  if (args->GetNext(&options))
+    options.Get("cacheDuration", &cache_duration);
   auto* permission_manager = static_cast<ElectronPermissionManager*>(
       browser_context()->GetPermissionControllerDelegate());
-  permission_manager->SetPermissionCheckHandler(handler);
+  permission_manager->SetPermissionCheckHandler(
+      handler, base::Milliseconds(std::max(cache_duration, 0)));
 }
 
 void Session::SetDisplayMediaRequestHandler(v8::Isolate* isolate,
@@ -1009,6 +1235,14 @@ v8::Local<v8::Promise> Session::GetBlobData(v8::Isolate* isolate,
   return holder->ReadAll(isolate);
 }
 
+v8::Local<v8::Value> Session::GetBlobDataPipe(v8::Isolate* isolate,
+                                              const std::string& uuid) {
+  gin::Handle<DataPipeHolder> holder = DataPipeHolder::From(isolate, uuid);
+  if (holder.IsEmpty())
+    return v8::Null(isolate);
+  return holder.ToV8();
+}
+
 void Session::DownloadURL(const GURL& url, gin::Arguments* args) {
   std::map<std::string, std::string> headers;
   gin_helper::Dictionary options;
@@ -1279,9 +1513,35 @@ void Session::SetCodeCachePath(gin::Arguments* args) {
     }
     code_cache_context->Initialize(
         code_cache_path, 0 /* allows disk_cache to choose the size */);
+    code_cache_path_ = code_cache_path;
   }
 }
 
+void Session::SetPreloadCodeCacheEnabled(bool enabled) {
+  preload_code_cache_enabled_ = enabled;
+}
+
+v8::Local<v8::Value> Session::GetPreloadCodeCachePath(v8::Isolate* isolate) {
+  if (!preload_code_cache_enabled_)
+    return v8::Null(isolate);
+  base::FilePath code_cache_path = code_cache_path_;
+  if (code_cache_path.empty()) {
+    if (browser_context_->IsOffTheRecord())
+      return v8::Null(isolate);
+    code_cache_path =
+        browser_context_->GetPath().Append(FILE_PATH_LITERAL("Code Cache"));
+  }
+  return gin::ConvertToV8(isolate,
+                          code_cache_path.Append(FILE_PATH_LITERAL("Preload")));
+}
+
+void Session::SetSpareRendererEnabled(bool enabled) {
+  browser_context_->set_spare_renderer_enabled(enabled);
+  if (enabled)
+    content::RenderProcessHost::WarmupSpareRenderProcessHost(
+        browser_context_.get());
+}
+
 v8::Local<v8::Promise> Session::ClearCodeCaches(
     const gin_helper::Dictionary& options) {
   auto* isolate = JavascriptEnvironment::GetIsolate();
@@ -1592,8 +1852,10 @@ void Session::FillObjectTemplate(v8::Isolate* isolate,
                                  v8::Local<v8::ObjectTemplate> templ) {
   gin::ObjectTemplateBuilder(isolate, GetClassName(), templ)
       .SetMethod("resolveHost", &Session::ResolveHost)
+      .SetMethod("prefetchHosts", &Session::PrefetchHosts)
       .SetMethod("resolveProxy", &Session::ResolveProxy)
       .SetMethod("getCacheSize", &Session::GetCacheSize)
+      .SetMethod("getStorageUsage", &Session::GetStorageUsage)
       .SetMethod("clearCache", &Session::ClearCache)
       .SetMethod("clearStorageData", &Session::ClearStorageData)
       .SetMethod("flushStorageData", &Session::FlushStorageData)
@@ -1624,6 +1886,7 @@ void Session::FillObjectTemplate(v8::Isolate* isolate,
       .SetMethod("getUserAgent", &Session::GetUserAgent)
       .SetMethod("setSSLConfig", &Session::SetSSLConfig)
       .SetMethod("getBlobData", &Session::GetBlobData)
+      .SetMethod("_getBlobDataPipe", &Session::GetBlobDataPipe)
       .SetMethod("downloadURL", &Session::DownloadURL)
       .SetMethod("createInterruptedDownload",
                  &Session::CreateInterruptedDownload)
@@ -1657,6 +1920,10 @@ void Session::FillObjectTemplate(v8::Isolate* isolate,
       .SetMethod("closeAllConnections", &Session::CloseAllConnections)
       .SetMethod("getStoragePath", &Session::GetPath)
       .SetMethod("setCodeCachePath", &Session::SetCodeCachePath)
+      .SetMethod("setPreloadCodeCacheEnabled",
+                 &Session::SetPreloadCodeCacheEnabled)
+      .SetMethod("_getPreloadCodeCachePath", &Session::GetPreloadCodeCachePath)
+      .SetMethod("setSpareRendererEnabled", &Session::SetSpareRendererEnabled)
       .SetMethod("clearCodeCaches", &Session::ClearCodeCaches)
       .SetMethod("clearData", &Session::ClearData)
       .SetProperty("cookies", &Session::Cookies)
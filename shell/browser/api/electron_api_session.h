@@ -9,6 +9,7 @@
 #include <string>
 #include <vector>
 
+#include "base/files/file_path.h"
 #include "base/memory/raw_ptr.h"
 #include "base/values.h"
 #include "content/public/browser/download_manager.h"
@@ -23,6 +24,7 @@
 #include "shell/common/gin_helper/constructible.h"
 #include "shell/common/gin_helper/error_thrower.h"
 #include "shell/common/gin_helper/function_template_extensions.h"
+#include "shell/common/gin_helper/live_object.h"
 #include "shell/common/gin_helper/pinnable.h"
 #include "shell/common/gin_helper/promise.h"
 
@@ -103,8 +105,12 @@ class Session : public gin::Wrappable<Session>,
   v8::Local<v8::Promise> ResolveHost(
       std::string host,
       std::optional<network::mojom::ResolveHostParametersPtr> params);
+  v8::Local<v8::Promise> PrefetchHosts(
+      const std::vector<std::string>& hosts,
+      std::optional<network::mojom::ResolveHostParametersPtr> params);
   v8::Local<v8::Promise> ResolveProxy(gin::Arguments* args);
   v8::Local<v8::Promise> GetCacheSize();
+  v8::Local<v8::Promise> GetStorageUsage();
   v8::Local<v8::Promise> ClearCache();
   v8::Local<v8::Promise> ClearStorageData(gin::Arguments* args);
   void FlushStorageData();
@@ -133,6 +139,8 @@ class Session : public gin::Wrappable<Session>,
   bool IsPersistent();
   v8::Local<v8::Promise> GetBlobData(v8::Isolate* isolate,
                                      const std::string& uuid);
+  v8::Local<v8::Value> GetBlobDataPipe(v8::Isolate* isolate,
+                                       const std::string& uuid);
   void DownloadURL(const GURL& url, gin::Arguments* args);
   void CreateInterruptedDownload(const gin_helper::Dictionary& options);
   void SetPreloads(const std::vector<base::FilePath>& preloads);
@@ -146,6 +154,9 @@ class Session : public gin::Wrappable<Session>,
   v8::Local<v8::Promise> CloseAllConnections();
   v8::Local<v8::Value> GetPath(v8::Isolate* isolate);
   void SetCodeCachePath(gin::Arguments* args);
+  void SetPreloadCodeCacheEnabled(bool enabled);
+  v8::Local<v8::Value> GetPreloadCodeCachePath(v8::Isolate* isolate);
+  void SetSpareRendererEnabled(bool enabled);
   v8::Local<v8::Promise> ClearCodeCaches(const gin_helper::Dictionary& options);
   v8::Local<v8::Value> ClearData(gin_helper::ErrorThrower thrower,
                                  gin::Arguments* args);
@@ -215,7 +226,14 @@ class Session : public gin::Wrappable<Session>,
   // The client id to enable the network throttler.
   base::UnguessableToken network_emulation_token_;
 
+  // Set by setCodeCachePath, empty when the default directory is used.
+  base::FilePath code_cache_path_;
+
+  bool preload_code_cache_enabled_ = false;
+
   raw_ptr<ElectronBrowserContext> browser_context_;
+
+  gin_helper::LiveObject live_object_{"Session"};
 };
 
 }  // namespace api
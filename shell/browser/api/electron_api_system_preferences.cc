@@ -17,34 +17,55 @@ namespace electron::api {
 
 gin::WrapperInfo SystemPreferences::kWrapperInfo = {gin::kEmbedderNativeGin};
 
-#if BUILDFLAG(IS_WIN)
 SystemPreferences::SystemPreferences() {
+#if BUILDFLAG(IS_WIN)
   InitializeWindow();
-}
-#else
-SystemPreferences::SystemPreferences() = default;
 #endif
+  ui::NativeTheme::GetInstanceForNativeUi()->AddObserver(this);
+}
 
-#if BUILDFLAG(IS_WIN)
 SystemPreferences::~SystemPreferences() {
+  ui::NativeTheme::GetInstanceForNativeUi()->RemoveObserver(this);
+#if BUILDFLAG(IS_WIN)
   Browser::Get()->RemoveObserver(this);
-}
-#else
-SystemPreferences::~SystemPreferences() = default;
 #endif
+}
 
 v8::Local<v8::Value> SystemPreferences::GetAnimationSettings(
     v8::Isolate* isolate) {
+  if (!animation_settings_) {
+    animation_settings_ = AnimationSettings{
+        .should_render_rich_animation =
+            gfx::Animation::ShouldRenderRichAnimation(),
+        .scroll_animations_enabled_by_system =
+            gfx::Animation::ScrollAnimationsEnabledBySystem(),
+        .prefers_reduced_motion = gfx::Animation::PrefersReducedMotion(),
+    };
+  }
+
   auto dict = gin_helper::Dictionary::CreateEmpty(isolate);
   dict.Set("shouldRenderRichAnimation",
-           gfx::Animation::ShouldRenderRichAnimation());
+           animation_settings_->should_render_rich_animation);
   dict.Set("scrollAnimationsEnabledBySystem",
-           gfx::Animation::ScrollAnimationsEnabledBySystem());
-  dict.Set("prefersReducedMotion", gfx::Animation::PrefersReducedMotion());
+           animation_settings_->scroll_animations_enabled_by_system);
+  dict.Set("prefersReducedMotion", animation_settings_->prefers_reduced_motion);
 
   return dict.GetHandle();
 }
 
+void SystemPreferences::OnNativeThemeUpdated(ui::NativeTheme* theme) {
+  // The native theme is updated for changes of the system colors, the
+  // appearance and the accessibility settings, which covers every cached
+  // value.
+  InvalidateCaches();
+}
+
+void SystemPreferences::InvalidateCaches() {
+  accent_color_.reset();
+  colors_.clear();
+  animation_settings_.reset();
+}
+
 // static
 gin::Handle<SystemPreferences> SystemPreferences::Create(v8::Isolate* isolate) {
   return gin::CreateHandle(isolate, new SystemPreferences());
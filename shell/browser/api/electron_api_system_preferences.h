@@ -6,14 +6,18 @@
 #define ELECTRON_SHELL_BROWSER_API_ELECTRON_API_SYSTEM_PREFERENCES_H_
 
 #include <memory>
+#include <optional>
 #include <string>
 
+#include "base/containers/flat_map.h"
+#include "base/memory/weak_ptr.h"
 #include "base/values.h"
 #include "gin/handle.h"
 #include "gin/wrappable.h"
 #include "shell/browser/event_emitter_mixin.h"
 #include "shell/common/gin_helper/error_thrower.h"
 #include "shell/common/gin_helper/promise.h"
+#include "ui/native_theme/native_theme_observer.h"
 
 #if BUILDFLAG(IS_WIN)
 #include "shell/browser/browser.h"
@@ -33,7 +37,8 @@ enum class NotificationCenterKind {
 
 class SystemPreferences
     : public gin::Wrappable<SystemPreferences>,
-      public gin_helper::EventEmitterMixin<SystemPreferences>
+      public gin_helper::EventEmitterMixin<SystemPreferences>,
+      public ui::NativeThemeObserver
 #if BUILDFLAG(IS_WIN)
     ,
       public BrowserObserver,
@@ -116,6 +121,9 @@ class SystemPreferences
 #endif
   v8::Local<v8::Value> GetAnimationSettings(v8::Isolate* isolate);
 
+  // ui::NativeThemeObserver:
+  void OnNativeThemeUpdated(ui::NativeTheme* theme) override;
+
   // disable copy
   SystemPreferences(const SystemPreferences&) = delete;
   SystemPreferences& operator=(const SystemPreferences&) = delete;
@@ -132,7 +140,25 @@ class SystemPreferences
 #endif
 
  private:
+  struct AnimationSettings {
+    bool should_render_rich_animation;
+    bool scroll_animations_enabled_by_system;
+    bool prefers_reduced_motion;
+  };
+
+  // Drops the values cached from the OS, called whenever the OS reports that
+  // one of them might have changed.
+  void InvalidateCaches();
+
+  // Values of getAccentColor(), getColor() and getAnimationSettings(), which
+  // otherwise query the OS on every call.
+  std::optional<std::string> accent_color_;
+  base::flat_map<std::string, std::string> colors_;
+  std::optional<AnimationSettings> animation_settings_;
+
 #if BUILDFLAG(IS_WIN)
+  void EmitColorChanged();
+
   // Static callback invoked when a message comes in to our messaging window.
   static LRESULT CALLBACK WndProcStatic(HWND hwnd,
                                         UINT message,
@@ -156,7 +182,12 @@ class SystemPreferences
   std::string current_color_;
 
   std::unique_ptr<gfx::ScopedSysColorChangeListener> color_change_listener_;
+
+  // Whether a "color-changed" event is already queued.
+  bool color_changed_pending_ = false;
 #endif
+
+  base::WeakPtrFactory<SystemPreferences> weak_factory_{this};
 };
 
 }  // namespace electron::api
@@ -374,9 +374,12 @@ void SystemPreferences::SetUserDefault(const std::string& name,
 }
 
 std::string SystemPreferences::GetAccentColor() {
-  NSColor* sysColor = sysColor = [NSColor controlAccentColor];
-  return ToRGBAHex(skia::NSSystemColorToSkColor(sysColor),
-                   false /* include_hash */);
+  if (!accent_color_) {
+    NSColor* sysColor = [NSColor controlAccentColor];
+    accent_color_ = ToRGBAHex(skia::NSSystemColorToSkColor(sysColor),
+                              false /* include_hash */);
+  }
+  return *accent_color_;
 }
 
 std::string SystemPreferences::GetSystemColor(gin_helper::ErrorThrower thrower,
@@ -470,6 +473,9 @@ bool SystemPreferences::IsTrustedAccessibilityClient(bool prompt) {
 
 std::string SystemPreferences::GetColor(gin_helper::ErrorThrower thrower,
                                         const std::string& color) {
+  if (auto cached = colors_.find(color); cached != colors_.end())
+    return cached->second;
+
   NSColor* sysColor = nil;
   if (color == "control-background") {
     sysColor = [NSColor controlBackgroundColor];
@@ -539,9 +545,12 @@ std::string SystemPreferences::GetColor(gin_helper::ErrorThrower thrower,
     thrower.ThrowError("Unknown color: " + color);
   }
 
-  if (sysColor)
-    return ToRGBAHex(skia::NSSystemColorToSkColor(sysColor));
-  return "";
+  if (!sysColor)
+    return "";
+
+  std::string value = ToRGBAHex(skia::NSSystemColorToSkColor(sysColor));
+  colors_.emplace(color, value);
+  return value;
 }
 
 std::string SystemPreferences::GetMediaAccessStatus(
@@ -12,6 +12,7 @@
 #include "shell/browser/api/electron_api_system_preferences.h"
 
 #include "base/containers/fixed_flat_map.h"
+#include "base/task/sequenced_task_runner.h"
 #include "base/win/core_winrt_util.h"
 #include "base/win/windows_types.h"
 #include "base/win/wrapped_window_proc.h"
@@ -88,6 +89,9 @@ std::string hexColorDWORDToRGBA(DWORD color) {
 }
 
 std::string SystemPreferences::GetAccentColor() {
+  if (accent_color_)
+    return *accent_color_;
+
   DWORD color = 0;
   BOOL opaque = FALSE;
 
@@ -95,7 +99,8 @@ std::string SystemPreferences::GetAccentColor() {
     return "";
   }
 
-  return hexColorDWORDToRGBA(color);
+  accent_color_ = hexColorDWORDToRGBA(color);
+  return *accent_color_;
 }
 
 std::string SystemPreferences::GetColor(gin_helper::ErrorThrower thrower,
@@ -133,8 +138,14 @@ std::string SystemPreferences::GetColor(gin_helper::ErrorThrower thrower,
       {"window-text", COLOR_WINDOWTEXT},
   });
 
-  if (const auto* iter = Lookup.find(color); iter != Lookup.end())
-    return ToRGBAHex(color_utils::GetSysSkColor(iter->second));
+  if (auto cached = colors_.find(color); cached != colors_.end())
+    return cached->second;
+
+  if (const auto* iter = Lookup.find(color); iter != Lookup.end()) {
+    std::string value = ToRGBAHex(color_utils::GetSysSkColor(iter->second));
+    colors_.emplace(color, value);
+    return value;
+  }
 
   thrower.ThrowError("Unknown color: " + color);
   return "";
@@ -205,15 +216,33 @@ LRESULT CALLBACK SystemPreferences::WndProc(HWND hwnd,
   if (message == WM_DWMCOLORIZATIONCOLORCHANGED) {
     DWORD new_color = (DWORD)wparam;
     std::string new_color_string = hexColorDWORDToRGBA(new_color);
+    accent_color_ = new_color_string;
     if (new_color_string != current_color_) {
       Emit("accent-color-changed", hexColorDWORDToRGBA(new_color));
       current_color_ = new_color_string;
     }
+  } else if (message == WM_SETTINGCHANGE) {
+    // The animation settings are SystemParametersInfo() values, which are
+    // announced with WM_SETTINGCHANGE.
+    animation_settings_.reset();
   }
   return ::DefWindowProc(hwnd, message, wparam, lparam);
 }
 
 void SystemPreferences::OnSysColorChange() {
+  colors_.clear();
+  // Changing the theme changes many system colors at once, which Windows
+  // reports with several WM_SYSCOLORCHANGE messages.
+  if (color_changed_pending_)
+    return;
+  color_changed_pending_ = true;
+  base::SequencedTaskRunner::GetCurrentDefault()->PostTask(
+      FROM_HERE, base::BindOnce(&SystemPreferences::EmitColorChanged,
+                                weak_factory_.GetWeakPtr()));
+}
+
+void SystemPreferences::EmitColorChanged() {
+  color_changed_pending_ = false;
   Emit("color-changed");
 }
 
@@ -6,6 +6,7 @@
 
 #include <string>
 #include <string_view>
+#include <utility>
 
 #include "base/containers/fixed_flat_map.h"
 #include "gin/dictionary.h"
@@ -226,6 +227,40 @@ void Tray::SetPressedImage(v8::Isolate* isolate, v8::Local<v8::Value> image) {
 #endif
 }
 
+void Tray::SetImageFrames(v8::Isolate* isolate,
+                          const std::vector<v8::Local<v8::Value>>& images) {
+  if (!CheckAlive())
+    return;
+
+  std::vector<TrayIcon::ImageFrame> frames;
+  frames.reserve(images.size());
+  for (const auto& image : images) {
+    NativeImage* native_image = nullptr;
+    if (!NativeImage::TryConvertNativeImage(isolate, image, &native_image))
+      return;
+#if BUILDFLAG(IS_WIN)
+    // The icon belongs to |native_image|, which may be collected while the
+    // frame is still registered.
+    frames.emplace_back(
+        CopyIcon(native_image->GetHICON(GetSystemMetrics(SM_CXSMICON))));
+#else
+    frames.push_back(native_image->image());
+#endif
+  }
+  tray_icon_->SetImageFrames(std::move(frames));
+}
+
+void Tray::SetImageFrame(gin_helper::ErrorThrower thrower, uint32_t index) {
+  if (!CheckAlive())
+    return;
+
+  if (index >= tray_icon_->GetImageFrameCount()) {
+    thrower.ThrowRangeError("index must be less than the number of frames");
+    return;
+  }
+  tray_icon_->SetImageFrame(index);
+}
+
 void Tray::SetToolTip(const std::string& tool_tip) {
   if (!CheckAlive())
     return;
@@ -410,6 +445,8 @@ void Tray::FillObjectTemplate(v8::Isolate* isolate,
       .SetMethod("isDestroyed", &Tray::IsDestroyed)
       .SetMethod("setImage", &Tray::SetImage)
       .SetMethod("setPressedImage", &Tray::SetPressedImage)
+      .SetMethod("setImageFrames", &Tray::SetImageFrames)
+      .SetMethod("setImageFrame", &Tray::SetImageFrame)
       .SetMethod("setToolTip", &Tray::SetToolTip)
       .SetMethod("setTitle", &Tray::SetTitle)
       .SetMethod("getTitle", &Tray::GetTitle)
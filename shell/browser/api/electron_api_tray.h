@@ -91,6 +91,9 @@ class Tray : public gin::Wrappable<Tray>,
   bool IsDestroyed();
   void SetImage(v8::Isolate* isolate, v8::Local<v8::Value> image);
   void SetPressedImage(v8::Isolate* isolate, v8::Local<v8::Value> image);
+  void SetImageFrames(v8::Isolate* isolate,
+                      const std::vector<v8::Local<v8::Value>>& images);
+  void SetImageFrame(gin_helper::ErrorThrower thrower, uint32_t index);
   void SetToolTip(const std::string& tool_tip);
   void SetTitle(const std::string& title,
                 const std::optional<gin_helper::Dictionary>& options,
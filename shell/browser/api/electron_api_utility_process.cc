@@ -24,6 +24,7 @@
 #include "shell/browser/api/message_port.h"
 #include "shell/browser/javascript_environment.h"
 #include "shell/browser/net/system_network_context_manager.h"
+#include "shell/common/api/electron_api_shared_memory.h"
 #include "shell/common/gin_converters/callback_converter.h"
 #include "shell/common/gin_converters/file_path_converter.h"
 #include "shell/common/gin_helper/dictionary.h"
@@ -64,7 +65,10 @@ UtilityProcessWrapper::UtilityProcessWrapper(
     std::map<IOHandle, IOType> stdio,
     base::EnvironmentMap env_map,
     base::FilePath current_working_directory,
-    bool use_plugin_helper) {
+    bool use_plugin_helper,
+    bool fork_from_zygote,
+    base::UnsafeSharedMemoryRegion shared_memory)
+    : shared_memory_(std::move(shared_memory)) {
 #if BUILDFLAG(IS_WIN)
   base::win::ScopedHandle stdout_write(nullptr);
   base::win::ScopedHandle stderr_write(nullptr);
@@ -148,33 +152,42 @@ UtilityProcessWrapper::UtilityProcessWrapper(
   mojo::PendingReceiver<node::mojom::NodeService> receiver =
       node_service_remote_.BindNewPipeAndPassReceiver();
 
-  content::ServiceProcessHost::Launch(
-      std::move(receiver),
-      content::ServiceProcessHost::Options()
-          .WithDisplayName(display_name.empty()
-                               ? std::u16string(u"Node Utility Process")
-                               : display_name)
-          .WithExtraCommandLineSwitches(params->exec_args)
-          .WithCurrentDirectory(current_working_directory)
-          // Inherit parent process environment when there is no custom
-          // environment provided by the user.
-          .WithEnvironment(env_map,
-                           env_map.empty() ? false : true /*clear_environment*/)
+#if BUILDFLAG(IS_LINUX)
+  // The zygote can only fork processes that use the parent's environment,
+  // working directory and stdio.
+  forked_from_zygote_ = fork_from_zygote && env_map.empty() &&
+                        current_working_directory.empty() &&
+                        fds_to_remap.empty();
+#endif
+
+  content::ServiceProcessHost::Options options;
+  options
+      .WithDisplayName(display_name.empty()
+                           ? std::u16string(u"Node Utility Process")
+                           : display_name)
+      .WithExtraCommandLineSwitches(params->exec_args)
+      .WithCurrentDirectory(current_working_directory)
+      // Inherit parent process environment when there is no custom
+      // environment provided by the user.
+      .WithEnvironment(env_map,
+                       env_map.empty() ? false : true /*clear_environment*/)
 #if BUILDFLAG(IS_WIN)
-          .WithStdoutHandle(std::move(stdout_write))
-          .WithStderrHandle(std::move(stderr_write))
+      .WithStdoutHandle(std::move(stdout_write))
+      .WithStderrHandle(std::move(stderr_write))
 #elif BUILDFLAG(IS_POSIX)
-          .WithAdditionalFds(std::move(fds_to_remap))
+      .WithAdditionalFds(std::move(fds_to_remap))
 #endif
 #if BUILDFLAG(IS_MAC)
-          .WithChildFlags(use_plugin_helper
-                              ? content::ChildProcessHost::CHILD_PLUGIN
-                              : content::ChildProcessHost::CHILD_NORMAL)
+      .WithChildFlags(use_plugin_helper
+                          ? content::ChildProcessHost::CHILD_PLUGIN
+                          : content::ChildProcessHost::CHILD_NORMAL)
 #endif
-          .WithProcessCallback(
-              base::BindOnce(&UtilityProcessWrapper::OnServiceProcessLaunched,
-                             weak_factory_.GetWeakPtr()))
-          .Pass());
+      .WithProcessCallback(
+          base::BindOnce(&UtilityProcessWrapper::OnServiceProcessLaunched,
+                         weak_factory_.GetWeakPtr()));
+  if (forked_from_zygote_)
+    options.WithUnsandboxedZygote();
+  content::ServiceProcessHost::Launch(std::move(receiver), options.Pass());
   node_service_remote_.set_disconnect_with_reason_handler(
       base::BindOnce(&UtilityProcessWrapper::OnServiceProcessDisconnected,
                      weak_factory_.GetWeakPtr()));
@@ -210,6 +223,8 @@ UtilityProcessWrapper::UtilityProcessWrapper(
   network_context->CreateHostResolver(
       {}, host_resolver.InitWithNewPipeAndPassReceiver());
   params->host_resolver = std::move(host_resolver);
+  if (shared_memory_.IsValid())
+    params->shared_memory = shared_memory_.Duplicate();
   node_service_remote_->Initialize(std::move(params));
 }
 
@@ -266,22 +281,22 @@ void UtilityProcessWrapper::PostMessage(gin::Arguments* args) {
 
   blink::TransferableMessage transferable_message;
   v8::Local<v8::Value> message_value;
-  if (args->GetNext(&message_value)) {
-    if (!electron::SerializeV8Value(args->isolate(), message_value,
-                                    &transferable_message)) {
-      // SerializeV8Value sets an exception.
-      return;
-    }
-  }
+  bool has_message = args->GetNext(&message_value);
 
   v8::Local<v8::Value> transferables;
   std::vector<gin::Handle<MessagePort>> wrapped_ports;
-  if (args->GetNext(&transferables)) {
-    if (!gin::ConvertFromV8(args->isolate(), transferables, &wrapped_ports)) {
-      gin_helper::ErrorThrower(args->isolate())
-          .ThrowTypeError("Invalid value for transfer");
-      return;
-    }
+  std::vector<v8::Local<v8::ArrayBuffer>> array_buffers;
+  if (args->GetNext(&transferables) &&
+      !MessagePort::ParseTransferables(args->isolate(), transferables,
+                                       &wrapped_ports, &array_buffers)) {
+    return;
+  }
+
+  if (has_message &&
+      !electron::SerializeV8Value(args->isolate(), message_value,
+                                  array_buffers, &transferable_message)) {
+    // SerializeV8Value sets an exception.
+    return;
   }
 
   bool threw_exception = false;
@@ -301,13 +316,13 @@ bool UtilityProcessWrapper::Kill() const {
   base::Process process = base::Process::Open(pid_);
   bool result = process.Terminate(content::RESULT_CODE_NORMAL_EXIT, false);
   // Refs https://bugs.chromium.org/p/chromium/issues/detail?id=818244
-  // Currently utility process is not sandboxed which
-  // means Zygote is not used on linux, refs
+  // Processes forked from the zygote are not our children, the child process
+  // launcher reaps them through content::ZygoteCommunication once they exit.
+  // Otherwise the utility process is not sandboxed, which means the zygote
+  // is not used on linux, refs
   // content::UtilitySandboxedProcessLauncherDelegate::GetZygote.
-  // If sandbox feature is enabled for the utility process, then the
-  // process reap should be signaled through the zygote via
-  // content::ZygoteCommunication::EnsureProcessTerminated.
-  base::EnsureProcessTerminated(std::move(process));
+  if (!forked_from_zygote_)
+    base::EnsureProcessTerminated(std::move(process));
   return result;
 }
 
@@ -318,6 +333,18 @@ v8::Local<v8::Value> UtilityProcessWrapper::GetOSProcessId(
   return gin::ConvertToV8(isolate, pid_);
 }
 
+v8::Local<v8::Value> UtilityProcessWrapper::GetSharedMemory(
+    v8::Isolate* isolate) {
+  if (!shared_memory_object_.IsEmpty())
+    return shared_memory_object_.Get(isolate);
+  if (!shared_memory_.IsValid())
+    return v8::Null(isolate);
+  v8::Local<v8::Value> memory =
+      api::SharedMemory::Create(isolate, shared_memory_.Duplicate()).ToV8();
+  shared_memory_object_.Reset(isolate, memory);
+  return memory;
+}
+
 bool UtilityProcessWrapper::Accept(mojo::Message* mojo_message) {
   blink::TransferableMessage message;
   if (!blink::mojom::TransferableMessage::DeserializeFromMessage(
@@ -328,7 +355,7 @@ bool UtilityProcessWrapper::Accept(mojo::Message* mojo_message) {
   v8::Isolate* isolate = JavascriptEnvironment::GetIsolate();
   v8::HandleScope handle_scope(isolate);
   v8::Local<v8::Value> message_value =
-      electron::DeserializeV8Value(isolate, message);
+      electron::DeserializeV8Value(isolate, &message);
   EmitWithoutEvent("message", message_value);
   return true;
 }
@@ -351,9 +378,11 @@ gin::Handle<UtilityProcessWrapper> UtilityProcessWrapper::Create(
 
   std::u16string display_name;
   bool use_plugin_helper = false;
+  bool fork_from_zygote = false;
   std::map<IOHandle, IOType> stdio;
   base::FilePath current_working_directory;
   base::EnvironmentMap env_map;
+  base::UnsafeSharedMemoryRegion shared_memory;
   node::mojom::NodeServiceParamsPtr params =
       node::mojom::NodeServiceParams::New();
   dict.Get("modulePath", &params->script);
@@ -394,12 +423,33 @@ gin::Handle<UtilityProcessWrapper> UtilityProcessWrapper::Create(
 #if BUILDFLAG(IS_MAC)
     opts.Get("allowLoadingUnsignedLibraries", &use_plugin_helper);
 #endif
+
+#if BUILDFLAG(IS_LINUX)
+    opts.Get("forkFromZygote", &fork_from_zygote);
+#endif
+
+    if (opts.Has("sharedMemorySize")) {
+      uint32_t shared_memory_size = 0;
+      if (!opts.Get("sharedMemorySize", &shared_memory_size) ||
+          shared_memory_size == 0) {
+        args->ThrowTypeError("Invalid value for sharedMemorySize");
+        return gin::Handle<UtilityProcessWrapper>();
+      }
+      shared_memory =
+          base::UnsafeSharedMemoryRegion::Create(shared_memory_size);
+      if (!shared_memory.IsValid()) {
+        gin_helper::ErrorThrower(args->isolate())
+            .ThrowError("Failed to allocate shared memory");
+        return gin::Handle<UtilityProcessWrapper>();
+      }
+    }
   }
   auto handle = gin::CreateHandle(
       args->isolate(),
       new UtilityProcessWrapper(std::move(params), display_name,
                                 std::move(stdio), env_map,
-                                current_working_directory, use_plugin_helper));
+                                current_working_directory, use_plugin_helper,
+                                fork_from_zygote, std::move(shared_memory)));
   handle->Pin(args->isolate());
   return handle;
 }
@@ -411,7 +461,8 @@ gin::ObjectTemplateBuilder UtilityProcessWrapper::GetObjectTemplateBuilder(
              UtilityProcessWrapper>::GetObjectTemplateBuilder(isolate)
       .SetMethod("postMessage", &UtilityProcessWrapper::PostMessage)
       .SetMethod("kill", &UtilityProcessWrapper::Kill)
-      .SetProperty("pid", &UtilityProcessWrapper::GetOSProcessId);
+      .SetProperty("pid", &UtilityProcessWrapper::GetOSProcessId)
+      .SetProperty("sharedMemory", &UtilityProcessWrapper::GetSharedMemory);
 }
 
 const char* UtilityProcessWrapper::GetTypeName() {
@@ -11,6 +11,7 @@
 
 #include "base/containers/id_map.h"
 #include "base/environment.h"
+#include "base/memory/unsafe_shared_memory_region.h"
 #include "base/memory/weak_ptr.h"
 #include "base/process/process_handle.h"
 #include "gin/wrappable.h"
@@ -61,7 +62,9 @@ class UtilityProcessWrapper
                         std::map<IOHandle, IOType> stdio,
                         base::EnvironmentMap env_map,
                         base::FilePath current_working_directory,
-                        bool use_plugin_helper);
+                        bool use_plugin_helper,
+                        bool fork_from_zygote,
+                        base::UnsafeSharedMemoryRegion shared_memory);
   void OnServiceProcessDisconnected(uint32_t error_code,
                                     const std::string& description);
   void OnServiceProcessLaunched(const base::Process& process);
@@ -70,6 +73,7 @@ class UtilityProcessWrapper
   void PostMessage(gin::Arguments* args);
   bool Kill() const;
   v8::Local<v8::Value> GetOSProcessId(v8::Isolate* isolate) const;
+  v8::Local<v8::Value> GetSharedMemory(v8::Isolate* isolate);
 
   // mojo::MessageReceiver
   bool Accept(mojo::Message* mojo_message) override;
@@ -84,9 +88,16 @@ class UtilityProcessWrapper
   int stdout_read_fd_ = -1;
   int stderr_read_fd_ = -1;
   bool connector_closed_ = false;
+  // Whether the process was forked from the unsandboxed zygote, which is then
+  // responsible for reaping it.
+  bool forked_from_zygote_ = false;
   std::unique_ptr<mojo::Connector> connector_;
   blink::MessagePortDescriptor host_port_;
   mojo::Remote<node::mojom::NodeService> node_service_remote_;
+  // Memory shared with the child process, and the SharedMemory object that
+  // is lazily created to expose it.
+  base::UnsafeSharedMemoryRegion shared_memory_;
+  v8::Global<v8::Value> shared_memory_object_;
   base::WeakPtrFactory<UtilityProcessWrapper> weak_factory_{this};
 };
 
@@ -304,6 +304,64 @@ void View::SetVisible(bool visible) {
   view_->SetVisible(visible);
 }
 
+void View::SetChildLayouts(gin_helper::ErrorThrower thrower,
+                           const std::vector<gin_helper::Dictionary>& layouts) {
+  if (!view_)
+    return;
+
+  struct Change {
+    raw_ptr<views::View> child;
+    std::optional<gfx::Rect> bounds;
+    std::optional<bool> visible;
+  };
+
+  // Everything is validated before anything is applied, so a bad entry
+  // leaves the tree untouched.
+  std::vector<Change> changes;
+  changes.reserve(layouts.size());
+  for (const auto& layout : layouts) {
+    gin::Handle<View> child;
+    if (!layout.Get("view", &child) || !child->view() ||
+        child->view()->parent() != view_) {
+      thrower.ThrowError("'view' must be a child of this View");
+      return;
+    }
+    Change& change = changes.emplace_back();
+    change.child = child->view();
+    gfx::Rect bounds;
+    if (layout.Has("bounds")) {
+      if (!layout.Get("bounds", &bounds)) {
+        thrower.ThrowTypeError("'bounds' must be a Rectangle");
+        return;
+      }
+      change.bounds = bounds;
+    }
+    bool visible;
+    if (layout.Has("visible")) {
+      if (!layout.Get("visible", &visible)) {
+        thrower.ThrowTypeError("'visible' must be a boolean");
+        return;
+      }
+      change.visible = visible;
+    }
+  }
+
+#if BUILDFLAG(IS_MAC)
+  ScopedCAActionDisabler disable_animations;
+#endif
+  // Bounds first, so children that become visible are laid out at their new
+  // size, then visibility, which only invalidates the layout of |view_| once
+  // no matter how many children change.
+  for (const auto& change : changes) {
+    if (change.bounds)
+      change.child->SetBoundsRect(*change.bounds);
+  }
+  for (const auto& change : changes) {
+    if (change.visible)
+      change.child->SetVisible(*change.visible);
+  }
+}
+
 void View::OnViewBoundsChanged(views::View* observed_view) {
   Emit("bounds-changed");
 }
@@ -354,7 +412,8 @@ void View::BuildPrototype(v8::Isolate* isolate,
       .SetMethod("getBounds", &View::GetBounds)
       .SetMethod("setBackgroundColor", &View::SetBackgroundColor)
       .SetMethod("setLayout", &View::SetLayout)
-      .SetMethod("setVisible", &View::SetVisible);
+      .SetMethod("setVisible", &View::SetVisible)
+      .SetMethod("setChildLayouts", &View::SetChildLayouts);
 }
 
 }  // namespace electron::api
@@ -6,15 +6,21 @@
 #define ELECTRON_SHELL_BROWSER_API_ELECTRON_API_VIEW_H_
 
 #include <optional>
+#include <vector>
 
 #include "base/memory/raw_ptr.h"
 #include "gin/handle.h"
 #include "shell/common/color_util.h"
+#include "shell/common/gin_helper/error_thrower.h"
 #include "shell/common/gin_helper/event_emitter.h"
 #include "ui/views/view.h"
 #include "ui/views/view_observer.h"
 #include "v8/include/v8-value.h"
 
+namespace gin_helper {
+class Dictionary;
+}
+
 namespace electron::api {
 
 class View : public gin_helper::EventEmitter<View>, public views::ViewObserver {
@@ -37,6 +43,8 @@ class View : public gin_helper::EventEmitter<View>, public views::ViewObserver {
   std::vector<v8::Local<v8::Value>> GetChildren();
   void SetBackgroundColor(std::optional<WrappedSkColor> color);
   void SetVisible(bool visible);
+  void SetChildLayouts(gin_helper::ErrorThrower thrower,
+                       const std::vector<gin_helper::Dictionary>& layouts);
 
   // views::ViewObserver
   void OnViewBoundsChanged(views::View* observed_view) override;
@@ -5,21 +5,33 @@
 #include "shell/browser/api/electron_api_web_contents.h"
 
 #include <limits>
+#include <map>
 #include <memory>
 #include <optional>
 #include <set>
 #include <string>
 #include <string_view>
 #include <utility>
+#include <variant>
 #include <vector>
 
+#include "base/auto_reset.h"
+#include "base/barrier_callback.h"
+#include "base/barrier_closure.h"
 #include "base/containers/contains.h"
 #include "base/containers/fixed_flat_map.h"
+#include "base/containers/flat_map.h"
 #include "base/containers/id_map.h"
+#include "base/containers/span.h"
 #include "base/files/file_util.h"
+#include "base/functional/callback_helpers.h"
 #include "base/json/json_reader.h"
 #include "base/no_destructor.h"
+#include "base/process/process_metrics.h"
+#include "base/ranges/algorithm.h"
+#include "base/strings/string_number_conversions.h"
 #include "base/strings/utf_string_conversions.h"
+#include "base/system/sys_info.h"
 #include "base/task/current_thread.h"
 #include "base/task/thread_pool.h"
 #include "base/threading/scoped_blocking_call.h"
@@ -39,6 +51,9 @@
 #include "content/browser/renderer_host/render_frame_host_manager.h"  // nogncheck
 #include "content/browser/renderer_host/render_widget_host_impl.h"  // nogncheck
 #include "content/browser/renderer_host/render_widget_host_view_base.h"  // nogncheck
+#include "content/public/browser/browser_child_process_host.h"
+#include "content/public/browser/browser_task_traits.h"
+#include "content/public/browser/browser_thread.h"
 #include "content/public/browser/child_process_security_policy.h"
 #include "content/public/browser/context_menu_params.h"
 #include "content/public/browser/desktop_media_id.h"
@@ -49,6 +64,8 @@
 #include "content/public/browser/navigation_details.h"
 #include "content/public/browser/navigation_entry.h"
 #include "content/public/browser/navigation_handle.h"
+#include "content/public/browser/preloading.h"
+#include "content/public/browser/prerender_handle.h"
 #include "content/public/browser/render_frame_host.h"
 #include "content/public/browser/render_process_host.h"
 #include "content/public/browser/render_view_host.h"
@@ -69,8 +86,13 @@
 #include "gin/handle.h"
 #include "gin/object_template_builder.h"
 #include "gin/wrappable.h"
+#include "media/base/limits.h"
 #include "media/base/mime_util.h"
+#include "media/base/video_types.h"
 #include "mojo/public/cpp/bindings/associated_remote.h"
+#include "mojo/public/cpp/bindings/callback_helpers.h"
+#include "mojo/public/cpp/bindings/clone_traits.h"
+#include "mojo/public/cpp/bindings/equals_traits.h"
 #include "mojo/public/cpp/bindings/pending_receiver.h"
 #include "mojo/public/cpp/bindings/remote.h"
 #include "mojo/public/cpp/system/platform_handle.h"
@@ -82,6 +104,7 @@
 #include "shell/browser/api/electron_api_debugger.h"
 #include "shell/browser/api/electron_api_session.h"
 #include "shell/browser/api/electron_api_web_frame_main.h"
+#include "shell/browser/api/frame_encoder.h"
 #include "shell/browser/api/message_port.h"
 #include "shell/browser/browser.h"
 #include "shell/browser/child_web_contents_tracker.h"
@@ -92,9 +115,12 @@
 #include "shell/browser/electron_navigation_throttle.h"
 #include "shell/browser/file_select_helper.h"
 #include "shell/browser/native_window.h"
+#include "shell/browser/osr/osr_paint_event.h"
 #include "shell/browser/osr/osr_render_widget_host_view.h"
 #include "shell/browser/osr/osr_web_contents_view.h"
+#include "shell/browser/power_saving_policy.h"
 #include "shell/browser/session_preferences.h"
+#include "shell/browser/startup_timeline.h"
 #include "shell/browser/ui/drag_util.h"
 #include "shell/browser/ui/file_dialog.h"
 #include "shell/browser/ui/inspectable_web_contents.h"
@@ -107,6 +133,7 @@
 #include "shell/common/api/electron_api_native_image.h"
 #include "shell/common/api/electron_bindings.h"
 #include "shell/common/color_util.h"
+#include "shell/common/crash_keys.h"
 #include "shell/common/electron_constants.h"
 #include "shell/common/gin_converters/base_converter.h"
 #include "shell/common/gin_converters/blink_converter.h"
@@ -135,12 +162,15 @@
 #include "third_party/blink/public/common/page/page_zoom.h"
 #include "third_party/blink/public/mojom/frame/find_in_page.mojom.h"
 #include "third_party/blink/public/mojom/frame/fullscreen.mojom.h"
+#include "third_party/blink/public/mojom/loader/resource_load_info.mojom.h"
 #include "third_party/blink/public/mojom/messaging/transferable_message.mojom.h"
+#include "third_party/blink/public/mojom/page/draggable_region.mojom.h"
 #include "third_party/blink/public/mojom/renderer_preferences.mojom.h"
 #include "ui/base/cursor/cursor.h"
 #include "ui/base/cursor/mojom/cursor_type.mojom-shared.h"
 #include "ui/display/screen.h"
 #include "ui/events/base_event_utils.h"
+#include "url/origin.h"
 
 #if BUILDFLAG(IS_WIN)
 #include "shell/browser/native_window_views.h"
@@ -616,6 +646,15 @@ void AppendToFile(const base::FilePath& path, const std::string& content) {
   base::AppendToFile(path, content);
 }
 
+#if BUILDFLAG(ENABLE_PRINTING)
+bool WritePDFToFile(const base::FilePath& path,
+                    scoped_refptr<base::RefCountedMemory> data) {
+  base::ScopedBlockingCall scoped_blocking_call(FROM_HERE,
+                                                base::BlockingType::WILL_BLOCK);
+  return base::WriteFile(path, base::make_span(data->front(), data->size()));
+}
+#endif
+
 PrefService* GetPrefService(content::WebContents* web_contents) {
   auto* context = web_contents->GetBrowserContext();
   return static_cast<electron::ElectronBrowserContext*>(context)->prefs();
@@ -657,8 +696,172 @@ content::RenderFrameHost* GetRenderFrameHost(
 
   return frame_host;
 }
+
+v8::Local<v8::Value> ToHandleBuffer(v8::Isolate* isolate,
+                                    void* handle,
+                                    size_t size) {
+  auto buffer =
+      node::Buffer::Copy(isolate, reinterpret_cast<char*>(handle), size);
+  if (buffer.IsEmpty())
+    return v8::Null(isolate);
+  return buffer.ToLocalChecked();
+}
+
+v8::Local<v8::Value> CreateOffscreenSharedTexture(
+    v8::Isolate* isolate,
+    std::unique_ptr<OffscreenSharedTexture> texture) {
+  auto handle = gin_helper::Dictionary::CreateEmpty(isolate);
+#if BUILDFLAG(IS_WIN)
+  HANDLE nt_handle = texture->handle.dxgi_handle.Get();
+  handle.Set("ntHandle", ToHandleBuffer(isolate, &nt_handle, sizeof(HANDLE)));
+#elif BUILDFLAG(IS_MAC)
+  IOSurfaceRef io_surface = texture->handle.io_surface.get();
+  handle.Set("ioSurface",
+             ToHandleBuffer(isolate, &io_surface, sizeof(IOSurfaceRef)));
+#elif BUILDFLAG(IS_LINUX)
+  const gfx::NativePixmapHandle& native_pixmap =
+      texture->handle.native_pixmap_handle;
+  std::vector<v8::Local<v8::Value>> planes;
+  for (const auto& plane : native_pixmap.planes) {
+    auto plane_info = gin_helper::Dictionary::CreateEmpty(isolate);
+    plane_info.Set("stride", plane.stride);
+    plane_info.Set("offset", static_cast<double>(plane.offset));
+    plane_info.Set("size", static_cast<double>(plane.size));
+    plane_info.Set("fd", plane.fd.get());
+    planes.push_back(plane_info.GetHandle());
+  }
+  auto native_pixmap_info = gin_helper::Dictionary::CreateEmpty(isolate);
+  native_pixmap_info.Set("planes", planes);
+  native_pixmap_info.Set("modifier",
+                         base::NumberToString(native_pixmap.modifier));
+  handle.Set("nativePixmap", native_pixmap_info);
+#endif
+
+  auto texture_info = gin_helper::Dictionary::CreateEmpty(isolate);
+  texture_info.Set("pixelFormat",
+                   texture->pixel_format == media::PIXEL_FORMAT_ABGR ? "rgba"
+                                                                     : "bgra");
+  texture_info.Set("codedSize", texture->coded_size);
+  texture_info.Set("visibleRect", texture->visible_rect);
+  texture_info.Set("contentRect", texture->content_rect);
+  texture_info.Set("timestamp",
+                   static_cast<double>(texture->timestamp.InMicroseconds()));
+  texture_info.Set("handle", handle);
+
+  auto result = gin_helper::Dictionary::CreateEmpty(isolate);
+  result.Set("textureInfo", texture_info);
+  // The frame goes back to the capturer once |texture| is destroyed, either by
+  // calling release() or when the function is garbage collected.
+  result.Set("release",
+             base::BindOnce([](std::unique_ptr<OffscreenSharedTexture>) {},
+                            std::move(texture)));
+  return result.GetHandle();
+}
+
+// The frames of one renderer process that a script runs in with a single
+// message, and their results.
+struct FrameScriptBatch {
+  // Positions of the frames in the frames passed by the caller.
+  std::vector<size_t> indices;
+  std::vector<mojom::FrameScriptResultPtr> results;
+};
+
+void ResolveFrameScriptResults(
+    gin_helper::Promise<v8::Local<v8::Value>> promise,
+    const std::vector<content::GlobalRenderFrameHostId>& frame_ids,
+    std::vector<FrameScriptBatch> batches) {
+  std::vector<mojom::FrameScriptResultPtr> results(frame_ids.size());
+  for (auto& batch : batches) {
+    // A renderer that went away replies with no results.
+    if (batch.results.size() != batch.indices.size())
+      continue;
+    for (size_t i = 0; i < batch.indices.size(); ++i)
+      results[batch.indices[i]] = std::move(batch.results[i]);
+  }
+
+  v8::Isolate* isolate = promise.isolate();
+  v8::HandleScope handle_scope(isolate);
+  v8::Context::Scope context_scope(promise.GetContext());
+  std::vector<v8::Local<v8::Value>> entries;
+  entries.reserve(results.size());
+  for (size_t i = 0; i < results.size(); ++i) {
+    auto entry = gin_helper::Dictionary::CreateEmpty(isolate);
+    entry.Set("frame", content::RenderFrameHost::FromID(frame_ids[i]));
+    const auto& result = results[i];
+    if (result && result->value) {
+      entry.Set("result", DeserializeV8Value(isolate, *result->value));
+    } else {
+      const std::string error =
+          result ? result->error
+                 : "Render frame was disposed before the script could run";
+      entry.Set("error", v8::Exception::Error(gin::StringToV8(isolate, error)));
+    }
+    entries.push_back(entry.GetHandle());
+  }
+  promise.Resolve(gin::ConvertToV8(isolate, entries));
+}
+
+using ConvertedInputEvent = std::variant<blink::WebMouseEvent,
+                                         blink::WebMouseWheelEvent,
+                                         content::NativeWebKeyboardEvent>;
+
+std::optional<ConvertedInputEvent> ConvertInputEvent(
+    v8::Isolate* isolate,
+    v8::Local<v8::Value> input_event) {
+  blink::WebInputEvent::Type type =
+      gin::GetWebInputEventType(isolate, input_event);
+  if (blink::WebInputEvent::IsMouseEventType(type)) {
+    blink::WebMouseEvent mouse_event;
+    if (gin::ConvertFromV8(isolate, input_event, &mouse_event))
+      return mouse_event;
+  } else if (blink::WebInputEvent::IsKeyboardEventType(type)) {
+    content::NativeWebKeyboardEvent keyboard_event(
+        blink::WebKeyboardEvent::Type::kRawKeyDown,
+        blink::WebInputEvent::Modifiers::kNoModifiers, ui::EventTimeForNow());
+    if (gin::ConvertFromV8(isolate, input_event, &keyboard_event)) {
+      // For backwards compatibility, convert `kKeyDown` to `kRawKeyDown`.
+      if (keyboard_event.GetType() == blink::WebKeyboardEvent::Type::kKeyDown)
+        keyboard_event.SetType(blink::WebKeyboardEvent::Type::kRawKeyDown);
+      return keyboard_event;
+    }
+  } else if (type == blink::WebInputEvent::Type::kMouseWheel) {
+    blink::WebMouseWheelEvent mouse_wheel_event;
+    if (gin::ConvertFromV8(isolate, input_event, &mouse_wheel_event))
+      return mouse_wheel_event;
+  }
+  return std::nullopt;
+}
+
+// Pages being prerendered are not shown to the app until they are activated,
+// so their navigation and load events are not emitted either.
+bool IsPrerendering(content::RenderFrameHost* render_frame_host) {
+  return render_frame_host &&
+         render_frame_host->GetLifecycleState() ==
+             content::RenderFrameHost::LifecycleState::kPrerendering;
+}
+
+bool IsPrerendering(content::NavigationHandle* navigation_handle) {
+  return navigation_handle->IsInPrerenderedMainFrame() ||
+         IsPrerendering(navigation_handle->GetParentFrameOrOuterDocument());
+}
+
 }  // namespace
 
+struct WebContents::PendingInputEvent {
+  ConvertedInputEvent event;
+  // When to send the event, relative to the start of its batch.
+  base::TimeDelta offset;
+};
+
+struct WebContents::InputEventBatch {
+  explicit InputEventBatch(v8::Isolate* isolate) : promise(isolate) {}
+
+  gin_helper::Promise<void> promise;
+  base::TimeTicks start;
+  std::vector<PendingInputEvent> events;
+  size_t next = 0;
+};
+
 #if BUILDFLAG(ENABLE_ELECTRON_EXTENSIONS)
 
 WebContents::Type GetTypeFromViewType(extensions::mojom::ViewType view_type) {
@@ -741,7 +944,16 @@ WebContents::WebContents(v8::Isolate* isolate,
 #endif
 {
   // Read options.
-  options.Get("backgroundThrottling", &background_throttling_);
+  bool background_throttling = true;
+  if (options.Get("backgroundThrottling", &background_throttling) &&
+      !background_throttling) {
+    background_throttling_.timers = false;
+    background_throttling_.rendering =
+        BackgroundThrottlingPolicy::Rendering::kFull;
+  }
+  int background_purge_delay = 0;
+  if (options.Get("backgroundMemoryPurgeDelay", &background_purge_delay))
+    background_purge_delay_ = base::Milliseconds(background_purge_delay);
 
   // Get type
   options.Get("type", &type_);
@@ -750,8 +962,14 @@ WebContents::WebContents(v8::Isolate* isolate,
   options.Get("transparent", &guest_transparent_);
 
   bool b = false;
-  if (options.Get(options::kOffscreen, &b) && b)
+  gin_helper::Dictionary offscreen_options;
+  if (options.Get(options::kOffscreen, &offscreen_options)) {
     type_ = Type::kOffScreen;
+    offscreen_options.Get(options::kUseSharedTexture,
+                          &offscreen_use_shared_texture_);
+  } else if (options.Get(options::kOffscreen, &b) && b) {
+    type_ = Type::kOffScreen;
+  }
 
   // Init embedder earlier
   options.Get("embedder", &embedder_);
@@ -787,7 +1005,7 @@ WebContents::WebContents(v8::Isolate* isolate,
 
     if (embedder_ && embedder_->IsOffScreen()) {
       auto* view = new OffScreenWebContentsView(
-          false,
+          false, false,
           base::BindRepeating(&WebContents::OnPaint, base::Unretained(this)));
       params.view = view;
       params.delegate_view = view;
@@ -807,7 +1025,7 @@ WebContents::WebContents(v8::Isolate* isolate,
 
     content::WebContents::CreateParams params(session->browser_context());
     auto* view = new OffScreenWebContentsView(
-        transparent,
+        transparent, offscreen_use_shared_texture_,
         base::BindRepeating(&WebContents::OnPaint, base::Unretained(this)));
     params.view = view;
     params.delegate_view = view;
@@ -821,6 +1039,11 @@ WebContents::WebContents(v8::Isolate* isolate,
   }
 
   InitWithSessionAndOptions(isolate, std::move(web_contents), session, options);
+
+  // Offscreen rendering starts at the default frame rate, which may be above
+  // the power saving cap.
+  if (PowerSavingPolicy::Get()->is_active())
+    UpdatePowerSaving();
 }
 
 void WebContents::InitZoomController(content::WebContents* web_contents,
@@ -1030,8 +1253,32 @@ void WebContents::Destroy() {
 
 void WebContents::Close(std::optional<gin_helper::Dictionary> options) {
   bool dispatch_beforeunload = false;
-  if (options)
+  bool include_children = false;
+  if (options) {
     options->Get("waitForBeforeUnload", &dispatch_beforeunload);
+    options->Get("includeChildren", &include_children);
+  }
+
+  if (include_children) {
+    // Closing a window can destroy others synchronously, e.g. child windows
+    // that do not outlive their opener.
+    std::vector<base::WeakPtr<WebContents>> children;
+    for (WebContents* child : GetChildWebContents(true))
+      children.push_back(child->GetWeakPtr());
+    base::WeakPtr<WebContents> weak_this = GetWeakPtr();
+    // The deepest windows are closed first.
+    for (auto it = children.rbegin(); it != children.rend(); ++it) {
+      if (*it && (*it)->web_contents())
+        (*it)->ClosePage(dispatch_beforeunload);
+    }
+    if (!weak_this || !web_contents())
+      return;
+  }
+
+  ClosePage(dispatch_beforeunload);
+}
+
+void WebContents::ClosePage(bool dispatch_beforeunload) {
   if (dispatch_beforeunload &&
       web_contents()->NeedToFireBeforeUnloadOrUnloadEvents()) {
     NotifyUserActivation();
@@ -1075,6 +1322,7 @@ void WebContents::WebContentsCreatedWithFullParams(
   tracker->referrer = params.referrer.To<content::Referrer>();
   tracker->raw_features = params.raw_features;
   tracker->body = params.body;
+  tracker->opener_id = ID();
 
   v8::Isolate* isolate = JavascriptEnvironment::GetIsolate();
   v8::HandleScope handle_scope(isolate);
@@ -1588,13 +1836,16 @@ void WebContents::HandleNewRenderFrame(
   if (web_preferences)
     SetBackgroundColor(web_preferences->GetBackgroundColor());
 
-  if (!background_throttling_)
+  BackgroundThrottlingPolicy background_throttling =
+      GetEffectiveBackgroundThrottlingPolicy();
+  if (!background_throttling.timers)
     render_frame_host->GetRenderViewHost()->SetSchedulerThrottling(false);
 
   auto* rwh_impl =
       static_cast<content::RenderWidgetHostImpl*>(rwhv->GetRenderWidgetHost());
   if (rwh_impl)
-    rwh_impl->disable_hidden_ = !background_throttling_;
+    rwh_impl->disable_hidden_ = background_throttling.rendering !=
+                                BackgroundThrottlingPolicy::Rendering::kStop;
 
   auto* web_frame = WebFrameMain::FromRenderFrameHost(render_frame_host);
   if (web_frame)
@@ -1760,13 +2011,17 @@ void WebContents::DOMContentLoaded(
   if (web_frame)
     web_frame->DOMContentLoaded();
 
-  if (!render_frame_host->GetParent())
+  if (!render_frame_host->GetParent() && !IsPrerendering(render_frame_host))
     Emit("dom-ready");
 }
 
 void WebContents::DidFinishLoad(content::RenderFrameHost* render_frame_host,
                                 const GURL& validated_url) {
+  if (IsPrerendering(render_frame_host))
+    return;
   bool is_main_frame = !render_frame_host->GetParent();
+  if (is_main_frame && owner_window())
+    startup_timeline::Record(startup_timeline::Phase::kFirstWindowLoad);
   int frame_process_id = render_frame_host->GetProcess()->GetID();
   int frame_routing_id = render_frame_host->GetRoutingID();
   auto weak_this = GetWeakPtr();
@@ -1792,6 +2047,8 @@ void WebContents::DidFailLoad(content::RenderFrameHost* render_frame_host,
       media::IsSupportedMediaMimeType(web_contents()->GetContentsMimeType());
   if (error_code == net::ERR_ABORTED && is_media_document)
     return;
+  if (IsPrerendering(render_frame_host))
+    return;
 
   bool is_main_frame = !render_frame_host->GetParent();
   int frame_process_id = render_frame_host->GetProcess()->GetID();
@@ -1804,6 +2061,13 @@ void WebContents::DidStartLoading() {
   Emit("did-start-loading");
 }
 
+void WebContents::DidFirstVisuallyNonEmptyPaint() {
+  if (owner_window()) {
+    startup_timeline::Record(startup_timeline::Phase::kFirstWindowPaint);
+    ElectronBrowserMainParts::Get()->OnFirstWindowPaint();
+  }
+}
+
 void WebContents::DidStopLoading() {
   auto* web_preferences = WebContentsPreferences::From(web_contents());
   if (web_preferences && web_preferences->ShouldUsePreferredSizeMode())
@@ -1815,6 +2079,8 @@ void WebContents::DidStopLoading() {
 bool WebContents::EmitNavigationEvent(
     const std::string& event_name,
     content::NavigationHandle* navigation_handle) {
+  if (IsPrerendering(navigation_handle))
+    return false;
   bool is_main_frame = navigation_handle->IsInMainFrame();
   int frame_process_id = -1, frame_routing_id = -1;
   content::RenderFrameHost* frame_host = GetRenderFrameHost(navigation_handle);
@@ -1851,9 +2117,113 @@ bool WebContents::EmitNavigationEvent(
   return event->GetDefaultPrevented();
 }
 
+WebContents::NavigationRule::NavigationRule() = default;
+WebContents::NavigationRule::NavigationRule(NavigationRule&&) = default;
+WebContents::NavigationRule& WebContents::NavigationRule::operator=(
+    NavigationRule&&) = default;
+WebContents::NavigationRule::~NavigationRule() = default;
+
+void WebContents::SetNavigationRules(gin::Arguments* args) {
+  std::vector<gin_helper::Dictionary> rule_dicts;
+  v8::Local<v8::Value> arg;
+  if (!args->GetNext(&arg) ||
+      !(arg->IsNull() ||
+        gin::ConvertFromV8(args->isolate(), arg, &rule_dicts))) {
+    args->ThrowTypeError("Must pass null or an Array of rules");
+    return;
+  }
+
+  static constexpr auto Actions =
+      base::MakeFixedFlatMap<std::string_view, NavigationRule::Action>({
+          {"allow", NavigationRule::Action::kAllow},
+          {"ask", NavigationRule::Action::kAsk},
+          {"deny", NavigationRule::Action::kDeny},
+          {"openExternally", NavigationRule::Action::kOpenExternally},
+      });
+
+  std::vector<NavigationRule> rules;
+  rules.reserve(rule_dicts.size());
+  for (size_t i = 0; i < rule_dicts.size(); ++i) {
+    const std::string prefix =
+        "Invalid rule at index " + base::NumberToString(i) + ": ";
+    NavigationRule rule;
+
+    std::string action;
+    if (!rule_dicts[i].Get("action", &action)) {
+      args->ThrowTypeError(prefix + "'action' is required");
+      return;
+    }
+    const auto iter = Actions.find(action);
+    if (iter == Actions.end()) {
+      args->ThrowTypeError(prefix + "Invalid action " + action);
+      return;
+    }
+    rule.action = iter->second;
+
+    gin_helper::Dictionary condition;
+    if (rule_dicts[i].Get("condition", &condition)) {
+      for (auto [name, patterns] :
+           {std::make_pair("urls", &rule.url_patterns),
+            std::make_pair("initiatorOrigins",
+                           &rule.initiator_origin_patterns)}) {
+        std::vector<std::string> pattern_strings;
+        condition.Get(name, &pattern_strings);
+        for (const std::string& pattern_string : pattern_strings) {
+          URLPattern pattern(URLPattern::SCHEME_ALL);
+          const URLPattern::ParseResult result = pattern.Parse(pattern_string);
+          if (result != URLPattern::ParseResult::kSuccess) {
+            args->ThrowTypeError(prefix + "Invalid url pattern " +
+                                 pattern_string + ": " +
+                                 URLPattern::GetParseResultString(result));
+            return;
+          }
+          patterns->push_back(std::move(pattern));
+        }
+      }
+      bool is_main_frame;
+      if (condition.Get("isMainFrame", &is_main_frame))
+        rule.is_main_frame = is_main_frame;
+    }
+
+    rules.push_back(std::move(rule));
+  }
+
+  navigation_rules_ = std::move(rules);
+}
+
+WebContents::NavigationRule::Action WebContents::GetNavigationRuleAction(
+    content::NavigationHandle* navigation_handle) const {
+  if (navigation_rules_.empty())
+    return NavigationRule::Action::kAsk;
+
+  const GURL& url = navigation_handle->GetURL();
+  // Opaque and missing initiators match only rules without initiator
+  // patterns, since their URL is empty.
+  const std::optional<url::Origin>& initiator =
+      navigation_handle->GetInitiatorOrigin();
+  const GURL initiator_url = initiator ? initiator->GetURL() : GURL();
+  const bool is_main_frame = navigation_handle->IsInMainFrame();
+
+  const auto matches = [](const std::vector<URLPattern>& patterns,
+                          const GURL& url) {
+    return patterns.empty() ||
+           base::ranges::any_of(patterns, [&url](const URLPattern& pattern) {
+             return pattern.MatchesURL(url);
+           });
+  };
+  for (const auto& rule : navigation_rules_) {
+    if (rule.is_main_frame && *rule.is_main_frame != is_main_frame)
+      continue;
+    if (matches(rule.url_patterns, url) &&
+        matches(rule.initiator_origin_patterns, initiator_url))
+      return rule.action;
+  }
+  return NavigationRule::Action::kAsk;
+}
+
 void WebContents::Message(bool internal,
                           const std::string& channel,
-                          blink::CloneableMessage arguments,
+                          blink::TransferableMessage arguments,
                           content::RenderFrameHost* render_frame_host) {
   TRACE_EVENT1("electron", "WebContents::Message", "channel", channel);
   // webContents.emit('-ipc-message', new Event(), internal, channel,
@@ -1863,10 +2233,41 @@ void WebContents::Message(bool internal,
                  channel, std::move(arguments));
 }
 
+void WebContents::MessageBatch(
+    std::vector<electron::mojom::BatchedMessagePtr> messages,
+    content::RenderFrameHost* render_frame_host) {
+  TRACE_EVENT1("electron", "WebContents::MessageBatch", "count",
+               messages.size());
+  v8::Isolate* isolate = JavascriptEnvironment::GetIsolate();
+  v8::HandleScope handle_scope(isolate);
+  v8::Local<v8::Context> context = isolate->GetCurrentContext();
+
+  // Each message gets its own event, but all of them are handed to JS in a
+  // single emit so the main process is only entered once per batch.
+  // webContents.emit('-ipc-message-batch', [[event, internal, channel,
+  // arguments], ...]);
+  v8::Local<v8::Array> batch = v8::Array::New(isolate, messages.size());
+  for (size_t i = 0; i < messages.size(); ++i) {
+    gin::Handle<gin_helper::internal::Event> event = MakeEventWithSender(
+        isolate, render_frame_host,
+        electron::mojom::ElectronApiIPC::InvokeCallback());
+    if (event.IsEmpty())
+      return;
+    v8::Local<v8::Value> entry[] = {
+        event.ToV8(), gin::ConvertToV8(isolate, messages[i]->internal),
+        gin::StringToV8(isolate, messages[i]->channel),
+        gin::ConvertToV8(isolate, messages[i]->arguments)};
+    batch
+        ->Set(context, i, v8::Array::New(isolate, entry, std::size(entry)))
+        .Check();
+  }
+  EmitWithoutEvent("-ipc-message-batch", batch);
+}
+
 void WebContents::Invoke(
     bool internal,
     const std::string& channel,
-    blink::CloneableMessage arguments,
+    blink::TransferableMessage arguments,
     electron::mojom::ElectronApiIPC::InvokeCallback callback,
     content::RenderFrameHost* render_frame_host) {
   TRACE_EVENT1("electron", "WebContents::Invoke", "channel", channel);
@@ -1973,7 +2374,7 @@ void WebContents::ReceivePostMessage(
   auto wrapped_ports =
       MessagePort::EntanglePorts(isolate, std::move(message.ports));
   v8::Local<v8::Value> message_value =
-      electron::DeserializeV8Value(isolate, message);
+      electron::DeserializeV8Value(isolate, &message);
   EmitWithSender("-ipc-ports", render_frame_host,
                  electron::mojom::ElectronApiIPC::InvokeCallback(), false,
                  channel, message_value, std::move(wrapped_ports));
@@ -1982,7 +2383,7 @@ void WebContents::ReceivePostMessage(
 void WebContents::MessageSync(
     bool internal,
     const std::string& channel,
-    blink::CloneableMessage arguments,
+    blink::TransferableMessage arguments,
     electron::mojom::ElectronApiIPC::MessageSyncCallback callback,
     content::RenderFrameHost* render_frame_host) {
   TRACE_EVENT1("electron", "WebContents::MessageSync", "channel", channel);
@@ -2009,11 +2410,21 @@ void WebContents::DraggableRegionsChanged(
     return;
   }
 
+  // Blink sends the regions again after every layout, even when they did not
+  // change, e.g. for most of the frames of a window resize.
+  if (draggable_region_ && mojo::Equals(regions, draggable_regions_))
+    return;
+
+  draggable_regions_ = mojo::Clone(regions);
   draggable_region_ = DraggableRegionsToSkRegion(regions);
 }
 
 void WebContents::DidStartNavigation(
     content::NavigationHandle* navigation_handle) {
+  // Only the origin is kept, paths and queries can carry user data.
+  crash_keys::RecordBreadcrumb(
+      crash_keys::BreadcrumbKind::kUrl,
+      url::Origin::Create(navigation_handle->GetURL()).Serialize());
   EmitNavigationEvent("did-start-navigation", navigation_handle);
 }
 
@@ -2035,7 +2446,7 @@ void WebContents::ReadyToCommitNavigation(
     return;
 #endif
   // Don't focus content after subframe navigations.
-  if (!navigation_handle->IsInMainFrame())
+  if (!navigation_handle->IsInMainFrame() || IsPrerendering(navigation_handle))
     return;
   // Only focus for top-level contents.
   if (type_ != Type::kBrowserWindow)
@@ -2045,6 +2456,9 @@ void WebContents::ReadyToCommitNavigation(
 
 void WebContents::DidFinishNavigation(
     content::NavigationHandle* navigation_handle) {
+  if (IsPrerendering(navigation_handle))
+    return;
+
   if (owner_window_) {
     owner_window_->NotifyLayoutWindowControlsOverlay();
   }
@@ -2112,6 +2526,28 @@ void WebContents::DidFinishNavigation(
   // proceed with setting the new title
   if (entry && (entry->GetTransitionType() & ui::PAGE_TRANSITION_FORWARD_BACK))
     WebContents::TitleWasSet(entry);
+
+  // The page may have finished loading while it was prerendered, in which
+  // case its load events were held back until now.
+  if (navigation_handle->IsPrerenderedPageActivation() && frame_host) {
+    auto weak_this = GetWeakPtr();
+    if (frame_host->IsDOMContentLoaded())
+      Emit("dom-ready");
+    if (!weak_this || !web_contents() ||
+        !web_contents()->IsDocumentOnLoadCompletedInPrimaryMainFrame())
+      return;
+    Emit("did-frame-finish-load", true, frame_process_id, frame_routing_id);
+    if (weak_this && web_contents())
+      Emit("did-finish-load");
+  }
+}
+
+void WebContents::ResourceLoadComplete(
+    content::RenderFrameHost* render_frame_host,
+    const content::GlobalRequestID& request_id,
+    const blink::mojom::ResourceLoadInfo& resource_load_info) {
+  network_bytes_received_ += resource_load_info.total_received_bytes;
+  ++network_request_count_;
 }
 
 void WebContents::TitleWasSet(content::NavigationEntry* entry) {
@@ -2257,17 +2693,145 @@ void WebContents::NavigationEntryCommitted(
        details.is_same_document, details.did_replace_entry);
 }
 
+void WebContents::UpdatePowerSaving() {
+  ApplyBackgroundThrottlingPolicy();
+
+  auto* osr_wcv = GetOffScreenWebContentsView();
+  if (!osr_wcv)
+    return;
+  int frame_rate =
+      uncapped_frame_rate_ ? uncapped_frame_rate_ : osr_wcv->GetFrameRate();
+  SetFrameRate(frame_rate);
+}
+
 bool WebContents::GetBackgroundThrottling() const {
-  return background_throttling_;
+  return GetEffectiveBackgroundThrottlingPolicy().rendering !=
+         BackgroundThrottlingPolicy::Rendering::kFull;
 }
 
 void WebContents::SetBackgroundThrottling(bool allowed) {
-  background_throttling_ = allowed;
+  background_throttling_.timers = allowed;
+  background_throttling_.rendering =
+      allowed ? BackgroundThrottlingPolicy::Rendering::kStop
+              : BackgroundThrottlingPolicy::Rendering::kFull;
+  ApplyBackgroundThrottlingPolicy();
+}
+
+v8::Local<v8::Value> WebContents::GetBackgroundThrottlingPolicy(
+    v8::Isolate* isolate) const {
+  auto dict = gin_helper::Dictionary::CreateEmpty(isolate);
+  dict.Set("timers", background_throttling_.timers);
+  switch (background_throttling_.rendering) {
+    case BackgroundThrottlingPolicy::Rendering::kStop:
+      dict.Set("rendering", "stop");
+      break;
+    case BackgroundThrottlingPolicy::Rendering::kThrottle:
+      dict.Set("rendering", "throttle");
+      break;
+    case BackgroundThrottlingPolicy::Rendering::kFull:
+      dict.Set("rendering", "full");
+      break;
+  }
+  dict.Set("freezeAfter", background_throttling_.freeze_delay.InMilliseconds());
+  return dict.GetHandle();
+}
+
+void WebContents::SetBackgroundThrottlingPolicy(gin::Arguments* args) {
+  gin_helper::Dictionary options;
+  if (!args->GetNext(&options)) {
+    gin_helper::ErrorThrower(args->isolate())
+        .ThrowTypeError("Expected an object");
+    return;
+  }
+
+  std::optional<bool> timers;
+  if (options.Has("timers")) {
+    bool value;
+    if (!options.Get("timers", &value)) {
+      gin_helper::ErrorThrower(args->isolate())
+          .ThrowTypeError("'timers' must be a boolean");
+      return;
+    }
+    timers = value;
+  }
+
+  std::optional<BackgroundThrottlingPolicy::Rendering> rendering;
+  if (options.Has("rendering")) {
+    std::string value;
+    options.Get("rendering", &value);
+    if (value == "stop") {
+      rendering = BackgroundThrottlingPolicy::Rendering::kStop;
+    } else if (value == "throttle") {
+      rendering = BackgroundThrottlingPolicy::Rendering::kThrottle;
+    } else if (value == "full") {
+      rendering = BackgroundThrottlingPolicy::Rendering::kFull;
+    } else {
+      gin_helper::ErrorThrower(args->isolate())
+          .ThrowTypeError(
+              "'rendering' must be one of 'stop', 'throttle' or 'full'");
+      return;
+    }
+  }
+
+  std::optional<base::TimeDelta> freeze_delay;
+  if (options.Has("freezeAfter")) {
+    int64_t freeze_after = -1;
+    if (!options.Get("freezeAfter", &freeze_after) || freeze_after < 0) {
+      gin_helper::ErrorThrower(args->isolate())
+          .ThrowTypeError("'freezeAfter' must be a non-negative number");
+      return;
+    }
+    freeze_delay = base::Milliseconds(freeze_after);
+  }
+
+  bool include_children = false;
+  options.Get("includeChildren", &include_children);
+
+  std::vector<WebContents*> targets = {this};
+  if (include_children) {
+    for (WebContents* child : GetChildWebContents(true))
+      targets.push_back(child);
+  }
 
+  // Each WebContents keeps its own value for the options that are omitted.
+  for (WebContents* target : targets) {
+    BackgroundThrottlingPolicy& policy = target->background_throttling_;
+    policy.timers = timers.value_or(policy.timers);
+    policy.rendering = rendering.value_or(policy.rendering);
+    policy.freeze_delay = freeze_delay.value_or(policy.freeze_delay);
+    target->ApplyBackgroundThrottlingPolicy();
+  }
+}
+
+WebContents::BackgroundThrottlingPolicy
+WebContents::GetEffectiveBackgroundThrottlingPolicy() const {
+  BackgroundThrottlingPolicy policy = background_throttling_;
+  if (PowerSavingPolicy::Get()->force_background_throttling()) {
+    // Pages that must keep rendering in the background still do so, but at
+    // the reduced frame rate of the owner window's compositor.
+    policy.timers = true;
+    if (policy.rendering == BackgroundThrottlingPolicy::Rendering::kFull)
+      policy.rendering = BackgroundThrottlingPolicy::Rendering::kThrottle;
+  }
+  return policy;
+}
+
+void WebContents::ApplyBackgroundThrottlingPolicy() {
   if (owner_window_) {
     owner_window_->UpdateBackgroundThrottlingState();
   }
 
+  if (!background_throttling_.freeze_delay.is_positive()) {
+    background_freeze_timer_.Stop();
+    SetPageFrozen(false);
+  } else if (!page_frozen_ && web_contents()->GetVisibility() ==
+                                  content::Visibility::HIDDEN) {
+    background_freeze_timer_.Start(
+        FROM_HERE, background_throttling_.freeze_delay,
+        base::BindOnce(&WebContents::SetPageFrozen, base::Unretained(this),
+                       true));
+  }
+
   auto* rfh = web_contents()->GetPrimaryMainFrame();
   if (!rfh)
     return;
@@ -2281,14 +2845,25 @@ void WebContents::SetBackgroundThrottling(bool allowed) {
   if (!rwh_impl)
     return;
 
-  rwh_impl->disable_hidden_ = !background_throttling_;
-  web_contents()->GetRenderViewHost()->SetSchedulerThrottling(allowed);
+  BackgroundThrottlingPolicy background_throttling =
+      GetEffectiveBackgroundThrottlingPolicy();
+  rwh_impl->disable_hidden_ = background_throttling.rendering !=
+                              BackgroundThrottlingPolicy::Rendering::kStop;
+  web_contents()->GetRenderViewHost()->SetSchedulerThrottling(
+      background_throttling.timers);
 
-  if (rwh_impl->is_hidden()) {
+  if (rwh_impl->disable_hidden_ && rwh_impl->is_hidden()) {
     rwh_impl->WasShown({});
   }
 }
 
+void WebContents::SetPageFrozen(bool frozen) {
+  if (page_frozen_ == frozen)
+    return;
+  page_frozen_ = frozen;
+  web_contents()->SetPageFrozen(frozen);
+}
+
 int WebContents::GetProcessID() const {
   return web_contents()->GetPrimaryMainFrame()->GetProcess()->GetID();
 }
@@ -2362,6 +2937,22 @@ void WebContents::LoadURL(const GURL& url,
       ui::PAGE_TRANSITION_TYPED | ui::PAGE_TRANSITION_FROM_ADDRESS_BAR);
   params.override_user_agent = content::NavigationController::UA_OVERRIDE_TRUE;
 
+  if (defer_load_) {
+    // Only the latest load is started. loadURL() aborts the one it replaces
+    // before it listens for the events of its own load, see
+    // AbortDeferredLoad().
+    AbortDeferredLoad();
+    if (!weak_this || !web_contents())
+      return;
+    deferred_load_params_ =
+        std::make_unique<content::NavigationController::LoadURLParams>(
+            std::move(params));
+    // Have a renderer process ready for when the window is shown.
+    content::RenderProcessHost::WarmupSpareRenderProcessHost(
+        web_contents()->GetBrowserContext());
+    return;
+  }
+
   // It's not safe to start a new navigation or otherwise discard the current
   // one while the call that started it is still on the stack. See
   // http://crbug.com/347742.
@@ -2388,6 +2979,105 @@ void WebContents::LoadURL(const GURL& url,
   NotifyUserActivation();
 }
 
+void WebContents::DeferLoad() {
+  defer_load_ = true;
+}
+
+void WebContents::AbortDeferredLoad() {
+  if (!deferred_load_params_)
+    return;
+  std::unique_ptr<content::NavigationController::LoadURLParams> params =
+      std::move(deferred_load_params_);
+  Emit("did-fail-load", static_cast<int>(net::ERR_ABORTED),
+       net::ErrorToShortString(net::ERR_ABORTED),
+       params->url.possibly_invalid_spec(), true);
+}
+
+void WebContents::StopDeferringLoad() {
+  if (!defer_load_)
+    return;
+  defer_load_ = false;
+  if (!deferred_load_params_)
+    return;
+
+  std::unique_ptr<content::NavigationController::LoadURLParams> params =
+      std::move(deferred_load_params_);
+  auto weak_this = GetWeakPtr();
+  web_contents()->GetController().DiscardNonCommittedEntries();
+  web_contents()->GetController().LoadURLWithParams(*params);
+  // LoadURLWithParams() can destroy |this|, see LoadURL().
+  if (!weak_this || !web_contents())
+    return;
+  NotifyUserActivation();
+}
+
+bool WebContents::StartPrerendering(const GURL& url) {
+  if (!url.SchemeIsHTTPOrHTTPS() || max_prerenders_ == 0)
+    return false;
+
+  std::erase_if(prerender_handles_,
+                [](const auto& handle) { return !handle->IsValid(); });
+  if (base::ranges::any_of(prerender_handles_, [&url](const auto& handle) {
+        return handle->GetInitialPrerenderingUrl() == url;
+      })) {
+    return true;
+  }
+
+  if (prerender_min_available_memory_ > 0 &&
+      base::SysInfo::AmountOfAvailablePhysicalMemory() <
+          prerender_min_available_memory_) {
+    return false;
+  }
+
+  // The oldest prerender is the least likely to be navigated to.
+  if (prerender_handles_.size() >= max_prerenders_)
+    prerender_handles_.erase(prerender_handles_.begin());
+
+  // Activation requires the prerender and the navigation to have the same
+  // transition type, so use the one LoadURL() navigates with.
+  base::AutoReset<bool> allow_prerendering(&allow_prerendering_, true);
+  std::unique_ptr<content::PrerenderHandle> handle =
+      web_contents()->StartPrerendering(
+          url, content::PreloadingTriggerType::kEmbedder, "Electron",
+          ui::PageTransitionFromInt(ui::PAGE_TRANSITION_TYPED |
+                                    ui::PAGE_TRANSITION_FROM_ADDRESS_BAR),
+          content::PreloadingHoldbackStatus::kAllowed,
+          /*preloading_attempt=*/nullptr, /*url_match_predicate=*/{},
+          /*prerender_navigation_handle_callback=*/{});
+  if (!handle)
+    return false;
+  prerender_handles_.push_back(std::move(handle));
+  return true;
+}
+
+void WebContents::StopPrerendering(gin::Arguments* args) {
+  GURL url;
+  if (!args->GetNext(&url)) {
+    prerender_handles_.clear();
+    return;
+  }
+  std::erase_if(prerender_handles_, [&url](const auto& handle) {
+    return handle->GetInitialPrerenderingUrl() == url;
+  });
+}
+
+void WebContents::SetPrerenderLimits(const gin_helper::Dictionary& limits) {
+  int max_count;
+  if (limits.Get("maxCount", &max_count))
+    max_prerenders_ = std::max(max_count, 0);
+  int min_available_memory;
+  if (limits.Get("minAvailableMemory", &min_available_memory)) {
+    prerender_min_available_memory_ =
+        static_cast<uint64_t>(std::max(min_available_memory, 0)) * 1024 * 1024;
+  }
+
+  if (prerender_handles_.size() > max_prerenders_) {
+    prerender_handles_.erase(
+        prerender_handles_.begin(),
+        prerender_handles_.end() - static_cast<ptrdiff_t>(max_prerenders_));
+  }
+}
+
 // TODO(MarshallOfSound): Figure out what we need to do with post data here, I
 // believe the default behavior when we pass "true" is to phone out to the
 // delegate and then the controller expects this method to be called again with
@@ -2646,7 +3336,15 @@ v8::Local<v8::Promise> WebContents::SavePage(
     return handle;
   }
 
-  auto* handler = new SavePageHandler(web_contents(), std::move(promise));
+  auto progress_callback = base::BindRepeating(
+      [](base::WeakPtr<WebContents> self, const base::FilePath& path,
+         int64_t received_bytes, int64_t total_bytes) {
+        if (self)
+          self->Emit("save-page-progress", path, received_bytes, total_bytes);
+      },
+      GetWeakPtr(), full_file_path);
+  auto* handler = new SavePageHandler(web_contents(), std::move(promise),
+                                      std::move(progress_callback));
   handler->Handle(full_file_path, save_type);
 
   return handle;
@@ -3121,16 +3819,23 @@ v8::Local<v8::Promise> WebContents::PrintToPDF(const base::Value& settings) {
       absl::get<printing::mojom::PrintPagesParamsPtr>(print_pages_params));
   params->params->document_cookie = unique_id.value_or(0);
 
+  // When a file path is given the PDF is written straight from the
+  // compositor's shared memory, so no copy of it lands on the JS heap.
+  base::FilePath file_path;
+  if (const auto* path = settings.GetDict().FindString("filePath"))
+    file_path = base::FilePath::FromUTF8Unsafe(*path);
+
   manager->PrintToPdf(web_contents()->GetPrimaryMainFrame(), page_ranges,
                       std::move(params),
                       base::BindOnce(&WebContents::OnPDFCreated, GetWeakPtr(),
-                                     std::move(promise)));
+                                     std::move(promise), file_path));
 
   return handle;
 }
 
 void WebContents::OnPDFCreated(
     gin_helper::Promise<v8::Local<v8::Value>> promise,
+    const base::FilePath& file_path,
     print_to_pdf::PdfPrintResult print_result,
     scoped_refptr<base::RefCountedMemory> data) {
   if (print_result != print_to_pdf::PdfPrintResult::kPrintSuccess) {
@@ -3140,6 +3845,21 @@ void WebContents::OnPDFCreated(
     return;
   }
 
+  if (!file_path.empty()) {
+    file_task_runner_->PostTaskAndReplyWithResult(
+        FROM_HERE, base::BindOnce(&WritePDFToFile, file_path, std::move(data)),
+        base::BindOnce(
+            [](gin_helper::Promise<v8::Local<v8::Value>> promise,
+               bool success) {
+              if (success)
+                promise.As<void>().Resolve();
+              else
+                promise.RejectWithErrorMessage("Failed to write PDF file");
+            },
+            std::move(promise)));
+    return;
+  }
+
   v8::Isolate* isolate = promise.isolate();
   gin_helper::Locker locker(isolate);
   v8::HandleScope handle_scope(isolate);
@@ -3314,72 +4034,191 @@ bool WebContents::IsFocused() const {
 
 void WebContents::SendInputEvent(v8::Isolate* isolate,
                                  v8::Local<v8::Value> input_event) {
+  if (!web_contents()->GetRenderWidgetHostView())
+    return;
+
+  std::optional<ConvertedInputEvent> event =
+      ConvertInputEvent(isolate, input_event);
+  if (!event) {
+    isolate->ThrowException(v8::Exception::Error(
+        gin::StringToV8(isolate, "Invalid event object")));
+    return;
+  }
+  PendingInputEvent pending{std::move(*event)};
+  DispatchInputEvent(&pending);
+}
+
+v8::Local<v8::Promise> WebContents::SendInputEvents(
+    v8::Isolate* isolate,
+    v8::Local<v8::Value> input_events) {
+  auto batch = std::make_unique<InputEventBatch>(isolate);
+  v8::Local<v8::Promise> handle = batch->promise.GetHandle();
+
+  std::vector<v8::Local<v8::Value>> values;
+  if (!gin::ConvertFromV8(isolate, input_events, &values)) {
+    batch->promise.RejectWithErrorMessage("events must be an array");
+    return handle;
+  }
+  batch->events.reserve(values.size());
+  for (size_t i = 0; i < values.size(); i++) {
+    std::optional<ConvertedInputEvent> event =
+        ConvertInputEvent(isolate, values[i]);
+    if (!event) {
+      batch->promise.RejectWithErrorMessage("Invalid event object at index " +
+                                            base::NumberToString(i));
+      return handle;
+    }
+    double timestamp = 0;
+    gin_helper::Dictionary(isolate, values[i].As<v8::Object>())
+        .Get("timestamp", &timestamp);
+    base::TimeDelta offset = base::Milliseconds(timestamp);
+    if (!batch->events.empty() && offset < batch->events.back().offset) {
+      batch->promise.RejectWithErrorMessage(
+          "Event timestamps must not decrease");
+      return handle;
+    }
+    batch->events.push_back({std::move(*event), offset});
+  }
+
+  batch->start = base::TimeTicks::Now();
+  DispatchInputEventBatch(GetWeakPtr(), std::move(batch));
+  return handle;
+}
+
+// static
+void WebContents::DispatchInputEventBatch(
+    base::WeakPtr<WebContents> weak_this,
+    std::unique_ptr<InputEventBatch> batch) {
+  if (!weak_this) {
+    batch->promise.RejectWithErrorMessage("WebContents was destroyed");
+    return;
+  }
+
+  const base::TimeTicks now = base::TimeTicks::Now();
+  while (batch->next < batch->events.size()) {
+    PendingInputEvent& pending = batch->events[batch->next];
+    const base::TimeTicks due = batch->start + pending.offset;
+    if (due > now) {
+      // Input tasks run ahead of other work on the UI thread, which keeps
+      // the events close to their timestamps.
+      content::GetUIThreadTaskRunner({content::BrowserTaskType::kUserInput})
+          ->PostDelayedTask(
+              FROM_HERE,
+              base::BindOnce(&WebContents::DispatchInputEventBatch,
+                             std::move(weak_this), std::move(batch)),
+              due - now);
+      return;
+    }
+    // The page sees the time the event was meant for, not when this task
+    // happened to run.
+    std::visit([due](auto& event) { event.SetTimeStamp(due); }, pending.event);
+    weak_this->DispatchInputEvent(&pending);
+    batch->next++;
+  }
+  batch->promise.Resolve();
+}
+
+void WebContents::DispatchInputEvent(PendingInputEvent* pending) {
   content::RenderWidgetHostView* view =
       web_contents()->GetRenderWidgetHostView();
   if (!view)
     return;
 
   content::RenderWidgetHost* rwh = view->GetRenderWidgetHost();
-  blink::WebInputEvent::Type type =
-      gin::GetWebInputEventType(isolate, input_event);
-  if (blink::WebInputEvent::IsMouseEventType(type)) {
-    blink::WebMouseEvent mouse_event;
-    if (gin::ConvertFromV8(isolate, input_event, &mouse_event)) {
-      if (IsOffScreen()) {
-        GetOffScreenRenderWidgetHostView()->SendMouseEvent(mouse_event);
-      } else {
-        rwh->ForwardMouseEvent(mouse_event);
-      }
-      return;
-    }
-  } else if (blink::WebInputEvent::IsKeyboardEventType(type)) {
-    content::NativeWebKeyboardEvent keyboard_event(
-        blink::WebKeyboardEvent::Type::kRawKeyDown,
-        blink::WebInputEvent::Modifiers::kNoModifiers, ui::EventTimeForNow());
-    if (gin::ConvertFromV8(isolate, input_event, &keyboard_event)) {
-      // For backwards compatibility, convert `kKeyDown` to `kRawKeyDown`.
-      if (keyboard_event.GetType() == blink::WebKeyboardEvent::Type::kKeyDown)
-        keyboard_event.SetType(blink::WebKeyboardEvent::Type::kRawKeyDown);
-      rwh->ForwardKeyboardEvent(keyboard_event);
-      return;
+  if (auto* mouse_event = std::get_if<blink::WebMouseEvent>(&pending->event)) {
+    if (IsOffScreen()) {
+      GetOffScreenRenderWidgetHostView()->SendMouseEvent(*mouse_event);
+    } else {
+      rwh->ForwardMouseEvent(*mouse_event);
     }
-  } else if (type == blink::WebInputEvent::Type::kMouseWheel) {
-    blink::WebMouseWheelEvent mouse_wheel_event;
-    if (gin::ConvertFromV8(isolate, input_event, &mouse_wheel_event)) {
-      if (IsOffScreen()) {
-        GetOffScreenRenderWidgetHostView()->SendMouseWheelEvent(
-            mouse_wheel_event);
-      } else {
-        // Chromium expects phase info in wheel events (and applies a
-        // DCHECK to verify it). See: https://crbug.com/756524.
-        mouse_wheel_event.phase = blink::WebMouseWheelEvent::kPhaseBegan;
-        mouse_wheel_event.dispatch_type =
-            blink::WebInputEvent::DispatchType::kBlocking;
-        rwh->ForwardWheelEvent(mouse_wheel_event);
-
-        // Send a synthetic wheel event with phaseEnded to finish scrolling.
-        mouse_wheel_event.has_synthetic_phase = true;
-        mouse_wheel_event.delta_x = 0;
-        mouse_wheel_event.delta_y = 0;
-        mouse_wheel_event.phase = blink::WebMouseWheelEvent::kPhaseEnded;
-        mouse_wheel_event.dispatch_type =
-            blink::WebInputEvent::DispatchType::kEventNonBlocking;
-        rwh->ForwardWheelEvent(mouse_wheel_event);
-      }
-      return;
+  } else if (auto* keyboard_event =
+                 std::get_if<content::NativeWebKeyboardEvent>(
+                     &pending->event)) {
+    rwh->ForwardKeyboardEvent(*keyboard_event);
+  } else if (auto* mouse_wheel_event =
+                 std::get_if<blink::WebMouseWheelEvent>(&pending->event)) {
+    if (IsOffScreen()) {
+      GetOffScreenRenderWidgetHostView()->SendMouseWheelEvent(
+          *mouse_wheel_event);
+    } else {
+      // Chromium expects phase info in wheel events (and applies a
+      // DCHECK to verify it). See: https://crbug.com/756524.
+      mouse_wheel_event->phase = blink::WebMouseWheelEvent::kPhaseBegan;
+      mouse_wheel_event->dispatch_type =
+          blink::WebInputEvent::DispatchType::kBlocking;
+      rwh->ForwardWheelEvent(*mouse_wheel_event);
+
+      // Send a synthetic wheel event with phaseEnded to finish scrolling.
+      mouse_wheel_event->has_synthetic_phase = true;
+      mouse_wheel_event->delta_x = 0;
+      mouse_wheel_event->delta_y = 0;
+      mouse_wheel_event->phase = blink::WebMouseWheelEvent::kPhaseEnded;
+      mouse_wheel_event->dispatch_type =
+          blink::WebInputEvent::DispatchType::kEventNonBlocking;
+      rwh->ForwardWheelEvent(*mouse_wheel_event);
     }
   }
-
-  isolate->ThrowException(
-      v8::Exception::Error(gin::StringToV8(isolate, "Invalid event object")));
 }
 
 void WebContents::BeginFrameSubscription(gin::Arguments* args) {
-  bool only_dirty = false;
+  FrameSubscriber::Options options;
   FrameSubscriber::FrameCaptureCallback callback;
 
   if (args->Length() > 1) {
-    if (!args->GetNext(&only_dirty)) {
+    v8::Local<v8::Value> next = args->PeekNext();
+    if (!next.IsEmpty() && next->IsObject()) {
+      gin_helper::Dictionary dict;
+      args->GetNext(&dict);
+      dict.Get("onlyDirty", &options.only_dirty);
+      if (dict.Get("frameRate", &options.frame_rate) &&
+          (options.frame_rate < 1 ||
+           options.frame_rate > FrameSubscriber::kMaxFrameRate)) {
+        gin_helper::ErrorThrower(args->isolate())
+            .ThrowRangeError("'frameRate' must be between 1 and 240");
+        return;
+      }
+      std::string pixel_format;
+      if (dict.Get("pixelFormat", &pixel_format)) {
+        if (pixel_format == "i420") {
+          options.pixel_format = media::PIXEL_FORMAT_I420;
+        } else if (pixel_format != "bgra") {
+          gin_helper::ErrorThrower(args->isolate())
+              .ThrowTypeError("'pixelFormat' must be 'bgra' or 'i420'");
+          return;
+        }
+      }
+      std::string codec;
+      if (dict.Get("codec", &codec)) {
+        static constexpr auto kCodecs =
+            base::MakeFixedFlatMap<std::string_view, media::VideoCodec>({
+                {"av1", media::VideoCodec::kAV1},
+                {"h264", media::VideoCodec::kH264},
+                {"vp8", media::VideoCodec::kVP8},
+                {"vp9", media::VideoCodec::kVP9},
+            });
+        auto iter = kCodecs.find(codec);
+        if (iter == kCodecs.end() ||
+            !FrameEncoder::IsCodecSupported(iter->second)) {
+          gin_helper::ErrorThrower(args->isolate())
+              .ThrowTypeError("Unsupported 'codec': " + codec);
+          return;
+        }
+        // The encoders take I420 frames.
+        options.codec = iter->second;
+        options.pixel_format = media::PIXEL_FORMAT_I420;
+      }
+      uint32_t bitrate;
+      if (dict.Get("bitrate", &bitrate))
+        options.bitrate = bitrate;
+      if (dict.Get("size", &options.size) &&
+          (options.size.IsEmpty() ||
+           options.size.width() > media::limits::kMaxDimension ||
+           options.size.height() > media::limits::kMaxDimension)) {
+        gin_helper::ErrorThrower(args->isolate())
+            .ThrowRangeError("'size' is not a valid frame size");
+        return;
+      }
+    } else if (!args->GetNext(&options.only_dirty)) {
       args->ThrowError();
       return;
     }
@@ -3390,7 +4229,7 @@ void WebContents::BeginFrameSubscription(gin::Arguments* args) {
   }
 
   frame_subscriber_ =
-      std::make_unique<FrameSubscriber>(web_contents(), callback, only_dirty);
+      std::make_unique<FrameSubscriber>(web_contents(), callback, options);
 }
 
 void WebContents::EndFrameSubscription() {
@@ -3481,6 +4320,22 @@ v8::Local<v8::Promise> WebContents::CapturePage(gin::Arguments* args) {
   return handle;
 }
 
+base::OnceClosure WebContents::HoldCapturer(gin::Arguments* args) {
+  bool stay_hidden = false;
+  bool stay_awake = false;
+  gin_helper::Dictionary options;
+  if (args->GetNext(&options)) {
+    options.Get("stayHidden", &stay_hidden);
+    options.Get("stayAwake", &stay_awake);
+  }
+
+  // The capturer is released when the returned function is called, or when
+  // it is garbage collected.
+  return base::BindOnce([](base::ScopedClosureRunner capture_handle) {},
+                        web_contents()->IncrementCapturerCount(
+                            gfx::Size(), stay_hidden, stay_awake));
+}
+
 bool WebContents::IsBeingCaptured() {
   return web_contents()->IsBeingCaptured();
 }
@@ -3509,8 +4364,18 @@ bool WebContents::IsOffScreen() const {
   return type_ == Type::kOffScreen;
 }
 
-void WebContents::OnPaint(const gfx::Rect& dirty_rect, const SkBitmap& bitmap) {
-  Emit("paint", dirty_rect, gfx::Image::CreateFrom1xBitmap(bitmap));
+void WebContents::OnPaint(const gfx::Rect& dirty_rect,
+                          const SkBitmap& bitmap,
+                          std::unique_ptr<OffscreenSharedTexture> texture) {
+  if (!texture) {
+    Emit("paint", dirty_rect, gfx::Image::CreateFrom1xBitmap(bitmap));
+    return;
+  }
+
+  v8::Isolate* isolate = JavascriptEnvironment::GetIsolate();
+  v8::HandleScope handle_scope(isolate);
+  Emit("paint", dirty_rect, gfx::Image(),
+       CreateOffscreenSharedTexture(isolate, std::move(texture)));
 }
 
 void WebContents::StartPainting() {
@@ -3532,8 +4397,16 @@ bool WebContents::IsPainting() const {
 
 void WebContents::SetFrameRate(int frame_rate) {
   auto* osr_wcv = GetOffScreenWebContentsView();
-  if (osr_wcv)
-    osr_wcv->SetFrameRate(frame_rate);
+  if (!osr_wcv)
+    return;
+  int max_frame_rate = PowerSavingPolicy::Get()->max_frame_rate();
+  if (max_frame_rate > 0 && frame_rate > max_frame_rate) {
+    uncapped_frame_rate_ = frame_rate;
+    frame_rate = max_frame_rate;
+  } else {
+    uncapped_frame_rate_ = 0;
+  }
+  osr_wcv->SetFrameRate(frame_rate);
 }
 
 int WebContents::GetFrameRate() const {
@@ -3541,6 +4414,31 @@ int WebContents::GetFrameRate() const {
   return osr_wcv ? osr_wcv->GetFrameRate() : 0;
 }
 
+void WebContents::SetPaintAcknowledgementEnabled(bool enabled) {
+  auto* osr_wcv = GetOffScreenWebContentsView();
+  if (osr_wcv)
+    osr_wcv->SetPaintAcknowledgementEnabled(enabled);
+}
+
+void WebContents::AcknowledgePaint() {
+  auto* osr_rwhv = GetOffScreenRenderWidgetHostView();
+  if (osr_rwhv)
+    osr_rwhv->AcknowledgePaint();
+}
+
+v8::Local<v8::Value> WebContents::GetPaintStatistics(v8::Isolate* isolate) {
+  auto dict = gin_helper::Dictionary::CreateEmpty(isolate);
+  auto* osr_rwhv = GetOffScreenRenderWidgetHostView();
+  if (osr_rwhv) {
+    const auto& stats = osr_rwhv->paint_statistics();
+    dict.Set("painted", static_cast<double>(stats.painted));
+    dict.Set("coalesced", static_cast<double>(stats.coalesced));
+    dict.Set("dropped", static_cast<double>(stats.dropped));
+    dict.Set("bytesCopied", static_cast<double>(stats.bytes_copied));
+  }
+  return dict.GetHandle();
+}
+
 void WebContents::Invalidate() {
   if (IsOffScreen()) {
     auto* osr_rwhv = GetOffScreenRenderWidgetHostView();
@@ -3789,6 +4687,324 @@ v8::Local<v8::Promise> WebContents::GetProcessMemoryInfo(v8::Isolate* isolate) {
   return handle;
 }
 
+v8::Local<v8::Promise> WebContents::GetResourceUsage(v8::Isolate* isolate) {
+  gin_helper::Promise<gin_helper::Dictionary> promise(isolate);
+  v8::Local<v8::Promise> handle = promise.GetHandle();
+
+  auto* frame_host = web_contents()->GetPrimaryMainFrame();
+  if (!frame_host || !frame_host->IsRenderFrameLive()) {
+    promise.RejectWithErrorMessage(
+        "Failed to get resource usage with nonexistent render frame");
+    return handle;
+  }
+
+  // CPU time can't be split between the frames of one renderer, so report the
+  // time of the whole process and whether other pages share it.
+  content::RenderProcessHost* process = frame_host->GetProcess();
+#if BUILDFLAG(IS_MAC)
+  auto metrics = base::ProcessMetrics::CreateProcessMetrics(
+      process->GetProcess().Handle(),
+      content::BrowserChildProcessHost::GetPortProvider());
+#else
+  auto metrics =
+      base::ProcessMetrics::CreateProcessMetrics(process->GetProcess().Handle());
+#endif
+  double cpu_time = metrics->GetCumulativeCPUUsage()
+                        .value_or(base::TimeDelta())
+                        .InMillisecondsF();
+  bool process_shared = false;
+  process->ForEachRenderFrameHost(
+      [this, &process_shared](content::RenderFrameHost* rfh) {
+        if (content::WebContents::FromRenderFrameHost(rfh) != web_contents())
+          process_shared = true;
+      });
+
+  std::vector<content::RenderFrameHost*> frame_hosts;
+  frame_host->ForEachRenderFrameHost(
+      [this, &frame_hosts](content::RenderFrameHost* rfh) {
+        if (rfh->IsRenderFrameLive() &&
+            content::WebContents::FromRenderFrameHost(rfh) == web_contents())
+          frame_hosts.push_back(rfh);
+      });
+
+  auto barrier = base::BarrierCallback<mojom::FrameResourceUsagePtr>(
+      frame_hosts.size(),
+      base::BindOnce(
+          [](gin_helper::Promise<gin_helper::Dictionary> promise,
+             double cpu_time, bool process_shared,
+             int64_t network_bytes_received, int64_t network_request_count,
+             std::vector<mojom::FrameResourceUsagePtr> usages) {
+            uint64_t js_heap_size = 0;
+            uint64_t dom_node_count = 0;
+            int frame_count = 0;
+            for (const auto& usage : usages) {
+              // Frames that went away while measuring report nothing.
+              if (!usage)
+                continue;
+              js_heap_size += usage->js_heap_size;
+              dom_node_count += usage->dom_node_count;
+              ++frame_count;
+            }
+
+            v8::HandleScope handle_scope(promise.isolate());
+            auto dict = gin_helper::Dictionary::CreateEmpty(promise.isolate());
+            dict.Set("cpuTime", cpu_time);
+            dict.Set("processShared", process_shared);
+            dict.Set("jsHeapSize", static_cast<double>(js_heap_size >> 10));
+            dict.Set("domNodeCount", static_cast<double>(dom_node_count));
+            dict.Set("frameCount", frame_count);
+            dict.Set("networkBytesReceived",
+                     static_cast<double>(network_bytes_received));
+            dict.Set("networkRequestCount",
+                     static_cast<double>(network_request_count));
+            promise.Resolve(dict);
+          },
+          std::move(promise), cpu_time, process_shared,
+          network_bytes_received_, network_request_count_));
+
+  for (auto* rfh : frame_hosts) {
+    auto electron_renderer =
+        std::make_unique<mojo::Remote<mojom::ElectronRenderer>>();
+    rfh->GetRemoteInterfaces()->GetInterface(
+        electron_renderer->BindNewPipeAndPassReceiver());
+    auto* remote = electron_renderer.get();
+    (*remote)->GetResourceUsage(mojo::WrapCallbackWithDefaultInvokeIfNotRun(
+        base::BindOnce(
+            [](mojo::Remote<mojom::ElectronRenderer>* ep,
+               base::RepeatingCallback<void(mojom::FrameResourceUsagePtr)>
+                   barrier,
+               mojom::FrameResourceUsagePtr usage) {
+              barrier.Run(std::move(usage));
+            },
+            base::Owned(std::move(electron_renderer)), barrier),
+        mojom::FrameResourceUsagePtr()));
+  }
+
+  return handle;
+}
+
+v8::Local<v8::Promise> WebContents::ExecuteJavaScriptInFrames(
+    gin::Arguments* args,
+    const std::u16string& code) {
+  v8::Isolate* isolate = args->isolate();
+  gin_helper::Promise<v8::Local<v8::Value>> promise(isolate);
+  v8::Local<v8::Promise> handle = promise.GetHandle();
+
+  std::vector<content::RenderFrameHost*> frames;
+  bool has_frames = false;
+  bool user_gesture = false;
+  gin_helper::Dictionary options;
+  if (args->GetNext(&options)) {
+    v8::Local<v8::Value> frames_value;
+    if (options.Get("frames", &frames_value) &&
+        !frames_value->IsUndefined()) {
+      if (!gin::ConvertFromV8(isolate, frames_value, &frames)) {
+        args->ThrowTypeError("frames must be an array of WebFrameMain");
+        return handle;
+      }
+      has_frames = true;
+    }
+    options.Get("userGesture", &user_gesture);
+  }
+
+  // Defaults to the whole frame tree.
+  if (!has_frames) {
+    web_contents()->GetPrimaryMainFrame()->ForEachRenderFrameHost(
+        [this, &frames](content::RenderFrameHost* rfh) {
+          if (rfh->IsRenderFrameLive() &&
+              content::WebContents::FromRenderFrameHost(rfh) == web_contents())
+            frames.push_back(rfh);
+        });
+  }
+
+  // Frames of the same renderer process share one message, which goes
+  // through the first of them.
+  std::vector<content::GlobalRenderFrameHostId> frame_ids(frames.size());
+  base::flat_map<int, std::vector<size_t>> frames_by_process;
+  for (size_t i = 0; i < frames.size(); ++i) {
+    content::RenderFrameHost* rfh = frames[i];
+    if (!rfh)
+      continue;
+    frame_ids[i] = rfh->GetGlobalId();
+    if (rfh->IsRenderFrameLive())
+      frames_by_process[rfh->GetProcess()->GetID()].push_back(i);
+  }
+
+  auto barrier = base::BarrierCallback<FrameScriptBatch>(
+      frames_by_process.size(),
+      base::BindOnce(&ResolveFrameScriptResults, std::move(promise),
+                     std::move(frame_ids)));
+
+  for (auto& [process_id, indices] : frames_by_process) {
+    std::vector<blink::LocalFrameToken> tokens;
+    tokens.reserve(indices.size());
+    for (size_t index : indices)
+      tokens.push_back(frames[index]->GetFrameToken());
+
+    auto electron_renderer =
+        std::make_unique<mojo::Remote<mojom::ElectronRenderer>>();
+    frames[indices.front()]->GetRemoteInterfaces()->GetInterface(
+        electron_renderer->BindNewPipeAndPassReceiver());
+    auto* remote = electron_renderer.get();
+    (*remote)->ExecuteJavaScriptInFrames(
+        tokens, code, user_gesture,
+        mojo::WrapCallbackWithDefaultInvokeIfNotRun(
+            base::BindOnce(
+                [](mojo::Remote<mojom::ElectronRenderer>* ep,
+                   std::vector<size_t> indices,
+                   base::RepeatingCallback<void(FrameScriptBatch)> barrier,
+                   std::vector<mojom::FrameScriptResultPtr> results) {
+                  barrier.Run({std::move(indices), std::move(results)});
+                },
+                base::Owned(std::move(electron_renderer)), std::move(indices),
+                barrier),
+            std::vector<mojom::FrameScriptResultPtr>()));
+  }
+
+  return handle;
+}
+
+v8::Local<v8::Promise> WebContents::PurgeMemory(gin::Arguments* args) {
+  gin_helper::Promise<void> promise(args->isolate());
+  v8::Local<v8::Promise> handle = promise.GetHandle();
+
+  auto level = base::MemoryPressureListener::MEMORY_PRESSURE_LEVEL_MODERATE;
+  bool include_children = false;
+  gin_helper::Dictionary options;
+  if (args->GetNext(&options)) {
+    options.Get("includeChildren", &include_children);
+    std::string level_name;
+    if (options.Get("level", &level_name)) {
+      if (level_name == "critical") {
+        level = base::MemoryPressureListener::MEMORY_PRESSURE_LEVEL_CRITICAL;
+      } else if (level_name != "moderate") {
+        args->ThrowTypeError("level must be 'moderate' or 'critical'");
+        return handle;
+      }
+    }
+  }
+
+  SendMemoryPressure(level, include_children,
+                     base::BindOnce(
+                         [](gin_helper::Promise<void> promise) {
+                           promise.Resolve();
+                         },
+                         std::move(promise)));
+  return handle;
+}
+
+std::vector<WebContents*> WebContents::GetChildWebContents(
+    bool recursive) const {
+  std::map<int32_t, std::vector<WebContents*>> children_by_opener;
+  for (auto iter = base::IDMap<WebContents*>::iterator(&GetAllWebContents());
+       !iter.IsAtEnd(); iter.Advance()) {
+    WebContents* contents = iter.GetCurrentValue();
+    if (!contents->web_contents())
+      continue;
+    auto* tracker =
+        ChildWebContentsTracker::FromWebContents(contents->web_contents());
+    if (tracker && tracker->opener_id)
+      children_by_opener[tracker->opener_id].push_back(contents);
+  }
+
+  // base::IDMap iterates in hash order. IDs are handed out in increasing
+  // order, so sorting by them puts each list in the order the windows were
+  // opened.
+  for (auto& [opener_id, list] : children_by_opener)
+    base::ranges::sort(list, {}, &WebContents::ID);
+
+  std::vector<WebContents*> children;
+  std::vector<int32_t> openers = {ID()};
+  for (size_t i = 0; i < openers.size(); ++i) {
+    auto it = children_by_opener.find(openers[i]);
+    if (it == children_by_opener.end())
+      continue;
+    for (WebContents* child : it->second) {
+      children.push_back(child);
+      if (recursive)
+        openers.push_back(child->ID());
+    }
+  }
+  return children;
+}
+
+std::vector<gin::Handle<WebContents>> WebContents::GetChildWebContentsForJS(
+    gin::Arguments* args) const {
+  bool recursive = false;
+  gin_helper::Dictionary options;
+  if (args->GetNext(&options))
+    options.Get("recursive", &recursive);
+
+  std::vector<gin::Handle<WebContents>> list;
+  for (WebContents* child : GetChildWebContents(recursive))
+    list.push_back(gin::CreateHandle(args->isolate(), child));
+  return list;
+}
+
+void WebContents::SendMemoryPressure(
+    base::MemoryPressureListener::MemoryPressureLevel level,
+    bool include_children,
+    base::OnceClosure done) {
+  std::vector<const WebContents*> targets = {this};
+  if (include_children) {
+    for (WebContents* child : GetChildWebContents(true))
+      targets.push_back(child);
+  }
+
+  // The pressure is signalled to whole processes, once for each process that
+  // renders a frame of the targeted WebContents.
+  base::flat_map<int, content::RenderFrameHost*> frames_by_process;
+  for (const WebContents* target : targets) {
+    content::WebContents* contents = target->web_contents();
+    if (!contents)
+      continue;
+    contents->GetPrimaryMainFrame()->ForEachRenderFrameHost(
+        [contents, &frames_by_process](content::RenderFrameHost* rfh) {
+          if (rfh->IsRenderFrameLive() &&
+              content::WebContents::FromRenderFrameHost(rfh) == contents)
+            frames_by_process.emplace(rfh->GetProcess()->GetID(), rfh);
+        });
+  }
+
+  auto barrier =
+      base::BarrierClosure(frames_by_process.size(), std::move(done));
+  for (auto [process_id, rfh] : frames_by_process) {
+    auto electron_renderer =
+        std::make_unique<mojo::Remote<mojom::ElectronRenderer>>();
+    rfh->GetRemoteInterfaces()->GetInterface(
+        electron_renderer->BindNewPipeAndPassReceiver());
+    auto* remote = electron_renderer.get();
+    (*remote)->PurgeMemory(
+        level, mojo::WrapCallbackWithDefaultInvokeIfNotRun(base::BindOnce(
+                   [](mojo::Remote<mojom::ElectronRenderer>* ep,
+                      base::RepeatingClosure barrier) { barrier.Run(); },
+                   base::Owned(std::move(electron_renderer)), barrier)));
+  }
+}
+
+void WebContents::OnVisibilityChanged(content::Visibility visibility) {
+  if (visibility != content::Visibility::HIDDEN) {
+    background_purge_timer_.Stop();
+    background_freeze_timer_.Stop();
+    SetPageFrozen(false);
+    return;
+  }
+  if (background_throttling_.freeze_delay.is_positive()) {
+    background_freeze_timer_.Start(
+        FROM_HERE, background_throttling_.freeze_delay,
+        base::BindOnce(&WebContents::SetPageFrozen, base::Unretained(this),
+                       true));
+  }
+  if (background_purge_delay_.is_positive()) {
+    background_purge_timer_.Start(
+        FROM_HERE, background_purge_delay_,
+        base::BindOnce(
+            &WebContents::SendMemoryPressure, base::Unretained(this),
+            base::MemoryPressureListener::MEMORY_PRESSURE_LEVEL_MODERATE,
+            false, base::DoNothing()));
+  }
+}
+
 v8::Local<v8::Promise> WebContents::TakeHeapSnapshot(
     v8::Isolate* isolate,
     const base::FilePath& file_path) {
@@ -3877,6 +5093,10 @@ void WebContents::EnumerateDirectory(
   FileSelectHelper::EnumerateDirectory(web_contents, std::move(listener), path);
 }
 
+bool WebContents::IsPrerender2Supported(content::WebContents& web_contents) {
+  return allow_prerendering_;
+}
+
 bool WebContents::IsFullscreenForTabOrPending(
     const content::WebContents* source) {
   if (!owner_window())
@@ -4266,10 +5486,19 @@ void WebContents::FillObjectTemplate(v8::Isolate* isolate,
                  &WebContents::GetBackgroundThrottling)
       .SetMethod("setBackgroundThrottling",
                  &WebContents::SetBackgroundThrottling)
+      .SetMethod("getBackgroundThrottlingPolicy",
+                 &WebContents::GetBackgroundThrottlingPolicy)
+      .SetMethod("setBackgroundThrottlingPolicy",
+                 &WebContents::SetBackgroundThrottlingPolicy)
+      .SetMethod("setNavigationRules", &WebContents::SetNavigationRules)
       .SetMethod("getProcessId", &WebContents::GetProcessID)
       .SetMethod("getOSProcessId", &WebContents::GetOSProcessID)
       .SetMethod("equal", &WebContents::Equal)
       .SetMethod("_loadURL", &WebContents::LoadURL)
+      .SetMethod("_abortDeferredLoad", &WebContents::AbortDeferredLoad)
+      .SetMethod("startPrerendering", &WebContents::StartPrerendering)
+      .SetMethod("stopPrerendering", &WebContents::StopPrerendering)
+      .SetMethod("setPrerenderLimits", &WebContents::SetPrerenderLimits)
       .SetMethod("reload", &WebContents::Reload)
       .SetMethod("reloadIgnoringCache", &WebContents::ReloadIgnoringCache)
       .SetMethod("downloadURL", &WebContents::DownloadURL)
@@ -4333,6 +5562,7 @@ void WebContents::FillObjectTemplate(v8::Isolate* isolate,
       .SetMethod("focus", &WebContents::Focus)
       .SetMethod("isFocused", &WebContents::IsFocused)
       .SetMethod("sendInputEvent", &WebContents::SendInputEvent)
+      .SetMethod("sendInputEvents", &WebContents::SendInputEvents)
       .SetMethod("beginFrameSubscription", &WebContents::BeginFrameSubscription)
       .SetMethod("endFrameSubscription", &WebContents::EndFrameSubscription)
       .SetMethod("startDrag", &WebContents::StartDrag)
@@ -4344,6 +5574,10 @@ void WebContents::FillObjectTemplate(v8::Isolate* isolate,
       .SetMethod("isPainting", &WebContents::IsPainting)
       .SetMethod("setFrameRate", &WebContents::SetFrameRate)
       .SetMethod("getFrameRate", &WebContents::GetFrameRate)
+      .SetMethod("setPaintAcknowledgementEnabled",
+                 &WebContents::SetPaintAcknowledgementEnabled)
+      .SetMethod("acknowledgePaint", &WebContents::AcknowledgePaint)
+      .SetMethod("getPaintStatistics", &WebContents::GetPaintStatistics)
       .SetMethod("invalidate", &WebContents::Invalidate)
       .SetMethod("setZoomLevel", &WebContents::SetZoomLevel)
       .SetMethod("getZoomLevel", &WebContents::GetZoomLevel)
@@ -4374,6 +5608,7 @@ void WebContents::FillObjectTemplate(v8::Isolate* isolate,
       .SetMethod("setDevToolsWebContents", &WebContents::SetDevToolsWebContents)
       .SetMethod("getNativeView", &WebContents::GetNativeView)
       .SetMethod("isBeingCaptured", &WebContents::IsBeingCaptured)
+      .SetMethod("_holdCapturer", &WebContents::HoldCapturer)
       .SetMethod("setWebRTCIPHandlingPolicy",
                  &WebContents::SetWebRTCIPHandlingPolicy)
       .SetMethod("setWebRTCUDPPortRange", &WebContents::SetWebRTCUDPPortRange)
@@ -4385,6 +5620,11 @@ void WebContents::FillObjectTemplate(v8::Isolate* isolate,
       .SetMethod("setImageAnimationPolicy",
                  &WebContents::SetImageAnimationPolicy)
       .SetMethod("_getProcessMemoryInfo", &WebContents::GetProcessMemoryInfo)
+      .SetMethod("getResourceUsage", &WebContents::GetResourceUsage)
+      .SetMethod("purgeMemory", &WebContents::PurgeMemory)
+      .SetMethod("getChildWebContents", &WebContents::GetChildWebContentsForJS)
+      .SetMethod("executeJavaScriptInFrames",
+                 &WebContents::ExecuteJavaScriptInFrames)
       .SetProperty("id", &WebContents::ID)
       .SetProperty("session", &WebContents::Session)
       .SetProperty("hostWebContents", &WebContents::HostWebContents)
@@ -14,12 +14,15 @@
 #include <vector>
 
 #include "base/functional/callback_forward.h"
+#include "base/memory/memory_pressure_listener.h"
 #include "base/memory/raw_ptr.h"
 #include "base/memory/raw_ptr_exclusion.h"
 #include "base/memory/weak_ptr.h"
 #include "base/observer_list.h"
 #include "base/observer_list_types.h"
 #include "base/task/thread_pool.h"
+#include "base/time/time.h"
+#include "base/timer/timer.h"
 #include "chrome/browser/devtools/devtools_eye_dropper.h"
 #include "chrome/browser/devtools/devtools_file_system_indexer.h"
 #include "chrome/browser/ui/exclusive_access/exclusive_access_context.h"  // nogncheck
@@ -28,12 +31,14 @@
 #include "content/public/browser/devtools_agent_host.h"
 #include "content/public/browser/javascript_dialog_manager.h"
 #include "content/public/browser/keyboard_event_processing_result.h"
+#include "content/public/browser/navigation_controller.h"
 #include "content/public/browser/render_widget_host.h"
 #include "content/public/browser/web_contents.h"
 #include "content/public/browser/web_contents_delegate.h"
 #include "content/public/browser/web_contents_observer.h"
 #include "electron/buildflags/buildflags.h"
 #include "electron/shell/common/api/api.mojom.h"
+#include "extensions/common/url_pattern.h"
 #include "gin/handle.h"
 #include "gin/wrappable.h"
 #include "mojo/public/cpp/bindings/receiver_set.h"
@@ -49,6 +54,7 @@
 #include "shell/common/gin_helper/cleaned_up_at_exit.h"
 #include "shell/common/gin_helper/constructible.h"
 #include "shell/common/gin_helper/error_thrower.h"
+#include "shell/common/gin_helper/live_object.h"
 #include "shell/common/gin_helper/pinnable.h"
 #include "ui/base/cursor/cursor.h"
 #include "ui/base/models/image_model.h"
@@ -67,6 +73,10 @@ class ScriptExecutor;
 }
 #endif
 
+namespace content {
+class PrerenderHandle;
+}
+
 namespace blink {
 struct DeviceEmulationParams;
 // enum class PermissionType;
@@ -97,6 +107,7 @@ class WebDialogHelper;
 class NativeWindow;
 class OffScreenRenderWidgetHostView;
 class OffScreenWebContentsView;
+struct OffscreenSharedTexture;
 
 namespace api {
 
@@ -170,13 +181,30 @@ class WebContents : public ExclusiveAccessContext,
   void Close(std::optional<gin_helper::Dictionary> options);
   base::WeakPtr<WebContents> GetWeakPtr() { return weak_factory_.GetWeakPtr(); }
 
+  // Re-applies the background throttling and frame rate after
+  // PowerSavingPolicy changed state.
+  void UpdatePowerSaving();
+
   bool GetBackgroundThrottling() const override;
   void SetBackgroundThrottling(bool allowed);
+  v8::Local<v8::Value> GetBackgroundThrottlingPolicy(
+      v8::Isolate* isolate) const;
+  void SetBackgroundThrottlingPolicy(gin::Arguments* args);
   int GetProcessID() const;
   base::ProcessId GetOSProcessID() const;
   [[nodiscard]] Type type() const { return type_; }
   bool Equal(const WebContents* web_contents) const;
   void LoadURL(const GURL& url, const gin_helper::Dictionary& options);
+  // Holds back navigations started by LoadURL until StopDeferringLoad().
+  void DeferLoad();
+  // Fails the navigation held back by DeferLoad(), if any, with ERR_ABORTED.
+  void AbortDeferredLoad();
+  void StopDeferringLoad();
+  // Prerenders |url| so that a later LoadURL() of it activates the prerendered
+  // page instead of starting a new navigation.
+  bool StartPrerendering(const GURL& url);
+  void StopPrerendering(gin::Arguments* args);
+  void SetPrerenderLimits(const gin_helper::Dictionary& limits);
   void Reload();
   void ReloadIgnoringCache();
   void DownloadURL(const GURL& url, gin::Arguments* args);
@@ -243,6 +271,7 @@ class WebContents : public ExclusiveAccessContext,
   // Print current page as PDF.
   v8::Local<v8::Promise> PrintToPDF(const base::Value& settings);
   void OnPDFCreated(gin_helper::Promise<v8::Local<v8::Value>> promise,
+                    const base::FilePath& file_path,
                     print_to_pdf::PdfPrintResult print_result,
                     scoped_refptr<base::RefCountedMemory> data);
 #endif
@@ -280,6 +309,10 @@ class WebContents : public ExclusiveAccessContext,
 
   // Send WebInputEvent to the page.
   void SendInputEvent(v8::Isolate* isolate, v8::Local<v8::Value> input_event);
+  // Sends each of |input_events| when its timestamp, in milliseconds since
+  // the call, is reached.
+  v8::Local<v8::Promise> SendInputEvents(v8::Isolate* isolate,
+                                         v8::Local<v8::Value> input_events);
 
   // Subscribe to the frame updates.
   void BeginFrameSubscription(gin::Arguments* args);
@@ -291,6 +324,7 @@ class WebContents : public ExclusiveAccessContext,
   // Captures the page with |rect|, |callback| would be called when capturing is
   // done.
   v8::Local<v8::Promise> CapturePage(gin::Arguments* args);
+  base::OnceClosure HoldCapturer(gin::Arguments* args);
 
   // Methods for creating <webview>.
   [[nodiscard]] bool is_guest() const { return type_ == Type::kWebView; }
@@ -300,12 +334,17 @@ class WebContents : public ExclusiveAccessContext,
 
   // Methods for offscreen rendering
   bool IsOffScreen() const;
-  void OnPaint(const gfx::Rect& dirty_rect, const SkBitmap& bitmap);
+  void OnPaint(const gfx::Rect& dirty_rect,
+               const SkBitmap& bitmap,
+               std::unique_ptr<OffscreenSharedTexture> texture);
   void StartPainting();
   void StopPainting();
   bool IsPainting() const;
   void SetFrameRate(int frame_rate);
   int GetFrameRate() const;
+  void SetPaintAcknowledgementEnabled(bool enabled);
+  void AcknowledgePaint();
+  v8::Local<v8::Value> GetPaintStatistics(v8::Isolate* isolate);
   void Invalidate();
   gfx::Size GetSizeForNewRenderView(content::WebContents*) override;
 
@@ -344,6 +383,17 @@ class WebContents : public ExclusiveAccessContext,
   v8::Local<v8::Promise> TakeHeapSnapshot(v8::Isolate* isolate,
                                           const base::FilePath& file_path);
   v8::Local<v8::Promise> GetProcessMemoryInfo(v8::Isolate* isolate);
+  v8::Local<v8::Promise> GetResourceUsage(v8::Isolate* isolate);
+  v8::Local<v8::Promise> ExecuteJavaScriptInFrames(gin::Arguments* args,
+                                                   const std::u16string& code);
+  v8::Local<v8::Promise> PurgeMemory(gin::Arguments* args);
+
+  // Returns the WebContents opened by this one with window.open(), in the
+  // order they were opened. With |recursive| the windows they opened follow
+  // too, each after its opener.
+  std::vector<WebContents*> GetChildWebContents(bool recursive) const;
+  std::vector<gin::Handle<WebContents>> GetChildWebContentsForJS(
+      gin::Arguments* args) const;
 
   bool HandleContextMenu(content::RenderFrameHost& render_frame_host,
                          const content::ContextMenuParams& params) override;
@@ -371,6 +421,28 @@ class WebContents : public ExclusiveAccessContext,
   bool EmitNavigationEvent(const std::string& event,
                            content::NavigationHandle* navigation_handle);
 
+  // A rule set with webContents.setNavigationRules(). The first rule whose
+  // conditions all match a navigation decides it; navigations that match no
+  // rule, or an "ask" rule, are decided by JS through the navigation events.
+  struct NavigationRule {
+    enum class Action { kAsk, kAllow, kDeny, kOpenExternally };
+
+    NavigationRule();
+    NavigationRule(NavigationRule&&);
+    NavigationRule& operator=(NavigationRule&&);
+    ~NavigationRule();
+
+    Action action = Action::kAsk;
+    // Empty pattern lists match everything.
+    std::vector<URLPattern> url_patterns;
+    std::vector<URLPattern> initiator_origin_patterns;
+    std::optional<bool> is_main_frame;
+  };
+
+  void SetNavigationRules(gin::Arguments* args);
+  NavigationRule::Action GetNavigationRuleAction(
+      content::NavigationHandle* navigation_handle) const;
+
   // this.emit(name, new Event(sender, message), args...);
   template <typename... Args>
   bool EmitWithSender(const std::string_view name,
@@ -429,11 +501,13 @@ class WebContents : public ExclusiveAccessContext,
   // mojom::ElectronApiIPC
   void Message(bool internal,
                const std::string& channel,
-               blink::CloneableMessage arguments,
+               blink::TransferableMessage arguments,
                content::RenderFrameHost* render_frame_host);
+  void MessageBatch(std::vector<electron::mojom::BatchedMessagePtr> messages,
+                    content::RenderFrameHost* render_frame_host);
   void Invoke(bool internal,
               const std::string& channel,
-              blink::CloneableMessage arguments,
+              blink::TransferableMessage arguments,
               electron::mojom::ElectronApiIPC::InvokeCallback callback,
               content::RenderFrameHost* render_frame_host);
   void ReceivePostMessage(const std::string& channel,
@@ -442,7 +516,7 @@ class WebContents : public ExclusiveAccessContext,
   void MessageSync(
       bool internal,
       const std::string& channel,
-      blink::CloneableMessage arguments,
+      blink::TransferableMessage arguments,
       electron::mojom::ElectronApiIPC::MessageSyncCallback callback,
       content::RenderFrameHost* render_frame_host);
   void MessageHost(const std::string& channel,
@@ -522,6 +596,21 @@ class WebContents : public ExclusiveAccessContext,
                              extensions::mojom::ViewType view_type);
 #endif
 
+  // Pushes |background_throttling_| to the primary main frame's widget and
+  // the owner window.
+  void ApplyBackgroundThrottlingPolicy();
+  void SetPageFrozen(bool frozen);
+
+  void ClosePage(bool dispatch_beforeunload);
+
+  // Signals memory pressure to the renderers of this WebContents' frames, and
+  // with |include_children| of its child windows' frames, once per process.
+  // |done| runs once they all have received it.
+  void SendMemoryPressure(
+      base::MemoryPressureListener::MemoryPressureLevel level,
+      bool include_children,
+      base::OnceClosure done);
+
   // content::WebContentsDelegate:
   bool DidAddMessageToConsole(content::WebContents* source,
                               blink::mojom::ConsoleMessageLevel level,
@@ -644,6 +733,7 @@ class WebContents : public ExclusiveAccessContext,
                    int error_code) override;
   void DidStartLoading() override;
   void DidStopLoading() override;
+  void DidFirstVisuallyNonEmptyPaint() override;
   void DidStartNavigation(
       content::NavigationHandle* navigation_handle) override;
   void DidRedirectNavigation(
@@ -652,6 +742,10 @@ class WebContents : public ExclusiveAccessContext,
       content::NavigationHandle* navigation_handle) override;
   void DidFinishNavigation(
       content::NavigationHandle* navigation_handle) override;
+  void ResourceLoadComplete(
+      content::RenderFrameHost* render_frame_host,
+      const content::GlobalRequestID& request_id,
+      const blink::mojom::ResourceLoadInfo& resource_load_info) override;
   void WebContentsDestroyed() override;
   void NavigationEntryCommitted(
       const content::LoadCommittedDetails& load_details) override;
@@ -674,6 +768,7 @@ class WebContents : public ExclusiveAccessContext,
       content::RenderWidgetHost* render_widget_host) override;
   void OnWebContentsLostFocus(
       content::RenderWidgetHost* render_widget_host) override;
+  void OnVisibilityChanged(content::Visibility visibility) override;
 
   // InspectableWebContentsDelegate:
   void DevToolsReloadPage() override;
@@ -691,6 +786,16 @@ class WebContents : public ExclusiveAccessContext,
   OffScreenWebContentsView* GetOffScreenWebContentsView() const;
   OffScreenRenderWidgetHostView* GetOffScreenRenderWidgetHostView() const;
 
+  // An event converted by SendInputEvent(s), and the events of one
+  // SendInputEvents call. Defined in the .cc file.
+  struct PendingInputEvent;
+  struct InputEventBatch;
+  void DispatchInputEvent(PendingInputEvent* pending);
+  // Rejects the batch's promise if the WebContents is destroyed before all of
+  // its events have been dispatched.
+  static void DispatchInputEventBatch(base::WeakPtr<WebContents> weak_this,
+                                      std::unique_ptr<InputEventBatch> batch);
+
   // Called when received a synchronous message from renderer to
   // get the zoom level.
   void OnGetZoomLevel(content::RenderFrameHost* frame_host,
@@ -730,6 +835,7 @@ class WebContents : public ExclusiveAccessContext,
   bool IsExclusiveAccessBubbleDisplayed() const override;
 
   // content::WebContentsDelegate
+  bool IsPrerender2Supported(content::WebContents& web_contents) override;
   bool IsFullscreenForTabOrPending(const content::WebContents* source) override;
   content::FullscreenState GetFullscreenState(
       const content::WebContents* web_contents) const override;
@@ -817,8 +923,33 @@ class WebContents : public ExclusiveAccessContext,
   // Request id used for findInPage request.
   uint32_t find_in_page_request_id_ = 0;
 
-  // Whether background throttling is disabled.
-  bool background_throttling_ = true;
+  // How the page is throttled while it is hidden.
+  struct BackgroundThrottlingPolicy {
+    enum class Rendering { kStop, kThrottle, kFull };
+
+    // Whether Blink throttles the page's timers and tasks.
+    bool timers = true;
+    Rendering rendering = Rendering::kStop;
+    // How long the page stays hidden before it is frozen, never when zero.
+    base::TimeDelta freeze_delay;
+  };
+
+  // |background_throttling_|, throttled further while PowerSavingPolicy is
+  // active.
+  BackgroundThrottlingPolicy GetEffectiveBackgroundThrottlingPolicy() const;
+
+  BackgroundThrottlingPolicy background_throttling_;
+  base::OneShotTimer background_freeze_timer_;
+  bool page_frozen_ = false;
+
+  // The offscreen frame rate the app asked for while PowerSavingPolicy caps
+  // it to a lower one, zero otherwise.
+  int uncapped_frame_rate_ = 0;
+
+  // How long the page stays hidden before its renderers are told to purge
+  // memory, never when zero.
+  base::TimeDelta background_purge_delay_;
+  base::OneShotTimer background_purge_timer_;
 
   // Whether to enable devtools.
   bool enable_devtools_ = true;
@@ -831,8 +962,16 @@ class WebContents : public ExclusiveAccessContext,
   // The window that this WebContents belongs to.
   base::WeakPtr<NativeWindow> owner_window_;
 
+  // The latest navigation requested while loads are deferred.
+  bool defer_load_ = false;
+  std::unique_ptr<content::NavigationController::LoadURLParams>
+      deferred_load_params_;
+
   bool offscreen_ = false;
 
+  // Whether offscreen rendering paints GPU shared textures.
+  bool offscreen_use_shared_texture_ = false;
+
   // Whether window is fullscreened by HTML5 api.
   bool html_fullscreen_ = false;
 
@@ -880,9 +1019,29 @@ class WebContents : public ExclusiveAccessContext,
   raw_ptr<content::RenderFrameHost> fullscreen_frame_ = nullptr;
 
   std::unique_ptr<SkRegion> draggable_region_;
+  // The regions |draggable_region_| was built from.
+  std::vector<blink::mojom::DraggableRegionPtr> draggable_regions_;
 
   bool force_non_draggable_ = false;
 
+  // Network usage of the frames of this WebContents, reported by the network
+  // service as loads complete.
+  int64_t network_bytes_received_ = 0;
+  int64_t network_request_count_ = 0;
+
+  std::vector<NavigationRule> navigation_rules_;
+
+  // Prerenders started by StartPrerendering(), oldest first.
+  std::vector<std::unique_ptr<content::PrerenderHandle>> prerender_handles_;
+  size_t max_prerenders_ = 2;
+  // Prerendering is not started while less physical memory is available.
+  uint64_t prerender_min_available_memory_ = 0;
+  // Only prerenders started by the app are allowed, not the ones requested
+  // by pages through speculation rules.
+  bool allow_prerendering_ = false;
+
+  gin_helper::LiveObject live_object_{"WebContents"};
+
   base::WeakPtrFactory<WebContents> weak_factory_{this};
 };
 
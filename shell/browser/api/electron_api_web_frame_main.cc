@@ -11,10 +11,12 @@
 
 #include "base/logging.h"
 #include "base/no_destructor.h"
+#include "base/ranges/algorithm.h"
 #include "content/browser/renderer_host/render_frame_host_impl.h"  // nogncheck
 #include "content/public/browser/render_frame_host.h"
 #include "content/public/common/isolated_world_ids.h"
 #include "electron/shell/common/api/api.mojom.h"
+#include "extensions/common/url_pattern.h"
 #include "gin/object_template_builder.h"
 #include "services/service_manager/public/cpp/interface_provider.h"
 #include "shell/browser/api/message_port.h"
@@ -30,6 +32,7 @@
 #include "shell/common/gin_helper/promise.h"
 #include "shell/common/node_includes.h"
 #include "shell/common/v8_value_serializer.h"
+#include "url/origin.h"
 
 namespace gin {
 
@@ -334,10 +337,15 @@ std::vector<content::RenderFrameHost*> WebFrameMain::Frames() const {
   if (!CheckRenderFrame())
     return frame_hosts;
 
-  render_frame_->ForEachRenderFrameHost(
+  // Only the children are needed, so there is no need to visit their
+  // subtrees.
+  render_frame_->ForEachRenderFrameHostWithAction(
       [&frame_hosts, this](content::RenderFrameHost* rfh) {
+        if (rfh == render_frame_)
+          return content::RenderFrameHost::FrameIterationAction::kContinue;
         if (rfh->GetParent() == render_frame_)
           frame_hosts.push_back(rfh);
+        return content::RenderFrameHost::FrameIterationAction::kSkipChildren;
       });
 
   return frame_hosts;
@@ -356,6 +364,63 @@ std::vector<content::RenderFrameHost*> WebFrameMain::FramesInSubtree() const {
   return frame_hosts;
 }
 
+std::vector<content::RenderFrameHost*> WebFrameMain::QueryFrames(
+    gin::Arguments* args) const {
+  std::vector<content::RenderFrameHost*> frame_hosts;
+
+  gin_helper::Dictionary filter;
+  if (!args->GetNext(&filter)) {
+    args->ThrowTypeError("Expected a filter object");
+    return frame_hosts;
+  }
+
+  std::optional<url::Origin> origin;
+  if (std::string origin_string; filter.Get("origin", &origin_string)) {
+    GURL origin_url(origin_string);
+    if (!origin_url.is_valid()) {
+      args->ThrowTypeError("Invalid origin " + origin_string);
+      return frame_hosts;
+    }
+    origin = url::Origin::Create(origin_url);
+  }
+
+  std::vector<URLPattern> url_patterns;
+  if (std::vector<std::string> urls; filter.Get("urls", &urls)) {
+    for (const std::string& filter_pattern : urls) {
+      URLPattern pattern(URLPattern::SCHEME_ALL);
+      const URLPattern::ParseResult result = pattern.Parse(filter_pattern);
+      if (result != URLPattern::ParseResult::kSuccess) {
+        args->ThrowTypeError(
+            "Invalid url pattern " + filter_pattern + ": " +
+            URLPattern::GetParseResultString(result));
+        return frame_hosts;
+      }
+      url_patterns.push_back(std::move(pattern));
+    }
+  }
+
+  if (!CheckRenderFrame())
+    return frame_hosts;
+
+  // Matching here means only the frames that match get a JS wrapper.
+  render_frame_->ForEachRenderFrameHost([&](content::RenderFrameHost* rfh) {
+    if (origin && !rfh->GetLastCommittedOrigin().IsSameOriginWith(*origin))
+      return;
+    if (!url_patterns.empty()) {
+      const GURL& url = rfh->GetLastCommittedURL();
+      if (!base::ranges::any_of(url_patterns,
+                                [&url](const URLPattern& pattern) {
+                                  return pattern.MatchesURL(url);
+                                })) {
+        return;
+      }
+    }
+    frame_hosts.push_back(rfh);
+  });
+
+  return frame_hosts;
+}
+
 void WebFrameMain::DOMContentLoaded() {
   Emit("dom-ready");
 }
@@ -405,6 +470,7 @@ void WebFrameMain::FillObjectTemplate(v8::Isolate* isolate,
       .SetMethod("reload", &WebFrameMain::Reload)
       .SetMethod("_send", &WebFrameMain::Send)
       .SetMethod("_postMessage", &WebFrameMain::PostMessage)
+      .SetMethod("queryFrames", &WebFrameMain::QueryFrames)
       .SetProperty("frameTreeNodeId", &WebFrameMain::FrameTreeNodeID)
       .SetProperty("name", &WebFrameMain::Name)
       .SetProperty("osProcessId", &WebFrameMain::OSProcessID)
@@ -119,6 +119,8 @@ class WebFrameMain : public gin::Wrappable<WebFrameMain>,
   content::RenderFrameHost* Parent() const;
   std::vector<content::RenderFrameHost*> Frames() const;
   std::vector<content::RenderFrameHost*> FramesInSubtree() const;
+  std::vector<content::RenderFrameHost*> QueryFrames(
+      gin::Arguments* args) const;
 
   void DOMContentLoaded();
 
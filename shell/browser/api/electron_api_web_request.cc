@@ -9,10 +9,12 @@
 #include <string_view>
 #include <utility>
 
-#include "base/containers/contains.h"
 #include "base/containers/fixed_flat_map.h"
 #include "base/memory/raw_ptr.h"
+#include "base/ranges/algorithm.h"
 #include "base/stl_util.h"
+#include "base/strings/string_number_conversions.h"
+#include "base/strings/string_util.h"
 #include "base/task/sequenced_task_runner.h"
 #include "base/values.h"
 #include "extensions/browser/api/web_request/web_request_resource_type.h"
@@ -20,6 +22,7 @@
 #include "gin/dictionary.h"
 #include "gin/object_template_builder.h"
 #include "net/http/http_content_disposition.h"
+#include "net/http/http_util.h"
 #include "shell/browser/api/electron_api_session.h"
 #include "shell/browser/api/electron_api_web_contents.h"
 #include "shell/browser/api/electron_api_web_frame_main.h"
@@ -32,6 +35,7 @@
 #include "shell/common/gin_converters/std_converter.h"
 #include "shell/common/gin_converters/value_converter.h"
 #include "shell/common/gin_helper/dictionary.h"
+#include "shell/common/gin_helper/object_shape.h"
 
 static constexpr auto ResourceTypes =
     base::MakeFixedFlatMap<std::string_view,
@@ -120,8 +124,13 @@ v8::Local<v8::Value> HttpResponseHeadersToV8(
   return gin::ConvertToV8(v8::Isolate::GetCurrent(), response_headers);
 }
 
+// The keys every |details| object starts with, see the first ToDictionary.
+constexpr std::string_view kDetailsKeys[] = {"id", "url", "method",
+                                              "timestamp", "resourceType"};
+constexpr gin_helper::ObjectShape kDetailsShape{kDetailsKeys};
+
 // Overloaded by multiple types to fill the |details| object.
-void ToDictionary(gin_helper::Dictionary* details,
+void ToDictionary(gin_helper::ShapedObject* details,
                   extensions::WebRequestInfo* info) {
   details->Set("id", info->id);
   details->Set("url", info->url);
@@ -142,7 +151,7 @@ void ToDictionary(gin_helper::Dictionary* details,
   auto* render_frame_host = content::RenderFrameHost::FromID(
       info->render_process_id, info->frame_routing_id);
   if (render_frame_host) {
-    details->SetGetter("frame", render_frame_host);
+    details->AsDictionary().SetGetter("frame", render_frame_host);
     auto* web_contents =
         content::WebContents::FromRenderFrameHost(render_frame_host);
     auto* api_web_contents = WebContents::From(web_contents);
@@ -153,34 +162,34 @@ void ToDictionary(gin_helper::Dictionary* details,
   }
 }
 
-void ToDictionary(gin_helper::Dictionary* details,
+void ToDictionary(gin_helper::ShapedObject* details,
                   const network::ResourceRequest& request) {
   details->Set("referrer", request.referrer);
   if (request.request_body)
     details->Set("uploadData", *request.request_body);
 }
 
-void ToDictionary(gin_helper::Dictionary* details,
+void ToDictionary(gin_helper::ShapedObject* details,
                   const net::HttpRequestHeaders& headers) {
   details->Set("requestHeaders", headers);
 }
 
-void ToDictionary(gin_helper::Dictionary* details, const GURL& location) {
+void ToDictionary(gin_helper::ShapedObject* details, const GURL& location) {
   details->Set("redirectURL", location);
 }
 
-void ToDictionary(gin_helper::Dictionary* details, int net_error) {
+void ToDictionary(gin_helper::ShapedObject* details, int net_error) {
   details->Set("error", net::ErrorToString(net_error));
 }
 
 // Helper function to fill |details| with arbitrary |args|.
 template <typename Arg>
-void FillDetails(gin_helper::Dictionary* details, Arg arg) {
+void FillDetails(gin_helper::ShapedObject* details, Arg arg) {
   ToDictionary(details, arg);
 }
 
 template <typename Arg, typename... Args>
-void FillDetails(gin_helper::Dictionary* details, Arg arg, Args... args) {
+void FillDetails(gin_helper::ShapedObject* details, Arg arg, Args... args) {
   ToDictionary(details, arg);
   FillDetails(details, args...);
 }
@@ -225,39 +234,108 @@ gin::WrapperInfo WebRequest::kWrapperInfo = {gin::kEmbedderNativeGin};
 WebRequest::RequestFilter::RequestFilter(
     std::set<URLPattern> url_patterns,
     std::set<extensions::WebRequestResourceType> types)
-    : url_patterns_(std::move(url_patterns)), types_(std::move(types)) {}
+    : RequestFilter() {
+  for (URLPattern& pattern : url_patterns)
+    AddUrlPattern(std::move(pattern));
+  for (extensions::WebRequestResourceType type : types)
+    AddType(type);
+}
 WebRequest::RequestFilter::RequestFilter(const RequestFilter&) = default;
 WebRequest::RequestFilter::RequestFilter() = default;
 WebRequest::RequestFilter::~RequestFilter() = default;
 
 void WebRequest::RequestFilter::AddUrlPattern(URLPattern pattern) {
-  url_patterns_.emplace(std::move(pattern));
+  if (!url_patterns_.insert(pattern).second)
+    return;
+
+  if (pattern.match_all_urls() || pattern.host().empty()) {
+    any_host_patterns_.push_back(std::move(pattern));
+  } else {
+    PatternsByHost& index =
+        pattern.match_subdomains() ? subdomain_patterns_ : host_patterns_;
+    index[base::ToLowerASCII(pattern.host())].push_back(std::move(pattern));
+  }
 }
 
 void WebRequest::RequestFilter::AddType(
     extensions::WebRequestResourceType type) {
-  types_.insert(type);
+  types_.Put(type);
+}
+
+bool WebRequest::RequestFilter::Parse(const std::set<std::string>& url_patterns,
+                                      const std::set<std::string>& types,
+                                      std::string* error) {
+  for (const std::string& filter_pattern : url_patterns) {
+    URLPattern pattern(URLPattern::SCHEME_ALL);
+    const URLPattern::ParseResult result = pattern.Parse(filter_pattern);
+    if (result == URLPattern::ParseResult::kSuccess) {
+      AddUrlPattern(std::move(pattern));
+    } else {
+      const char* error_type = URLPattern::GetParseResultString(result);
+      *error = "Invalid url pattern " + filter_pattern + ": " + error_type;
+      return false;
+    }
+  }
+
+  for (const std::string& filter_type : types) {
+    auto type = ParseResourceType(filter_type);
+    if (type != extensions::WebRequestResourceType::OTHER) {
+      AddType(type);
+    } else {
+      *error = "Invalid type " + filter_type;
+      return false;
+    }
+  }
+  return true;
 }
 
 bool WebRequest::RequestFilter::MatchesURL(const GURL& url) const {
   if (url_patterns_.empty())
     return true;
 
-  for (const auto& pattern : url_patterns_) {
-    if (pattern.MatchesURL(url))
+  const auto matches = [&url](const std::vector<URLPattern>& patterns) {
+    return base::ranges::any_of(patterns, [&url](const URLPattern& pattern) {
+      return pattern.MatchesURL(url);
+    });
+  };
+
+  if (matches(any_host_patterns_))
+    return true;
+
+  std::string_view host = url.host_piece();
+  if (const auto iter = host_patterns_.find(host);
+      iter != host_patterns_.end() && matches(iter->second))
+    return true;
+
+  // Try the host and each of its parent domains against the patterns that
+  // match subdomains, e.g. "a.b.com", "b.com" and then "com".
+  if (subdomain_patterns_.empty())
+    return false;
+  while (true) {
+    if (const auto iter = subdomain_patterns_.find(host);
+        iter != subdomain_patterns_.end() && matches(iter->second))
       return true;
+    const size_t dot = host.find('.');
+    if (dot == std::string_view::npos)
+      return false;
+    host.remove_prefix(dot + 1);
   }
-  return false;
 }
 
 bool WebRequest::RequestFilter::MatchesType(
     extensions::WebRequestResourceType type) const {
-  return types_.empty() || base::Contains(types_, type);
+  return types_.empty() || types_.Has(type);
 }
 
 bool WebRequest::RequestFilter::MatchesRequest(
     extensions::WebRequestInfo* info) const {
-  return MatchesURL(info->url) && MatchesType(info->web_request_type);
+  return Matches(info->url, info->web_request_type);
+}
+
+bool WebRequest::RequestFilter::Matches(
+    const GURL& url,
+    extensions::WebRequestResourceType type) const {
+  return MatchesURL(url) && MatchesType(type);
 }
 
 WebRequest::SimpleListenerInfo::SimpleListenerInfo(RequestFilter filter_,
@@ -273,6 +351,12 @@ WebRequest::ResponseListenerInfo::ResponseListenerInfo(
 WebRequest::ResponseListenerInfo::ResponseListenerInfo() = default;
 WebRequest::ResponseListenerInfo::~ResponseListenerInfo() = default;
 
+WebRequest::DeclarativeRule::DeclarativeRule() = default;
+WebRequest::DeclarativeRule::DeclarativeRule(DeclarativeRule&&) = default;
+WebRequest::DeclarativeRule& WebRequest::DeclarativeRule::operator=(
+    DeclarativeRule&&) = default;
+WebRequest::DeclarativeRule::~DeclarativeRule() = default;
+
 WebRequest::WebRequest(v8::Isolate* isolate,
                        content::BrowserContext* browser_context)
     : browser_context_(browser_context) {
@@ -305,7 +389,8 @@ gin::ObjectTemplateBuilder WebRequest::GetObjectTemplateBuilder(
       .SetMethod("onErrorOccurred",
                  &WebRequest::SetSimpleListener<SimpleEvent::kOnErrorOccurred>)
       .SetMethod("onCompleted",
-                 &WebRequest::SetSimpleListener<SimpleEvent::kOnCompleted>);
+                 &WebRequest::SetSimpleListener<SimpleEvent::kOnCompleted>)
+      .SetMethod("setDeclarativeRules", &WebRequest::SetDeclarativeRules);
 }
 
 const char* WebRequest::GetTypeName() {
@@ -313,13 +398,49 @@ const char* WebRequest::GetTypeName() {
 }
 
 bool WebRequest::HasListener() const {
-  return !(simple_listeners_.empty() && response_listeners_.empty());
+  return !(simple_listeners_.empty() && response_listeners_.empty() &&
+           rules_.empty());
+}
+
+bool WebRequest::MayObserveRequest(
+    const GURL& url,
+    extensions::WebRequestResourceType type) const {
+  const auto matches = [&](const auto& entry) {
+    return entry.second.filter.Matches(url, type);
+  };
+  return base::ranges::any_of(simple_listeners_, matches) ||
+         base::ranges::any_of(response_listeners_, matches) ||
+         base::ranges::any_of(rules_, [&](const DeclarativeRule& rule) {
+           return rule.filter.Matches(url, type);
+         });
+}
+
+bool WebRequest::MayObserveRequestsOfType(
+    extensions::WebRequestResourceType type) const {
+  const auto matches = [&](const auto& entry) {
+    return entry.second.filter.MatchesType(type);
+  };
+  return base::ranges::any_of(simple_listeners_, matches) ||
+         base::ranges::any_of(response_listeners_, matches) ||
+         base::ranges::any_of(rules_, [&](const DeclarativeRule& rule) {
+           return rule.filter.MatchesType(type);
+         });
 }
 
 int WebRequest::OnBeforeRequest(extensions::WebRequestInfo* info,
                                 const network::ResourceRequest& request,
                                 net::CompletionOnceCallback callback,
                                 GURL* new_url) {
+  if (const auto* rule = FindDecisiveRule(info)) {
+    if (rule->action == DeclarativeRule::Action::kBlock)
+      return net::ERR_BLOCKED_BY_CLIENT;
+    if (rule->action == DeclarativeRule::Action::kRedirect &&
+        rule->redirect_url != info->url) {
+      *new_url = rule->redirect_url;
+      return net::OK;
+    }
+  }
+
   return HandleResponseEvent(ResponseEvent::kOnBeforeRequest, info,
                              std::move(callback), new_url, request);
 }
@@ -328,6 +449,15 @@ int WebRequest::OnBeforeSendHeaders(extensions::WebRequestInfo* info,
                                     const network::ResourceRequest& request,
                                     BeforeSendHeadersCallback callback,
                                     net::HttpRequestHeaders* headers) {
+  ForEachHeaderRule(info, [headers](const DeclarativeRule& rule) {
+    for (const auto& operation : rule.request_headers) {
+      if (operation.value)
+        headers->SetHeader(operation.header, *operation.value);
+      else
+        headers->RemoveHeader(operation.header);
+    }
+  });
+
   return HandleResponseEvent(
       ResponseEvent::kOnBeforeSendHeaders, info,
       base::BindOnce(std::move(callback), std::set<std::string>(),
@@ -342,6 +472,23 @@ int WebRequest::OnHeadersReceived(
     const net::HttpResponseHeaders* original_response_headers,
     scoped_refptr<net::HttpResponseHeaders>* override_response_headers,
     GURL* allowed_unsafe_redirect_url) {
+  ForEachHeaderRule(info, [&](const DeclarativeRule& rule) {
+    if (rule.response_headers.empty() || !original_response_headers)
+      return;
+    if (!*override_response_headers) {
+      *override_response_headers =
+          base::MakeRefCounted<net::HttpResponseHeaders>(
+              original_response_headers->raw_headers());
+    }
+    for (const auto& operation : rule.response_headers) {
+      if (operation.value)
+        (*override_response_headers)
+            ->SetHeader(operation.header, *operation.value);
+      else
+        (*override_response_headers)->RemoveHeader(operation.header);
+    }
+  });
+
   const std::string& status_line =
       original_response_headers ? original_response_headers->GetStatusLine()
                                 : std::string();
@@ -388,6 +535,124 @@ void WebRequest::OnRequestWillBeDestroyed(extensions::WebRequestInfo* info) {
   callbacks_.erase(info->id);
 }
 
+void WebRequest::SetDeclarativeRules(gin::Arguments* args) {
+  std::vector<gin_helper::Dictionary> rule_dicts;
+  v8::Local<v8::Value> arg;
+  if (!args->GetNext(&arg) ||
+      !(arg->IsNull() ||
+        gin::ConvertFromV8(args->isolate(), arg, &rule_dicts))) {
+    args->ThrowTypeError("Must pass null or an Array of rules");
+    return;
+  }
+
+  static constexpr auto Actions =
+      base::MakeFixedFlatMap<std::string_view, DeclarativeRule::Action>({
+          {"allow", DeclarativeRule::Action::kAllow},
+          {"block", DeclarativeRule::Action::kBlock},
+          {"modifyHeaders", DeclarativeRule::Action::kModifyHeaders},
+          {"redirect", DeclarativeRule::Action::kRedirect},
+      });
+
+  std::vector<DeclarativeRule> rules;
+  rules.reserve(rule_dicts.size());
+  for (size_t i = 0; i < rule_dicts.size(); ++i) {
+    const std::string prefix =
+        "Invalid rule at index " + base::NumberToString(i) + ": ";
+    DeclarativeRule rule;
+
+    gin_helper::Dictionary condition;
+    if (rule_dicts[i].Get("condition", &condition)) {
+      std::set<std::string> url_patterns, types;
+      condition.Get("urls", &url_patterns);
+      condition.Get("types", &types);
+      std::string error;
+      if (!rule.filter.Parse(url_patterns, types, &error)) {
+        args->ThrowTypeError(prefix + error);
+        return;
+      }
+    }
+
+    gin_helper::Dictionary action;
+    std::string type;
+    if (!rule_dicts[i].Get("action", &action) || !action.Get("type", &type)) {
+      args->ThrowTypeError(prefix + "'action.type' is required");
+      return;
+    }
+    const auto iter = Actions.find(type);
+    if (iter == Actions.end()) {
+      args->ThrowTypeError(prefix + "Invalid action type " + type);
+      return;
+    }
+    rule.action = iter->second;
+
+    if (rule.action == DeclarativeRule::Action::kRedirect) {
+      if (!action.Get("redirectURL", &rule.redirect_url) ||
+          !rule.redirect_url.is_valid()) {
+        args->ThrowTypeError(prefix + "'action.redirectURL' must be a URL");
+        return;
+      }
+    }
+
+    if (rule.action == DeclarativeRule::Action::kModifyHeaders) {
+      for (auto [name, operations] :
+           {std::make_pair("requestHeaders", &rule.request_headers),
+            std::make_pair("responseHeaders", &rule.response_headers)}) {
+        std::vector<gin_helper::Dictionary> operation_dicts;
+        action.Get(name, &operation_dicts);
+        for (const auto& operation_dict : operation_dicts) {
+          DeclarativeRule::HeaderOperation operation;
+          std::string op;
+          if (!operation_dict.Get("header", &operation.header) ||
+              !net::HttpUtil::IsValidHeaderName(operation.header) ||
+              !operation_dict.Get("operation", &op) ||
+              !(op == "set" || op == "remove")) {
+            args->ThrowTypeError(prefix + "Invalid header operation in " +
+                                 name);
+            return;
+          }
+          if (op == "set") {
+            std::string value;
+            if (!operation_dict.Get("value", &value) ||
+                !net::HttpUtil::IsValidHeaderValue(value)) {
+              args->ThrowTypeError(prefix + "Invalid header value in " +
+                                   name);
+              return;
+            }
+            operation.value = std::move(value);
+          }
+          operations->push_back(std::move(operation));
+        }
+      }
+    }
+
+    rules.push_back(std::move(rule));
+  }
+
+  rules_ = std::move(rules);
+}
+
+const WebRequest::DeclarativeRule* WebRequest::FindDecisiveRule(
+    extensions::WebRequestInfo* info) const {
+  for (const auto& rule : rules_) {
+    if (rule.action != DeclarativeRule::Action::kModifyHeaders &&
+        rule.filter.MatchesRequest(info))
+      return &rule;
+  }
+  return nullptr;
+}
+
+void WebRequest::ForEachHeaderRule(
+    extensions::WebRequestInfo* info,
+    base::FunctionRef<void(const DeclarativeRule&)> apply) const {
+  for (const auto& rule : rules_) {
+    if (!rule.filter.MatchesRequest(info))
+      continue;
+    if (rule.action != DeclarativeRule::Action::kModifyHeaders)
+      return;
+    apply(rule);
+  }
+}
+
 template <WebRequest::SimpleEvent event>
 void WebRequest::SetSimpleListener(gin::Arguments* args) {
   SetListener<SimpleListener>(event, &simple_listeners_, args);
@@ -422,28 +687,10 @@ void WebRequest::SetListener(Event event,
   }
 
   RequestFilter filter;
-
-  for (const std::string& filter_pattern : filter_patterns) {
-    URLPattern pattern(URLPattern::SCHEME_ALL);
-    const URLPattern::ParseResult result = pattern.Parse(filter_pattern);
-    if (result == URLPattern::ParseResult::kSuccess) {
-      filter.AddUrlPattern(std::move(pattern));
-    } else {
-      const char* error_type = URLPattern::GetParseResultString(result);
-      args->ThrowTypeError("Invalid url pattern " + filter_pattern + ": " +
-                           error_type);
-      return;
-    }
-  }
-
-  for (const std::string& filter_type : filter_types) {
-    auto type = ParseResourceType(filter_type);
-    if (type != extensions::WebRequestResourceType::OTHER) {
-      filter.AddType(type);
-    } else {
-      args->ThrowTypeError("Invalid type " + filter_type);
-      return;
-    }
+  std::string error;
+  if (!filter.Parse(filter_patterns, filter_types, &error)) {
+    args->ThrowTypeError(error);
+    return;
   }
 
   // Function or null.
@@ -474,7 +721,7 @@ void WebRequest::HandleSimpleEvent(SimpleEvent event,
 
   v8::Isolate* isolate = JavascriptEnvironment::GetIsolate();
   v8::HandleScope handle_scope(isolate);
-  gin_helper::Dictionary details(isolate, v8::Object::New(isolate));
+  gin_helper::ShapedObject details(isolate, kDetailsShape);
   FillDetails(&details, request_info, args...);
   info.listener.Run(gin::ConvertToV8(isolate, details));
 }
@@ -497,7 +744,7 @@ int WebRequest::HandleResponseEvent(ResponseEvent event,
 
   v8::Isolate* isolate = JavascriptEnvironment::GetIsolate();
   v8::HandleScope handle_scope(isolate);
-  gin_helper::Dictionary details(isolate, v8::Object::New(isolate));
+  gin_helper::ShapedObject details(isolate, kDetailsShape);
   FillDetails(&details, request_info, args...);
 
   ResponseCallback response =
@@ -5,16 +5,24 @@
 #ifndef ELECTRON_SHELL_BROWSER_API_ELECTRON_API_WEB_REQUEST_H_
 #define ELECTRON_SHELL_BROWSER_API_ELECTRON_API_WEB_REQUEST_H_
 
+#include <functional>
 #include <map>
+#include <optional>
 #include <set>
+#include <string>
+#include <vector>
 
+#include "base/containers/enum_set.h"
+#include "base/functional/function_ref.h"
 #include "base/memory/raw_ptr.h"
 #include "base/values.h"
+#include "extensions/browser/api/web_request/web_request_resource_type.h"
 #include "extensions/common/url_pattern.h"
 #include "gin/arguments.h"
 #include "gin/handle.h"
 #include "gin/wrappable.h"
 #include "shell/browser/net/web_request_api_interface.h"
+#include "url/gurl.h"
 
 namespace content {
 class BrowserContext;
@@ -49,6 +57,11 @@ class WebRequest : public gin::Wrappable<WebRequest>, public WebRequestAPI {
 
   // WebRequestAPI:
   bool HasListener() const override;
+  bool MayObserveRequest(
+      const GURL& url,
+      extensions::WebRequestResourceType type) const override;
+  bool MayObserveRequestsOfType(
+      extensions::WebRequestResourceType type) const override;
   int OnBeforeRequest(extensions::WebRequestInfo* info,
                       const network::ResourceRequest& request,
                       net::CompletionOnceCallback callback,
@@ -134,14 +147,36 @@ class WebRequest : public gin::Wrappable<WebRequest>, public WebRequestAPI {
     void AddUrlPattern(URLPattern pattern);
     void AddType(extensions::WebRequestResourceType type);
 
+    // Adds the |url_patterns| and |types| given as strings, returns false and
+    // sets |error| when one of them is invalid.
+    bool Parse(const std::set<std::string>& url_patterns,
+               const std::set<std::string>& types,
+               std::string* error);
+
     bool MatchesRequest(extensions::WebRequestInfo* info) const;
+    bool Matches(const GURL& url,
+                 extensions::WebRequestResourceType type) const;
+    bool MatchesType(extensions::WebRequestResourceType type) const;
 
    private:
+    using PatternsByHost =
+        std::map<std::string, std::vector<URLPattern>, std::less<>>;
+    using ResourceTypeSet =
+        base::EnumSet<extensions::WebRequestResourceType,
+                      extensions::WebRequestResourceType::MAIN_FRAME,
+                      extensions::WebRequestResourceType::OTHER>;
+
     bool MatchesURL(const GURL& url) const;
-    bool MatchesType(extensions::WebRequestResourceType type) const;
 
     std::set<URLPattern> url_patterns_;
-    std::set<extensions::WebRequestResourceType> types_;
+
+    // The patterns of |url_patterns_| indexed by the host they match, so that
+    // a request is only tested against the patterns that can match its host.
+    PatternsByHost host_patterns_;
+    PatternsByHost subdomain_patterns_;
+    std::vector<URLPattern> any_host_patterns_;
+
+    ResourceTypeSet types_;
   };
 
   struct SimpleListenerInfo {
@@ -162,6 +197,42 @@ class WebRequest : public gin::Wrappable<WebRequest>, public WebRequestAPI {
     ~ResponseListenerInfo();
   };
 
+  // A rule of the declarative rule set, which is evaluated without calling
+  // into JavaScript.
+  struct DeclarativeRule {
+    enum class Action { kBlock, kAllow, kRedirect, kModifyHeaders };
+
+    struct HeaderOperation {
+      std::string header;
+      // Removes the header when not set.
+      std::optional<std::string> value;
+    };
+
+    RequestFilter filter;
+    Action action = Action::kAllow;
+    GURL redirect_url;
+    std::vector<HeaderOperation> request_headers;
+    std::vector<HeaderOperation> response_headers;
+
+    DeclarativeRule();
+    DeclarativeRule(DeclarativeRule&&);
+    DeclarativeRule& operator=(DeclarativeRule&&);
+    ~DeclarativeRule();
+  };
+
+  void SetDeclarativeRules(gin::Arguments* args);
+
+  // Returns the first block, allow or redirect rule matching |info|.
+  const DeclarativeRule* FindDecisiveRule(
+      extensions::WebRequestInfo* info) const;
+  // Calls |apply| with the modifyHeaders rules matching |info| that come
+  // before the first matching block, allow or redirect rule.
+  void ForEachHeaderRule(
+      extensions::WebRequestInfo* info,
+      base::FunctionRef<void(const DeclarativeRule&)> apply) const;
+
+  std::vector<DeclarativeRule> rules_;
+
   std::map<SimpleEvent, SimpleListenerInfo> simple_listeners_;
   std::map<ResponseEvent, ResponseListenerInfo> response_listeners_;
   std::map<uint64_t, net::CompletionOnceCallback> callbacks_;
@@ -0,0 +1,150 @@
+// Copyright (c) 2024 Microsoft, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#include "shell/browser/api/event_loop_monitor.h"
+
+#include <algorithm>
+#include <limits>
+
+#include "base/bits.h"
+#include "base/functional/bind.h"
+#include "base/pending_task.h"
+#include "base/task/current_thread.h"
+#include "base/task/single_thread_task_runner.h"
+#include "base/trace_event/trace_event.h"
+#include "shell/browser/electron_browser_main_parts.h"
+#include "shell/common/node_bindings.h"
+
+namespace electron {
+
+void LatencyHistogram::Add(base::TimeDelta duration) {
+  const int64_t ms = duration.InMilliseconds();
+  size_t index = 0;
+  if (ms >= 1) {
+    const auto clamped = static_cast<uint32_t>(
+        std::min<int64_t>(ms, std::numeric_limits<uint32_t>::max()));
+    index = std::min<size_t>(1 + base::bits::Log2Floor(clamped),
+                             kBucketCount - 1);
+  }
+  ++buckets[index];
+  ++count;
+  total += duration;
+  max = std::max(max, duration);
+}
+
+// static
+base::TimeDelta LatencyHistogram::BucketUpperBound(size_t index) {
+  if (index + 1 >= kBucketCount)
+    return base::TimeDelta::Max();
+  return base::Milliseconds(int64_t{1} << index);
+}
+
+EventLoopMonitor::EventLoopMonitor() = default;
+
+EventLoopMonitor::~EventLoopMonitor() {
+  Stop();
+}
+
+void EventLoopMonitor::Start(const Options& options) {
+  Stop();
+
+  options_ = options;
+  queue_delay_ = LatencyHistogram();
+  uv_run_duration_ = LatencyHistogram();
+  long_tasks_.clear();
+  long_tasks_.reserve(options_.max_long_tasks);
+  next_long_task_ = 0;
+  task_depth_ = 0;
+
+  running_ = true;
+  base::CurrentThread::Get()->AddTaskObserver(this);
+  if (auto* node_bindings = ElectronBrowserMainParts::Get()->node_bindings()) {
+    node_bindings->set_uv_run_callback(base::BindRepeating(
+        &EventLoopMonitor::OnUvRun, weak_factory_.GetWeakPtr()));
+  }
+  probe_timer_.Start(FROM_HERE, options_.sample_interval,
+                     base::BindRepeating(&EventLoopMonitor::PostProbe,
+                                         base::Unretained(this)));
+}
+
+void EventLoopMonitor::Stop() {
+  if (!running_)
+    return;
+
+  running_ = false;
+  probe_timer_.Stop();
+  base::CurrentThread::Get()->RemoveTaskObserver(this);
+  if (auto* main_parts = ElectronBrowserMainParts::Get()) {
+    if (auto* node_bindings = main_parts->node_bindings())
+      node_bindings->set_uv_run_callback({});
+  }
+  // Drops the probes that are still queued.
+  weak_factory_.InvalidateWeakPtrs();
+}
+
+std::vector<LongTask> EventLoopMonitor::GetLongTasks() const {
+  std::vector<LongTask> result;
+  result.reserve(long_tasks_.size());
+  // Once full, |next_long_task_| is the index of the oldest one.
+  for (size_t i = 0; i < long_tasks_.size(); ++i)
+    result.push_back(
+        long_tasks_[(next_long_task_ + i) % long_tasks_.size()]);
+  return result;
+}
+
+void EventLoopMonitor::WillProcessTask(const base::PendingTask& pending_task,
+                                       bool was_blocked_or_low_priority) {
+  if (task_depth_++ == 0)
+    task_start_ = base::TimeTicks::Now();
+}
+
+void EventLoopMonitor::DidProcessTask(const base::PendingTask& pending_task) {
+  // Monitoring started from inside this task.
+  if (task_depth_ == 0)
+    return;
+  if (--task_depth_ != 0)
+    return;
+
+  const base::TimeDelta duration = base::TimeTicks::Now() - task_start_;
+  if (duration < options_.long_task_threshold)
+    return;
+
+  LongTask task{base::Time::Now() - duration, duration,
+                pending_task.posted_from};
+  if (long_tasks_.size() < options_.max_long_tasks) {
+    long_tasks_.push_back(std::move(task));
+  } else {
+    long_tasks_[next_long_task_] = std::move(task);
+    next_long_task_ = (next_long_task_ + 1) % long_tasks_.size();
+  }
+
+  if (options_.trace_events) {
+    TRACE_EVENT_INSTANT2("electron", "EventLoopMonitor::LongTask",
+                         TRACE_EVENT_SCOPE_THREAD, "duration_us",
+                         duration.InMicroseconds(), "posted_from",
+                         pending_task.posted_from.ToString());
+  }
+}
+
+void EventLoopMonitor::PostProbe() {
+  base::SingleThreadTaskRunner::GetCurrentDefault()->PostTask(
+      FROM_HERE, base::BindOnce(&EventLoopMonitor::OnProbe,
+                                weak_factory_.GetWeakPtr(),
+                                base::TimeTicks::Now()));
+}
+
+void EventLoopMonitor::OnProbe(base::TimeTicks posted_at) {
+  const base::TimeDelta delay = base::TimeTicks::Now() - posted_at;
+  queue_delay_.Add(delay);
+  if (options_.trace_events) {
+    TRACE_COUNTER1("electron", "EventLoopMonitor::QueueDelay",
+                   delay.InMicroseconds());
+  }
+}
+
+void EventLoopMonitor::OnUvRun(base::TimeDelta duration) {
+  uv_run_duration_.Add(duration);
+}
+
+}  // namespace electron
@@ -0,0 +1,104 @@
+// Copyright (c) 2024 Microsoft, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#ifndef ELECTRON_SHELL_BROWSER_API_EVENT_LOOP_MONITOR_H_
+#define ELECTRON_SHELL_BROWSER_API_EVENT_LOOP_MONITOR_H_
+
+#include <array>
+#include <string>
+#include <vector>
+
+#include "base/location.h"
+#include "base/memory/weak_ptr.h"
+#include "base/task/task_observer.h"
+#include "base/time/time.h"
+#include "base/timer/timer.h"
+
+namespace electron {
+
+// Durations bucketed by powers of two milliseconds: the first bucket holds
+// durations below 1ms, bucket i those in [2^(i-1), 2^i) ms and the last one
+// everything from 2^(kBucketCount-2) ms up.
+struct LatencyHistogram {
+  static constexpr size_t kBucketCount = 14;
+
+  void Add(base::TimeDelta duration);
+
+  // Upper bound of the |index|th bucket, infinite for the last one.
+  static base::TimeDelta BucketUpperBound(size_t index);
+
+  std::array<uint64_t, kBucketCount> buckets = {};
+  uint64_t count = 0;
+  base::TimeDelta total;
+  base::TimeDelta max;
+};
+
+struct LongTask {
+  base::Time time;
+  base::TimeDelta duration;
+  base::Location posted_from;
+};
+
+// Measures how responsive the main thread is: the delay of tasks posted to
+// its default queue, the tasks that run for longer than a threshold, and the
+// time spent in each run of the Node.js event loop.
+class EventLoopMonitor : public base::TaskObserver {
+ public:
+  struct Options {
+    base::TimeDelta sample_interval = base::Milliseconds(100);
+    base::TimeDelta long_task_threshold = base::Milliseconds(50);
+    size_t max_long_tasks = 100;
+    bool trace_events = false;
+  };
+
+  EventLoopMonitor();
+  ~EventLoopMonitor() override;
+
+  // disable copy
+  EventLoopMonitor(const EventLoopMonitor&) = delete;
+  EventLoopMonitor& operator=(const EventLoopMonitor&) = delete;
+
+  // Starts monitoring with empty statistics, restarting if already running.
+  void Start(const Options& options);
+  void Stop();
+  bool IsRunning() const { return running_; }
+
+  const LatencyHistogram& queue_delay() const { return queue_delay_; }
+  const LatencyHistogram& uv_run_duration() const { return uv_run_duration_; }
+  // The most recent long tasks, oldest first.
+  std::vector<LongTask> GetLongTasks() const;
+
+ private:
+  // base::TaskObserver:
+  void WillProcessTask(const base::PendingTask& pending_task,
+                       bool was_blocked_or_low_priority) override;
+  void DidProcessTask(const base::PendingTask& pending_task) override;
+
+  void PostProbe();
+  void OnProbe(base::TimeTicks posted_at);
+  void OnUvRun(base::TimeDelta duration);
+
+  Options options_;
+  bool running_ = false;
+
+  // Posts a probe task every |options_.sample_interval|, how late it runs
+  // is the queue delay.
+  base::RepeatingTimer probe_timer_;
+
+  // Tasks can nest, only the outermost one is timed.
+  int task_depth_ = 0;
+  base::TimeTicks task_start_;
+
+  LatencyHistogram queue_delay_;
+  LatencyHistogram uv_run_duration_;
+
+  std::vector<LongTask> long_tasks_;
+  size_t next_long_task_ = 0;
+
+  base::WeakPtrFactory<EventLoopMonitor> weak_factory_{this};
+};
+
+}  // namespace electron
+
+#endif  // ELECTRON_SHELL_BROWSER_API_EVENT_LOOP_MONITOR_H_
@@ -0,0 +1,156 @@
+// Copyright (c) 2024 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#include "shell/browser/api/frame_encoder.h"
+
+#include <utility>
+
+#include "base/functional/bind.h"
+#include "base/functional/callback_helpers.h"
+#include "media/base/bitrate.h"
+#include "media/base/video_frame.h"
+#include "media/media_buildflags.h"
+
+#if BUILDFLAG(ENABLE_LIBVPX)
+#include "media/video/vpx_video_encoder.h"
+#endif
+
+#if BUILDFLAG(ENABLE_OPENH264)
+#include "media/video/openh264_video_encoder.h"
+#endif
+
+#if BUILDFLAG(ENABLE_LIBAOM)
+#include "media/video/av1_video_encoder.h"
+#endif
+
+namespace electron::api {
+
+namespace {
+
+std::unique_ptr<media::VideoEncoder> CreateEncoder(media::VideoCodec codec) {
+  switch (codec) {
+#if BUILDFLAG(ENABLE_LIBVPX)
+    case media::VideoCodec::kVP8:
+    case media::VideoCodec::kVP9:
+      return std::make_unique<media::VpxVideoEncoder>();
+#endif
+#if BUILDFLAG(ENABLE_OPENH264)
+    case media::VideoCodec::kH264:
+      return std::make_unique<media::OpenH264VideoEncoder>();
+#endif
+#if BUILDFLAG(ENABLE_LIBAOM)
+    case media::VideoCodec::kAV1:
+      return std::make_unique<media::Av1VideoEncoder>();
+#endif
+    default:
+      return nullptr;
+  }
+}
+
+media::VideoCodecProfile GetProfile(media::VideoCodec codec) {
+  switch (codec) {
+    case media::VideoCodec::kVP8:
+      return media::VP8PROFILE_ANY;
+    case media::VideoCodec::kVP9:
+      return media::VP9PROFILE_PROFILE0;
+    case media::VideoCodec::kH264:
+      return media::H264PROFILE_BASELINE;
+    case media::VideoCodec::kAV1:
+      return media::AV1PROFILE_PROFILE_MAIN;
+    default:
+      return media::VIDEO_CODEC_PROFILE_UNKNOWN;
+  }
+}
+
+}  // namespace
+
+FrameEncoder::Chunk::Chunk() = default;
+FrameEncoder::Chunk::Chunk(Chunk&&) = default;
+FrameEncoder::Chunk::~Chunk() = default;
+
+// static
+bool FrameEncoder::IsCodecSupported(media::VideoCodec codec) {
+  switch (codec) {
+#if BUILDFLAG(ENABLE_LIBVPX)
+    case media::VideoCodec::kVP8:
+    case media::VideoCodec::kVP9:
+      return true;
+#endif
+#if BUILDFLAG(ENABLE_OPENH264)
+    case media::VideoCodec::kH264:
+      return true;
+#endif
+#if BUILDFLAG(ENABLE_LIBAOM)
+    case media::VideoCodec::kAV1:
+      return true;
+#endif
+    default:
+      return false;
+  }
+}
+
+FrameEncoder::FrameEncoder(media::VideoCodec codec,
+                           const gfx::Size& size,
+                           int frame_rate,
+                           std::optional<uint32_t> bitrate,
+                           ChunkCallback chunk_callback,
+                           ErrorCallback error_callback)
+    : encoder_(CreateEncoder(codec)),
+      chunk_callback_(std::move(chunk_callback)),
+      error_callback_(std::move(error_callback)) {
+  if (!encoder_) {
+    std::move(error_callback_).Run("Unsupported codec");
+    return;
+  }
+
+  media::VideoEncoder::Options options;
+  options.frame_size = size;
+  options.framerate = frame_rate;
+  if (bitrate)
+    options.bitrate = media::Bitrate::ConstantBitrate(*bitrate);
+  // Recordings should be seekable without requesting key frames by hand.
+  options.keyframe_interval = frame_rate * 2;
+  options.latency_mode = media::VideoEncoder::LatencyMode::Realtime;
+  // Keep the parameter sets in the stream so every chunk can be muxed alone.
+  options.avc.produce_annexb = true;
+
+  encoder_->Initialize(
+      GetProfile(codec), options, base::DoNothing(),
+      base::BindRepeating(&FrameEncoder::OnOutput,
+                          weak_ptr_factory_.GetWeakPtr()),
+      base::BindOnce(&FrameEncoder::OnStatus,
+                     weak_ptr_factory_.GetWeakPtr()));
+}
+
+FrameEncoder::~FrameEncoder() = default;
+
+void FrameEncoder::Encode(scoped_refptr<media::VideoFrame> frame,
+                          bool key_frame) {
+  if (!encoder_)
+    return;
+  encoder_->Encode(std::move(frame),
+                   media::VideoEncoder::EncodeOptions(key_frame),
+                   base::BindOnce(&FrameEncoder::OnStatus,
+                                  weak_ptr_factory_.GetWeakPtr()));
+}
+
+void FrameEncoder::OnOutput(
+    media::VideoEncoderOutput output,
+    std::optional<media::VideoEncoder::CodecDescription> description) {
+  Chunk chunk;
+  chunk.data.assign(output.data.get(), output.data.get() + output.size);
+  chunk.timestamp = output.timestamp;
+  chunk.key_frame = output.key_frame;
+  chunk_callback_.Run(std::move(chunk));
+}
+
+void FrameEncoder::OnStatus(media::EncoderStatus status) {
+  if (status.is_ok() || !encoder_)
+    return;
+  encoder_.reset();
+  if (error_callback_)
+    std::move(error_callback_).Run(status.message());
+}
+
+}  // namespace electron::api
@@ -0,0 +1,76 @@
+// Copyright (c) 2024 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#ifndef ELECTRON_SHELL_BROWSER_API_FRAME_ENCODER_H_
+#define ELECTRON_SHELL_BROWSER_API_FRAME_ENCODER_H_
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "base/functional/callback.h"
+#include "base/memory/scoped_refptr.h"
+#include "base/memory/weak_ptr.h"
+#include "base/time/time.h"
+#include "media/base/encoder_status.h"
+#include "media/base/video_codecs.h"
+#include "media/base/video_encoder.h"
+#include "ui/gfx/geometry/size.h"
+
+namespace media {
+class VideoFrame;
+}  // namespace media
+
+namespace electron::api {
+
+// Encodes the frames of a FrameSubscriber with the video encoders that media
+// provides for WebCodecs. Lives on its own sequence.
+class FrameEncoder {
+ public:
+  struct Chunk {
+    Chunk();
+    Chunk(Chunk&&);
+    ~Chunk();
+
+    std::vector<uint8_t> data;
+    base::TimeDelta timestamp;
+    bool key_frame = false;
+  };
+
+  using ChunkCallback = base::RepeatingCallback<void(Chunk chunk)>;
+  using ErrorCallback = base::OnceCallback<void(const std::string& message)>;
+
+  static bool IsCodecSupported(media::VideoCodec codec);
+
+  FrameEncoder(media::VideoCodec codec,
+               const gfx::Size& size,
+               int frame_rate,
+               std::optional<uint32_t> bitrate,
+               ChunkCallback chunk_callback,
+               ErrorCallback error_callback);
+  ~FrameEncoder();
+
+  // disable copy
+  FrameEncoder(const FrameEncoder&) = delete;
+  FrameEncoder& operator=(const FrameEncoder&) = delete;
+
+  void Encode(scoped_refptr<media::VideoFrame> frame, bool key_frame);
+
+ private:
+  void OnOutput(
+      media::VideoEncoderOutput output,
+      std::optional<media::VideoEncoder::CodecDescription> description);
+  void OnStatus(media::EncoderStatus status);
+
+  std::unique_ptr<media::VideoEncoder> encoder_;
+  ChunkCallback chunk_callback_;
+  ErrorCallback error_callback_;
+
+  base::WeakPtrFactory<FrameEncoder> weak_ptr_factory_{this};
+};
+
+}  // namespace electron::api
+
+#endif  // ELECTRON_SHELL_BROWSER_API_FRAME_ENCODER_H_
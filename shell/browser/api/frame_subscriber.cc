@@ -4,29 +4,73 @@
 
 #include "shell/browser/api/frame_subscriber.h"
 
+#include <string_view>
 #include <utility>
+#include <vector>
 
+#include "base/functional/bind.h"
+#include "base/functional/callback_helpers.h"
+#include "base/memory/shared_memory_mapping.h"
+#include "base/task/bind_post_task.h"
+#include "base/task/thread_pool.h"
+#include "content/public/browser/browser_task_traits.h"
+#include "content/public/browser/browser_thread.h"
 #include "content/public/browser/render_view_host.h"
 #include "content/public/browser/render_widget_host.h"
 #include "content/public/browser/render_widget_host_view.h"
+#include "media/base/video_frame.h"
 #include "media/capture/mojom/video_capture_buffer.mojom.h"
 #include "media/capture/mojom/video_capture_types.mojom.h"
 #include "mojo/public/cpp/bindings/remote.h"
 #include "services/viz/privileged/mojom/compositing/frame_sink_video_capture.mojom-shared.h"
+#include "shell/browser/javascript_environment.h"
+#include "shell/common/gin_converters/gfx_converter.h"
+#include "shell/common/gin_converters/image_converter.h"
+#include "shell/common/gin_helper/dictionary.h"
+#include "shell/common/node_includes.h"
 #include "ui/gfx/geometry/size_conversions.h"
 #include "ui/gfx/image/image.h"
-#include "ui/gfx/skbitmap_operations.h"
 
 namespace electron::api {
 
-constexpr static int kMaxFrameRate = 30;
+namespace {
+
+size_t GetPlaneStride(const ::media::mojom::VideoFrameInfo& info,
+                      size_t plane) {
+  return info.strides ? info.strides->stride_by_plane[plane]
+                      : media::VideoFrame::RowBytes(plane, info.pixel_format,
+                                                    info.coded_size.width());
+}
+
+size_t GetPlaneSize(const ::media::mojom::VideoFrameInfo& info, size_t plane) {
+  return GetPlaneStride(info, plane) *
+         media::VideoFrame::Rows(plane, info.pixel_format,
+                                 info.coded_size.height());
+}
+
+std::string_view GetCodecName(media::VideoCodec codec) {
+  switch (codec) {
+    case media::VideoCodec::kVP8:
+      return "vp8";
+    case media::VideoCodec::kVP9:
+      return "vp9";
+    case media::VideoCodec::kH264:
+      return "h264";
+    case media::VideoCodec::kAV1:
+      return "av1";
+    default:
+      return "";
+  }
+}
+
+}  // namespace
 
 FrameSubscriber::FrameSubscriber(content::WebContents* web_contents,
                                  const FrameCaptureCallback& callback,
-                                 bool only_dirty)
+                                 const Options& options)
     : content::WebContentsObserver(web_contents),
       callback_(callback),
-      only_dirty_(only_dirty) {
+      options_(options) {
   AttachToHost(web_contents->GetPrimaryMainFrame()->GetRenderWidgetHost());
 }
 
@@ -41,14 +85,14 @@ void FrameSubscriber::AttachToHost(content::RenderWidgetHost* host) {
     return;
 
   // Create and configure the video capturer.
-  gfx::Size size = GetRenderViewSize();
+  gfx::Size size = GetCaptureSize();
   DCHECK(!size.IsEmpty());
   video_capturer_ = host_->GetView()->CreateVideoCapturer();
   video_capturer_->SetResolutionConstraints(size, size, true);
   video_capturer_->SetAutoThrottlingEnabled(false);
   video_capturer_->SetMinSizeChangePeriod(base::TimeDelta());
-  video_capturer_->SetFormat(media::PIXEL_FORMAT_ARGB);
-  video_capturer_->SetMinCapturePeriod(base::Seconds(1) / kMaxFrameRate);
+  video_capturer_->SetFormat(options_.pixel_format);
+  video_capturer_->SetMinCapturePeriod(base::Seconds(1) / options_.frame_rate);
   video_capturer_->Start(this, viz::mojom::BufferFormatPreference::kDefault);
 }
 
@@ -87,11 +131,15 @@ void FrameSubscriber::OnFrameCaptured(
         callbacks) {
   auto& data_region = data->get_read_only_shmem_region();
 
-  gfx::Size size = GetRenderViewSize();
-  if (size != content_rect.size()) {
-    video_capturer_->SetResolutionConstraints(size, size, true);
-    video_capturer_->RequestRefreshFrame();
-    return;
+  // With a fixed target size the content is letterboxed into it, so only
+  // follow the size of the render view.
+  if (options_.size.IsEmpty()) {
+    gfx::Size size = GetRenderViewSize();
+    if (size != content_rect.size()) {
+      video_capturer_->SetResolutionConstraints(size, size, true);
+      video_capturer_->RequestRefreshFrame();
+      return;
+    }
   }
 
   mojo::Remote<viz::mojom::FrameSinkVideoConsumerFrameCallbacks>
@@ -111,6 +159,17 @@ void FrameSubscriber::OnFrameCaptured(
     return;
   }
 
+  if (options_.codec) {
+    EncodeFrame(std::move(mapping), *info, callbacks_remote.Unbind());
+    return;
+  }
+
+  if (info->pixel_format != media::PIXEL_FORMAT_ARGB) {
+    DonePlanar(content_rect, mapping, *info);
+    callbacks_remote->Done();
+    return;
+  }
+
   // The SkBitmap's pixels will be marked as immutable, but the installPixels()
   // API requires a non-const pointer. So, cast away the const.
   void* const pixels = const_cast<void*>(mapping.memory());
@@ -126,9 +185,11 @@ void FrameSubscriber::OnFrameCaptured(
     mojo::Remote<viz::mojom::FrameSinkVideoConsumerFrameCallbacks> releaser;
   };
 
+  // The bitmap covers the whole frame, |content_rect| is where the content
+  // was drawn into it.
   SkBitmap bitmap;
   bitmap.installPixels(
-      SkImageInfo::MakeN32(content_rect.width(), content_rect.height(),
+      SkImageInfo::MakeN32(info->coded_size.width(), info->coded_size.height(),
                            kPremul_SkAlphaType),
       pixels,
       media::VideoFrame::RowBytes(media::VideoFrame::kARGBPlane,
@@ -139,7 +200,8 @@ void FrameSubscriber::OnFrameCaptured(
       new FramePinner{std::move(mapping), std::move(callbacks_remote)});
   bitmap.setImmutable();
 
-  Done(content_rect, bitmap);
+  Done(content_rect, info->metadata.capture_update_rect.value_or(content_rect),
+       bitmap);
 }
 
 void FrameSubscriber::OnNewSubCaptureTargetVersion(uint32_t crop_version) {}
@@ -150,26 +212,153 @@ void FrameSubscriber::OnStopped() {}
 
 void FrameSubscriber::OnLog(const std::string& message) {}
 
-void FrameSubscriber::Done(const gfx::Rect& damage, const SkBitmap& frame) {
+void FrameSubscriber::Done(const gfx::Rect& content_rect,
+                           const gfx::Rect& damage,
+                           const SkBitmap& frame) {
   if (frame.drawsNothing())
     return;
 
-  const SkBitmap& bitmap = only_dirty_ ? SkBitmapOperations::CreateTiledBitmap(
-                                             frame, damage.x(), damage.y(),
-                                             damage.width(), damage.height())
-                                       : frame;
+  // Both rects are in frame coordinates, the area that is copied out and
+  // reported is in content coordinates.
+  gfx::Rect rect = content_rect;
+  if (options_.only_dirty)
+    rect.Intersect(damage);
+  if (rect.IsEmpty())
+    return;
 
   // Copying SkBitmap does not copy the internal pixels, we have to manually
   // allocate and write pixels otherwise crash may happen when the original
-  // frame is modified.
+  // frame is modified. The dirty area is read straight out of the frame.
   SkBitmap copy;
-  copy.allocPixels(SkImageInfo::Make(bitmap.width(), bitmap.height(),
+  copy.allocPixels(SkImageInfo::Make(rect.width(), rect.height(),
                                      kN32_SkColorType, kPremul_SkAlphaType));
-  SkPixmap pixmap;
-  bool success = bitmap.peekPixels(&pixmap) && copy.writePixels(pixmap, 0, 0);
+  bool success = frame.readPixels(copy.info(), copy.getPixels(),
+                                  copy.rowBytes(), rect.x(), rect.y());
   CHECK(success);
 
-  callback_.Run(gfx::Image::CreateFrom1xBitmap(copy), damage);
+  v8::Isolate* isolate = JavascriptEnvironment::GetIsolate();
+  v8::HandleScope handle_scope(isolate);
+  callback_.Run(gin::ConvertToV8(isolate, gfx::Image::CreateFrom1xBitmap(copy)),
+                rect - content_rect.OffsetFromOrigin());
+}
+
+void FrameSubscriber::DonePlanar(
+    const gfx::Rect& content_rect,
+    const base::ReadOnlySharedMemoryMapping& mapping,
+    const ::media::mojom::VideoFrameInfo& info) {
+  v8::Isolate* isolate = JavascriptEnvironment::GetIsolate();
+  v8::HandleScope handle_scope(isolate);
+
+  // The planes are laid out one after another in the shared memory. They have
+  // to be copied because the V8 sandbox doesn't allow external buffers.
+  std::vector<v8::Local<v8::Value>> planes;
+  const auto* data = mapping.GetMemoryAs<char>();
+  size_t offset = 0;
+  const size_t num_planes = media::VideoFrame::NumPlanes(info.pixel_format);
+  for (size_t plane = 0; plane < num_planes; ++plane) {
+    const size_t stride = GetPlaneStride(info, plane);
+    const size_t size = GetPlaneSize(info, plane);
+    if (offset + size > mapping.size())
+      return;
+    auto buffer = node::Buffer::Copy(isolate, data + offset, size);
+    if (buffer.IsEmpty())
+      return;
+    auto plane_info = gin_helper::Dictionary::CreateEmpty(isolate);
+    plane_info.Set("data", buffer.ToLocalChecked());
+    plane_info.Set("stride", static_cast<uint32_t>(stride));
+    planes.push_back(plane_info.GetHandle());
+    offset += size;
+  }
+
+  auto frame = gin_helper::Dictionary::CreateEmpty(isolate);
+  frame.Set("pixelFormat", "i420");
+  frame.Set("codedSize", info.coded_size);
+  frame.Set("visibleRect", content_rect);
+  frame.Set("timestamp", static_cast<double>(info.timestamp.InMicroseconds()));
+  frame.Set("planes", planes);
+  callback_.Run(frame.GetHandle(), content_rect);
+}
+
+void FrameSubscriber::EncodeFrame(
+    base::ReadOnlySharedMemoryMapping mapping,
+    const ::media::mojom::VideoFrameInfo& info,
+    mojo::PendingRemote<viz::mojom::FrameSinkVideoConsumerFrameCallbacks>
+        releaser) {
+  if (encoder_failed_)
+    return;
+
+  // The encoder is configured for one frame size, start a new stream when
+  // the page is resized.
+  const gfx::Size size = info.visible_rect.size();
+  if (encoder_.is_null() || size != encoder_size_) {
+    auto task_runner = content::GetUIThreadTaskRunner({});
+    encoder_ = base::SequenceBound<FrameEncoder>(
+        base::ThreadPool::CreateSequencedTaskRunner(
+            {base::TaskPriority::USER_VISIBLE}),
+        *options_.codec, size, options_.frame_rate, options_.bitrate,
+        base::BindPostTask(task_runner,
+                           base::BindRepeating(&FrameSubscriber::OnEncodedChunk,
+                                               weak_ptr_factory_.GetWeakPtr())),
+        base::BindPostTask(task_runner,
+                           base::BindOnce(&FrameSubscriber::OnEncoderError,
+                                          weak_ptr_factory_.GetWeakPtr())));
+    encoder_size_ = size;
+    key_frame_requested_ = true;
+  }
+
+  const size_t y_size = GetPlaneSize(info, media::VideoFrame::kYPlane);
+  const size_t u_size = GetPlaneSize(info, media::VideoFrame::kUPlane);
+  const size_t v_size = GetPlaneSize(info, media::VideoFrame::kVPlane);
+  if (y_size + u_size + v_size > mapping.size())
+    return;
+
+  // Wrap the shared memory instead of copying it, the capturer gets the
+  // buffer back once the encoder drops the frame.
+  const auto* data = mapping.GetMemoryAs<uint8_t>();
+  scoped_refptr<media::VideoFrame> frame =
+      media::VideoFrame::WrapExternalYuvData(
+          info.pixel_format, info.coded_size, info.visible_rect,
+          info.visible_rect.size(),
+          GetPlaneStride(info, media::VideoFrame::kYPlane),
+          GetPlaneStride(info, media::VideoFrame::kUPlane),
+          GetPlaneStride(info, media::VideoFrame::kVPlane), data,
+          data + y_size, data + y_size + u_size, info.timestamp);
+  if (!frame)
+    return;
+  frame->AddDestructionObserver(
+      base::DoNothingWithBoundArgs(std::move(mapping), std::move(releaser)));
+
+  encoder_.AsyncCall(&FrameEncoder::Encode)
+      .WithArgs(std::move(frame), std::exchange(key_frame_requested_, false));
+}
+
+void FrameSubscriber::OnEncodedChunk(FrameEncoder::Chunk chunk) {
+  v8::Isolate* isolate = JavascriptEnvironment::GetIsolate();
+  v8::HandleScope handle_scope(isolate);
+
+  auto buffer = node::Buffer::Copy(
+      isolate, reinterpret_cast<const char*>(chunk.data.data()),
+      chunk.data.size());
+  if (buffer.IsEmpty())
+    return;
+
+  auto encoded = gin_helper::Dictionary::CreateEmpty(isolate);
+  encoded.Set("codec", GetCodecName(*options_.codec));
+  encoded.Set("data", buffer.ToLocalChecked());
+  encoded.Set("timestamp",
+              static_cast<double>(chunk.timestamp.InMicroseconds()));
+  encoded.Set("keyFrame", chunk.key_frame);
+  callback_.Run(encoded.GetHandle(), gfx::Rect(encoder_size_));
+}
+
+void FrameSubscriber::OnEncoderError(const std::string& message) {
+  LOG(ERROR) << "Failed to encode captured frames: " << message;
+  encoder_failed_ = true;
+  encoder_.Reset();
+}
+
+gfx::Size FrameSubscriber::GetCaptureSize() const {
+  return options_.size.IsEmpty() ? GetRenderViewSize() : options_.size;
 }
 
 gfx::Size FrameSubscriber::GetRenderViewSize() const {
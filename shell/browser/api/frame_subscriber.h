@@ -6,18 +6,28 @@
 #define ELECTRON_SHELL_BROWSER_API_FRAME_SUBSCRIBER_H_
 
 #include <memory>
+#include <optional>
 #include <string>
 
 #include "base/functional/callback.h"
 #include "base/memory/raw_ptr.h"
 #include "base/memory/weak_ptr.h"
+#include "base/threading/sequence_bound.h"
 #include "components/viz/host/client_frame_sink_video_capturer.h"
 #include "content/public/browser/web_contents.h"
 #include "content/public/browser/web_contents_observer.h"
+#include "media/base/video_codecs.h"
+#include "media/base/video_types.h"
 #include "media/capture/mojom/video_capture_buffer.mojom-forward.h"
 #include "mojo/public/cpp/bindings/pending_remote.h"
+#include "shell/browser/api/frame_encoder.h"
+#include "ui/gfx/geometry/size.h"
 #include "v8/include/v8.h"
 
+namespace base {
+class ReadOnlySharedMemoryMapping;
+}  // namespace base
+
 namespace gfx {
 class Image;
 class Rect;
@@ -30,12 +40,31 @@ class WebContents;
 class FrameSubscriber : public content::WebContentsObserver,
                         public viz::mojom::FrameSinkVideoConsumer {
  public:
+  // Receives either a NativeImage or, for planar formats, an object holding
+  // the planes of the frame.
   using FrameCaptureCallback =
-      base::RepeatingCallback<void(const gfx::Image&, const gfx::Rect&)>;
+      base::RepeatingCallback<void(v8::Local<v8::Value>, const gfx::Rect&)>;
+
+  static constexpr int kDefaultFrameRate = 30;
+  static constexpr int kMaxFrameRate = 240;
+
+  struct Options {
+    bool only_dirty = false;
+    int frame_rate = kDefaultFrameRate;
+    // Either PIXEL_FORMAT_ARGB or PIXEL_FORMAT_I420.
+    media::VideoPixelFormat pixel_format = media::PIXEL_FORMAT_ARGB;
+    // Frames are scaled to fit in this size, in pixels. When empty the size
+    // of the render view is used.
+    gfx::Size size;
+    // When set, I420 frames are encoded and the callback receives the
+    // encoded chunks.
+    std::optional<media::VideoCodec> codec;
+    std::optional<uint32_t> bitrate;
+  };
 
   FrameSubscriber(content::WebContents* web_contents,
                   const FrameCaptureCallback& callback,
-                  bool only_dirty);
+                  const Options& options);
   ~FrameSubscriber() override;
 
   // disable copy
@@ -62,17 +91,38 @@ class FrameSubscriber : public content::WebContentsObserver,
   void OnStopped() override;
   void OnLog(const std::string& message) override;
 
-  void Done(const gfx::Rect& damage, const SkBitmap& frame);
+  void Done(const gfx::Rect& content_rect,
+            const gfx::Rect& damage,
+            const SkBitmap& frame);
+  void DonePlanar(const gfx::Rect& content_rect,
+                  const base::ReadOnlySharedMemoryMapping& mapping,
+                  const ::media::mojom::VideoFrameInfo& info);
+
+  void EncodeFrame(
+      base::ReadOnlySharedMemoryMapping mapping,
+      const ::media::mojom::VideoFrameInfo& info,
+      mojo::PendingRemote<viz::mojom::FrameSinkVideoConsumerFrameCallbacks>
+          releaser);
+  void OnEncodedChunk(FrameEncoder::Chunk chunk);
+  void OnEncoderError(const std::string& message);
+
+  // Get the size the capturer should produce.
+  gfx::Size GetCaptureSize() const;
 
   // Get the pixel size of render view.
   gfx::Size GetRenderViewSize() const;
 
   FrameCaptureCallback callback_;
-  bool only_dirty_;
+  const Options options_;
 
   raw_ptr<content::RenderWidgetHost> host_;
   std::unique_ptr<viz::ClientFrameSinkVideoCapturer> video_capturer_;
 
+  base::SequenceBound<FrameEncoder> encoder_;
+  gfx::Size encoder_size_;
+  bool key_frame_requested_ = true;
+  bool encoder_failed_ = false;
+
   base::WeakPtrFactory<FrameSubscriber> weak_ptr_factory_{this};
 };
 
@@ -15,6 +15,22 @@
 
 namespace electron {
 
+namespace {
+
+base::Value::Dict SelectKeys(const base::Value::Dict& info,
+                             const GPUInfoManager::Keys& keys) {
+  if (!keys)
+    return info.Clone();
+  base::Value::Dict selected;
+  for (const auto& key : *keys) {
+    if (const base::Value* value = info.Find(key))
+      selected.Set(key, value->Clone());
+  }
+  return selected;
+}
+
+}  // namespace
+
 GPUInfoManager* GPUInfoManager::GetInstance() {
   return base::Singleton<GPUInfoManager>::get();
 }
@@ -28,44 +44,74 @@ GPUInfoManager::~GPUInfoManager() {
   content::GpuDataManagerImpl::GetInstance()->RemoveObserver(this);
 }
 
+GPUInfoManager::PendingRequest::PendingRequest(
+    gin_helper::Promise<base::Value> promise,
+    Keys keys)
+    : promise(std::move(promise)), keys(std::move(keys)) {}
+GPUInfoManager::PendingRequest::PendingRequest(PendingRequest&&) = default;
+GPUInfoManager::PendingRequest& GPUInfoManager::PendingRequest::operator=(
+    PendingRequest&&) = default;
+GPUInfoManager::PendingRequest::~PendingRequest() = default;
+
 // Should be posted to the task runner
 void GPUInfoManager::ProcessCompleteInfo() {
-  base::Value::Dict result = EnumerateGPUInfo(gpu_data_manager_->GetGPUInfo());
+  if (complete_info_promise_set_.empty())
+    return;
+
+  complete_info_collected_ = true;
+  if (!complete_info_)
+    complete_info_ = EnumerateGPUInfo(gpu_data_manager_->GetGPUInfo());
   // We have received the complete information, resolve all promises that
   // were waiting for this info.
-  for (auto& promise : complete_info_promise_set_) {
-    promise.Resolve(base::Value(result.Clone()));
+  for (auto& request : complete_info_promise_set_) {
+    request.promise.Resolve(
+        base::Value(SelectKeys(*complete_info_, request.keys)));
   }
   complete_info_promise_set_.clear();
 }
 
 void GPUInfoManager::OnGpuInfoUpdate() {
+  complete_info_.reset();
+  basic_info_.reset();
   base::SingleThreadTaskRunner::GetCurrentDefault()->PostTask(
       FROM_HERE, base::BindOnce(&GPUInfoManager::ProcessCompleteInfo,
                                 base::Unretained(this)));
 }
 
 // Should be posted to the task runner
-void GPUInfoManager::CompleteInfoFetcher(
-    gin_helper::Promise<base::Value> promise) {
-  complete_info_promise_set_.emplace_back(std::move(promise));
+void GPUInfoManager::CompleteInfoFetcher(PendingRequest request) {
+  if (complete_info_collected_) {
+    if (!complete_info_)
+      complete_info_ = EnumerateGPUInfo(gpu_data_manager_->GetGPUInfo());
+    request.promise.Resolve(
+        base::Value(SelectKeys(*complete_info_, request.keys)));
+    return;
+  }
+
+  complete_info_promise_set_.push_back(std::move(request));
   gpu_data_manager_->RequestDx12VulkanVideoGpuInfoIfNeeded(
       content::GpuDataManagerImpl::kGpuInfoRequestAll, /* delayed */ false);
 }
 
-void GPUInfoManager::FetchCompleteInfo(
-    gin_helper::Promise<base::Value> promise) {
+void GPUInfoManager::FetchCompleteInfo(gin_helper::Promise<base::Value> promise,
+                                       Keys keys) {
   base::SingleThreadTaskRunner::GetCurrentDefault()->PostTask(
-      FROM_HERE, base::BindOnce(&GPUInfoManager::CompleteInfoFetcher,
-                                base::Unretained(this), std::move(promise)));
+      FROM_HERE,
+      base::BindOnce(&GPUInfoManager::CompleteInfoFetcher,
+                     base::Unretained(this),
+                     PendingRequest(std::move(promise), std::move(keys))));
 }
 
 // This fetches the info synchronously, so no need to post to the task queue.
 // There cannot be multiple promises as they are resolved synchronously.
-void GPUInfoManager::FetchBasicInfo(gin_helper::Promise<base::Value> promise) {
-  gpu::GPUInfo gpu_info;
-  CollectBasicGraphicsInfo(&gpu_info);
-  promise.Resolve(base::Value(EnumerateGPUInfo(gpu_info)));
+void GPUInfoManager::FetchBasicInfo(gin_helper::Promise<base::Value> promise,
+                                    Keys keys) {
+  if (!basic_info_) {
+    gpu::GPUInfo gpu_info;
+    CollectBasicGraphicsInfo(&gpu_info);
+    basic_info_ = EnumerateGPUInfo(gpu_info);
+  }
+  promise.Resolve(base::Value(SelectKeys(*basic_info_, keys)));
 }
 
 base::Value::Dict GPUInfoManager::EnumerateGPUInfo(
@@ -5,6 +5,8 @@
 #ifndef ELECTRON_SHELL_BROWSER_API_GPUINFO_MANAGER_H_
 #define ELECTRON_SHELL_BROWSER_API_GPUINFO_MANAGER_H_
 
+#include <optional>
+#include <string>
 #include <vector>
 
 #include "base/memory/raw_ptr.h"
@@ -27,21 +29,44 @@ class GPUInfoManager : public content::GpuDataManagerObserver {
   GPUInfoManager(const GPUInfoManager&) = delete;
   GPUInfoManager& operator=(const GPUInfoManager&) = delete;
 
-  void FetchCompleteInfo(gin_helper::Promise<base::Value> promise);
-  void FetchBasicInfo(gin_helper::Promise<base::Value> promise);
+  // Only the top-level |keys| of the info are resolved when set.
+  using Keys = std::optional<std::vector<std::string>>;
+
+  void FetchCompleteInfo(gin_helper::Promise<base::Value> promise,
+                         Keys keys = std::nullopt);
+  void FetchBasicInfo(gin_helper::Promise<base::Value> promise,
+                      Keys keys = std::nullopt);
   void OnGpuInfoUpdate() override;
 
  private:
+  struct PendingRequest {
+    PendingRequest(gin_helper::Promise<base::Value> promise, Keys keys);
+    PendingRequest(PendingRequest&&);
+    PendingRequest& operator=(PendingRequest&&);
+    ~PendingRequest();
+
+    gin_helper::Promise<base::Value> promise;
+    Keys keys;
+  };
+
   base::Value::Dict EnumerateGPUInfo(gpu::GPUInfo gpu_info) const;
 
   // These should be posted to the task queue
-  void CompleteInfoFetcher(gin_helper::Promise<base::Value> promise);
+  void CompleteInfoFetcher(PendingRequest request);
   void ProcessCompleteInfo();
 
   // This set maintains all the promises that should be fulfilled
   // once we have the complete information data
-  std::vector<gin_helper::Promise<base::Value>> complete_info_promise_set_;
+  std::vector<PendingRequest> complete_info_promise_set_;
   raw_ptr<content::GpuDataManagerImpl> gpu_data_manager_;
+
+  // The enumerated infos, kept until the GPU info is updated so that repeated
+  // queries neither enumerate it again nor ask the GPU process to collect it.
+  std::optional<base::Value::Dict> complete_info_;
+  std::optional<base::Value::Dict> basic_info_;
+  // Whether the complete info has been collected once, after which
+  // GpuDataManager always holds the complete info.
+  bool complete_info_collected_ = false;
 };
 
 }  // namespace electron
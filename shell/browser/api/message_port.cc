@@ -9,6 +9,7 @@
 #include <utility>
 
 #include "base/containers/contains.h"
+#include "base/functional/bind.h"
 #include "base/strings/string_number_conversions.h"
 #include "base/task/single_thread_task_runner.h"
 #include "gin/arguments.h"
@@ -76,31 +77,13 @@ void MessagePort::PostMessage(gin::Arguments* args) {
     return;
   }
 
-  electron::SerializeV8Value(args->isolate(), message_value,
-                             &transferable_message);
-
   v8::Local<v8::Value> transferables;
   std::vector<gin::Handle<MessagePort>> wrapped_ports;
-  if (args->GetNext(&transferables)) {
-    std::vector<v8::Local<v8::Value>> wrapped_port_values;
-    if (!gin::ConvertFromV8(args->isolate(), transferables,
-                            &wrapped_port_values)) {
-      thrower.ThrowTypeError("transferables must be an array of MessagePorts");
-      return;
-    }
-
-    for (unsigned i = 0; i < wrapped_port_values.size(); ++i) {
-      if (!IsValidWrappable(wrapped_port_values[i])) {
-        thrower.ThrowTypeError("Port at index " + base::NumberToString(i) +
-                               " is not a valid port");
-        return;
-      }
-    }
-
-    if (!gin::ConvertFromV8(args->isolate(), transferables, &wrapped_ports)) {
-      thrower.ThrowTypeError("Passed an invalid MessagePort");
-      return;
-    }
+  std::vector<v8::Local<v8::ArrayBuffer>> array_buffers;
+  if (args->GetNext(&transferables) &&
+      !ParseTransferables(args->isolate(), transferables, &wrapped_ports,
+                          &array_buffers)) {
+    return;
   }
 
   // Make sure we aren't connected to any of the passed-in ports.
@@ -112,6 +95,12 @@ void MessagePort::PostMessage(gin::Arguments* args) {
     }
   }
 
+  if (!electron::SerializeV8Value(args->isolate(), message_value,
+                                  array_buffers, &transferable_message)) {
+    // SerializeV8Value sets an exception.
+    return;
+  }
+
   bool threw_exception = false;
   transferable_message.ports = MessagePort::DisentanglePorts(
       args->isolate(), wrapped_ports, &threw_exception);
@@ -123,13 +112,17 @@ void MessagePort::PostMessage(gin::Arguments* args) {
   connector_->Accept(&mojo_message);
 }
 
-void MessagePort::Start() {
+void MessagePort::Start(gin::Arguments* args) {
   if (!IsEntangled())
     return;
 
   if (started_)
     return;
 
+  gin_helper::Dictionary options;
+  if (args->GetNext(&options))
+    options.Get("batch", &batch_messages_);
+
   started_ = true;
   if (HasPendingActivity())
     Pin();
@@ -139,6 +132,8 @@ void MessagePort::Start() {
 void MessagePort::Close() {
   if (closed_)
     return;
+  // Messages that were already read off the pipe still need to be delivered.
+  FlushPendingMessages();
   if (!IsNeutered()) {
     Disentangle().ReleaseHandle();
     blink::MessagePortDescriptorPair pipe;
@@ -179,6 +174,9 @@ void MessagePort::Entangle(blink::MessagePortChannel channel) {
 
 blink::MessagePortChannel MessagePort::Disentangle() {
   DCHECK(!IsNeutered());
+  // Queued messages can't be handed over with the pipe, so deliver them here
+  // before the port moves elsewhere.
+  FlushPendingMessages();
   port_.GiveDisentangledHandle(connector_->PassMessagePipe());
   connector_ = nullptr;
   if (!HasPendingActivity())
@@ -208,6 +206,37 @@ std::vector<gin::Handle<MessagePort>> MessagePort::EntanglePorts(
   return wrapped_ports;
 }
 
+// static
+bool MessagePort::ParseTransferables(
+    v8::Isolate* isolate,
+    v8::Local<v8::Value> transferables,
+    std::vector<gin::Handle<MessagePort>>* ports,
+    std::vector<v8::Local<v8::ArrayBuffer>>* array_buffers) {
+  gin_helper::ErrorThrower thrower(isolate);
+  std::vector<v8::Local<v8::Value>> values;
+  if (!gin::ConvertFromV8(isolate, transferables, &values)) {
+    thrower.ThrowTypeError(
+        "transferables must be an array of MessagePorts and ArrayBuffers");
+    return false;
+  }
+
+  for (unsigned i = 0; i < values.size(); ++i) {
+    if (values[i]->IsArrayBuffer()) {
+      array_buffers->push_back(values[i].As<v8::ArrayBuffer>());
+      continue;
+    }
+    gin::Handle<MessagePort> port;
+    if (!IsValidWrappable(values[i]) ||
+        !gin::ConvertFromV8(isolate, values[i], &port)) {
+      thrower.ThrowTypeError("Port at index " + base::NumberToString(i) +
+                             " is not a valid port");
+      return false;
+    }
+    ports->push_back(port);
+  }
+  return true;
+}
+
 // static
 std::vector<blink::MessagePortChannel> MessagePort::DisentanglePorts(
     v8::Isolate* isolate,
@@ -268,12 +297,26 @@ bool MessagePort::Accept(mojo::Message* mojo_message) {
     return false;
   }
 
+  if (batch_messages_) {
+    // The connector reads every message available on the pipe before
+    // returning to the message loop, so a task posted here runs once it has
+    // drained everything that was readable.
+    pending_messages_.push_back(std::move(message));
+    if (!flush_scheduled_) {
+      flush_scheduled_ = true;
+      base::SingleThreadTaskRunner::GetCurrentDefault()->PostTask(
+          FROM_HERE, base::BindOnce(&MessagePort::FlushPendingMessages,
+                                    weak_factory_.GetWeakPtr()));
+    }
+    return true;
+  }
+
   v8::Isolate* isolate = JavascriptEnvironment::GetIsolate();
   v8::HandleScope scope(isolate);
 
   auto ports = EntanglePorts(isolate, std::move(message.ports));
 
-  v8::Local<v8::Value> message_value = DeserializeV8Value(isolate, message);
+  v8::Local<v8::Value> message_value = DeserializeV8Value(isolate, &message);
 
   v8::Local<v8::Object> self;
   if (!GetWrapper(isolate).ToLocal(&self))
@@ -287,6 +330,33 @@ bool MessagePort::Accept(mojo::Message* mojo_message) {
   return true;
 }
 
+void MessagePort::FlushPendingMessages() {
+  flush_scheduled_ = false;
+  if (pending_messages_.empty())
+    return;
+
+  std::vector<blink::TransferableMessage> messages;
+  messages.swap(pending_messages_);
+
+  v8::Isolate* isolate = JavascriptEnvironment::GetIsolate();
+  v8::HandleScope scope(isolate);
+  v8::Local<v8::Object> self;
+  if (!GetWrapper(isolate).ToLocal(&self))
+    return;
+
+  v8::Local<v8::Context> context = isolate->GetCurrentContext();
+  v8::Local<v8::Array> events = v8::Array::New(isolate, messages.size());
+  for (size_t i = 0; i < messages.size(); ++i) {
+    auto ports = EntanglePorts(isolate, std::move(messages[i].ports));
+    auto event = gin::DataObjectBuilder(isolate)
+                     .Set("data", DeserializeV8Value(isolate, &messages[i]))
+                     .Set("ports", ports)
+                     .Build();
+    events->Set(context, i, event).Check();
+  }
+  gin_helper::EmitEvent(isolate, self, "message-batch", events);
+}
+
 gin::ObjectTemplateBuilder MessagePort::GetObjectTemplateBuilder(
     v8::Isolate* isolate) {
   return gin::Wrappable<MessagePort>::GetObjectTemplateBuilder(isolate)
@@ -14,6 +14,7 @@
 #include "shell/common/gin_helper/cleaned_up_at_exit.h"
 #include "third_party/blink/public/common/messaging/message_port_channel.h"
 #include "third_party/blink/public/common/messaging/message_port_descriptor.h"
+#include "third_party/blink/public/common/messaging/transferable_message.h"
 
 namespace gin {
 class Arguments;
@@ -32,7 +33,7 @@ class MessagePort : public gin::Wrappable<MessagePort>,
   static gin::Handle<MessagePort> Create(v8::Isolate* isolate);
 
   void PostMessage(gin::Arguments* args);
-  void Start();
+  void Start(gin::Arguments* args);
   void Close();
 
   void Entangle(blink::MessagePortDescriptor port);
@@ -47,6 +48,14 @@ class MessagePort : public gin::Wrappable<MessagePort>,
       v8::Isolate* isolate,
       std::vector<blink::MessagePortChannel> channels);
 
+  // Splits a JS transfer list into the MessagePorts and ArrayBuffers it
+  // contains. Throws and returns false if it contains anything else.
+  static bool ParseTransferables(
+      v8::Isolate* isolate,
+      v8::Local<v8::Value> transferables,
+      std::vector<gin::Handle<MessagePort>>* ports,
+      std::vector<v8::Local<v8::ArrayBuffer>>* array_buffers);
+
   static std::vector<blink::MessagePortChannel> DisentanglePorts(
       v8::Isolate* isolate,
       const std::vector<gin::Handle<MessagePort>>& ports,
@@ -76,10 +85,21 @@ class MessagePort : public gin::Wrappable<MessagePort>,
   // mojo::MessageReceiver
   bool Accept(mojo::Message* mojo_message) override;
 
+  // Emits everything in |pending_messages_| as a single 'message-batch'
+  // event.
+  void FlushPendingMessages();
+
   std::unique_ptr<mojo::Connector> connector_;
   bool started_ = false;
   bool closed_ = false;
 
+  // When set, messages read from |connector_| are queued and delivered
+  // together once the connector has drained the pipe, instead of emitting one
+  // 'message' event per message.
+  bool batch_messages_ = false;
+  bool flush_scheduled_ = false;
+  std::vector<blink::TransferableMessage> pending_messages_;
+
   v8::Global<v8::Value> pinned_;
 
   // The internal port owned by this class. The handle itself is moved into the
@@ -47,6 +47,86 @@ std::optional<mach_task_basic_info_data_t> GetTaskInfo(mach_port_t task) {
 
 #endif  // BUILDFLAG(IS_MAC)
 
+#if BUILDFLAG(IS_LINUX)
+#include <string_view>
+
+#include "base/files/file_path.h"
+#include "base/files/file_util.h"
+#include "base/functional/bind.h"
+#include "base/no_destructor.h"
+#include "base/strings/string_number_conversions.h"
+#include "base/strings/string_split.h"
+#include "base/strings/string_util.h"
+#include "base/strings/stringprintf.h"
+#include "base/task/sequenced_task_runner.h"
+#include "base/task/thread_pool.h"
+
+namespace {
+
+// /proc is read on one sequence shared by all processes, so sampling many of
+// them at once doesn't take up more than one worker.
+scoped_refptr<base::SequencedTaskRunner> GetProcReaderTaskRunner() {
+  static base::NoDestructor<scoped_refptr<base::SequencedTaskRunner>>
+      task_runner(base::ThreadPool::CreateSequencedTaskRunner(
+          {base::MayBlock(), base::TaskPriority::USER_VISIBLE,
+           base::TaskShutdownBehavior::CONTINUE_ON_SHUTDOWN}));
+  return *task_runner;
+}
+
+// Calls |callback| with the name and value in bytes of each "Name: N kB"
+// line of the /proc/<pid>/|file| file.
+template <typename Callback>
+void ReadProcKilobyteFields(base::ProcessId pid,
+                            const char* file,
+                            Callback callback) {
+  std::string contents;
+  if (!base::ReadFileToString(
+          base::FilePath(base::StringPrintf("/proc/%d/%s", pid, file)),
+          &contents))
+    return;
+  for (std::string_view line : base::SplitStringPiece(
+           contents, "\n", base::KEEP_WHITESPACE, base::SPLIT_WANT_NONEMPTY)) {
+    const size_t colon = line.find(':');
+    if (colon == std::string_view::npos)
+      continue;
+    std::string_view value =
+        base::TrimWhitespaceASCII(line.substr(colon + 1), base::TRIM_ALL);
+    if (!base::EndsWith(value, " kB"))
+      continue;
+    value.remove_suffix(3);
+    size_t kilobytes = 0;
+    if (base::StringToSizeT(value, &kilobytes))
+      callback(line.substr(0, colon), kilobytes << 10);
+  }
+}
+
+electron::ProcessMemoryInfo ReadMemoryInfo(base::ProcessId pid) {
+  electron::ProcessMemoryInfo result;
+
+  // smaps_rollup (Linux 4.14+) sums up smaps without listing every mapping,
+  // which keeps this cheap enough to call on every sample.
+  ReadProcKilobyteFields(pid, "smaps_rollup",
+                         [&result](std::string_view name, size_t bytes) {
+                           if (name == "Rss")
+                             result.working_set_size = bytes;
+                           else if (name == "Pss")
+                             result.proportional_set_size = bytes;
+                           else if (name == "Private_Clean" ||
+                                    name == "Private_Dirty")
+                             result.private_bytes += bytes;
+                         });
+  ReadProcKilobyteFields(pid, "status",
+                         [&result](std::string_view name, size_t bytes) {
+                           if (name == "VmHWM")
+                             result.peak_working_set_size = bytes;
+                         });
+
+  return result;
+}
+
+}  // namespace
+#endif  // BUILDFLAG(IS_LINUX)
+
 namespace electron {
 
 ProcessMetric::ProcessMetric(int type,
@@ -67,6 +147,10 @@ ProcessMetric::ProcessMetric(int type,
 #else
   this->process = base::Process(handle);
 #endif
+
+#if BUILDFLAG(IS_LINUX)
+  RefreshMemoryInfo();
+#endif
 }
 
 ProcessMetric::~ProcessMetric() = default;
@@ -166,6 +250,28 @@ bool ProcessMetric::IsSandboxed() const {
 #endif
 }
 
+#elif BUILDFLAG(IS_LINUX)
+
+ProcessMemoryInfo ProcessMetric::GetMemoryInfo() {
+  RefreshMemoryInfo();
+  return memory_info_;
+}
+
+void ProcessMetric::RefreshMemoryInfo() {
+  if (memory_info_refresh_pending_)
+    return;
+  memory_info_refresh_pending_ = true;
+  GetProcReaderTaskRunner()->PostTaskAndReplyWithResult(
+      FROM_HERE, base::BindOnce(&ReadMemoryInfo, process.Pid()),
+      base::BindOnce(&ProcessMetric::OnMemoryInfo,
+                     weak_factory_.GetWeakPtr()));
+}
+
+void ProcessMetric::OnMemoryInfo(ProcessMemoryInfo memory_info) {
+  memory_info_refresh_pending_ = false;
+  memory_info_ = memory_info;
+}
+
 #endif  // BUILDFLAG(IS_MAC)
 
 }  // namespace electron
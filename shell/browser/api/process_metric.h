@@ -12,17 +12,22 @@
 #include "base/process/process_handle.h"
 #include "base/process/process_metrics.h"
 
+#if BUILDFLAG(IS_LINUX)
+#include "base/memory/weak_ptr.h"
+#endif
+
 namespace electron {
 
-#if !BUILDFLAG(IS_LINUX)
 struct ProcessMemoryInfo {
   size_t working_set_size = 0;
   size_t peak_working_set_size = 0;
-#if BUILDFLAG(IS_WIN)
+#if BUILDFLAG(IS_WIN) || BUILDFLAG(IS_LINUX)
   size_t private_bytes = 0;
 #endif
-};
+#if BUILDFLAG(IS_LINUX)
+  size_t proportional_set_size = 0;
 #endif
+};
 
 #if BUILDFLAG(IS_WIN)
 enum class ProcessIntegrityLevel {
@@ -48,7 +53,11 @@ struct ProcessMetric {
                 const std::string& name = std::string());
   ~ProcessMetric();
 
-#if !BUILDFLAG(IS_LINUX)
+#if BUILDFLAG(IS_LINUX)
+  // Reading /proc may block, so this returns the latest memory info read on
+  // a background sequence and starts reading the next one.
+  ProcessMemoryInfo GetMemoryInfo();
+#else
   ProcessMemoryInfo GetMemoryInfo() const;
 #endif
 
@@ -58,6 +67,16 @@ struct ProcessMetric {
 #elif BUILDFLAG(IS_MAC)
   bool IsSandboxed() const;
 #endif
+
+#if BUILDFLAG(IS_LINUX)
+ private:
+  void RefreshMemoryInfo();
+  void OnMemoryInfo(ProcessMemoryInfo memory_info);
+
+  ProcessMemoryInfo memory_info_;
+  bool memory_info_refresh_pending_ = false;
+  base::WeakPtrFactory<ProcessMetric> weak_factory_{this};
+#endif
 };
 
 }  // namespace electron
@@ -0,0 +1,118 @@
+// Copyright (c) 2024 Microsoft, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#include "shell/browser/api/process_metrics_sampler.h"
+
+#include <algorithm>
+
+#include "base/functional/bind.h"
+#include "base/system/sys_info.h"
+#include "content/public/browser/gpu_data_manager.h"
+#include "gpu/ipc/common/memory_stats.h"
+
+namespace electron {
+
+ProcessMetricsSampler::ProcessMetricsSampler(const ProcessMetricMap& processes)
+    : processes_(processes) {}
+
+ProcessMetricsSampler::~ProcessMetricsSampler() = default;
+
+void ProcessMetricsSampler::Start(base::TimeDelta interval, size_t capacity) {
+  DCHECK_GT(capacity, 0u);
+  samples_.clear();
+  samples_.resize(capacity);
+  next_sample_ = 0;
+  sample_count_ = 0;
+  cpu_state_.clear();
+  timer_.Start(FROM_HERE, interval,
+               base::BindRepeating(&ProcessMetricsSampler::Sample,
+                                   base::Unretained(this)));
+  // Establishes the CPU baseline, so the first real sample has a usage.
+  Sample();
+}
+
+void ProcessMetricsSampler::Stop() {
+  timer_.Stop();
+}
+
+std::vector<ProcessMetricSample> ProcessMetricsSampler::GetSamples(
+    base::Time since) const {
+  std::vector<ProcessMetricSample> result;
+  result.reserve(sample_count_);
+  const size_t first = (next_sample_ + samples_.size() - sample_count_) %
+                       std::max<size_t>(samples_.size(), 1);
+  for (size_t i = 0; i < sample_count_; ++i) {
+    const ProcessMetricSample& sample =
+        samples_[(first + i) % samples_.size()];
+    if (sample.time > since)
+      result.push_back(sample);
+  }
+  return result;
+}
+
+void ProcessMetricsSampler::Sample() {
+  const base::Time now = base::Time::Now();
+  const base::TimeTicks now_ticks = base::TimeTicks::Now();
+  const int processor_count = base::SysInfo::NumberOfProcessors();
+
+  base::flat_map<base::ProcessId, CPUState> cpu_state;
+  cpu_state.reserve(processes_->size());
+  for (const auto& [pid, process_metric] : *processes_) {
+    const base::TimeDelta cumulative_usage =
+        process_metric->metrics->GetCumulativeCPUUsage().value_or(
+            base::TimeDelta());
+    cpu_state[pid] = {cumulative_usage, now_ticks};
+
+    // Processes seen for the first time only get their baseline recorded.
+    auto previous = cpu_state_.find(pid);
+    if (previous == cpu_state_.end())
+      continue;
+
+    ProcessMetricSample& sample = samples_[next_sample_];
+    sample.time = now;
+    sample.pid = pid;
+    sample.type = process_metric->type;
+    const base::TimeDelta elapsed = now_ticks - previous->second.time;
+    sample.cpu_usage =
+        elapsed.is_positive()
+            ? 100.0 * (cumulative_usage - previous->second.cumulative_usage) /
+                  elapsed / processor_count
+            : 0;
+#if !BUILDFLAG(IS_WIN)
+    sample.idle_wakeups_per_second =
+        process_metric->metrics->GetIdleWakeupsPerSecond();
+#endif
+    sample.memory = process_metric->GetMemoryInfo();
+    auto gpu_memory = gpu_memory_.find(pid);
+    sample.gpu_memory = gpu_memory != gpu_memory_.end()
+                            ? std::make_optional(gpu_memory->second)
+                            : std::nullopt;
+
+    next_sample_ = (next_sample_ + 1) % samples_.size();
+    sample_count_ = std::min(sample_count_ + 1, samples_.size());
+  }
+  // Drops the state of processes that went away.
+  cpu_state_ = std::move(cpu_state);
+
+  RequestGPUMemory();
+}
+
+void ProcessMetricsSampler::RequestGPUMemory() {
+  if (gpu_memory_request_pending_)
+    return;
+  gpu_memory_request_pending_ = true;
+  content::GpuDataManager::GetInstance()->RequestVideoMemoryUsageStatsUpdate(
+      base::BindOnce(&ProcessMetricsSampler::OnVideoMemoryUsageStats,
+                     weak_factory_.GetWeakPtr()));
+}
+
+void ProcessMetricsSampler::OnVideoMemoryUsageStats(
+    const gpu::VideoMemoryUsageStats& stats) {
+  gpu_memory_request_pending_ = false;
+  gpu_memory_.clear();
+  for (const auto& [pid, process_stats] : stats.process_map)
+    gpu_memory_[pid] = process_stats.video_memory;
+}
+
+}  // namespace electron
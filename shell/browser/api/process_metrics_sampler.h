@@ -0,0 +1,89 @@
+// Copyright (c) 2024 Microsoft, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#ifndef ELECTRON_SHELL_BROWSER_API_PROCESS_METRICS_SAMPLER_H_
+#define ELECTRON_SHELL_BROWSER_API_PROCESS_METRICS_SAMPLER_H_
+
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "base/containers/flat_map.h"
+#include "base/memory/raw_ref.h"
+#include "base/memory/weak_ptr.h"
+#include "base/time/time.h"
+#include "base/timer/timer.h"
+#include "shell/browser/api/process_metric.h"
+
+namespace gpu {
+struct VideoMemoryUsageStats;
+}
+
+namespace electron {
+
+struct ProcessMetricSample {
+  base::Time time;
+  base::ProcessId pid = base::kNullProcessId;
+  int type = 0;
+  // Percentage of the total CPU time of the machine since the previous
+  // sample of the same process.
+  double cpu_usage = 0;
+  int idle_wakeups_per_second = 0;
+  ProcessMemoryInfo memory;
+  std::optional<uint64_t> gpu_memory;
+};
+
+// Periodically records the metrics of every process in |processes| into a
+// fixed-size ring buffer, so that they can be read in bulk instead of being
+// polled one snapshot at a time.
+class ProcessMetricsSampler {
+ public:
+  using ProcessMetricMap =
+      base::flat_map<int, std::unique_ptr<electron::ProcessMetric>>;
+
+  explicit ProcessMetricsSampler(const ProcessMetricMap& processes);
+  ~ProcessMetricsSampler();
+
+  // disable copy
+  ProcessMetricsSampler(const ProcessMetricsSampler&) = delete;
+  ProcessMetricsSampler& operator=(const ProcessMetricsSampler&) = delete;
+
+  // Samples every |interval|, keeping the last |capacity| samples. Restarts
+  // with an empty buffer if already running.
+  void Start(base::TimeDelta interval, size_t capacity);
+  void Stop();
+  bool IsRunning() const { return timer_.IsRunning(); }
+
+  // Returns the samples taken after |since|, oldest first.
+  std::vector<ProcessMetricSample> GetSamples(base::Time since) const;
+
+ private:
+  struct CPUState {
+    base::TimeDelta cumulative_usage;
+    base::TimeTicks time;
+  };
+
+  void Sample();
+  void RequestGPUMemory();
+  void OnVideoMemoryUsageStats(const gpu::VideoMemoryUsageStats& stats);
+
+  const raw_ref<const ProcessMetricMap> processes_;
+  base::RepeatingTimer timer_;
+
+  std::vector<ProcessMetricSample> samples_;
+  size_t next_sample_ = 0;
+  size_t sample_count_ = 0;
+
+  base::flat_map<base::ProcessId, CPUState> cpu_state_;
+  // GPU memory is reported asynchronously by the GPU process, each sample
+  // records the latest numbers.
+  base::flat_map<base::ProcessId, uint64_t> gpu_memory_;
+  bool gpu_memory_request_pending_ = false;
+
+  base::WeakPtrFactory<ProcessMetricsSampler> weak_factory_{this};
+};
+
+}  // namespace electron
+
+#endif  // ELECTRON_SHELL_BROWSER_API_PROCESS_METRICS_SAMPLER_H_
@@ -14,8 +14,11 @@
 namespace electron::api {
 
 SavePageHandler::SavePageHandler(content::WebContents* web_contents,
-                                 gin_helper::Promise<void> promise)
-    : web_contents_(web_contents), promise_(std::move(promise)) {}
+                                 gin_helper::Promise<void> promise,
+                                 ProgressCallback progress_callback)
+    : web_contents_(web_contents),
+      promise_(std::move(promise)),
+      progress_callback_(std::move(progress_callback)) {}
 
 SavePageHandler::~SavePageHandler() = default;
 
@@ -55,6 +58,15 @@ void SavePageHandler::OnDownloadUpdated(download::DownloadItem* item) {
     else
       promise_.RejectWithErrorMessage("Failed to save the page.");
     Destroy(item);
+    return;
+  }
+
+  // The page is written to disk as it is serialized, so report how far that
+  // has got. Updates that only change other state of |item| are skipped.
+  int64_t received_bytes = item->GetReceivedBytes();
+  if (progress_callback_ && received_bytes != last_received_bytes_) {
+    last_received_bytes_ = received_bytes;
+    progress_callback_.Run(received_bytes, item->GetTotalBytes());
   }
 }
 
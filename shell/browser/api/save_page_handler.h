@@ -5,6 +5,7 @@
 #ifndef ELECTRON_SHELL_BROWSER_API_SAVE_PAGE_HANDLER_H_
 #define ELECTRON_SHELL_BROWSER_API_SAVE_PAGE_HANDLER_H_
 
+#include "base/functional/callback.h"
 #include "base/memory/raw_ptr.h"
 #include "components/download/public/common/download_item.h"
 #include "content/public/browser/download_manager.h"
@@ -26,8 +27,15 @@ namespace electron::api {
 class SavePageHandler : public content::DownloadManager::Observer,
                         public download::DownloadItem::Observer {
  public:
+  // Called with the bytes written so far and the expected total, which is 0
+  // while it is unknown.
+  using ProgressCallback =
+      base::RepeatingCallback<void(int64_t received_bytes,
+                                   int64_t total_bytes)>;
+
   SavePageHandler(content::WebContents* web_contents,
-                  gin_helper::Promise<void> promise);
+                  gin_helper::Promise<void> promise,
+                  ProgressCallback progress_callback = {});
   ~SavePageHandler() override;
 
   bool Handle(const base::FilePath& full_path,
@@ -45,6 +53,8 @@ class SavePageHandler : public content::DownloadManager::Observer,
 
   raw_ptr<content::WebContents> web_contents_;  // weak
   gin_helper::Promise<void> promise_;
+  ProgressCallback progress_callback_;
+  int64_t last_received_bytes_ = -1;
 };
 
 }  // namespace electron::api
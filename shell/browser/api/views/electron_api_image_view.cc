@@ -5,6 +5,7 @@
 #include "shell/browser/api/views/electron_api_image_view.h"
 
 #include "shell/common/gin_converters/image_converter.h"
+#include "shell/common/gin_helper/error_thrower.h"
 #include "shell/common/gin_helper/constructor.h"
 #include "shell/common/gin_helper/dictionary.h"
 #include "shell/common/gin_helper/object_template_builder.h"
@@ -22,6 +23,25 @@ void ImageView::SetImage(const gfx::Image& image) {
   image_view()->SetImage(image.AsImageSkia());
 }
 
+void ImageView::SetImageFrames(const std::vector<gfx::Image>& images) {
+  image_frames_.clear();
+  image_frames_.reserve(images.size());
+  for (const gfx::Image& image : images) {
+    gfx::ImageSkia image_skia = image.AsImageSkia();
+    image_skia.EnsureRepsForSupportedScales();
+    image_frames_.push_back(std::move(image_skia));
+  }
+}
+
+void ImageView::SetImageFrame(gin_helper::ErrorThrower thrower,
+                              uint32_t index) {
+  if (index >= image_frames_.size()) {
+    thrower.ThrowRangeError("index must be less than the number of frames");
+    return;
+  }
+  image_view()->SetImage(image_frames_[index]);
+}
+
 // static
 gin_helper::WrappableBase* ImageView::New(gin_helper::Arguments* args) {
   // Constructor call.
@@ -35,7 +55,9 @@ void ImageView::BuildPrototype(v8::Isolate* isolate,
                                v8::Local<v8::FunctionTemplate> prototype) {
   prototype->SetClassName(gin::StringToV8(isolate, "ImageView"));
   gin_helper::ObjectTemplateBuilder(isolate, prototype->PrototypeTemplate())
-      .SetMethod("setImage", &ImageView::SetImage);
+      .SetMethod("setImage", &ImageView::SetImage)
+      .SetMethod("setImageFrames", &ImageView::SetImageFrames)
+      .SetMethod("setImageFrame", &ImageView::SetImageFrame);
 }
 
 }  // namespace electron::api
@@ -5,6 +5,8 @@
 #ifndef ELECTRON_SHELL_BROWSER_API_VIEWS_ELECTRON_API_IMAGE_VIEW_H_
 #define ELECTRON_SHELL_BROWSER_API_VIEWS_ELECTRON_API_IMAGE_VIEW_H_
 
+#include <vector>
+
 #include "gin/handle.h"
 #include "shell/browser/api/electron_api_view.h"
 #include "ui/gfx/image/image.h"
@@ -20,6 +22,8 @@ class ImageView : public View {
                              v8::Local<v8::FunctionTemplate> prototype);
 
   void SetImage(const gfx::Image& image);
+  void SetImageFrames(const std::vector<gfx::Image>& images);
+  void SetImageFrame(gin_helper::ErrorThrower thrower, uint32_t index);
 
  protected:
   ImageView();
@@ -28,6 +32,10 @@ class ImageView : public View {
   views::ImageView* image_view() const {
     return static_cast<views::ImageView*>(view());
   }
+
+ private:
+  // Already holding a representation for every supported scale factor.
+  std::vector<gfx::ImageSkia> image_frames_;
 };
 
 }  // namespace electron::api
@@ -11,6 +11,7 @@
 #include <vector>
 
 #include "base/compiler_specific.h"
+#include "base/memory/weak_ptr.h"
 #include "base/observer_list.h"
 #include "base/task/cancelable_task_tracker.h"
 #include "base/values.h"
@@ -120,11 +121,13 @@ class Browser : public WindowListObserver {
   // Overrides the application name.
   void SetName(const std::string& name);
 
-  // Add the |path| to recent documents list.
-  void AddRecentDocument(const base::FilePath& path);
+  // Add the |path| to recent documents list. The returned promise resolves
+  // once the list has been updated.
+  v8::Local<v8::Promise> AddRecentDocument(v8::Isolate* isolate,
+                                           const base::FilePath& path);
 
   // Clear the recent documents list.
-  void ClearRecentDocuments();
+  v8::Local<v8::Promise> ClearRecentDocuments(v8::Isolate* isolate);
 
 #if BUILDFLAG(IS_WIN)
   // Set the application user model ID.
@@ -367,6 +370,22 @@ class Browser : public WindowListObserver {
 
   std::unique_ptr<gin_helper::Promise<void>> ready_promise_;
 
+#if BUILDFLAG(IS_WIN)
+  // Queues a change of the recent documents list, adding |path| or clearing
+  // the list if it is nullopt. The shell is updated off the UI thread, and
+  // the changes queued while an update is running are applied together.
+  v8::Local<v8::Promise> QueueRecentDocumentsChange(
+      v8::Isolate* isolate,
+      std::optional<base::FilePath> path);
+  void StartPendingRecentDocumentsChanges();
+  void OnRecentDocumentsChanged(
+      std::vector<gin_helper::Promise<void>> promises);
+
+  std::vector<std::optional<base::FilePath>> pending_recent_documents_;
+  std::vector<gin_helper::Promise<void>> pending_recent_documents_promises_;
+  bool recent_documents_update_running_ = false;
+#endif
+
 #if BUILDFLAG(IS_MAC)
   std::unique_ptr<ui::ScopedPasswordInputEnabler> password_input_enabler_;
   base::Time last_dock_show_;
@@ -382,6 +401,8 @@ class Browser : public WindowListObserver {
   // In charge of running taskbar related APIs.
   TaskbarHost taskbar_host_;
 #endif
+
+  base::WeakPtrFactory<Browser> weak_factory_{this};
 };
 
 }  // namespace electron
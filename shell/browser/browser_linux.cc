@@ -84,9 +84,14 @@ bool SetDefaultWebClient(const std::string& protocol) {
   return ran_ok && exit_code == EXIT_SUCCESS;
 }
 
-void Browser::AddRecentDocument(const base::FilePath& path) {}
+v8::Local<v8::Promise> Browser::AddRecentDocument(v8::Isolate* isolate,
+                                                  const base::FilePath& path) {
+  return gin_helper::Promise<void>::ResolvedPromise(isolate);
+}
 
-void Browser::ClearRecentDocuments() {}
+v8::Local<v8::Promise> Browser::ClearRecentDocuments(v8::Isolate* isolate) {
+  return gin_helper::Promise<void>::ResolvedPromise(isolate);
+}
 
 bool Browser::SetAsDefaultProtocolClient(const std::string& protocol,
                                          gin::Arguments* args) {
@@ -160,18 +160,20 @@ void Browser::Show() {
   [[AtomApplication sharedApplication] unhide:nil];
 }
 
-void Browser::AddRecentDocument(const base::FilePath& path) {
+v8::Local<v8::Promise> Browser::AddRecentDocument(v8::Isolate* isolate,
+                                                  const base::FilePath& path) {
   NSString* path_string = base::apple::FilePathToNSString(path);
-  if (!path_string)
-    return;
-  NSURL* u = [NSURL fileURLWithPath:path_string];
-  if (!u)
-    return;
-  [[NSDocumentController sharedDocumentController] noteNewRecentDocumentURL:u];
+  NSURL* u = path_string ? [NSURL fileURLWithPath:path_string] : nil;
+  if (u) {
+    [[NSDocumentController sharedDocumentController]
+        noteNewRecentDocumentURL:u];
+  }
+  return gin_helper::Promise<void>::ResolvedPromise(isolate);
 }
 
-void Browser::ClearRecentDocuments() {
+v8::Local<v8::Promise> Browser::ClearRecentDocuments(v8::Isolate* isolate) {
   [[NSDocumentController sharedDocumentController] clearRecentDocuments:nil];
+  return gin_helper::Promise<void>::ResolvedPromise(isolate);
 }
 
 bool Browser::RemoveAsDefaultProtocolClient(const std::string& protocol,
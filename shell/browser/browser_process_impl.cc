@@ -403,7 +403,4 @@ void BrowserProcessImpl::CreateOSCryptAsync() {
   os_crypt_async_ = std::make_unique<os_crypt_async::OSCryptAsync>(
       std::vector<
           std::pair<size_t, std::unique_ptr<os_crypt_async::KeyProvider>>>());
-
-  // Trigger async initialization of OSCrypt key providers.
-  std::ignore = os_crypt_async_->GetInstance(base::DoNothing());
 }
@@ -22,6 +22,7 @@
 #include "base/strings/strcat_win.h"
 #include "base/strings/string_util.h"
 #include "base/strings/utf_string_conversions.h"
+#include "base/task/sequenced_task_runner.h"
 #include "base/win/registry.h"
 #include "base/win/win_util.h"
 #include "base/win/windows_version.h"
@@ -255,6 +256,27 @@ std::unique_ptr<FileVersionInfo> FetchFileVersionInfo() {
   return std::unique_ptr<FileVersionInfo>();
 }
 
+// Applies changes queued by Browser::QueueRecentDocumentsChange() in order.
+void ApplyRecentDocumentsChanges(
+    const std::wstring& app_id,
+    const std::vector<std::optional<base::FilePath>>& changes) {
+  for (const auto& path : changes) {
+    if (!path) {
+      SHAddToRecentDocs(SHARD_APPIDINFO, nullptr);
+      continue;
+    }
+    CComPtr<IShellItem> item;
+    HRESULT hr = SHCreateItemFromParsingName(path->value().c_str(), nullptr,
+                                             IID_PPV_ARGS(&item));
+    if (SUCCEEDED(hr)) {
+      SHARDAPPIDINFO info;
+      info.psi = item;
+      info.pszAppID = app_id.c_str();
+      SHAddToRecentDocs(SHARD_APPIDINFO, &info);
+    }
+  }
+}
+
 }  // namespace
 
 Browser::UserTask::UserTask() = default;
@@ -315,28 +337,61 @@ void GetApplicationInfoForProtocolUsingAssocQuery(
               app_display_name, std::move(promise));
 }
 
-void Browser::AddRecentDocument(const base::FilePath& path) {
-  CComPtr<IShellItem> item;
-  HRESULT hr = SHCreateItemFromParsingName(path.value().c_str(), nullptr,
-                                           IID_PPV_ARGS(&item));
-  if (SUCCEEDED(hr)) {
-    SHARDAPPIDINFO info;
-    info.psi = item;
-    info.pszAppID = GetAppUserModelID();
-    SHAddToRecentDocs(SHARD_APPIDINFO, &info);
-  }
+v8::Local<v8::Promise> Browser::AddRecentDocument(v8::Isolate* isolate,
+                                                  const base::FilePath& path) {
+  return QueueRecentDocumentsChange(isolate, path);
+}
+
+v8::Local<v8::Promise> Browser::ClearRecentDocuments(v8::Isolate* isolate) {
+  return QueueRecentDocumentsChange(isolate, std::nullopt);
+}
+
+v8::Local<v8::Promise> Browser::QueueRecentDocumentsChange(
+    v8::Isolate* isolate,
+    std::optional<base::FilePath> path) {
+  gin_helper::Promise<void> promise(isolate);
+  v8::Local<v8::Promise> handle = promise.GetHandle();
+
+  // Documents added before the list is cleared would not survive it anyway.
+  if (!path)
+    pending_recent_documents_.clear();
+  pending_recent_documents_.push_back(std::move(path));
+  pending_recent_documents_promises_.push_back(std::move(promise));
+  if (!recent_documents_update_running_)
+    StartPendingRecentDocumentsChanges();
+  return handle;
+}
+
+void Browser::StartPendingRecentDocumentsChanges() {
+  recent_documents_update_running_ = true;
+  GetJumpListTaskRunner()->PostTaskAndReply(
+      FROM_HERE,
+      base::BindOnce(&ApplyRecentDocumentsChanges,
+                     std::wstring(GetAppUserModelID()),
+                     std::exchange(pending_recent_documents_, {})),
+      base::BindOnce(&Browser::OnRecentDocumentsChanged,
+                     weak_factory_.GetWeakPtr(),
+                     std::exchange(pending_recent_documents_promises_, {})));
 }
 
-void Browser::ClearRecentDocuments() {
-  SHAddToRecentDocs(SHARD_APPIDINFO, nullptr);
+void Browser::OnRecentDocumentsChanged(
+    std::vector<gin_helper::Promise<void>> promises) {
+  recent_documents_update_running_ = false;
+  for (auto& promise : promises)
+    promise.Resolve();
+  if (!pending_recent_documents_.empty())
+    StartPendingRecentDocumentsChanges();
 }
 
 void Browser::SetAppUserModelID(const std::wstring& name) {
   electron::SetAppUserModelID(name);
 }
 
-bool Browser::SetUserTasks(const std::vector<UserTask>& tasks) {
-  JumpList jump_list(GetAppUserModelID());
+namespace {
+
+bool ApplyUserTasks(const std::wstring& app_id,
+                    const std::vector<Browser::UserTask>& tasks) {
+  JumpList jump_list(app_id);
   if (!jump_list.Begin())
     return false;
 
@@ -360,6 +415,17 @@ bool Browser::SetUserTasks(const std::vector<UserTask>& tasks) {
   return jump_list.Commit();
 }
 
+}  // namespace
+
+bool Browser::SetUserTasks(const std::vector<UserTask>& tasks) {
+  bool result = false;
+  RunOnJumpListTaskRunnerAndWait(base::BindOnce(
+      [](const std::wstring& app_id, const std::vector<UserTask>& tasks,
+         bool* result) { *result = ApplyUserTasks(app_id, tasks); },
+      std::wstring(GetAppUserModelID()), tasks, &result));
+  return result;
+}
+
 bool Browser::RemoveAsDefaultProtocolClient(const std::string& protocol,
                                             gin::Arguments* args) {
   if (protocol.empty())
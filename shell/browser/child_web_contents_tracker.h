@@ -5,6 +5,7 @@
 #ifndef ELECTRON_SHELL_BROWSER_CHILD_WEB_CONTENTS_TRACKER_H_
 #define ELECTRON_SHELL_BROWSER_CHILD_WEB_CONTENTS_TRACKER_H_
 
+#include <cstdint>
 #include <string>
 
 #include "content/public/browser/web_contents_user_data.h"
@@ -26,6 +27,9 @@ struct ChildWebContentsTracker
   content::Referrer referrer;
   std::string raw_features;
   scoped_refptr<network::ResourceRequestBody> body;
+  // ID of the api::WebContents that opened this one. Unlike
+  // WebContents::GetOpener() it is kept for `noopener` windows too.
+  int32_t opener_id = 0;
 
  private:
   explicit ChildWebContentsTracker(content::WebContents* web_contents);
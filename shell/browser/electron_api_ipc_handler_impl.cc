@@ -4,13 +4,41 @@
 
 #include "shell/browser/electron_api_ipc_handler_impl.h"
 
+#include <string>
 #include <utility>
 
+#include "base/functional/bind.h"
+#include "base/time/time.h"
+#include "base/trace_event/trace_event.h"
+#include "content/public/browser/browser_task_traits.h"
+#include "content/public/browser/browser_thread.h"
 #include "content/public/browser/render_frame_host.h"
 #include "content/public/browser/render_process_host.h"
 #include "mojo/public/cpp/bindings/self_owned_receiver.h"
+#include "shell/browser/api/electron_api_ipc_main.h"
+#include "shell/common/crash_keys.h"
 
 namespace electron {
+
+namespace {
+
+// Wraps |callback| to record how big the reply on |channel| was and how long
+// the main process took to send it.
+template <typename ReplyCallback>
+ReplyCallback WrapReplyCallback(const std::string& channel,
+                                ReplyCallback callback) {
+  return base::BindOnce(
+      [](const std::string& channel, base::TimeTicks start,
+         ReplyCallback callback, blink::CloneableMessage reply) {
+        api::ipc_main::RecordReply(channel, reply,
+                                   base::TimeTicks::Now() - start);
+        std::move(callback).Run(std::move(reply));
+      },
+      channel, base::TimeTicks::Now(), std::move(callback));
+}
+
+}  // namespace
+
 ElectronApiIPCHandlerImpl::ElectronApiIPCHandlerImpl(
     content::RenderFrameHost* frame_host,
     mojo::PendingAssociatedReceiver<mojom::ElectronApiIPC> receiver)
@@ -37,17 +65,43 @@ void ElectronApiIPCHandlerImpl::OnConnectionError() {
 
 void ElectronApiIPCHandlerImpl::Message(bool internal,
                                         const std::string& channel,
-                                        blink::CloneableMessage arguments) {
+                                        blink::TransferableMessage arguments) {
+  crash_keys::RecordBreadcrumb(crash_keys::BreadcrumbKind::kIpc, channel);
+  if (!internal)
+    api::ipc_main::RecordMessage(api::ipc_main::MessageKind::kMessage, channel,
+                                 arguments);
   api::WebContents* api_web_contents = api::WebContents::From(web_contents());
   if (api_web_contents) {
     api_web_contents->Message(internal, channel, std::move(arguments),
                               GetRenderFrameHost());
   }
 }
+
+void ElectronApiIPCHandlerImpl::MessageBatch(
+    std::vector<mojom::BatchedMessagePtr> messages) {
+  for (const auto& message : messages) {
+    crash_keys::RecordBreadcrumb(crash_keys::BreadcrumbKind::kIpc,
+                                 message->channel);
+    if (!message->internal)
+      api::ipc_main::RecordMessage(api::ipc_main::MessageKind::kMessage,
+                                   message->channel, message->arguments);
+  }
+  api::WebContents* api_web_contents = api::WebContents::From(web_contents());
+  if (api_web_contents) {
+    api_web_contents->MessageBatch(std::move(messages), GetRenderFrameHost());
+  }
+}
+
 void ElectronApiIPCHandlerImpl::Invoke(bool internal,
                                        const std::string& channel,
-                                       blink::CloneableMessage arguments,
+                                       blink::TransferableMessage arguments,
                                        InvokeCallback callback) {
+  crash_keys::RecordBreadcrumb(crash_keys::BreadcrumbKind::kIpc, channel);
+  if (!internal) {
+    api::ipc_main::RecordMessage(api::ipc_main::MessageKind::kInvoke, channel,
+                                 arguments);
+    callback = WrapReplyCallback(channel, std::move(callback));
+  }
   api::WebContents* api_web_contents = api::WebContents::From(web_contents());
   if (api_web_contents) {
     api_web_contents->Invoke(internal, channel, std::move(arguments),
@@ -67,8 +121,24 @@ void ElectronApiIPCHandlerImpl::ReceivePostMessage(
 
 void ElectronApiIPCHandlerImpl::MessageSync(bool internal,
                                             const std::string& channel,
-                                            blink::CloneableMessage arguments,
+                                            blink::TransferableMessage arguments,
                                             MessageSyncCallback callback) {
+  crash_keys::RecordBreadcrumb(crash_keys::BreadcrumbKind::kIpc, channel);
+  // Channels with a reply set by ipcMain.setSyncReply() are answered here on
+  // the UI thread, without emitting the message to JavaScript. The replies are
+  // global, so this bypasses the listeners of webContents.ipc and
+  // webFrameMain.ipc too.
+  if (!internal) {
+    api::ipc_main::RecordMessage(api::ipc_main::MessageKind::kSync, channel,
+                                 arguments);
+    callback = WrapReplyCallback(channel, std::move(callback));
+    if (auto reply = api::ipc_main::GetSyncReply(channel)) {
+      TRACE_EVENT1("electron", "ElectronApiIPCHandlerImpl::MessageSync",
+                   "channel", channel);
+      std::move(callback).Run(std::move(*reply));
+      return;
+    }
+  }
   api::WebContents* api_web_contents = api::WebContents::From(web_contents());
   if (api_web_contents) {
     api_web_contents->MessageSync(internal, channel, std::move(arguments),
@@ -85,6 +155,19 @@ void ElectronApiIPCHandlerImpl::MessageHost(const std::string& channel,
   }
 }
 
+void ElectronApiIPCHandlerImpl::BindLane(
+    mojom::IPCLane lane,
+    mojo::PendingReceiver<mojom::ElectronApiIPCLane> receiver) {
+  // The UI thread runs input tasks ahead of the default queue, which the
+  // frame's associated pipe is dispatched from, and user visible tasks after.
+  scoped_refptr<base::SingleThreadTaskRunner> task_runner =
+      lane == mojom::IPCLane::kUrgent
+          ? content::GetUIThreadTaskRunner(
+                {content::BrowserTaskType::kUserInput})
+          : content::GetUIThreadTaskRunner({base::TaskPriority::USER_VISIBLE});
+  lane_receivers_.Add(this, std::move(receiver), std::move(task_runner));
+}
+
 content::RenderFrameHost* ElectronApiIPCHandlerImpl::GetRenderFrameHost() {
   return content::RenderFrameHost::FromID(render_frame_host_id_);
 }
@@ -12,6 +12,7 @@
 #include "content/public/browser/web_contents_observer.h"
 #include "electron/shell/common/api/api.mojom.h"
 #include "mojo/public/cpp/bindings/associated_receiver.h"
+#include "mojo/public/cpp/bindings/receiver_set.h"
 #include "shell/browser/api/electron_api_web_contents.h"
 
 namespace content {
@@ -20,6 +21,7 @@ class RenderFrameHost;
 
 namespace electron {
 class ElectronApiIPCHandlerImpl : public mojom::ElectronApiIPC,
+                                  public mojom::ElectronApiIPCLane,
                                   public content::WebContentsObserver {
  public:
   explicit ElectronApiIPCHandlerImpl(
@@ -35,22 +37,26 @@ class ElectronApiIPCHandlerImpl : public mojom::ElectronApiIPC,
   ElectronApiIPCHandlerImpl& operator=(const ElectronApiIPCHandlerImpl&) =
       delete;
 
-  // mojom::ElectronApiIPC:
+  // mojom::ElectronApiIPC and mojom::ElectronApiIPCLane:
   void Message(bool internal,
                const std::string& channel,
-               blink::CloneableMessage arguments) override;
+               blink::TransferableMessage arguments) override;
+  void MessageBatch(std::vector<mojom::BatchedMessagePtr> messages) override;
   void Invoke(bool internal,
               const std::string& channel,
-              blink::CloneableMessage arguments,
+              blink::TransferableMessage arguments,
               InvokeCallback callback) override;
   void ReceivePostMessage(const std::string& channel,
                           blink::TransferableMessage message) override;
   void MessageSync(bool internal,
                    const std::string& channel,
-                   blink::CloneableMessage arguments,
+                   blink::TransferableMessage arguments,
                    MessageSyncCallback callback) override;
   void MessageHost(const std::string& channel,
                    blink::CloneableMessage arguments) override;
+  void BindLane(
+      mojom::IPCLane lane,
+      mojo::PendingReceiver<mojom::ElectronApiIPCLane> receiver) override;
 
   base::WeakPtr<ElectronApiIPCHandlerImpl> GetWeakPtr() {
     return weak_factory_.GetWeakPtr();
@@ -69,6 +75,7 @@ class ElectronApiIPCHandlerImpl : public mojom::ElectronApiIPC,
   content::GlobalRenderFrameHostId render_frame_host_id_;
 
   mojo::AssociatedReceiver<mojom::ElectronApiIPC> receiver_{this};
+  mojo::ReceiverSet<mojom::ElectronApiIPCLane> lane_receivers_;
 
   base::WeakPtrFactory<ElectronApiIPCHandlerImpl> weak_factory_{this};
 };
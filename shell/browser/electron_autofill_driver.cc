@@ -59,8 +59,14 @@ void AutofillDriver::ShowAutofillPopup(
     embedder_frame_host = embedder->web_contents()->GetPrimaryMainFrame();
   }
 
-  autofill_popup_->CreateView(render_frame_host_, embedder_frame_host, osr,
-                              owner_window->content_view(), popup_bounds);
+  // The renderer asks again on every keystroke, update the popup in place
+  // while it is still showing for the same element.
+  if (!autofill_popup_->IsShowingFor(render_frame_host_,
+                                     owner_window->content_view(),
+                                     popup_bounds)) {
+    autofill_popup_->CreateView(render_frame_host_, embedder_frame_host, osr,
+                                owner_window->content_view(), popup_bounds);
+  }
   autofill_popup_->SetItems(values, labels);
 }
 
@@ -8,7 +8,9 @@
 #include <shlobj.h>
 #endif
 
+#include <algorithm>
 #include <memory>
+#include <optional>
 #include <utility>
 
 #include "base/base_switches.h"
@@ -57,8 +59,10 @@
 #include "electron/buildflags/buildflags.h"
 #include "electron/fuses.h"
 #include "electron/shell/common/api/api.mojom.h"
+#include "extensions/browser/api/web_request/web_request_resource_type.h"
 #include "extensions/browser/extension_navigation_ui_data.h"
 #include "mojo/public/cpp/bindings/binder_map.h"
+#include "net/http/http_request_headers.h"
 #include "net/ssl/ssl_cert_request_info.h"
 #include "net/ssl/ssl_private_key.h"
 #include "ppapi/buildflags/buildflags.h"
@@ -110,11 +114,13 @@
 #include "shell/browser/window_list.h"
 #include "shell/common/api/api.mojom.h"
 #include "shell/common/application_info.h"
+#include "shell/common/electron_constants.h"
 #include "shell/common/electron_paths.h"
 #include "shell/common/logging.h"
 #include "shell/common/options_switches.h"
 #include "shell/common/platform_util.h"
 #include "shell/common/thread_restrictions.h"
+#include "storage/browser/quota/quota_settings.h"
 #include "third_party/blink/public/common/associated_interfaces/associated_interface_registry.h"
 #include "third_party/blink/public/common/loader/url_loader_throttle.h"
 #include "third_party/blink/public/common/renderer_preferences/renderer_preferences.h"
@@ -443,8 +449,52 @@ void ElectronBrowserClient::RegisterPendingSiteInstance(
     content::SiteInstance* pending_site_instance) {
   // Remember the original web contents for the pending renderer process.
   auto* web_contents = content::WebContents::FromRenderFrameHost(rfh);
+
+  // A spare renderer was launched without knowing which web contents would
+  // adopt it, so it must only be handed to one that would have launched an
+  // identical process anyway.
+  auto* browser_context = static_cast<ElectronBrowserContext*>(
+      pending_site_instance->GetBrowserContext());
+  auto* web_preferences = WebContentsPreferences::From(web_contents);
+  const bool spare_renderer_enabled =
+      browser_context->spare_renderer_enabled();
+  allow_spare_render_process_host_ =
+      spare_renderer_enabled && web_preferences &&
+      web_preferences->CanUseSpareRenderProcessHost(rfh->GetParent() !=
+                                                    nullptr);
+  // Web contents of a process group share a process of that group if there
+  // is one already.
+  if (web_preferences && !pending_site_instance->HasProcess()) {
+    pending_process_group_ =
+        web_preferences->GetProcessGroupKey(rfh->GetParent() != nullptr);
+  }
   auto* pending_process = pending_site_instance->GetProcess();
+  allow_spare_render_process_host_ = false;
   pending_processes_[pending_process->GetID()] = web_contents;
+  if (pending_process_group_) {
+    process_groups_.try_emplace(pending_process->GetID(),
+                                std::move(*pending_process_group_));
+    pending_process_group_.reset();
+    // A shared process is launched for the first web contents of the group,
+    // the others never go through AppendCommandLineSwitches.
+    web_preferences->SaveLastPreferences();
+  }
+
+  if (spare_renderer_enabled) {
+    // Adopted processes never go through AppendCommandLineSwitches.
+    if (web_preferences)
+      web_preferences->SaveLastPreferences();
+    // Replace the spare once the navigation that may have taken it is done.
+    content::GetUIThreadTaskRunner({base::TaskPriority::BEST_EFFORT})
+        ->PostTask(FROM_HERE,
+                   base::BindOnce(
+                       [](base::WeakPtr<ElectronBrowserContext> context) {
+                         if (context && context->spare_renderer_enabled())
+                           content::RenderProcessHost::
+                               WarmupSpareRenderProcessHost(context.get());
+                       },
+                       browser_context->GetWeakPtr()));
+  }
 
   if (rfh->GetParent())
     renderer_is_subframe_.insert(pending_process->GetID());
@@ -592,12 +642,41 @@ std::string ElectronBrowserClient::GetGeolocationApiKey() {
 content::GeneratedCodeCacheSettings
 ElectronBrowserClient::GetGeneratedCodeCacheSettings(
     content::BrowserContext* context) {
+  auto* browser_context = static_cast<ElectronBrowserContext*>(context);
   // TODO(deepak1556): Use platform cache directory.
   base::FilePath cache_path = context->GetPath();
   // If we pass 0 for size, disk_cache will pick a default size using the
   // heuristics based on available disk size. These are implemented in
   // disk_cache::PreferredCacheSize in net/disk_cache/cache_util.cc.
-  return content::GeneratedCodeCacheSettings(true, 0, cache_path);
+  return content::GeneratedCodeCacheSettings(
+      browser_context->can_use_code_cache(),
+      browser_context->max_code_cache_size(), cache_path);
+}
+
+void ElectronBrowserClient::GetQuotaSettings(
+    content::BrowserContext* context,
+    content::StoragePartition* partition,
+    storage::OptionalQuotaSettingsCallback callback) {
+  const int64_t storage_quota =
+      static_cast<ElectronBrowserContext*>(context)->storage_quota();
+  if (storage_quota > 0) {
+    // Capping the pool makes the QuotaManager evict the least recently used
+    // origins once the session grows beyond its budget.
+    callback = base::BindOnce(
+        [](int64_t storage_quota,
+           storage::OptionalQuotaSettingsCallback callback,
+           std::optional<storage::QuotaSettings> settings) {
+          if (settings) {
+            settings->pool_size = std::min(settings->pool_size, storage_quota);
+            settings->per_storage_key_quota =
+                std::min(settings->per_storage_key_quota, storage_quota);
+          }
+          std::move(callback).Run(std::move(settings));
+        },
+        storage_quota, std::move(callback));
+  }
+  ContentBrowserClient::GetQuotaSettings(context, partition,
+                                         std::move(callback));
 }
 
 void ElectronBrowserClient::AllowCertificateError(
@@ -731,6 +810,17 @@ void ElectronBrowserClient::SiteInstanceGotProcessAndSite(
 bool ElectronBrowserClient::IsSuitableHost(
     content::RenderProcessHost* process_host,
     const GURL& site_url) {
+  // Processes of a process group only host web contents of that group, which
+  // may otherwise only take an unused process, e.g. the spare renderer.
+  const auto group = process_groups_.find(process_host->GetID());
+  if (pending_process_group_) {
+    if (group == process_groups_.end() ? !process_host->IsUnused()
+                                       : group->second != *pending_process_group_)
+      return false;
+  } else if (group != process_groups_.end()) {
+    return false;
+  }
+
 #if BUILDFLAG(ENABLE_ELECTRON_EXTENSIONS)
   auto* browser_context = process_host->GetBrowserContext();
   extensions::ExtensionRegistry* registry =
@@ -749,6 +839,23 @@ bool ElectronBrowserClient::IsSuitableHost(
 #endif
 }
 
+bool ElectronBrowserClient::ShouldTryToUseExistingProcessHost(
+    content::BrowserContext* browser_context,
+    const GURL& url) {
+  return pending_process_group_.has_value() ||
+         content::ContentBrowserClient::ShouldTryToUseExistingProcessHost(
+             browser_context, url);
+}
+
+bool ElectronBrowserClient::ShouldUseSpareRenderProcessHost(
+    content::BrowserContext* browser_context,
+    const GURL& site_url) {
+  // Only navigations vetted by RegisterPendingSiteInstance may adopt a spare,
+  // other process allocations (e.g. service workers) don't know their
+  // web preferences.
+  return allow_spare_render_process_host_;
+}
+
 bool ElectronBrowserClient::ShouldUseProcessPerSite(
     content::BrowserContext* browser_context,
     const GURL& effective_url) {
@@ -859,6 +966,7 @@ void ElectronBrowserClient::RenderProcessHostDestroyed(
   int process_id = host->GetID();
   pending_processes_.erase(process_id);
   renderer_is_subframe_.erase(process_id);
+  process_groups_.erase(process_id);
   host->RemoveObserver(this);
 }
 
@@ -1012,6 +1120,27 @@ ElectronBrowserClient::GetNetworkContextsParentDirectory() {
   return {session_data};
 }
 
+// The browser-wide shader caches are kept next to the default session's
+// GPUCache, so that they persist across launches and can be seeded with
+// app.setShaderCacheSeed().
+base::FilePath ElectronBrowserClient::GetShaderDiskCacheDirectory() {
+  base::FilePath session_data;
+  base::PathService::Get(DIR_SESSION_DATA, &session_data);
+  return session_data.Append(kShaderCacheDirname);
+}
+
+base::FilePath ElectronBrowserClient::GetGrShaderDiskCacheDirectory() {
+  base::FilePath session_data;
+  base::PathService::Get(DIR_SESSION_DATA, &session_data);
+  return session_data.Append(kGrShaderCacheDirname);
+}
+
+base::FilePath ElectronBrowserClient::GetGraphiteDawnDiskCacheDirectory() {
+  base::FilePath session_data;
+  base::PathService::Get(DIR_SESSION_DATA, &session_data);
+  return session_data.Append(kGraphiteDawnCacheDirname);
+}
+
 std::string ElectronBrowserClient::GetProduct() {
   return "Chrome/" CHROME_VERSION_STRING;
 }
@@ -1282,6 +1411,20 @@ void ElectronBrowserClient::CreateWebSocket(
   }
 #endif
 
+  // When no listener or rule cares about this socket, connect it the way
+  // content would have without interception and keep no per-socket state.
+  if (!web_request->MayObserveRequest(
+          url, extensions::WebRequestResourceType::WEB_SOCKET)) {
+    std::vector<network::mojom::HttpHeaderPtr> headers;
+    if (user_agent) {
+      headers.push_back(network::mojom::HttpHeader::New(
+          net::HttpRequestHeaders::kUserAgent, *user_agent));
+    }
+    std::move(factory).Run(url, std::move(headers), std::move(handshake_client),
+                           mojo::NullRemote(), mojo::NullRemote());
+    return;
+  }
+
   ProxyingWebSocket::StartProxying(
       web_request.get(), std::move(factory), url, site_for_cookies, user_agent,
       std::move(handshake_client), true, frame->GetProcess()->GetID(),
@@ -6,6 +6,7 @@
 #define ELECTRON_SHELL_BROWSER_ELECTRON_BROWSER_CLIENT_H_
 
 #include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -132,6 +133,10 @@ class ElectronBrowserClient : public content::ContentBrowserClient,
   std::string GetGeolocationApiKey() override;
   content::GeneratedCodeCacheSettings GetGeneratedCodeCacheSettings(
       content::BrowserContext* context) override;
+  void GetQuotaSettings(
+      content::BrowserContext* context,
+      content::StoragePartition* partition,
+      storage::OptionalQuotaSettingsCallback callback) override;
   void AllowCertificateError(
       content::WebContents* web_contents,
       int cert_error,
@@ -192,6 +197,9 @@ class ElectronBrowserClient : public content::ContentBrowserClient,
   void OnNetworkServiceCreated(
       network::mojom::NetworkService* network_service) override;
   std::vector<base::FilePath> GetNetworkContextsParentDirectory() override;
+  base::FilePath GetShaderDiskCacheDirectory() override;
+  base::FilePath GetGrShaderDiskCacheDirectory() override;
+  base::FilePath GetGraphiteDawnDiskCacheDirectory() override;
   std::string GetProduct() override;
   mojo::PendingRemote<network::mojom::URLLoaderFactory>
   CreateNonNetworkNavigationURLLoaderFactory(const std::string& scheme,
@@ -292,6 +300,11 @@ class ElectronBrowserClient : public content::ContentBrowserClient,
       content::BrowserContext* browser_context) override;
   bool IsSuitableHost(content::RenderProcessHost* process_host,
                       const GURL& site_url) override;
+  bool ShouldTryToUseExistingProcessHost(
+      content::BrowserContext* browser_context,
+      const GURL& url) override;
+  bool ShouldUseSpareRenderProcessHost(content::BrowserContext* browser_context,
+                                       const GURL& site_url) override;
   bool ShouldUseProcessPerSite(content::BrowserContext* browser_context,
                                const GURL& effective_url) override;
   void GetMediaDeviceIDSalt(
@@ -321,6 +334,17 @@ class ElectronBrowserClient : public content::ContentBrowserClient,
 
   base::flat_set<int> renderer_is_subframe_;
 
+  // Set while RegisterPendingSiteInstance picks a process for a web contents
+  // that may adopt the spare renderer.
+  bool allow_spare_render_process_host_ = false;
+
+  // Set while RegisterPendingSiteInstance picks a process for a web contents
+  // with a process group, see WebContentsPreferences::GetProcessGroupKey.
+  std::optional<std::string> pending_process_group_;
+
+  // render process => key of the process group it hosts.
+  base::flat_map<int, std::string> process_groups_;
+
   std::unique_ptr<PlatformNotificationService> notification_service_;
   std::unique_ptr<NotificationPresenter> notification_presenter_;
 
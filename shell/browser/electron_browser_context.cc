@@ -4,8 +4,9 @@
 
 #include "shell/browser/electron_browser_context.h"
 
+#include <algorithm>
 #include <memory>
-
+#include <string_view>
 #include <utility>
 
 #include "base/barrier_closure.h"
@@ -17,10 +18,13 @@
 #include "base/strings/escape.h"
 #include "base/strings/string_number_conversions.h"
 #include "base/strings/string_util.h"
+#include "base/task/thread_pool.h"
+#include "base/trace_event/trace_event.h"
 #include "chrome/common/chrome_paths.h"
 #include "chrome/common/pref_names.h"
 #include "components/keyed_service/content/browser_context_dependency_manager.h"
 #include "components/prefs/json_pref_store.h"
+#include "components/prefs/pref_filter.h"
 #include "components/prefs/pref_registry_simple.h"
 #include "components/prefs/pref_service.h"
 #include "components/prefs/pref_service_factory.h"
@@ -302,6 +306,41 @@ bool DoesDeviceMatch(const base::Value& device,
   return false;
 }
 
+// All sessions write their prefs on one sequence, so that commits of many
+// partitions are serialized instead of contending for the disk.
+scoped_refptr<base::SequencedTaskRunner> GetPrefsWriterTaskRunner() {
+  static base::NoDestructor<scoped_refptr<base::SequencedTaskRunner>>
+      task_runner(base::ThreadPool::CreateSequencedTaskRunner(
+          {base::MayBlock(), base::TaskPriority::USER_VISIBLE,
+           base::TaskShutdownBehavior::BLOCK_SHUTDOWN}));
+  return *task_runner;
+}
+
+// Traces how long each commit of the session prefs takes on the writer
+// sequence. It does not otherwise alter the prefs.
+class PrefsCommitTracer : public PrefFilter {
+ public:
+  // PrefFilter:
+  void FilterOnLoad(PostFilterOnLoadCallback post_filter_on_load_callback,
+                    base::Value::Dict pref_store_contents) override {
+    std::move(post_filter_on_load_callback)
+        .Run(std::move(pref_store_contents), false);
+  }
+  void FilterUpdate(std::string_view path) override {}
+  OnWriteCallbackPair FilterSerializeData(
+      base::Value::Dict& pref_store_contents) override {
+    // Both callbacks run on the writer sequence, around the file write.
+    return {base::BindOnce([] {
+              TRACE_EVENT_BEGIN("electron",
+                                "ElectronBrowserContext::CommitPrefs");
+            }),
+            base::BindOnce([](bool success) {
+              TRACE_EVENT_END("electron", "success", success);
+            })};
+  }
+  void OnStoreDeletionFromDisk() override {}
+};
+
 }  // namespace
 
 // static
@@ -330,6 +369,16 @@ ElectronBrowserContext::ElectronBrowserContext(
 
   base::StringToInt(command_line->GetSwitchValueASCII(switches::kDiskCacheSize),
                     &max_cache_size_);
+  if (auto max_cache_size_opt = options.FindInt("maxCacheSize"))
+    max_cache_size_ = std::max(max_cache_size_opt.value(), 0);
+  if (const std::string* backend = options.FindString("cacheBackend"))
+    http_cache_in_memory_ = *backend == "memory";
+  if (auto use_code_cache_opt = options.FindBool("codeCache"))
+    use_code_cache_ = use_code_cache_opt.value();
+  if (auto max_code_cache_size_opt = options.FindInt("maxCodeCacheSize"))
+    max_code_cache_size_ = std::max(max_code_cache_size_opt.value(), 0);
+  if (auto storage_quota_opt = options.FindDouble("storageQuota"))
+    storage_quota_ = std::max<int64_t>(storage_quota_opt.value(), 0);
 
   if (auto* path_value = std::get_if<std::reference_wrapper<const std::string>>(
           &partition_location)) {
@@ -381,7 +430,9 @@ void ElectronBrowserContext::InitPrefs() {
   ScopedAllowBlockingForElectron allow_blocking;
   PrefServiceFactory prefs_factory;
   scoped_refptr<JsonPrefStore> pref_store =
-      base::MakeRefCounted<JsonPrefStore>(prefs_path);
+      base::MakeRefCounted<JsonPrefStore>(
+          prefs_path, std::make_unique<PrefsCommitTracer>(),
+          GetPrefsWriterTaskRunner());
   pref_store->ReadPrefs();  // Synchronous.
   prefs_factory.set_user_prefs(pref_store);
   prefs_factory.set_command_line_prefs(in_memory_pref_store());
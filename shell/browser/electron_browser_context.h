@@ -121,6 +121,14 @@ class ElectronBrowserContext : public content::BrowserContext {
   std::string GetUserAgent() const;
   bool can_use_http_cache() const { return use_cache_; }
   int max_cache_size() const { return max_cache_size_; }
+  bool http_cache_in_memory() const { return http_cache_in_memory_; }
+  bool can_use_code_cache() const { return use_code_cache_; }
+  int max_code_cache_size() const { return max_code_cache_size_; }
+  int64_t storage_quota() const { return storage_quota_; }
+  bool spare_renderer_enabled() const { return spare_renderer_enabled_; }
+  void set_spare_renderer_enabled(bool enabled) {
+    spare_renderer_enabled_ = enabled;
+  }
   ResolveProxyHelper* GetResolveProxyHelper();
   predictors::PreconnectManager* GetPreconnectManager();
   scoped_refptr<network::SharedURLLoaderFactory> GetURLLoaderFactory();
@@ -238,6 +246,11 @@ class ElectronBrowserContext : public content::BrowserContext {
   bool in_memory_ = false;
   bool use_cache_ = true;
   int max_cache_size_ = 0;
+  bool http_cache_in_memory_ = false;
+  bool use_code_cache_ = true;
+  int max_code_cache_size_ = 0;
+  int64_t storage_quota_ = 0;
+  bool spare_renderer_enabled_ = false;
 
 #if BUILDFLAG(ENABLE_ELECTRON_EXTENSIONS)
   // Owned by the KeyedService system.
@@ -7,12 +7,14 @@
 #include <memory>
 #include <optional>
 #include <string>
+#include <tuple>
 #include <utility>
 #include <vector>
 
 #include "base/base_switches.h"
 #include "base/command_line.h"
 #include "base/feature_list.h"
+#include "base/functional/callback_helpers.h"
 #include "base/i18n/rtl.h"
 #include "base/metrics/field_trial.h"
 #include "base/nix/xdg_util.h"
@@ -25,12 +27,14 @@
 #include "chrome/browser/ui/color/chrome_color_mixers.h"
 #include "chrome/common/chrome_paths.h"
 #include "chrome/common/chrome_switches.h"
+#include "components/os_crypt/async/browser/os_crypt_async.h"
 #include "components/os_crypt/sync/key_storage_config_linux.h"
 #include "components/os_crypt/sync/key_storage_util_linux.h"
 #include "components/os_crypt/sync/os_crypt.h"
 #include "content/browser/browser_main_loop.h"  // nogncheck
 #include "content/public/browser/browser_child_process_host_delegate.h"
 #include "content/public/browser/browser_child_process_host_iterator.h"
+#include "content/public/browser/browser_task_traits.h"
 #include "content/public/browser/browser_thread.h"
 #include "content/public/browser/child_process_data.h"
 #include "content/public/browser/child_process_security_policy.h"
@@ -57,6 +61,7 @@
 #include "shell/browser/feature_list.h"
 #include "shell/browser/javascript_environment.h"
 #include "shell/browser/media/media_capture_devices_dispatcher.h"
+#include "shell/browser/startup_timeline.h"
 #include "shell/browser/ui/devtools_manager_delegate.h"
 #include "shell/common/api/electron_bindings.h"
 #include "shell/common/application_info.h"
@@ -129,6 +134,9 @@ namespace electron {
 
 namespace {
 
+// How long deferred startup tasks wait for a window to paint.
+constexpr base::TimeDelta kDeferredStartupTimeout = base::Seconds(10);
+
 #if BUILDFLAG(IS_LINUX)
 class LinuxUiGetterImpl : public ui::LinuxUiGetter {
  public:
@@ -208,6 +216,9 @@ int ElectronBrowserMainParts::GetExitCode() const {
 }
 
 int ElectronBrowserMainParts::PreEarlyInitialization() {
+  startup_timeline::Record(startup_timeline::Phase::kPreEarlyInitialization);
+  // The bundle is only loaded in PreCreateThreads, after the app code ran.
+  PreReadResourceBundle();
   field_trial_list_ = std::make_unique<base::FieldTrialList>();
 #if BUILDFLAG(IS_POSIX)
   HandleSIGCHLD();
@@ -241,6 +252,7 @@ void ElectronBrowserMainParts::PostEarlyInitialization() {
   // Create the global environment.
   node_env_ = node_bindings_->CreateEnvironment(
       js_env_->isolate()->GetCurrentContext(), js_env_->platform());
+  startup_timeline::Record(startup_timeline::Phase::kNodeEnvironmentCreated);
 
   node_env_->set_trace_sync_io(node_env_->options()->trace_sync_io);
 
@@ -261,13 +273,13 @@ void ElectronBrowserMainParts::PostEarlyInitialization() {
 
   // Wait for app
   node_bindings_->JoinAppCode();
+  startup_timeline::Record(startup_timeline::Phase::kAppCodeLoaded);
 
   // We already initialized the feature list in PreEarlyInitialization(), but
   // the user JS script would not have had a chance to alter the command-line
   // switches at that point. Lets reinitialize it here to pick up the
   // command-line changes.
-  base::FeatureList::ClearInstanceForTesting();
-  InitializeFeatureList();
+  ReinitializeFeatureListIfChanged();
 
   // Initialize field trials.
   InitializeFieldTrials();
@@ -279,9 +291,12 @@ void ElectronBrowserMainParts::PostEarlyInitialization() {
 
   // Initialize after user script environment creation.
   fake_browser_process_->PostEarlyInitialization();
+
+  startup_timeline::Record(startup_timeline::Phase::kPostEarlyInitialization);
 }
 
 int ElectronBrowserMainParts::PreCreateThreads() {
+  startup_timeline::Record(startup_timeline::Phase::kPreCreateThreads);
   if (!views::LayoutProvider::Get()) {
     layout_provider_ = std::make_unique<views::LayoutProvider>();
   }
@@ -346,9 +361,6 @@ int ElectronBrowserMainParts::PreCreateThreads() {
   // Force MediaCaptureDevicesDispatcher to be created on UI thread.
   MediaCaptureDevicesDispatcher::GetInstance();
 
-  // Force MediaCaptureDevicesDispatcher to be created on UI thread.
-  MediaCaptureDevicesDispatcher::GetInstance();
-
 #if BUILDFLAG(IS_MAC)
   ui::InitIdleMonitor();
   Browser::Get()->ApplyForcedRTL();
@@ -436,6 +448,7 @@ void ElectronBrowserMainParts::ToolkitInitialized() {
 }
 
 int ElectronBrowserMainParts::PreMainMessageLoopRun() {
+  startup_timeline::Record(startup_timeline::Phase::kPreMainMessageLoopRun);
   // Run user's main script before most things get initialized, so we can have
   // a chance to setup everything.
   node_bindings_->PrepareEmbedThread();
@@ -489,6 +502,17 @@ int ElectronBrowserMainParts::PreMainMessageLoopRun() {
 
   fake_browser_process_->PreMainMessageLoopRun();
 
+  // OSCryptAsync initializes its key providers on first use anyway, doing it
+  // here only saves the first caller from waiting for them.
+  PostDeferredStartupTask(base::BindOnce([] {
+    std::ignore = g_browser_process->os_crypt_async()->GetInstance(
+        base::DoNothing());
+  }));
+  deferred_startup_timer_.Start(
+      FROM_HERE, kDeferredStartupTimeout,
+      base::BindOnce(&ElectronBrowserMainParts::RunDeferredStartupTasks,
+                     base::Unretained(this)));
+
   return GetExitCode();
 }
 
@@ -647,6 +671,34 @@ ElectronBrowserMainParts::GetGeolocationControl() {
   return geolocation_control_.get();
 }
 
+void ElectronBrowserMainParts::PostDeferredStartupTask(
+    base::OnceClosure task) {
+  DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
+  if (deferred_startup_tasks_run_) {
+    content::GetUIThreadTaskRunner({base::TaskPriority::BEST_EFFORT})
+        ->PostTask(FROM_HERE, std::move(task));
+    return;
+  }
+  deferred_startup_tasks_.push_back(std::move(task));
+}
+
+void ElectronBrowserMainParts::OnFirstWindowPaint() {
+  if (!deferred_startup_tasks_run_)
+    RunDeferredStartupTasks();
+}
+
+void ElectronBrowserMainParts::RunDeferredStartupTasks() {
+  deferred_startup_tasks_run_ = true;
+  deferred_startup_timer_.Stop();
+  // Best effort so that they yield to the input and painting of the window
+  // that has just been shown.
+  auto task_runner =
+      content::GetUIThreadTaskRunner({base::TaskPriority::BEST_EFFORT});
+  for (auto& task : deferred_startup_tasks_)
+    task_runner->PostTask(FROM_HERE, std::move(task));
+  deferred_startup_tasks_.clear();
+}
+
 IconManager* ElectronBrowserMainParts::GetIconManager() {
   DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
   if (!icon_manager_.get())
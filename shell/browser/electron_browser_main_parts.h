@@ -8,6 +8,7 @@
 #include <memory>
 #include <optional>
 #include <string>
+#include <vector>
 
 #include "base/functional/callback.h"
 #include "base/task/single_thread_task_runner.h"
@@ -90,7 +91,16 @@ class ElectronBrowserMainParts : public content::BrowserMainParts {
   // Returns handle to the class responsible for extracting file icons.
   IconManager* GetIconManager();
 
+  // Runs |task| once startup has settled, after the first window has painted
+  // or after a timeout for apps that don't show one. Used for work that is
+  // worth doing early but shouldn't keep the first window from showing.
+  void PostDeferredStartupTask(base::OnceClosure task);
+
+  // Called when a window paints for the first time.
+  void OnFirstWindowPaint();
+
   Browser* browser() { return browser_.get(); }
+  NodeBindings* node_bindings() { return node_bindings_.get(); }
   BrowserProcessImpl* browser_process() { return fake_browser_process_.get(); }
 
  protected:
@@ -110,6 +120,7 @@ class ElectronBrowserMainParts : public content::BrowserMainParts {
 
  private:
   void PreCreateMainMessageLoopCommon();
+  void RunDeferredStartupTasks();
 
 #if BUILDFLAG(IS_POSIX)
   // Set signal handlers.
@@ -170,6 +181,11 @@ class ElectronBrowserMainParts : public content::BrowserMainParts {
   std::unique_ptr<Browser> browser_;
 
   std::unique_ptr<IconManager> icon_manager_;
+
+  std::vector<base::OnceClosure> deferred_startup_tasks_;
+  bool deferred_startup_tasks_run_ = false;
+  base::OneShotTimer deferred_startup_timer_;
+
   std::unique_ptr<base::FieldTrialList> field_trial_list_;
 
 #if BUILDFLAG(ENABLE_ELECTRON_EXTENSIONS)
@@ -4,14 +4,44 @@
 
 #include "shell/browser/electron_navigation_throttle.h"
 
+#include <optional>
+
+#include "base/functional/callback_helpers.h"
+
 #include "content/browser/renderer_host/render_frame_host_impl.h"  // nogncheck
 #include "content/public/browser/navigation_handle.h"
 #include "shell/browser/api/electron_api_web_contents.h"
 #include "shell/browser/javascript_environment.h"
+#include "shell/common/platform_util.h"
 #include "ui/base/page_transition_types.h"
 
 namespace electron {
 
+namespace {
+
+// Decides the navigation natively if it matches a navigation rule of
+// |api_contents|, so that JS is only asked about the rest.
+std::optional<content::NavigationThrottle::ThrottleCheckResult>
+ApplyNavigationRules(api::WebContents* api_contents,
+                     content::NavigationHandle* handle) {
+  using Action = api::WebContents::NavigationRule::Action;
+  switch (api_contents->GetNavigationRuleAction(handle)) {
+    case Action::kAsk:
+      return std::nullopt;
+    case Action::kAllow:
+      return content::NavigationThrottle::PROCEED;
+    case Action::kDeny:
+      return content::NavigationThrottle::CANCEL;
+    case Action::kOpenExternally:
+      platform_util::OpenExternal(handle->GetURL(),
+                                  platform_util::OpenExternalOptions{},
+                                  base::DoNothing());
+      return content::NavigationThrottle::CANCEL;
+  }
+}
+
+}  // namespace
+
 ElectronNavigationThrottle::ElectronNavigationThrottle(
     content::NavigationHandle* navigation_handle)
     : content::NavigationThrottle(navigation_handle) {}
@@ -52,11 +82,16 @@ ElectronNavigationThrottle::WillStartRequest() {
     is_renderer_initiated = rfh_impl && rfh_impl->web_ui();
   }
 
-  if (is_renderer_initiated &&
-      api_contents->EmitNavigationEvent("will-frame-navigate", handle)) {
+  if (!is_renderer_initiated)
+    return PROCEED;
+
+  if (auto result = ApplyNavigationRules(api_contents, handle))
+    return *result;
+
+  if (api_contents->EmitNavigationEvent("will-frame-navigate", handle)) {
     return CANCEL;
   }
-  if (is_renderer_initiated && handle->IsInMainFrame() &&
+  if (handle->IsInMainFrame() &&
       api_contents->EmitNavigationEvent("will-navigate", handle)) {
     return CANCEL;
   }
@@ -80,6 +115,9 @@ ElectronNavigationThrottle::WillRedirectRequest() {
     return PROCEED;
   }
 
+  if (auto result = ApplyNavigationRules(api_contents, handle))
+    return *result;
+
   if (api_contents->EmitNavigationEvent("will-redirect", handle)) {
     return CANCEL;
   }
@@ -5,6 +5,7 @@
 #include "shell/browser/electron_permission_manager.h"
 
 #include <memory>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -34,6 +35,9 @@ namespace electron {
 
 namespace {
 
+// Upper bound on cached permission check decisions per session.
+constexpr size_t kMaxCheckCacheSize = 256;
+
 bool WebContentsDestroyed(content::RenderFrameHost* rfh) {
   content::WebContents* web_contents =
       content::WebContents::FromRenderFrameHost(rfh);
@@ -117,11 +121,15 @@ void ElectronPermissionManager::SetPermissionRequestHandler(
     pending_requests_.Clear();
   }
   request_handler_ = handler;
+  check_cache_.clear();
 }
 
 void ElectronPermissionManager::SetPermissionCheckHandler(
-    const CheckHandler& handler) {
+    const CheckHandler& handler,
+    base::TimeDelta cache_duration) {
   check_handler_ = handler;
+  check_cache_duration_ = cache_duration;
+  check_cache_.clear();
 }
 
 void ElectronPermissionManager::SetDevicePermissionHandler(
@@ -240,7 +248,9 @@ void ElectronPermissionManager::OnPermissionResponse(
 void ElectronPermissionManager::ResetPermission(
     blink::PermissionType permission,
     const GURL& requesting_origin,
-    const GURL& embedding_origin) {}
+    const GURL& embedding_origin) {
+  check_cache_.clear();
+}
 
 void ElectronPermissionManager::RequestPermissionsFromCurrentDocument(
     content::RenderFrameHost* render_frame_host,
@@ -309,8 +319,9 @@ bool ElectronPermissionManager::CheckPermissionWithDetails(
     details.Set("requestingUrl",
                 render_frame_host->GetLastCommittedURL().spec());
   }
-  details.Set("isMainFrame",
-              render_frame_host && render_frame_host->GetParent() == nullptr);
+  const bool is_main_frame =
+      render_frame_host && render_frame_host->GetParent() == nullptr;
+  details.Set("isMainFrame", is_main_frame);
   switch (permission) {
     case blink::PermissionType::AUDIO_CAPTURE:
       details.Set("mediaType", "audio");
@@ -321,8 +332,40 @@ bool ElectronPermissionManager::CheckPermissionWithDetails(
     default:
       break;
   }
-  return check_handler_.Run(web_contents, permission, requesting_origin,
-                            base::Value(std::move(details)));
+
+  if (check_cache_duration_.is_zero()) {
+    return check_handler_.Run(web_contents, permission, requesting_origin,
+                              base::Value(std::move(details)));
+  }
+
+  std::string embedding_origin;
+  if (const std::string* origin = details.FindString("embeddingOrigin"))
+    embedding_origin = *origin;
+  else if (render_frame_host)
+    embedding_origin = render_frame_host->GetOutermostMainFrame()
+                           ->GetLastCommittedOrigin()
+                           .Serialize();
+  CheckCacheKey key{permission,
+                    url::Origin::Create(requesting_origin).Serialize(),
+                    std::move(embedding_origin), is_main_frame};
+
+  const base::TimeTicks now = base::TimeTicks::Now();
+  if (auto it = check_cache_.find(key);
+      it != check_cache_.end() && it->second.expiry > now)
+    return it->second.granted;
+
+  bool granted = check_handler_.Run(web_contents, permission,
+                                    requesting_origin,
+                                    base::Value(std::move(details)));
+
+  if (check_cache_.size() >= kMaxCheckCacheSize) {
+    std::erase_if(check_cache_,
+                  [now](const auto& item) { return item.second.expiry <= now; });
+    if (check_cache_.size() >= kMaxCheckCacheSize)
+      check_cache_.clear();
+  }
+  check_cache_[std::move(key)] = {granted, now + check_cache_duration_};
+  return granted;
 }
 
 bool ElectronPermissionManager::CheckDevicePermission(
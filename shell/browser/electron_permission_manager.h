@@ -5,11 +5,15 @@
 #ifndef ELECTRON_SHELL_BROWSER_ELECTRON_PERMISSION_MANAGER_H_
 #define ELECTRON_SHELL_BROWSER_ELECTRON_PERMISSION_MANAGER_H_
 
+#include <map>
 #include <memory>
+#include <string>
+#include <tuple>
 #include <vector>
 
 #include "base/containers/id_map.h"
 #include "base/functional/callback.h"
+#include "base/time/time.h"
 #include "content/public/browser/permission_controller_delegate.h"
 #include "gin/dictionary.h"
 #include "shell/browser/electron_browser_context.h"
@@ -70,7 +74,11 @@ class ElectronPermissionManager : public content::PermissionControllerDelegate {
 
   // Handler to dispatch permission requests in JS.
   void SetPermissionRequestHandler(const RequestHandler& handler);
-  void SetPermissionCheckHandler(const CheckHandler& handler);
+  // When |cache_duration| is non-zero, the decisions of |handler| are reused
+  // for that long for checks with the same permission, requesting origin,
+  // embedding origin and frame kind, instead of calling it again.
+  void SetPermissionCheckHandler(const CheckHandler& handler,
+                                 base::TimeDelta cache_duration = {});
   void SetDevicePermissionHandler(const DeviceCheckHandler& handler);
   void SetProtectedUSBHandler(const ProtectedUSBHandler& handler);
   void SetBluetoothPairingHandler(const BluetoothPairingHandler& handler);
@@ -158,8 +166,18 @@ class ElectronPermissionManager : public content::PermissionControllerDelegate {
       base::Value::Dict details,
       StatusesCallback callback);
 
+  // permission, requesting origin, embedding origin, is main frame.
+  using CheckCacheKey =
+      std::tuple<blink::PermissionType, std::string, std::string, bool>;
+  struct CheckCacheEntry {
+    bool granted;
+    base::TimeTicks expiry;
+  };
+
   RequestHandler request_handler_;
   CheckHandler check_handler_;
+  base::TimeDelta check_cache_duration_;
+  mutable std::map<CheckCacheKey, CheckCacheEntry> check_cache_;
   DeviceCheckHandler device_permission_handler_;
   ProtectedUSBHandler protected_usb_handler_;
   BluetoothPairingHandler bluetooth_pairing_handler_;
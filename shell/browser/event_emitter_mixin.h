@@ -10,6 +10,7 @@
 
 #include "gin/handle.h"
 #include "gin/object_template_builder.h"
+#include "shell/browser/api/electron_api_event_emitter.h"
 #include "shell/browser/javascript_environment.h"
 #include "shell/common/gin_helper/event.h"
 #include "shell/common/gin_helper/event_emitter.h"
@@ -32,6 +33,9 @@ class EventEmitterMixin {
     v8::Local<v8::Object> wrapper;
     if (!static_cast<T*>(this)->GetWrapper(isolate).ToLocal(&wrapper))
       return false;
+    // Nobody could have called preventDefault() on the event.
+    if (!gin_helper::HasEventListeners(isolate, wrapper, name))
+      return false;
     gin::Handle<internal::Event> event = internal::Event::New(isolate);
     gin_helper::EmitEvent(isolate, wrapper, name, event,
                           std::forward<Args>(args)...);
@@ -46,6 +50,8 @@ class EventEmitterMixin {
     v8::Local<v8::Object> wrapper;
     if (!static_cast<T*>(this)->GetWrapper(isolate).ToLocal(&wrapper))
       return;
+    if (!gin_helper::HasEventListeners(isolate, wrapper, name))
+      return;
     gin_helper::EmitEvent(isolate, wrapper, name, std::forward<Args>(args)...);
   }
 
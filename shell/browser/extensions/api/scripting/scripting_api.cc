@@ -5,13 +5,18 @@
 #include "shell/browser/extensions/api/scripting/scripting_api.h"
 
 #include <algorithm>
+#include <map>
+#include <utility>
 
 #include "base/check.h"
 #include "base/containers/contains.h"
 #include "base/json/json_writer.h"
+#include "base/no_destructor.h"
+#include "base/scoped_multi_source_observation.h"
 #include "base/strings/string_util.h"
 #include "base/strings/stringprintf.h"
 #include "base/strings/utf_string_conversions.h"
+#include "base/task/sequenced_task_runner.h"
 #include "base/types/optional_util.h"
 #include "chrome/common/extensions/api/scripting.h"
 #include "content/public/browser/browser_task_traits.h"
@@ -23,6 +28,7 @@
 #include "extensions/browser/extension_api_frame_id_map.h"
 #include "extensions/browser/extension_file_task_runner.h"
 #include "extensions/browser/extension_registry.h"
+#include "extensions/browser/extension_registry_observer.h"
 #include "extensions/browser/extension_system.h"
 #include "extensions/browser/extension_user_script_loader.h"
 #include "extensions/browser/extension_util.h"
@@ -197,6 +203,112 @@ bool GetFileResources(const std::vector<std::string>& files,
   return true;
 }
 
+// Keeps the loaded and localized contents of files injected with
+// chrome.scripting, so that injecting the same files again does not read and
+// localize them from disk each time. Entries are tied to the Extension object
+// they were loaded for, which is replaced whenever the extension is reloaded,
+// and are dropped when the extension is unloaded.
+class InjectedFileCache : public ExtensionRegistryObserver {
+ public:
+  static InjectedFileCache* Get() {
+    static base::NoDestructor<InjectedFileCache> cache;
+    return cache.get();
+  }
+
+  // Starts watching `browser_context` for unloaded extensions.
+  void Observe(content::BrowserContext* browser_context) {
+    DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
+    ExtensionRegistry* registry = ExtensionRegistry::Get(browser_context);
+    if (!registry_observations_.IsObservingSource(registry))
+      registry_observations_.AddObservation(registry);
+  }
+
+  // Returns a copy of the contents of every file in `files`, or nothing if
+  // any of them is not cached.
+  std::optional<std::vector<std::unique_ptr<std::string>>> Lookup(
+      const Extension& extension,
+      const std::vector<std::string>& files,
+      bool localized) const {
+    DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
+    auto it = entries_.find(extension.id());
+    if (it == entries_.end() || it->second.extension.get() != &extension)
+      return std::nullopt;
+
+    std::vector<std::unique_ptr<std::string>> data;
+    data.reserve(files.size());
+    for (const auto& file : files) {
+      auto file_it = it->second.files.find({file, localized});
+      if (file_it == it->second.files.end())
+        return std::nullopt;
+      data.push_back(std::make_unique<std::string>(file_it->second));
+    }
+    return data;
+  }
+
+  void Store(scoped_refptr<const Extension> extension,
+             const std::vector<InjectedFileSource>& sources,
+             bool localized) {
+    DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
+    auto& entry = entries_[extension->id()];
+    if (entry.extension != extension) {
+      RemoveFiles(entry);
+      entry.extension = std::move(extension);
+    }
+
+    for (const auto& source : sources) {
+      if (total_size_ + source.data->size() > kMaxTotalSize) {
+        for (auto& [id, other_entry] : entries_)
+          RemoveFiles(other_entry);
+      }
+      auto [it, inserted] =
+          entry.files.try_emplace({source.file_name, localized}, *source.data);
+      if (inserted)
+        total_size_ += it->second.size();
+    }
+  }
+
+ private:
+  friend class base::NoDestructor<InjectedFileCache>;
+
+  // Bounds the memory used by the cache. Exceeding it clears the cache.
+  static constexpr size_t kMaxTotalSize = 32 * 1024 * 1024;
+
+  struct Entry {
+    scoped_refptr<const Extension> extension;
+    // Keyed by file name and whether the contents were localized.
+    std::map<std::pair<std::string, bool>, std::string> files;
+  };
+
+  InjectedFileCache() = default;
+  ~InjectedFileCache() override = default;
+
+  // ExtensionRegistryObserver:
+  void OnExtensionUnloaded(content::BrowserContext* browser_context,
+                           const Extension* extension,
+                           UnloadedExtensionReason reason) override {
+    auto it = entries_.find(extension->id());
+    if (it == entries_.end())
+      return;
+    RemoveFiles(it->second);
+    entries_.erase(it);
+  }
+  void OnShutdown(ExtensionRegistry* registry) override {
+    registry_observations_.RemoveObservation(registry);
+  }
+
+  void RemoveFiles(Entry& entry) {
+    for (const auto& [key, contents] : entry.files)
+      total_size_ -= contents.size();
+    entry.files.clear();
+  }
+
+  std::map<ExtensionId, Entry> entries_;
+  size_t total_size_ = 0;
+  base::ScopedMultiSourceObservation<ExtensionRegistry,
+                                     ExtensionRegistryObserver>
+      registry_observations_{this};
+};
+
 using ResourcesLoadedCallback =
     base::OnceCallback<void(std::vector<InjectedFileSource>,
                             std::optional<std::string>)>;
@@ -204,6 +316,9 @@ using ResourcesLoadedCallback =
 // Checks the loaded content of extension resources. Invokes `callback` with
 // the constructed file sources on success or with an error on failure.
 void CheckLoadedResources(std::vector<std::string> file_names,
+                          scoped_refptr<const Extension> extension,
+                          bool localized,
+                          bool from_cache,
                           ResourcesLoadedCallback callback,
                           std::vector<std::unique_ptr<std::string>> file_data,
                           std::optional<std::string> load_error) {
@@ -215,6 +330,12 @@ void CheckLoadedResources(std::vector<std::string> file_names,
   std::vector<InjectedFileSource> file_sources =
       ConstructFileSources(std::move(file_data), std::move(file_names));
 
+  // Cached contents have already been validated below.
+  if (from_cache) {
+    std::move(callback).Run(std::move(file_sources), std::nullopt);
+    return;
+  }
+
   for (const auto& source : file_sources) {
     DCHECK(source.data);
     // TODO(devlin): What necessitates this encoding requirement? Is it needed
@@ -229,13 +350,16 @@ void CheckLoadedResources(std::vector<std::string> file_names,
     }
   }
 
+  InjectedFileCache::Get()->Store(std::move(extension), file_sources,
+                                  localized);
   std::move(callback).Run(std::move(file_sources), std::nullopt);
 }
 
 // Checks the specified `files` for validity, and attempts to load and localize
 // them, invoking `callback` with the result. Returns true on success; on
 // failure, populates `error`.
-bool CheckAndLoadFiles(std::vector<std::string> files,
+bool CheckAndLoadFiles(content::BrowserContext* browser_context,
+                       std::vector<std::string> files,
                        const Extension& extension,
                        bool requires_localization,
                        ResourcesLoadedCallback callback,
@@ -244,11 +368,25 @@ bool CheckAndLoadFiles(std::vector<std::string> files,
   if (!GetFileResources(files, extension, &resources, error))
     return false;
 
-  LoadAndLocalizeResources(
-      extension, resources, requires_localization,
-      script_parsing::GetMaxScriptLength(),
-      base::BindOnce(&CheckLoadedResources, std::move(files),
-                     std::move(callback)));
+  InjectedFileCache::Get()->Observe(browser_context);
+
+  auto cached = InjectedFileCache::Get()->Lookup(extension, files,
+                                                 requires_localization);
+  // The callback is always run asynchronously, like when loading from disk.
+  auto loaded_callback = base::BindOnce(
+      &CheckLoadedResources, files, base::WrapRefCounted(&extension),
+      requires_localization, cached.has_value(), std::move(callback));
+  if (cached) {
+    base::SequencedTaskRunner::GetCurrentDefault()->PostTask(
+        FROM_HERE, base::BindOnce(std::move(loaded_callback),
+                                  std::move(*cached),
+                                  std::optional<std::string>()));
+    return true;
+  }
+
+  LoadAndLocalizeResources(extension, resources, requires_localization,
+                           script_parsing::GetMaxScriptLength(),
+                           std::move(loaded_callback));
   return true;
 }
 
@@ -613,7 +751,8 @@ ExtensionFunction::ResponseAction ScriptingExecuteScriptFunction::Run() {
     constexpr bool kRequiresLocalization = false;
     std::string error;
     if (!CheckAndLoadFiles(
-            std::move(*injection_.files), *extension(), kRequiresLocalization,
+            browser_context(), std::move(*injection_.files), *extension(),
+            kRequiresLocalization,
             base::BindOnce(&ScriptingExecuteScriptFunction::DidLoadResources,
                            this),
             &error)) {
@@ -767,7 +906,8 @@ ExtensionFunction::ResponseAction ScriptingInsertCSSFunction::Run() {
     constexpr bool kRequiresLocalization = true;
     std::string error;
     if (!CheckAndLoadFiles(
-            std::move(*injection_.files), *extension(), kRequiresLocalization,
+            browser_context(), std::move(*injection_.files), *extension(),
+            kRequiresLocalization,
             base::BindOnce(&ScriptingInsertCSSFunction::DidLoadResources, this),
             &error)) {
       return RespondNow(Error(std::move(error)));
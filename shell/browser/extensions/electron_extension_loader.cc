@@ -4,22 +4,32 @@
 
 #include "shell/browser/extensions/electron_extension_loader.h"
 
+#include <map>
+#include <optional>
+#include <string>
 #include <utility>
 
 #include "base/auto_reset.h"
+#include "base/files/file.h"
 #include "base/files/file_path.h"
 #include "base/files/file_util.h"
 #include "base/functional/bind.h"
+#include "base/hash/hash.h"
 #include "base/logging.h"
+#include "base/no_destructor.h"
 #include "base/strings/string_number_conversions.h"
 #include "base/strings/utf_string_conversions.h"
+#include "base/synchronization/lock.h"
 #include "base/task/sequenced_task_runner.h"
+#include "base/task/thread_pool.h"
+#include "base/thread_annotations.h"
 #include "base/threading/thread_restrictions.h"
 #include "base/time/time.h"
-#include "extensions/browser/extension_file_task_runner.h"
+#include "content/public/browser/browser_thread.h"
 #include "extensions/browser/extension_prefs.h"
 #include "extensions/browser/extension_registry.h"
 #include "extensions/browser/pref_names.h"
+#include "extensions/common/constants.h"
 #include "extensions/common/error_utils.h"
 #include "extensions/common/file_util.h"
 #include "extensions/common/manifest_constants.h"
@@ -30,9 +40,83 @@ using LoadErrorBehavior = ExtensionRegistrar::LoadErrorBehavior;
 
 namespace {
 
-std::pair<scoped_refptr<const Extension>, std::string> LoadUnpacked(
-    const base::FilePath& extension_dir,
-    int load_flags) {
+using LoadResult = std::pair<scoped_refptr<const Extension>, std::string>;
+
+// Identifies the contents of an extension directory: the modification times
+// of the directory and of its manifest, and the size and hash of the
+// manifest. Modification times alone miss edits that land within the
+// timestamp granularity of the file system.
+struct Stamp {
+  base::Time dir_modified;
+  base::Time manifest_modified;
+  size_t manifest_size;
+  uint32_t manifest_hash;
+
+  bool operator==(const Stamp&) const = default;
+};
+
+// Caches successfully parsed extensions so that loading the same unpacked
+// extension again, e.g. into another session or on a later loadExtension()
+// call, does not re-read and re-validate it. An entry is only reused while the
+// stamp of the extension directory is unchanged; the manifest is checked as
+// well because editing a file in place does not update the directory's
+// modification time on every platform.
+class ParsedExtensionCache {
+ public:
+  static ParsedExtensionCache* Get() {
+    static base::NoDestructor<ParsedExtensionCache> cache;
+    return cache.get();
+  }
+
+  std::optional<LoadResult> Find(const base::FilePath& extension_dir,
+                                 int load_flags,
+                                 const Stamp& stamp) {
+    base::AutoLock lock(lock_);
+    auto it = entries_.find({extension_dir, load_flags});
+    if (it == entries_.end() || it->second.stamp != stamp)
+      return std::nullopt;
+    return it->second.result;
+  }
+
+  void Insert(const base::FilePath& extension_dir,
+              int load_flags,
+              const Stamp& stamp,
+              const LoadResult& result) {
+    base::AutoLock lock(lock_);
+    entries_[{extension_dir, load_flags}] = {stamp, result};
+  }
+
+  // Returns the stamp that identifies the current contents of
+  // |extension_dir|, or nullopt if it cannot be determined.
+  static std::optional<Stamp> GetStamp(const base::FilePath& extension_dir) {
+    const base::FilePath manifest_path =
+        extension_dir.Append(kManifestFilename);
+    base::File::Info dir_info;
+    base::File::Info manifest_info;
+    std::string manifest;
+    if (!base::GetFileInfo(extension_dir, &dir_info) ||
+        !base::GetFileInfo(manifest_path, &manifest_info) ||
+        !base::ReadFileToString(manifest_path, &manifest))
+      return std::nullopt;
+    return Stamp{dir_info.last_modified, manifest_info.last_modified,
+                 manifest.size(), base::FastHash(manifest)};
+  }
+
+ private:
+  friend class base::NoDestructor<ParsedExtensionCache>;
+
+  struct Entry {
+    Stamp stamp;
+    LoadResult result;
+  };
+
+  ParsedExtensionCache() = default;
+
+  base::Lock lock_;
+  std::map<std::pair<base::FilePath, int>, Entry> entries_ GUARDED_BY(lock_);
+};
+
+LoadResult LoadUnpacked(const base::FilePath& extension_dir, int load_flags) {
   // app_shell only supports unpacked extensions.
   // NOTE: If you add packed extension support consider removing the flag
   // FOLLOW_SYMLINKS_ANYWHERE below. Packed extensions should not have symlinks.
@@ -90,6 +174,43 @@ std::pair<scoped_refptr<const Extension>, std::string> LoadUnpacked(
   return std::make_pair(extension, warnings);
 }
 
+LoadResult LoadUnpackedCached(const base::FilePath& extension_dir,
+                              int load_flags) {
+  auto* cache = ParsedExtensionCache::Get();
+  std::optional<Stamp> stamp = ParsedExtensionCache::GetStamp(extension_dir);
+  if (stamp) {
+    if (auto cached = cache->Find(extension_dir, load_flags, *stamp))
+      return std::move(*cached);
+  }
+
+  LoadResult result = LoadUnpacked(extension_dir, load_flags);
+  // Loading may have deleted the _metadata folder, which changes the
+  // directory's modification time, so take the stamp again.
+  if (result.first) {
+    if ((stamp = ParsedExtensionCache::GetStamp(extension_dir)))
+      cache->Insert(extension_dir, load_flags, *stamp, result);
+  }
+  return result;
+}
+
+// Returns the task runner that loads of |extension_dir| run on. Loads of the
+// same directory must not overlap, since each of them deletes its _metadata
+// folder, while loads of different directories still run in parallel.
+scoped_refptr<base::SequencedTaskRunner> GetLoadTaskRunner(
+    const base::FilePath& extension_dir) {
+  DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
+  static base::NoDestructor<
+      std::map<base::FilePath, scoped_refptr<base::SequencedTaskRunner>>>
+      task_runners;
+  auto& task_runner = (*task_runners)[extension_dir];
+  if (!task_runner) {
+    task_runner = base::ThreadPool::CreateSequencedTaskRunner(
+        {base::MayBlock(), base::TaskPriority::USER_BLOCKING,
+         base::TaskShutdownBehavior::SKIP_ON_SHUTDOWN});
+  }
+  return task_runner;
+}
+
 }  // namespace
 
 ElectronExtensionLoader::ElectronExtensionLoader(
@@ -103,10 +224,15 @@ void ElectronExtensionLoader::LoadExtension(
     const base::FilePath& extension_dir,
     int load_flags,
     base::OnceCallback<void(const Extension*, const std::string&)> cb) {
-  GetExtensionFileTaskRunner()->PostTaskAndReplyWithResult(
-      FROM_HERE, base::BindOnce(&LoadUnpacked, extension_dir, load_flags),
-      base::BindOnce(&ElectronExtensionLoader::FinishExtensionLoad,
-                     weak_factory_.GetWeakPtr(), std::move(cb)));
+  // Loads of different extensions are independent of each other, so they run
+  // on per-directory sequences rather than the sequenced extension file task
+  // runner, allowing several extensions to be read and validated in parallel.
+  GetLoadTaskRunner(extension_dir)
+      ->PostTaskAndReplyWithResult(
+          FROM_HERE,
+          base::BindOnce(&LoadUnpackedCached, extension_dir, load_flags),
+          base::BindOnce(&ElectronExtensionLoader::FinishExtensionLoad,
+                         weak_factory_.GetWeakPtr(), std::move(cb)));
 }
 
 void ElectronExtensionLoader::ReloadExtension(const ExtensionId& extension_id) {
@@ -205,7 +331,7 @@ void ElectronExtensionLoader::LoadExtensionForReload(
   // when loading this extension and retain it here. As is, reloading an
   // extension will cause the file access permission to be dropped.
   int load_flags = Extension::FOLLOW_SYMLINKS_ANYWHERE;
-  GetExtensionFileTaskRunner()->PostTaskAndReplyWithResult(
+  GetLoadTaskRunner(path)->PostTaskAndReplyWithResult(
       FROM_HERE, base::BindOnce(&LoadUnpacked, path, load_flags),
       base::BindOnce(&ElectronExtensionLoader::FinishExtensionReload,
                      weak_factory_.GetWeakPtr(), extension_id));
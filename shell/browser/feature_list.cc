@@ -5,17 +5,23 @@
 #include "electron/shell/browser/feature_list.h"
 
 #include <string>
+#include <utility>
 
 #include "base/base_switches.h"
 #include "base/command_line.h"
 #include "base/feature_list.h"
 #include "base/metrics/field_trial.h"
+#include "base/no_destructor.h"
+#include "base/strings/strcat.h"
+#include "base/strings/string_number_conversions.h"
+#include "components/download/public/common/download_features.h"
 #include "components/spellcheck/common/spellcheck_features.h"
 #include "content/public/common/content_features.h"
 #include "electron/buildflags/buildflags.h"
 #include "media/base/media_switches.h"
 #include "net/base/features.h"
 #include "services/network/public/cpp/features.h"
+#include "shell/common/options_switches.h"
 #include "third_party/blink/public/common/features.h"
 
 #if BUILDFLAG(IS_MAC)
@@ -24,7 +30,40 @@
 
 namespace electron {
 
-void InitializeFeatureList() {
+namespace {
+
+// Builds the ParallelDownloading feature with the field trial params that
+// Chromium's parallel download job reads, or returns an empty string when
+// neither switch was passed.
+std::string GetParallelDownloadingFeature(const base::CommandLine& cmd_line) {
+  std::string params;
+  int value = 0;
+  if (base::StringToInt(
+          cmd_line.GetSwitchValueASCII(switches::kParallelDownloadSlices),
+          &value) &&
+      value > 0) {
+    params = base::StrCat({"request_count/", base::NumberToString(value)});
+  }
+  if (base::StringToInt(
+          cmd_line.GetSwitchValueASCII(switches::kParallelDownloadMinSliceSize),
+          &value) &&
+      value > 0) {
+    base::StrAppend(&params, {params.empty() ? "" : "/", "min_slice_size/",
+                              base::NumberToString(value)});
+  }
+  if (params.empty())
+    return std::string();
+  return base::StrCat(
+      {download::features::kParallelDownloading.name, ":", params});
+}
+
+// The enable and disable strings the feature list was last initialized from.
+std::pair<std::string, std::string>& GetLastFeatureSwitches() {
+  static base::NoDestructor<std::pair<std::string, std::string>> switches;
+  return *switches;
+}
+
+std::pair<std::string, std::string> GetFeatureSwitches() {
   auto* cmd_line = base::CommandLine::ForCurrentProcess();
   auto enable_features =
       cmd_line->GetSwitchValueASCII(::switches::kEnableFeatures);
@@ -40,6 +79,12 @@ void InitializeFeatureList() {
   // TODO(codebytere): Remove WebSQL support per crbug.com/695592.
   enable_features += std::string(",") + blink::features::kWebSQLAccess.name;
 
+  // Chromium only reads the slice count and size from the feature params, so
+  // they can't differ between downloads.
+  std::string parallel_downloading = GetParallelDownloadingFeature(*cmd_line);
+  if (!parallel_downloading.empty())
+    enable_features += std::string(",") + parallel_downloading;
+
 #if BUILDFLAG(IS_WIN)
   disable_features +=
       // Disable async spellchecker suggestions for Windows, which causes
@@ -54,7 +99,24 @@ void InitializeFeatureList() {
   if (platform_specific_enable_features.size() > 0) {
     enable_features += std::string(",") + platform_specific_enable_features;
   }
-  base::FeatureList::InitInstance(enable_features, disable_features);
+  return {std::move(enable_features), std::move(disable_features)};
+}
+
+}  // namespace
+
+void InitializeFeatureList() {
+  auto& last_switches = GetLastFeatureSwitches();
+  last_switches = GetFeatureSwitches();
+  base::FeatureList::InitInstance(last_switches.first, last_switches.second);
+}
+
+void ReinitializeFeatureListIfChanged() {
+  // Parsing the feature strings again is only needed when the app's code
+  // appended to them, which most apps don't.
+  if (GetFeatureSwitches() == GetLastFeatureSwitches())
+    return;
+  base::FeatureList::ClearInstanceForTesting();
+  InitializeFeatureList();
 }
 
 void InitializeFieldTrials() {
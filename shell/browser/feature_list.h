@@ -9,6 +9,9 @@
 
 namespace electron {
 void InitializeFeatureList();
+// Re-initializes the feature list if the app changed the feature switches
+// since the last call to InitializeFeatureList().
+void ReinitializeFeatureListIfChanged();
 void InitializeFieldTrials();
 std::string EnablePlatformSpecificFeatures();
 }  // namespace electron
@@ -281,9 +281,13 @@ class FileSystemAccessPermissionContext::PermissionGrantImpl
     DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
 
     auto permission_changed = status_ != new_status;
+    const bool was_granted = status_ == PermissionStatus::GRANTED;
     status_ = new_status;
 
     if (permission_changed) {
+      const bool is_granted = new_status == PermissionStatus::GRANTED;
+      if (context_ && was_granted != is_granted)
+        context_->PermissionGrantGrantedChanged(this, is_granted);
       NotifyPermissionStatusChanged();
     }
   }
@@ -293,9 +297,7 @@ class FileSystemAccessPermissionContext::PermissionGrantImpl
       const base::FilePath& old_path,
       const base::FilePath& new_path) {
     DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
-    auto entry_it = base::ranges::find_if(
-        grants,
-        [&old_path](const auto& entry) { return entry.first == old_path; });
+    auto entry_it = grants.find(old_path);
 
     if (entry_it == grants.end()) {
       // There must be an entry for an ancestor of this entry. Nothing to do
@@ -364,6 +366,11 @@ struct FileSystemAccessPermissionContext::OriginState {
   // PermissionGrantDestroyed().
   std::map<base::FilePath, PermissionGrantImpl*> read_grants;
   std::map<base::FilePath, PermissionGrantImpl*> write_grants;
+
+  // Number of live grants of each type whose status is GRANTED, so that
+  // OriginHas{Read,Write}Access() don't have to scan every grant.
+  size_t granted_read_count = 0;
+  size_t granted_write_count = 0;
 };
 
 FileSystemAccessPermissionContext::FileSystemAccessPermissionContext(
@@ -685,17 +692,17 @@ void FileSystemAccessPermissionContext::RevokeGrant(
   DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
 
   auto origin_it = active_permissions_map_.find(origin);
-  if (origin_it != active_permissions_map_.end()) {
-    OriginState& origin_state = origin_it->second;
-    for (auto& grant : origin_state.read_grants) {
-      if (file_path.empty() || grant.first == file_path) {
-        grant.second->SetStatus(PermissionStatus::ASK);
-      }
-    }
-    for (auto& grant : origin_state.write_grants) {
-      if (file_path.empty() || grant.first == file_path) {
+  if (origin_it == active_permissions_map_.end())
+    return;
+
+  OriginState& origin_state = origin_it->second;
+  for (auto* grants : {&origin_state.read_grants, &origin_state.write_grants}) {
+    if (file_path.empty()) {
+      for (auto& grant : *grants)
         grant.second->SetStatus(PermissionStatus::ASK);
-      }
+    } else if (auto grant_it = grants->find(file_path);
+               grant_it != grants->end()) {
+      grant_it->second->SetStatus(PermissionStatus::ASK);
     }
   }
 }
@@ -705,13 +712,8 @@ bool FileSystemAccessPermissionContext::OriginHasReadAccess(
   DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
 
   auto it = active_permissions_map_.find(origin);
-  if (it != active_permissions_map_.end()) {
-    return base::ranges::any_of(it->second.read_grants, [&](const auto& grant) {
-      return grant.second->GetStatus() == PermissionStatus::GRANTED;
-    });
-  }
-
-  return false;
+  return it != active_permissions_map_.end() &&
+         it->second.granted_read_count > 0;
 }
 
 bool FileSystemAccessPermissionContext::OriginHasWriteAccess(
@@ -719,14 +721,8 @@ bool FileSystemAccessPermissionContext::OriginHasWriteAccess(
   DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
 
   auto it = active_permissions_map_.find(origin);
-  if (it != active_permissions_map_.end()) {
-    return base::ranges::any_of(
-        it->second.write_grants, [&](const auto& grant) {
-          return grant.second->GetStatus() == PermissionStatus::GRANTED;
-        });
-  }
-
-  return false;
+  return it != active_permissions_map_.end() &&
+         it->second.granted_write_count > 0;
 }
 
 void FileSystemAccessPermissionContext::CleanupPermissions(
@@ -771,6 +767,9 @@ void FileSystemAccessPermissionContext::PermissionGrantDestroyed(
     return;
   }
 
+  if (grant->GetStatus() == PermissionStatus::GRANTED)
+    PermissionGrantGrantedChanged(grant, false);
+
   auto& grants = grant->type() == GrantType::kRead ? it->second.read_grants
                                                    : it->second.write_grants;
   auto grant_it = grants.find(grant->GetPath());
@@ -791,6 +790,26 @@ void FileSystemAccessPermissionContext::PermissionGrantDestroyed(
   }
 }
 
+void FileSystemAccessPermissionContext::PermissionGrantGrantedChanged(
+    PermissionGrantImpl* grant,
+    bool granted) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  auto it = active_permissions_map_.find(grant->origin());
+  if (it == active_permissions_map_.end()) {
+    return;
+  }
+
+  size_t& count = grant->type() == GrantType::kRead
+                      ? it->second.granted_read_count
+                      : it->second.granted_write_count;
+  if (granted) {
+    ++count;
+  } else {
+    DCHECK_GT(count, 0u);
+    --count;
+  }
+}
+
 base::WeakPtr<FileSystemAccessPermissionContext>
 FileSystemAccessPermissionContext::GetWeakPtr() {
   return weak_factory_.GetWeakPtr();
@@ -119,6 +119,7 @@ class FileSystemAccessPermissionContext
   class PermissionGrantImpl;
 
   void PermissionGrantDestroyed(PermissionGrantImpl* grant);
+  void PermissionGrantGrantedChanged(PermissionGrantImpl* grant, bool granted);
 
   void CheckPathAgainstBlocklist(PathType path_type,
                                  const base::FilePath& path,
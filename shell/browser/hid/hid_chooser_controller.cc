@@ -99,7 +99,7 @@ HidChooserController::HidChooserController(
                          ->AsWeakPtr();
   DCHECK(chooser_context_);
 
-  chooser_context_->GetHidManager()->GetDevices(base::BindOnce(
+  chooser_context_->GetDevices(base::BindOnce(
       &HidChooserController::OnGotDevices, weak_factory_.GetWeakPtr()));
 }
 
@@ -222,12 +222,11 @@ void HidChooserController::OnHidChooserContextShutdown() {
 void HidChooserController::OnGotDevices(
     std::vector<device::mojom::HidDeviceInfoPtr> devices) {
   std::vector<device::mojom::HidDeviceInfoPtr> devicesToDisplay;
-  devicesToDisplay.reserve(devices.size());
 
   for (auto& device : devices) {
     if (DisplayDevice(*device)) {
       if (AddDeviceInfo(*device))
-        devicesToDisplay.push_back(device->Clone());
+        devicesToDisplay.push_back(std::move(device));
     }
   }
 
@@ -6,6 +6,7 @@
 
 #include <memory>
 #include <string>
+#include <string_view>
 #include <unordered_set>
 #include <utility>
 
@@ -14,23 +15,61 @@
 #include "base/bits.h"
 #include "base/command_line.h"
 #include "base/feature_list.h"
+#include "base/metrics/field_trial_params.h"
 #include "base/no_destructor.h"
+#include "base/strings/strcat.h"
+#include "base/strings/string_number_conversions.h"
 #include "base/task/current_thread.h"
 #include "base/task/single_thread_task_runner.h"
 #include "base/task/thread_pool/initialization_util.h"
 #include "base/trace_event/trace_event.h"
 #include "gin/array_buffer.h"
+#include "gin/public/v8_platform.h"
 #include "gin/v8_initializer.h"
 #include "shell/browser/microtasks_runner.h"
 #include "shell/common/gin_helper/cleaned_up_at_exit.h"
 #include "shell/common/node_includes.h"
+#include "shell/common/process_util.h"
 #include "third_party/blink/public/common/switches.h"
+#include "third_party/electron_node/src/node_platform.h"
 #include "third_party/electron_node/src/node_wasm_web_api.h"
 
+namespace features {
+
+// Runs V8's worker tasks (concurrent GC, background compilation) on
+// base::ThreadPool, sharing its workers with the rest of Chromium instead of
+// keeping a separate set of threads for Node's platform.
+// |max_concurrency| caps how many workers a single V8 job may use at once;
+// 0 means the same default as Node's own worker pool.
+const base::Feature kV8WorkerTasksInThreadPool{
+    "V8WorkerTasksInThreadPool", base::FEATURE_DISABLED_BY_DEFAULT};
+const base::FeatureParam<int> kV8WorkerMaxConcurrency{
+    &kV8WorkerTasksInThreadPool, "max_concurrency", 0};
+
+}  // namespace features
+
 namespace {
+
 v8::Isolate* g_isolate;
+
+// Heap limits, in MB, that only apply to the main process. Unlike --js-flags
+// they are not propagated to renderer processes.
+constexpr std::string_view kMainMaxSemiSpaceSize{"main-max-semi-space-size"};
+constexpr std::string_view kMainMaxOldSpaceSize{"main-max-old-space-size"};
+
+void AppendHeapFlag(const base::CommandLine& cmd,
+                    std::string_view main_switch,
+                    std::string_view v8_flag,
+                    std::string* js_flags) {
+  int size;
+  if (base::StringToInt(cmd.GetSwitchValueASCII(main_switch), &size) &&
+      size > 0)
+    js_flags->append(base::StrCat({" ", v8_flag, "=",
+                                   base::NumberToString(size)}));
 }
 
+}  // namespace
+
 namespace gin {
 
 class ConvertableToTraceFormatWrapper final
@@ -138,18 +177,37 @@ v8::Isolate* JavascriptEnvironment::Initialize(uv_loop_t* event_loop,
   // --js-flags.
   std::string js_flags =
       cmd->GetSwitchValueASCII(blink::switches::kJavaScriptFlags);
+  if (electron::IsBrowserProcess()) {
+    AppendHeapFlag(*cmd, kMainMaxSemiSpaceSize, "--max-semi-space-size",
+                   &js_flags);
+    AppendHeapFlag(*cmd, kMainMaxOldSpaceSize, "--max-old-space-size",
+                   &js_flags);
+  }
   js_flags.append(" --no-freeze-flags-after-init");
   if (!js_flags.empty())
     v8::V8::SetFlagsFromString(js_flags.c_str(), js_flags.size());
 
-  // The V8Platform of gin relies on Chromium's task schedule, which has not
-  // been started at this point, so we have to rely on Node's V8Platform.
+  // Node needs its own MultiIsolatePlatform for the per-isolate foreground
+  // task runners, but its worker tasks can optionally be handed to gin's
+  // V8Platform, which posts them to base::ThreadPool. Tasks posted before the
+  // thread pool has started are queued until it does.
   auto* tracing_agent = node::CreateAgent();
   auto* tracing_controller = tracing_agent->GetTracingController();
   node::tracing::TraceEventHelper::SetAgent(tracing_agent);
+  int worker_threads =
+      base::RecommendedMaxNumberOfThreadsInThreadGroup(3, 8, 0.1, 0);
+  const bool delegate_worker_tasks =
+      base::FeatureList::IsEnabled(features::kV8WorkerTasksInThreadPool);
   platform_ = node::MultiIsolatePlatform::Create(
-      base::RecommendedMaxNumberOfThreadsInThreadGroup(3, 8, 0.1, 0),
-      tracing_controller, gin::V8Platform::GetCurrentPageAllocator());
+      delegate_worker_tasks ? 1 : worker_threads, tracing_controller,
+      gin::V8Platform::GetCurrentPageAllocator());
+  if (delegate_worker_tasks) {
+    if (int max_concurrency = features::kV8WorkerMaxConcurrency.Get();
+        max_concurrency > 0)
+      worker_threads = max_concurrency;
+    node::NodePlatform::SetWorkerTaskDelegate(gin::V8Platform::Get(),
+                                              worker_threads);
+  }
 
   v8::V8::InitializePlatform(platform_.get());
   gin::IsolateHolder::Initialize(gin::IsolateHolder::kNonStrictMode,
@@ -852,6 +852,22 @@ void NativeWindow::HandlePendingFullscreenTransitions() {
 // static
 int32_t NativeWindow::next_id_ = 0;
 
+// static
+int NativeWindow::batch_update_depth_ = 0;
+
+// static
+void NativeWindow::BeginBatchUpdate() {
+  if (batch_update_depth_++ == 0)
+    PlatformBeginBatchUpdate();
+}
+
+// static
+void NativeWindow::EndBatchUpdate() {
+  DCHECK_GT(batch_update_depth_, 0);
+  if (--batch_update_depth_ == 0)
+    PlatformEndBatchUpdate();
+}
+
 bool NativeWindow::IsTranslucent() const {
   // Transparent windows are translucent
   if (transparent()) {
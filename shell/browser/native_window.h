@@ -75,6 +75,12 @@ class NativeWindow : public base::SupportsUserData,
   static NativeWindow* Create(const gin_helper::Dictionary& options,
                               NativeWindow* parent = nullptr);
 
+  // Changes made to any window between the outermost BeginBatchUpdate() and
+  // its EndBatchUpdate() are committed together, where the platform can.
+  static void BeginBatchUpdate();
+  static void EndBatchUpdate();
+  static bool IsBatchingUpdates() { return batch_update_depth_ > 0; }
+
   void InitFromOptions(const gin_helper::Dictionary& options);
 
   virtual void SetContentView(views::View* view) = 0;
@@ -454,6 +460,12 @@ class NativeWindow : public base::SupportsUserData,
 
   static int32_t next_id_;
 
+  // Implemented by the platforms.
+  static void PlatformBeginBatchUpdate();
+  static void PlatformEndBatchUpdate();
+
+  static int batch_update_depth_;
+
   // The content view, weak ref.
   raw_ptr<views::View> content_view_ = nullptr;
 
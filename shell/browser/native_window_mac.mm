@@ -6,6 +6,7 @@
 
 #include <AvailabilityMacros.h>
 #include <objc/objc-runtime.h>
+#import <QuartzCore/QuartzCore.h>
 
 #include <algorithm>
 #include <memory>
@@ -710,6 +711,21 @@ bool NativeWindowMac::IsFullscreen() const {
   return HasStyleMask(NSWindowStyleMaskFullScreen);
 }
 
+// static
+void NativeWindow::PlatformBeginBatchUpdate() {
+  // Groups the changes into one transaction, committed without animation.
+  [NSAnimationContext beginGrouping];
+  [[NSAnimationContext currentContext] setDuration:0];
+  [CATransaction begin];
+  [CATransaction setDisableActions:YES];
+}
+
+// static
+void NativeWindow::PlatformEndBatchUpdate() {
+  [CATransaction commit];
+  [NSAnimationContext endGrouping];
+}
+
 void NativeWindowMac::SetBounds(const gfx::Rect& bounds, bool animate) {
   // Do nothing if in fullscreen mode.
   if (IsFullscreen())
@@ -727,7 +743,10 @@ void NativeWindowMac::SetBounds(const gfx::Rect& bounds, bool animate) {
   NSScreen* screen = [[NSScreen screens] firstObject];
   cocoa_bounds.origin.y = NSHeight([screen frame]) - size.height() - bounds.y();
 
-  [window_ setFrame:cocoa_bounds display:YES animate:animate];
+  // In a batch update the windows are displayed together, when it ends.
+  [window_ setFrame:cocoa_bounds
+            display:!IsBatchingUpdates()
+            animate:animate];
   user_set_bounds_maximized_ = IsMaximized() ? true : false;
   UpdateWindowOriginalFrame();
 }
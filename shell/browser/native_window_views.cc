@@ -22,6 +22,8 @@
 
 #include "base/containers/contains.h"
 #include "base/memory/raw_ptr.h"
+#include "base/no_destructor.h"
+#include "base/ranges/algorithm.h"
 #include "base/stl_util.h"
 #include "base/strings/utf_string_conversions.h"
 #include "content/public/browser/browser_thread.h"
@@ -163,6 +165,26 @@ gfx::Size WindowSizeToContentSizeBuggy(HWND hwnd, const gfx::Size& size) {
   return ScreenToDIPRect(hwnd, gfx::Rect(screen_client_size)).size();
 }
 
+// The bounds set during a batch update, committed when it ends.
+using PendingBounds =
+    std::vector<std::pair<base::WeakPtr<NativeWindow>, gfx::Rect>>;
+PendingBounds& GetPendingBatchBounds() {
+  static base::NoDestructor<PendingBounds> pending_bounds;
+  return *pending_bounds;
+}
+
+// Returns the bounds set for |window| during the current batch update, if
+// they weren't committed yet.
+std::optional<gfx::Rect> GetPendingBatchBoundsFor(const NativeWindow* window) {
+  const auto& pending_bounds = GetPendingBatchBounds();
+  auto it = base::ranges::find(pending_bounds, window, [](const auto& item) {
+    return item.first.get();
+  });
+  if (it == pending_bounds.end())
+    return std::nullopt;
+  return it->second;
+}
+
 #endif
 
 [[maybe_unused]] bool IsX11() {
@@ -195,6 +217,26 @@ class NativeWindowClientView : public views::ClientView {
 
 }  // namespace
 
+// static
+void NativeWindow::PlatformBeginBatchUpdate() {}
+
+// static
+void NativeWindow::PlatformEndBatchUpdate() {
+#if BUILDFLAG(IS_WIN)
+  PendingBounds pending_bounds = std::move(GetPendingBatchBounds());
+  GetPendingBatchBounds().clear();
+  std::erase_if(pending_bounds, [](const auto& item) { return !item.first; });
+  if (pending_bounds.empty())
+    return;
+
+  // Each window gets only the last bounds set during the batch. They go
+  // through the widget, so that it keeps track of them like of any other
+  // bounds change.
+  for (const auto& [window, bounds] : pending_bounds)
+    window->widget()->SetBounds(bounds);
+#endif
+}
+
 NativeWindowViews::NativeWindowViews(const gin_helper::Dictionary& options,
                                      NativeWindow* parent)
     : NativeWindow(options, parent) {
@@ -784,11 +826,31 @@ void NativeWindowViews::SetBounds(const gfx::Rect& bounds, bool animate) {
   }
 #endif
 
+#if BUILDFLAG(IS_WIN)
+  // Minimized and maximized windows are left to the widget, which keeps
+  // their restored bounds.
+  if (IsBatchingUpdates() && !animate && IsNormal() && !IsFullscreen()) {
+    auto& pending_bounds = GetPendingBatchBounds();
+    auto it = base::ranges::find(pending_bounds, this, [](const auto& item) {
+      return item.first.get();
+    });
+    if (it != pending_bounds.end())
+      it->second = bounds;
+    else
+      pending_bounds.emplace_back(GetWeakPtr(), bounds);
+    return;
+  }
+#endif
+
   widget()->SetBounds(bounds);
 }
 
 gfx::Rect NativeWindowViews::GetBounds() const {
 #if BUILDFLAG(IS_WIN)
+  // SetSize() and SetPosition() build on the bounds returned here, so bounds
+  // set earlier in a batch update must be visible before they are committed.
+  if (std::optional<gfx::Rect> pending = GetPendingBatchBoundsFor(this))
+    return *pending;
   if (IsMinimized())
     return widget()->GetRestoredBounds();
 #endif
@@ -797,12 +859,16 @@ gfx::Rect NativeWindowViews::GetBounds() const {
 }
 
 gfx::Rect NativeWindowViews::GetContentBounds() const {
+#if BUILDFLAG(IS_WIN)
+  if (std::optional<gfx::Rect> pending = GetPendingBatchBoundsFor(this))
+    return WindowBoundsToContentBounds(*pending);
+#endif
   return content_view() ? content_view()->GetBoundsInScreen() : gfx::Rect();
 }
 
 gfx::Size NativeWindowViews::GetContentSize() const {
 #if BUILDFLAG(IS_WIN)
-  if (IsMinimized())
+  if (GetPendingBatchBoundsFor(this) || IsMinimized())
     return NativeWindow::GetContentSize();
 #endif
 
@@ -5,23 +5,70 @@
 #include "shell/browser/net/asar/asar_file_validator.h"
 
 #include <algorithm>
+#include <cinttypes>
 #include <string>
 #include <utility>
 #include <vector>
 
+#include "base/containers/lru_cache.h"
 #include "base/logging.h"
+#include "base/no_destructor.h"
 #include "base/notreached.h"
 #include "base/strings/string_number_conversions.h"
 #include "base/strings/string_util.h"
+#include "base/strings/stringprintf.h"
+#include "base/synchronization/lock.h"
 #include "crypto/sha2.h"
 
 namespace asar {
 
+namespace {
+
+// Number of validated blocks remembered by the process.
+constexpr size_t kMaxValidatedBlocks = 4096;
+
+base::Lock& GetValidatedBlocksLock() {
+  static base::NoDestructor<base::Lock> lock;
+  return *lock;
+}
+
+base::HashingLRUCacheSet<std::string>& GetValidatedBlocks() {
+  static base::NoDestructor<base::HashingLRUCacheSet<std::string>> blocks(
+      kMaxValidatedBlocks);
+  return *blocks;
+}
+
+bool IsBlockValidated(const std::string& key) {
+  base::AutoLock auto_lock(GetValidatedBlocksLock());
+  auto& blocks = GetValidatedBlocks();
+  return blocks.Get(key) != blocks.end();
+}
+
+void MarkBlockValidated(const std::string& key) {
+  base::AutoLock auto_lock(GetValidatedBlocksLock());
+  GetValidatedBlocks().Put(key);
+}
+
+}  // namespace
+
 AsarFileValidator::AsarFileValidator(IntegrityPayload integrity,
-                                     base::File file)
+                                     base::File file,
+                                     const base::FilePath& path,
+                                     uint64_t file_offset)
     : file_(std::move(file)), integrity_(std::move(integrity)) {
   current_block_ = 0;
   max_block_ = integrity_.blocks.size() - 1;
+
+  // A file that is replaced or rewritten changes size or modification time,
+  // which invalidates the blocks validated before.
+  base::File::Info info;
+  if (file_.GetInfo(&info)) {
+    cache_key_prefix_ = base::StringPrintf(
+        "%s:%" PRId64 ":%" PRId64 ":%" PRIu64, path.AsUTF8Unsafe().c_str(),
+        info.size,
+        info.last_modified.ToDeltaSinceWindowsEpoch().InMicroseconds(),
+        file_offset);
+  }
 }
 
 AsarFileValidator::~AsarFileValidator() = default;
@@ -41,19 +88,8 @@ void AsarFileValidator::OnRead(base::span<char> buffer,
           << "Unexpected number of blocks while validating ASAR file stream";
     }
 
-    // Create a hash if we don't have one yet
-    if (!current_hash_) {
-      current_hash_byte_count_ = 0;
-      switch (integrity_.algorithm) {
-        case HashAlgorithm::kSHA256:
-          current_hash_ =
-              crypto::SecureHash::Create(crypto::SecureHash::SHA256);
-          break;
-        case HashAlgorithm::kNone:
-          CHECK(false);
-          break;
-      }
-    }
+    if (!block_started_)
+      StartBlock();
 
     // Compute how many bytes we should hash, and add them to the current hash.
     // We need to either add just enough bytes to fill up a block (block_size -
@@ -61,7 +97,8 @@ void AsarFileValidator::OnRead(base::span<char> buffer,
     int bytes_to_hash = std::min(block_size - current_hash_byte_count_,
                                  buffer_size - bytes_added);
     DCHECK_GT(bytes_to_hash, 0);
-    current_hash_->Update(buffer.data() + bytes_added, bytes_to_hash);
+    if (!block_validated_before_)
+      current_hash_->Update(buffer.data() + bytes_added, bytes_to_hash);
     bytes_added += bytes_to_hash;
     current_hash_byte_count_ += bytes_to_hash;
     total_hash_byte_count_ += bytes_to_hash;
@@ -73,6 +110,32 @@ void AsarFileValidator::OnRead(base::span<char> buffer,
   }
 }
 
+void AsarFileValidator::SetCompressedSource(std::shared_ptr<Archive> archive,
+                                            const Archive::FileInfo& info) {
+  compressed_archive_ = std::move(archive);
+  compressed_info_ = info;
+}
+
+void AsarFileValidator::StartBlock() {
+  DCHECK(!block_started_);
+  block_started_ = true;
+  current_hash_byte_count_ = 0;
+  block_validated_before_ =
+      !cache_key_prefix_.empty() &&
+      IsBlockValidated(GetBlockCacheKey(current_block_));
+  if (block_validated_before_)
+    return;
+
+  switch (integrity_.algorithm) {
+    case HashAlgorithm::kSHA256:
+      current_hash_ = crypto::SecureHash::Create(crypto::SecureHash::SHA256);
+      break;
+    case HashAlgorithm::kNone:
+      CHECK(false);
+      break;
+  }
+}
+
 bool AsarFileValidator::FinishBlock() {
   if (current_hash_byte_count_ == 0) {
     if (!done_reading_ || current_block_ > max_block_) {
@@ -80,13 +143,10 @@ bool AsarFileValidator::FinishBlock() {
     }
   }
 
-  if (!current_hash_) {
-    // This happens when we fail to read the resource. Compute empty content's
-    // hash in this case.
-    current_hash_ = crypto::SecureHash::Create(crypto::SecureHash::SHA256);
-  }
-
-  uint8_t actual[crypto::kSHA256Length];
+  // This happens when we fail to read the resource, in which case the empty
+  // content is validated.
+  if (!block_started_)
+    StartBlock();
 
   // If the file reader is done we need to make sure we've either read up to the
   // end of the file (the check below) or up to the end of a block_size byte
@@ -94,30 +154,46 @@ bool AsarFileValidator::FinishBlock() {
   // many bytes are needed to get there and then we manually read those bytes
   // from our own file handle ensuring the data producer is unaware but we can
   // validate the hash still.
-  if (done_reading_ &&
+  if (!block_validated_before_ && done_reading_ &&
       total_hash_byte_count_ - extra_read_ != read_max_ - read_start_) {
     uint64_t bytes_needed = std::min(
         integrity_.block_size - current_hash_byte_count_,
         read_max_ - read_start_ - total_hash_byte_count_ + extra_read_);
     uint64_t offset = read_start_ + total_hash_byte_count_ - extra_read_;
     std::vector<uint8_t> abandoned_buffer(bytes_needed);
-    if (!file_.ReadAndCheck(offset, abandoned_buffer)) {
+    const bool read_ok =
+        compressed_archive_
+            ? compressed_archive_->ReadDecompressed(
+                  *compressed_info_, offset - compressed_info_->offset,
+                  abandoned_buffer)
+            : file_.ReadAndCheck(offset, abandoned_buffer);
+    if (!read_ok) {
       LOG(FATAL) << "Failed to read required portion of streamed ASAR archive";
     }
 
     current_hash_->Update(&abandoned_buffer.front(), bytes_needed);
   }
 
-  current_hash_->Finish(actual, sizeof(actual));
-  current_hash_.reset();
+  const bool validated_before = block_validated_before_;
+  block_started_ = false;
+  block_validated_before_ = false;
   current_hash_byte_count_ = 0;
 
-  const std::string expected_hash = integrity_.blocks[current_block_];
-  const std::string actual_hex_hash =
-      base::ToLowerASCII(base::HexEncode(actual, sizeof(actual)));
+  if (!validated_before) {
+    uint8_t actual[crypto::kSHA256Length];
+    current_hash_->Finish(actual, sizeof(actual));
+    current_hash_.reset();
+
+    const std::string expected_hash = integrity_.blocks[current_block_];
+    const std::string actual_hex_hash =
+        base::ToLowerASCII(base::HexEncode(actual, sizeof(actual)));
+
+    if (expected_hash != actual_hex_hash) {
+      return false;
+    }
 
-  if (expected_hash != actual_hex_hash) {
-    return false;
+    if (!cache_key_prefix_.empty())
+      MarkBlockValidated(GetBlockCacheKey(current_block_));
   }
 
   current_block_++;
@@ -125,6 +201,11 @@ bool AsarFileValidator::FinishBlock() {
   return true;
 }
 
+std::string AsarFileValidator::GetBlockCacheKey(int block) const {
+  return base::StringPrintf("%s:%d:%s", cache_key_prefix_.c_str(), block,
+                            integrity_.blocks[block].c_str());
+}
+
 void AsarFileValidator::OnDone() {
   DCHECK(!done_reading_);
   done_reading_ = true;
@@ -8,7 +8,9 @@
 #include <algorithm>
 #include <memory>
 #include <optional>
+#include <string>
 
+#include "base/files/file_path.h"
 #include "crypto/secure_hash.h"
 #include "mojo/public/cpp/system/file_data_source.h"
 #include "mojo/public/cpp/system/filtered_data_source.h"
@@ -16,9 +18,19 @@
 
 namespace asar {
 
+// Validates the blocks of a file streamed out of an asar archive against its
+// integrity payload. Blocks that were validated before are remembered for the
+// lifetime of the process, keyed by the identity of the file on disk (path,
+// size and modification time), the position of the block and its expected
+// hash, so repeated reads of a hot file are not hashed again.
 class AsarFileValidator : public mojo::FilteredDataSource::Filter {
  public:
-  AsarFileValidator(IntegrityPayload integrity, base::File file);
+  // |path| is the file |file| was opened from and |file_offset| the offset of
+  // the validated file in it.
+  AsarFileValidator(IntegrityPayload integrity,
+                    base::File file,
+                    const base::FilePath& path,
+                    uint64_t file_offset);
   ~AsarFileValidator() override;
 
   // disable copy
@@ -33,12 +45,28 @@ class AsarFileValidator : public mojo::FilteredDataSource::Filter {
   void SetRange(uint64_t read_start, uint64_t extra_read, uint64_t read_max);
   void SetCurrentBlock(int current_block);
 
+  // Makes the bytes this filter reads on its own, to finish a block, come
+  // from the decompressed contents of the compressed file |info| instead of
+  // from |file|.
+  void SetCompressedSource(std::shared_ptr<Archive> archive,
+                           const Archive::FileInfo& info);
+
  protected:
   bool FinishBlock();
 
  private:
+  // Called when the first byte of |current_block_| is seen.
+  void StartBlock();
+  std::string GetBlockCacheKey(int block) const;
+
   base::File file_;
   IntegrityPayload integrity_;
+  std::shared_ptr<Archive> compressed_archive_;
+  std::optional<Archive::FileInfo> compressed_info_;
+
+  // Identifies the file on disk for the validated block cache, empty if the
+  // cache can't be used.
+  std::string cache_key_prefix_;
 
   // The offset in the file_ that the underlying file reader is starting at
   uint64_t read_start_ = 0;
@@ -56,6 +84,10 @@ class AsarFileValidator : public mojo::FilteredDataSource::Filter {
   uint64_t current_hash_byte_count_ = 0;
   uint64_t total_hash_byte_count_ = 0;
   std::unique_ptr<crypto::SecureHash> current_hash_;
+  // Whether StartBlock has been called for |current_block_|.
+  bool block_started_ = false;
+  // Whether |current_block_| was validated before and needs no hashing.
+  bool block_validated_before_ = false;
 };
 
 }  // namespace asar
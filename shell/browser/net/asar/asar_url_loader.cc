@@ -5,11 +5,14 @@
 #include "shell/browser/net/asar/asar_url_loader.h"
 
 #include <algorithm>
+#include <cinttypes>
 #include <memory>
 #include <string>
 #include <utility>
 #include <vector>
 
+#include "base/files/file_util.h"
+#include "base/numerics/safe_conversions.h"
 #include "base/strings/stringprintf.h"
 #include "base/task/thread_pool.h"
 #include "content/public/browser/file_url_loader.h"
@@ -49,6 +52,106 @@ net::Error ConvertMojoResultToNetError(MojoResult result) {
   }
 }
 
+// Serves a packed file out of the memory mapping of its archive. Offsets and
+// ranges are relative to the start of the archive, like those of the
+// |mojo::FileDataSource| it replaces, so callers can use either.
+class MappedDataSource : public mojo::DataPipeProducer::DataSource {
+ public:
+  MappedDataSource(std::shared_ptr<Archive> archive,
+                   base::span<const uint8_t> contents,
+                   uint64_t contents_offset)
+      : archive_(std::move(archive)),
+        contents_(contents),
+        contents_offset_(contents_offset),
+        end_(contents_offset + contents.size()) {}
+  ~MappedDataSource() override = default;
+
+  // disable copy
+  MappedDataSource(const MappedDataSource&) = delete;
+  MappedDataSource& operator=(const MappedDataSource&) = delete;
+
+  void SetRange(uint64_t start, uint64_t end) {
+    start_ = start;
+    end_ = std::max(start, end);
+  }
+
+  // mojo::DataPipeProducer::DataSource:
+  uint64_t GetLength() const override { return end_ - start_; }
+
+  ReadResult Read(uint64_t offset, base::span<char> buffer) override {
+    ReadResult result;
+    uint64_t position = start_ + offset;
+    uint64_t contents_end = contents_offset_ + contents_.size();
+    if (position < contents_offset_ || position >= std::min(end_, contents_end))
+      return result;
+
+    size_t read_size = std::min<uint64_t>(
+        buffer.size(), std::min(end_, contents_end) - position);
+    auto source = contents_.subspan(position - contents_offset_, read_size);
+    std::copy(source.begin(), source.end(), buffer.begin());
+    result.bytes_read = read_size;
+    return result;
+  }
+
+ private:
+  // Keeps the mapping alive while the response is streamed.
+  std::shared_ptr<Archive> archive_;
+  base::span<const uint8_t> contents_;
+  uint64_t contents_offset_;
+  uint64_t start_ = 0;
+  uint64_t end_;
+};
+
+// Serves the decompressed contents of a compressed file. Offsets and ranges
+// are relative to the start of the archive as if the file was stored
+// uncompressed at its offset, like those of |MappedDataSource|.
+class CompressedDataSource : public mojo::DataPipeProducer::DataSource {
+ public:
+  CompressedDataSource(std::shared_ptr<Archive> archive,
+                       const Archive::FileInfo& info)
+      : archive_(std::move(archive)),
+        info_(info),
+        end_(info.offset + info.size) {}
+  ~CompressedDataSource() override = default;
+
+  // disable copy
+  CompressedDataSource(const CompressedDataSource&) = delete;
+  CompressedDataSource& operator=(const CompressedDataSource&) = delete;
+
+  void SetRange(uint64_t start, uint64_t end) {
+    start_ = start;
+    end_ = std::max(start, end);
+  }
+
+  // mojo::DataPipeProducer::DataSource:
+  uint64_t GetLength() const override { return end_ - start_; }
+
+  ReadResult Read(uint64_t offset, base::span<char> buffer) override {
+    ReadResult result;
+    uint64_t position = start_ + offset;
+    uint64_t contents_end = info_.offset + info_.size;
+    if (position < info_.offset || position >= std::min(end_, contents_end))
+      return result;
+
+    size_t read_size = std::min<uint64_t>(
+        buffer.size(), std::min(end_, contents_end) - position);
+    if (!archive_->ReadDecompressed(
+            info_, position - info_.offset,
+            base::as_writable_bytes(buffer.first(read_size)))) {
+      result.result = MOJO_RESULT_DATA_LOSS;
+      return result;
+    }
+    result.bytes_read = read_size;
+    return result;
+  }
+
+ private:
+  std::shared_ptr<Archive> archive_;
+  const Archive::FileInfo info_;
+  uint64_t start_ = 0;
+  uint64_t end_;
+};
+
 constexpr size_t kDefaultFileUrlPipeSize = 65536;
 
 // Because this makes things simpler.
@@ -61,6 +164,7 @@ static_assert(kDefaultFileUrlPipeSize >= net::kMaxBytesToSniff,
 class AsarURLLoader : public network::mojom::URLLoader {
  public:
   static void CreateAndStart(
+      bool serve_plain_files,
       const network::ResourceRequest& request,
       mojo::PendingReceiver<network::mojom::URLLoader> loader,
       mojo::PendingRemote<network::mojom::URLLoaderClient> client,
@@ -68,7 +172,7 @@ class AsarURLLoader : public network::mojom::URLLoader {
     // Owns itself. Will live as long as its URLLoader and URLLoaderClientPtr
     // bindings are alive - essentially until either the client gives up or all
     // file data has been sent to it.
-    auto* asar_url_loader = new AsarURLLoader;
+    auto* asar_url_loader = new AsarURLLoader(serve_plain_files);
     asar_url_loader->Start(request, std::move(loader), std::move(client),
                            std::move(extra_response_headers));
   }
@@ -89,7 +193,8 @@ class AsarURLLoader : public network::mojom::URLLoader {
   AsarURLLoader& operator=(const AsarURLLoader&) = delete;
 
  private:
-  AsarURLLoader() = default;
+  explicit AsarURLLoader(bool serve_plain_files)
+      : serve_plain_files_(serve_plain_files) {}
   ~AsarURLLoader() override = default;
 
   void Start(const network::ResourceRequest& request,
@@ -113,7 +218,8 @@ class AsarURLLoader : public network::mojom::URLLoader {
 
     // Determine whether it is an asar file.
     base::FilePath asar_path, relative_path;
-    if (!GetAsarArchivePath(path, &asar_path, &relative_path)) {
+    const bool is_asar = GetAsarArchivePath(path, &asar_path, &relative_path);
+    if (!is_asar && !serve_plain_files_) {
       content::CreateFileURLLoaderBypassingSecurityChecks(
           request, std::move(loader), std::move(client), nullptr, false,
           extra_response_headers);
@@ -126,21 +232,40 @@ class AsarURLLoader : public network::mojom::URLLoader {
     receiver_.set_disconnect_handler(base::BindOnce(
         &AsarURLLoader::OnConnectionError, base::Unretained(this)));
 
-    // Parse asar archive.
-    std::shared_ptr<Archive> archive = GetOrCreateAsarArchive(asar_path);
+    std::shared_ptr<Archive> archive;
     Archive::FileInfo info;
-    if (!archive || !archive->GetFileInfo(relative_path, &info)) {
-      OnClientComplete(net::ERR_FILE_NOT_FOUND);
-      return;
-    }
-    bool is_verifying_file = info.integrity.has_value();
+    base::FilePath real_path = path;
+    if (is_asar) {
+      // Parse asar archive.
+      archive = GetOrCreateAsarArchive(asar_path);
+      if (!archive || !archive->GetFileInfo(relative_path, &info)) {
+        OnClientComplete(net::ERR_FILE_NOT_FOUND);
+        return;
+      }
 
-    // For unpacked path, read like normal file.
-    base::FilePath real_path;
-    if (info.unpacked) {
-      archive->CopyFileOut(relative_path, &real_path);
+      // For unpacked path, read like normal file.
+      if (info.unpacked) {
+        archive->CopyFileOut(relative_path, &real_path);
+        info.offset = 0;
+      } else {
+        real_path = archive->path();
+      }
+    } else {
+      // Serve a plain file as if it was an unpacked file of an archive.
+      base::File::Info file_info;
+      if (!base::GetFileInfo(path, &file_info) || file_info.is_directory) {
+        OnClientComplete(net::ERR_FILE_NOT_FOUND);
+        return;
+      }
+      if (!base::IsValueInRangeForNumericType<uint32_t>(file_info.size)) {
+        OnClientComplete(net::ERR_FILE_TOO_BIG);
+        return;
+      }
+      info.size = static_cast<uint32_t>(file_info.size);
       info.offset = 0;
+      info.unpacked = true;
     }
+    bool is_verifying_file = info.integrity.has_value();
 
     mojo::ScopedDataPipeProducerHandle producer_handle;
     mojo::ScopedDataPipeConsumerHandle consumer_handle;
@@ -153,18 +278,40 @@ class AsarURLLoader : public network::mojom::URLLoader {
     // Note that while the |Archive| already opens a |base::File|, we still need
     // to create a new |base::File| here, as it might be accessed by multiple
     // requests at the same time.
-    base::File file(info.unpacked ? real_path : archive->path(),
-                    base::File::FLAG_OPEN | base::File::FLAG_READ);
-    auto file_data_source =
-        std::make_unique<mojo::FileDataSource>(file.Duplicate());
+    base::File file(real_path, base::File::FLAG_OPEN | base::File::FLAG_READ);
+    std::unique_ptr<mojo::DataPipeProducer::DataSource> file_data_source;
+    mojo::FileDataSource* file_data_source_raw = nullptr;
+    MappedDataSource* mapped_data_source_raw = nullptr;
+    CompressedDataSource* compressed_data_source_raw = nullptr;
+    if (archive && info.compression) {
+      auto compressed_data_source =
+          std::make_unique<CompressedDataSource>(archive, info);
+      compressed_data_source_raw = compressed_data_source.get();
+      file_data_source = std::move(compressed_data_source);
+    } else if (std::optional<base::span<const uint8_t>> mapped =
+                   archive ? archive->GetMappedContents(info) : std::nullopt) {
+      // Serve packed files straight out of the archive mapping if there is
+      // one.
+      auto mapped_data_source =
+          std::make_unique<MappedDataSource>(archive, *mapped, info.offset);
+      mapped_data_source_raw = mapped_data_source.get();
+      file_data_source = std::move(mapped_data_source);
+    } else {
+      auto plain_data_source =
+          std::make_unique<mojo::FileDataSource>(file.Duplicate());
+      file_data_source_raw = plain_data_source.get();
+      file_data_source = std::move(plain_data_source);
+    }
     std::unique_ptr<mojo::DataPipeProducer::DataSource> readable_data_source;
-    mojo::FileDataSource* file_data_source_raw = file_data_source.get();
     AsarFileValidator* file_validator_raw = nullptr;
     uint32_t block_size = 0;
     if (info.integrity.has_value()) {
       block_size = info.integrity.value().block_size;
       auto asar_validator = std::make_unique<AsarFileValidator>(
-          std::move(info.integrity.value()), std::move(file));
+          std::move(info.integrity.value()), std::move(file), real_path,
+          info.offset);
+      if (info.compression)
+        asar_validator->SetCompressedSource(archive, info);
       file_validator_raw = asar_validator.get();
       readable_data_source = std::make_unique<mojo::FilteredDataSource>(
           std::move(file_data_source), std::move(asar_validator));
@@ -211,6 +358,16 @@ class AsarURLLoader : public network::mojom::URLLoader {
       first_byte_to_send = byte_range.first_byte_position();
       total_bytes_to_send =
           byte_range.last_byte_position() - first_byte_to_send + 1;
+      if (serve_plain_files_ && head->headers) {
+        head->headers->ReplaceStatusLine("HTTP/1.1 206 Partial Content");
+        head->headers->SetHeader(
+            "Content-Range",
+            base::StringPrintf("bytes %" PRIu64 "-%" PRIu64 "/%u",
+                               first_byte_to_send,
+                               static_cast<uint64_t>(
+                                   byte_range.last_byte_position()),
+                               info.size));
+      }
     }
 
     total_bytes_written_ = total_bytes_to_send;
@@ -323,9 +480,14 @@ class AsarURLLoader : public network::mojom::URLLoader {
     // (i.e., no range request) this Seek is effectively a no-op.
     //
     // Note that in Electron we also need to add file offset.
-    file_data_source_raw->SetRange(
-        first_byte_to_send + info.offset,
-        first_byte_to_send + info.offset + total_bytes_to_send);
+    uint64_t range_start = first_byte_to_send + info.offset;
+    uint64_t range_end = range_start + total_bytes_to_send;
+    if (compressed_data_source_raw)
+      compressed_data_source_raw->SetRange(range_start, range_end);
+    else if (mapped_data_source_raw)
+      mapped_data_source_raw->SetRange(range_start, range_end);
+    else
+      file_data_source_raw->SetRange(range_start, range_end);
     if (file_validator_raw)
       file_validator_raw->SetRange(info.offset + first_byte_to_send,
                                    total_bytes_dropped_from_head,
@@ -382,6 +544,10 @@ class AsarURLLoader : public network::mojom::URLLoader {
   // It is used to set some of the URLLoaderCompletionStatus data passed back
   // to the URLLoaderClients (eg SimpleURLLoader).
   size_t total_bytes_written_ = 0;
+
+  // Whether files outside of asar archives are served by this loader rather
+  // than by the file:// loader, see |CreateStaticFileURLLoader|.
+  const bool serve_plain_files_;
 };
 
 }  // namespace
@@ -396,8 +562,19 @@ void CreateAsarURLLoader(
        base::TaskShutdownBehavior::SKIP_ON_SHUTDOWN});
   task_runner->PostTask(
       FROM_HERE,
-      base::BindOnce(&AsarURLLoader::CreateAndStart, request, std::move(loader),
+      base::BindOnce(&AsarURLLoader::CreateAndStart,
+                     /*serve_plain_files=*/false, request, std::move(loader),
                      std::move(client), std::move(extra_response_headers)));
 }
 
+void CreateStaticFileURLLoader(
+    const network::ResourceRequest& request,
+    mojo::PendingReceiver<network::mojom::URLLoader> loader,
+    mojo::PendingRemote<network::mojom::URLLoaderClient> client,
+    scoped_refptr<net::HttpResponseHeaders> response_headers) {
+  AsarURLLoader::CreateAndStart(/*serve_plain_files=*/true, request,
+                                std::move(loader), std::move(client),
+                                std::move(response_headers));
+}
+
 }  // namespace asar
@@ -17,6 +17,15 @@ void CreateAsarURLLoader(
     mojo::PendingRemote<network::mojom::URLLoaderClient> client,
     scoped_refptr<net::HttpResponseHeaders> extra_response_headers);
 
+// Like |CreateAsarURLLoader|, but serves files outside of asar archives too and
+// answers Range requests with a "206 Partial Content" response. Unlike
+// |CreateAsarURLLoader| it must be called on a sequence that may block.
+void CreateStaticFileURLLoader(
+    const network::ResourceRequest& request,
+    mojo::PendingReceiver<network::mojom::URLLoader> loader,
+    mojo::PendingRemote<network::mojom::URLLoaderClient> client,
+    scoped_refptr<net::HttpResponseHeaders> response_headers);
+
 }  // namespace asar
 
 #endif  // ELECTRON_SHELL_BROWSER_NET_ASAR_ASAR_URL_LOADER_H_
@@ -4,19 +4,35 @@
 
 #include <utility>
 
+#include "crypto/sha2.h"
+#include "net/base/net_errors.h"
 #include "net/cert/cert_verify_result.h"
 #include "shell/browser/net/cert_verifier_client.h"
 
 namespace electron {
 
+namespace {
+
+constexpr size_t kMaxCachedResults = 1024;
+
+// Results the proc can call back with, besides net error codes.
+constexpr int kProcAccept = 0;
+constexpr int kProcUseDefault = -3;
+
+}  // namespace
+
 VerifyRequestParams::VerifyRequestParams() = default;
 
 VerifyRequestParams::~VerifyRequestParams() = default;
 
 VerifyRequestParams::VerifyRequestParams(const VerifyRequestParams&) = default;
 
-CertVerifierClient::CertVerifierClient(CertVerifyProc proc)
-    : cert_verify_proc_(proc) {}
+CertVerifierClient::CertVerifierClient(CertVerifyProc proc,
+                                       const Options& options)
+    : cert_verify_proc_(proc),
+      options_(options),
+      results_(kMaxCachedResults),
+      approved_chains_(kMaxCachedResults) {}
 
 CertVerifierClient::~CertVerifierClient() = default;
 
@@ -28,6 +44,28 @@ void CertVerifierClient::Verify(
     int flags,
     const std::optional<std::string>& ocsp_response,
     VerifyCallback callback) {
+  ChainKey chain_key{hostname, certificate->CalculateChainFingerprint256()};
+
+  if (options_.reuse_approved_chains && default_error == net::OK) {
+    if (auto it = approved_chains_.Get(chain_key);
+        it != approved_chains_.end()) {
+      std::move(callback).Run(it->second, default_result);
+      return;
+    }
+  }
+
+  ResultKey result_key{chain_key, flags, default_error,
+                       crypto::SHA256HashString(ocsp_response.value_or(""))};
+  if (options_.cache_ttl.is_positive()) {
+    if (auto it = results_.Get(result_key); it != results_.end()) {
+      if (it->second.expiry > base::TimeTicks::Now()) {
+        std::move(callback).Run(it->second.result, default_result);
+        return;
+      }
+      results_.Erase(it);
+    }
+  }
+
   VerifyRequestParams params;
   params.hostname = hostname;
   params.default_result = net::ErrorToString(default_error);
@@ -36,11 +74,32 @@ void CertVerifierClient::Verify(
   params.validated_certificate = default_result.verified_cert;
   params.is_issued_by_known_root = default_result.is_issued_by_known_root;
   cert_verify_proc_.Run(
-      params,
-      base::BindOnce(
-          [](VerifyCallback callback, const net::CertVerifyResult& result,
-             int err) { std::move(callback).Run(err, result); },
-          std::move(callback), default_result));
+      params, base::BindOnce(&CertVerifierClient::OnProcResult,
+                             weak_factory_.GetWeakPtr(), std::move(result_key),
+                             std::move(callback), default_result));
+}
+
+// static
+void CertVerifierClient::OnProcResult(
+    base::WeakPtr<CertVerifierClient> client,
+    ResultKey key,
+    VerifyCallback callback,
+    const net::CertVerifyResult& default_result,
+    int result) {
+  if (client) {
+    const Options& options = client->options_;
+    if (options.cache_ttl.is_positive()) {
+      client->results_.Put(
+          key, {result, base::TimeTicks::Now() + options.cache_ttl});
+    }
+    const int default_error = std::get<2>(key);
+    const bool approved =
+        result == kProcAccept ||
+        (result == kProcUseDefault && default_error == net::OK);
+    if (options.reuse_approved_chains && approved)
+      client->approved_chains_.Put(std::get<0>(key), result);
+  }
+  std::move(callback).Run(result, default_result);
 }
 
 }  // namespace electron
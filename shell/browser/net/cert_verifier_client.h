@@ -6,7 +6,13 @@
 #define ELECTRON_SHELL_BROWSER_NET_CERT_VERIFIER_CLIENT_H_
 
 #include <string>
+#include <tuple>
+#include <utility>
 
+#include "base/containers/lru_cache.h"
+#include "base/memory/weak_ptr.h"
+#include "base/time/time.h"
+#include "net/base/hash_value.h"
 #include "net/cert/x509_certificate.h"
 #include "services/network/public/mojom/network_context.mojom.h"
 
@@ -31,7 +37,18 @@ class CertVerifierClient : public network::mojom::CertVerifierClient {
       base::RepeatingCallback<void(const VerifyRequestParams& request,
                                    base::OnceCallback<void(int)>)>;
 
-  explicit CertVerifierClient(CertVerifyProc proc);
+  struct Options {
+    // How long results of the proc are reused for the same hostname,
+    // certificate chain, verify flags, default result and OCSP response.
+    // Zero disables it.
+    base::TimeDelta cache_ttl;
+    // Whether a chain the proc accepted for a hostname is accepted again
+    // without asking the proc, for as long as the default verifier accepts
+    // it as well.
+    bool reuse_approved_chains = false;
+  };
+
+  CertVerifierClient(CertVerifyProc proc, const Options& options);
   ~CertVerifierClient() override;
 
   // network::mojom::CertVerifierClient
@@ -44,7 +61,29 @@ class CertVerifierClient : public network::mojom::CertVerifierClient {
               VerifyCallback callback) override;
 
  private:
+  using ChainKey = std::pair<std::string, net::SHA256HashValue>;
+  // The chain key, the verify flags, the default result and the SHA-256 of
+  // the stapled OCSP response, which can change the proc's answer.
+  using ResultKey = std::tuple<ChainKey, int, int, std::string>;
+
+  struct CachedResult {
+    int result;
+    base::TimeTicks expiry;
+  };
+
+  static void OnProcResult(base::WeakPtr<CertVerifierClient> client,
+                           ResultKey key,
+                           VerifyCallback callback,
+                           const net::CertVerifyResult& default_result,
+                           int result);
+
   CertVerifyProc cert_verify_proc_;
+  const Options options_;
+
+  base::LRUCache<ResultKey, CachedResult> results_;
+  base::LRUCache<ChainKey, int> approved_chains_;
+
+  base::WeakPtrFactory<CertVerifierClient> weak_factory_{this};
 };
 
 }  // namespace electron
@@ -0,0 +1,249 @@
+// Copyright (c) 2024 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#include "shell/browser/net/directory_url_loader_factory.h"
+
+#include <cinttypes>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include "base/files/file_util.h"
+#include "base/strings/escape.h"
+#include "base/strings/string_split.h"
+#include "base/strings/string_util.h"
+#include "base/strings/stringprintf.h"
+#include "base/task/thread_pool.h"
+#include "base/time/time.h"
+#include "build/build_config.h"
+#include "mojo/public/cpp/bindings/remote.h"
+#include "mojo/public/cpp/system/data_pipe.h"
+#include "net/base/filename_util.h"
+#include "net/base/mime_util.h"
+#include "net/http/http_request_headers.h"
+#include "net/http/http_response_headers.h"
+#include "net/http/http_util.h"
+#include "services/network/public/cpp/url_loader_completion_status.h"
+#include "services/network/public/mojom/url_response_head.mojom.h"
+#include "shell/browser/net/asar/asar_url_loader.h"
+#include "shell/common/asar/archive.h"
+#include "shell/common/asar/asar_util.h"
+
+namespace electron {
+
+namespace {
+
+// Maps the path of |url| to a file inside |directory|, refusing paths that
+// would escape it. Paths ending with a slash are mapped to their index.html.
+bool GetFilePath(const base::FilePath& directory,
+                 const GURL& url,
+                 base::FilePath* path) {
+  std::string_view url_path = url.path_piece();
+  // URLs of schemes that are not standard keep their host in the path.
+  if (!url.has_host() && base::StartsWith(url_path, "//")) {
+    const size_t end = url_path.find('/', 2);
+    url_path = end == std::string_view::npos ? std::string_view()
+                                             : url_path.substr(end);
+  }
+
+  const std::string decoded =
+      base::UnescapeBinaryURLComponent(url_path, base::UnescapeRule::NORMAL);
+  if (decoded.find('\0') != std::string::npos)
+    return false;
+
+  base::FilePath result = directory;
+  for (std::string_view segment : base::SplitStringPiece(
+           decoded, "/", base::KEEP_WHITESPACE, base::SPLIT_WANT_NONEMPTY)) {
+    if (segment == ".")
+      continue;
+    if (segment == ".." || segment.find('\\') != std::string_view::npos)
+      return false;
+#if BUILDFLAG(IS_WIN)
+    if (segment.find(':') != std::string_view::npos)
+      return false;
+#endif
+    result = result.Append(base::FilePath::FromUTF8Unsafe(segment));
+  }
+  if (decoded.empty() || decoded.back() == '/')
+    result = result.Append(FILE_PATH_LITERAL("index.html"));
+
+  *path = std::move(result);
+  return true;
+}
+
+// Returns the size and modification time of a file, which may be inside an
+// asar archive, in which case the modification time is the archive's.
+bool GetFileStat(const base::FilePath& path,
+                 int64_t* size,
+                 base::Time* last_modified) {
+  base::FilePath asar_path, relative_path;
+  if (asar::GetAsarArchivePath(path, &asar_path, &relative_path)) {
+    std::shared_ptr<asar::Archive> archive =
+        asar::GetOrCreateAsarArchive(asar_path);
+    asar::Archive::FileInfo info;
+    base::File::Info archive_info;
+    if (!archive || !archive->GetFileInfo(relative_path, &info) ||
+        !base::GetFileInfo(asar_path, &archive_info))
+      return false;
+    *size = info.size;
+    *last_modified = archive_info.last_modified;
+    return true;
+  }
+
+  base::File::Info info;
+  if (!base::GetFileInfo(path, &info) || info.is_directory)
+    return false;
+  *size = info.size;
+  *last_modified = info.last_modified;
+  return true;
+}
+
+// Whether the validators of a request show that the client already has the
+// current version of the file.
+bool IsNotModified(const net::HttpRequestHeaders& headers,
+                   const std::string& etag,
+                   base::Time last_modified) {
+  std::string value;
+  if (headers.GetHeader(net::HttpRequestHeaders::kIfNoneMatch, &value)) {
+    for (std::string_view tag : base::SplitStringPiece(
+             value, ",", base::TRIM_WHITESPACE, base::SPLIT_WANT_NONEMPTY)) {
+      if (tag == "*" || tag == etag || tag == "W/" + etag)
+        return true;
+    }
+    // If-Modified-Since is ignored when If-None-Match is present.
+    return false;
+  }
+
+  base::Time since;
+  return headers.GetHeader(net::HttpRequestHeaders::kIfModifiedSince,
+                           &value) &&
+         base::Time::FromString(value.c_str(), &since) &&
+         last_modified.ToDeltaSinceWindowsEpoch().InSeconds() <=
+             since.ToDeltaSinceWindowsEpoch().InSeconds();
+}
+
+// Whether a Range request should be served, per its If-Range validator.
+bool IsRangeApplicable(const net::HttpRequestHeaders& headers,
+                       const std::string& etag,
+                       const std::string& last_modified) {
+  std::string value;
+  if (!headers.GetHeader(net::HttpRequestHeaders::kIfRange, &value))
+    return true;
+  return value == etag || value == last_modified;
+}
+
+void SendNotModified(
+    mojo::PendingRemote<network::mojom::URLLoaderClient> client,
+    scoped_refptr<net::HttpResponseHeaders> headers) {
+  mojo::Remote<network::mojom::URLLoaderClient> client_remote(
+      std::move(client));
+
+  mojo::ScopedDataPipeProducerHandle producer;
+  mojo::ScopedDataPipeConsumerHandle consumer;
+  if (mojo::CreateDataPipe(nullptr, producer, consumer) != MOJO_RESULT_OK) {
+    client_remote->OnComplete(
+        network::URLLoaderCompletionStatus(net::ERR_INSUFFICIENT_RESOURCES));
+    return;
+  }
+
+  headers->ReplaceStatusLine("HTTP/1.1 304 Not Modified");
+  auto head = network::mojom::URLResponseHead::New();
+  head->request_start = base::TimeTicks::Now();
+  head->response_start = base::TimeTicks::Now();
+  head->headers = std::move(headers);
+  head->headers->GetMimeTypeAndCharset(&head->mime_type, &head->charset);
+  client_remote->OnReceiveResponse(std::move(head), std::move(consumer),
+                                   std::nullopt);
+  client_remote->OnComplete(network::URLLoaderCompletionStatus(net::OK));
+}
+
+void StartLoading(const base::FilePath& directory,
+                  network::ResourceRequest request,
+                  mojo::PendingReceiver<network::mojom::URLLoader> loader,
+                  mojo::PendingRemote<network::mojom::URLLoaderClient> client) {
+  base::FilePath path;
+  int64_t size = 0;
+  base::Time last_modified;
+  if (!GetFilePath(directory, request.url, &path) ||
+      !GetFileStat(path, &size, &last_modified)) {
+    mojo::Remote<network::mojom::URLLoaderClient> client_remote(
+        std::move(client));
+    client_remote->OnComplete(
+        network::URLLoaderCompletionStatus(net::ERR_FILE_NOT_FOUND));
+    return;
+  }
+
+  const std::string etag = base::StringPrintf(
+      "\"%" PRIx64 "-%" PRIx64 "\"", static_cast<uint64_t>(size),
+      static_cast<uint64_t>(
+          last_modified.ToDeltaSinceWindowsEpoch().InMicroseconds()));
+  const std::string last_modified_string =
+      base::TimeFormatHTTP(last_modified);
+
+  auto headers =
+      base::MakeRefCounted<net::HttpResponseHeaders>("HTTP/1.1 200 OK");
+  // Add header to ignore CORS.
+  headers->SetHeader("Access-Control-Allow-Origin", "*");
+  headers->SetHeader("Accept-Ranges", "bytes");
+  // Let the client keep its copy, but check that it is fresh before use.
+  headers->SetHeader("Cache-Control", "no-cache");
+  headers->SetHeader("ETag", etag);
+  headers->SetHeader("Last-Modified", last_modified_string);
+
+  if (IsNotModified(request.headers, etag, last_modified)) {
+    std::string mime_type;
+    if (net::GetMimeTypeFromFile(path, &mime_type))
+      headers->SetHeader(net::HttpRequestHeaders::kContentType, mime_type);
+    SendNotModified(std::move(client), std::move(headers));
+    return;
+  }
+
+  if (!IsRangeApplicable(request.headers, etag, last_modified_string))
+    request.headers.RemoveHeader(net::HttpRequestHeaders::kRange);
+
+  request.url = net::FilePathToFileURL(path);
+  asar::CreateStaticFileURLLoader(request, std::move(loader), std::move(client),
+                                  std::move(headers));
+}
+
+}  // namespace
+
+// static
+mojo::PendingRemote<network::mojom::URLLoaderFactory>
+DirectoryURLLoaderFactory::Create(const base::FilePath& directory) {
+  mojo::PendingRemote<network::mojom::URLLoaderFactory> pending_remote;
+
+  // The DirectoryURLLoaderFactory will delete itself when there are no more
+  // receivers - see the SelfDeletingURLLoaderFactory::OnDisconnect method.
+  new DirectoryURLLoaderFactory(directory,
+                                pending_remote.InitWithNewPipeAndPassReceiver());
+
+  return pending_remote;
+}
+
+DirectoryURLLoaderFactory::DirectoryURLLoaderFactory(
+    const base::FilePath& directory,
+    mojo::PendingReceiver<network::mojom::URLLoaderFactory> factory_receiver)
+    : network::SelfDeletingURLLoaderFactory(std::move(factory_receiver)),
+      directory_(directory) {}
+DirectoryURLLoaderFactory::~DirectoryURLLoaderFactory() = default;
+
+void DirectoryURLLoaderFactory::CreateLoaderAndStart(
+    mojo::PendingReceiver<network::mojom::URLLoader> loader,
+    int32_t request_id,
+    uint32_t options,
+    const network::ResourceRequest& request,
+    mojo::PendingRemote<network::mojom::URLLoaderClient> client,
+    const net::MutableNetworkTrafficAnnotationTag& traffic_annotation) {
+  // The loader binds its pipes on the sequence it is started on.
+  auto task_runner = base::ThreadPool::CreateSequencedTaskRunner(
+      {base::MayBlock(), base::TaskPriority::USER_VISIBLE,
+       base::TaskShutdownBehavior::SKIP_ON_SHUTDOWN});
+  task_runner->PostTask(
+      FROM_HERE, base::BindOnce(&StartLoading, directory_, request,
+                                std::move(loader), std::move(client)));
+}
+
+}  // namespace electron
@@ -0,0 +1,49 @@
+// Copyright (c) 2024 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#ifndef ELECTRON_SHELL_BROWSER_NET_DIRECTORY_URL_LOADER_FACTORY_H_
+#define ELECTRON_SHELL_BROWSER_NET_DIRECTORY_URL_LOADER_FACTORY_H_
+
+#include "base/files/file_path.h"
+#include "mojo/public/cpp/bindings/pending_receiver.h"
+#include "mojo/public/cpp/bindings/pending_remote.h"
+#include "services/network/public/cpp/self_deleting_url_loader_factory.h"
+
+namespace electron {
+
+// Serves the files of a directory, which may be inside an asar archive, for a
+// scheme registered with |protocol.handleDirectory|. Requests are handled on
+// the thread pool without calling into JavaScript.
+class DirectoryURLLoaderFactory : public network::SelfDeletingURLLoaderFactory {
+ public:
+  static mojo::PendingRemote<network::mojom::URLLoaderFactory> Create(
+      const base::FilePath& directory);
+
+  // disable copy
+  DirectoryURLLoaderFactory(const DirectoryURLLoaderFactory&) = delete;
+  DirectoryURLLoaderFactory& operator=(const DirectoryURLLoaderFactory&) =
+      delete;
+
+ private:
+  DirectoryURLLoaderFactory(
+      const base::FilePath& directory,
+      mojo::PendingReceiver<network::mojom::URLLoaderFactory> factory_receiver);
+  ~DirectoryURLLoaderFactory() override;
+
+  // network::mojom::URLLoaderFactory:
+  void CreateLoaderAndStart(
+      mojo::PendingReceiver<network::mojom::URLLoader> loader,
+      int32_t request_id,
+      uint32_t options,
+      const network::ResourceRequest& request,
+      mojo::PendingRemote<network::mojom::URLLoaderClient> client,
+      const net::MutableNetworkTrafficAnnotationTag& traffic_annotation)
+      override;
+
+  const base::FilePath directory_;
+};
+
+}  // namespace electron
+
+#endif  // ELECTRON_SHELL_BROWSER_NET_DIRECTORY_URL_LOADER_FACTORY_H_
@@ -4,6 +4,7 @@
 
 #include "shell/browser/net/electron_url_loader_factory.h"
 
+#include <algorithm>
 #include <list>
 #include <memory>
 #include <string>
@@ -161,10 +162,18 @@ network::mojom::URLResponseHeadPtr ToResponseHead(
   return head;
 }
 
+// Bounds of the data pipe capacity of stream responses.
+constexpr int64_t kMinStreamPipeCapacity = 64 * 1024;
+constexpr int64_t kMaxStreamPipeCapacity = 4 * 1024 * 1024;
+
 // Helper to write string to pipe.
 struct WriteData {
   mojo::Remote<network::mojom::URLLoaderClient> client;
+  // Owns the memory |contents| points into, either |data| or the backing store
+  // of the ArrayBuffer returned by the handler.
   std::string data;
+  std::shared_ptr<v8::BackingStore> backing_store;
+  std::string_view contents;
   std::unique_ptr<mojo::DataPipeProducer> producer;
 };
 
@@ -172,13 +181,47 @@ void OnWrite(std::unique_ptr<WriteData> write_data, MojoResult result) {
   network::URLLoaderCompletionStatus status(net::ERR_FAILED);
   if (result == MOJO_RESULT_OK) {
     status = network::URLLoaderCompletionStatus(net::OK);
-    status.encoded_data_length = write_data->data.size();
-    status.encoded_body_length = write_data->data.size();
-    status.decoded_body_length = write_data->data.size();
+    status.encoded_data_length = write_data->contents.size();
+    status.encoded_body_length = write_data->contents.size();
+    status.decoded_body_length = write_data->contents.size();
   }
   write_data->client->OnComplete(status);
 }
 
+void WriteContents(mojo::PendingRemote<network::mojom::URLLoaderClient> client,
+                   network::mojom::URLResponseHeadPtr head,
+                   std::unique_ptr<WriteData> write_data) {
+  mojo::Remote<network::mojom::URLLoaderClient> client_remote(
+      std::move(client));
+
+  // Add header to ignore CORS.
+  head->headers->AddHeader("Access-Control-Allow-Origin", "*");
+
+  // Code below follows the pattern of data_url_loader_factory.cc.
+  mojo::ScopedDataPipeProducerHandle producer;
+  mojo::ScopedDataPipeConsumerHandle consumer;
+  if (mojo::CreateDataPipe(nullptr, producer, consumer) != MOJO_RESULT_OK) {
+    client_remote->OnComplete(
+        network::URLLoaderCompletionStatus(net::ERR_INSUFFICIENT_RESOURCES));
+    return;
+  }
+
+  client_remote->OnReceiveResponse(std::move(head), std::move(consumer),
+                                   std::nullopt);
+
+  write_data->client = std::move(client_remote);
+  write_data->producer =
+      std::make_unique<mojo::DataPipeProducer>(std::move(producer));
+  auto* producer_ptr = write_data->producer.get();
+
+  base::StringPiece string_piece(write_data->contents);
+  producer_ptr->Write(
+      std::make_unique<mojo::StringDataSource>(
+          string_piece, mojo::StringDataSource::AsyncWritingMode::
+                            STRING_STAYS_VALID_UNTIL_COMPLETION),
+      base::BindOnce(OnWrite, std::move(write_data)));
+}
+
 }  // namespace
 
 ElectronURLLoaderFactory::RedirectedRequest::RedirectedRequest(
@@ -497,9 +540,20 @@ void ElectronURLLoaderFactory::StartLoadingBuffer(
     mojo::PendingRemote<network::mojom::URLLoaderClient> client,
     network::mojom::URLResponseHeadPtr head,
     v8::Local<v8::ArrayBufferView> buffer) {
-  SendContents(std::move(client), std::move(head),
-               std::string(node::Buffer::Data(buffer.As<v8::Value>()),
-                           node::Buffer::Length(buffer.As<v8::Value>())));
+  // Stream straight from the memory of the buffer instead of copying it, the
+  // backing store is kept alive until the data pipe has consumed it. The data
+  // is read after the handler returns, so changes the app makes to the buffer
+  // before the response is finished may be sent; protocol.md documents that
+  // the buffer must not be modified until then.
+  auto write_data = std::make_unique<WriteData>();
+  if (buffer->ByteLength() > 0) {
+    write_data->backing_store = buffer->Buffer()->GetBackingStore();
+    write_data->contents = std::string_view(
+        static_cast<const char*>(write_data->backing_store->Data()) +
+            buffer->ByteOffset(),
+        buffer->ByteLength());
+  }
+  WriteContents(std::move(client), std::move(head), std::move(write_data));
 }
 
 // static
@@ -616,8 +670,16 @@ void ElectronURLLoaderFactory::StartLoadingStream(
     return;
   }
 
+  // Size the pipe after the response when its length is known, so that small
+  // responses don't reserve a large buffer and large ones can be pipelined.
+  uint32_t pipe_capacity = NodeStreamLoader::kDefaultPipeCapacity;
+  if (head->content_length > 0) {
+    pipe_capacity = static_cast<uint32_t>(std::clamp<int64_t>(
+        head->content_length, kMinStreamPipeCapacity, kMaxStreamPipeCapacity));
+  }
+
   new NodeStreamLoader(std::move(head), std::move(loader), std::move(client),
-                       data.isolate(), data.GetHandle());
+                       data.isolate(), data.GetHandle(), pipe_capacity);
 }
 
 // static
@@ -625,37 +687,10 @@ void ElectronURLLoaderFactory::SendContents(
     mojo::PendingRemote<network::mojom::URLLoaderClient> client,
     network::mojom::URLResponseHeadPtr head,
     std::string data) {
-  mojo::Remote<network::mojom::URLLoaderClient> client_remote(
-      std::move(client));
-
-  // Add header to ignore CORS.
-  head->headers->AddHeader("Access-Control-Allow-Origin", "*");
-
-  // Code below follows the pattern of data_url_loader_factory.cc.
-  mojo::ScopedDataPipeProducerHandle producer;
-  mojo::ScopedDataPipeConsumerHandle consumer;
-  if (mojo::CreateDataPipe(nullptr, producer, consumer) != MOJO_RESULT_OK) {
-    client_remote->OnComplete(
-        network::URLLoaderCompletionStatus(net::ERR_INSUFFICIENT_RESOURCES));
-    return;
-  }
-
-  client_remote->OnReceiveResponse(std::move(head), std::move(consumer),
-                                   std::nullopt);
-
   auto write_data = std::make_unique<WriteData>();
-  write_data->client = std::move(client_remote);
   write_data->data = std::move(data);
-  write_data->producer =
-      std::make_unique<mojo::DataPipeProducer>(std::move(producer));
-  auto* producer_ptr = write_data->producer.get();
-
-  base::StringPiece string_piece(write_data->data);
-  producer_ptr->Write(
-      std::make_unique<mojo::StringDataSource>(
-          string_piece, mojo::StringDataSource::AsyncWritingMode::
-                            STRING_STAYS_VALID_UNTIL_COMPLETION),
-      base::BindOnce(OnWrite, std::move(write_data)));
+  write_data->contents = write_data->data;
+  WriteContents(std::move(client), std::move(head), std::move(write_data));
 }
 
 }  // namespace electron
@@ -0,0 +1,213 @@
+// Copyright (c) 2024 Microsoft, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#include "shell/browser/net/net_log_recorder.h"
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "base/files/file_util.h"
+#include "base/functional/bind.h"
+#include "base/json/json_reader.h"
+#include "base/json/json_writer.h"
+#include "base/task/thread_pool.h"
+#include "base/time/time.h"
+#include "content/public/browser/storage_partition.h"
+#include "services/network/public/mojom/network_context.mojom.h"
+
+namespace electron {
+
+namespace {
+
+// The number of segments kept, including the one being written to.
+constexpr size_t kMaxSegments = 4;
+constexpr base::TimeDelta kSizeCheckInterval = base::Seconds(1);
+
+std::pair<base::FilePath, base::File> CreateSegmentFile() {
+  base::FilePath path;
+  if (!base::CreateTemporaryFile(&path))
+    return {};
+  return {path,
+          base::File(path, base::File::FLAG_CREATE_ALWAYS |
+                               base::File::FLAG_WRITE)};
+}
+
+int64_t GetSegmentSize(const base::FilePath& path) {
+  int64_t size = 0;
+  base::GetFileSize(path, &size);
+  return size;
+}
+
+// Segments that could not be stopped cleanly, e.g. because the network
+// service crashed, are not valid JSON and are skipped.
+bool MergeSegments(const std::vector<base::FilePath>& segments,
+                   const base::FilePath& output_path) {
+  base::Value::Dict merged;
+  base::Value::List events;
+  for (const base::FilePath& segment : segments) {
+    std::string contents;
+    bool read = base::ReadFileToString(segment, &contents);
+    base::DeleteFile(segment);
+    if (!read)
+      continue;
+    std::optional<base::Value::Dict> log =
+        base::JSONReader::ReadDict(contents);
+    if (!log)
+      continue;
+    if (base::Value::Dict* constants = log->FindDict("constants");
+        constants && !merged.contains("constants")) {
+      merged.Set("constants", std::move(*constants));
+    }
+    if (base::Value::List* segment_events = log->FindList("events")) {
+      for (base::Value& event : *segment_events)
+        events.Append(std::move(event));
+    }
+  }
+  merged.Set("events", std::move(events));
+
+  std::string json;
+  return base::JSONWriter::Write(merged, &json) &&
+         base::WriteFile(output_path, json);
+}
+
+}  // namespace
+
+NetLogRecorder::Segment::Segment() = default;
+NetLogRecorder::Segment::Segment(Segment&&) = default;
+NetLogRecorder::Segment& NetLogRecorder::Segment::operator=(Segment&&) =
+    default;
+NetLogRecorder::Segment::~Segment() = default;
+
+NetLogRecorder::NetLogRecorder(content::StoragePartition* storage_partition,
+                               net::NetLogCaptureMode capture_mode,
+                               uint64_t max_size,
+                               base::Value::Dict constants)
+    : storage_partition_(storage_partition),
+      capture_mode_(capture_mode),
+      segment_size_(std::max<uint64_t>(max_size / kMaxSegments, 1)),
+      constants_(std::move(constants)),
+      file_task_runner_(base::ThreadPool::CreateSequencedTaskRunner(
+          {base::MayBlock(), base::TaskPriority::USER_VISIBLE,
+           base::TaskShutdownBehavior::BLOCK_SHUTDOWN})) {
+  StartSegment();
+  size_timer_.Start(FROM_HERE, kSizeCheckInterval,
+                    base::BindRepeating(&NetLogRecorder::CheckSegmentSize,
+                                        base::Unretained(this)));
+}
+
+NetLogRecorder::~NetLogRecorder() {
+  for (const Segment& segment : segments_)
+    DeleteSegment(segment);
+  if (pending_dump_)
+    std::move(pending_dump_->second).Run(false);
+}
+
+void NetLogRecorder::Dump(const base::FilePath& path, DumpCallback callback) {
+  DCHECK(!pending_dump_);
+  pending_dump_.emplace(path, std::move(callback));
+  StartSegment();
+}
+
+void NetLogRecorder::StartSegment() {
+  if (starting_segment_)
+    return;
+  starting_segment_ = true;
+  file_task_runner_->PostTaskAndReplyWithResult(
+      FROM_HERE, base::BindOnce(&CreateSegmentFile),
+      base::BindOnce(&NetLogRecorder::OnSegmentFileCreated,
+                     weak_ptr_factory_.GetWeakPtr()));
+}
+
+void NetLogRecorder::OnSegmentFileCreated(
+    std::pair<base::FilePath, base::File> file) {
+  starting_segment_ = false;
+
+  // The previous segment is stopped only after the new one has started, so
+  // no events are missed in between.
+  mojo::Remote<network::mojom::NetLogExporter> previous_exporter;
+  if (!segments_.empty())
+    previous_exporter = std::move(segments_.back().exporter);
+
+  if (file.second.IsValid()) {
+    Segment segment;
+    segment.path = file.first;
+    storage_partition_->GetNetworkContext()->CreateNetLogExporter(
+        segment.exporter.BindNewPipeAndPassReceiver());
+    // The cap leaves room for the events logged until the next size check.
+    segment.exporter->Start(std::move(file.second), constants_.Clone(),
+                            capture_mode_, segment_size_ * 2,
+                            base::DoNothing());
+    segments_.push_back(std::move(segment));
+  } else if (previous_exporter) {
+    // Keep writing to the previous segment rather than losing every event.
+    segments_.back().exporter = std::move(previous_exporter);
+  }
+
+  base::OnceClosure after_stop = base::DoNothing();
+  if (pending_dump_) {
+    std::vector<base::FilePath> paths;
+    while (!segments_.empty() && !segments_.front().exporter) {
+      paths.push_back(segments_.front().path);
+      segments_.pop_front();
+    }
+    auto [path, callback] = std::move(*pending_dump_);
+    pending_dump_.reset();
+    after_stop = base::BindOnce(
+        [](scoped_refptr<base::SequencedTaskRunner> file_task_runner,
+           std::vector<base::FilePath> paths, base::FilePath path,
+           DumpCallback callback) {
+          file_task_runner->PostTaskAndReplyWithResult(
+              FROM_HERE,
+              base::BindOnce(&MergeSegments, std::move(paths), path),
+              std::move(callback));
+        },
+        file_task_runner_, std::move(paths), path, std::move(callback));
+  } else {
+    while (segments_.size() > kMaxSegments) {
+      DeleteSegment(segments_.front());
+      segments_.pop_front();
+    }
+  }
+
+  if (previous_exporter) {
+    // The remote is moved into the callback so that it lives until the
+    // segment is complete.
+    previous_exporter->Stop(
+        base::Value::Dict(),
+        base::BindOnce(
+            [](mojo::Remote<network::mojom::NetLogExporter>,
+               base::OnceClosure after_stop,
+               int32_t error) { std::move(after_stop).Run(); },
+            std::move(previous_exporter), std::move(after_stop)));
+  } else {
+    std::move(after_stop).Run();
+  }
+}
+
+void NetLogRecorder::CheckSegmentSize() {
+  if (starting_segment_)
+    return;
+  if (segments_.empty() || !segments_.back().exporter.is_connected()) {
+    // Recording stopped, e.g. because the network service restarted.
+    StartSegment();
+    return;
+  }
+  file_task_runner_->PostTaskAndReplyWithResult(
+      FROM_HERE, base::BindOnce(&GetSegmentSize, segments_.back().path),
+      base::BindOnce(&NetLogRecorder::OnSegmentSize,
+                     weak_ptr_factory_.GetWeakPtr()));
+}
+
+void NetLogRecorder::OnSegmentSize(int64_t size) {
+  if (size >= static_cast<int64_t>(segment_size_))
+    StartSegment();
+}
+
+void NetLogRecorder::DeleteSegment(const Segment& segment) {
+  file_task_runner_->PostTask(FROM_HERE,
+                              base::GetDeleteFileCallback(segment.path));
+}
+
+}  // namespace electron
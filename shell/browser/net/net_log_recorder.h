@@ -0,0 +1,95 @@
+// Copyright (c) 2024 Microsoft, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#ifndef ELECTRON_SHELL_BROWSER_NET_NET_LOG_RECORDER_H_
+#define ELECTRON_SHELL_BROWSER_NET_NET_LOG_RECORDER_H_
+
+#include <cstdint>
+#include <deque>
+#include <optional>
+#include <utility>
+
+#include "base/files/file.h"
+#include "base/files/file_path.h"
+#include "base/functional/callback.h"
+#include "base/memory/raw_ptr.h"
+#include "base/memory/weak_ptr.h"
+#include "base/task/sequenced_task_runner.h"
+#include "base/timer/timer.h"
+#include "base/values.h"
+#include "mojo/public/cpp/bindings/remote.h"
+#include "net/log/net_log_capture_mode.h"
+#include "services/network/public/mojom/net_log.mojom.h"
+
+namespace content {
+class StoragePartition;
+}
+
+namespace electron {
+
+// Keeps the most recent network events of a storage partition so they can be
+// written out when something goes wrong.
+//
+// The network service only exports events as JSON files, so the events are
+// recorded into a rotating set of size-capped temporary files ("segments").
+// Once the newest segment reaches its share of |max_size| a new one is
+// started and the oldest is deleted. Dump() starts a fresh segment, then
+// merges all of the previous ones into a single net log.
+class NetLogRecorder {
+ public:
+  using DumpCallback = base::OnceCallback<void(bool success)>;
+
+  NetLogRecorder(content::StoragePartition* storage_partition,
+                 net::NetLogCaptureMode capture_mode,
+                 uint64_t max_size,
+                 base::Value::Dict constants);
+  ~NetLogRecorder();
+
+  // disable copy
+  NetLogRecorder(const NetLogRecorder&) = delete;
+  NetLogRecorder& operator=(const NetLogRecorder&) = delete;
+
+  // Writes the recorded events to |path|. The events are not kept afterwards.
+  // Must not be called while another dump is in progress.
+  void Dump(const base::FilePath& path, DumpCallback callback);
+  bool is_dumping() const { return pending_dump_.has_value(); }
+
+ private:
+  struct Segment {
+    Segment();
+    Segment(Segment&&);
+    Segment& operator=(Segment&&);
+    ~Segment();
+
+    base::FilePath path;
+    // Unbound once the segment is no longer written to.
+    mojo::Remote<network::mojom::NetLogExporter> exporter;
+  };
+
+  void StartSegment();
+  void OnSegmentFileCreated(std::pair<base::FilePath, base::File> file);
+  void CheckSegmentSize();
+  void OnSegmentSize(int64_t size);
+  void DeleteSegment(const Segment& segment);
+
+  raw_ptr<content::StoragePartition> storage_partition_;
+  const net::NetLogCaptureMode capture_mode_;
+  const uint64_t segment_size_;
+  const base::Value::Dict constants_;
+
+  scoped_refptr<base::SequencedTaskRunner> file_task_runner_;
+
+  // Oldest first, the last one is being written to.
+  std::deque<Segment> segments_;
+  bool starting_segment_ = false;
+  std::optional<std::pair<base::FilePath, DumpCallback>> pending_dump_;
+
+  base::RepeatingTimer size_timer_;
+
+  base::WeakPtrFactory<NetLogRecorder> weak_ptr_factory_{this};
+};
+
+}  // namespace electron
+
+#endif  // ELECTRON_SHELL_BROWSER_NET_NET_LOG_RECORDER_H_
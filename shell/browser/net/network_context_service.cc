@@ -74,15 +74,15 @@ void NetworkContextService::ConfigureNetworkContextParams(
   network_context_params->http_cache_enabled =
       browser_context_->can_use_http_cache();
 
+  // Configure the HTTP cache size, which also bounds in-memory caches.
+  network_context_params->http_cache_max_size =
+      browser_context_->max_cache_size();
+
   network_context_params->cookie_manager_params =
       network::mojom::CookieManagerParams::New();
 
   // Configure on-disk storage for persistent sessions.
   if (!in_memory) {
-    // Configure the HTTP cache path and size.
-    network_context_params->http_cache_max_size =
-        browser_context_->max_cache_size();
-
     network_context_params->file_paths =
         network::mojom::NetworkContextFilePaths::New();
     network_context_params->file_paths->data_directory =
@@ -90,8 +90,12 @@ void NetworkContextService::ConfigureNetworkContextParams(
     network_context_params->file_paths->unsandboxed_data_path = path;
     network_context_params->file_paths->trigger_migration =
         ShouldTriggerNetworkDataMigration();
-    network_context_params->file_paths->http_cache_directory =
-        path.Append(chrome::kCacheDirname);
+    // Without a cache directory the network service keeps the HTTP cache in
+    // memory, while the rest of the session data is still persisted.
+    if (!browser_context_->http_cache_in_memory()) {
+      network_context_params->file_paths->http_cache_directory =
+          path.Append(chrome::kCacheDirname);
+    }
 
     // Currently this just contains HttpServerProperties
     network_context_params->file_paths->http_server_properties_file_name =
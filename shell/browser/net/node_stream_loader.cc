@@ -4,10 +4,12 @@
 
 #include "shell/browser/net/node_stream_loader.h"
 
+#include <algorithm>
 #include <string_view>
 #include <utility>
 
-#include "mojo/public/cpp/system/string_data_source.h"
+#include "base/task/sequenced_task_runner.h"
+#include "base/trace_event/trace_event.h"
 #include "shell/common/gin_converters/callback_converter.h"
 #include "shell/common/node_includes.h"
 
@@ -18,11 +20,16 @@ NodeStreamLoader::NodeStreamLoader(
     mojo::PendingReceiver<network::mojom::URLLoader> loader,
     mojo::PendingRemote<network::mojom::URLLoaderClient> client,
     v8::Isolate* isolate,
-    v8::Local<v8::Object> emitter)
+    v8::Local<v8::Object> emitter,
+    uint32_t pipe_capacity)
     : url_loader_(this, std::move(loader)),
       client_(std::move(client)),
       isolate_(isolate),
-      emitter_(isolate, emitter) {
+      emitter_(isolate, emitter),
+      producer_watcher_(FROM_HERE,
+                        mojo::SimpleWatcher::ArmingPolicy::MANUAL,
+                        base::SequencedTaskRunner::GetCurrentDefault()),
+      pipe_capacity_(pipe_capacity) {
   url_loader_.set_disconnect_handler(
       base::BindOnce(&NodeStreamLoader::NotifyComplete,
                      weak_factory_.GetWeakPtr(), net::ERR_FAILED));
@@ -50,15 +57,22 @@ NodeStreamLoader::~NodeStreamLoader() {
 }
 
 void NodeStreamLoader::Start(network::mojom::URLResponseHeadPtr head) {
-  mojo::ScopedDataPipeProducerHandle producer;
+  start_time_ = base::TimeTicks::Now();
+
   mojo::ScopedDataPipeConsumerHandle consumer;
-  MojoResult rv = mojo::CreateDataPipe(nullptr, producer, consumer);
+  const MojoCreateDataPipeOptions options{
+      sizeof(MojoCreateDataPipeOptions), MOJO_CREATE_DATA_PIPE_FLAG_NONE, 1,
+      pipe_capacity_};
+  MojoResult rv = mojo::CreateDataPipe(&options, producer_, consumer);
   if (rv != MOJO_RESULT_OK) {
     NotifyComplete(net::ERR_INSUFFICIENT_RESOURCES);
     return;
   }
 
-  producer_ = std::make_unique<mojo::DataPipeProducer>(std::move(producer));
+  producer_watcher_.Watch(
+      producer_.get(), MOJO_HANDLE_SIGNAL_WRITABLE,
+      base::BindRepeating(&NodeStreamLoader::OnPipeWritable,
+                          weak_factory_.GetWeakPtr()));
   client_->OnReceiveResponse(std::move(head), std::move(consumer),
                              std::nullopt);
 
@@ -71,21 +85,31 @@ void NodeStreamLoader::Start(network::mojom::URLResponseHeadPtr head) {
 }
 
 void NodeStreamLoader::NotifyReadable() {
-  if (!readable_)
-    ReadMore();
-  else if (is_reading_)
+  if (is_pumping_) {
+    // Calling read() can trigger the "readable" event again, making this
+    // function re-entrant, read again once the current read() returned.
     has_read_waiting_ = true;
+    readable_ = true;
+    return;
+  }
   readable_ = true;
+  Pump();
 }
 
 void NodeStreamLoader::NotifyComplete(int result) {
-  // Wait until write finishes or fails.
-  if (is_reading_ || is_writing_) {
+  // Wait until the pending data is written or fails.
+  if (is_pumping_ || !chunks_.empty()) {
     ended_ = true;
     result_ = result;
     return;
   }
 
+  const base::TimeDelta duration = base::TimeTicks::Now() - start_time_;
+  TRACE_EVENT_INSTANT("electron", "NodeStreamLoader::Complete", "bytes",
+                      bytes_written_, "duration_us", duration.InMicroseconds(),
+                      "reads", read_count_, "writes", write_count_,
+                      "pipe_waits", pipe_wait_count_);
+
   network::URLLoaderCompletionStatus status(result);
   status.completion_time = base::TimeTicks::Now();
   status.decoded_body_length = bytes_written_;
@@ -93,70 +117,123 @@ void NodeStreamLoader::NotifyComplete(int result) {
   delete this;
 }
 
-void NodeStreamLoader::ReadMore() {
-  if (is_reading_) {
-    // Calling read() can trigger the "readable" event again, making this
-    // function re-entrant. If we're already reading, we don't want to start
-    // a nested read, so short-circuit.
+void NodeStreamLoader::Pump() {
+  if (is_pumping_)
     return;
+  is_pumping_ = true;
+
+  while (true) {
+    // Read ahead while the consumer drains the pipe.
+    if (readable_ && buffered_bytes_ < pipe_capacity_)
+      ReadChunks();
+    if (waiting_for_pipe_)
+      break;
+
+    MojoResult result = WriteChunks();
+    if (result == MOJO_RESULT_SHOULD_WAIT) {
+      waiting_for_pipe_ = true;
+      ++pipe_wait_count_;
+      producer_watcher_.ArmOrNotify();
+      continue;
+    }
+    if (result != MOJO_RESULT_OK) {
+      is_pumping_ = false;
+      chunks_.clear();
+      buffered_bytes_ = 0;
+      NotifyComplete(net::ERR_FAILED);
+      return;
+    }
+    if (!readable_)
+      break;
   }
-  is_reading_ = true;
+
+  is_pumping_ = false;
+  if (ended_ && chunks_.empty())
+    NotifyComplete(result_);
+}
+
+void NodeStreamLoader::ReadChunks() {
   auto weak = weak_factory_.GetWeakPtr();
   v8::HandleScope scope(isolate_);
-  // buffer = emitter.read()
-  v8::MaybeLocal<v8::Value> ret = node::MakeCallback(
-      isolate_, emitter_.Get(isolate_), "read", 0, nullptr, {0, 0});
-  DCHECK(weak) << "We shouldn't have been destroyed when calling read()";
-
-  // If there is no buffer read, wait until |readable| is emitted again.
-  v8::Local<v8::Value> buffer;
-  if (!ret.ToLocal(&buffer) || !node::Buffer::HasInstance(buffer)) {
-    is_reading_ = false;
-
-    // If 'readable' was called after 'read()', try again
-    if (has_read_waiting_) {
-      has_read_waiting_ = false;
-      ReadMore();
+  while (buffered_bytes_ < pipe_capacity_) {
+    // buffer = emitter.read()
+    v8::MaybeLocal<v8::Value> ret = node::MakeCallback(
+        isolate_, emitter_.Get(isolate_), "read", 0, nullptr, {0, 0});
+    DCHECK(weak) << "We shouldn't have been destroyed when calling read()";
+
+    // If there is no buffer read, wait until |readable| is emitted again.
+    v8::Local<v8::Value> buffer;
+    if (!ret.ToLocal(&buffer) || !node::Buffer::HasInstance(buffer)) {
+      // If 'readable' was called after 'read()', try again
+      if (has_read_waiting_) {
+        has_read_waiting_ = false;
+        continue;
+      }
+      readable_ = false;
       return;
     }
 
-    readable_ = false;
-    if (ended_) {
-      NotifyComplete(result_);
-    }
-    return;
+    // Hold the buffer until it has been written.
+    ++read_count_;
+    PendingChunk chunk(isolate_, buffer);
+    buffered_bytes_ += chunk.data.size();
+    if (!chunk.data.empty())
+      chunks_.push_back(std::move(chunk));
   }
+}
 
-  // Hold the buffer until the write is done.
-  buffer_.Reset(isolate_, buffer);
-
-  bytes_written_ += node::Buffer::Length(buffer);
+MojoResult NodeStreamLoader::WriteChunks() {
+  while (!chunks_.empty()) {
+    void* buffer = nullptr;
+    uint32_t available = 0;
+    MojoResult result =
+        producer_->BeginWriteData(&buffer, &available, MOJO_WRITE_DATA_FLAG_NONE);
+    if (result != MOJO_RESULT_OK)
+      return result;
+
+    // Coalesce as many chunks as fit into a single write.
+    auto* out = static_cast<char*>(buffer);
+    uint32_t written = 0;
+    while (written < available && !chunks_.empty()) {
+      PendingChunk& chunk = chunks_.front();
+      const size_t size =
+          std::min<size_t>(available - written, chunk.data.size());
+      std::copy_n(chunk.data.data(), size, out + written);
+      written += size;
+      chunk.data.remove_prefix(size);
+      if (chunk.data.empty())
+        chunks_.pop_front();
+    }
 
-  // Write buffer to mojo pipe asynchronously.
-  is_reading_ = false;
-  is_writing_ = true;
-  producer_->Write(std::make_unique<mojo::StringDataSource>(
-                       std::string_view{node::Buffer::Data(buffer),
-                                        node::Buffer::Length(buffer)},
-                       mojo::StringDataSource::AsyncWritingMode::
-                           STRING_STAYS_VALID_UNTIL_COMPLETION),
-                   base::BindOnce(&NodeStreamLoader::DidWrite, weak));
+    producer_->EndWriteData(written);
+    buffered_bytes_ -= written;
+    bytes_written_ += written;
+    ++write_count_;
+  }
+  return MOJO_RESULT_OK;
 }
 
-void NodeStreamLoader::DidWrite(MojoResult result) {
-  is_writing_ = false;
-  // We were told to end streaming.
-  if (ended_) {
-    NotifyComplete(result_);
+void NodeStreamLoader::OnPipeWritable(MojoResult result) {
+  waiting_for_pipe_ = false;
+  if (result != MOJO_RESULT_OK) {
+    // The consumer went away.
+    chunks_.clear();
+    buffered_bytes_ = 0;
+    NotifyComplete(net::ERR_FAILED);
     return;
   }
-
-  if (result == MOJO_RESULT_OK && readable_)
-    ReadMore();
-  else
-    NotifyComplete(net::ERR_FAILED);
+  Pump();
 }
 
+NodeStreamLoader::PendingChunk::PendingChunk(v8::Isolate* isolate,
+                                             v8::Local<v8::Value> buffer)
+    : buffer(isolate, buffer),
+      data(node::Buffer::Data(buffer), node::Buffer::Length(buffer)) {}
+NodeStreamLoader::PendingChunk::PendingChunk(PendingChunk&&) = default;
+NodeStreamLoader::PendingChunk& NodeStreamLoader::PendingChunk::operator=(
+    PendingChunk&&) = default;
+NodeStreamLoader::PendingChunk::~PendingChunk() = default;
+
 void NodeStreamLoader::On(const char* event, EventCallback callback) {
   v8::Isolate::Scope isolate_scope(isolate_);
   v8::HandleScope handle_scope(isolate_);
@@ -8,13 +8,17 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <string_view>
 #include <vector>
 
+#include "base/containers/circular_deque.h"
 #include "base/memory/raw_ptr.h"
+#include "base/time/time.h"
 #include "mojo/public/cpp/bindings/pending_remote.h"
 #include "mojo/public/cpp/bindings/receiver.h"
 #include "mojo/public/cpp/bindings/remote.h"
-#include "mojo/public/cpp/system/data_pipe_producer.h"
+#include "mojo/public/cpp/system/data_pipe.h"
+#include "mojo/public/cpp/system/simple_watcher.h"
 #include "services/network/public/mojom/url_loader.mojom.h"
 #include "services/network/public/mojom/url_response_head.mojom.h"
 #include "v8/include/v8.h"
@@ -29,13 +33,20 @@ namespace electron {
 // We use |paused mode| to read data from |Readable| stream, so we don't need to
 // copy data from buffer and hold it in memory, and we only need to make sure
 // the passed |Buffer| is alive while writing data to pipe.
+//
+// Reads run ahead of the pipe by up to |pipe_capacity| bytes, so the stream is
+// read while the consumer drains the pipe, and small chunks are coalesced into
+// a single write.
 class NodeStreamLoader : public network::mojom::URLLoader {
  public:
+  static constexpr uint32_t kDefaultPipeCapacity = 512 * 1024;
+
   NodeStreamLoader(network::mojom::URLResponseHeadPtr head,
                    mojo::PendingReceiver<network::mojom::URLLoader> loader,
                    mojo::PendingRemote<network::mojom::URLLoaderClient> client,
                    v8::Isolate* isolate,
-                   v8::Local<v8::Object> emitter);
+                   v8::Local<v8::Object> emitter,
+                   uint32_t pipe_capacity = kDefaultPipeCapacity);
 
   // disable copy
   NodeStreamLoader(const NodeStreamLoader&) = delete;
@@ -46,11 +57,26 @@ class NodeStreamLoader : public network::mojom::URLLoader {
 
   using EventCallback = base::RepeatingCallback<void()>;
 
+  // A buffer read from the stream that has not been fully written yet.
+  struct PendingChunk {
+    PendingChunk(v8::Isolate* isolate, v8::Local<v8::Value> buffer);
+    PendingChunk(PendingChunk&&);
+    PendingChunk& operator=(PendingChunk&&);
+    ~PendingChunk();
+
+    v8::Global<v8::Value> buffer;
+    // The part of |buffer| that is still to be written.
+    std::string_view data;
+  };
+
   void Start(network::mojom::URLResponseHeadPtr head);
   void NotifyReadable();
   void NotifyComplete(int result);
-  void ReadMore();
-  void DidWrite(MojoResult result);
+  // Reads from the stream and writes to the pipe until either would block.
+  void Pump();
+  void ReadChunks();
+  MojoResult WriteChunks();
+  void OnPipeWritable(MojoResult result);
 
   // Subscribe to events of |emitter|.
   void On(const char* event, EventCallback callback);
@@ -71,21 +97,31 @@ class NodeStreamLoader : public network::mojom::URLLoader {
 
   raw_ptr<v8::Isolate> isolate_;
   v8::Global<v8::Object> emitter_;
-  v8::Global<v8::Value> buffer_;
 
   // Mojo data pipe where the data that is being read is written to.
-  std::unique_ptr<mojo::DataPipeProducer> producer_;
+  mojo::ScopedDataPipeProducerHandle producer_;
+  mojo::SimpleWatcher producer_watcher_;
+  const uint32_t pipe_capacity_;
+
+  // Buffers read from the stream, in order, and their total size.
+  base::circular_deque<PendingChunk> chunks_;
+  size_t buffered_bytes_ = 0;
 
-  // Whether we are in the middle of write.
-  bool is_writing_ = false;
+  // Whether we are inside |Pump|, which may be re-entered by stream events.
+  bool is_pumping_ = false;
 
-  // Whether we are in the middle of a stream.read().
-  bool is_reading_ = false;
+  // Whether we are waiting for the pipe to become writable.
+  bool waiting_for_pipe_ = false;
 
+  // Throughput counters, reported in a trace event when the load completes.
+  base::TimeTicks start_time_;
   size_t bytes_written_ = 0;
+  size_t read_count_ = 0;
+  size_t write_count_ = 0;
+  size_t pipe_wait_count_ = 0;
 
-  // When NotifyComplete is called while writing, we will save the result and
-  // quit with it after the write is done.
+  // When NotifyComplete is called while data is still pending, we will save
+  // the result and quit with it after the data has been written.
   bool ended_ = false;
   int result_ = net::OK;
 
@@ -95,7 +131,7 @@ class NodeStreamLoader : public network::mojom::URLLoader {
   bool readable_ = false;
 
   // It's possible for reads to be queued using nextTick() during read()
-  // which will cause 'readable' to emit during ReadMore, so we track if
+  // which will cause 'readable' to emit during ReadChunks, so we track if
   // that occurred in a flag.
   bool has_read_waiting_ = false;
 
@@ -14,6 +14,7 @@
 #include "base/strings/string_util.h"
 #include "base/strings/stringprintf.h"
 #include "content/public/browser/browser_context.h"
+#include "extensions/browser/api/web_request/web_request_resource_type.h"
 #include "extensions/browser/extension_navigation_ui_data.h"
 #include "net/base/completion_repeating_callback.h"
 #include "net/base/load_flags.h"
@@ -835,7 +836,13 @@ void ProxyingURLLoaderFactory::CreateLoaderAndStart(
     return;
   }
 
-  if (!web_request_api()->HasListener()) {
+  // Requests no listener can observe are not proxied. Their redirects are
+  // not observed either, so this only checks the resource type, which
+  // redirects keep, and never the URL.
+  if (!web_request_api()->HasListener() ||
+      !web_request_api()->MayObserveRequestsOfType(
+          extensions::ToWebRequestResourceType(request,
+                                               /*is_download=*/false))) {
     // Pass-through to the original factory.
     target_factory_->CreateLoaderAndStart(std::move(loader), request_id,
                                           options, request, std::move(client),
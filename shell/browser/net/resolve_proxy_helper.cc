@@ -9,6 +9,7 @@
 #include "base/functional/bind.h"
 #include "content/public/browser/browser_thread.h"
 #include "mojo/public/cpp/bindings/pending_remote.h"
+#include "net/base/net_errors.h"
 #include "net/base/network_anonymization_key.h"
 #include "net/proxy_resolution/proxy_info.h"
 
@@ -16,83 +17,128 @@ using content::BrowserThread;
 
 namespace electron {
 
+namespace {
+
+constexpr size_t kMaxCachedResults = 1000;
+// Long enough for a burst of lookups to share results, short enough that
+// changes of the system's proxy settings, which are not observed here, are
+// picked up soon.
+constexpr base::TimeDelta kCacheTTL = base::Seconds(5);
+
+}  // namespace
+
 ResolveProxyHelper::ResolveProxyHelper(
     network::mojom::NetworkContext* network_context)
-    : network_context_(network_context) {}
+    : cache_(kMaxCachedResults), network_context_(network_context) {
+  receivers_.set_disconnect_handler(base::BindRepeating(
+      &ResolveProxyHelper::OnLookupDisconnected, base::Unretained(this)));
+}
 
 ResolveProxyHelper::~ResolveProxyHelper() {
   DCHECK_CURRENTLY_ON(BrowserThread::UI);
-  DCHECK(!owned_self_);
-  DCHECK(!receiver_.is_bound());
   // Clear all pending requests if the ProxyService is still alive.
-  pending_requests_.clear();
+  receivers_.Clear();
+  pending_lookups_.clear();
+}
+
+// static
+GURL ResolveProxyHelper::GetLookupKey(const GURL& url) {
+  // Like net::ProxyResolutionService, which never shows the credentials or
+  // fragment of a URL to a PAC script, nor the path and query of secure URLs.
+  GURL::Replacements replacements;
+  replacements.ClearUsername();
+  replacements.ClearPassword();
+  replacements.ClearRef();
+  if (url.SchemeIsCryptographic()) {
+    replacements.ClearPath();
+    replacements.ClearQuery();
+  }
+  return url.ReplaceComponents(replacements);
 }
 
 void ResolveProxyHelper::ResolveProxy(const GURL& url,
                                       ResolveProxyCallback callback) {
   DCHECK_CURRENTLY_ON(BrowserThread::UI);
-  // Enqueue the pending request.
-  pending_requests_.emplace_back(url, std::move(callback));
-
-  // If nothing is in progress, start.
-  if (!receiver_.is_bound()) {
-    DCHECK_EQ(1u, pending_requests_.size());
-    StartPendingRequest();
+  GURL key = GetLookupKey(url);
+
+  if (auto it = cache_.Get(key); it != cache_.end()) {
+    if (it->second.expiry > base::TimeTicks::Now()) {
+      std::move(callback).Run(it->second.proxy);
+      return;
+    }
+    cache_.Erase(it);
   }
+
+  auto [it, inserted] = pending_lookups_.try_emplace(key);
+  it->second.callbacks.push_back(std::move(callback));
+  if (!inserted)
+    return;
+
+  it->second.generation = cache_generation_;
+  mojo::PendingRemote<network::mojom::ProxyLookupClient> proxy_lookup_client;
+  receivers_.Add(this, proxy_lookup_client.InitWithNewPipeAndPassReceiver(),
+                 key);
+  network_context_->LookUpProxyForURL(url, net::NetworkAnonymizationKey(),
+                                      std::move(proxy_lookup_client));
 }
 
-void ResolveProxyHelper::StartPendingRequest() {
+void ResolveProxyHelper::ClearCache() {
   DCHECK_CURRENTLY_ON(BrowserThread::UI);
-  DCHECK(!receiver_.is_bound());
-  DCHECK(!pending_requests_.empty());
-
-  // Start the request.
-  mojo::PendingRemote<network::mojom::ProxyLookupClient> proxy_lookup_client =
-      receiver_.BindNewPipeAndPassRemote();
-  receiver_.set_disconnect_handler(
-      base::BindOnce(&ResolveProxyHelper::OnProxyLookupComplete,
-                     base::Unretained(this), net::ERR_ABORTED, std::nullopt));
-  network_context_->LookUpProxyForURL(pending_requests_.front().url,
-                                      net::NetworkAnonymizationKey(),
-                                      std::move(proxy_lookup_client));
+  cache_.Clear();
+  // Lookups that are in progress may still use the old configuration.
+  ++cache_generation_;
+}
+
+base::OnceClosure ResolveProxyHelper::ClearCacheBefore(
+    base::OnceClosure callback) {
+  return base::BindOnce(
+      [](scoped_refptr<ResolveProxyHelper> self, base::OnceClosure callback) {
+        self->ClearCache();
+        std::move(callback).Run();
+      },
+      base::WrapRefCounted(this), std::move(callback));
 }
 
 void ResolveProxyHelper::OnProxyLookupComplete(
     int32_t net_error,
     const std::optional<net::ProxyInfo>& proxy_info) {
   DCHECK_CURRENTLY_ON(BrowserThread::UI);
-  DCHECK(!pending_requests_.empty());
-
-  receiver_.reset();
-
-  // Clear the current (completed) request.
-  PendingRequest completed_request = std::move(pending_requests_.front());
-  pending_requests_.pop_front();
+  GURL key = receivers_.current_context();
+  receivers_.Remove(receivers_.current_receiver());
 
   std::string proxy;
   if (proxy_info)
     proxy = proxy_info->ToPacString();
+  CompleteLookup(key, net_error, std::move(proxy));
+}
 
-  if (!completed_request.callback.is_null())
-    std::move(completed_request.callback).Run(proxy);
-
-  // Start the next request.
-  if (!pending_requests_.empty())
-    StartPendingRequest();
+void ResolveProxyHelper::OnLookupDisconnected() {
+  DCHECK_CURRENTLY_ON(BrowserThread::UI);
+  CompleteLookup(receivers_.current_context(), net::ERR_ABORTED, "");
 }
 
-ResolveProxyHelper::PendingRequest::PendingRequest(
-    const GURL& url,
-    ResolveProxyCallback callback)
-    : url(url), callback(std::move(callback)) {}
+void ResolveProxyHelper::CompleteLookup(const GURL& key,
+                                        int32_t net_error,
+                                        std::string proxy) {
+  auto it = pending_lookups_.find(key);
+  if (it == pending_lookups_.end())
+    return;
+  PendingLookup lookup = std::move(it->second);
+  pending_lookups_.erase(it);
+
+  if (net_error == net::OK && lookup.generation == cache_generation_)
+    cache_.Put(key, {proxy, base::TimeTicks::Now() + kCacheTTL});
+
+  for (auto& callback : lookup.callbacks) {
+    if (!callback.is_null())
+      std::move(callback).Run(proxy);
+  }
+}
 
-ResolveProxyHelper::PendingRequest::PendingRequest(
-    ResolveProxyHelper::PendingRequest&& pending_request) noexcept = default;
+ResolveProxyHelper::PendingLookup::PendingLookup() = default;
 
-ResolveProxyHelper::PendingRequest::~PendingRequest() noexcept = default;
+ResolveProxyHelper::PendingLookup::PendingLookup(PendingLookup&&) = default;
 
-ResolveProxyHelper::PendingRequest&
-ResolveProxyHelper::PendingRequest::operator=(
-    ResolveProxyHelper::PendingRequest&& pending_request) noexcept = default;
+ResolveProxyHelper::PendingLookup::~PendingLookup() = default;
 
 }  // namespace electron
@@ -5,13 +5,16 @@
 #ifndef ELECTRON_SHELL_BROWSER_NET_RESOLVE_PROXY_HELPER_H_
 #define ELECTRON_SHELL_BROWSER_NET_RESOLVE_PROXY_HELPER_H_
 
-#include <deque>
+#include <map>
 #include <optional>
 #include <string>
+#include <vector>
 
+#include "base/containers/lru_cache.h"
 #include "base/memory/raw_ptr.h"
 #include "base/memory/ref_counted.h"
-#include "mojo/public/cpp/bindings/receiver.h"
+#include "base/time/time.h"
+#include "mojo/public/cpp/bindings/receiver_set.h"
 #include "services/network/public/mojom/network_context.mojom.h"
 #include "services/network/public/mojom/proxy_lookup_client.mojom.h"
 #include "url/gurl.h"
@@ -26,8 +29,21 @@ class ResolveProxyHelper
 
   explicit ResolveProxyHelper(network::mojom::NetworkContext* network_context);
 
+  // Lookups for different URLs run concurrently. Requests for a URL that is
+  // already being looked up wait for that lookup, and results are reused for
+  // a few seconds.
   void ResolveProxy(const GURL& url, ResolveProxyCallback callback);
 
+  // Forgets the reused results, must be called when the proxy configuration
+  // changes.
+  void ClearCache();
+
+  // Returns |callback| wrapped so that the cache is cleared right before it
+  // runs. Used as the completion callback of proxy configuration changes,
+  // which take effect asynchronously; clearing earlier would let lookups
+  // that still see the old configuration fill the cache again.
+  base::OnceClosure ClearCacheBefore(base::OnceClosure callback);
+
   // disable copy
   ResolveProxyHelper(const ResolveProxyHelper&) = delete;
   ResolveProxyHelper& operator=(const ResolveProxyHelper&) = delete;
@@ -37,37 +53,40 @@ class ResolveProxyHelper
 
  private:
   friend class base::RefCountedThreadSafe<ResolveProxyHelper>;
-  // A PendingRequest is a resolve request that is in progress, or queued.
-  struct PendingRequest {
-   public:
-    PendingRequest(const GURL& url, ResolveProxyCallback callback);
-    PendingRequest(PendingRequest&& pending_request) noexcept;
-    ~PendingRequest();
 
-    // disable copy
-    PendingRequest(const PendingRequest&) = delete;
-    PendingRequest& operator=(const PendingRequest&) = delete;
+  // A lookup that is in progress, with the requests waiting for it.
+  struct PendingLookup {
+    PendingLookup();
+    PendingLookup(PendingLookup&&);
+    ~PendingLookup();
 
-    PendingRequest& operator=(PendingRequest&& pending_request) noexcept;
+    std::vector<ResolveProxyCallback> callbacks;
+    // The cache generation the lookup started in.
+    uint64_t generation = 0;
+  };
 
-    GURL url;
-    ResolveProxyCallback callback;
+  struct CachedResult {
+    std::string proxy;
+    base::TimeTicks expiry;
   };
 
-  // Starts the first pending request.
-  void StartPendingRequest();
+  // The part of |url| that proxy resolution depends on.
+  static GURL GetLookupKey(const GURL& url);
 
   // network::mojom::ProxyLookupClient implementation.
   void OnProxyLookupComplete(
       int32_t net_error,
       const std::optional<net::ProxyInfo>& proxy_info) override;
 
-  // Self-reference. Owned as long as there's an outstanding proxy lookup.
-  scoped_refptr<ResolveProxyHelper> owned_self_;
+  void OnLookupDisconnected();
+  void CompleteLookup(const GURL& key, int32_t net_error, std::string proxy);
+
+  std::map<GURL, PendingLookup> pending_lookups_;
+  // One receiver per pending lookup, with its key as context.
+  mojo::ReceiverSet<network::mojom::ProxyLookupClient, GURL> receivers_;
 
-  std::deque<PendingRequest> pending_requests_;
-  // Receiver for the currently in-progress request, if any.
-  mojo::Receiver<network::mojom::ProxyLookupClient> receiver_{this};
+  base::LRUCache<GURL, CachedResult> cache_;
+  uint64_t cache_generation_ = 0;
 
   // Weak Ref
   raw_ptr<network::mojom::NetworkContext> network_context_ = nullptr;
@@ -9,6 +9,7 @@
 #include <string>
 
 #include "extensions/browser/api/web_request/web_request_info.h"
+#include "extensions/browser/api/web_request/web_request_resource_type.h"
 #include "net/base/completion_once_callback.h"
 #include "services/network/public/cpp/resource_request.h"
 
@@ -25,6 +26,16 @@ class WebRequestAPI {
                               int error_code)>;
 
   virtual bool HasListener() const = 0;
+  // Returns false when no listener or rule can match a request for |url| of
+  // |type|, in which case the request does not need to be proxied.
+  virtual bool MayObserveRequest(
+      const GURL& url,
+      extensions::WebRequestResourceType type) const = 0;
+  // Returns false when no listener or rule can match a request of |type| for
+  // any URL. Redirects keep the type of a request, so unlike
+  // MayObserveRequest() this also holds for every URL it is redirected to.
+  virtual bool MayObserveRequestsOfType(
+      extensions::WebRequestResourceType type) const = 0;
   virtual int OnBeforeRequest(extensions::WebRequestInfo* info,
                               const network::ResourceRequest& request,
                               net::CompletionOnceCallback callback,
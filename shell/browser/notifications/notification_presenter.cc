@@ -6,7 +6,8 @@
 
 #include <algorithm>
 
-#include "shell/browser/notifications/notification.h"
+#include "base/functional/bind.h"
+#include "base/ranges/algorithm.h"
 
 namespace electron {
 
@@ -39,9 +40,90 @@ void NotificationPresenter::CloseNotificationWithId(
                          });
   if (it != notifications_.end()) {
     Notification* notification = (*it);
+    if (CancelPendingNotification(notification)) {
+      RemoveNotification(notification);
+      return;
+    }
     notification->Dismiss();
     notifications_.erase(notification);
   }
 }
 
+void NotificationPresenter::ShowNotification(
+    Notification* notification,
+    const NotificationOptions& options) {
+  const base::TimeTicks now = base::TimeTicks::Now();
+  if (pending_notifications_.empty() &&
+      (min_show_interval_.is_zero() ||
+       now - last_shown_ >= min_show_interval_)) {
+    last_shown_ = now;
+    notification->Show(options);
+    return;
+  }
+
+  if (!options.tag.empty()) {
+    auto it = base::ranges::find_if(
+        pending_notifications_, [&options](const PendingNotification& pending) {
+          return pending.notification && pending.options.tag == options.tag;
+        });
+    if (it != pending_notifications_.end()) {
+      Notification* replaced = it->notification.get();
+      pending_notifications_.erase(it);
+      replaced->Destroy();
+    }
+  }
+
+  pending_notifications_.push_back({notification->GetWeakPtr(), options});
+  if (!show_timer_.IsRunning()) {
+    show_timer_.Start(
+        FROM_HERE,
+        std::max(last_shown_ + min_show_interval_ - now, base::TimeDelta()),
+        base::BindOnce(&NotificationPresenter::ShowNextPendingNotification,
+                       base::Unretained(this)));
+  }
+}
+
+bool NotificationPresenter::CancelPendingNotification(
+    Notification* notification) {
+  auto it = base::ranges::find_if(
+      pending_notifications_,
+      [notification](const PendingNotification& pending) {
+        return pending.notification.get() == notification;
+      });
+  if (it == pending_notifications_.end())
+    return false;
+  pending_notifications_.erase(it);
+  return true;
+}
+
+void NotificationPresenter::set_max_rate(int notifications_per_second) {
+  min_show_interval_ = notifications_per_second > 0
+                           ? base::Seconds(1) / notifications_per_second
+                           : base::TimeDelta();
+  if (min_show_interval_.is_zero()) {
+    show_timer_.Stop();
+    while (!pending_notifications_.empty())
+      ShowNextPendingNotification();
+  }
+}
+
+void NotificationPresenter::ShowNextPendingNotification() {
+  while (!pending_notifications_.empty()) {
+    PendingNotification pending = std::move(pending_notifications_.front());
+    pending_notifications_.pop_front();
+    if (pending.notification) {
+      last_shown_ = base::TimeTicks::Now();
+      pending.notification->Show(pending.options);
+      break;
+    }
+  }
+
+  if (!pending_notifications_.empty() && !min_show_interval_.is_zero()) {
+    show_timer_.Start(
+        FROM_HERE, min_show_interval_,
+        base::BindOnce(&NotificationPresenter::ShowNextPendingNotification,
+                       base::Unretained(this)));
+  }
+}
+
 }  // namespace electron
@@ -8,11 +8,14 @@
 #include <set>
 #include <string>
 
+#include "base/containers/circular_deque.h"
 #include "base/memory/weak_ptr.h"
+#include "base/time/time.h"
+#include "base/timer/timer.h"
+#include "shell/browser/notifications/notification.h"
 
 namespace electron {
 
-class Notification;
 class NotificationDelegate;
 
 class NotificationPresenter {
@@ -26,6 +29,18 @@ class NotificationPresenter {
       const std::string& notification_id);
   void CloseNotificationWithId(const std::string& notification_id);
 
+  // Shows |notification|, or queues it if showing it now would exceed the
+  // rate set with set_max_rate(). A queued notification is replaced by a
+  // newer one with the same non-empty tag.
+  void ShowNotification(Notification* notification,
+                        const NotificationOptions& options);
+
+  // Drops |notification| if it is still queued, and returns whether it was.
+  bool CancelPendingNotification(Notification* notification);
+
+  // Limits how many notifications are shown per second. 0 means no limit.
+  void set_max_rate(int notifications_per_second);
+
   std::set<Notification*> notifications() const { return notifications_; }
 
   // disable copy
@@ -41,8 +56,18 @@ class NotificationPresenter {
   friend class Notification;
 
   void RemoveNotification(Notification* notification);
+  void ShowNextPendingNotification();
 
   std::set<Notification*> notifications_;
+
+  struct PendingNotification {
+    base::WeakPtr<Notification> notification;
+    NotificationOptions options;
+  };
+  base::circular_deque<PendingNotification> pending_notifications_;
+  base::TimeDelta min_show_interval_;
+  base::TimeTicks last_shown_;
+  base::OneShotTimer show_timer_;
 };
 
 }  // namespace electron
@@ -70,7 +70,13 @@ void LayeredWindowUpdater::Draw(const gfx::Rect& damage_rect,
 
   if (active_ && canvas_->peekPixels(&pixmap)) {
     bitmap.installPixels(pixmap);
-    callback_.Run(damage_rect, bitmap);
+    gfx::Rect paint_rect = damage_rect;
+    paint_rect.Union(missed_damage_rect_);
+    missed_damage_rect_ = gfx::Rect();
+    callback_.Run(paint_rect, bitmap, nullptr);
+  } else {
+    // Keep the damage of draws that weren't painted for the next paint.
+    missed_damage_rect_.Union(damage_rect);
   }
 
   std::move(draw_callback).Run();
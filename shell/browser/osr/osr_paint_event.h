@@ -0,0 +1,54 @@
+// Copyright (c) 2024 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#ifndef ELECTRON_SHELL_BROWSER_OSR_OSR_PAINT_EVENT_H_
+#define ELECTRON_SHELL_BROWSER_OSR_OSR_PAINT_EVENT_H_
+
+#include <memory>
+
+#include "base/functional/callback.h"
+#include "base/time/time.h"
+#include "media/base/video_types.h"
+#include "mojo/public/cpp/bindings/pending_remote.h"
+#include "services/viz/privileged/mojom/compositing/frame_sink_video_capture.mojom.h"
+#include "third_party/skia/include/core/SkBitmap.h"
+#include "ui/gfx/geometry/rect.h"
+#include "ui/gfx/geometry/size.h"
+#include "ui/gfx/gpu_memory_buffer.h"
+
+namespace electron {
+
+// A captured frame that is still in GPU memory, used when offscreen rendering
+// is created with |useSharedTexture|.
+struct OffscreenSharedTexture {
+  OffscreenSharedTexture();
+  ~OffscreenSharedTexture();
+
+  // disable copy
+  OffscreenSharedTexture(const OffscreenSharedTexture&) = delete;
+  OffscreenSharedTexture& operator=(const OffscreenSharedTexture&) = delete;
+
+  gfx::GpuMemoryBufferHandle handle;
+  media::VideoPixelFormat pixel_format = media::PIXEL_FORMAT_UNKNOWN;
+  gfx::Size coded_size;
+  gfx::Rect visible_rect;
+  gfx::Rect content_rect;
+  base::TimeDelta timestamp;
+
+  // Prevents the capturer from recycling the buffer, the frame is released
+  // when this is reset.
+  mojo::PendingRemote<viz::mojom::FrameSinkVideoConsumerFrameCallbacks>
+      releaser;
+};
+
+// Either |bitmap| holds the frame, or it is empty and |texture| is set.
+typedef base::RepeatingCallback<void(
+    const gfx::Rect&,
+    const SkBitmap&,
+    std::unique_ptr<OffscreenSharedTexture> texture)>
+    OnPaintCallback;
+
+}  // namespace electron
+
+#endif  // ELECTRON_SHELL_BROWSER_OSR_OSR_PAINT_EVENT_H_
@@ -14,6 +14,7 @@
 #include "base/location.h"
 #include "base/memory/ptr_util.h"
 #include "base/memory/raw_ptr.h"
+#include "base/ranges/algorithm.h"
 #include "base/task/single_thread_task_runner.h"
 #include "base/time/time.h"
 #include "components/viz/common/features.h"
@@ -55,6 +56,27 @@ namespace {
 
 const float kDefaultScaleFactor = 1.0;
 
+// Backings that a paint event may still reference, beyond the current one.
+constexpr size_t kMaxSpareBackings = 2;
+
+// Copies the part of |src|, placed at |origin| in |dst|, that intersects
+// |rect|. Returns the number of bytes copied.
+size_t CopyBitmapRect(const SkBitmap& src,
+                      const gfx::Point& origin,
+                      const gfx::Rect& rect,
+                      SkBitmap* dst) {
+  gfx::Rect area = gfx::IntersectRects(
+      gfx::Rect(origin, gfx::Size(src.width(), src.height())), rect);
+  area.Intersect(gfx::Rect(dst->width(), dst->height()));
+  if (area.IsEmpty())
+    return 0;
+  src.readPixels(dst->info().makeWH(area.width(), area.height()),
+                 dst->getAddr(area.x(), area.y()), dst->rowBytes(),
+                 area.x() - origin.x(), area.y() - origin.y());
+  return static_cast<size_t>(area.width()) * area.height() *
+         dst->bytesPerPixel();
+}
+
 ui::MouseEvent UiMouseEventFromWebMouseEvent(blink::WebMouseEvent event) {
   ui::EventType type = ui::EventType::ET_UNKNOWN;
   switch (event.GetType()) {
@@ -174,6 +196,7 @@ class ElectronDelegatedFrameHostClient
 
 OffScreenRenderWidgetHostView::OffScreenRenderWidgetHostView(
     bool transparent,
+    bool offscreen_use_shared_texture,
     bool painting,
     int frame_rate,
     const OnPaintCallback& callback,
@@ -184,6 +207,7 @@ OffScreenRenderWidgetHostView::OffScreenRenderWidgetHostView(
       render_widget_host_(content::RenderWidgetHostImpl::From(host)),
       parent_host_view_(parent_host_view),
       transparent_(transparent),
+      offscreen_use_shared_texture_(offscreen_use_shared_texture),
       callback_(callback),
       frame_rate_(frame_rate),
       size_(initial_size),
@@ -574,7 +598,8 @@ OffScreenRenderWidgetHostView::CreateViewForWidget(
   }
 
   return new OffScreenRenderWidgetHostView(
-      transparent_, true, embedder_host_view->frame_rate(), callback_,
+      transparent_, offscreen_use_shared_texture_, true,
+      embedder_host_view->frame_rate(), callback_,
       render_widget_host, embedder_host_view, size());
 }
 
@@ -637,16 +662,19 @@ void OffScreenRenderWidgetHostView::RemoveGuestHostView(
 void OffScreenRenderWidgetHostView::AddViewProxy(OffscreenViewProxy* proxy) {
   proxy->SetObserver(this);
   proxy_views_.insert(proxy);
+  composited_layer_rects_.clear();
 }
 
 void OffScreenRenderWidgetHostView::RemoveViewProxy(OffscreenViewProxy* proxy) {
   proxy->RemoveObserver();
   proxy_views_.erase(proxy);
+  composited_layer_rects_.clear();
 }
 
 void OffScreenRenderWidgetHostView::ProxyViewDestroyed(
     OffscreenViewProxy* proxy) {
   proxy_views_.erase(proxy);
+  composited_layer_rects_.clear();
   Invalidate();
 }
 
@@ -700,11 +728,29 @@ uint64_t OffScreenRenderWidgetHostView::GetNSViewId() const {
 }
 #endif
 
-void OffScreenRenderWidgetHostView::OnPaint(const gfx::Rect& damage_rect,
-                                            const SkBitmap& bitmap) {
-  backing_ = std::make_unique<SkBitmap>();
-  backing_->allocN32Pixels(bitmap.width(), bitmap.height(), !transparent_);
-  bitmap.readPixels(backing_->pixmap());
+void OffScreenRenderWidgetHostView::OnPaint(
+    const gfx::Rect& damage_rect,
+    const SkBitmap& bitmap,
+    std::unique_ptr<OffscreenSharedTexture> texture) {
+  // Shared textures are handed out as they are, they can't be composited with
+  // popups without reading them back.
+  if (texture) {
+    // The backing no longer holds the previous frame.
+    backing_->reset();
+    if (IsPopupWidget())
+      return;
+    if (awaiting_paint_acknowledgement_) {
+      // Destroying the texture hands it back to the capturer right away.
+      ++paint_statistics_.dropped;
+      dropped_texture_frame_ = true;
+      return;
+    }
+    DidPaint();
+    callback_.Run(damage_rect, SkBitmap(), std::move(texture));
+    return;
+  }
+
+  UpdateBacking(damage_rect, bitmap);
 
   if (IsPopupWidget() && parent_callback_) {
     parent_callback_.Run(this->popup_position_);
@@ -713,6 +759,56 @@ void OffScreenRenderWidgetHostView::OnPaint(const gfx::Rect& damage_rect,
   }
 }
 
+void OffScreenRenderWidgetHostView::UpdateBacking(const gfx::Rect& damage_rect,
+                                                  const SkBitmap& bitmap) {
+  const gfx::Rect frame_rect(bitmap.width(), bitmap.height());
+  auto has_frame_size = [&](const SkBitmap& backing) {
+    return backing.width() == bitmap.width() &&
+           backing.height() == bitmap.height();
+  };
+  // Pixels handed out with an earlier paint event are still referenced
+  // elsewhere and must not change.
+  auto is_reusable = [&](const SkBitmap& backing) {
+    return has_frame_size(backing) && backing.pixelRef() &&
+           backing.pixelRef()->unique();
+  };
+
+  // The backing already holds the previous frame, so only the damaged part
+  // has to be copied.
+  if (is_reusable(*backing_)) {
+    paint_statistics_.bytes_copied +=
+        CopyBitmapRect(bitmap, gfx::Point(),
+                       damage_rect.IsEmpty() ? frame_rect : damage_rect,
+                       backing_.get());
+    return;
+  }
+
+  // Otherwise take a buffer that is no longer referenced, or allocate a new
+  // one, and copy the whole frame into it.
+  std::unique_ptr<SkBitmap> backing;
+  auto it = base::ranges::find_if(
+      spare_backings_,
+      [&](const std::unique_ptr<SkBitmap>& spare) {
+        return is_reusable(*spare);
+      });
+  if (it != spare_backings_.end()) {
+    backing = std::move(*it);
+    spare_backings_.erase(it);
+  } else {
+    backing = std::make_unique<SkBitmap>();
+    backing->allocN32Pixels(bitmap.width(), bitmap.height(), !transparent_);
+  }
+  bitmap.readPixels(backing->pixmap());
+  paint_statistics_.bytes_copied += backing->computeByteSize();
+
+  std::swap(backing_, backing);
+  std::erase_if(spare_backings_, [&](const std::unique_ptr<SkBitmap>& spare) {
+    return !has_frame_size(*spare);
+  });
+  if (has_frame_size(*backing) && spare_backings_.size() < kMaxSpareBackings)
+    spare_backings_.push_back(std::move(backing));
+}
+
 gfx::Size OffScreenRenderWidgetHostView::SizeInPixels() {
   float sf = GetDeviceScaleFactor();
   return gfx::ToFlooredSize(
@@ -721,6 +817,17 @@ gfx::Size OffScreenRenderWidgetHostView::SizeInPixels() {
 
 void OffScreenRenderWidgetHostView::CompositeFrame(
     const gfx::Rect& damage_rect) {
+  // The backing keeps receiving updates, so the held back frames can be
+  // composited in one go once the paint is acknowledged.
+  if (awaiting_paint_acknowledgement_) {
+    ++paint_statistics_.coalesced;
+    pending_paint_damage_ = pending_paint_damage_
+                                ? gfx::UnionRects(*pending_paint_damage_,
+                                                  damage_rect)
+                                : damage_rect;
+    return;
+  }
+
   HoldResize();
 
   gfx::Size size_in_pixels = SizeInPixels();
@@ -730,34 +837,66 @@ void OffScreenRenderWidgetHostView::CompositeFrame(
   // Optimize for the case when there is no popup
   if (proxy_views_.empty() && !popup_host_view_) {
     frame = GetBacking();
+    composited_frame_.reset();
+    composited_layer_rects_.clear();
   } else {
     float sf = GetDeviceScaleFactor();
-    frame.allocN32Pixels(size_in_pixels.width(), size_in_pixels.height(),
-                         false);
-    if (!GetBacking().drawsNothing()) {
-      SkCanvas canvas(frame);
-      canvas.writePixels(GetBacking(), 0, 0);
-
-      if (popup_host_view_ && !popup_host_view_->GetBacking().drawsNothing()) {
-        gfx::Rect rect = popup_host_view_->popup_position_;
-        gfx::Point origin_in_pixels =
-            gfx::ToFlooredPoint(gfx::ConvertPointToPixels(rect.origin(), sf));
-        canvas.writePixels(popup_host_view_->GetBacking(), origin_in_pixels.x(),
-                           origin_in_pixels.y());
-      }
+    auto layer_rect = [sf](const gfx::Rect& bounds, const SkBitmap& bitmap) {
+      return gfx::Rect(
+          gfx::ToFlooredPoint(gfx::ConvertPointToPixels(bounds.origin(), sf)),
+          gfx::Size(bitmap.width(), bitmap.height()));
+    };
+
+    // Layers are drawn in this order, each on top of the previous ones.
+    std::vector<std::pair<const SkBitmap*, gfx::Rect>> layers;
+    layers.emplace_back(&GetBacking(), gfx::Rect(GetBacking().width(),
+                                                 GetBacking().height()));
+    if (popup_host_view_ && !popup_host_view_->GetBacking().drawsNothing()) {
+      const SkBitmap& popup = popup_host_view_->GetBacking();
+      layers.emplace_back(&popup,
+                          layer_rect(popup_host_view_->popup_position_, popup));
+    }
+    for (auto* proxy_view : proxy_views_) {
+      const SkBitmap& proxy = *proxy_view->bitmap();
+      layers.emplace_back(&proxy, layer_rect(proxy_view->bounds(), proxy));
+    }
 
-      for (auto* proxy_view : proxy_views_) {
-        gfx::Rect rect = proxy_view->bounds();
-        gfx::Point origin_in_pixels =
-            gfx::ToFlooredPoint(gfx::ConvertPointToPixels(rect.origin(), sf));
-        canvas.writePixels(*proxy_view->bitmap(), origin_in_pixels.x(),
-                           origin_in_pixels.y());
+    std::vector<gfx::Rect> layer_rects;
+    for (const auto& layer : layers)
+      layer_rects.push_back(layer.second);
+
+    // Only the damaged part of the composited frame has to be redrawn, unless
+    // layers moved or a paint event still references its pixels.
+    gfx::Rect redraw_rect =
+        gfx::IntersectRects(gfx::Rect(size_in_pixels), damage_rect);
+    if (composited_frame_.width() != size_in_pixels.width() ||
+        composited_frame_.height() != size_in_pixels.height() ||
+        !composited_frame_.pixelRef() ||
+        !composited_frame_.pixelRef()->unique()) {
+      composited_frame_.allocN32Pixels(size_in_pixels.width(),
+                                       size_in_pixels.height(), false);
+      composited_frame_.eraseColor(SK_ColorTRANSPARENT);
+      redraw_rect = gfx::Rect(size_in_pixels);
+    } else if (layer_rects != composited_layer_rects_) {
+      redraw_rect = gfx::Rect(size_in_pixels);
+    }
+    composited_layer_rects_ = std::move(layer_rects);
+
+    if (!GetBacking().drawsNothing()) {
+      for (const auto& [bitmap, rect] : layers) {
+        paint_statistics_.bytes_copied += CopyBitmapRect(
+            *bitmap, rect.origin(), redraw_rect, &composited_frame_);
       }
+    } else {
+      // Nothing was drawn, so the next frame has to be composited in full.
+      composited_layer_rects_.clear();
     }
+    frame = composited_frame_;
   }
 
+  DidPaint();
   callback_.Run(gfx::IntersectRects(gfx::Rect(size_in_pixels), damage_rect),
-                frame);
+                frame, nullptr);
 
   ReleaseResize();
 }
@@ -983,6 +1122,35 @@ void OffScreenRenderWidgetHostView::SetupFrameRate(bool force) {
   }
 }
 
+void OffScreenRenderWidgetHostView::SetPaintAcknowledgementEnabled(
+    bool enabled) {
+  paint_acknowledgement_enabled_ = enabled;
+  if (!enabled)
+    AcknowledgePaint();
+}
+
+void OffScreenRenderWidgetHostView::AcknowledgePaint() {
+  if (!awaiting_paint_acknowledgement_)
+    return;
+  awaiting_paint_acknowledgement_ = false;
+
+  if (pending_paint_damage_) {
+    const gfx::Rect damage_rect = *pending_paint_damage_;
+    pending_paint_damage_.reset();
+    CompositeFrame(damage_rect);
+  } else if (dropped_texture_frame_) {
+    dropped_texture_frame_ = false;
+    if (video_consumer_)
+      video_consumer_->RequestRefreshFrame();
+  }
+}
+
+void OffScreenRenderWidgetHostView::DidPaint() {
+  ++paint_statistics_.painted;
+  if (paint_acknowledgement_enabled_)
+    awaiting_paint_acknowledgement_ = true;
+}
+
 void OffScreenRenderWidgetHostView::Invalidate() {
   InvalidateBounds(gfx::Rect(GetRequestedRendererSize()));
 }
@@ -6,6 +6,7 @@
 #define ELECTRON_SHELL_BROWSER_OSR_OSR_RENDER_WIDGET_HOST_VIEW_H_
 
 #include <memory>
+#include <optional>
 #include <set>
 #include <string>
 #include <vector>
@@ -27,6 +28,7 @@
 #include "content/browser/renderer_host/render_widget_host_view_base.h"  // nogncheck
 #include "content/browser/web_contents/web_contents_view.h"  // nogncheck
 #include "shell/browser/osr/osr_host_display_client.h"
+#include "shell/browser/osr/osr_paint_event.h"
 #include "shell/browser/osr/osr_video_consumer.h"
 #include "shell/browser/osr/osr_view_proxy.h"
 #include "third_party/blink/public/mojom/widget/record_content_to_visible_time_request.mojom-forward.h"
@@ -55,8 +57,6 @@ class ElectronBeginFrameTimer;
 
 class ElectronDelegatedFrameHostClient;
 
-typedef base::RepeatingCallback<void(const gfx::Rect&, const SkBitmap&)>
-    OnPaintCallback;
 typedef base::RepeatingCallback<void(const gfx::Rect&)> OnPopupPaintCallback;
 
 class OffScreenRenderWidgetHostView
@@ -66,6 +66,7 @@ class OffScreenRenderWidgetHostView
       public OffscreenViewProxyObserver {
  public:
   OffScreenRenderWidgetHostView(bool transparent,
+                                bool offscreen_use_shared_texture,
                                 bool painting,
                                 int frame_rate,
                                 const OnPaintCallback& callback,
@@ -200,13 +201,16 @@ class OffScreenRenderWidgetHostView
   void RemoveViewProxy(OffscreenViewProxy* proxy);
   void ProxyViewDestroyed(OffscreenViewProxy* proxy) override;
 
-  void OnPaint(const gfx::Rect& damage_rect, const SkBitmap& bitmap);
+  void OnPaint(const gfx::Rect& damage_rect,
+               const SkBitmap& bitmap,
+               std::unique_ptr<OffscreenSharedTexture> texture);
   void OnPopupPaint(const gfx::Rect& damage_rect);
   void OnProxyViewPaint(const gfx::Rect& damage_rect) override;
 
   gfx::Size SizeInPixels();
 
   void CompositeFrame(const gfx::Rect& damage_rect);
+  void UpdateBacking(const gfx::Rect& damage_rect, const SkBitmap& bitmap);
 
   bool IsPopupWidget() const {
     return widget_type_ == content::WidgetType::kPopup;
@@ -224,9 +228,28 @@ class OffScreenRenderWidgetHostView
   void SetPainting(bool painting);
   bool is_painting() const { return painting_; }
 
+  bool offscreen_use_shared_texture() const {
+    return offscreen_use_shared_texture_;
+  }
+
   void SetFrameRate(int frame_rate);
   int frame_rate() const { return frame_rate_; }
 
+  // When enabled, a paint event is only emitted once the previous one has been
+  // acknowledged. Bitmap frames produced in between are coalesced into the
+  // next paint event, shared texture frames are dropped.
+  void SetPaintAcknowledgementEnabled(bool enabled);
+  void AcknowledgePaint();
+
+  struct PaintStatistics {
+    uint64_t painted = 0;
+    uint64_t coalesced = 0;
+    uint64_t dropped = 0;
+    // Pixel bytes copied into the backing store and composited frames.
+    uint64_t bytes_copied = 0;
+  };
+  const PaintStatistics& paint_statistics() const { return paint_statistics_; }
+
   ui::Layer* root_layer() const { return root_layer_.get(); }
 
   content::DelegatedFrameHost* delegated_frame_host() const {
@@ -244,6 +267,7 @@ class OffScreenRenderWidgetHostView
 
   void set_popup_host_view(OffScreenRenderWidgetHostView* popup_view) {
     popup_host_view_ = popup_view;
+    composited_layer_rects_.clear();
   }
 
   void set_child_host_view(OffScreenRenderWidgetHostView* child_view) {
@@ -252,6 +276,7 @@ class OffScreenRenderWidgetHostView
 
  private:
   void SetupFrameRate(bool force);
+  void DidPaint();
   void ResizeRootLayer(bool force);
 
   viz::FrameSinkId AllocateFrameSinkId();
@@ -270,6 +295,7 @@ class OffScreenRenderWidgetHostView
   std::set<OffscreenViewProxy*> proxy_views_;
 
   const bool transparent_;
+  const bool offscreen_use_shared_texture_;
   OnPaintCallback callback_;
   OnPopupPaintCallback parent_callback_;
 
@@ -286,6 +312,14 @@ class OffScreenRenderWidgetHostView
   bool hold_resize_ = false;
   bool pending_resize_ = false;
 
+  bool paint_acknowledgement_enabled_ = false;
+  bool awaiting_paint_acknowledgement_ = false;
+  // Damage of the bitmap frames held back while awaiting an acknowledgement.
+  std::optional<gfx::Rect> pending_paint_damage_;
+  // Whether a shared texture frame was dropped while awaiting one.
+  bool dropped_texture_frame_ = false;
+  PaintStatistics paint_statistics_;
+
   viz::LocalSurfaceId delegated_frame_host_surface_id_;
   viz::ParentLocalSurfaceIdAllocator delegated_frame_host_allocator_;
 
@@ -320,6 +354,15 @@ class OffScreenRenderWidgetHostView
 
   std::unique_ptr<SkBitmap> backing_;
 
+  // Earlier backings, kept for reuse once the paint events that referenced
+  // them are gone.
+  std::vector<std::unique_ptr<SkBitmap>> spare_backings_;
+
+  // The backing with popups and proxy views drawn on top, and where those
+  // layers were when it was last drawn.
+  SkBitmap composited_frame_;
+  std::vector<gfx::Rect> composited_layer_rects_;
+
   base::WeakPtrFactory<OffScreenRenderWidgetHostView> weak_ptr_factory_{this};
 };
 
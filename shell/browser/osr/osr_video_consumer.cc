@@ -49,7 +49,14 @@ OffScreenVideoConsumer::~OffScreenVideoConsumer() = default;
 
 void OffScreenVideoConsumer::SetActive(bool active) {
   if (active) {
-    video_capturer_->Start(this, viz::mojom::BufferFormatPreference::kDefault);
+    // Nothing was painted while the capturer was stopped.
+    dropped_frame_ = true;
+    // The capturer falls back to shared memory when it can't allocate GPU
+    // memory buffers, so both kinds of frames are handled below.
+    video_capturer_->Start(
+        this, view_->offscreen_use_shared_texture()
+                  ? viz::mojom::BufferFormatPreference::kPreferGpuMemoryBuffer
+                  : viz::mojom::BufferFormatPreference::kDefault);
   } else {
     video_capturer_->Stop();
   }
@@ -66,35 +73,71 @@ void OffScreenVideoConsumer::SizeChanged(const gfx::Size& size_in_pixels) {
   video_capturer_->RequestRefreshFrame();
 }
 
+void OffScreenVideoConsumer::RequestRefreshFrame() {
+  video_capturer_->RequestRefreshFrame();
+}
+
 void OffScreenVideoConsumer::OnFrameCaptured(
     ::media::mojom::VideoBufferHandlePtr data,
     ::media::mojom::VideoFrameInfoPtr info,
     const gfx::Rect& content_rect,
     mojo::PendingRemote<viz::mojom::FrameSinkVideoConsumerFrameCallbacks>
         callbacks) {
-  auto& data_region = data->get_read_only_shmem_region();
-
   if (!CheckContentRect(content_rect)) {
+    dropped_frame_ = true;
     SizeChanged(view_->SizeInPixels());
     return;
   }
 
+  // Update rects are relative to the previous captured frame, so the whole
+  // frame is damaged if that one was never painted.
+  std::optional<gfx::Rect> update_rect = info->metadata.capture_update_rect;
+  if (!update_rect.has_value() || update_rect->IsEmpty() || dropped_frame_) {
+    update_rect = content_rect;
+  }
+  dropped_frame_ = false;
+
+  if (data->is_gpu_memory_buffer_handle()) {
+    // Hand the buffer out without reading it back, the capturer keeps it
+    // until |releaser| is dropped.
+    auto texture = std::make_unique<OffscreenSharedTexture>();
+    texture->handle = std::move(data->get_gpu_memory_buffer_handle());
+    texture->pixel_format = info->pixel_format;
+    texture->coded_size = info->coded_size;
+    texture->visible_rect = info->visible_rect;
+    texture->content_rect = content_rect;
+    texture->timestamp = info->timestamp;
+    texture->releaser = std::move(callbacks);
+    callback_.Run(*update_rect, SkBitmap(), std::move(texture));
+    return;
+  }
+
   mojo::Remote<viz::mojom::FrameSinkVideoConsumerFrameCallbacks>
       callbacks_remote(std::move(callbacks));
 
+  if (!data->is_read_only_shmem_region()) {
+    dropped_frame_ = true;
+    callbacks_remote->Done();
+    return;
+  }
+  auto& data_region = data->get_read_only_shmem_region();
+
   if (!data_region.IsValid()) {
+    dropped_frame_ = true;
     callbacks_remote->Done();
     return;
   }
   base::ReadOnlySharedMemoryMapping mapping = data_region.Map();
   if (!mapping.IsValid()) {
     DLOG(ERROR) << "Shared memory mapping failed.";
+    dropped_frame_ = true;
     callbacks_remote->Done();
     return;
   }
   if (mapping.size() <
       media::VideoFrame::AllocationSize(info->pixel_format, info->coded_size)) {
     DLOG(ERROR) << "Shared memory size was less than expected.";
+    dropped_frame_ = true;
     callbacks_remote->Done();
     return;
   }
@@ -128,12 +171,7 @@ void OffScreenVideoConsumer::OnFrameCaptured(
       new FramePinner{std::move(mapping), callbacks_remote.Unbind()});
   bitmap.setImmutable();
 
-  std::optional<gfx::Rect> update_rect = info->metadata.capture_update_rect;
-  if (!update_rect.has_value() || update_rect->IsEmpty()) {
-    update_rect = content_rect;
-  }
-
-  callback_.Run(*update_rect, bitmap);
+  callback_.Run(*update_rect, bitmap, nullptr);
 }
 
 void OffScreenVideoConsumer::OnNewSubCaptureTargetVersion(
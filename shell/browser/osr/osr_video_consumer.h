@@ -14,14 +14,12 @@
 #include "components/viz/host/client_frame_sink_video_capturer.h"
 #include "media/capture/mojom/video_capture_buffer.mojom-forward.h"
 #include "media/capture/mojom/video_capture_types.mojom.h"
+#include "shell/browser/osr/osr_paint_event.h"
 
 namespace electron {
 
 class OffScreenRenderWidgetHostView;
 
-typedef base::RepeatingCallback<void(const gfx::Rect&, const SkBitmap&)>
-    OnPaintCallback;
-
 class OffScreenVideoConsumer : public viz::mojom::FrameSinkVideoConsumer {
  public:
   OffScreenVideoConsumer(OffScreenRenderWidgetHostView* view,
@@ -35,6 +33,7 @@ class OffScreenVideoConsumer : public viz::mojom::FrameSinkVideoConsumer {
   void SetActive(bool active);
   void SetFrameRate(int frame_rate);
   void SizeChanged(const gfx::Size& size_in_pixels);
+  void RequestRefreshFrame();
 
  private:
   // viz::mojom::FrameSinkVideoConsumer implementation.
@@ -53,6 +52,9 @@ class OffScreenVideoConsumer : public viz::mojom::FrameSinkVideoConsumer {
 
   OnPaintCallback callback_;
 
+  // Whether a captured frame was discarded without being painted.
+  bool dropped_frame_ = false;
+
   raw_ptr<OffScreenRenderWidgetHostView> view_;
   std::unique_ptr<viz::ClientFrameSinkVideoCapturer> video_capturer_;
 
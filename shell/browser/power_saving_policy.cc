@@ -0,0 +1,76 @@
+// Copyright (c) 2024 Microsoft, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#include "shell/browser/power_saving_policy.h"
+
+#include <utility>
+
+#include "base/no_destructor.h"
+#include "base/power_monitor/power_monitor.h"
+#include "shell/browser/api/electron_api_web_contents.h"
+
+namespace electron {
+
+// static
+PowerSavingPolicy* PowerSavingPolicy::Get() {
+  static base::NoDestructor<PowerSavingPolicy> policy;
+  return policy.get();
+}
+
+PowerSavingPolicy::PowerSavingPolicy() = default;
+
+PowerSavingPolicy::~PowerSavingPolicy() = default;
+
+void PowerSavingPolicy::SetOptions(std::optional<Options> options,
+                                   ChangeCallback on_change) {
+  // The observers are only added once an app opts in, the policy lives for
+  // the rest of the process after that.
+  if (options && !observing_) {
+    observing_ = true;
+    base::PowerMonitor::AddPowerStateObserver(this);
+    base::PowerMonitor::AddPowerThermalObserver(this);
+    on_battery_ = base::PowerMonitor::IsOnBatteryPower();
+    thermal_state_ = base::PowerMonitor::GetCurrentThermalState();
+    speed_limit_ = base::PowerMonitor::GetInitialSpeedLimit();
+  }
+
+  options_ = std::move(options);
+  on_change_ = std::move(on_change);
+  // The caps may differ from the previous options even if the state does not.
+  Update(true);
+}
+
+void PowerSavingPolicy::OnPowerStateChange(bool on_battery_power) {
+  on_battery_ = on_battery_power;
+  Update(false);
+}
+
+void PowerSavingPolicy::OnThermalStateChange(DeviceThermalState new_state) {
+  thermal_state_ = new_state;
+  Update(false);
+}
+
+void PowerSavingPolicy::OnSpeedLimitChange(int speed_limit) {
+  speed_limit_ = speed_limit;
+  Update(false);
+}
+
+void PowerSavingPolicy::Update(bool force) {
+  bool active = false;
+  if (options_) {
+    active = (options_->on_battery && on_battery_) ||
+             thermal_state_ >= options_->thermal_state ||
+             speed_limit_ < options_->speed_limit;
+  }
+  if (active == active_ && !force)
+    return;
+
+  active_ = active;
+  for (auto* web_contents : api::WebContents::GetWebContentsList())
+    web_contents->UpdatePowerSaving();
+  if (on_change_)
+    on_change_.Run(active_);
+}
+
+}  // namespace electron
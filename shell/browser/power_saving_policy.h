@@ -0,0 +1,85 @@
+// Copyright (c) 2024 Microsoft, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#ifndef ELECTRON_SHELL_BROWSER_POWER_SAVING_POLICY_H_
+#define ELECTRON_SHELL_BROWSER_POWER_SAVING_POLICY_H_
+
+#include <optional>
+
+#include "base/functional/callback.h"
+#include "base/power_monitor/power_observer.h"
+
+namespace electron {
+
+// Saves power across the app while the device is on battery or under thermal
+// pressure, as configured once by powerMonitor.setPowerSavingPolicy().
+//
+// While power saving is active every WebContents caps the frame rate of
+// offscreen rendering and throttles its timers and rendering in the
+// background, whatever its own settings are. Both are restored once the
+// device is back on AC power and has cooled down.
+class PowerSavingPolicy : public base::PowerStateObserver,
+                          public base::PowerThermalObserver {
+ public:
+  struct Options {
+    // Conditions that each activate power saving.
+    bool on_battery = true;
+    DeviceThermalState thermal_state = DeviceThermalState::kSerious;
+    // Active while the OS limits the CPU speed below this percentage, never
+    // when zero.
+    int speed_limit = 0;
+
+    // Maximum frame rate of offscreen rendering, unlimited when zero.
+    int max_frame_rate = 0;
+    bool background_throttling = true;
+  };
+
+  using ChangeCallback = base::RepeatingCallback<void(bool active)>;
+
+  static PowerSavingPolicy* Get();
+
+  // Replaces the options, or disables power saving when |options| is empty.
+  // |on_change| runs with the new state right away and again on every
+  // change.
+  void SetOptions(std::optional<Options> options, ChangeCallback on_change);
+
+  bool is_active() const { return active_; }
+  // The frame rate cap that is in effect, zero when there is none.
+  int max_frame_rate() const { return active_ ? options_->max_frame_rate : 0; }
+  bool force_background_throttling() const {
+    return active_ && options_->background_throttling;
+  }
+
+  // disable copy
+  PowerSavingPolicy(const PowerSavingPolicy&) = delete;
+  PowerSavingPolicy& operator=(const PowerSavingPolicy&) = delete;
+
+ private:
+  PowerSavingPolicy();
+  ~PowerSavingPolicy() override;
+
+  // base::PowerStateObserver:
+  void OnPowerStateChange(bool on_battery_power) override;
+
+  // base::PowerThermalObserver:
+  void OnThermalStateChange(DeviceThermalState new_state) override;
+  void OnSpeedLimitChange(int speed_limit) override;
+
+  // Re-evaluates the conditions, and applies the result to every
+  // WebContents when it changed or when |force| is set.
+  void Update(bool force);
+
+  std::optional<Options> options_;
+  ChangeCallback on_change_;
+  bool active_ = false;
+
+  bool observing_ = false;
+  bool on_battery_ = false;
+  DeviceThermalState thermal_state_ = DeviceThermalState::kUnknown;
+  int speed_limit_ = kSpeedLimitMax;
+};
+
+}  // namespace electron
+
+#endif  // ELECTRON_SHELL_BROWSER_POWER_SAVING_POLICY_H_
@@ -9,6 +9,7 @@
 #include "electron/fuses.h"
 #include "shell/browser/electron_browser_context.h"
 #include "shell/browser/net/asar/asar_url_loader_factory.h"
+#include "shell/browser/net/directory_url_loader_factory.h"
 
 namespace electron {
 
@@ -46,6 +47,8 @@ void ProtocolRegistry::RegisterURLLoaderFactories(
     factories->emplace(it.first, ElectronURLLoaderFactory::Create(
                                      it.second.first, it.second.second));
   }
+  for (const auto& it : directories_)
+    factories->emplace(it.first, DirectoryURLLoaderFactory::Create(it.second));
 }
 
 mojo::PendingRemote<network::mojom::URLLoaderFactory>
@@ -56,11 +59,20 @@ ProtocolRegistry::CreateNonNetworkNavigationURLLoaderFactory(
       return AsarURLLoaderFactory::Create();
     }
   } else {
-    auto handler = handlers_.find(scheme);
-    if (handler != handlers_.end()) {
-      return ElectronURLLoaderFactory::Create(handler->second.first,
-                                              handler->second.second);
-    }
+    return CreateRegisteredURLLoaderFactory(scheme);
+  }
+  return {};
+}
+
+mojo::PendingRemote<network::mojom::URLLoaderFactory>
+ProtocolRegistry::CreateRegisteredURLLoaderFactory(const std::string& scheme) {
+  if (auto handler = handlers_.find(scheme); handler != handlers_.end()) {
+    return ElectronURLLoaderFactory::Create(handler->second.first,
+                                            handler->second.second);
+  }
+  if (auto directory = directories_.find(scheme);
+      directory != directories_.end()) {
+    return DirectoryURLLoaderFactory::Create(directory->second);
   }
   return {};
 }
@@ -68,15 +80,25 @@ ProtocolRegistry::CreateNonNetworkNavigationURLLoaderFactory(
 bool ProtocolRegistry::RegisterProtocol(ProtocolType type,
                                         const std::string& scheme,
                                         const ProtocolHandler& handler) {
+  if (base::Contains(directories_, scheme))
+    return false;
   return handlers_.try_emplace(scheme, type, handler).second;
 }
 
+bool ProtocolRegistry::RegisterDirectory(const std::string& scheme,
+                                         const base::FilePath& directory) {
+  if (base::Contains(handlers_, scheme))
+    return false;
+  return directories_.try_emplace(scheme, directory).second;
+}
+
 bool ProtocolRegistry::UnregisterProtocol(const std::string& scheme) {
-  return handlers_.erase(scheme) != 0;
+  return (handlers_.erase(scheme) + directories_.erase(scheme)) != 0;
 }
 
 bool ProtocolRegistry::IsProtocolRegistered(const std::string& scheme) {
-  return base::Contains(handlers_, scheme);
+  return base::Contains(handlers_, scheme) ||
+         base::Contains(directories_, scheme);
 }
 
 bool ProtocolRegistry::InterceptProtocol(ProtocolType type,
@@ -5,8 +5,10 @@
 #ifndef ELECTRON_SHELL_BROWSER_PROTOCOL_REGISTRY_H_
 #define ELECTRON_SHELL_BROWSER_PROTOCOL_REGISTRY_H_
 
+#include <map>
 #include <string>
 
+#include "base/files/file_path.h"
 #include "content/public/browser/content_browser_client.h"
 #include "shell/browser/net/electron_url_loader_factory.h"
 
@@ -32,12 +34,19 @@ class ProtocolRegistry {
   mojo::PendingRemote<network::mojom::URLLoaderFactory>
   CreateNonNetworkNavigationURLLoaderFactory(const std::string& scheme);
 
+  // Returns the factory of a scheme registered with |RegisterProtocol| or
+  // |RegisterDirectory|.
+  mojo::PendingRemote<network::mojom::URLLoaderFactory>
+  CreateRegisteredURLLoaderFactory(const std::string& scheme);
+
   const HandlersMap& intercept_handlers() const { return intercept_handlers_; }
   const HandlersMap& handlers() const { return handlers_; }
 
   bool RegisterProtocol(ProtocolType type,
                         const std::string& scheme,
                         const ProtocolHandler& handler);
+  bool RegisterDirectory(const std::string& scheme,
+                         const base::FilePath& directory);
   bool UnregisterProtocol(const std::string& scheme);
   bool IsProtocolRegistered(const std::string& scheme);
 
@@ -54,6 +63,8 @@ class ProtocolRegistry {
 
   HandlersMap handlers_;
   HandlersMap intercept_handlers_;
+  // scheme => directory served natively.
+  std::map<std::string, base::FilePath> directories_;
 };
 
 }  // namespace electron
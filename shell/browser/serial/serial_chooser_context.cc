@@ -9,6 +9,7 @@
 
 #include "base/base64.h"
 #include "base/containers/contains.h"
+#include "base/task/sequenced_task_runner.h"
 #include "base/strings/utf_string_conversions.h"
 #include "base/values.h"
 #include "content/public/browser/device_service.h"
@@ -209,6 +210,21 @@ device::mojom::SerialPortManager* SerialChooserContext::GetPortManager() {
   return port_manager_.get();
 }
 
+void SerialChooserContext::GetDevices(GetDevicesCallback callback) {
+  EnsurePortManagerConnection();
+  if (get_devices_pending_) {
+    pending_get_devices_requests_.push(std::move(callback));
+    return;
+  }
+
+  std::vector<device::mojom::SerialPortInfoPtr> ports;
+  ports.reserve(port_info_.size());
+  for (const auto& pair : port_info_)
+    ports.push_back(pair.second->Clone());
+  base::SequencedTaskRunner::GetCurrentDefault()->PostTask(
+      FROM_HERE, base::BindOnce(std::move(callback), std::move(ports)));
+}
+
 void SerialChooserContext::AddPortObserver(PortObserver* observer) {
   port_observer_list_.AddObserver(observer);
 }
@@ -260,6 +276,7 @@ void SerialChooserContext::SetUpPortManagerConnection(
                      base::Unretained(this)));
 
   port_manager_->SetClient(client_receiver_.BindNewPipeAndPassRemote());
+  get_devices_pending_ = true;
   port_manager_->GetDevices(base::BindOnce(&SerialChooserContext::OnGetDevices,
                                            weak_factory_.GetWeakPtr()));
 }
@@ -269,6 +286,16 @@ void SerialChooserContext::OnGetDevices(
   for (auto& port : ports)
     port_info_.insert({port->token, std::move(port)});
   is_initialized_ = true;
+  get_devices_pending_ = false;
+
+  while (!pending_get_devices_requests_.empty()) {
+    std::vector<device::mojom::SerialPortInfoPtr> port_list;
+    port_list.reserve(port_info_.size());
+    for (const auto& pair : port_info_)
+      port_list.push_back(pair.second->Clone());
+    std::move(pending_get_devices_requests_.front()).Run(std::move(port_list));
+    pending_get_devices_requests_.pop();
+  }
 }
 
 void SerialChooserContext::OnPortManagerConnectionError() {
@@ -277,5 +304,14 @@ void SerialChooserContext::OnPortManagerConnectionError() {
 
   port_info_.clear();
   ephemeral_ports_.clear();
+
+  // The reply to GetDevices() will never come, there are no ports to report.
+  get_devices_pending_ = false;
+  base::queue<GetDevicesCallback> requests =
+      std::exchange(pending_get_devices_requests_, {});
+  while (!requests.empty()) {
+    std::move(requests.front()).Run({});
+    requests.pop();
+  }
 }
 }  // namespace electron
@@ -9,6 +9,8 @@
 #include <set>
 #include <vector>
 
+#include "base/containers/queue.h"
+#include "base/functional/callback.h"
 #include "base/memory/raw_ptr.h"
 #include "base/memory/weak_ptr.h"
 #include "base/observer_list.h"
@@ -79,6 +81,12 @@ class SerialChooserContext : public KeyedService,
 
   device::mojom::SerialPortManager* GetPortManager();
 
+  // Returns the ports known to this context, querying the port manager only
+  // until the initial enumeration has completed.
+  using GetDevicesCallback =
+      base::OnceCallback<void(std::vector<device::mojom::SerialPortInfoPtr>)>;
+  void GetDevices(GetDevicesCallback callback);
+
   void AddPortObserver(PortObserver* observer);
   void RemovePortObserver(PortObserver* observer);
 
@@ -97,7 +105,13 @@ class SerialChooserContext : public KeyedService,
   void OnGetDevices(std::vector<device::mojom::SerialPortInfoPtr> ports);
   void OnPortManagerConnectionError();
 
+  // Set once the first list of ports has been received. It stays set when the
+  // port manager goes away, |port_info_| is then empty until it reconnects.
   bool is_initialized_ = false;
+  // Whether the port manager has been asked for the list of ports and hasn't
+  // replied yet. GetDevices() requests wait for the reply.
+  bool get_devices_pending_ = false;
+  base::queue<GetDevicesCallback> pending_get_devices_requests_;
 
   // Tracks the set of ports to which an origin has access to.
   std::map<url::Origin, std::set<base::UnguessableToken>> ephemeral_ports_;
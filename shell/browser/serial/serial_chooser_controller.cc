@@ -121,7 +121,7 @@ SerialChooserController::SerialChooserController(
                          web_contents->GetBrowserContext())
                          ->AsWeakPtr();
   DCHECK(chooser_context_);
-  chooser_context_->GetPortManager()->GetDevices(base::BindOnce(
+  chooser_context_->GetDevices(base::BindOnce(
       &SerialChooserController::OnGetDevices, weak_factory_.GetWeakPtr()));
   observation_.Observe(chooser_context_.get());
 }
@@ -191,17 +191,17 @@ void SerialChooserController::OnDeviceChosen(const std::string& port_id) {
 
 void SerialChooserController::OnGetDevices(
     std::vector<device::mojom::SerialPortInfoPtr> ports) {
-  // Sort ports by file paths.
-  std::sort(ports.begin(), ports.end(),
-            [](const auto& port1, const auto& port2) {
-              return port1->path.BaseName() < port2->path.BaseName();
-            });
-
   for (auto& port : ports) {
     if (DisplayDevice(*port))
       ports_.push_back(std::move(port));
   }
 
+  // Sort ports by file paths.
+  std::sort(ports_.begin(), ports_.end(),
+            [](const auto& port1, const auto& port2) {
+              return port1->path.BaseName() < port2->path.BaseName();
+            });
+
   bool prevent_default = false;
   api::Session* session = GetSession();
   if (session) {
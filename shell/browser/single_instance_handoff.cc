@@ -0,0 +1,208 @@
+// Copyright (c) 2024 Microsoft, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#include "shell/browser/single_instance_handoff.h"
+
+#include <vector>
+
+#include "base/base_paths.h"
+#include "base/command_line.h"
+#include "base/containers/span.h"
+#include "base/environment.h"
+#include "base/files/file.h"
+#include "base/files/file_path.h"
+#include "base/files/file_util.h"
+#include "base/functional/bind.h"
+#include "base/hash/hash.h"
+#include "base/path_service.h"
+#include "base/posix/eintr_wrapper.h"
+#include "base/strings/strcat.h"
+#include "base/strings/string_number_conversions.h"
+#include "base/strings/string_split.h"
+#include "base/threading/thread_restrictions.h"
+#include "build/build_config.h"
+#include "chrome/browser/process_singleton.h"
+#include "chrome/common/chrome_switches.h"
+#include "shell/common/electron_paths.h"
+
+#if BUILDFLAG(IS_POSIX)
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#if BUILDFLAG(IS_MAC)
+#include "shell/common/mac/main_application_bundle.h"
+#endif
+
+#if BUILDFLAG(IS_WIN)
+#include "shell/app/command_line_args.h"
+#endif
+
+namespace electron::single_instance_handoff {
+
+namespace {
+
+constexpr size_t kMaxRecordSize = 4096;
+
+bool g_recorded = false;
+
+// The record lives in a directory only the current user can write to, so
+// another user can't plant a record that redirects the command line, e.g.
+// $XDG_RUNTIME_DIR or the parent of the default user data directory.
+base::FilePath GetRecordDir() {
+#if BUILDFLAG(IS_LINUX)
+  auto env = base::Environment::Create();
+  std::string runtime_dir;
+  if (env->GetVar("XDG_RUNTIME_DIR", &runtime_dir) && !runtime_dir.empty())
+    return base::FilePath(runtime_dir);
+#endif
+  base::FilePath app_data_dir;
+  if (!base::PathService::Get(DIR_APP_DATA, &app_data_dir))
+    return {};
+  return app_data_dir;
+}
+
+// Instances of the same executable share the record, other apps don't.
+base::FilePath GetRecordPath() {
+  base::FilePath exe_path;
+  base::FilePath record_dir = GetRecordDir();
+  if (record_dir.empty() ||
+      !base::PathService::Get(base::FILE_EXE, &exe_path)) {
+    return {};
+  }
+  return record_dir.AppendASCII(base::StrCat(
+      {".electron-single-instance-",
+       base::NumberToString(base::PersistentHash(exe_path.AsUTF8Unsafe()))}));
+}
+
+// Creates the record, failing rather than following a link or writing into
+// a file that someone else created.
+bool WriteRecord(const base::FilePath& path, const std::string& contents) {
+  // A record left behind by an instance that crashed is replaced.
+  base::DeleteFile(path);
+#if BUILDFLAG(IS_POSIX)
+  base::File file(HANDLE_EINTR(open(path.value().c_str(),
+                                    O_WRONLY | O_CREAT | O_EXCL | O_NOFOLLOW |
+                                        O_CLOEXEC,
+                                    S_IRUSR | S_IWUSR)));
+#else
+  base::File file(path, base::File::FLAG_CREATE | base::File::FLAG_WRITE);
+#endif
+  if (!file.IsValid())
+    return false;
+  if (file.WriteAtCurrentPosAndCheck(base::as_byte_span(contents)))
+    return true;
+  file.Close();
+  base::DeleteFile(path);
+  return false;
+}
+
+// Apps run by the default app, e.g. with `electron .`, share the executable
+// with every other app run that way.
+bool IsPackagedApp() {
+#if BUILDFLAG(IS_MAC)
+  base::FilePath resources_path =
+      electron::MainApplicationBundlePath().Append("Contents").Append(
+          "Resources");
+#else
+  base::FilePath exe_path;
+  if (!base::PathService::Get(base::FILE_EXE, &exe_path))
+    return false;
+  base::FilePath resources_path =
+      exe_path.DirName().Append(FILE_PATH_LITERAL("resources"));
+#endif
+  return base::PathExists(
+             resources_path.Append(FILE_PATH_LITERAL("app.asar"))) ||
+         base::PathExists(resources_path.Append(FILE_PATH_LITERAL("app")));
+}
+
+// Only trust a record that was written by the user running this process and
+// is not a link to somewhere else.
+bool IsOwnedByCurrentUser(const base::FilePath& path) {
+#if BUILDFLAG(IS_POSIX)
+  struct stat info;
+  return lstat(path.value().c_str(), &info) == 0 && S_ISREG(info.st_mode) &&
+         info.st_uid == geteuid();
+#else
+  return true;
+#endif
+}
+
+bool IgnoreNotification(base::CommandLine command_line,
+                        const base::FilePath& current_directory,
+                        const std::vector<uint8_t> additional_data) {
+  return false;
+}
+
+}  // namespace
+
+void Record(const std::string& program_name,
+            const base::FilePath& user_data_dir) {
+  base::ScopedAllowBlocking allow_blocking;
+  base::FilePath path = GetRecordPath();
+  if (path.empty() || !IsPackagedApp())
+    return;
+  g_recorded = WriteRecord(
+      path, base::StrCat({program_name, "\n", user_data_dir.AsUTF8Unsafe()}));
+}
+
+void Clear() {
+  if (!g_recorded)
+    return;
+  g_recorded = false;
+  base::FilePath path = GetRecordPath();
+  if (path.empty())
+    return;
+  base::ScopedAllowBlocking allow_blocking;
+  base::DeleteFile(path);
+}
+
+bool NotifyRecordedInstance() {
+  // An instance started for another user data directory is meant to run
+  // alongside the recorded one.
+  if (base::CommandLine::ForCurrentProcess()->HasSwitch(
+          ::switches::kUserDataDir)) {
+    return false;
+  }
+
+  base::FilePath path = GetRecordPath();
+  std::string contents;
+  if (path.empty() || !IsOwnedByCurrentUser(path) ||
+      !base::ReadFileToStringWithMaxSize(path, &contents, kMaxRecordSize)) {
+    return false;
+  }
+  std::vector<std::string> fields = base::SplitString(
+      contents, "\n", base::KEEP_WHITESPACE, base::SPLIT_WANT_ALL);
+  if (fields.size() != 2 || fields[1].empty())
+    return false;
+  base::FilePath user_data_dir = base::FilePath::FromUTF8Unsafe(fields[1]);
+
+  // Without additional data the first instance gets the same event as when
+  // app.requestSingleInstanceLock() is called without arguments.
+#if BUILDFLAG(IS_WIN)
+  ProcessSingleton singleton(
+      fields[0], user_data_dir, {},
+      IsSandboxEnabled(base::CommandLine::ForCurrentProcess()),
+      base::BindRepeating(&IgnoreNotification));
+#else
+  ProcessSingleton singleton(user_data_dir, {},
+                             base::BindRepeating(&IgnoreNotification));
+#endif
+
+  switch (singleton.NotifyOtherProcessOrCreate()) {
+    case ProcessSingleton::NotifyResult::PROCESS_NOTIFIED:
+      return true;
+    case ProcessSingleton::NotifyResult::PROCESS_NONE:
+      // The recorded instance is gone, release the lock again so that the
+      // app can take it the usual way.
+      singleton.Cleanup();
+      return false;
+    case ProcessSingleton::NotifyResult::LOCK_ERROR:
+    case ProcessSingleton::NotifyResult::PROFILE_IN_USE:
+      return false;
+  }
+}
+
+}  // namespace electron::single_instance_handoff
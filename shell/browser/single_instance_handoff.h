@@ -0,0 +1,39 @@
+// Copyright (c) 2024 Microsoft, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#ifndef ELECTRON_SHELL_BROWSER_SINGLE_INSTANCE_HANDOFF_H_
+#define ELECTRON_SHELL_BROWSER_SINGLE_INSTANCE_HANDOFF_H_
+
+#include <string>
+
+namespace base {
+class FilePath;
+}
+
+// Lets a second instance hand its command line to the first one right at
+// startup, before resources, ICU and V8 are loaded.
+//
+// The single instance lock lives in the user data directory, which the app
+// may only settle on from JavaScript. The first instance therefore records
+// where its lock is in a file keyed on the path of the executable, and a new
+// instance that finds the file notifies the lock holder without waiting for
+// app.requestSingleInstanceLock().
+namespace electron::single_instance_handoff {
+
+// Records the lock of this instance, so later instances find it early. Does
+// nothing unless the app is packaged with the executable.
+void Record(const std::string& program_name,
+            const base::FilePath& user_data_dir);
+
+// Removes the record, if this instance made it.
+void Clear();
+
+// Tries to pass the command line of this process to the instance that
+// recorded its lock. Returns true if that instance handled it, in which case
+// this process should exit.
+bool NotifyRecordedInstance();
+
+}  // namespace electron::single_instance_handoff
+
+#endif  // ELECTRON_SHELL_BROWSER_SINGLE_INSTANCE_HANDOFF_H_
@@ -0,0 +1,85 @@
+// Copyright (c) 2024 Microsoft, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#include "shell/browser/startup_timeline.h"
+
+#include <array>
+
+#include "base/no_destructor.h"
+#include "base/process/process.h"
+#include "base/trace_event/trace_event.h"
+
+namespace electron::startup_timeline {
+
+namespace {
+
+constexpr size_t kPhaseCount = static_cast<size_t>(Phase::kMaxValue) + 1;
+
+struct Timeline {
+  Timeline() {
+    // Converted as early as possible, the clocks can drift apart.
+    const base::Time creation_time = base::Process::Current().CreationTime();
+    if (!creation_time.is_null()) {
+      process_start_time =
+          base::TimeTicks::Now() - (base::Time::Now() - creation_time);
+    }
+  }
+
+  std::optional<base::TimeTicks> process_start_time;
+  std::array<bool, kPhaseCount> recorded = {};
+  std::vector<Entry> entries;
+};
+
+Timeline& GetTimeline() {
+  static base::NoDestructor<Timeline> timeline;
+  return *timeline;
+}
+
+}  // namespace
+
+void Record(Phase phase) {
+  Timeline& timeline = GetTimeline();
+  const auto index = static_cast<size_t>(phase);
+  if (timeline.recorded[index])
+    return;
+  timeline.recorded[index] = true;
+
+  const base::TimeTicks now = base::TimeTicks::Now();
+  timeline.entries.push_back({phase, now});
+  TRACE_EVENT_INSTANT_WITH_TIMESTAMP0("startup", GetPhaseName(phase),
+                                      TRACE_EVENT_SCOPE_PROCESS, now);
+}
+
+std::vector<Entry> GetEntries() {
+  return GetTimeline().entries;
+}
+
+std::optional<base::TimeTicks> GetProcessStartTime() {
+  return GetTimeline().process_start_time;
+}
+
+const char* GetPhaseName(Phase phase) {
+  switch (phase) {
+    case Phase::kBasicStartupComplete:
+      return "basic-startup-complete";
+    case Phase::kPreEarlyInitialization:
+      return "pre-early-initialization";
+    case Phase::kNodeEnvironmentCreated:
+      return "node-environment-created";
+    case Phase::kAppCodeLoaded:
+      return "app-code-loaded";
+    case Phase::kPostEarlyInitialization:
+      return "post-early-initialization";
+    case Phase::kPreCreateThreads:
+      return "pre-create-threads";
+    case Phase::kPreMainMessageLoopRun:
+      return "pre-main-message-loop-run";
+    case Phase::kFirstWindowPaint:
+      return "first-window-paint";
+    case Phase::kFirstWindowLoad:
+      return "first-window-load";
+  }
+}
+
+}  // namespace electron::startup_timeline
@@ -0,0 +1,49 @@
+// Copyright (c) 2024 Microsoft, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#ifndef ELECTRON_SHELL_BROWSER_STARTUP_TIMELINE_H_
+#define ELECTRON_SHELL_BROWSER_STARTUP_TIMELINE_H_
+
+#include <optional>
+#include <vector>
+
+#include "base/time/time.h"
+
+// Records when the browser process reaches each phase of its startup, so
+// that it can be read back by the app and shows up in startup traces.
+namespace electron::startup_timeline {
+
+enum class Phase {
+  kBasicStartupComplete,
+  kPreEarlyInitialization,
+  kNodeEnvironmentCreated,
+  kAppCodeLoaded,
+  kPostEarlyInitialization,
+  kPreCreateThreads,
+  kPreMainMessageLoopRun,
+  kFirstWindowPaint,
+  kFirstWindowLoad,
+  kMaxValue = kFirstWindowLoad,
+};
+
+struct Entry {
+  Phase phase;
+  base::TimeTicks time;
+};
+
+// Records that |phase| has been reached, later calls for the same phase
+// are ignored. Must be called on the browser process's main thread.
+void Record(Phase phase);
+
+// The recorded phases, in the order they were reached.
+std::vector<Entry> GetEntries();
+
+// When the process was launched, if the platform can tell.
+std::optional<base::TimeTicks> GetProcessStartTime();
+
+const char* GetPhaseName(Phase phase);
+
+}  // namespace electron::startup_timeline
+
+#endif  // ELECTRON_SHELL_BROWSER_STARTUP_TIMELINE_H_
@@ -9,7 +9,9 @@
 #include <string>
 #include <vector>
 
+#include "base/containers/lru_cache.h"
 #include "base/logging.h"
+#include "base/no_destructor.h"
 #include "base/stl_util.h"
 #include "base/strings/string_split.h"
 #include "base/strings/string_util.h"
@@ -17,8 +19,21 @@
 
 namespace accelerator_util {
 
-bool StringToAccelerator(const std::string& shortcut,
-                         ui::Accelerator* accelerator) {
+namespace {
+
+// Apps tend to register the same handful of accelerators over and over, e.g.
+// when switching between sets of global shortcuts, so recently parsed strings
+// are remembered.
+constexpr size_t kParsedAcceleratorCacheSize = 256;
+
+base::HashingLRUCache<std::string, ui::Accelerator>& GetParsedAccelerators() {
+  static base::NoDestructor<base::HashingLRUCache<std::string, ui::Accelerator>>
+      cache(kParsedAcceleratorCacheSize);
+  return *cache;
+}
+
+bool ParseAccelerator(const std::string& shortcut,
+                      ui::Accelerator* accelerator) {
   if (!base::IsStringASCII(shortcut)) {
     LOG(ERROR) << "The accelerator string can only contain ASCII characters, "
                   "invalid string: "
@@ -71,6 +86,23 @@ bool StringToAccelerator(const std::string& shortcut,
   return true;
 }
 
+}  // namespace
+
+bool StringToAccelerator(const std::string& shortcut,
+                         ui::Accelerator* accelerator) {
+  auto& cache = GetParsedAccelerators();
+  auto it = cache.Get(shortcut);
+  if (it != cache.end()) {
+    *accelerator = it->second;
+    return true;
+  }
+
+  if (!ParseAccelerator(shortcut, accelerator))
+    return false;
+  cache.Put(shortcut, *accelerator);
+  return true;
+}
+
 void GenerateAcceleratorTable(AcceleratorTable* table,
                               electron::ElectronMenuModel* model) {
   size_t count = model->GetItemCount();
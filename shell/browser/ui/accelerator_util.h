@@ -20,7 +20,7 @@ typedef struct {
 } MenuItem;
 typedef std::map<ui::Accelerator, MenuItem> AcceleratorTable;
 
-// Parse a string as an accelerator.
+// Parse a string as an accelerator. Must be called on the UI thread.
 bool StringToAccelerator(const std::string& shortcut,
                          ui::Accelerator* accelerator);
 
@@ -27,4 +27,19 @@ TEST(AcceleratorUtilTest, StringToAccelerator) {
   }
 }
 
+TEST(AcceleratorUtilTest, StringToAcceleratorCached) {
+  ui::Accelerator first;
+  ASSERT_TRUE(StringToAccelerator("Ctrl+Shift+K", &first));
+  ui::Accelerator second;
+  ASSERT_TRUE(StringToAccelerator("Ctrl+Shift+K", &second));
+  EXPECT_EQ(first, second);
+  EXPECT_EQ(ui::VKEY_K, second.key_code());
+  EXPECT_EQ(ui::EF_CONTROL_DOWN | ui::EF_SHIFT_DOWN, second.modifiers());
+
+  // Invalid strings are not cached as valid accelerators.
+  ui::Accelerator invalid;
+  EXPECT_FALSE(StringToAccelerator("CmdOrCtrl", &invalid));
+  EXPECT_FALSE(StringToAccelerator("CmdOrCtrl", &invalid));
+}
+
 }  // namespace accelerator_util
@@ -206,7 +206,16 @@ void AutofillPopup::CreateView(content::RenderFrameHost* frame_host,
   view_->Show();
 }
 
+bool AutofillPopup::IsShowingFor(content::RenderFrameHost* frame_host,
+                                 views::View* parent,
+                                 const gfx::RectF& bounds) const {
+  return view_ && view_->GetWidget() && frame_host_ == frame_host &&
+         parent_ == parent && element_bounds_ == gfx::ToEnclosedRect(bounds);
+}
+
 void AutofillPopup::Hide() {
+  value_widths_.clear();
+  label_widths_.clear();
   if (parent_) {
     parent_->RemoveObserver(this);
     parent_ = nullptr;
@@ -220,6 +229,10 @@ void AutofillPopup::Hide() {
 void AutofillPopup::SetItems(const std::vector<std::u16string>& values,
                              const std::vector<std::u16string>& labels) {
   DCHECK(view_);
+  // Typing often leaves the suggestions unchanged, e.g. when none match.
+  if (view_->GetWidget() && values == values_ && labels == labels_)
+    return;
+
   values_ = values;
   labels_ = labels;
   UpdatePopupBounds();
@@ -265,7 +278,7 @@ void AutofillPopup::OnViewIsDeleting(views::View* view) {
 }
 
 int AutofillPopup::GetDesiredPopupHeight() {
-  return 2 * kPopupBorderThickness + values_.size() * kRowHeight;
+  return 2 * kPopupBorderThickness + visible_line_count() * kRowHeight;
 }
 
 int AutofillPopup::GetDesiredPopupWidth() {
@@ -273,8 +286,7 @@ int AutofillPopup::GetDesiredPopupWidth() {
 
   for (size_t i = 0; i < values_.size(); ++i) {
     int row_size = kEndPadding + 2 * kPopupBorderThickness +
-                   gfx::GetStringWidth(value_at(i), GetValueFontListForRow(i)) +
-                   gfx::GetStringWidth(label_at(i), GetLabelFontListForRow(i));
+                   GetValueWidth(i) + GetLabelWidth(i);
     if (!label_at(i).empty())
       row_size += kNamePadding + kEndPadding;
 
@@ -284,8 +296,24 @@ int AutofillPopup::GetDesiredPopupWidth() {
   return popup_width;
 }
 
-gfx::Rect AutofillPopup::GetRowBounds(int index) {
-  int top = kPopupBorderThickness + index * kRowHeight;
+int AutofillPopup::GetValueWidth(int index) {
+  auto [it, inserted] = value_widths_.try_emplace(value_at(index), 0);
+  if (inserted)
+    it->second = gfx::GetStringWidth(it->first, GetValueFontListForRow(index));
+  return it->second;
+}
+
+int AutofillPopup::GetLabelWidth(int index) {
+  if (label_at(index).empty())
+    return 0;
+  auto [it, inserted] = label_widths_.try_emplace(label_at(index), 0);
+  if (inserted)
+    it->second = gfx::GetStringWidth(it->first, GetLabelFontListForRow(index));
+  return it->second;
+}
+
+gfx::Rect AutofillPopup::GetRowBounds(int slot) {
+  int top = kPopupBorderThickness + slot * kRowHeight;
 
   return gfx::Rect(kPopupBorderThickness, top,
                    popup_bounds_.width() - 2 * kPopupBorderThickness,
@@ -306,17 +334,13 @@ ui::ColorId AutofillPopup::GetBackgroundColorIDForRow(int index) const {
              : ui::kColorResultsTableNormalBackground;
 }
 
-int AutofillPopup::LineFromY(int y) const {
-  int current_height = kPopupBorderThickness;
-
-  for (size_t i = 0; i < values_.size(); ++i) {
-    current_height += kRowHeight;
-
-    if (y <= current_height)
-      return i;
-  }
+int AutofillPopup::visible_line_count() const {
+  return std::min(line_count(), kMaxVisibleRows);
+}
 
-  return values_.size() - 1;
+int AutofillPopup::LineFromY(int y) const {
+  int slot = std::max(0, y - kPopupBorderThickness) / kRowHeight;
+  return std::min(slot, visible_line_count() - 1);
 }
 
 }  // namespace electron
@@ -5,11 +5,13 @@
 #ifndef ELECTRON_SHELL_BROWSER_UI_AUTOFILL_POPUP_H_
 #define ELECTRON_SHELL_BROWSER_UI_AUTOFILL_POPUP_H_
 
+#include <string>
 #include <vector>
 
 #include "base/memory/raw_ptr.h"
 #include "content/public/browser/render_frame_host.h"
 #include "shell/browser/ui/views/autofill_popup_view.h"
+#include "third_party/abseil-cpp/absl/container/flat_hash_map.h"
 #include "ui/color/color_id.h"
 #include "ui/gfx/font_list.h"
 #include "ui/views/view.h"
@@ -35,6 +37,12 @@ class AutofillPopup : public views::ViewObserver {
                   const gfx::RectF& bounds);
   void Hide();
 
+  // Whether the popup is showing for the element at |bounds| in |frame_host|,
+  // in which case it can be updated with SetItems() instead of recreated.
+  bool IsShowingFor(content::RenderFrameHost* frame_host,
+                    views::View* parent,
+                    const gfx::RectF& bounds) const;
+
   void SetItems(const std::vector<std::u16string>& values,
                 const std::vector<std::u16string>& labels);
   void UpdatePopupBounds();
@@ -52,14 +60,20 @@ class AutofillPopup : public views::ViewObserver {
 
   int GetDesiredPopupHeight();
   int GetDesiredPopupWidth();
-  gfx::Rect GetRowBounds(int i);
+  // Bounds of the |slot|-th visible row.
+  gfx::Rect GetRowBounds(int slot);
+  int GetValueWidth(int index);
+  int GetLabelWidth(int index);
   const gfx::FontList& GetValueFontListForRow(int index) const;
   const gfx::FontList& GetLabelFontListForRow(int index) const;
   ui::ColorId GetBackgroundColorIDForRow(int index) const;
 
   int line_count() const { return values_.size(); }
+  // Only this many rows are laid out, the others are scrolled into view.
+  int visible_line_count() const;
   const std::u16string& value_at(int i) const { return values_.at(i); }
   const std::u16string& label_at(int i) const { return labels_.at(i); }
+  // The visible row at |y|.
   int LineFromY(int y) const;
 
   int selected_index_;
@@ -74,6 +88,11 @@ class AutofillPopup : public views::ViewObserver {
   std::vector<std::u16string> values_;
   std::vector<std::u16string> labels_;
 
+  // Measured text widths, so that a suggestion that stays in the list while
+  // the user types is not measured again.
+  absl::flat_hash_map<std::u16string, int> value_widths_;
+  absl::flat_hash_map<std::u16string, int> label_widths_;
+
   // Font lists for the suggestions
   gfx::FontList smaller_font_list_;
   gfx::FontList bold_font_list_;
@@ -30,6 +30,9 @@ class ElectronMenuModel;
   NSMenu* __strong recentDocumentsMenuSwap_;
   BOOL isMenuOpen_;
   BOOL useDefaultAccelerator_;
+  // Submenus that are filled in when they are about to be shown, mapped to
+  // the model and version they were last built from.
+  NSMapTable* __strong lazySubmenus_;
   base::OnceClosure closeCallback;
 }
 
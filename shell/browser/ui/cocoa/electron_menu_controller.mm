@@ -151,6 +151,34 @@ NSArray* ConvertSharingItemToNS(const SharingItem& item) {
 
 @end
 
+// The model a lazily populated submenu is built from, and the version of that
+// model its items reflect.
+@interface ElectronLazySubmenuState : NSObject
++ (instancetype)stateForModel:(electron::ElectronMenuModel*)model;
+- (electron::ElectronMenuModel*)menuModel;
+@property(nonatomic, assign) BOOL built;
+@property(nonatomic, assign) uint64_t builtVersion;
+@end
+
+@implementation ElectronLazySubmenuState {
+  base::WeakPtr<electron::ElectronMenuModel> _model;
+}
+
+@synthesize built;
+@synthesize builtVersion;
+
++ (instancetype)stateForModel:(electron::ElectronMenuModel*)model {
+  ElectronLazySubmenuState* state = [[ElectronLazySubmenuState alloc] init];
+  state->_model = model->GetWeakPtr();
+  return state;
+}
+
+- (electron::ElectronMenuModel*)menuModel {
+  return _model.get();
+}
+
+@end
+
 @implementation ElectronMenuController
 
 - (electron::ElectronMenuModel*)model {
@@ -167,6 +195,11 @@ NSArray* ConvertSharingItemToNS(const SharingItem& item) {
     model_ = model->GetWeakPtr();
     isMenuOpen_ = NO;
     useDefaultAccelerator_ = use;
+    // The application menu has to be complete up front so that the key
+    // equivalents of its items work without opening it, other menus only
+    // build their submenus once they are shown.
+    if (!use)
+      lazySubmenus_ = [NSMapTable weakToStrongObjectsMapTable];
     [self menu];
   }
   return self;
@@ -174,6 +207,8 @@ NSArray* ConvertSharingItemToNS(const SharingItem& item) {
 
 - (void)dealloc {
   [menu_ setDelegate:nil];
+  for (NSMenu* submenu in lazySubmenus_)
+    [submenu setDelegate:nil];
 
   // Close the menu if it is still open. This could happen if a tab gets closed
   // while its context menu is still open.
@@ -201,6 +236,7 @@ NSArray* ConvertSharingItemToNS(const SharingItem& item) {
 
   model_ = model->GetWeakPtr();
   [menu_ removeAllItems];
+  [lazySubmenus_ removeAllObjects];
 
   const int count = model->GetItemCount();
   for (int index = 0; index < count; index++) {
@@ -357,9 +393,20 @@ NSArray* ConvertSharingItemToNS(const SharingItem& item) {
     electron::ElectronMenuModel* submenuModel =
         static_cast<electron::ElectronMenuModel*>(
             model->GetSubmenuModelAt(index));
-    NSMenu* submenu = MenuHasVisibleItems(submenuModel)
-                          ? [self menuFromModel:submenuModel]
-                          : MakeEmptySubmenu();
+    NSMenu* submenu;
+    if (lazySubmenus_ && role != u"window" && role != u"windowmenu" &&
+        role != u"help" && role != u"recentdocuments") {
+      // Items are added in menuNeedsUpdate: right before it is shown.
+      submenu = [[NSMenu alloc] initWithTitle:@""];
+      [submenu setDelegate:self];
+      [lazySubmenus_
+          setObject:[ElectronLazySubmenuState stateForModel:submenuModel]
+             forKey:submenu];
+    } else {
+      submenu = MenuHasVisibleItems(submenuModel)
+                    ? [self menuFromModel:submenuModel]
+                    : MakeEmptySubmenu();
+    }
     [submenu setTitle:[item title]];
     [item setSubmenu:submenu];
 
@@ -509,13 +556,43 @@ NSArray* ConvertSharingItemToNS(const SharingItem& item) {
   return isMenuOpen_;
 }
 
+- (void)menuNeedsUpdate:(NSMenu*)menu {
+  ElectronLazySubmenuState* state = [lazySubmenus_ objectForKey:menu];
+  if (!state)
+    return;
+  electron::ElectronMenuModel* model = [state menuModel];
+  if (!model || ([state built] && [state builtVersion] == model->version()))
+    return;
+
+  [menu removeAllItems];
+  if (MenuHasVisibleItems(model)) {
+    const int count = model->GetItemCount();
+    for (int index = 0; index < count; index++) {
+      if (model->GetTypeAt(index) ==
+          electron::ElectronMenuModel::TYPE_SEPARATOR)
+        [self addSeparatorToMenu:menu atIndex:index];
+      else
+        [self addItemToMenu:menu atIndex:index fromModel:model];
+    }
+  } else {
+    [self moveMenuItems:MakeEmptySubmenu() to:menu];
+  }
+  [state setBuilt:YES];
+  [state setBuiltVersion:model->version()];
+}
+
 - (void)menuWillOpen:(NSMenu*)menu {
+  // Lazily populated submenus share this delegate.
+  if (menu != menu_)
+    return;
   isMenuOpen_ = YES;
   if (model_)
     model_->MenuWillShow();
 }
 
 - (void)menuDidClose:(NSMenu*)menu {
+  if (menu != menu_)
+    return;
   if (isMenuOpen_) {
     isMenuOpen_ = NO;
     if (model_)
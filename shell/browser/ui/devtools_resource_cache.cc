@@ -0,0 +1,130 @@
+// Copyright (c) 2024 Microsoft, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#include "shell/browser/ui/devtools_resource_cache.h"
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include "base/files/file_enumerator.h"
+#include "base/files/file_util.h"
+#include "base/files/important_file_writer.h"
+#include "base/functional/bind.h"
+#include "base/no_destructor.h"
+#include "base/strings/strcat.h"
+#include "base/strings/string_number_conversions.h"
+#include "base/strings/string_util.h"
+#include "base/task/sequenced_task_runner.h"
+#include "base/task/thread_pool.h"
+#include "crypto/sha2.h"
+#include "url/gurl.h"
+
+namespace electron::devtools_resource_cache {
+
+namespace {
+
+constexpr size_t kMaxETagSize = 1024;
+constexpr int64_t kMaxCacheSize = 256 * 1024 * 1024;
+
+// All caches are accessed on one sequence so that a lookup never sees an
+// entry that is still being written.
+scoped_refptr<base::SequencedTaskRunner> GetTaskRunner() {
+  static base::NoDestructor<scoped_refptr<base::SequencedTaskRunner>>
+      task_runner(base::ThreadPool::CreateSequencedTaskRunner(
+          {base::MayBlock(), base::TaskPriority::USER_VISIBLE,
+           base::TaskShutdownBehavior::SKIP_ON_SHUTDOWN}));
+  return *task_runner;
+}
+
+base::FilePath GetEntryPath(const base::FilePath& dir, const GURL& url) {
+  return dir.AppendASCII(
+      base::HexEncode(crypto::SHA256HashString(url.spec())));
+}
+
+// An entry is its ETag on the first line followed by the body.
+std::optional<Entry> ReadEntry(const base::FilePath& path) {
+  std::string contents;
+  if (!base::ReadFileToStringWithMaxSize(path, &contents,
+                                         kMaxEntrySize + kMaxETagSize + 1))
+    return std::nullopt;
+  const size_t newline = contents.find('\n');
+  if (newline == std::string::npos)
+    return std::nullopt;
+
+  // Marks the entry as recently used.
+  const base::Time now = base::Time::Now();
+  base::TouchFile(path, now, now);
+
+  Entry entry;
+  entry.etag = contents.substr(0, newline);
+  entry.body = contents.substr(newline + 1);
+  return entry;
+}
+
+void EvictEntries(const base::FilePath& dir) {
+  struct FileInfo {
+    base::FilePath path;
+    int64_t size;
+    base::Time last_modified;
+  };
+  std::vector<FileInfo> files;
+  int64_t total_size = 0;
+  base::FileEnumerator enumerator(dir, false, base::FileEnumerator::FILES);
+  for (base::FilePath path = enumerator.Next(); !path.empty();
+       path = enumerator.Next()) {
+    const base::FileEnumerator::FileInfo info = enumerator.GetInfo();
+    files.push_back({path, info.GetSize(), info.GetLastModifiedTime()});
+    total_size += info.GetSize();
+  }
+  if (total_size <= kMaxCacheSize)
+    return;
+
+  std::sort(files.begin(), files.end(),
+            [](const FileInfo& a, const FileInfo& b) {
+              return a.last_modified < b.last_modified;
+            });
+  for (const FileInfo& file : files) {
+    if (total_size <= kMaxCacheSize)
+      break;
+    if (base::DeleteFile(file.path))
+      total_size -= file.size;
+  }
+}
+
+void WriteEntry(const base::FilePath& dir, const GURL& url, Entry entry) {
+  if (!base::CreateDirectory(dir))
+    return;
+  // Written atomically so that a crash never leaves a truncated body behind.
+  base::ImportantFileWriter::WriteFileAtomically(
+      GetEntryPath(dir, url), base::StrCat({entry.etag, "\n", entry.body}));
+  EvictEntries(dir);
+}
+
+}  // namespace
+
+bool IsCacheable(const GURL& url) {
+  return url.SchemeIsHTTPOrHTTPS() &&
+         base::EndsWith(url.path_piece(), ".map",
+                        base::CompareCase::INSENSITIVE_ASCII);
+}
+
+void Lookup(const base::FilePath& dir,
+            const GURL& url,
+            LookupCallback callback) {
+  GetTaskRunner()->PostTaskAndReplyWithResult(
+      FROM_HERE, base::BindOnce(&ReadEntry, GetEntryPath(dir, url)),
+      std::move(callback));
+}
+
+void Store(const base::FilePath& dir, const GURL& url, Entry entry) {
+  if (entry.etag.empty() || entry.etag.size() > kMaxETagSize ||
+      entry.etag.find('\n') != std::string::npos ||
+      entry.body.size() > kMaxEntrySize)
+    return;
+  GetTaskRunner()->PostTask(
+      FROM_HERE, base::BindOnce(&WriteEntry, dir, url, std::move(entry)));
+}
+
+}  // namespace electron::devtools_resource_cache
@@ -0,0 +1,47 @@
+// Copyright (c) 2024 Microsoft, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#ifndef ELECTRON_SHELL_BROWSER_UI_DEVTOOLS_RESOURCE_CACHE_H_
+#define ELECTRON_SHELL_BROWSER_UI_DEVTOOLS_RESOURCE_CACHE_H_
+
+#include <cstddef>
+#include <optional>
+#include <string>
+
+#include "base/files/file_path.h"
+#include "base/functional/callback.h"
+
+class GURL;
+
+// An on-disk cache for the source maps loaded by the DevTools frontend, so
+// that reopening DevTools only needs a revalidation request per source map
+// instead of downloading all of them again.
+namespace electron::devtools_resource_cache {
+
+// Larger source maps are uncommon and not worth keeping on disk.
+inline constexpr size_t kMaxEntrySize = 64 * 1024 * 1024;
+
+struct Entry {
+  std::string etag;
+  std::string body;
+};
+
+using LookupCallback = base::OnceCallback<void(std::optional<Entry>)>;
+
+// Whether responses for |url| are worth caching.
+bool IsCacheable(const GURL& url);
+
+// Reads the entry of |url| from the cache in |dir| off the UI thread and
+// runs |callback| with it, or with nullopt when there is none.
+void Lookup(const base::FilePath& dir,
+            const GURL& url,
+            LookupCallback callback);
+
+// Writes |entry| as the cached response of |url|, evicting the least
+// recently used entries once the cache grows too big.
+void Store(const base::FilePath& dir, const GURL& url, Entry entry);
+
+}  // namespace electron::devtools_resource_cache
+
+#endif  // ELECTRON_SHELL_BROWSER_UI_DEVTOOLS_RESOURCE_CACHE_H_
@@ -4,6 +4,8 @@
 
 #include "shell/browser/ui/drag_util.h"
 
+#include <utility>
+
 #include "third_party/blink/public/mojom/page/draggable_region.mojom.h"
 #include "ui/gfx/geometry/skia_conversions.h"
 
@@ -13,12 +15,30 @@ namespace electron {
 std::unique_ptr<SkRegion> DraggableRegionsToSkRegion(
     const std::vector<blink::mojom::DraggableRegionPtr>& regions) {
   auto sk_region = std::make_unique<SkRegion>();
+  // Adding or removing a run of rects one by one is the same as adding or
+  // removing their union, which SkRegion::setRects builds in one pass instead
+  // of rebuilding the region for every rect.
+  std::vector<SkIRect> run;
+  bool run_draggable = true;
+  auto apply_run = [&] {
+    if (run.empty())
+      return;
+    SkRegion run_region;
+    run_region.setRects(run.data(), run.size());
+    sk_region->op(run_region, run_draggable ? SkRegion::kUnion_Op
+                                            : SkRegion::kDifference_Op);
+    run.clear();
+  };
   for (const auto& region : regions) {
-    sk_region->op(
+    if (region->draggable != run_draggable) {
+      apply_run();
+      run_draggable = region->draggable;
+    }
+    run.push_back(
         SkIRect::MakeLTRB(region->bounds.x(), region->bounds.y(),
-                          region->bounds.right(), region->bounds.bottom()),
-        region->draggable ? SkRegion::kUnion_Op : SkRegion::kDifference_Op);
+                          region->bounds.right(), region->bounds.bottom()));
   }
+  apply_run();
   return sk_region;
 }
 
@@ -31,6 +31,7 @@ void ElectronMenuModel::SetToolTip(size_t index,
                                    const std::u16string& toolTip) {
   int command_id = GetCommandIdAt(index);
   toolTips_[command_id] = toolTip;
+  MenuItemsChanged();
 }
 
 std::u16string ElectronMenuModel::GetToolTipAt(size_t index) {
@@ -42,6 +43,7 @@ std::u16string ElectronMenuModel::GetToolTipAt(size_t index) {
 void ElectronMenuModel::SetRole(size_t index, const std::u16string& role) {
   int command_id = GetCommandIdAt(index);
   roles_[command_id] = role;
+  MenuItemsChanged();
 }
 
 std::u16string ElectronMenuModel::GetRoleAt(size_t index) {
@@ -54,6 +56,7 @@ void ElectronMenuModel::SetSecondaryLabel(size_t index,
                                           const std::u16string& sublabel) {
   int command_id = GetCommandIdAt(index);
   sublabels_[command_id] = sublabel;
+  MenuItemsChanged();
 }
 
 std::u16string ElectronMenuModel::GetSecondaryLabelAt(size_t index) const {
@@ -115,6 +118,11 @@ void ElectronMenuModel::MenuWillShow() {
   }
 }
 
+void ElectronMenuModel::MenuItemsChanged() {
+  ++version_;
+  ui::SimpleMenuModel::MenuItemsChanged();
+}
+
 ElectronMenuModel* ElectronMenuModel::GetSubmenuModelAt(size_t index) {
   return static_cast<ElectronMenuModel*>(
       ui::SimpleMenuModel::GetSubmenuModelAt(index));
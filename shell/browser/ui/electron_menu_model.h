@@ -108,6 +108,10 @@ class ElectronMenuModel : public ui::SimpleMenuModel {
   void MenuWillClose() override;
   void MenuWillShow() override;
 
+  // Changes whenever an item is added, removed or changed, so that native
+  // menus built from the model can tell whether they are out of date.
+  uint64_t version() const { return version_; }
+
   base::WeakPtr<ElectronMenuModel> GetWeakPtr() {
     return weak_factory_.GetWeakPtr();
   }
@@ -115,6 +119,10 @@ class ElectronMenuModel : public ui::SimpleMenuModel {
   using SimpleMenuModel::GetSubmenuModelAt;
   ElectronMenuModel* GetSubmenuModelAt(size_t index);
 
+ protected:
+  // ui::SimpleMenuModel:
+  void MenuItemsChanged() override;
+
  private:
   raw_ptr<Delegate> delegate_;  // weak ref.
 
@@ -126,6 +134,7 @@ class ElectronMenuModel : public ui::SimpleMenuModel {
   base::flat_map<int, std::u16string> roles_;      // command id -> role
   base::flat_map<int, std::u16string> sublabels_;  // command id -> sublabel
   base::ObserverList<Observer> observers_;
+  uint64_t version_ = 0;
 
   base::WeakPtrFactory<ElectronMenuModel> weak_factory_{this};
 };
@@ -5,12 +5,15 @@
 #include <memory>
 #include <string>
 
+#include "base/files/file_enumerator.h"
 #include "base/files/file_util.h"
 #include "base/functional/bind.h"
 #include "base/functional/callback.h"
 #include "base/memory/raw_ptr.h"
 #include "base/memory/raw_ptr_exclusion.h"
+#include "base/memory/weak_ptr.h"
 #include "base/strings/string_util.h"
+#include "base/task/thread_pool.h"
 #include "electron/electron_gtk_stubs.h"
 #include "shell/browser/javascript_environment.h"
 #include "shell/browser/native_window_views.h"
@@ -18,6 +21,7 @@
 #include "shell/browser/ui/gtk_util.h"
 #include "shell/common/gin_converters/file_path_converter.h"
 #include "shell/common/thread_restrictions.h"
+#include "ui/base/glib/scoped_gobject.h"
 #include "ui/base/glib/scoped_gsignal.h"
 #include "ui/gtk/gtk_ui.h"    // nogncheck
 #include "ui/gtk/gtk_util.h"  // nogncheck
@@ -54,9 +58,40 @@ std::string MakeCaseInsensitivePattern(const std::string& extension) {
   return pattern;
 }
 
+// Whether |settings.default_path| names an existing directory. This touches
+// the file system, so the asynchronous dialogs call it on the thread pool.
+bool IsDefaultPathDirectory(const DialogSettings& settings) {
+  return !settings.default_path.empty() &&
+         base::DirectoryExists(settings.default_path);
+}
+
+bool IsDefaultPathDirectorySync(const DialogSettings& settings) {
+  electron::ScopedAllowBlockingForElectron allow_blocking;
+  return IsDefaultPathDirectory(settings);
+}
+
+bool CanPreview(const struct stat& st);
+
+// Decodes a thumbnail of |filename| for the preview widget, or returns null if
+// the file should not or cannot be previewed.
+ScopedGObject<GdkPixbuf> LoadPreview(const std::string& filename) {
+  struct stat sb;
+  if (stat(filename.c_str(), &sb) != 0 || !CanPreview(sb))
+    return {};
+
+  // This will preserve the image's aspect ratio.
+  GdkPixbuf* pixbuf = gdk_pixbuf_new_from_file_at_size(
+      filename.c_str(), kPreviewWidth, kPreviewHeight, nullptr);
+  if (!pixbuf)
+    return {};
+  return TakeGObject(pixbuf);
+}
+
 class FileChooserDialog {
  public:
-  FileChooserDialog(GtkFileChooserAction action, const DialogSettings& settings)
+  FileChooserDialog(GtkFileChooserAction action,
+                    const DialogSettings& settings,
+                    bool default_path_is_directory)
       : parent_(
             static_cast<electron::NativeWindowViews*>(settings.parent_window)),
         filters_(settings.filters) {
@@ -97,8 +132,7 @@ class FileChooserDialog {
       gtk_file_chooser_set_create_folders(dialog_, TRUE);
 
     if (!settings.default_path.empty()) {
-      electron::ScopedAllowBlockingForElectron allow_blocking;
-      if (base::DirectoryExists(settings.default_path)) {
+      if (default_path_is_directory) {
         gtk_file_chooser_set_current_folder(
             dialog_, settings.default_path.value().c_str());
       } else {
@@ -168,6 +202,10 @@ class FileChooserDialog {
   }
 
   void RunAsynchronous() {
+    // Thumbnails are decoded on the thread pool while the dialog is shown
+    // asynchronously. The synchronous dialogs run a nested GTK loop in which
+    // the replies would not be delivered, so they keep decoding inline.
+    async_preview_ = true;
     signals_.emplace_back(
         GTK_WIDGET(dialog_), "response",
         base::BindRepeating(&FileChooserDialog::OnFileDialogResponse,
@@ -233,8 +271,19 @@ class FileChooserDialog {
 
   // Callback for when we update the preview for the selection.
   void OnUpdatePreview(GtkFileChooser* chooser);
+  void SetPreview(GdkPixbuf* pixbuf);
+  static void OnPreviewLoaded(base::WeakPtr<FileChooserDialog> dialog,
+                              int request_id,
+                              ScopedGObject<GdkPixbuf> pixbuf);
+
+  bool async_preview_ = false;
+  // Incremented for every preview request so that thumbnails which finish
+  // decoding after the selection has moved on are dropped.
+  int preview_request_id_ = 0;
 
   std::vector<ScopedGSignal> signals_;
+
+  base::WeakPtrFactory<FileChooserDialog> weak_factory_{this};
 };
 
 void FileChooserDialog::OnFileDialogResponse(GtkWidget* widget, int response) {
@@ -299,28 +348,98 @@ bool CanPreview(const struct stat& st) {
 
 void FileChooserDialog::OnUpdatePreview(GtkFileChooser* chooser) {
   CHECK(!electron::IsElectron_gtkInitialized());
+  const int request_id = ++preview_request_id_;
   gchar* filename = gtk_file_chooser_get_preview_filename(chooser);
   if (!filename) {
-    gtk_file_chooser_set_preview_widget_active(chooser, FALSE);
+    SetPreview(nullptr);
     return;
   }
 
-  struct stat sb;
-  if (stat(filename, &sb) != 0 || !CanPreview(sb)) {
-    g_free(filename);
-    gtk_file_chooser_set_preview_widget_active(chooser, FALSE);
+  std::string path(filename);
+  g_free(filename);
+  if (!async_preview_) {
+    electron::ScopedAllowBlockingForElectron allow_blocking;
+    SetPreview(LoadPreview(path).get());
     return;
   }
 
-  // This will preserve the image's aspect ratio.
-  GdkPixbuf* pixbuf = gdk_pixbuf_new_from_file_at_size(filename, kPreviewWidth,
-                                                       kPreviewHeight, nullptr);
-  g_free(filename);
-  if (pixbuf) {
+  base::ThreadPool::PostTaskAndReplyWithResult(
+      FROM_HERE,
+      {base::MayBlock(), base::TaskPriority::USER_VISIBLE,
+       base::TaskShutdownBehavior::CONTINUE_ON_SHUTDOWN},
+      base::BindOnce(&LoadPreview, std::move(path)),
+      base::BindOnce(&FileChooserDialog::OnPreviewLoaded,
+                     weak_factory_.GetWeakPtr(), request_id));
+}
+
+void FileChooserDialog::SetPreview(GdkPixbuf* pixbuf) {
+  if (pixbuf)
     gtk_image_set_from_pixbuf(GTK_IMAGE(preview_), pixbuf);
-    g_object_unref(pixbuf);
+  gtk_file_chooser_set_preview_widget_active(dialog_, pixbuf ? TRUE : FALSE);
+}
+
+// static
+void FileChooserDialog::OnPreviewLoaded(base::WeakPtr<FileChooserDialog> dialog,
+                                        int request_id,
+                                        ScopedGObject<GdkPixbuf> pixbuf) {
+  if (dialog && request_id == dialog->preview_request_id_)
+    dialog->SetPreview(pixbuf.get());
+}
+
+void ShowOpenDialogWithDirectoryInfo(
+    const DialogSettings& settings,
+    base::WeakPtr<electron::NativeWindow> parent,
+    gin_helper::Promise<gin_helper::Dictionary> promise,
+    bool default_path_is_directory) {
+  DialogSettings dialog_settings = settings;
+  dialog_settings.parent_window = parent.get();
+  GtkFileChooserAction action = GTK_FILE_CHOOSER_ACTION_OPEN;
+  if (settings.properties & OPEN_DIALOG_OPEN_DIRECTORY)
+    action = GTK_FILE_CHOOSER_ACTION_SELECT_FOLDER;
+  FileChooserDialog* open_dialog =
+      new FileChooserDialog(action, dialog_settings, default_path_is_directory);
+  open_dialog->SetupOpenProperties(settings.properties);
+  open_dialog->RunOpenAsynchronous(std::move(promise));
+}
+
+void ShowSaveDialogWithDirectoryInfo(
+    const DialogSettings& settings,
+    base::WeakPtr<electron::NativeWindow> parent,
+    gin_helper::Promise<gin_helper::Dictionary> promise,
+    bool default_path_is_directory) {
+  DialogSettings dialog_settings = settings;
+  dialog_settings.parent_window = parent.get();
+  FileChooserDialog* save_dialog =
+      new FileChooserDialog(GTK_FILE_CHOOSER_ACTION_SAVE, dialog_settings,
+                            default_path_is_directory);
+  save_dialog->RunSaveAsynchronous(std::move(promise));
+}
+
+// Checks |settings.default_path| on the thread pool, then calls |show| on the
+// UI thread with the result.
+template <typename ShowFunction>
+void ResolveDefaultPathThen(
+    const DialogSettings& settings,
+    gin_helper::Promise<gin_helper::Dictionary> promise,
+    ShowFunction show) {
+  base::WeakPtr<electron::NativeWindow> parent;
+  if (settings.parent_window)
+    parent = settings.parent_window->GetWeakPtr();
+  base::ThreadPool::PostTaskAndReplyWithResult(
+      FROM_HERE, {base::MayBlock(), base::TaskPriority::USER_BLOCKING},
+      base::BindOnce(&IsDefaultPathDirectory, settings),
+      base::BindOnce(show, settings, std::move(parent), std::move(promise)));
+}
+
+void EnumerateDirectory(const base::FilePath& path) {
+  // FileEnumerator stats every entry, which is what GTK does as well when it
+  // lists the directory, so afterwards the kernel serves those lookups from
+  // its dentry and inode caches instead of the disk.
+  base::FileEnumerator enumerator(
+      path, false,
+      base::FileEnumerator::FILES | base::FileEnumerator::DIRECTORIES);
+  while (!enumerator.Next().empty()) {
   }
-  gtk_file_chooser_set_preview_widget_active(chooser, pixbuf ? TRUE : FALSE);
 }
 
 }  // namespace
@@ -348,7 +467,8 @@ bool ShowOpenDialogSync(const DialogSettings& settings,
   GtkFileChooserAction action = GTK_FILE_CHOOSER_ACTION_OPEN;
   if (settings.properties & OPEN_DIALOG_OPEN_DIRECTORY)
     action = GTK_FILE_CHOOSER_ACTION_SELECT_FOLDER;
-  FileChooserDialog open_dialog(action, settings);
+  FileChooserDialog open_dialog(action, settings,
+                                IsDefaultPathDirectorySync(settings));
   open_dialog.SetupOpenProperties(settings.properties);
 
   ShowFileDialog(open_dialog);
@@ -363,16 +483,13 @@ bool ShowOpenDialogSync(const DialogSettings& settings,
 
 void ShowOpenDialog(const DialogSettings& settings,
                     gin_helper::Promise<gin_helper::Dictionary> promise) {
-  GtkFileChooserAction action = GTK_FILE_CHOOSER_ACTION_OPEN;
-  if (settings.properties & OPEN_DIALOG_OPEN_DIRECTORY)
-    action = GTK_FILE_CHOOSER_ACTION_SELECT_FOLDER;
-  FileChooserDialog* open_dialog = new FileChooserDialog(action, settings);
-  open_dialog->SetupOpenProperties(settings.properties);
-  open_dialog->RunOpenAsynchronous(std::move(promise));
+  ResolveDefaultPathThen(settings, std::move(promise),
+                         &ShowOpenDialogWithDirectoryInfo);
 }
 
 bool ShowSaveDialogSync(const DialogSettings& settings, base::FilePath* path) {
-  FileChooserDialog save_dialog(GTK_FILE_CHOOSER_ACTION_SAVE, settings);
+  FileChooserDialog save_dialog(GTK_FILE_CHOOSER_ACTION_SAVE, settings,
+                                IsDefaultPathDirectorySync(settings));
   save_dialog.SetupSaveProperties(settings.properties);
 
   ShowFileDialog(save_dialog);
@@ -387,9 +504,16 @@ bool ShowSaveDialogSync(const DialogSettings& settings, base::FilePath* path) {
 
 void ShowSaveDialog(const DialogSettings& settings,
                     gin_helper::Promise<gin_helper::Dictionary> promise) {
-  FileChooserDialog* save_dialog =
-      new FileChooserDialog(GTK_FILE_CHOOSER_ACTION_SAVE, settings);
-  save_dialog->RunSaveAsynchronous(std::move(promise));
+  ResolveDefaultPathThen(settings, std::move(promise),
+                         &ShowSaveDialogWithDirectoryInfo);
+}
+
+void PrewarmDirectory(const base::FilePath& path) {
+  base::ThreadPool::PostTask(
+      FROM_HERE,
+      {base::MayBlock(), base::TaskPriority::BEST_EFFORT,
+       base::TaskShutdownBehavior::SKIP_ON_SHUTDOWN},
+      base::BindOnce(&EnumerateDirectory, path));
 }
 
 }  // namespace file_dialog
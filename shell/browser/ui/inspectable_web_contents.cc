@@ -5,11 +5,15 @@
 
 #include "shell/browser/ui/inspectable_web_contents.h"
 
+#include <algorithm>
 #include <memory>
+#include <optional>
+#include <string>
 #include <string_view>
 #include <utility>
 
 #include "base/base64.h"
+#include "base/files/file_path.h"
 #include "base/json/json_reader.h"
 #include "base/json/json_writer.h"
 #include "base/json/string_escape.h"
@@ -50,6 +54,7 @@
 #include "shell/browser/native_window_views.h"
 #include "shell/browser/net/asar/asar_url_loader_factory.h"
 #include "shell/browser/protocol_registry.h"
+#include "shell/browser/ui/devtools_resource_cache.h"
 #include "shell/browser/ui/inspectable_web_contents_delegate.h"
 #include "shell/browser/ui/inspectable_web_contents_view.h"
 #include "shell/browser/ui/inspectable_web_contents_view_delegate.h"
@@ -92,6 +97,8 @@ const char kChromeUIDevToolsRemoteFrontendPath[] = "serve_file";
 const char kDevToolsBoundsPref[] = "electron.devtools.bounds";
 const char kDevToolsZoomPref[] = "electron.devtools.zoom";
 const char kDevToolsPreferences[] = "electron.devtools.preferences";
+const base::FilePath::CharType kDevToolsResourceCacheDirName[] =
+    FILE_PATH_LITERAL("DevTools Resource Cache");
 
 const char kFrontendHostId[] = "id";
 const char kFrontendHostMethod[] = "method";
@@ -161,6 +168,33 @@ void OnOpenItemComplete(const base::FilePath& path, const std::string& result) {
 constexpr base::TimeDelta kInitialBackoffDelay = base::Milliseconds(250);
 constexpr base::TimeDelta kMaxBackoffDelay = base::Seconds(10);
 
+// Network chunks are small, each one sent to the frontend is a script
+// evaluation of its own, so they are coalesced up to this size.
+constexpr size_t kStreamWriteSize = 1024 * 1024;
+
+// Returns the length of the longest prefix of |data| that does not end in the
+// middle of a UTF-8 sequence.
+size_t GetCompleteUTF8PrefixLength(std::string_view data) {
+  size_t index = data.size();
+  size_t continuation_bytes = 0;
+  while (index > 0 && continuation_bytes < 3 &&
+         (static_cast<uint8_t>(data[index - 1]) & 0xC0) == 0x80) {
+    --index;
+    ++continuation_bytes;
+  }
+  if (index == 0)
+    return data.size();
+  const auto lead = static_cast<uint8_t>(data[index - 1]);
+  size_t length = 1;
+  if ((lead & 0xE0) == 0xC0)
+    length = 2;
+  else if ((lead & 0xF0) == 0xE0)
+    length = 3;
+  else if ((lead & 0xF8) == 0xF0)
+    length = 4;
+  return length > continuation_bytes + 1 ? index - 1 : data.size();
+}
+
 }  // namespace
 
 class InspectableWebContents::NetworkResourceLoader
@@ -183,17 +217,49 @@ class InspectableWebContents::NetworkResourceLoader
     scoped_refptr<network::SharedURLLoaderFactory> refptr_;
   };
 
+  // A non-empty |cache_dir| stores the response in the DevTools resource
+  // cache, |cached| is the entry it already holds, if any.
   static void Create(int stream_id,
                      InspectableWebContents* bindings,
                      const network::ResourceRequest& resource_request,
                      const net::NetworkTrafficAnnotationTag& traffic_annotation,
                      URLLoaderFactoryHolder url_loader_factory,
                      DispatchCallback callback,
+                     base::FilePath cache_dir = base::FilePath(),
+                     std::optional<devtools_resource_cache::Entry> cached =
+                         std::nullopt,
                      base::TimeDelta retry_delay = base::TimeDelta()) {
     bindings->loaders_.insert(
         std::make_unique<InspectableWebContents::NetworkResourceLoader>(
             stream_id, bindings, resource_request, traffic_annotation,
-            std::move(url_loader_factory), std::move(callback), retry_delay));
+            std::move(url_loader_factory), std::move(callback),
+            std::move(cache_dir), std::move(cached), retry_delay));
+  }
+
+  // Revalidates |cached| instead of downloading the resource again.
+  static void CreateWithCachedEntry(
+      base::WeakPtr<InspectableWebContents> bindings,
+      int stream_id,
+      network::ResourceRequest resource_request,
+      const net::NetworkTrafficAnnotationTag& traffic_annotation,
+      URLLoaderFactoryHolder url_loader_factory,
+      DispatchCallback callback,
+      const base::FilePath& cache_dir,
+      std::optional<devtools_resource_cache::Entry> cached) {
+    if (!bindings)
+      return;
+
+    // A request with validators of its own is answered by the server as is.
+    if (cached && (resource_request.headers.HasHeader("If-None-Match") ||
+                   resource_request.headers.HasHeader("If-Modified-Since"))) {
+      cached.reset();
+    }
+    if (cached)
+      resource_request.headers.SetHeader("If-None-Match", cached->etag);
+
+    Create(stream_id, bindings.get(), resource_request, traffic_annotation,
+           std::move(url_loader_factory), std::move(callback), cache_dir,
+           std::move(cached));
   }
 
   NetworkResourceLoader(
@@ -203,6 +269,8 @@ class InspectableWebContents::NetworkResourceLoader
       const net::NetworkTrafficAnnotationTag& traffic_annotation,
       URLLoaderFactoryHolder url_loader_factory,
       DispatchCallback callback,
+      base::FilePath cache_dir,
+      std::optional<devtools_resource_cache::Entry> cached,
       base::TimeDelta delay)
       : stream_id_(stream_id),
         bindings_(bindings),
@@ -213,6 +281,8 @@ class InspectableWebContents::NetworkResourceLoader
             traffic_annotation)),
         url_loader_factory_(std::move(url_loader_factory)),
         callback_(std::move(callback)),
+        cache_dir_(std::move(cache_dir)),
+        cached_(std::move(cached)),
         retry_delay_(delay) {
     loader_->SetOnResponseStartedCallback(base::BindOnce(
         &NetworkResourceLoader::OnResponseStarted, base::Unretained(this)));
@@ -244,12 +314,34 @@ class InspectableWebContents::NetworkResourceLoader
 
   void OnDataReceived(base::StringPiece chunk,
                       base::OnceClosure resume) override {
-    bool encoded = !base::IsStringUTF8(chunk);
+    if (!cache_dir_.empty()) {
+      if (body_.size() + chunk.size() <=
+          devtools_resource_cache::kMaxEntrySize) {
+        body_.append(chunk);
+      } else {
+        cache_dir_.clear();
+        body_ = std::string();
+      }
+    }
+
+    pending_data_.append(chunk);
+    if (pending_data_.size() >= kStreamWriteSize) {
+      // Keeps characters whole so that text is not needlessly encoded.
+      const size_t length = GetCompleteUTF8PrefixLength(pending_data_);
+      StreamWrite(std::string_view(pending_data_).substr(0, length));
+      pending_data_.erase(0, length);
+    }
+    std::move(resume).Run();
+  }
+
+  void StreamWrite(std::string_view data) {
+    if (data.empty())
+      return;
+    bool encoded = !base::IsStringUTF8(data);
     bindings_->CallClientFunction(
         "DevToolsAPI", "streamWrite", base::Value{stream_id_},
-        base::Value{encoded ? base::Base64Encode(chunk) : chunk},
+        base::Value{encoded ? base::Base64Encode(data) : data},
         base::Value{encoded});
-    std::move(resume).Run();
   }
 
   void OnComplete(bool success) override {
@@ -263,12 +355,39 @@ class InspectableWebContents::NetworkResourceLoader
                    << delay << "." << std::endl;
       NetworkResourceLoader::Create(
           stream_id_, bindings_, resource_request_, traffic_annotation_,
-          std::move(url_loader_factory_), std::move(callback_), delay);
+          std::move(url_loader_factory_), std::move(callback_),
+          std::move(cache_dir_), std::move(cached_), delay);
     } else {
+      int status_code =
+          response_headers_ ? response_headers_->response_code() : net::HTTP_OK;
+      if (cached_ && status_code == net::HTTP_NOT_MODIFIED) {
+        // The frontend did not ask for revalidation, answer as if the body
+        // had been sent again.
+        status_code = net::HTTP_OK;
+        std::string_view body = cached_->body;
+        for (size_t offset = 0; offset < body.size();) {
+          size_t length = std::min(kStreamWriteSize, body.size() - offset);
+          length = GetCompleteUTF8PrefixLength(body.substr(offset, length));
+          if (length == 0)
+            length = std::min(kStreamWriteSize, body.size() - offset);
+          StreamWrite(body.substr(offset, length));
+          offset += length;
+        }
+      } else {
+        StreamWrite(pending_data_);
+        std::string etag;
+        if (success && response_headers_ && status_code == net::HTTP_OK &&
+            !cache_dir_.empty() &&
+            response_headers_->GetNormalizedHeader("ETag", &etag)) {
+          devtools_resource_cache::Store(
+              cache_dir_, resource_request_.url,
+              devtools_resource_cache::Entry{std::move(etag),
+                                             std::move(body_)});
+        }
+      }
+
       base::Value response(base::Value::Type::DICT);
-      response.GetDict().Set(
-          "statusCode", response_headers_ ? response_headers_->response_code()
-                                          : net::HTTP_OK);
+      response.GetDict().Set("statusCode", status_code);
 
       base::Value::Dict headers;
       size_t iterator = 0;
@@ -296,6 +415,12 @@ class InspectableWebContents::NetworkResourceLoader
   URLLoaderFactoryHolder url_loader_factory_;
   DispatchCallback callback_;
   scoped_refptr<net::HttpResponseHeaders> response_headers_;
+  base::FilePath cache_dir_;
+  std::optional<devtools_resource_cache::Entry> cached_;
+  // Data received but not yet sent to the frontend.
+  std::string pending_data_;
+  // The whole body, while it is still small enough to be cached.
+  std::string body_;
   base::OneShotTimer timer_;
   base::TimeDelta retry_delay_;
 };
@@ -684,18 +809,31 @@ void InspectableWebContents::LoadNetworkResource(DispatchCallback callback,
         std::make_unique<network::WrapperPendingSharedURLLoaderFactory>(
             std::move(pending_remote)));
   } else if (protocol_registry->IsProtocolRegistered(gurl.scheme())) {
-    auto& protocol_handler = protocol_registry->handlers().at(gurl.scheme());
     mojo::PendingRemote<network::mojom::URLLoaderFactory> pending_remote =
-        ElectronURLLoaderFactory::Create(protocol_handler.first,
-                                         protocol_handler.second);
+        protocol_registry->CreateRegisteredURLLoaderFactory(gurl.scheme());
     url_loader_factory = network::SharedURLLoaderFactory::Create(
         std::make_unique<network::WrapperPendingSharedURLLoaderFactory>(
             std::move(pending_remote)));
   } else {
-    auto* partition = GetDevToolsWebContents()
-                          ->GetBrowserContext()
-                          ->GetDefaultStoragePartition();
-    url_loader_factory = partition->GetURLLoaderFactoryForBrowserProcess();
+    auto* browser_context = GetDevToolsWebContents()->GetBrowserContext();
+    url_loader_factory = browser_context->GetDefaultStoragePartition()
+                             ->GetURLLoaderFactoryForBrowserProcess();
+
+    // Source maps can be large and slow to download, keep them on disk and
+    // only revalidate them the next time DevTools asks for them.
+    if (!browser_context->IsOffTheRecord() &&
+        devtools_resource_cache::IsCacheable(gurl)) {
+      base::FilePath cache_dir =
+          browser_context->GetPath().Append(kDevToolsResourceCacheDirName);
+      devtools_resource_cache::Lookup(
+          cache_dir, gurl,
+          base::BindOnce(&NetworkResourceLoader::CreateWithCachedEntry,
+                         weak_factory_.GetWeakPtr(), stream_id,
+                         std::move(resource_request), traffic_annotation,
+                         std::move(url_loader_factory), std::move(callback),
+                         cache_dir));
+      return;
+    }
   }
 
   NetworkResourceLoader::Create(
@@ -703,6 +841,7 @@ void InspectableWebContents::LoadNetworkResource(DispatchCallback callback,
       std::move(url_loader_factory), std::move(callback));
 }
 
+
 void InspectableWebContents::SetIsDocked(DispatchCallback callback,
                                          bool docked) {
   if (managed_devtools_web_contents_)
@@ -4,6 +4,8 @@
 
 #include "shell/browser/ui/tray_icon.h"
 
+#include <utility>
+
 namespace electron {
 
 TrayIcon::BalloonOptions::BalloonOptions() = default;
@@ -14,6 +16,18 @@ TrayIcon::~TrayIcon() = default;
 
 void TrayIcon::SetPressedImage(ImageType image) {}
 
+void TrayIcon::SetImageFrames(std::vector<ImageFrame> frames) {
+  image_frames_ = std::move(frames);
+}
+
+void TrayIcon::SetImageFrame(size_t index) {
+#if BUILDFLAG(IS_WIN)
+  SetImage(image_frames_[index].get());
+#else
+  SetImage(image_frames_[index]);
+#endif
+}
+
 void TrayIcon::DisplayBalloon(const BalloonOptions& options) {}
 
 void TrayIcon::RemoveBalloon() {}
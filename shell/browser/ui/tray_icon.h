@@ -14,6 +14,12 @@
 #include "shell/common/gin_converters/guid_converter.h"
 #include "ui/gfx/geometry/rect.h"
 
+#if BUILDFLAG(IS_WIN)
+#include "base/win/scoped_gdi_object.h"
+#else
+#include "ui/gfx/image/image.h"
+#endif
+
 namespace electron {
 
 class TrayIcon {
@@ -22,8 +28,10 @@ class TrayIcon {
 
 #if BUILDFLAG(IS_WIN)
   using ImageType = HICON;
+  using ImageFrame = base::win::ScopedHICON;
 #else
   using ImageType = const gfx::Image&;
+  using ImageFrame = gfx::Image;
 #endif
 
   virtual ~TrayIcon();
@@ -38,6 +46,15 @@ class TrayIcon {
   // Sets the image associated with this status icon when pressed.
   virtual void SetPressedImage(ImageType image);
 
+  // Registers images that SetImageFrame() can switch between, converted to
+  // the platform's representation once instead of on every switch.
+  virtual void SetImageFrames(std::vector<ImageFrame> frames);
+
+  // Shows the |index|th registered frame, which must exist.
+  virtual void SetImageFrame(size_t index);
+
+  size_t GetImageFrameCount() const { return image_frames_.size(); }
+
   // Sets the hover text for this status icon. This is also used as the label
   // for the menu item which is created as a replacement for the status icon
   // click action on platforms that do not support custom click actions for the
@@ -132,6 +149,8 @@ class TrayIcon {
  protected:
   TrayIcon();
 
+  std::vector<ImageFrame> image_frames_;
+
  private:
   base::ObserverList<TrayIconObserver> observers_;
 };
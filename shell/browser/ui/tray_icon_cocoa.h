@@ -8,6 +8,7 @@
 #import <Cocoa/Cocoa.h>
 
 #include <string>
+#include <vector>
 
 #include "shell/browser/ui/tray_icon.h"
 
@@ -23,6 +24,7 @@ class TrayIconCocoa : public TrayIcon {
 
   void SetImage(const gfx::Image& image) override;
   void SetPressedImage(const gfx::Image& image) override;
+  void SetImageFrames(std::vector<gfx::Image> frames) override;
   void SetToolTip(const std::string& tool_tip) override;
   void SetTitle(const std::string& title, const TitleOptions& options) override;
   std::string GetTitle() override;
@@ -368,6 +368,14 @@ void TrayIconCocoa::SetPressedImage(const gfx::Image& image) {
   [status_item_view_ setAlternateImage:image.AsNSImage()];
 }
 
+void TrayIconCocoa::SetImageFrames(std::vector<gfx::Image> frames) {
+  // The NSImage is cached by the gfx::Image, create it now rather than the
+  // first time the frame is shown.
+  for (const gfx::Image& frame : frames)
+    frame.AsNSImage();
+  TrayIcon::SetImageFrames(std::move(frames));
+}
+
 void TrayIconCocoa::SetToolTip(const std::string& tool_tip) {
   [status_item_view_ setToolTip:base::SysUTF8ToNSString(tool_tip)];
 }
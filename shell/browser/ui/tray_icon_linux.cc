@@ -44,6 +44,20 @@ void TrayIconLinux::SetImage(const gfx::Image& image) {
     status_icon->SetIcon(image_);
 }
 
+void TrayIconLinux::SetImageFrames(std::vector<gfx::Image> frames) {
+  best_image_frames_.clear();
+  best_image_frames_.reserve(frames.size());
+  for (const gfx::Image& frame : frames)
+    best_image_frames_.push_back(GetBestImageRep(frame.AsImageSkia()));
+  TrayIcon::SetImageFrames(std::move(frames));
+}
+
+void TrayIconLinux::SetImageFrame(size_t index) {
+  image_ = best_image_frames_[index];
+  if (auto* status_icon = GetStatusIcon())
+    status_icon->SetIcon(image_);
+}
+
 void TrayIconLinux::SetToolTip(const std::string& tool_tip) {
   tool_tip_ = base::UTF8ToUTF16(tool_tip);
   if (auto* status_icon = GetStatusIcon())
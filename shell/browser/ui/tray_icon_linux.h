@@ -7,6 +7,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "shell/browser/ui/tray_icon.h"
 #include "ui/linux/status_icon_linux.h"
@@ -24,6 +25,8 @@ class TrayIconLinux : public TrayIcon, public ui::StatusIconLinux::Delegate {
 
   // TrayIcon:
   void SetImage(const gfx::Image& image) override;
+  void SetImageFrames(std::vector<gfx::Image> frames) override;
+  void SetImageFrame(size_t index) override;
   void SetToolTip(const std::string& tool_tip) override;
   void SetContextMenu(raw_ptr<ElectronMenuModel> menu_model) override;
 
@@ -49,6 +52,8 @@ class TrayIconLinux : public TrayIcon, public ui::StatusIconLinux::Delegate {
   StatusIconType status_icon_type_;
 
   gfx::ImageSkia image_;
+  // |image_frames_| already reduced to the representation status icons use.
+  std::vector<gfx::ImageSkia> best_image_frames_;
   std::u16string tool_tip_;
   raw_ptr<ui::MenuModel> menu_model_ = nullptr;
 };
@@ -4,6 +4,7 @@
 
 #include "shell/browser/ui/views/autofill_popup_view.h"
 
+#include <algorithm>
 #include <memory>
 #include <utility>
 
@@ -36,7 +37,7 @@ END_METADATA
 AutofillPopupView::AutofillPopupView(AutofillPopup* popup,
                                      views::Widget* parent_widget)
     : popup_(popup), parent_widget_(parent_widget) {
-  CreateChildViews();
+  UpdateChildViews();
   SetFocusBehavior(FocusBehavior::ALWAYS);
   set_drag_controller(this);
 }
@@ -123,11 +124,18 @@ void AutofillPopupView::OnSuggestionsChanged() {
   if (!popup_)
     return;
 
-  CreateChildViews();
   if (popup_->line_count() == 0) {
     popup_->Hide();
     return;
   }
+
+  if (selected_line_ && *selected_line_ >= popup_->line_count())
+    selected_line_.reset();
+  // The list usually shrinks as the user types, show the best matches.
+  first_visible_line_ = 0;
+  if (selected_line_)
+    ScrollToLine(*selected_line_);
+  UpdateChildViews();
   DoUpdateBoundsAndRedrawPopup();
 }
 
@@ -152,11 +160,11 @@ void AutofillPopupView::OnSelectedRowChanged(
   SchedulePaint();
 
   if (current_row_selection) {
-    int selected = current_row_selection.value_or(-1);
-    if (selected == -1 || static_cast<size_t>(selected) >= children().size())
+    int slot = *current_row_selection - first_visible_line_;
+    if (slot < 0 || static_cast<size_t>(slot) >= children().size())
       return;
-    children().at(selected)->NotifyAccessibilityEvent(
-        ax::mojom::Event::kSelection, true);
+    children().at(slot)->NotifyAccessibilityEvent(ax::mojom::Event::kSelection,
+                                                  true);
   }
 }
 
@@ -176,8 +184,7 @@ void AutofillPopupView::DrawAutofillEntry(gfx::Canvas* canvas,
   value_rect.Inset(gfx::Insets::VH(0, kEndPadding));
 
   int x_align_left = value_rect.x();
-  const int value_width = gfx::GetStringWidth(
-      popup_->value_at(index), popup_->GetValueFontListForRow(index));
+  const int value_width = popup_->GetValueWidth(index);
   int value_x_align_left = x_align_left;
   value_x_align_left =
       is_rtl ? value_rect.right() - value_width : value_rect.x();
@@ -191,8 +198,7 @@ void AutofillPopupView::DrawAutofillEntry(gfx::Canvas* canvas,
 
   // Draw the label text, if one exists.
   if (auto const& label = popup_->label_at(index); !label.empty()) {
-    const int label_width =
-        gfx::GetStringWidth(label, popup_->GetLabelFontListForRow(index));
+    const int label_width = popup_->GetLabelWidth(index);
     int label_x_align_left = x_align_left;
     label_x_align_left =
         is_rtl ? value_rect.x() : value_rect.right() - label_width;
@@ -206,17 +212,46 @@ void AutofillPopupView::DrawAutofillEntry(gfx::Canvas* canvas,
   }
 }
 
-void AutofillPopupView::CreateChildViews() {
+void AutofillPopupView::UpdateChildViews() {
   if (!popup_)
     return;
 
-  RemoveAllChildViews();
-
-  for (int i = 0; i < popup_->line_count(); ++i) {
-    auto* child_view = new AutofillPopupChildView(popup_->value_at(i));
+  const size_t visible_count = popup_->visible_line_count();
+  while (children().size() > visible_count)
+    RemoveChildViewT(children().back());
+  while (children().size() < visible_count) {
+    auto* child_view = new AutofillPopupChildView(std::u16string());
     child_view->set_drag_controller(this);
     AddChildView(child_view);
   }
+
+  for (size_t i = 0; i < visible_count; ++i) {
+    static_cast<AutofillPopupChildView*>(children()[i])
+        ->set_suggestion(popup_->value_at(first_visible_line_ + i));
+  }
+}
+
+void AutofillPopupView::ScrollTo(int first_line) {
+  if (!popup_)
+    return;
+
+  first_line = std::clamp(
+      first_line, 0, popup_->line_count() - popup_->visible_line_count());
+  if (first_line == first_visible_line_)
+    return;
+  first_visible_line_ = first_line;
+  UpdateChildViews();
+  SchedulePaint();
+}
+
+void AutofillPopupView::ScrollToLine(int line) {
+  if (!popup_)
+    return;
+
+  if (line < first_visible_line_)
+    ScrollTo(line);
+  else if (line >= first_visible_line_ + popup_->visible_line_count())
+    ScrollTo(line - popup_->visible_line_count() + 1);
 }
 
 void AutofillPopupView::DoUpdateBoundsAndRedrawPopup() {
@@ -234,7 +269,8 @@ void AutofillPopupView::DoUpdateBoundsAndRedrawPopup() {
 }
 
 void AutofillPopupView::OnPaint(gfx::Canvas* canvas) {
-  if (!popup_ || static_cast<size_t>(popup_->line_count()) != children().size())
+  if (!popup_ ||
+      static_cast<size_t>(popup_->visible_line_count()) != children().size())
     return;
   gfx::Canvas* draw_canvas = canvas;
   SkBitmap bitmap;
@@ -251,10 +287,11 @@ void AutofillPopupView::OnPaint(gfx::Canvas* canvas) {
       GetColorProvider()->GetColor(ui::kColorResultsTableNormalBackground));
   OnPaintBorder(draw_canvas);
 
-  for (int i = 0; i < popup_->line_count(); ++i) {
-    gfx::Rect line_rect = popup_->GetRowBounds(i);
+  // Only the visible rows are drawn, however long the list is.
+  for (int slot = 0; slot < popup_->visible_line_count(); ++slot) {
+    gfx::Rect line_rect = popup_->GetRowBounds(slot);
 
-    DrawAutofillEntry(draw_canvas, i, line_rect);
+    DrawAutofillEntry(draw_canvas, first_visible_line_ + slot, line_rect);
   }
 
   if (view_proxy_.get()) {
@@ -312,6 +349,20 @@ void AutofillPopupView::OnMouseMoved(const ui::MouseEvent& event) {
     ClearSelection();
 }
 
+bool AutofillPopupView::OnMouseWheel(const ui::MouseWheelEvent& event) {
+  if (!popup_)
+    return false;
+
+  // Positive offsets scroll up, by at least one row per event.
+  int rows = event.y_offset() / kRowHeight;
+  if (rows == 0)
+    rows = event.y_offset() > 0 ? 1 : -1;
+  ScrollTo(first_visible_line_ - rows);
+  if (HitTestPoint(event.location()))
+    SetSelection(event.location());
+  return true;
+}
+
 bool AutofillPopupView::OnMousePressed(const ui::MouseEvent& event) {
   return event.GetClickCount() == 1;
 }
@@ -431,7 +482,7 @@ void AutofillPopupView::AcceptSelection(const gfx::Point& point) {
   if (!popup_)
     return;
 
-  SetSelectedLine(popup_->LineFromY(point.y()));
+  SetSelectedLine(first_visible_line_ + popup_->LineFromY(point.y()));
   AcceptSelectedLine();
 }
 
@@ -445,6 +496,8 @@ void AutofillPopupView::SetSelectedLine(std::optional<int> selected_line) {
 
   auto previous_selected_line(selected_line_);
   selected_line_ = selected_line;
+  if (selected_line_)
+    ScrollToLine(*selected_line_);
   OnSelectedRowChanged(previous_selected_line, selected_line_);
 }
 
@@ -452,7 +505,7 @@ void AutofillPopupView::SetSelection(const gfx::Point& point) {
   if (!popup_)
     return;
 
-  SetSelectedLine(popup_->LineFromY(point.y()));
+  SetSelectedLine(first_visible_line_ + popup_->LineFromY(point.y()));
 }
 
 void AutofillPopupView::SelectNextLine() {
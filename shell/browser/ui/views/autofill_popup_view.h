@@ -30,11 +30,12 @@ const int kSmallerFontSizeDelta = -1;
 const int kEndPadding = 8;
 const int kNamePadding = 15;
 const int kRowHeight = 24;
+const int kMaxVisibleRows = 12;
 
 class AutofillPopup;
 
-// Child view only for triggering accessibility events. Rendering is handled
-// by |AutofillPopupViewViews|.
+// Child view only for triggering accessibility events, one for each visible
+// row. Rendering is handled by |AutofillPopupViewViews|.
 class AutofillPopupChildView : public views::View {
   METADATA_HEADER(AutofillPopupChildView, views::View)
 
@@ -48,6 +49,10 @@ class AutofillPopupChildView : public views::View {
   AutofillPopupChildView(const AutofillPopupChildView&) = delete;
   AutofillPopupChildView& operator=(const AutofillPopupChildView&) = delete;
 
+  void set_suggestion(const std::u16string& suggestion) {
+    suggestion_ = suggestion;
+  }
+
  private:
   ~AutofillPopupChildView() override {}
 
@@ -92,10 +97,16 @@ class AutofillPopupView : public views::WidgetDelegateView,
                          int index,
                          const gfx::Rect& entry_rect);
 
-  // Creates child views based on the suggestions given by |controller_|. These
-  // child views are used for accessibility events only. We need child views to
+  // Updates the child views to the suggestions in the visible rows, adding or
+  // removing views only when the number of visible rows changed. These child
+  // views are used for accessibility events only. We need child views to
   // populate the correct |AXNodeData| when user selects a suggestion.
-  void CreateChildViews();
+  void UpdateChildViews();
+
+  // Scrolls so that the rows from |first_line| on are visible.
+  void ScrollTo(int first_line);
+  // Scrolls |line| into view, if it is not visible yet.
+  void ScrollToLine(int line);
 
   void DoUpdateBoundsAndRedrawPopup();
 
@@ -106,6 +117,7 @@ class AutofillPopupView : public views::WidgetDelegateView,
   bool OnMouseDragged(const ui::MouseEvent& event) override;
   void OnMouseExited(const ui::MouseEvent& event) override;
   void OnMouseMoved(const ui::MouseEvent& event) override;
+  bool OnMouseWheel(const ui::MouseWheelEvent& event) override;
   bool OnMousePressed(const ui::MouseEvent& event) override;
   void OnMouseReleased(const ui::MouseEvent& event) override;
   void OnGestureEvent(ui::GestureEvent* event) override;
@@ -143,6 +155,9 @@ class AutofillPopupView : public views::WidgetDelegateView,
   // The index of the currently selected line
   std::optional<int> selected_line_;
 
+  // The index of the line in the first visible row
+  int first_visible_line_ = 0;
+
   std::unique_ptr<OffscreenViewProxy> view_proxy_;
 
   // The registered keypress callback, responsible for switching lines on
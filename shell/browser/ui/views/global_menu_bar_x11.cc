@@ -7,6 +7,8 @@
 #include <dlfcn.h>
 #include <glib-object.h>
 
+#include <vector>
+
 #include "base/functional/bind.h"
 #include "base/logging.h"
 #include "base/strings/stringprintf.h"
@@ -31,7 +33,11 @@ typedef DbusmenuMenuitem* (*dbusmenu_menuitem_new_with_id_func)(int id);
 
 typedef int (*dbusmenu_menuitem_get_id_func)(DbusmenuMenuitem* item);
 typedef GList* (*dbusmenu_menuitem_get_children_func)(DbusmenuMenuitem* item);
-typedef DbusmenuMenuitem* (*dbusmenu_menuitem_child_append_func)(
+typedef gboolean (*dbusmenu_menuitem_child_add_position_func)(
+    DbusmenuMenuitem* parent,
+    DbusmenuMenuitem* child,
+    guint position);
+typedef gboolean (*dbusmenu_menuitem_child_delete_func)(
     DbusmenuMenuitem* parent,
     DbusmenuMenuitem* child);
 typedef DbusmenuMenuitem* (*dbusmenu_menuitem_property_set_func)(
@@ -50,6 +56,8 @@ typedef DbusmenuMenuitem* (*dbusmenu_menuitem_property_set_int_func)(
     DbusmenuMenuitem* item,
     const char* property,
     int value);
+typedef void (*dbusmenu_menuitem_property_remove_func)(DbusmenuMenuitem* item,
+                                                       const char* property);
 
 typedef struct _DbusmenuServer DbusmenuServer;
 typedef DbusmenuServer* (*dbusmenu_server_new_func)(const char* object);
@@ -67,13 +75,14 @@ dbusmenu_menuitem_new_func menuitem_new = nullptr;
 dbusmenu_menuitem_new_with_id_func menuitem_new_with_id = nullptr;
 dbusmenu_menuitem_get_id_func menuitem_get_id = nullptr;
 dbusmenu_menuitem_get_children_func menuitem_get_children = nullptr;
-dbusmenu_menuitem_get_children_func menuitem_take_children = nullptr;
-dbusmenu_menuitem_child_append_func menuitem_child_append = nullptr;
+dbusmenu_menuitem_child_add_position_func menuitem_child_add_position = nullptr;
+dbusmenu_menuitem_child_delete_func menuitem_child_delete = nullptr;
 dbusmenu_menuitem_property_set_func menuitem_property_set = nullptr;
 dbusmenu_menuitem_property_set_variant_func menuitem_property_set_variant =
     nullptr;
 dbusmenu_menuitem_property_set_bool_func menuitem_property_set_bool = nullptr;
 dbusmenu_menuitem_property_set_int_func menuitem_property_set_int = nullptr;
+dbusmenu_menuitem_property_remove_func menuitem_property_remove = nullptr;
 
 // DbusmenuServer methods:
 dbusmenu_server_new_func server_new = nullptr;
@@ -115,11 +124,11 @@ void EnsureMethodsLoaded() {
       dlsym(dbusmenu_lib, "dbusmenu_menuitem_get_id"));
   menuitem_get_children = reinterpret_cast<dbusmenu_menuitem_get_children_func>(
       dlsym(dbusmenu_lib, "dbusmenu_menuitem_get_children"));
-  menuitem_take_children =
-      reinterpret_cast<dbusmenu_menuitem_get_children_func>(
-          dlsym(dbusmenu_lib, "dbusmenu_menuitem_take_children"));
-  menuitem_child_append = reinterpret_cast<dbusmenu_menuitem_child_append_func>(
-      dlsym(dbusmenu_lib, "dbusmenu_menuitem_child_append"));
+  menuitem_child_add_position =
+      reinterpret_cast<dbusmenu_menuitem_child_add_position_func>(
+          dlsym(dbusmenu_lib, "dbusmenu_menuitem_child_add_position"));
+  menuitem_child_delete = reinterpret_cast<dbusmenu_menuitem_child_delete_func>(
+      dlsym(dbusmenu_lib, "dbusmenu_menuitem_child_delete"));
   menuitem_property_set = reinterpret_cast<dbusmenu_menuitem_property_set_func>(
       dlsym(dbusmenu_lib, "dbusmenu_menuitem_property_set"));
   menuitem_property_set_variant =
@@ -131,6 +140,9 @@ void EnsureMethodsLoaded() {
   menuitem_property_set_int =
       reinterpret_cast<dbusmenu_menuitem_property_set_int_func>(
           dlsym(dbusmenu_lib, "dbusmenu_menuitem_property_set_int"));
+  menuitem_property_remove =
+      reinterpret_cast<dbusmenu_menuitem_property_remove_func>(
+          dlsym(dbusmenu_lib, "dbusmenu_menuitem_property_remove"));
 
   // DbusmenuServer methods.
   server_new = reinterpret_cast<dbusmenu_server_new_func>(
@@ -161,16 +173,24 @@ void SetMenuItemID(DbusmenuMenuitem* item, int id) {
   g_object_set_data(G_OBJECT(item), "menu-id", GINT_TO_POINTER(id + 1));
 }
 
-std::string GetMenuModelStatus(ElectronMenuModel* model) {
-  std::string ret;
-  for (size_t i = 0; i < model->GetItemCount(); ++i) {
-    int status = model->GetTypeAt(i) | (model->IsVisibleAt(i) << 3) |
-                 (model->IsEnabledAt(i) << 4) |
-                 (model->IsItemCheckedAt(i) << 5);
-    ret += base::StringPrintf(
-        "%s-%X\n", base::UTF16ToUTF8(model->GetLabelAt(i)).c_str(), status);
+// Items can only be updated in place by items of the same kind, since the
+// signals connected to them and the "type" property depend on it.
+enum class ItemKind { kSeparator, kSubmenu, kCommand };
+
+ItemKind GetItemKind(ElectronMenuModel::ItemType type) {
+  switch (type) {
+    case ElectronMenuModel::TYPE_SEPARATOR:
+      return ItemKind::kSeparator;
+    case ElectronMenuModel::TYPE_SUBMENU:
+      return ItemKind::kSubmenu;
+    default:
+      return ItemKind::kCommand;
   }
-  return ret;
+}
+
+ItemKind GetItemKind(DbusmenuMenuitem* item) {
+  return static_cast<ItemKind>(
+      GPOINTER_TO_INT(g_object_get_data(G_OBJECT(item), "kind")));
 }
 
 }  // namespace
@@ -187,6 +207,8 @@ GlobalMenuBarX11::GlobalMenuBarX11(NativeWindowViews* window)
 }
 
 GlobalMenuBarX11::~GlobalMenuBarX11() {
+  if (root_item_)
+    g_object_unref(root_item_);
   if (IsServerStarted())
     g_object_unref(server_);
 
@@ -203,15 +225,14 @@ void GlobalMenuBarX11::SetMenu(ElectronMenuModel* menu_model) {
   if (!IsServerStarted())
     return;
 
-  DbusmenuMenuitem* root_item = menuitem_new();
-  menuitem_property_set(root_item, kPropertyLabel, "Root");
-  menuitem_property_set_bool(root_item, kPropertyVisible, true);
-  if (menu_model != nullptr) {
-    BuildMenuFromModel(menu_model, root_item);
+  if (!root_item_) {
+    root_item_ = menuitem_new();
+    menuitem_property_set(root_item_, kPropertyLabel, "Root");
+    menuitem_property_set_bool(root_item_, kPropertyVisible, true);
+    server_set_root(server_, root_item_);
   }
 
-  server_set_root(server_, root_item);
-  g_object_unref(root_item);
+  UpdateMenuFromModel(menu_model, root_item_);
 }
 
 bool GlobalMenuBarX11::IsServerStarted() const {
@@ -231,8 +252,35 @@ void GlobalMenuBarX11::OnWindowUnmapped() {
   GlobalMenuBarRegistrarX11::GetInstance()->OnWindowUnmapped(xwindow_);
 }
 
-void GlobalMenuBarX11::BuildMenuFromModel(ElectronMenuModel* model,
-                                          DbusmenuMenuitem* parent) {
+void GlobalMenuBarX11::UpdateMenuFromModel(ElectronMenuModel* model,
+                                           DbusmenuMenuitem* parent) {
+  std::vector<DbusmenuMenuitem*> old_items;
+  for (GList* child = menuitem_get_children(parent); child;
+       child = child->next) {
+    old_items.push_back(static_cast<DbusmenuMenuitem*>(child->data));
+  }
+
+  const size_t count = model ? model->GetItemCount() : 0;
+  for (size_t i = 0; i < count; ++i) {
+    ElectronMenuModel::ItemType type = model->GetTypeAt(i);
+    DbusmenuMenuitem* item = i < old_items.size() ? old_items[i] : nullptr;
+    if (item && GetItemKind(item) != GetItemKind(type)) {
+      menuitem_child_delete(parent, item);
+      item = nullptr;
+    }
+    if (!item) {
+      item = CreateMenuItem(type);
+      menuitem_child_add_position(parent, item, i);
+      g_object_unref(item);
+    }
+    UpdateMenuItem(model, i, item);
+  }
+  for (size_t i = count; i < old_items.size(); ++i)
+    menuitem_child_delete(parent, old_items[i]);
+}
+
+DbusmenuMenuitem* GlobalMenuBarX11::CreateMenuItem(
+    ElectronMenuModel::ItemType type) {
   auto connect = [&](auto* sender, const char* detailed_signal, auto receiver) {
     // Unretained() is safe since GlobalMenuBarX11 will own the
     // ScopedGSignal.
@@ -240,46 +288,68 @@ void GlobalMenuBarX11::BuildMenuFromModel(ElectronMenuModel* model,
         sender, detailed_signal,
         base::BindRepeating(receiver, base::Unretained(this)));
   };
-  for (size_t i = 0; i < model->GetItemCount(); ++i) {
-    DbusmenuMenuitem* item = menuitem_new();
-    menuitem_property_set_bool(item, kPropertyVisible, model->IsVisibleAt(i));
-
-    ElectronMenuModel::ItemType type = model->GetTypeAt(i);
-    if (type == ElectronMenuModel::TYPE_SEPARATOR) {
+  DbusmenuMenuitem* item = menuitem_new();
+  const ItemKind kind = GetItemKind(type);
+  g_object_set_data(G_OBJECT(item), "kind",
+                    GINT_TO_POINTER(static_cast<int>(kind)));
+  switch (kind) {
+    case ItemKind::kSeparator:
       menuitem_property_set(item, kPropertyType, kTypeSeparator);
-    } else {
-      std::string label = ui::ConvertAcceleratorsFromWindowsStyle(
-          base::UTF16ToUTF8(model->GetLabelAt(i)));
-      menuitem_property_set(item, kPropertyLabel, label.c_str());
-      menuitem_property_set_bool(item, kPropertyEnabled, model->IsEnabledAt(i));
-
-      g_object_set_data(G_OBJECT(item), "model", model);
-      SetMenuItemID(item, i);
-
-      if (type == ElectronMenuModel::TYPE_SUBMENU) {
-        menuitem_property_set(item, kPropertyChildrenDisplay, kDisplaySubmenu);
-        connect(item, "about-to-show", &GlobalMenuBarX11::OnSubMenuShow);
-      } else {
-        ui::Accelerator accelerator;
-        if (model->GetAcceleratorAtWithParams(i, true, &accelerator))
-          RegisterAccelerator(item, accelerator);
-
-        connect(item, "item-activated", &GlobalMenuBarX11::OnItemActivated);
-
-        if (type == ElectronMenuModel::TYPE_CHECK ||
-            type == ElectronMenuModel::TYPE_RADIO) {
-          menuitem_property_set(item, kPropertyToggleType,
-                                type == ElectronMenuModel::TYPE_CHECK
-                                    ? kToggleCheck
-                                    : kToggleRadio);
-          menuitem_property_set_int(item, kPropertyToggleState,
-                                    model->IsItemCheckedAt(i));
-        }
-      }
-    }
+      break;
+    case ItemKind::kSubmenu:
+      menuitem_property_set(item, kPropertyChildrenDisplay, kDisplaySubmenu);
+      connect(item, "about-to-show", &GlobalMenuBarX11::OnSubMenuShow);
+      break;
+    case ItemKind::kCommand:
+      connect(item, "item-activated", &GlobalMenuBarX11::OnItemActivated);
+      break;
+  }
+  return item;
+}
+
+void GlobalMenuBarX11::UpdateMenuItem(ElectronMenuModel* model,
+                                      size_t index,
+                                      DbusmenuMenuitem* item) {
+  // Setting a property to its current value does not signal a change, so
+  // every property is simply set again.
+  menuitem_property_set_bool(item, kPropertyVisible, model->IsVisibleAt(index));
+
+  ElectronMenuModel::ItemType type = model->GetTypeAt(index);
+  if (type == ElectronMenuModel::TYPE_SEPARATOR)
+    return;
+
+  std::string label = ui::ConvertAcceleratorsFromWindowsStyle(
+      base::UTF16ToUTF8(model->GetLabelAt(index)));
+  menuitem_property_set(item, kPropertyLabel, label.c_str());
+  menuitem_property_set_bool(item, kPropertyEnabled, model->IsEnabledAt(index));
+
+  g_object_set_data(G_OBJECT(item), "model", model);
+  SetMenuItemID(item, index);
 
-    menuitem_child_append(parent, item);
-    g_object_unref(item);
+  if (type == ElectronMenuModel::TYPE_SUBMENU) {
+    // Submenus are built when they are first shown; once they have been,
+    // keep them in sync so that they never refer to a stale model.
+    if (menuitem_get_children(item))
+      UpdateMenuFromModel(model->GetSubmenuModelAt(index), item);
+    return;
+  }
+
+  ui::Accelerator accelerator;
+  if (model->GetAcceleratorAtWithParams(index, true, &accelerator))
+    RegisterAccelerator(item, accelerator);
+  else
+    menuitem_property_remove(item, kPropertyShortcut);
+
+  if (type == ElectronMenuModel::TYPE_CHECK ||
+      type == ElectronMenuModel::TYPE_RADIO) {
+    menuitem_property_set(
+        item, kPropertyToggleType,
+        type == ElectronMenuModel::TYPE_CHECK ? kToggleCheck : kToggleRadio);
+    menuitem_property_set_int(item, kPropertyToggleState,
+                              model->IsItemCheckedAt(index));
+  } else {
+    menuitem_property_remove(item, kPropertyToggleType);
+    menuitem_property_remove(item, kPropertyToggleState);
   }
 }
 
@@ -328,23 +398,9 @@ void GlobalMenuBarX11::OnSubMenuShow(DbusmenuMenuitem* item) {
   if (!model || !GetMenuItemID(item, &id))
     return;
 
-  // Do not update menu if the submenu has not been changed.
-  std::string status = GetMenuModelStatus(model);
-  char* old = static_cast<char*>(g_object_get_data(G_OBJECT(item), "status"));
-  if (old && status == old)
-    return;
-
-  // Save the new status.
-  g_object_set_data_full(G_OBJECT(item), "status", g_strdup(status.c_str()),
-                         g_free);
-
-  // Clear children.
-  GList* children = menuitem_take_children(item);
-  g_list_foreach(children, reinterpret_cast<GFunc>(g_object_unref), nullptr);
-  g_list_free(children);
-
-  // Build children.
-  BuildMenuFromModel(model->GetSubmenuModelAt(id), item);
+  // Only the items of the submenu that changed since it was last shown are
+  // exported again.
+  UpdateMenuFromModel(model->GetSubmenuModelAt(id), item);
 }
 
 }  // namespace electron
@@ -59,8 +59,17 @@ class GlobalMenuBarX11 {
   // Creates a DbusmenuServer.
   void InitServer(x11::Window window);
 
-  // Create a menu from menu model.
-  void BuildMenuFromModel(ElectronMenuModel* model, DbusmenuMenuitem* parent);
+  // Makes the children of |parent| match the items of |model|. Items whose
+  // type is unchanged are updated in place, and only the properties that
+  // changed are signalled to the desktop shell; items are only added or
+  // removed where the structure of the menu changed, so the shell just
+  // refetches the layout below those parents.
+  void UpdateMenuFromModel(ElectronMenuModel* model, DbusmenuMenuitem* parent);
+
+  DbusmenuMenuitem* CreateMenuItem(ElectronMenuModel::ItemType type);
+  void UpdateMenuItem(ElectronMenuModel* model,
+                      size_t index,
+                      DbusmenuMenuitem* item);
 
   // Sets the accelerator for |item|.
   void RegisterAccelerator(DbusmenuMenuitem* item,
@@ -73,6 +82,9 @@ class GlobalMenuBarX11 {
   x11::Window xwindow_;
 
   raw_ptr<DbusmenuServer> server_ = nullptr;
+  // Kept across SetMenu() calls so that menu changes can be exported
+  // incrementally.
+  raw_ptr<DbusmenuMenuitem> root_item_ = nullptr;
   std::vector<ScopedGSignal> signals_;
 };
 
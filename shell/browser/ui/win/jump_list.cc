@@ -6,7 +6,14 @@
 
 #include <propkey.h>  // for PKEY_* constants
 
+#include "base/functional/bind.h"
+#include "base/functional/callback_helpers.h"
 #include "base/logging.h"
+#include "base/no_destructor.h"
+#include "base/synchronization/waitable_event.h"
+#include "base/task/sequenced_task_runner.h"
+#include "base/task/thread_pool.h"
+#include "base/threading/thread_restrictions.h"
 #include "base/win/scoped_co_mem.h"
 #include "base/win/scoped_propvariant.h"
 #include "base/win/win_util.h"
@@ -355,4 +362,61 @@ JumpListResult JumpList::AppendCategories(
   return result;
 }
 
+JumpListResult UpdateJumpList(
+    const std::wstring& app_id,
+    const std::optional<std::vector<JumpListCategory>>& categories) {
+  JumpList jump_list(app_id);
+
+  if (!categories) {
+    return jump_list.Delete() ? JumpListResult::kSuccess
+                              : JumpListResult::kGenericError;
+  }
+
+  // Start a transaction that updates the JumpList of this application.
+  if (!jump_list.Begin())
+    return JumpListResult::kGenericError;
+
+  JumpListResult result = jump_list.AppendCategories(*categories);
+  // AppendCategories may have failed to add some categories, but it's better
+  // to have something than nothing so try to commit the changes anyway.
+  if (!jump_list.Commit()) {
+    LOG(ERROR) << "Failed to commit changes to custom Jump List.";
+    // It's more useful to return the earlier error code that might give
+    // some indication as to why the transaction actually failed, so don't
+    // overwrite it with a "generic error" code here.
+    if (result == JumpListResult::kSuccess)
+      result = JumpListResult::kGenericError;
+  }
+
+  return result;
+}
+
+scoped_refptr<base::SequencedTaskRunner> GetJumpListTaskRunner() {
+  static base::NoDestructor<scoped_refptr<base::SingleThreadTaskRunner>>
+      task_runner(base::ThreadPool::CreateCOMSTATaskRunner(
+          {base::MayBlock(), base::TaskPriority::USER_VISIBLE,
+           base::TaskShutdownBehavior::SKIP_ON_SHUTDOWN}));
+  return *task_runner;
+}
+
+// The use of the ForTesting flavor is a hack workaround to avoid having to
+// patch this as a friend into the associated guard class.
+class [[maybe_unused, nodiscard]] JumpListScopedAllowBaseSyncPrimitives
+    : public base::ScopedAllowBaseSyncPrimitivesForTesting {};
+
+void RunOnJumpListTaskRunnerAndWait(base::OnceClosure task) {
+  base::WaitableEvent done;
+  // The event is also signaled if the task is dropped at shutdown.
+  base::ScopedClosureRunner signal_done(base::BindOnce(
+      &base::WaitableEvent::Signal, base::Unretained(&done)));
+  GetJumpListTaskRunner()->PostTask(
+      FROM_HERE, base::BindOnce(
+                     [](base::OnceClosure task, base::ScopedClosureRunner) {
+                       std::move(task).Run();
+                     },
+                     std::move(task), std::move(signal_done)));
+  JumpListScopedAllowBaseSyncPrimitives allow_base_sync_primitives;
+  done.Wait();
+}
+
 }  // namespace electron
@@ -7,9 +7,17 @@
 
 #include <atlbase.h>
 #include <shobjidl.h>
+#include <optional>
+#include <string>
 #include <vector>
 
 #include "base/files/file_path.h"
+#include "base/functional/callback_forward.h"
+#include "base/memory/scoped_refptr.h"
+
+namespace base {
+class SequencedTaskRunner;
+}
 
 namespace electron {
 
@@ -118,6 +126,22 @@ class JumpList {
   CComPtr<ICustomDestinationList> destinations_;
 };
 
+// Replaces the custom Jump List of |app_id| with |categories|, or deletes it
+// when |categories| is nullopt.
+JumpListResult UpdateJumpList(
+    const std::wstring& app_id,
+    const std::optional<std::vector<JumpListCategory>>& categories);
+
+// The COM STA sequence that asynchronous Jump List and recent documents
+// updates run on. The shell can take hundreds of milliseconds to handle them
+// when it is busy, which must not block the UI thread.
+scoped_refptr<base::SequencedTaskRunner> GetJumpListTaskRunner();
+
+// Runs |task| on GetJumpListTaskRunner() and blocks until it is done, so a
+// synchronous update can't be overtaken by an asynchronous one that was
+// already running.
+void RunOnJumpListTaskRunnerAndWait(base::OnceClosure task);
+
 }  // namespace electron
 
 #endif  // ELECTRON_SHELL_BROWSER_UI_WIN_JUMP_LIST_H_
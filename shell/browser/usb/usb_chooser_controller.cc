@@ -77,6 +77,9 @@ void UsbChooserController::OnDeviceAdded(
 
 void UsbChooserController::OnDeviceRemoved(
     const device::mojom::UsbDeviceInfo& device_info) {
+  if (!DisplayDevice(device_info))
+    return;
+
   api::Session* session = GetSession();
   if (session) {
     session->Emit("usb-device-removed", device_info.Clone(), web_contents());
@@ -13,6 +13,10 @@
 #include "base/command_line.h"
 #include "base/containers/fixed_flat_map.h"
 #include "base/memory/ptr_util.h"
+#include "base/strings/string_number_conversions.h"
+#include "base/strings/strcat.h"
+#include "base/strings/string_util.h"
+#include "base/strings/stringprintf.h"
 #include "base/strings/utf_string_conversions.h"
 #include "cc/base/switches.h"
 #include "content/public/browser/render_frame_host.h"
@@ -115,7 +119,9 @@ void WebContentsPreferences::Clear() {
   experimental_features_ = false;
   node_integration_ = false;
   node_integration_in_sub_frames_ = false;
+  shared_node_integration_in_sub_frames_ = false;
   node_integration_in_worker_ = false;
+  lazy_node_integration_in_worker_ = false;
   disable_html_fullscreen_window_resize_ = false;
   webview_tag_ = false;
   sandbox_ = std::nullopt;
@@ -141,6 +147,7 @@ void WebContentsPreferences::Clear() {
   custom_switches_.clear();
   enable_blink_features_ = std::nullopt;
   disable_blink_features_ = std::nullopt;
+  process_group_ = std::nullopt;
   disable_popups_ = false;
   disable_dialogs_ = false;
   safe_dialogs_ = false;
@@ -151,6 +158,9 @@ void WebContentsPreferences::Clear() {
       blink::mojom::ImageAnimationPolicy::kImageAnimationPolicyAllowed;
   preload_path_ = std::nullopt;
   v8_cache_options_ = blink::mojom::V8CacheOptions::kDefault;
+  max_semi_space_size_ = std::nullopt;
+  max_old_space_size_ = std::nullopt;
+  optimize_for_size_ = false;
 
 #if BUILDFLAG(IS_MAC)
   scroll_bounce_ = false;
@@ -169,8 +179,12 @@ void WebContentsPreferences::SetFromDictionary(
   web_preferences.Get(options::kNodeIntegration, &node_integration_);
   web_preferences.Get(options::kNodeIntegrationInSubFrames,
                       &node_integration_in_sub_frames_);
+  web_preferences.Get(options::kSharedNodeIntegrationInSubFrames,
+                      &shared_node_integration_in_sub_frames_);
   web_preferences.Get(options::kNodeIntegrationInWorker,
                       &node_integration_in_worker_);
+  web_preferences.Get(options::kLazyNodeIntegrationInWorker,
+                      &lazy_node_integration_in_worker_);
   web_preferences.Get(options::kDisableHtmlFullscreenWindowResize,
                       &disable_html_fullscreen_window_resize_);
   web_preferences.Get(options::kWebviewTag, &webview_tag_);
@@ -191,7 +205,11 @@ void WebContentsPreferences::SetFromDictionary(
                            &allow_running_insecure_content_) &&
       !web_security_)
     allow_running_insecure_content_ = true;
-  web_preferences.Get(options::kOffscreen, &offscreen_);
+  gin_helper::Dictionary offscreen;
+  if (web_preferences.Get(options::kOffscreen, &offscreen))
+    offscreen_ = true;
+  else
+    web_preferences.Get(options::kOffscreen, &offscreen_);
   web_preferences.Get(options::kNavigateOnDragDrop, &navigate_on_drag_drop_);
   web_preferences.Get("autoplayPolicy", &autoplay_policy_);
   web_preferences.Get("defaultFontFamily", &default_font_family_);
@@ -231,6 +249,10 @@ void WebContentsPreferences::SetFromDictionary(
   if (web_preferences.Get(options::kDisableBlinkFeatures,
                           &disable_blink_features))
     disable_blink_features_ = disable_blink_features;
+  std::string process_group;
+  if (web_preferences.Get(options::kProcessGroup, &process_group) &&
+      !process_group.empty())
+    process_group_ = process_group;
 
   base::FilePath::StringType preload_path;
   if (web_preferences.Get(options::kPreloadScript, &preload_path)) {
@@ -249,6 +271,16 @@ void WebContentsPreferences::SetFromDictionary(
 
   web_preferences.Get("v8CacheOptions", &v8_cache_options_);
 
+  gin_helper::Dictionary heap_limits;
+  if (web_preferences.Get("heapLimits", &heap_limits)) {
+    int size;
+    if (heap_limits.Get("maxSemiSpaceSize", &size) && size > 0)
+      max_semi_space_size_ = size;
+    if (heap_limits.Get("maxOldSpaceSize", &size) && size > 0)
+      max_old_space_size_ = size;
+    heap_limits.Get("optimizeForSize", &optimize_for_size_);
+  }
+
 #if BUILDFLAG(IS_MAC)
   web_preferences.Get(options::kScrollBounce, &scroll_bounce_);
 #endif
@@ -325,6 +357,45 @@ WebContentsPreferences* WebContentsPreferences::From(
 void WebContentsPreferences::AppendCommandLineSwitches(
     base::CommandLine* command_line,
     bool is_subframe) {
+  AppendRendererSwitches(command_line, is_subframe);
+
+  // We are appending args to a webContents so let's save the current state
+  // of our preferences object so that during the lifetime of the WebContents
+  // we can fetch the options used to initially configure the WebContents
+  // last_preference_ = preference_.Clone();
+  SaveLastPreferences();
+}
+
+std::optional<std::string> WebContentsPreferences::GetProcessGroupKey(
+    bool is_subframe) const {
+  if (!process_group_)
+    return std::nullopt;
+
+  base::CommandLine command_line(base::CommandLine::NO_PROGRAM);
+  AppendRendererSwitches(&command_line, is_subframe);
+#if BUILDFLAG(IS_WIN)
+  std::string switches = base::WideToUTF8(command_line.GetArgumentsString());
+#else
+  std::string switches = command_line.GetArgumentsString();
+#endif
+  // The preferences that decide what a page can reach beyond the web are
+  // part of the key too, so a page with Node.js or without isolation never
+  // shares a process, and so an address space, with a page that is meant to
+  // be isolated from it. They would otherwise be free to differ because they
+  // only travel with each frame's blink preferences.
+  base::FilePath preload_path;
+  GetPreloadPath(&preload_path);
+  std::string security = base::StringPrintf(
+      "%d%d%d%d%d%d%d%d", node_integration_, node_integration_in_sub_frames_,
+      node_integration_in_worker_, lazy_node_integration_in_worker_,
+      context_isolation_, IsSandboxed(), web_security_, webview_tag_);
+  return base::StrCat({*process_group_, "\n", security, "\n",
+                       preload_path.AsUTF8Unsafe(), "\n", switches});
+}
+
+void WebContentsPreferences::AppendRendererSwitches(
+    base::CommandLine* command_line,
+    bool is_subframe) const {
   // Experimental flags.
   if (experimental_features_)
     command_line->AppendSwitch(
@@ -364,14 +435,43 @@ void WebContentsPreferences::AppendCommandLineSwitches(
     command_line->AppendSwitchASCII(::switches::kDisableBlinkFeatures,
                                     *disable_blink_features_);
 
-  if (node_integration_in_worker_)
-    command_line->AppendSwitch(switches::kNodeIntegrationInWorker);
+  // V8 heap limits, merged into any --js-flags propagated from the browser
+  // process so that the per-window values take precedence.
+  if (HasHeapLimits()) {
+    std::string js_flags =
+        command_line->GetSwitchValueASCII(::switches::kJavaScriptFlags);
+    if (max_semi_space_size_)
+      js_flags += " --max-semi-space-size=" +
+                  base::NumberToString(*max_semi_space_size_);
+    if (max_old_space_size_)
+      js_flags += " --max-old-space-size=" +
+                  base::NumberToString(*max_old_space_size_);
+    if (optimize_for_size_)
+      js_flags += " --optimize-for-size";
+    command_line->AppendSwitchASCII(
+        ::switches::kJavaScriptFlags,
+        base::TrimWhitespaceASCII(js_flags, base::TRIM_LEADING));
+  }
+}
 
-  // We are appending args to a webContents so let's save the current state
-  // of our preferences object so that during the lifetime of the WebContents
-  // we can fetch the options used to initially configure the WebContents
-  // last_preference_ = preference_.Clone();
-  SaveLastPreferences();
+bool WebContentsPreferences::CanUseSpareRenderProcessHost(
+    bool is_subframe) const {
+  // Spare renderers have no web contents when they are launched, so they
+  // only get the sandbox switch.
+  bool can_sandbox_frame = is_subframe && !node_integration_in_sub_frames_;
+  if (!IsSandboxed() && !can_sandbox_frame)
+    return false;
+#if BUILDFLAG(IS_MAC)
+  if (scroll_bounce_)
+    return false;
+#endif
+  return !experimental_features_ && custom_args_.empty() &&
+         custom_switches_.empty() && !enable_blink_features_ &&
+         !disable_blink_features_ && !HasHeapLimits();
+}
+
+bool WebContentsPreferences::HasHeapLimits() const {
+  return max_semi_space_size_ || max_old_space_size_ || optimize_for_size_;
 }
 
 void WebContentsPreferences::SaveLastPreferences() {
@@ -484,7 +584,10 @@ void WebContentsPreferences::OverrideWebkitPrefs(
 
   prefs->node_integration = node_integration_;
   prefs->node_integration_in_worker = node_integration_in_worker_;
+  prefs->lazy_node_integration_in_worker = lazy_node_integration_in_worker_;
   prefs->node_integration_in_sub_frames = node_integration_in_sub_frames_;
+  prefs->shared_node_integration_in_sub_frames =
+      shared_node_integration_in_sub_frames_;
 
 #if BUILDFLAG(ENABLE_BUILTIN_SPELLCHECKER)
   prefs->enable_spellcheck = spellcheck_;
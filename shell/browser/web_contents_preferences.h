@@ -6,6 +6,7 @@
 #define ELECTRON_SHELL_BROWSER_WEB_CONTENTS_PREFERENCES_H_
 
 #include <map>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -44,10 +45,24 @@ class WebContentsPreferences
 
   void SetFromDictionary(const gin_helper::Dictionary& new_web_preferences);
 
-  // Append command parameters according to preferences.
+  // Append command parameters according to preferences. Only preferences that
+  // configure the whole renderer process belong here, those that can differ
+  // between the frames of a process are sent with the frames' blink
+  // preferences in OverrideWebkitPrefs.
   void AppendCommandLineSwitches(base::CommandLine* command_line,
                                  bool is_subframe);
 
+  // Returns the key of the renderer processes this web contents may share
+  // with others, or std::nullopt if it doesn't set |processGroup|. Web
+  // contents only share a process when they are in the same group and would
+  // launch it with the same command line and the same Node.js, isolation,
+  // sandbox, preload and web security settings.
+  std::optional<std::string> GetProcessGroupKey(bool is_subframe) const;
+
+  // Whether AppendCommandLineSwitches would append nothing beyond what a
+  // spare renderer is launched with, so that one can be adopted.
+  bool CanUseSpareRenderProcessHost(bool is_subframe) const;
+
   // Modify the WebPreferences according to preferences.
   void OverrideWebkitPrefs(blink::web_pref::WebPreferences* prefs,
                            blink::RendererPreferences* renderer_prefs);
@@ -93,6 +108,14 @@ class WebContentsPreferences
   void Clear();
   void SaveLastPreferences();
 
+  // Appends the switches of AppendCommandLineSwitches without recording the
+  // preferences.
+  void AppendRendererSwitches(base::CommandLine* command_line,
+                              bool is_subframe) const;
+
+  // Whether any of the V8 heap limits in |heapLimits| were set.
+  bool HasHeapLimits() const;
+
   // TODO(clavin): refactor to use the WebContents provided by the
   // WebContentsUserData base class instead of storing a duplicate ref
   raw_ptr<content::WebContents> web_contents_;
@@ -101,7 +124,9 @@ class WebContentsPreferences
   bool experimental_features_;
   bool node_integration_;
   bool node_integration_in_sub_frames_;
+  bool shared_node_integration_in_sub_frames_;
   bool node_integration_in_worker_;
+  bool lazy_node_integration_in_worker_;
   bool disable_html_fullscreen_window_resize_;
   bool webview_tag_;
   std::optional<bool> sandbox_;
@@ -127,6 +152,7 @@ class WebContentsPreferences
   std::vector<std::string> custom_switches_;
   std::optional<std::string> enable_blink_features_;
   std::optional<std::string> disable_blink_features_;
+  std::optional<std::string> process_group_;
   bool disable_popups_;
   bool disable_dialogs_;
   bool safe_dialogs_;
@@ -136,6 +162,9 @@ class WebContentsPreferences
   blink::mojom::ImageAnimationPolicy image_animation_policy_;
   std::optional<base::FilePath> preload_path_;
   blink::mojom::V8CacheOptions v8_cache_options_;
+  std::optional<int> max_semi_space_size_;
+  std::optional<int> max_old_space_size_;
+  bool optimize_for_size_;
 
 #if BUILDFLAG(IS_MAC)
   bool scroll_bounce_;
@@ -5,7 +5,9 @@
 #include "shell/browser/web_contents_zoom_controller.h"
 
 #include <string>
+#include <utility>
 
+#include "base/strings/strcat.h"
 #include "content/public/browser/browser_thread.h"
 #include "content/public/browser/navigation_details.h"
 #include "content/public/browser/navigation_entry.h"
@@ -93,8 +95,7 @@ bool WebContentsZoomController::SetZoomLevel(double level) {
     ZoomChangedEventData zoom_change_data(web_contents(), old_zoom_level,
                                           zoom_level_, true /* temporary */,
                                           zoom_mode_);
-    for (auto& observer : observers_)
-      observer.OnZoomChanged(zoom_change_data);
+    NotifyZoomChanged(zoom_change_data);
 
     return true;
   }
@@ -113,8 +114,7 @@ bool WebContentsZoomController::SetZoomLevel(double level) {
     zoom_map->SetTemporaryZoomLevel(rfh_id, level);
     ZoomChangedEventData zoom_change_data(web_contents(), zoom_level_, level,
                                           true /* temporary */, zoom_mode_);
-    for (auto& observer : observers_)
-      observer.OnZoomChanged(zoom_change_data);
+    NotifyZoomChanged(zoom_change_data);
   } else {
     if (!entry) {
       // If we exit without triggering an update, we should clear event_data_,
@@ -140,6 +140,7 @@ double WebContentsZoomController::GetZoomLevel() const {
 
 void WebContentsZoomController::SetDefaultZoomFactor(double factor) {
   default_zoom_factor_ = factor;
+  resolved_zoom_origin_.reset();
 }
 
 void WebContentsZoomController::SetTemporaryZoomLevel(double level) {
@@ -151,8 +152,7 @@ void WebContentsZoomController::SetTemporaryZoomLevel(double level) {
   // Notify observers of zoom level changes.
   ZoomChangedEventData zoom_change_data(web_contents(), zoom_level_, level,
                                         true /* temporary */, zoom_mode_);
-  for (auto& observer : observers_)
-    observer.OnZoomChanged(zoom_change_data);
+  NotifyZoomChanged(zoom_change_data);
 }
 
 bool WebContentsZoomController::UsesTemporaryZoomLevel() {
@@ -217,8 +217,7 @@ void WebContentsZoomController::SetZoomMode(ZoomMode new_mode) {
       } else {
         // When we don't call any HostZoomMap set functions, we send the event
         // manually.
-        for (auto& observer : observers_)
-          observer.OnZoomChanged(*event_data_);
+        NotifyZoomChanged(*event_data_);
         event_data_.reset();
       }
       break;
@@ -233,8 +232,7 @@ void WebContentsZoomController::SetZoomMode(ZoomMode new_mode) {
       } else {
         // When we don't call any HostZoomMap set functions, we send the event
         // manually.
-        for (auto& observer : observers_)
-          observer.OnZoomChanged(*event_data_);
+        NotifyZoomChanged(*event_data_);
         event_data_.reset();
       }
       break;
@@ -278,6 +276,7 @@ void WebContentsZoomController::ResetZoomModeOnNavigationIfNeeded(
   zoom_map->ClearTemporaryZoomLevel(
       web_contents()->GetPrimaryMainFrame()->GetGlobalId());
   zoom_mode_ = ZOOM_MODE_DEFAULT;
+  resolved_zoom_origin_.reset();
 }
 
 void WebContentsZoomController::DidFinishNavigation(
@@ -325,6 +324,7 @@ void WebContentsZoomController::RenderFrameHostChanged(
     return;
 
   host_zoom_map_ = new_host_zoom_map;
+  resolved_zoom_origin_.reset();
   zoom_subscription_ = host_zoom_map_->AddZoomLevelChangedCallback(
       base::BindRepeating(&WebContentsZoomController::OnZoomLevelChanged,
                           base::Unretained(this)));
@@ -356,6 +356,14 @@ void WebContentsZoomController::SetZoomFactorOnNavigationIfNeeded(
   // pref store < kZoomFactor < setZoomLevel
   std::string host = net::GetHostOrSpecFromURL(url);
   std::string scheme = url.scheme();
+
+  // Navigations within the origin whose zoom was last resolved keep that zoom,
+  // unless the HostZoomMap or the default factor changed in between.
+  std::string origin = base::StrCat({scheme, "://", host});
+  if (resolved_zoom_origin_ == origin)
+    return;
+  resolved_zoom_origin_ = std::move(origin);
+
   double zoom_factor = default_zoom_factor();
   double zoom_level = blink::PageZoomFactorToZoomLevel(zoom_factor);
   if (host_zoom_map_->HasZoomLevel(scheme, host)) {
@@ -370,6 +378,7 @@ void WebContentsZoomController::SetZoomFactorOnNavigationIfNeeded(
 void WebContentsZoomController::OnZoomLevelChanged(
     const content::HostZoomMap::ZoomLevelChange& change) {
   DCHECK_CURRENTLY_ON(BrowserThread::UI);
+  resolved_zoom_origin_.reset();
   UpdateState(change.host);
 }
 
@@ -392,17 +401,30 @@ void WebContentsZoomController::UpdateState(const std::string& host) {
     // the change should be sent.
     ZoomChangedEventData zoom_change_data = *event_data_;
     event_data_.reset();
-    for (auto& observer : observers_)
-      observer.OnZoomChanged(zoom_change_data);
+    NotifyZoomChanged(zoom_change_data);
   } else {
     double zoom_level = GetZoomLevel();
+    // Nothing changed since observers were last told, e.g. after a
+    // navigation within the same origin.
+    if (last_notified_zoom_level_ &&
+        blink::PageZoomValuesEqual(*last_notified_zoom_level_, zoom_level) &&
+        last_notified_zoom_mode_ == zoom_mode_) {
+      return;
+    }
     ZoomChangedEventData zoom_change_data(web_contents(), zoom_level,
                                           zoom_level, false, zoom_mode_);
-    for (auto& observer : observers_)
-      observer.OnZoomChanged(zoom_change_data);
+    NotifyZoomChanged(zoom_change_data);
   }
 }
 
+void WebContentsZoomController::NotifyZoomChanged(
+    const ZoomChangedEventData& data) {
+  last_notified_zoom_level_ = data.new_zoom_level;
+  last_notified_zoom_mode_ = data.zoom_mode;
+  for (auto& observer : observers_)
+    observer.OnZoomChanged(data);
+}
+
 WEB_CONTENTS_USER_DATA_KEY_IMPL(WebContentsZoomController);
 
 }  // namespace electron
@@ -5,6 +5,10 @@
 #ifndef ELECTRON_SHELL_BROWSER_WEB_CONTENTS_ZOOM_CONTROLLER_H_
 #define ELECTRON_SHELL_BROWSER_WEB_CONTENTS_ZOOM_CONTROLLER_H_
 
+#include <memory>
+#include <optional>
+#include <string>
+
 #include "base/memory/raw_ptr.h"
 #include "base/observer_list.h"
 #include "base/observer_list_types.h"
@@ -120,6 +124,8 @@ class WebContentsZoomController
   // change only affects sites with the given host.
   void UpdateState(const std::string& host);
 
+  void NotifyZoomChanged(const ZoomChangedEventData& data);
+
   // The current zoom mode.
   ZoomMode zoom_mode_ = ZOOM_MODE_DEFAULT;
 
@@ -134,6 +140,14 @@ class WebContentsZoomController
 
   std::unique_ptr<ZoomChangedEventData> event_data_;
 
+  // The scheme and host the zoom level was last resolved for on navigation,
+  // reset whenever something that zoom depends on changes.
+  std::optional<std::string> resolved_zoom_origin_;
+
+  // The state observers were last notified of, to skip redundant updates.
+  std::optional<double> last_notified_zoom_level_;
+  ZoomMode last_notified_zoom_mode_ = ZOOM_MODE_DEFAULT;
+
   raw_ptr<WebContentsZoomController> embedder_zoom_controller_ = nullptr;
 
   // Observer receiving notifications on state changes.
@@ -2,8 +2,12 @@
 // Use of this source code is governed by the MIT license that can be
 // found in the LICENSE file.
 
+#include <memory>
+#include <string>
+#include <unordered_map>
 #include <vector>
 
+#include "base/memory/raw_ptr.h"
 #include "gin/handle.h"
 #include "shell/common/asar/archive.h"
 #include "shell/common/asar/asar_util.h"
@@ -24,11 +28,19 @@ class Archive : public node::ObjectWrap {
 
     NODE_SET_PROTOTYPE_METHOD(tpl, "getFileInfo", &Archive::GetFileInfo);
     NODE_SET_PROTOTYPE_METHOD(tpl, "stat", &Archive::Stat);
+    NODE_SET_PROTOTYPE_METHOD(tpl, "getType", &Archive::GetType);
     NODE_SET_PROTOTYPE_METHOD(tpl, "readdir", &Archive::Readdir);
+    NODE_SET_PROTOTYPE_METHOD(tpl, "readdirWithTypes",
+                              &Archive::ReaddirWithTypes);
     NODE_SET_PROTOTYPE_METHOD(tpl, "realpath", &Archive::Realpath);
     NODE_SET_PROTOTYPE_METHOD(tpl, "copyFileOut", &Archive::CopyFileOut);
+    NODE_SET_PROTOTYPE_METHOD(tpl, "copyFileOutAsync",
+                              &Archive::CopyFileOutAsync);
     NODE_SET_PROTOTYPE_METHOD(tpl, "getFdAndValidateIntegrityLater",
                               &Archive::GetFD);
+    NODE_SET_PROTOTYPE_METHOD(tpl, "readMapped", &Archive::ReadMapped);
+    NODE_SET_PROTOTYPE_METHOD(tpl, "readCompressed", &Archive::ReadCompressed);
+    NODE_SET_PROTOTYPE_METHOD(tpl, "readCodeCache", &Archive::ReadCodeCache);
 
     return tpl;
   }
@@ -84,6 +96,8 @@ class Archive : public node::ObjectWrap {
     dict.Set("size", info.size);
     dict.Set("unpacked", info.unpacked);
     dict.Set("offset", info.offset);
+    if (info.compression)
+      dict.Set("compressed", true);
     if (info.integrity.has_value()) {
       gin_helper::Dictionary integrity(isolate, v8::Object::New(isolate));
       asar::HashAlgorithm algorithm = info.integrity.value().algorithm;
@@ -124,6 +138,75 @@ class Archive : public node::ObjectWrap {
     args.GetReturnValue().Set(dict.GetHandle());
   }
 
+  // Returns the UV_DIRENT_* type of path, or -1 if it does not exist. This is
+  // what existence checks and module resolution need from stat(), without
+  // building a result object.
+  //
+  // Module resolution probes the same candidate paths over and over, e.g.
+  // every require() of a package from a nested directory checks the same
+  // ancestor node_modules folders, so results are cached. Archives never
+  // change once opened, which makes caching missing paths safe as well.
+  static void GetType(const v8::FunctionCallbackInfo<v8::Value>& args) {
+    auto* isolate = args.GetIsolate();
+    auto* wrap = node::ObjectWrap::Unwrap<Archive>(args.Holder());
+    base::FilePath path;
+    if (!gin::ConvertFromV8(isolate, args[0], &path) || !wrap->archive_) {
+      args.GetReturnValue().Set(-1);
+      return;
+    }
+
+    auto it = wrap->type_cache_.find(path.value());
+    if (it != wrap->type_cache_.end()) {
+      args.GetReturnValue().Set(it->second);
+      return;
+    }
+
+    asar::Archive::Stats stats;
+    const int type = wrap->archive_->Stat(path, &stats)
+                         ? static_cast<int>(stats.type)
+                         : -1;
+    if (wrap->type_cache_.size() >= kMaxTypeCacheSize)
+      wrap->type_cache_.clear();
+    wrap->type_cache_.emplace(path.value(), type);
+    args.GetReturnValue().Set(type);
+  }
+
+  // Returns [names, types] for all files under a directory, where types is a
+  // Uint8Array holding the UV_DIRENT_* type of each name, or UV_DIRENT_UNKNOWN
+  // if the entry could not be found.
+  static void ReaddirWithTypes(
+      const v8::FunctionCallbackInfo<v8::Value>& args) {
+    auto* isolate = args.GetIsolate();
+    auto* wrap = node::ObjectWrap::Unwrap<Archive>(args.Holder());
+    base::FilePath path;
+    if (!gin::ConvertFromV8(isolate, args[0], &path)) {
+      args.GetReturnValue().Set(v8::False(isolate));
+      return;
+    }
+
+    std::vector<base::FilePath> files;
+    if (!wrap->archive_ || !wrap->archive_->Readdir(path, &files)) {
+      args.GetReturnValue().Set(v8::False(isolate));
+      return;
+    }
+
+    v8::Local<v8::ArrayBuffer> buffer =
+        v8::ArrayBuffer::New(isolate, files.size());
+    auto* types = static_cast<uint8_t*>(buffer->Data());
+    for (size_t i = 0; i < files.size(); ++i) {
+      asar::Archive::Stats stats;
+      types[i] = wrap->archive_->Stat(path.Append(files[i]), &stats)
+                     ? static_cast<uint8_t>(stats.type)
+                     : UV_DIRENT_UNKNOWN;
+    }
+
+    v8::Local<v8::Value> result[] = {
+        gin::ConvertToV8(isolate, files),
+        v8::Uint8Array::New(buffer, 0, files.size())};
+    args.GetReturnValue().Set(
+        v8::Array::New(isolate, result, std::size(result)));
+  }
+
   // Returns all files under a directory.
   static void Readdir(const v8::FunctionCallbackInfo<v8::Value>& args) {
     auto* isolate = args.GetIsolate();
@@ -178,6 +261,24 @@ class Archive : public node::ObjectWrap {
     args.GetReturnValue().Set(gin::ConvertToV8(isolate, new_path));
   }
 
+  // Like CopyFileOut() but copies, and decompresses, the file on the libuv
+  // threadpool, then calls back with the new path or false.
+  static void CopyFileOutAsync(
+      const v8::FunctionCallbackInfo<v8::Value>& args) {
+    auto* wrap = node::ObjectWrap::Unwrap<Archive>(args.Holder());
+    base::FilePath path;
+    if (!wrap->archive_ || !args[1]->IsFunction() ||
+        !gin::ConvertFromV8(args.GetIsolate(), args[0], &path)) {
+      args.GetReturnValue().Set(v8::False(args.GetIsolate()));
+      return;
+    }
+
+    auto work = std::make_unique<AsyncWork>(args, wrap->archive_);
+    work->path = path;
+    AsyncWork::Queue(std::move(work));
+    args.GetReturnValue().Set(v8::True(args.GetIsolate()));
+  }
+
   // Return the file descriptor.
   static void GetFD(const v8::FunctionCallbackInfo<v8::Value>& args) {
     auto* isolate = args.GetIsolate();
@@ -187,7 +288,182 @@ class Archive : public node::ObjectWrap {
         isolate, wrap->archive_ ? wrap->archive_->GetUnsafeFD() : -1));
   }
 
+  // Reads a packed file out of the archive mapping, or decompresses it when it
+  // is stored compressed, as a utf8 string if requested. Returns undefined
+  // when the archive is not mapped, in which case callers should fall back to
+  // reading through the fd, or when a compressed file can't be decompressed.
+  static void ReadMapped(const v8::FunctionCallbackInfo<v8::Value>& args) {
+    auto* isolate = args.GetIsolate();
+    auto* wrap = node::ObjectWrap::Unwrap<Archive>(args.Holder());
+    base::FilePath path;
+    if (!gin::ConvertFromV8(isolate, args[0], &path))
+      return;
+    bool as_utf8 = args[1]->IsTrue();
+
+    asar::Archive::FileInfo info;
+    if (!wrap->archive_ || !wrap->archive_->GetFileInfo(path, &info))
+      return;
+
+    std::vector<uint8_t> decompressed;
+    std::optional<base::span<const uint8_t>> contents;
+    if (info.compression) {
+      decompressed.resize(info.size);
+      if (!wrap->archive_->ReadDecompressed(info, 0, decompressed))
+        return;
+      contents = base::span<const uint8_t>(decompressed);
+    } else {
+      contents = wrap->archive_->GetMappedContents(info);
+    }
+    if (!contents)
+      return;
+
+    const char* data = reinterpret_cast<const char*>(contents->data());
+    if (info.integrity.has_value()) {
+      asar::ValidateIntegrityOrDie(data, contents->size(),
+                                   info.integrity.value());
+    }
+
+    v8::Local<v8::Value> result;
+    if (ToContents(isolate, *contents, as_utf8).ToLocal(&result))
+      args.GetReturnValue().Set(result);
+  }
+
+  // Decompresses a compressed file on the libuv threadpool and calls back
+  // with its contents, as a utf8 string if requested, or undefined when it
+  // can't be decompressed. Returns false if |path| isn't a compressed file.
+  static void ReadCompressed(const v8::FunctionCallbackInfo<v8::Value>& args) {
+    auto* wrap = node::ObjectWrap::Unwrap<Archive>(args.Holder());
+    base::FilePath path;
+    asar::Archive::FileInfo info;
+    if (!wrap->archive_ || !args[2]->IsFunction() ||
+        !gin::ConvertFromV8(args.GetIsolate(), args[0], &path) ||
+        !wrap->archive_->GetFileInfo(path, &info) || !info.compression) {
+      args.GetReturnValue().Set(v8::False(args.GetIsolate()));
+      return;
+    }
+
+    auto work = std::make_unique<AsyncWork>(args, wrap->archive_);
+    work->info = std::move(info);
+    work->as_utf8 = args[1]->IsTrue();
+    AsyncWork::Queue(std::move(work));
+    args.GetReturnValue().Set(v8::True(args.GetIsolate()));
+  }
+
+  // Returns the V8 code cache the archive carries for a file as a Buffer, or
+  // undefined if it has none.
+  static void ReadCodeCache(const v8::FunctionCallbackInfo<v8::Value>& args) {
+    auto* isolate = args.GetIsolate();
+    auto* wrap = node::ObjectWrap::Unwrap<Archive>(args.Holder());
+    base::FilePath path;
+    if (!gin::ConvertFromV8(isolate, args[0], &path))
+      return;
+
+    asar::Archive::FileInfo info;
+    if (!wrap->archive_ || !wrap->archive_->GetFileInfo(path, &info) ||
+        !info.code_cache)
+      return;
+
+    std::optional<std::vector<uint8_t>> code_cache =
+        wrap->archive_->ReadCodeCache(info);
+    if (!code_cache)
+      return;
+
+    v8::Local<v8::Object> buffer;
+    if (!node::Buffer::Copy(isolate,
+                            reinterpret_cast<const char*>(code_cache->data()),
+                            code_cache->size())
+             .ToLocal(&buffer)) {
+      return;
+    }
+    args.GetReturnValue().Set(buffer);
+  }
+
+  // A copyFileOutAsync() or readCompressed() call running on the libuv
+  // threadpool. The last argument of the call is the callback.
+  struct AsyncWork {
+    AsyncWork(const v8::FunctionCallbackInfo<v8::Value>& args,
+              std::shared_ptr<asar::Archive> archive)
+        : env(node::Environment::GetCurrent(args)),
+          callback(args.GetIsolate(),
+                   args[args.Length() - 1].As<v8::Function>()),
+          archive(std::move(archive)) {
+      request.data = this;
+    }
+
+    static void Queue(std::unique_ptr<AsyncWork> work) {
+      uv_loop_t* loop = work->env->event_loop();
+      uv_work_t* request = &work.release()->request;
+      uv_queue_work(loop, request, &AsyncWork::Run, &AsyncWork::Done);
+    }
+
+    static void Run(uv_work_t* request) {
+      auto* work = static_cast<AsyncWork*>(request->data);
+      if (!work->info.compression) {
+        work->succeeded = work->archive->CopyFileOut(work->path, &work->path);
+        return;
+      }
+      work->contents.resize(work->info.size);
+      work->succeeded =
+          work->archive->ReadDecompressed(work->info, 0, work->contents);
+      if (work->succeeded && work->info.integrity.has_value()) {
+        asar::ValidateIntegrityOrDie(
+            reinterpret_cast<const char*>(work->contents.data()),
+            work->contents.size(), work->info.integrity.value());
+      }
+    }
+
+    static void Done(uv_work_t* request, int status) {
+      std::unique_ptr<AsyncWork> work(static_cast<AsyncWork*>(request->data));
+      v8::Isolate* isolate = work->env->isolate();
+      v8::HandleScope handle_scope(isolate);
+      v8::Context::Scope context_scope(work->env->context());
+
+      v8::Local<v8::Value> result;
+      if (!work->info.compression) {
+        result = status == 0 && work->succeeded
+                     ? gin::ConvertToV8(isolate, work->path)
+                     : v8::False(isolate).As<v8::Value>();
+      } else if (status != 0 || !work->succeeded ||
+                 !ToContents(isolate, work->contents, work->as_utf8)
+                      .ToLocal(&result)) {
+        result = v8::Undefined(isolate);
+      }
+      node::MakeCallback(isolate, work->env->context()->Global(),
+                         work->callback.Get(isolate), 1, &result, {0, 0});
+    }
+
+    uv_work_t request;
+    raw_ptr<node::Environment> env;
+    v8::Global<v8::Function> callback;
+    std::shared_ptr<asar::Archive> archive;
+    // Set for copyFileOutAsync(), and replaced with the copied file's path.
+    base::FilePath path;
+    // Set for readCompressed().
+    asar::Archive::FileInfo info;
+    bool as_utf8 = false;
+    bool succeeded = false;
+    std::vector<uint8_t> contents;
+  };
+
+  // Converts file contents to a string or a Buffer.
+  static v8::MaybeLocal<v8::Value> ToContents(
+      v8::Isolate* isolate,
+      base::span<const uint8_t> contents,
+      bool as_utf8) {
+    const char* data = reinterpret_cast<const char*>(contents.data());
+    if (as_utf8) {
+      return v8::String::NewFromUtf8(isolate, data, v8::NewStringType::kNormal,
+                                     contents.size());
+    }
+    return node::Buffer::Copy(isolate, data, contents.size());
+  }
+
+  static constexpr size_t kMaxTypeCacheSize = 8192;
+
   std::shared_ptr<asar::Archive> archive_;
+
+  // Results of GetType(), keyed by the path inside the archive.
+  std::unordered_map<base::FilePath::StringType, int> type_cache_;
 };
 
 static void SplitPath(const v8::FunctionCallbackInfo<v8::Value>& args) {
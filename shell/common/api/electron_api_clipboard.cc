@@ -5,13 +5,17 @@
 #include "shell/common/api/electron_api_clipboard.h"
 
 #include <map>
+#include <optional>
+#include <vector>
 
 #include "base/containers/contains.h"
 #include "base/run_loop.h"
 #include "base/strings/utf_string_conversions.h"
+#include "base/task/thread_pool.h"
 #include "shell/browser/browser.h"
 #include "shell/common/gin_converters/image_converter.h"
 #include "shell/common/gin_helper/dictionary.h"
+#include "shell/common/gin_helper/promise.h"
 #include "shell/common/node_includes.h"
 #include "third_party/skia/include/core/SkBitmap.h"
 #include "third_party/skia/include/core/SkImageInfo.h"
@@ -23,6 +27,21 @@
 
 namespace electron::api {
 
+namespace {
+
+SkBitmap DecodePng(const std::vector<uint8_t>& png) {
+  SkBitmap bitmap;
+  gfx::PNGCodec::Decode(png.data(), png.size(), &bitmap);
+  return bitmap;
+}
+
+void ResolveWithImage(gin_helper::Promise<gfx::Image> promise,
+                      SkBitmap bitmap) {
+  promise.Resolve(gfx::Image::CreateFrom1xBitmap(bitmap));
+}
+
+}  // namespace
+
 ui::ClipboardBuffer Clipboard::GetClipboardBuffer(gin_helper::Arguments* args) {
   std::string type;
   if (args->GetNext(&type) && type == "selection")
@@ -240,9 +259,7 @@ gfx::Image Clipboard::ReadImage(gin_helper::Arguments* args) {
       base::BindOnce(
           [](std::optional<gfx::Image>* image, base::RepeatingClosure cb,
              const std::vector<uint8_t>& result) {
-            SkBitmap bitmap;
-            gfx::PNGCodec::Decode(result.data(), result.size(), &bitmap);
-            image->emplace(gfx::Image::CreateFrom1xBitmap(bitmap));
+            image->emplace(gfx::Image::CreateFrom1xBitmap(DecodePng(result)));
             std::move(cb).Run();
           },
           &image, std::move(callback)));
@@ -252,6 +269,36 @@ gfx::Image Clipboard::ReadImage(gin_helper::Arguments* args) {
   return image.value();
 }
 
+v8::Local<v8::Promise> Clipboard::ReadImageAsync(gin_helper::Arguments* args) {
+  gin_helper::Promise<gfx::Image> promise(args->isolate());
+  v8::Local<v8::Promise> handle = promise.GetHandle();
+
+  // The ReadPng uses thread pool which requires app ready.
+  if (IsBrowserProcess() && !Browser::Get()->is_ready()) {
+    promise.RejectWithErrorMessage(
+        "clipboard.readImageAsync is available only after app ready in the "
+        "main process");
+    return handle;
+  }
+
+  // ui::Clipboard is bound to this thread, but ReadPng already answers
+  // asynchronously on every platform, so only the decoding is moved.
+  ui::Clipboard* clipboard = ui::Clipboard::GetForCurrentThread();
+  clipboard->ReadPng(
+      GetClipboardBuffer(args),
+      /* data_dst = */ nullptr,
+      base::BindOnce(
+          [](gin_helper::Promise<gfx::Image> promise,
+             const std::vector<uint8_t>& result) {
+            base::ThreadPool::PostTaskAndReplyWithResult(
+                FROM_HERE, {base::TaskPriority::USER_VISIBLE},
+                base::BindOnce(&DecodePng, result),
+                base::BindOnce(&ResolveWithImage, std::move(promise)));
+          },
+          std::move(promise)));
+  return handle;
+}
+
 void Clipboard::WriteImage(const gfx::Image& image,
                            gin_helper::Arguments* args) {
   ui::ScopedClipboardWriter writer(GetClipboardBuffer(args));
@@ -309,6 +356,7 @@ void Initialize(v8::Local<v8::Object> exports,
   dict.SetMethod("readBookmark", &electron::api::Clipboard::ReadBookmark);
   dict.SetMethod("writeBookmark", &electron::api::Clipboard::WriteBookmark);
   dict.SetMethod("readImage", &electron::api::Clipboard::ReadImage);
+  dict.SetMethod("readImageAsync", &electron::api::Clipboard::ReadImageAsync);
   dict.SetMethod("writeImage", &electron::api::Clipboard::WriteImage);
   dict.SetMethod("readFindText", &electron::api::Clipboard::ReadFindText);
   dict.SetMethod("writeFindText", &electron::api::Clipboard::WriteFindText);
@@ -5,16 +5,22 @@
 #include "shell/common/api/electron_api_native_image.h"
 
 #include <memory>
+#include <optional>
 #include <string>
+#include <tuple>
 #include <utility>
 #include <vector>
 
+#include "base/barrier_callback.h"
+#include "base/containers/lru_cache.h"
 #include "base/files/file_util.h"
 #include "base/logging.h"
+#include "base/no_destructor.h"
 #include "base/memory/ref_counted_memory.h"
 #include "base/strings/pattern.h"
 #include "base/strings/string_util.h"
 #include "base/strings/utf_string_conversions.h"
+#include "base/task/thread_pool.h"
 #include "gin/arguments.h"
 #include "gin/object_template_builder.h"
 #include "gin/per_isolate_data.h"
@@ -29,10 +35,12 @@
 #include "shell/common/gin_helper/dictionary.h"
 #include "shell/common/gin_helper/function_template_extensions.h"
 #include "shell/common/gin_helper/object_template_builder.h"
+#include "shell/common/gin_helper/promise.h"
 #include "shell/common/node_includes.h"
 #include "shell/common/process_util.h"
 #include "shell/common/skia_util.h"
 #include "shell/common/thread_restrictions.h"
+#include "skia/ext/image_operations.h"
 #include "third_party/skia/include/core/SkBitmap.h"
 #include "third_party/skia/include/core/SkImageInfo.h"
 #include "third_party/skia/include/core/SkPixelRef.h"
@@ -41,6 +49,7 @@
 #include "ui/base/webui/web_ui_util.h"
 #include "ui/gfx/codec/jpeg_codec.h"
 #include "ui/gfx/codec/png_codec.h"
+#include "ui/gfx/codec/webp_codec.h"
 #include "ui/gfx/geometry/size.h"
 #include "ui/gfx/image/image_skia.h"
 #include "ui/gfx/image/image_skia_operations.h"
@@ -77,6 +86,91 @@ float GetScaleFactorFromOptions(gin::Arguments* args) {
   return scale_factor;
 }
 
+enum class EncodeFormat { kPNG, kJPEG, kWebP };
+
+// Runs on the thread pool, |bitmap| shares its pixels with the image
+// representation, which is never written to after creation.
+std::vector<unsigned char> EncodeBitmap(const SkBitmap& bitmap,
+                                        EncodeFormat format,
+                                        int quality) {
+  std::vector<unsigned char> output;
+  bool success = false;
+  switch (format) {
+    case EncodeFormat::kPNG:
+      success = gfx::PNGCodec::EncodeBGRASkBitmap(bitmap, false, &output);
+      break;
+    case EncodeFormat::kJPEG:
+      success = gfx::JPEGCodec::Encode(bitmap, quality, &output);
+      break;
+    case EncodeFormat::kWebP:
+      success = gfx::WebpCodec::Encode(bitmap, quality, &output);
+      break;
+  }
+  if (!success)
+    output.clear();
+  return output;
+}
+
+void ResolveWithBuffer(gin_helper::Promise<v8::Local<v8::Value>> promise,
+                       std::vector<unsigned char> encoded) {
+  if (encoded.empty()) {
+    promise.RejectWithErrorMessage("Failed to encode image");
+    return;
+  }
+  v8::HandleScope handle_scope(promise.isolate());
+  promise.Resolve(
+      node::Buffer::Copy(promise.isolate(),
+                         reinterpret_cast<const char*>(encoded.data()),
+                         encoded.size())
+          .ToLocalChecked());
+}
+
+skia::ImageOperations::ResizeMethod GetResizeMethod(
+    const std::string* quality) {
+  if (quality && *quality == "good")
+    return skia::ImageOperations::ResizeMethod::RESIZE_GOOD;
+  else if (quality && *quality == "better")
+    return skia::ImageOperations::ResizeMethod::RESIZE_BETTER;
+  return skia::ImageOperations::ResizeMethod::RESIZE_BEST;
+}
+
+// Runs on the thread pool, empty sizes produce empty bitmaps.
+std::vector<SkBitmap> ResizeBitmap(const SkBitmap& bitmap,
+                                   skia::ImageOperations::ResizeMethod method,
+                                   const std::vector<gfx::Size>& sizes) {
+  std::vector<SkBitmap> resized;
+  resized.reserve(sizes.size());
+  for (const auto& size : sizes) {
+    if (size.IsEmpty() || bitmap.drawsNothing()) {
+      resized.emplace_back();
+      continue;
+    }
+    resized.push_back(skia::ImageOperations::Resize(bitmap, method,
+                                                    size.width(),
+                                                    size.height()));
+  }
+  return resized;
+}
+
+void ResolveWithImages(gin_helper::Promise<v8::Local<v8::Value>> promise,
+                       float scale,
+                       std::vector<SkBitmap> bitmaps) {
+  v8::Isolate* isolate = promise.isolate();
+  v8::HandleScope handle_scope(isolate);
+  std::vector<v8::Local<v8::Value>> images;
+  images.reserve(bitmaps.size());
+  for (auto& bitmap : bitmaps) {
+    gfx::Image image;
+    if (!bitmap.drawsNothing()) {
+      bitmap.setImmutable();
+      image = gfx::Image(gfx::ImageSkia(gfx::ImageSkiaRep(bitmap, scale)));
+    }
+    images.push_back(
+        gin::CreateHandle(isolate, new NativeImage(isolate, image)).ToV8());
+  }
+  promise.Resolve(gin::ConvertToV8(isolate, images));
+}
+
 base::FilePath NormalizePath(const base::FilePath& path) {
   if (!path.ReferencesParent()) {
     return path;
@@ -119,6 +213,70 @@ base::win::ScopedHICON ReadICOFromPath(int size, const base::FilePath& path) {
 }
 #endif
 
+#if !BUILDFLAG(IS_LINUX)
+// Thumbnails are cached per file, so the modification time and size are part
+// of the key to pick up edits, along with the requested size.
+using ThumbnailKey = std::tuple<base::FilePath, base::Time, int64_t, int, int>;
+
+// Roughly the pixel memory the cached thumbnails may hold before the least
+// recently used ones are dropped.
+constexpr size_t kThumbnailCacheMaxBytes = 64 * 1024 * 1024;
+
+std::optional<ThumbnailKey> GetThumbnailKey(const base::FilePath& path,
+                                            const gfx::Size& size) {
+  base::File::Info info;
+  if (!base::GetFileInfo(path, &info))
+    return std::nullopt;
+  return ThumbnailKey{path, info.last_modified, info.size, size.width(),
+                      size.height()};
+}
+
+class ThumbnailCache {
+ public:
+  static ThumbnailCache* Get() {
+    static base::NoDestructor<ThumbnailCache> cache;
+    return cache.get();
+  }
+
+  // gfx::Image shares its representations between copies, and a NativeImage
+  // can add representations to the image it holds. The cache therefore only
+  // ever hands out and keeps deep copies.
+  std::optional<gfx::Image> Lookup(const ThumbnailKey& key) {
+    auto iter = entries_.Get(key);
+    if (iter == entries_.end())
+      return std::nullopt;
+    return DeepCopy(iter->second);
+  }
+
+  void Put(const ThumbnailKey& key, const gfx::Image& image) {
+    if (auto iter = entries_.Peek(key); iter != entries_.end()) {
+      bytes_ -= GetByteSize(iter->second);
+      entries_.Erase(iter);
+    }
+    entries_.Put(key, DeepCopy(image));
+    bytes_ += GetByteSize(image);
+    while (bytes_ > kThumbnailCacheMaxBytes && entries_.size() > 1) {
+      auto oldest = entries_.rbegin();
+      bytes_ -= GetByteSize(oldest->second);
+      entries_.Erase(oldest);
+    }
+  }
+
+ private:
+  static gfx::Image DeepCopy(const gfx::Image& image) {
+    return gfx::Image(image.AsImageSkia().DeepCopy());
+  }
+
+  static size_t GetByteSize(const gfx::Image& image) {
+    return static_cast<size_t>(image.Width()) * image.Height() * 4;
+  }
+
+  base::LRUCache<ThumbnailKey, gfx::Image> entries_{
+      base::LRUCache<ThumbnailKey, gfx::Image>::NO_AUTO_EVICT};
+  size_t bytes_ = 0;
+};
+#endif
+
 }  // namespace
 
 NativeImage::NativeImage(v8::Isolate* isolate, const gfx::Image& image)
@@ -146,18 +304,29 @@ NativeImage::~NativeImage() {
 }
 
 void NativeImage::UpdateExternalAllocatedMemoryUsage() {
-  int32_t new_memory_usage = 0;
+  int64_t new_memory_usage = 0;
 
+  // Representations are created lazily, e.g. a PNG is only decoded once its
+  // pixels are asked for, so every one that exists so far is counted.
   if (image_.HasRepresentation(gfx::Image::kImageRepSkia)) {
-    auto* const image_skia = image_.ToImageSkia();
-    if (!image_skia->isNull()) {
-      new_memory_usage = image_skia->bitmap()->computeByteSize();
-    }
+    for (const auto& rep : image_.ToImageSkia()->image_reps())
+      new_memory_usage += rep.GetBitmap().computeByteSize();
   }
+  if (image_.HasRepresentation(gfx::Image::kImageRepPNG))
+    new_memory_usage += image_.As1xPNGBytes()->size();
 
+  if (new_memory_usage == memory_usage_)
+    return;
   isolate_->AdjustAmountOfExternalAllocatedMemory(new_memory_usage -
                                                   memory_usage_);
   memory_usage_ = new_memory_usage;
+  live_object_.SetNativeSize(memory_usage_);
+}
+
+gfx::ImageSkiaRep NativeImage::GetRepresentation(float scale_factor) {
+  gfx::ImageSkiaRep rep = image_.AsImageSkia().GetRepresentation(scale_factor);
+  UpdateExternalAllocatedMemoryUsage();
+  return rep;
 }
 
 // static
@@ -236,7 +405,7 @@ v8::Local<v8::Value> NativeImage::ToPNG(gin::Arguments* args) {
   }
 
   const SkBitmap bitmap =
-      image_.AsImageSkia().GetRepresentation(scale_factor).GetBitmap();
+      GetRepresentation(scale_factor).GetBitmap();
   std::vector<unsigned char> encoded;
   gfx::PNGCodec::EncodeBGRASkBitmap(bitmap, false, &encoded);
   const char* data = reinterpret_cast<char*>(encoded.data());
@@ -248,7 +417,7 @@ v8::Local<v8::Value> NativeImage::ToBitmap(gin::Arguments* args) {
   float scale_factor = GetScaleFactorFromOptions(args);
 
   const SkBitmap bitmap =
-      image_.AsImageSkia().GetRepresentation(scale_factor).GetBitmap();
+      GetRepresentation(scale_factor).GetBitmap();
 
   SkImageInfo info =
       SkImageInfo::MakeN32Premul(bitmap.width(), bitmap.height());
@@ -268,6 +437,7 @@ v8::Local<v8::Value> NativeImage::ToBitmap(gin::Arguments* args) {
 v8::Local<v8::Value> NativeImage::ToJPEG(v8::Isolate* isolate, int quality) {
   std::vector<unsigned char> output;
   gfx::JPEG1xEncodedDataFromImage(image_, quality, &output);
+  UpdateExternalAllocatedMemoryUsage();
   if (output.empty())
     return node::Buffer::New(isolate, 0).ToLocalChecked();
   return node::Buffer::Copy(isolate,
@@ -280,14 +450,71 @@ std::string NativeImage::ToDataURL(gin::Arguments* args) {
   float scale_factor = GetScaleFactorFromOptions(args);
 
   return webui::GetBitmapDataUrl(
-      image_.AsImageSkia().GetRepresentation(scale_factor).GetBitmap());
+      GetRepresentation(scale_factor).GetBitmap());
+}
+
+v8::Local<v8::Promise> NativeImage::Encode(gin::Arguments* args) {
+  v8::Isolate* isolate = args->isolate();
+  gin_helper::Promise<v8::Local<v8::Value>> promise(isolate);
+  v8::Local<v8::Promise> handle = promise.GetHandle();
+
+  std::string format_name = "png";
+  float scale_factor = 1.0f;
+  int quality = 90;
+  gin_helper::Dictionary options;
+  if (args->GetNext(&options)) {
+    options.Get("format", &format_name);
+    options.Get("scaleFactor", &scale_factor);
+    options.Get("quality", &quality);
+  }
+
+  EncodeFormat format;
+  if (format_name == "png") {
+    format = EncodeFormat::kPNG;
+  } else if (format_name == "jpeg") {
+    format = EncodeFormat::kJPEG;
+  } else if (format_name == "webp") {
+    format = EncodeFormat::kWebP;
+  } else {
+    promise.RejectWithErrorMessage("Unsupported format: " + format_name);
+    return handle;
+  }
+
+  if (quality < 0 || quality > 100) {
+    promise.RejectWithErrorMessage("quality must be between 0 and 100");
+    return handle;
+  }
+
+  if (format == EncodeFormat::kPNG && scale_factor == 1.0f &&
+      image_.HasRepresentation(gfx::Image::kImageRepPNG)) {
+    // Already encoded, skip the round trip through the thread pool.
+    scoped_refptr<base::RefCountedMemory> png = image_.As1xPNGBytes();
+    promise.Resolve(node::Buffer::Copy(
+                        isolate, reinterpret_cast<const char*>(png->front()),
+                        png->size())
+                        .ToLocalChecked());
+    return handle;
+  }
+
+  const SkBitmap bitmap =
+      GetRepresentation(scale_factor).GetBitmap();
+  if (bitmap.drawsNothing()) {
+    promise.RejectWithErrorMessage("Cannot encode an empty image");
+    return handle;
+  }
+
+  base::ThreadPool::PostTaskAndReplyWithResult(
+      FROM_HERE, {base::TaskPriority::USER_VISIBLE},
+      base::BindOnce(&EncodeBitmap, bitmap, format, quality),
+      base::BindOnce(&ResolveWithBuffer, std::move(promise)));
+  return handle;
 }
 
 v8::Local<v8::Value> NativeImage::GetBitmap(gin::Arguments* args) {
   float scale_factor = GetScaleFactorFromOptions(args);
 
   const SkBitmap bitmap =
-      image_.AsImageSkia().GetRepresentation(scale_factor).GetBitmap();
+      GetRepresentation(scale_factor).GetBitmap();
   SkPixelRef* ref = bitmap.pixelRef();
   if (!ref)
     return node::Buffer::New(args->isolate(), 0).ToLocalChecked();
@@ -319,7 +546,7 @@ bool NativeImage::IsEmpty() {
 
 gfx::Size NativeImage::GetSize(const std::optional<float> scale_factor) {
   float sf = scale_factor.value_or(1.0f);
-  gfx::ImageSkiaRep image_rep = image_.AsImageSkia().GetRepresentation(sf);
+  gfx::ImageSkiaRep image_rep = GetRepresentation(sf);
 
   return gfx::Size(image_rep.GetWidth(), image_rep.GetHeight());
 }
@@ -342,10 +569,8 @@ float NativeImage::GetAspectRatio(const std::optional<float> scale_factor) {
     return static_cast<float>(size.width()) / static_cast<float>(size.height());
 }
 
-gin::Handle<NativeImage> NativeImage::Resize(gin::Arguments* args,
-                                             base::Value::Dict options) {
-  float scale_factor = GetScaleFactorFromOptions(args);
-
+gfx::Size NativeImage::GetResizedSize(const base::Value::Dict& options,
+                                      float scale_factor) {
   gfx::Size size = GetSize(scale_factor);
   std::optional<int> new_width = options.FindInt("width");
   std::optional<int> new_height = options.FindInt("height");
@@ -354,7 +579,7 @@ gin::Handle<NativeImage> NativeImage::Resize(gin::Arguments* args,
   size.SetSize(width, height);
 
   if (width <= 0 && height <= 0) {
-    return CreateEmpty(args->isolate());
+    return gfx::Size();
   } else if (new_width && !new_height) {
     // Scale height to preserve original aspect ratio
     size.set_height(width);
@@ -365,25 +590,65 @@ gin::Handle<NativeImage> NativeImage::Resize(gin::Arguments* args,
     size.set_width(height);
     size = gfx::ScaleToRoundedSize(size, GetAspectRatio(scale_factor), 1.f);
   }
+  return size;
+}
 
-  skia::ImageOperations::ResizeMethod method =
-      skia::ImageOperations::ResizeMethod::RESIZE_BEST;
-  std::string* quality = options.FindString("quality");
-  if (quality && *quality == "good")
-    method = skia::ImageOperations::ResizeMethod::RESIZE_GOOD;
-  else if (quality && *quality == "better")
-    method = skia::ImageOperations::ResizeMethod::RESIZE_BETTER;
+gin::Handle<NativeImage> NativeImage::Resize(gin::Arguments* args,
+                                             base::Value::Dict options) {
+  float scale_factor = GetScaleFactorFromOptions(args);
+
+  gfx::Size size = GetResizedSize(options, scale_factor);
+  if (size.IsEmpty())
+    return CreateEmpty(args->isolate());
 
   gfx::ImageSkia resized = gfx::ImageSkiaOperations::CreateResizedImage(
-      image_.AsImageSkia(), method, size);
+      image_.AsImageSkia(), GetResizeMethod(options.FindString("quality")),
+      size);
+  resized.EnsureRepsForSupportedScales();
   return gin::CreateHandle(
       args->isolate(), new NativeImage(args->isolate(), gfx::Image(resized)));
 }
 
+v8::Local<v8::Promise> NativeImage::ResizeAsync(
+    gin::Arguments* args,
+    std::vector<base::Value::Dict> sizes) {
+  v8::Isolate* isolate = args->isolate();
+  gin_helper::Promise<v8::Local<v8::Value>> promise(isolate);
+  v8::Local<v8::Promise> handle = promise.GetHandle();
+
+  float scale_factor = 1.0f;
+  std::string quality;
+  gin_helper::Dictionary options;
+  if (args->GetNext(&options)) {
+    options.Get("scaleFactor", &scale_factor);
+    options.Get("quality", &quality);
+  }
+
+  // All targets are scaled from the same representation, sizes are computed
+  // here so that the worker only touches the bitmap.
+  const gfx::ImageSkiaRep rep =
+      GetRepresentation(scale_factor);
+  std::vector<gfx::Size> pixel_sizes;
+  pixel_sizes.reserve(sizes.size());
+  for (const auto& size : sizes) {
+    pixel_sizes.push_back(gfx::ScaleToCeiledSize(
+        GetResizedSize(size, scale_factor), rep.scale()));
+  }
+
+  base::ThreadPool::PostTaskAndReplyWithResult(
+      FROM_HERE, {base::TaskPriority::USER_VISIBLE},
+      base::BindOnce(&ResizeBitmap, rep.GetBitmap(),
+                     GetResizeMethod(quality.empty() ? nullptr : &quality),
+                     std::move(pixel_sizes)),
+      base::BindOnce(&ResolveWithImages, std::move(promise), rep.scale()));
+  return handle;
+}
+
 gin::Handle<NativeImage> NativeImage::Crop(v8::Isolate* isolate,
                                            const gfx::Rect& rect) {
   gfx::ImageSkia cropped =
       gfx::ImageSkiaOperations::ExtractSubset(image_.AsImageSkia(), rect);
+  cropped.EnsureRepsForSupportedScales();
   return gin::CreateHandle(isolate,
                            new NativeImage(isolate, gfx::Image(cropped)));
 }
@@ -425,6 +690,16 @@ void NativeImage::AddRepresentation(const gin_helper::Dictionary& options) {
     gfx::Image image(image_skia);
     image_ = std::move(image);
   }
+  UpdateExternalAllocatedMemoryUsage();
+}
+
+void NativeImage::Release() {
+  image_ = gfx::Image();
+#if BUILDFLAG(IS_WIN)
+  hicon_path_.clear();
+  hicons_.clear();
+#endif
+  UpdateExternalAllocatedMemoryUsage();
 }
 
 #if !BUILDFLAG(IS_MAC)
@@ -577,6 +852,113 @@ gin::Handle<NativeImage> NativeImage::CreateFromDataURL(v8::Isolate* isolate,
   return CreateEmpty(isolate);
 }
 
+#if !BUILDFLAG(IS_LINUX)
+// static
+v8::Local<v8::Promise> NativeImage::CreateThumbnailFromPath(
+    v8::Isolate* isolate,
+    const base::FilePath& path,
+    const gfx::Size& size) {
+  gin_helper::Promise<gfx::Image> promise(isolate);
+  v8::Local<v8::Promise> handle = promise.GetHandle();
+
+  if (size.IsEmpty()) {
+    promise.RejectWithErrorMessage("size must not be empty");
+    return handle;
+  }
+
+  GetThumbnail(
+      path, size,
+      base::BindOnce(
+          [](gin_helper::Promise<gfx::Image> promise,
+             base::expected<gfx::Image, std::string> result) {
+            if (result.has_value())
+              promise.Resolve(*result);
+            else
+              promise.RejectWithErrorMessage(result.error());
+          },
+          std::move(promise)));
+  return handle;
+}
+
+// static
+v8::Local<v8::Promise> NativeImage::CreateThumbnailsFromPath(
+    v8::Isolate* isolate,
+    const std::vector<base::FilePath>& paths,
+    const gfx::Size& size) {
+  gin_helper::Promise<std::vector<gfx::Image>> promise(isolate);
+  v8::Local<v8::Promise> handle = promise.GetHandle();
+
+  if (size.IsEmpty()) {
+    promise.RejectWithErrorMessage("size must not be empty");
+    return handle;
+  }
+  if (paths.empty()) {
+    promise.Resolve({});
+    return handle;
+  }
+
+  // Every thumbnail is requested at once; results arrive in any order and are
+  // put back in the order of |paths|. Failures become empty images so that one
+  // unreadable file does not fail the whole batch.
+  using IndexedImage = std::pair<size_t, gfx::Image>;
+  auto barrier = base::BarrierCallback<IndexedImage>(
+      paths.size(),
+      base::BindOnce(
+          [](gin_helper::Promise<std::vector<gfx::Image>> promise,
+             std::vector<IndexedImage> results) {
+            std::vector<gfx::Image> images(results.size());
+            for (auto& [index, image] : results)
+              images[index] = std::move(image);
+            promise.Resolve(images);
+          },
+          std::move(promise)));
+  for (size_t i = 0; i < paths.size(); ++i) {
+    GetThumbnail(paths[i], size,
+                 base::BindOnce(
+                     [](size_t index,
+                        base::RepeatingCallback<void(IndexedImage)> barrier,
+                        base::expected<gfx::Image, std::string> result) {
+                       barrier.Run({index, result.value_or(gfx::Image())});
+                     },
+                     i, barrier));
+  }
+  return handle;
+}
+
+// static
+void NativeImage::GetThumbnail(const base::FilePath& path,
+                               const gfx::Size& size,
+                               ThumbnailCallback callback) {
+  base::ThreadPool::PostTaskAndReplyWithResult(
+      FROM_HERE, {base::MayBlock(), base::TaskPriority::USER_VISIBLE},
+      base::BindOnce(&GetThumbnailKey, path, size),
+      base::BindOnce(
+          [](const base::FilePath& path, const gfx::Size& size,
+             ThumbnailCallback callback, std::optional<ThumbnailKey> key) {
+            if (!key) {
+              // Leave it to the platform to report why the file is unusable.
+              GenerateThumbnail(path, size, std::move(callback));
+              return;
+            }
+            if (auto image = ThumbnailCache::Get()->Lookup(*key)) {
+              std::move(callback).Run(*std::move(image));
+              return;
+            }
+            GenerateThumbnail(
+                path, size,
+                base::BindOnce(
+                    [](const ThumbnailKey& key, ThumbnailCallback callback,
+                       base::expected<gfx::Image, std::string> result) {
+                      if (result.has_value())
+                        ThumbnailCache::Get()->Put(key, *result);
+                      std::move(callback).Run(std::move(result));
+                    },
+                    *key, std::move(callback)));
+          },
+          path, size, std::move(callback)));
+}
+#endif
+
 #if !BUILDFLAG(IS_MAC)
 gin::Handle<NativeImage> NativeImage::CreateFromNamedImage(gin::Arguments* args,
                                                            std::string name) {
@@ -605,6 +987,7 @@ gin::ObjectTemplateBuilder NativeImage::GetObjectTemplateBuilder(
       .SetMethod("getScaleFactors", &NativeImage::GetScaleFactors)
       .SetMethod("getNativeHandle", &NativeImage::GetNativeHandle)
       .SetMethod("toDataURL", &NativeImage::ToDataURL)
+      .SetMethod("encode", &NativeImage::Encode)
       .SetMethod("isEmpty", &NativeImage::IsEmpty)
       .SetMethod("getSize", &NativeImage::GetSize)
       .SetMethod("setTemplateImage", &NativeImage::SetTemplateImage)
@@ -612,9 +995,11 @@ gin::ObjectTemplateBuilder NativeImage::GetObjectTemplateBuilder(
       .SetProperty("isMacTemplateImage", &NativeImage::IsTemplateImage,
                    &NativeImage::SetTemplateImage)
       .SetMethod("resize", &NativeImage::Resize)
+      .SetMethod("resizeAsync", &NativeImage::ResizeAsync)
       .SetMethod("crop", &NativeImage::Crop)
       .SetMethod("getAspectRatio", &NativeImage::GetAspectRatio)
-      .SetMethod("addRepresentation", &NativeImage::AddRepresentation);
+      .SetMethod("addRepresentation", &NativeImage::AddRepresentation)
+      .SetMethod("release", &NativeImage::Release);
 }
 
 const char* NativeImage::GetTypeName() {
@@ -649,6 +1034,8 @@ void Initialize(v8::Local<v8::Object> exports,
 #if !BUILDFLAG(IS_LINUX)
   native_image.SetMethod("createThumbnailFromPath",
                          &NativeImage::CreateThumbnailFromPath);
+  native_image.SetMethod("createThumbnailsFromPath",
+                         &NativeImage::CreateThumbnailsFromPath);
 #endif
 }
 
@@ -9,11 +9,14 @@
 #include <vector>
 
 #include "base/containers/flat_map.h"
+#include "base/functional/callback_forward.h"
 #include "base/memory/raw_ptr.h"
+#include "base/types/expected.h"
 #include "base/values.h"
 #include "gin/handle.h"
 #include "gin/wrappable.h"
 #include "shell/common/gin_helper/error_thrower.h"
+#include "shell/common/gin_helper/live_object.h"
 #include "ui/gfx/image/image.h"
 #include "ui/gfx/image/image_skia_rep.h"
 
@@ -79,10 +82,18 @@ class NativeImage : public gin::Wrappable<NativeImage> {
   static gin::Handle<NativeImage> CreateFromNamedImage(gin::Arguments* args,
                                                        std::string name);
 #if !BUILDFLAG(IS_LINUX)
+  // Called with the thumbnail, or with the reason it could not be generated.
+  using ThumbnailCallback =
+      base::OnceCallback<void(base::expected<gfx::Image, std::string>)>;
+
   static v8::Local<v8::Promise> CreateThumbnailFromPath(
       v8::Isolate* isolate,
       const base::FilePath& path,
       const gfx::Size& size);
+  static v8::Local<v8::Promise> CreateThumbnailsFromPath(
+      v8::Isolate* isolate,
+      const std::vector<base::FilePath>& paths,
+      const gfx::Size& size);
 #endif
 
   enum class OnConvertError { kThrow, kWarn };
@@ -112,16 +123,40 @@ class NativeImage : public gin::Wrappable<NativeImage> {
   std::vector<float> GetScaleFactors();
   v8::Local<v8::Value> GetBitmap(gin::Arguments* args);
   v8::Local<v8::Value> GetNativeHandle(gin_helper::ErrorThrower thrower);
+  gfx::Size GetResizedSize(const base::Value::Dict& options,
+                           float scale_factor);
   gin::Handle<NativeImage> Resize(gin::Arguments* args,
                                   base::Value::Dict options);
+  v8::Local<v8::Promise> ResizeAsync(gin::Arguments* args,
+                                     std::vector<base::Value::Dict> sizes);
   gin::Handle<NativeImage> Crop(v8::Isolate* isolate, const gfx::Rect& rect);
   std::string ToDataURL(gin::Arguments* args);
+  v8::Local<v8::Promise> Encode(gin::Arguments* args);
   bool IsEmpty();
   gfx::Size GetSize(const std::optional<float> scale_factor);
   float GetAspectRatio(const std::optional<float> scale_factor);
   void AddRepresentation(const gin_helper::Dictionary& options);
 
+  // Frees the pixels now instead of when the wrapper is garbage collected.
+  void Release();
+
+  // Reports the memory held by all representations of |image_| to V8.
   void UpdateExternalAllocatedMemoryUsage();
+  // Like image_.AsImageSkia().GetRepresentation(), but accounts for the
+  // representation that may have been created by the call.
+  gfx::ImageSkiaRep GetRepresentation(float scale_factor);
+
+#if !BUILDFLAG(IS_LINUX)
+  // Serves the thumbnail of |path| from the thumbnail cache, generating it on
+  // a miss.
+  static void GetThumbnail(const base::FilePath& path,
+                           const gfx::Size& size,
+                           ThumbnailCallback callback);
+  // Implemented per platform.
+  static void GenerateThumbnail(const base::FilePath& path,
+                                const gfx::Size& size,
+                                ThumbnailCallback callback);
+#endif
 
   // Mark the image as template image.
   void SetTemplateImage(bool setAsTemplate);
@@ -138,7 +173,9 @@ class NativeImage : public gin::Wrappable<NativeImage> {
   gfx::Image image_;
 
   raw_ptr<v8::Isolate> isolate_;
-  int32_t memory_usage_ = 0;
+  int64_t memory_usage_ = 0;
+
+  gin_helper::LiveObject live_object_{"NativeImage"};
 };
 
 }  // namespace electron::api
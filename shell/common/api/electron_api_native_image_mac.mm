@@ -17,7 +17,6 @@
 #include "base/task/bind_post_task.h"
 #include "gin/arguments.h"
 #include "shell/common/gin_converters/image_converter.h"
-#include "shell/common/gin_helper/promise.h"
 #include "ui/gfx/color_utils.h"
 #include "ui/gfx/geometry/size.h"
 #include "ui/gfx/image/image_skia.h"
@@ -40,35 +39,26 @@ double safeShift(double in, double def) {
 }
 
 void ReceivedThumbnailResult(CGSize size,
-                             gin_helper::Promise<gfx::Image> p,
+                             NativeImage::ThumbnailCallback callback,
                              QLThumbnailRepresentation* thumbnail,
                              NSError* error) {
   if (error || !thumbnail) {
     std::string err_msg([error.localizedDescription UTF8String]);
-    p.RejectWithErrorMessage("unable to retrieve thumbnail preview "
-                             "image for the given path: " +
-                             err_msg);
+    std::move(callback).Run(
+        base::unexpected("unable to retrieve thumbnail preview "
+                         "image for the given path: " +
+                         err_msg));
   } else {
     NSImage* result = [[NSImage alloc] initWithCGImage:[thumbnail CGImage]
                                                   size:size];
-    gfx::Image image(result);
-    p.Resolve(image);
+    std::move(callback).Run(gfx::Image(result));
   }
 }
 
 // static
-v8::Local<v8::Promise> NativeImage::CreateThumbnailFromPath(
-    v8::Isolate* isolate,
-    const base::FilePath& path,
-    const gfx::Size& size) {
-  gin_helper::Promise<gfx::Image> promise(isolate);
-  v8::Local<v8::Promise> handle = promise.GetHandle();
-
-  if (size.IsEmpty()) {
-    promise.RejectWithErrorMessage("size must not be empty");
-    return handle;
-  }
-
+void NativeImage::GenerateThumbnail(const base::FilePath& path,
+                                    const gfx::Size& size,
+                                    ThumbnailCallback callback) {
   CGSize cg_size = size.ToCGSize();
 
   NSURL* nsurl = base::apple::FilePathToNSURL(path);
@@ -77,9 +67,9 @@ v8::Local<v8::Promise> NativeImage::CreateThumbnailFromPath(
   // because QLThumbnailGenerationRequest will generate a stock file icon
   // and pass silently if we do not.
   if (![[NSFileManager defaultManager] fileExistsAtPath:[nsurl path]]) {
-    promise.RejectWithErrorMessage(
-        "unable to retrieve thumbnail preview image for the given path");
-    return handle;
+    std::move(callback).Run(base::unexpected(
+        "unable to retrieve thumbnail preview image for the given path"));
+    return;
   }
 
   NSScreen* screen = [[NSScreen screens] firstObject];
@@ -89,7 +79,7 @@ v8::Local<v8::Promise> NativeImage::CreateThumbnailFromPath(
                     scale:[screen backingScaleFactor]
       representationTypes:QLThumbnailGenerationRequestRepresentationTypeAll]);
   __block auto block_callback = base::BindPostTaskToCurrentDefault(
-      base::BindOnce(&ReceivedThumbnailResult, cg_size, std::move(promise)));
+      base::BindOnce(&ReceivedThumbnailResult, cg_size, std::move(callback)));
   auto completionHandler =
       ^(QLThumbnailRepresentation* thumbnail, NSError* error) {
         std::move(block_callback).Run(thumbnail, error);
@@ -97,8 +87,6 @@ v8::Local<v8::Promise> NativeImage::CreateThumbnailFromPath(
   [[QLThumbnailGenerator sharedGenerator]
       generateBestRepresentationForRequest:request
                          completionHandler:completionHandler];
-
-  return handle;
 }
 
 gin::Handle<NativeImage> NativeImage::CreateFromNamedImage(gin::Arguments* args,
@@ -9,81 +9,87 @@
 #include <thumbcache.h>
 #include <wrl/client.h>
 
-#include "base/win/scoped_com_initializer.h"
-#include "shell/common/gin_converters/image_converter.h"
-#include "shell/common/gin_helper/promise.h"
-#include "shell/common/skia_util.h"
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "base/no_destructor.h"
+#include "base/task/single_thread_task_runner.h"
+#include "base/task/thread_pool.h"
+#include "base/win/scoped_gdi_object.h"
 #include "third_party/skia/include/core/SkBitmap.h"
 #include "ui/gfx/icon_util.h"
 #include "ui/gfx/image/image_skia.h"
 
 namespace electron::api {
 
-// static
-v8::Local<v8::Promise> NativeImage::CreateThumbnailFromPath(
-    v8::Isolate* isolate,
-    const base::FilePath& path,
-    const gfx::Size& size) {
-  base::win::ScopedCOMInitializer scoped_com_initializer;
+namespace {
+
+// Thumbnails are generated on a few COM threads in turn, so a batch is not
+// serialized behind one slow shell thumbnail provider.
+constexpr size_t kThumbnailThreadCount = 4;
+
+scoped_refptr<base::SingleThreadTaskRunner> GetThumbnailTaskRunner() {
+  static base::NoDestructor<
+      std::vector<scoped_refptr<base::SingleThreadTaskRunner>>>
+      task_runners;
+  static size_t next = 0;
+  if (task_runners->empty()) {
+    for (size_t i = 0; i < kThumbnailThreadCount; ++i) {
+      task_runners->push_back(base::ThreadPool::CreateCOMSTATaskRunner(
+          {base::MayBlock(), base::TaskPriority::USER_VISIBLE,
+           base::TaskShutdownBehavior::SKIP_ON_SHUTDOWN},
+          base::SingleThreadTaskRunnerThreadMode::DEDICATED));
+    }
+  }
+  return (*task_runners)[next++ % kThumbnailThreadCount];
+}
 
-  gin_helper::Promise<gfx::Image> promise(isolate);
-  v8::Local<v8::Promise> handle = promise.GetHandle();
+base::expected<SkBitmap, std::string> GetThumbnailBitmap(
+    const base::FilePath& path,
+    int width) {
   HRESULT hr;
 
-  if (size.IsEmpty()) {
-    promise.RejectWithErrorMessage("size must not be empty");
-    return handle;
-  }
-
   // create an IShellItem
   Microsoft::WRL::ComPtr<IShellItem> pItem;
   std::wstring image_path = path.value();
   hr = SHCreateItemFromParsingName(image_path.c_str(), nullptr,
                                    IID_PPV_ARGS(&pItem));
 
-  if (FAILED(hr)) {
-    promise.RejectWithErrorMessage(
-        "Failed to create IShellItem from the given path");
-    return handle;
-  }
+  if (FAILED(hr))
+    return base::unexpected("Failed to create IShellItem from the given path");
 
   // Init thumbnail cache
   Microsoft::WRL::ComPtr<IThumbnailCache> pThumbnailCache;
   hr = CoCreateInstance(CLSID_LocalThumbnailCache, nullptr, CLSCTX_INPROC,
                         IID_PPV_ARGS(&pThumbnailCache));
   if (FAILED(hr)) {
-    promise.RejectWithErrorMessage(
+    return base::unexpected(
         "Failed to acquire local thumbnail cache reference");
-    return handle;
   }
 
   // Populate the IShellBitmap
   Microsoft::WRL::ComPtr<ISharedBitmap> pThumbnail;
   hr = pThumbnailCache->GetThumbnail(
-      pItem.Get(), size.width(),
+      pItem.Get(), width,
       WTS_FLAGS::WTS_SCALETOREQUESTEDSIZE | WTS_FLAGS::WTS_SCALEUP, &pThumbnail,
       nullptr, nullptr);
 
   if (FAILED(hr)) {
-    promise.RejectWithErrorMessage(
+    return base::unexpected(
         "Failed to get thumbnail from local thumbnail cache reference");
-    return handle;
   }
 
   // Init HBITMAP
   HBITMAP hBitmap = nullptr;
   hr = pThumbnail->GetSharedBitmap(&hBitmap);
-  if (FAILED(hr)) {
-    promise.RejectWithErrorMessage("Failed to extract bitmap from thumbnail");
-    return handle;
-  }
+  if (FAILED(hr))
+    return base::unexpected("Failed to extract bitmap from thumbnail");
 
   // convert HBITMAP to gfx::Image
   BITMAP bitmap;
-  if (!GetObject(hBitmap, sizeof(bitmap), &bitmap)) {
-    promise.RejectWithErrorMessage("Could not convert HBITMAP to BITMAP");
-    return handle;
-  }
+  if (!GetObject(hBitmap, sizeof(bitmap), &bitmap))
+    return base::unexpected("Could not convert HBITMAP to BITMAP");
 
   ICONINFO icon_info;
   icon_info.fIcon = TRUE;
@@ -91,12 +97,31 @@ v8::Local<v8::Promise> NativeImage::CreateThumbnailFromPath(
   icon_info.hbmColor = hBitmap;
 
   base::win::ScopedHICON icon(CreateIconIndirect(&icon_info));
-  SkBitmap skbitmap = IconUtil::CreateSkBitmapFromHICON(icon.get());
-  gfx::ImageSkia image_skia =
-      gfx::ImageSkia::CreateFromBitmap(skbitmap, 1.0 /*scale factor*/);
-  gfx::Image gfx_image = gfx::Image(image_skia);
-  promise.Resolve(gfx_image);
-  return handle;
+  return IconUtil::CreateSkBitmapFromHICON(icon.get());
+}
+
+}  // namespace
+
+// static
+void NativeImage::GenerateThumbnail(const base::FilePath& path,
+                                    const gfx::Size& size,
+                                    ThumbnailCallback callback) {
+  // The shell calls run on a COM thread; the image is created back on this
+  // sequence since gfx::ImageSkia is not thread-safe.
+  GetThumbnailTaskRunner()->PostTaskAndReplyWithResult(
+      FROM_HERE, base::BindOnce(&GetThumbnailBitmap, path, size.width()),
+      base::BindOnce(
+          [](ThumbnailCallback callback,
+             base::expected<SkBitmap, std::string> bitmap) {
+            if (!bitmap.has_value()) {
+              std::move(callback).Run(base::unexpected(bitmap.error()));
+              return;
+            }
+            gfx::ImageSkia image_skia =
+                gfx::ImageSkia::CreateFromBitmap(*bitmap, 1.0 /*scale factor*/);
+            std::move(callback).Run(gfx::Image(image_skia));
+          },
+          std::move(callback)));
 }
 
 }  // namespace electron::api
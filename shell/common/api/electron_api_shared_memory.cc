@@ -0,0 +1,220 @@
+// Copyright (c) 2024 Microsoft, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#include "shell/common/api/electron_api_shared_memory.h"
+
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+
+#include "gin/arguments.h"
+#include "gin/object_template_builder.h"
+#include "shell/common/gin_helper/dictionary.h"
+#include "shell/common/node_includes.h"
+#include "v8/include/v8-array-buffer.h"
+#include "v8/include/v8-typed-array.h"
+
+namespace electron::api {
+
+namespace {
+
+constexpr double kMaxSharedMemorySize = 1 << 30;
+
+constexpr char kInvalidAtomicOffset[] =
+    "offset must be a multiple of 4 within the memory";
+
+// Reads the next argument of |args|, if present, as an integer in [0, max].
+// Uses |default_value| when the argument is missing or undefined.
+bool GetOptionalIndex(gin::Arguments* args,
+                      size_t max,
+                      size_t* result,
+                      size_t default_value = 0) {
+  v8::Local<v8::Value> value = args->PeekNext();
+  if (value.IsEmpty() || value->IsUndefined()) {
+    if (!value.IsEmpty())
+      args->GetNext(&value);
+    *result = default_value;
+    return true;
+  }
+  double index = 0;
+  if (!args->GetNext(&index) || !(index >= 0) || index > max ||
+      std::floor(index) != index) {
+    return false;
+  }
+  *result = static_cast<size_t>(index);
+  return true;
+}
+
+// Reads the offset of a 32-bit value that can be accessed atomically.
+bool GetAtomicOffset(gin::Arguments* args, size_t size, size_t* offset) {
+  return size >= sizeof(uint32_t) &&
+         GetOptionalIndex(args, size - sizeof(uint32_t), offset) &&
+         *offset % sizeof(uint32_t) == 0;
+}
+
+// Mappings are page aligned, so every multiple of 4 is a suitably aligned
+// address for a 32-bit atomic.
+std::atomic<uint32_t>* GetAtomic(uint8_t* memory, size_t offset) {
+  static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t));
+  static_assert(std::atomic<uint32_t>::is_always_lock_free);
+  return reinterpret_cast<std::atomic<uint32_t>*>(memory + offset);
+}
+
+}  // namespace
+
+gin::WrapperInfo SharedMemory::kWrapperInfo = {gin::kEmbedderNativeGin};
+
+SharedMemory::SharedMemory(base::UnsafeSharedMemoryRegion region)
+    : region_(std::move(region)) {}
+
+SharedMemory::~SharedMemory() = default;
+
+// static
+gin::Handle<SharedMemory> SharedMemory::Create(
+    gin_helper::ErrorThrower thrower,
+    double size) {
+  if (!(size >= 1) || size > kMaxSharedMemorySize ||
+      std::floor(size) != size) {
+    thrower.ThrowRangeError("size must be a positive integer up to 1GiB");
+    return gin::Handle<SharedMemory>();
+  }
+  auto region =
+      base::UnsafeSharedMemoryRegion::Create(static_cast<size_t>(size));
+  if (!region.IsValid()) {
+    thrower.ThrowError("Failed to allocate shared memory");
+    return gin::Handle<SharedMemory>();
+  }
+  return Create(thrower.isolate(), std::move(region));
+}
+
+// static
+gin::Handle<SharedMemory> SharedMemory::Create(
+    v8::Isolate* isolate,
+    base::UnsafeSharedMemoryRegion region) {
+  return gin::CreateHandle(isolate, new SharedMemory(std::move(region)));
+}
+
+size_t SharedMemory::GetSize() const {
+  return region_.GetSize();
+}
+
+uint8_t* SharedMemory::GetMemory(gin_helper::ErrorThrower thrower) {
+  if (!mapping_.IsValid())
+    mapping_ = region_.Map();
+  if (!mapping_.IsValid()) {
+    thrower.ThrowError("Failed to map shared memory");
+    return nullptr;
+  }
+  return mapping_.GetMemoryAsSpan<uint8_t>().data();
+}
+
+v8::Local<v8::Value> SharedMemory::Read(gin::Arguments* args) {
+  gin_helper::ErrorThrower thrower(args->isolate());
+  const size_t size = GetSize();
+  size_t offset = 0;
+  size_t length = 0;
+  if (!GetOptionalIndex(args, size, &offset) ||
+      !GetOptionalIndex(args, size - offset, &length, size - offset)) {
+    thrower.ThrowRangeError("offset and length must be within the memory");
+    return v8::Undefined(args->isolate());
+  }
+  uint8_t* memory = GetMemory(thrower);
+  if (!memory)
+    return v8::Undefined(args->isolate());
+  auto buffer = v8::ArrayBuffer::New(args->isolate(), length);
+  memcpy(buffer->Data(), memory + offset, length);
+  return v8::Uint8Array::New(buffer, 0, length);
+}
+
+void SharedMemory::Write(gin::Arguments* args) {
+  gin_helper::ErrorThrower thrower(args->isolate());
+  v8::Local<v8::Value> data;
+  if (!args->GetNext(&data) || !data->IsArrayBufferView()) {
+    thrower.ThrowTypeError("data must be an ArrayBufferView");
+    return;
+  }
+  auto view = data.As<v8::ArrayBufferView>();
+  const size_t size = GetSize();
+  size_t offset = 0;
+  if (!GetOptionalIndex(args, size, &offset) ||
+      view->ByteLength() > size - offset) {
+    thrower.ThrowRangeError("data must fit in the memory at offset");
+    return;
+  }
+  uint8_t* memory = GetMemory(thrower);
+  if (memory)
+    view->CopyContents(memory + offset, view->ByteLength());
+}
+
+v8::Local<v8::Value> SharedMemory::LoadUint32(gin::Arguments* args) {
+  gin_helper::ErrorThrower thrower(args->isolate());
+  size_t offset = 0;
+  if (!GetAtomicOffset(args, GetSize(), &offset)) {
+    thrower.ThrowRangeError(kInvalidAtomicOffset);
+    return v8::Undefined(args->isolate());
+  }
+  uint8_t* memory = GetMemory(thrower);
+  if (!memory)
+    return v8::Undefined(args->isolate());
+  return gin::ConvertToV8(args->isolate(),
+                          GetAtomic(memory, offset)->load());
+}
+
+void SharedMemory::StoreUint32(gin::Arguments* args) {
+  gin_helper::ErrorThrower thrower(args->isolate());
+  size_t offset = 0;
+  if (!GetAtomicOffset(args, GetSize(), &offset)) {
+    thrower.ThrowRangeError(kInvalidAtomicOffset);
+    return;
+  }
+  double value = 0;
+  if (!args->GetNext(&value) || !(value >= 0) || value > UINT32_MAX ||
+      std::floor(value) != value) {
+    thrower.ThrowRangeError("value must be an unsigned 32-bit integer");
+    return;
+  }
+  uint8_t* memory = GetMemory(thrower);
+  if (memory)
+    GetAtomic(memory, offset)->store(static_cast<uint32_t>(value));
+}
+
+gin::ObjectTemplateBuilder SharedMemory::GetObjectTemplateBuilder(
+    v8::Isolate* isolate) {
+  return gin::Wrappable<SharedMemory>::GetObjectTemplateBuilder(isolate)
+      .SetProperty("size", &SharedMemory::GetSize)
+      .SetMethod("read", &SharedMemory::Read)
+      .SetMethod("write", &SharedMemory::Write)
+      .SetMethod("loadUint32", &SharedMemory::LoadUint32)
+      .SetMethod("storeUint32", &SharedMemory::StoreUint32);
+}
+
+const char* SharedMemory::GetTypeName() {
+  return "SharedMemory";
+}
+
+}  // namespace electron::api
+
+namespace {
+
+using electron::api::SharedMemory;
+
+void Initialize(v8::Local<v8::Object> exports,
+                v8::Local<v8::Value> unused,
+                v8::Local<v8::Context> context,
+                void* priv) {
+  v8::Isolate* isolate = context->GetIsolate();
+  gin_helper::Dictionary dict(isolate, exports);
+  auto shared_memory = gin_helper::Dictionary::CreateEmpty(isolate);
+  dict.Set("sharedMemory", shared_memory);
+
+  shared_memory.SetMethod(
+      "create", static_cast<gin::Handle<SharedMemory> (*)(
+                    gin_helper::ErrorThrower, double)>(&SharedMemory::Create));
+}
+
+}  // namespace
+
+NODE_LINKED_BINDING_CONTEXT_AWARE(electron_common_shared_memory, Initialize)
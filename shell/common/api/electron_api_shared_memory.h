@@ -0,0 +1,66 @@
+// Copyright (c) 2024 Microsoft, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#ifndef ELECTRON_SHELL_COMMON_API_ELECTRON_API_SHARED_MEMORY_H_
+#define ELECTRON_SHELL_COMMON_API_ELECTRON_API_SHARED_MEMORY_H_
+
+#include "base/memory/shared_memory_mapping.h"
+#include "base/memory/unsafe_shared_memory_region.h"
+#include "gin/handle.h"
+#include "gin/wrappable.h"
+#include "shell/common/gin_helper/error_thrower.h"
+
+namespace gin {
+class Arguments;
+}
+
+namespace electron::api {
+
+// A block of memory that can be sent to other processes in a postMessage()
+// call. Every process that receives it maps the same memory.
+//
+// The mapping lives outside of the V8 sandbox, so it can't back an
+// ArrayBuffer. JS reads and writes it through methods that copy between the
+// mapping and buffers allocated by V8.
+class SharedMemory : public gin::Wrappable<SharedMemory> {
+ public:
+  static gin::Handle<SharedMemory> Create(gin_helper::ErrorThrower thrower,
+                                          double size);
+  static gin::Handle<SharedMemory> Create(
+      v8::Isolate* isolate,
+      base::UnsafeSharedMemoryRegion region);
+
+  // disable copy
+  SharedMemory(const SharedMemory&) = delete;
+  SharedMemory& operator=(const SharedMemory&) = delete;
+
+  const base::UnsafeSharedMemoryRegion& region() const { return region_; }
+
+  // gin::Wrappable
+  static gin::WrapperInfo kWrapperInfo;
+  gin::ObjectTemplateBuilder GetObjectTemplateBuilder(
+      v8::Isolate* isolate) override;
+  const char* GetTypeName() override;
+
+ private:
+  explicit SharedMemory(base::UnsafeSharedMemoryRegion region);
+  ~SharedMemory() override;
+
+  size_t GetSize() const;
+  v8::Local<v8::Value> Read(gin::Arguments* args);
+  void Write(gin::Arguments* args);
+  v8::Local<v8::Value> LoadUint32(gin::Arguments* args);
+  void StoreUint32(gin::Arguments* args);
+
+  // Maps |region_| the first time the memory is accessed. Throws and returns
+  // nullptr if that fails.
+  uint8_t* GetMemory(gin_helper::ErrorThrower thrower);
+
+  base::UnsafeSharedMemoryRegion region_;
+  base::WritableSharedMemoryMapping mapping_;
+};
+
+}  // namespace electron::api
+
+#endif  // ELECTRON_SHELL_COMMON_API_ELECTRON_API_SHARED_MEMORY_H_
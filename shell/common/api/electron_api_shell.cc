@@ -3,11 +3,15 @@
 // found in the LICENSE file.
 
 #include <string>
+#include <utility>
+#include <vector>
 
+#include "base/values.h"
 #include "shell/common/gin_converters/callback_converter.h"
 #include "shell/common/gin_converters/file_path_converter.h"
 #include "shell/common/gin_converters/guid_converter.h"
 #include "shell/common/gin_converters/gurl_converter.h"
+#include "shell/common/gin_converters/value_converter.h"
 #include "shell/common/gin_helper/dictionary.h"
 #include "shell/common/gin_helper/error_thrower.h"
 #include "shell/common/gin_helper/promise.h"
@@ -104,6 +108,44 @@ v8::Local<v8::Promise> TrashItem(v8::Isolate* isolate,
   return handle;
 }
 
+v8::Local<v8::Promise> TrashItems(std::vector<base::FilePath> paths,
+                                  gin::Arguments* args) {
+  gin_helper::Promise<base::Value::List> promise(args->isolate());
+  v8::Local<v8::Promise> handle = promise.GetHandle();
+
+  platform_util::TrashItemsProgressCallback progress;
+  base::RepeatingCallback<void(int, int)> on_progress;
+  if (args->GetNext(&on_progress)) {
+    progress = base::BindRepeating(
+        [](const base::RepeatingCallback<void(int, int)>& on_progress,
+           int total, size_t completed) {
+          on_progress.Run(static_cast<int>(completed), total);
+        },
+        std::move(on_progress), static_cast<int>(paths.size()));
+  }
+
+  std::vector<base::FilePath> full_paths = paths;
+  platform_util::TrashItems(
+      std::move(full_paths), std::move(progress),
+      base::BindOnce(
+          [](gin_helper::Promise<base::Value::List> promise,
+             std::vector<base::FilePath> paths,
+             std::vector<std::string> errors) {
+            base::Value::List results;
+            for (size_t i = 0; i < paths.size(); ++i) {
+              base::Value::Dict result;
+              result.Set("path", paths[i].AsUTF8Unsafe());
+              result.Set("success", errors[i].empty());
+              if (!errors[i].empty())
+                result.Set("error", std::move(errors[i]));
+              results.Append(std::move(result));
+            }
+            promise.Resolve(std::move(results));
+          },
+          std::move(promise), std::move(paths)));
+  return handle;
+}
+
 #if BUILDFLAG(IS_WIN)
 
 bool WriteShortcutLink(const base::FilePath& shortcut_path,
@@ -176,6 +218,7 @@ void Initialize(v8::Local<v8::Object> exports,
   dict.SetMethod("openPath", &OpenPath);
   dict.SetMethod("openExternal", &OpenExternal);
   dict.SetMethod("trashItem", &TrashItem);
+  dict.SetMethod("trashItems", &TrashItems);
   dict.SetMethod("beep", &platform_util::Beep);
 #if BUILDFLAG(IS_WIN)
   dict.SetMethod("writeShortcutLink", &WriteShortcutLink);
@@ -0,0 +1,131 @@
+// Copyright (c) 2024 Microsoft, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#include <optional>
+#include <string>
+
+#include "base/trace_event/trace_event.h"
+#include "base/values.h"
+#include "gin/arguments.h"
+#include "shell/common/gin_converters/value_converter.h"
+#include "shell/common/gin_helper/dictionary.h"
+#include "shell/common/node_includes.h"
+#include "third_party/perfetto/include/perfetto/tracing/track_event.h"
+
+namespace {
+
+struct EventOptions {
+  base::Value::Dict args;
+  std::optional<uint64_t> flow_id;
+  bool terminating_flow = false;
+};
+
+// Categories are only known at runtime, checking them is a cheap no-op while
+// no trace is being recorded.
+bool IsEnabled(const std::string& category) {
+  return TRACE_EVENT_CATEGORY_ENABLED(perfetto::DynamicCategory(category));
+}
+
+bool ParseEventOptions(gin::Arguments* args, EventOptions* options) {
+  gin_helper::Dictionary dict;
+  if (!args->GetNext(&dict))
+    return true;
+
+  v8::Local<v8::Value> event_args;
+  if (dict.Get("args", &event_args) && !event_args->IsUndefined() &&
+      !gin::ConvertFromV8(args->isolate(), event_args, &options->args)) {
+    args->ThrowTypeError("args must be an object");
+    return false;
+  }
+
+  double flow_id;
+  if (dict.Get("flowId", &flow_id)) {
+    if (!(flow_id >= 0) || flow_id != static_cast<uint64_t>(flow_id)) {
+      args->ThrowTypeError("flowId must be a non-negative integer");
+      return false;
+    }
+    options->flow_id = static_cast<uint64_t>(flow_id);
+  }
+  dict.Get("terminatingFlow", &options->terminating_flow);
+  return true;
+}
+
+void WriteEventOptions(perfetto::EventContext& ctx,
+                       const EventOptions& options) {
+  for (const auto [key, value] : options.args)
+    ctx.AddDebugAnnotation(perfetto::DynamicString(key), value);
+
+  // Flows are global so that they can connect events of different processes.
+  if (options.flow_id) {
+    if (options.terminating_flow)
+      perfetto::TerminatingFlow::Global(*options.flow_id)(ctx);
+    else
+      perfetto::Flow::Global(*options.flow_id)(ctx);
+  }
+}
+
+void Begin(const std::string& category,
+           const std::string& name,
+           gin::Arguments* args) {
+  if (!IsEnabled(category))
+    return;
+  EventOptions options;
+  if (!ParseEventOptions(args, &options))
+    return;
+  TRACE_EVENT_BEGIN(perfetto::DynamicCategory(category),
+                    perfetto::DynamicString(name),
+                    [&options](perfetto::EventContext ctx) {
+                      WriteEventOptions(ctx, options);
+                    });
+}
+
+void End(const std::string& category) {
+  if (!IsEnabled(category))
+    return;
+  TRACE_EVENT_END(perfetto::DynamicCategory(category));
+}
+
+void Instant(const std::string& category,
+             const std::string& name,
+             gin::Arguments* args) {
+  if (!IsEnabled(category))
+    return;
+  EventOptions options;
+  if (!ParseEventOptions(args, &options))
+    return;
+  TRACE_EVENT_INSTANT(perfetto::DynamicCategory(category),
+                      perfetto::DynamicString(name),
+                      [&options](perfetto::EventContext ctx) {
+                        WriteEventOptions(ctx, options);
+                      });
+}
+
+void Counter(const std::string& category,
+             const std::string& name,
+             double value) {
+  if (!IsEnabled(category))
+    return;
+  TRACE_COUNTER(perfetto::DynamicCategory(category),
+                perfetto::CounterTrack(perfetto::DynamicString(name)), value);
+}
+
+void Initialize(v8::Local<v8::Object> exports,
+                v8::Local<v8::Value> unused,
+                v8::Local<v8::Context> context,
+                void* priv) {
+  v8::Isolate* isolate = context->GetIsolate();
+  gin_helper::Dictionary dict(isolate, exports);
+  auto trace_events = gin_helper::Dictionary::CreateEmpty(isolate);
+  dict.Set("traceEvents", trace_events);
+
+  trace_events.SetMethod("isEnabled", &IsEnabled);
+  trace_events.SetMethod("begin", &Begin);
+  trace_events.SetMethod("end", &End);
+  trace_events.SetMethod("instant", &Instant);
+  trace_events.SetMethod("counter", &Counter);
+}
+
+}  // namespace
+
+NODE_LINKED_BINDING_CONTEXT_AWARE(electron_common_trace_events, Initialize)
@@ -12,16 +12,19 @@
 #include <vector>
 
 #include "base/containers/fixed_flat_map.h"
+#include "base/functional/callback_helpers.h"
 #include "base/memory/raw_ptr.h"
 #include "base/no_destructor.h"
 #include "base/sequence_checker.h"
 #include "base/strings/string_number_conversions.h"
+#include "base/task/sequenced_task_runner.h"
 #include "gin/handle.h"
 #include "gin/object_template_builder.h"
 #include "gin/wrappable.h"
 #include "mojo/public/cpp/bindings/remote.h"
 #include "mojo/public/cpp/system/data_pipe_producer.h"
 #include "net/base/load_flags.h"
+#include "net/base/request_priority.h"
 #include "net/http/http_util.h"
 #include "net/url_request/redirect_util.h"
 #include "services/network/public/cpp/resource_request.h"
@@ -326,10 +329,12 @@ gin::WrapperInfo SimpleURLLoaderWrapper::kWrapperInfo = {
 SimpleURLLoaderWrapper::SimpleURLLoaderWrapper(
     ElectronBrowserContext* browser_context,
     std::unique_ptr<network::ResourceRequest> request,
-    int options)
+    int options,
+    size_t response_buffer_size)
     : browser_context_(browser_context),
       request_options_(options),
-      request_(std::move(request)) {
+      request_(std::move(request)),
+      response_buffer_size_(response_buffer_size) {
   DETACH_FROM_SEQUENCE(sequence_checker_);
   if (!request_->trusted_params)
     request_->trusted_params = network::ResourceRequest::TrustedParams();
@@ -466,6 +471,9 @@ void SimpleURLLoaderWrapper::Clone(
 
 void SimpleURLLoaderWrapper::Cancel() {
   loader_.reset();
+  buffered_data_.reset();
+  buffered_data_size_ = 0;
+  resume_after_consumed_.Reset();
   pinned_wrapper_.Reset();
   pinned_chunk_pipe_getter_.Reset();
   // This ensures that no further callbacks will be called, so there's no need
@@ -497,10 +505,8 @@ SimpleURLLoaderWrapper::GetURLLoaderFactoryForURL(const GURL& url) {
             std::move(pending_remote)));
   } else if (!bypass_custom_protocol_handlers &&
              protocol_registry->IsProtocolRegistered(url.scheme())) {
-    auto& protocol_handler = protocol_registry->handlers().at(url.scheme());
     mojo::PendingRemote<network::mojom::URLLoaderFactory> pending_remote =
-        ElectronURLLoaderFactory::Create(protocol_handler.first,
-                                         protocol_handler.second);
+        protocol_registry->CreateRegisteredURLLoaderFactory(url.scheme());
     url_loader_factory = network::SharedURLLoaderFactory::Create(
         std::make_unique<network::WrapperPendingSharedURLLoaderFactory>(
             std::move(pending_remote)));
@@ -589,6 +595,20 @@ gin::Handle<SimpleURLLoaderWrapper> SimpleURLLoaderWrapper::Create(
       request->destination = iter->second;
   }
 
+  if (std::string priority; opts.Get("priority", &priority)) {
+    static constexpr auto Lookup =
+        base::MakeFixedFlatMap<std::string_view, net::RequestPriority>({
+            {"throttled", net::THROTTLED},
+            {"idle", net::IDLE},
+            {"lowest", net::LOWEST},
+            {"low", net::LOW},
+            {"medium", net::MEDIUM},
+            {"highest", net::HIGHEST},
+        });
+    if (auto* iter = Lookup.find(priority); iter != Lookup.end())
+      request->priority = iter->second;
+  }
+
   bool credentials_specified =
       opts.Get("credentials", &request->credentials_mode);
   std::vector<std::pair<std::string, std::string>> extra_headers;
@@ -649,6 +669,9 @@ gin::Handle<SimpleURLLoaderWrapper> SimpleURLLoaderWrapper::Create(
   if (bypass_custom_protocol_handlers)
     options |= kBypassCustomProtocolHandlers;
 
+  uint32_t response_buffer_size = 0;
+  opts.Get("responseBufferSize", &response_buffer_size);
+
   v8::Local<v8::Value> body;
   v8::Local<v8::Value> chunk_pipe_getter;
   if (opts.Get("body", &body)) {
@@ -690,7 +713,8 @@ gin::Handle<SimpleURLLoaderWrapper> SimpleURLLoaderWrapper::Create(
 
   auto ret = gin::CreateHandle(
       args->isolate(),
-      new SimpleURLLoaderWrapper(browser_context, std::move(request), options));
+      new SimpleURLLoaderWrapper(browser_context, std::move(request), options,
+                                 response_buffer_size));
   ret->Pin();
   if (!chunk_pipe_getter.IsEmpty()) {
     ret->PinBodyGetter(chunk_pipe_getter);
@@ -701,6 +725,10 @@ gin::Handle<SimpleURLLoaderWrapper> SimpleURLLoaderWrapper::Create(
 void SimpleURLLoaderWrapper::OnDataReceived(std::string_view string_piece,
                                             base::OnceClosure resume) {
   DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  if (response_buffer_size_) {
+    BufferData(string_piece, std::move(resume));
+    return;
+  }
   v8::Isolate* isolate = JavascriptEnvironment::GetIsolate();
   v8::HandleScope handle_scope(isolate);
   auto array_buffer = v8::ArrayBuffer::New(isolate, string_piece.size());
@@ -710,8 +738,93 @@ void SimpleURLLoaderWrapper::OnDataReceived(std::string_view string_piece,
        base::AdaptCallbackForRepeating(std::move(resume)));
 }
 
+void SimpleURLLoaderWrapper::BufferData(std::string_view data,
+                                        base::OnceClosure resume) {
+  ++chunks_received_;
+  if (!buffered_data_) {
+    buffered_data_ = v8::ArrayBuffer::NewBackingStore(
+        JavascriptEnvironment::GetIsolate(), response_buffer_size_);
+  }
+  const size_t count =
+      std::min(data.size(), response_buffer_size_ - buffered_data_size_);
+  memcpy(static_cast<char*>(buffered_data_->Data()) + buffered_data_size_,
+         data.data(), count);
+  buffered_data_size_ += count;
+  data.remove_prefix(count);
+
+  if (buffered_data_size_ < response_buffer_size_) {
+    // Resuming reads whatever is already in the pipe synchronously, so post it
+    // to avoid reentrancy and to find out afterwards whether it was drained.
+    base::SequencedTaskRunner::GetCurrentDefault()->PostTask(
+        FROM_HERE, base::BindOnce(&SimpleURLLoaderWrapper::ResumeAndMaybeFlush,
+                                  weak_factory_.GetWeakPtr(), std::move(resume)));
+    return;
+  }
+
+  // The buffer is full. The rest of |data| stays valid until |resume| is run,
+  // so hold on to both until JS has consumed the buffer.
+  resume_after_consumed_ =
+      base::BindOnce(&SimpleURLLoaderWrapper::BufferData,
+                     weak_factory_.GetWeakPtr(), data, std::move(resume));
+  if (!waiting_for_consumer_)
+    FlushBufferedData(true);
+}
+
+void SimpleURLLoaderWrapper::ResumeAndMaybeFlush(base::OnceClosure resume) {
+  const uint64_t chunks_received = chunks_received_;
+  std::move(resume).Run();
+  // Nothing was read synchronously, so hand what we have to JS rather than
+  // waiting for the network to fill the buffer.
+  if (loader_ && chunks_received_ == chunks_received && !waiting_for_consumer_)
+    FlushBufferedData(true);
+}
+
+void SimpleURLLoaderWrapper::FlushBufferedData(bool wait_for_resume) {
+  if (!buffered_data_size_)
+    return;
+  v8::Isolate* isolate = JavascriptEnvironment::GetIsolate();
+  v8::HandleScope handle_scope(isolate);
+  v8::Local<v8::ArrayBuffer> array_buffer;
+  if (buffered_data_size_ * 2 < response_buffer_size_) {
+    // Don't pin a mostly empty buffer in memory for a small tail.
+    array_buffer = v8::ArrayBuffer::New(isolate, buffered_data_size_);
+    memcpy(array_buffer->Data(), buffered_data_->Data(), buffered_data_size_);
+    buffered_data_.reset();
+  } else {
+    array_buffer = v8::ArrayBuffer::New(isolate, std::move(buffered_data_));
+  }
+  auto data = v8::Uint8Array::New(array_buffer, 0, buffered_data_size_);
+  buffered_data_size_ = 0;
+
+  waiting_for_consumer_ = wait_for_resume;
+  base::RepeatingClosure resume = base::DoNothing();
+  if (wait_for_resume) {
+    resume = base::AdaptCallbackForRepeating(
+        base::BindOnce(&SimpleURLLoaderWrapper::OnBufferedDataConsumed,
+                       weak_factory_.GetWeakPtr()));
+  }
+  Emit("data", data, resume);
+
+  // Report progress once per buffer rather than once per chunk.
+  if (pending_download_progress_)
+    Emit("download-progress", *std::exchange(pending_download_progress_, {}));
+}
+
+void SimpleURLLoaderWrapper::OnBufferedDataConsumed() {
+  waiting_for_consumer_ = false;
+  if (!loader_)
+    return;
+  if (resume_after_consumed_)
+    std::move(resume_after_consumed_).Run();
+  else
+    FlushBufferedData(true);
+}
+
 void SimpleURLLoaderWrapper::OnComplete(bool success) {
   if (success) {
+    FlushBufferedData(false);
+    if (pending_download_progress_)
+      Emit("download-progress", *pending_download_progress_);
     Emit("complete");
   } else {
     Emit("error", net::ErrorToString(loader_->NetError()));
@@ -791,6 +904,10 @@ void SimpleURLLoaderWrapper::OnUploadProgress(uint64_t position,
 }
 
 void SimpleURLLoaderWrapper::OnDownloadProgress(uint64_t current) {
+  if (response_buffer_size_) {
+    pending_download_progress_ = current;
+    return;
+  }
   Emit("download-progress", current);
 }
 
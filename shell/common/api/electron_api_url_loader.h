@@ -6,7 +6,9 @@
 #define ELECTRON_SHELL_BROWSER_API_ELECTRON_API_URL_LOADER_H_
 
 #include <memory>
+#include <optional>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include "base/memory/raw_ptr.h"
@@ -63,7 +65,8 @@ class SimpleURLLoaderWrapper
  private:
   SimpleURLLoaderWrapper(ElectronBrowserContext* browser_context,
                          std::unique_ptr<network::ResourceRequest> request,
-                         int options);
+                         int options,
+                         size_t response_buffer_size);
 
   // SimpleURLLoaderStreamConsumer:
   void OnDataReceived(base::StringPiece string_piece,
@@ -132,6 +135,12 @@ class SimpleURLLoaderWrapper
   void OnUploadProgress(uint64_t position, uint64_t total);
   void OnDownloadProgress(uint64_t current);
 
+  // Coalescing of response data into |response_buffer_size_| sized buffers.
+  void BufferData(std::string_view data, base::OnceClosure resume);
+  void ResumeAndMaybeFlush(base::OnceClosure resume);
+  void FlushBufferedData(bool wait_for_resume);
+  void OnBufferedDataConsumed();
+
   void Start();
   void Pin();
   void PinBodyGetter(v8::Local<v8::Value>);
@@ -145,6 +154,19 @@ class SimpleURLLoaderWrapper
   v8::Global<v8::Value> pinned_wrapper_;
   v8::Global<v8::Value> pinned_chunk_pipe_getter_;
 
+  // When non-zero, response data is delivered to JS in buffers of up to this
+  // many bytes instead of one buffer per chunk read from the network.
+  const size_t response_buffer_size_;
+  std::unique_ptr<v8::BackingStore> buffered_data_;
+  size_t buffered_data_size_ = 0;
+  // Counts the chunks received, to tell whether resuming read anything.
+  uint64_t chunks_received_ = 0;
+  // True while JS has not yet consumed the last buffer it was handed.
+  bool waiting_for_consumer_ = false;
+  // Continues reading from the network once JS has consumed a full buffer.
+  base::OnceClosure resume_after_consumed_;
+  std::optional<uint64_t> pending_download_progress_;
+
   mojo::ReceiverSet<network::mojom::URLLoaderNetworkServiceObserver>
       url_loader_network_observer_receivers_;
   base::WeakPtrFactory<SimpleURLLoaderWrapper> weak_factory_{this};
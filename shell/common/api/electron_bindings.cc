@@ -5,14 +5,21 @@
 #include "shell/common/api/electron_bindings.h"
 
 #include <algorithm>
+#include <memory>
 #include <string>
+#include <string_view>
 #include <utility>
 #include <vector>
 
+#include "base/allocator/partition_allocator/src/partition_alloc/partition_alloc_buildflags.h"
+#include "base/allocator/partition_allocator/src/partition_alloc/partition_root.h"
+#include "base/allocator/partition_allocator/src/partition_alloc/partition_stats.h"
 #include "base/containers/contains.h"
 #include "base/logging.h"
 #include "base/process/process.h"
 #include "base/process/process_handle.h"
+#include "base/process/process_metrics.h"
+#include "base/strings/string_number_conversions.h"
 #include "base/system/sys_info.h"
 #include "services/resource_coordinator/public/cpp/memory_instrumentation/global_memory_dump.h"
 #include "services/resource_coordinator/public/cpp/memory_instrumentation/memory_instrumentation.h"
@@ -20,16 +27,113 @@
 #include "shell/common/application_info.h"
 #include "shell/common/gin_converters/file_path_converter.h"
 #include "shell/common/gin_helper/dictionary.h"
+#include "shell/common/gin_helper/live_object.h"
 #include "shell/common/gin_helper/microtasks_scope.h"
+#include "shell/common/gin_helper/object_shape.h"
 #include "shell/common/gin_helper/promise.h"
 #include "shell/common/heap_snapshot.h"
 #include "shell/common/node_includes.h"
 #include "shell/common/process_util.h"
 #include "shell/common/thread_restrictions.h"
 #include "third_party/blink/renderer/platform/heap/process_heap.h"  // nogncheck
+#include "v8/include/v8-profiler.h"
+
+#if BUILDFLAG(USE_PARTITION_ALLOC_AS_MALLOC)
+#include "base/allocator/partition_allocator/src/partition_alloc/shim/allocator_shim_default_dispatch_to_partition_alloc.h"
+#endif
 
 namespace electron {
 
+namespace {
+
+// The defaults of the DevTools protocol.
+constexpr uint64_t kDefaultSamplingInterval = 32 * 1024;
+constexpr int kDefaultSamplingStackDepth = 128;
+
+// The profile has the format of the DevTools protocol's SamplingHeapProfile,
+// so that it can be saved as a .heapprofile file and loaded in DevTools.
+constexpr std::string_view kCallFrameKeys[] = {
+    "functionName", "scriptId", "url", "lineNumber", "columnNumber"};
+constexpr gin_helper::ObjectShape kCallFrameShape{kCallFrameKeys};
+constexpr std::string_view kProfileNodeKeys[] = {"callFrame", "selfSize", "id",
+                                                 "children"};
+constexpr gin_helper::ObjectShape kProfileNodeShape{kProfileNodeKeys};
+constexpr std::string_view kSampleKeys[] = {"size", "nodeId", "ordinal"};
+constexpr gin_helper::ObjectShape kSampleShape{kSampleKeys};
+
+ElectronBindings::PartitionsDumper g_blink_partitions_dumper = nullptr;
+
+// Keeps the totals of each partition it is handed, the per-bucket stats
+// are not needed.
+class PartitionTotalsDumper : public partition_alloc::PartitionStatsDumper {
+ public:
+  struct Totals {
+    std::string name;
+    size_t committed;
+    size_t allocated;
+    size_t resident;
+    size_t active;
+    size_t decommittable;
+    size_t discardable;
+  };
+
+  // partition_alloc::PartitionStatsDumper:
+  void PartitionDumpTotals(
+      const char* partition_name,
+      const partition_alloc::PartitionMemoryStats* stats) override {
+    totals_.push_back({partition_name, stats->total_committed_bytes,
+                       stats->total_allocated_bytes,
+                       stats->total_resident_bytes, stats->total_active_bytes,
+                       stats->total_decommittable_bytes,
+                       stats->total_discardable_bytes});
+  }
+  void PartitionsDumpBucketStats(
+      const char* partition_name,
+      const partition_alloc::PartitionBucketMemoryStats* stats) override {}
+
+  const std::vector<Totals>& totals() const { return totals_; }
+
+ private:
+  std::vector<Totals> totals_;
+};
+
+// The share of committed memory that holds no allocation.
+double Fragmentation(size_t committed, size_t allocated) {
+  if (committed == 0 || allocated >= committed)
+    return 0;
+  return 1.0 - static_cast<double>(allocated) / committed;
+}
+
+// Returns the converted |node| without its children, |children| is the
+// array they must be added to.
+v8::Local<v8::Object> CreateProfileNode(
+    v8::Isolate* isolate,
+    const v8::AllocationProfile::Node* node,
+    v8::Local<v8::Array>* children) {
+  gin_helper::ShapedObject call_frame(isolate, kCallFrameShape);
+  call_frame.Set("functionName", node->name);
+  call_frame.Set("scriptId", base::NumberToString(node->script_id));
+  call_frame.Set("url", node->script_name);
+  // V8 counts lines and columns from 1, DevTools from 0.
+  call_frame.Set("lineNumber", node->line_number - 1);
+  call_frame.Set("columnNumber", node->column_number - 1);
+
+  uint64_t self_size = 0;
+  for (const auto& allocation : node->allocations)
+    self_size += uint64_t{allocation.size} * allocation.count;
+
+  *children =
+      v8::Array::New(isolate, static_cast<int>(node->children.size()));
+  gin_helper::ShapedObject profile_node(isolate, kProfileNodeShape);
+  profile_node.Set("callFrame", call_frame);
+  profile_node.Set("selfSize", static_cast<double>(self_size));
+  profile_node.Set("id", node->node_id);
+  profile_node.Set("children", *children);
+  return profile_node.GetHandle();
+}
+
+}  // namespace
+
 ElectronBindings::ElectronBindings(uv_loop_t* loop) {
   uv_async_init(loop, call_next_tick_async_.get(), OnCallNextTick);
   call_next_tick_async_.get()->data = this;
@@ -48,6 +152,13 @@ void ElectronBindings::BindProcess(v8::Isolate* isolate,
   process->SetMethod("getCreationTime", &GetCreationTime);
   process->SetMethod("getHeapStatistics", &GetHeapStatistics);
   process->SetMethod("getBlinkMemoryInfo", &GetBlinkMemoryInfo);
+  process->SetMethod("getNativeObjectStats", &GetNativeObjectStats);
+  process->SetMethod("getAllocatorStats",
+                     base::BindRepeating(&ElectronBindings::GetAllocatorStats,
+                                         base::Unretained(metrics)));
+  process->SetMethod("startSamplingHeapProfiler", &StartSamplingHeapProfiler);
+  process->SetMethod("stopSamplingHeapProfiler", &StopSamplingHeapProfiler);
+  process->SetMethod("getSamplingHeapProfile", &GetSamplingHeapProfile);
   if (electron::IsBrowserProcess()) {
     process->SetMethod("getProcessMemoryInfo", &GetProcessMemoryInfo);
   }
@@ -226,6 +337,78 @@ v8::Local<v8::Value> ElectronBindings::GetBlinkMemoryInfo(
   return dict.GetHandle();
 }
 
+// static
+v8::Local<v8::Value> ElectronBindings::GetNativeObjectStats(
+    v8::Isolate* isolate) {
+  if (!gin_helper::LiveObjectTracker::IsEnabled())
+    return v8::Null(isolate);
+
+  auto result = gin_helper::Dictionary::CreateEmpty(isolate);
+  for (const auto& [type_name, stats] :
+       gin_helper::LiveObjectTracker::GetStats()) {
+    auto sites = gin_helper::Dictionary::CreateEmpty(isolate);
+    for (const auto& [site, count] : stats.allocation_sites)
+      sites.Set(site, static_cast<double>(count));
+
+    auto type_stats = gin_helper::Dictionary::CreateEmpty(isolate);
+    type_stats.Set("count", static_cast<double>(stats.count));
+    type_stats.Set("nativeSize", static_cast<double>(stats.native_size >> 10));
+    type_stats.Set("allocationSites", sites.GetHandle());
+    result.Set(type_name, type_stats.GetHandle());
+  }
+  return result.GetHandle();
+}
+
+// static
+void ElectronBindings::SetBlinkPartitionsDumper(PartitionsDumper dumper) {
+  g_blink_partitions_dumper = dumper;
+}
+
+// static
+v8::Local<v8::Value> ElectronBindings::GetAllocatorStats(
+    base::ProcessMetrics* metrics,
+    v8::Isolate* isolate) {
+  PartitionTotalsDumper dumper;
+#if BUILDFLAG(USE_PARTITION_ALLOC_AS_MALLOC)
+  allocator_shim::internal::PartitionAllocMalloc::Allocator()->DumpStats(
+      "malloc", true /* is_light_dump */, &dumper);
+  if (auto* original =
+          allocator_shim::internal::PartitionAllocMalloc::OriginalAllocator()) {
+    original->DumpStats("malloc/original", true /* is_light_dump */, &dumper);
+  }
+#endif
+  // Blink's partitions are only set up in renderers.
+  if (g_blink_partitions_dumper)
+    g_blink_partitions_dumper(&dumper);
+
+  size_t total_committed = 0;
+  size_t total_allocated = 0;
+  auto partitions = gin_helper::Dictionary::CreateEmpty(isolate);
+  for (const auto& totals : dumper.totals()) {
+    auto partition = gin_helper::Dictionary::CreateEmpty(isolate);
+    partition.Set("committed", static_cast<double>(totals.committed >> 10));
+    partition.Set("allocated", static_cast<double>(totals.allocated >> 10));
+    partition.Set("resident", static_cast<double>(totals.resident >> 10));
+    partition.Set("active", static_cast<double>(totals.active >> 10));
+    partition.Set("decommittable",
+                  static_cast<double>(totals.decommittable >> 10));
+    partition.Set("discardable", static_cast<double>(totals.discardable >> 10));
+    partition.Set("fragmentation",
+                  Fragmentation(totals.committed, totals.allocated));
+    partitions.Set(totals.name, partition);
+    total_committed += totals.committed;
+    total_allocated += totals.allocated;
+  }
+
+  auto dict = gin_helper::Dictionary::CreateEmpty(isolate);
+  dict.Set("mallocUsage", static_cast<double>(metrics->GetMallocUsage() >> 10));
+  dict.Set("committed", static_cast<double>(total_committed >> 10));
+  dict.Set("allocated", static_cast<double>(total_allocated >> 10));
+  dict.Set("fragmentation", Fragmentation(total_committed, total_allocated));
+  dict.Set("partitions", partitions);
+  return dict.GetHandle();
+}
+
 // static
 void ElectronBindings::DidReceiveMemoryDump(
     v8::Global<v8::Context> context,
@@ -299,4 +482,96 @@ bool ElectronBindings::TakeHeapSnapshot(v8::Isolate* isolate,
   return electron::TakeHeapSnapshot(isolate, &file);
 }
 
+// static
+bool ElectronBindings::StartSamplingHeapProfiler(gin_helper::Arguments* args) {
+  double sampling_interval = kDefaultSamplingInterval;
+  int stack_depth = kDefaultSamplingStackDepth;
+  bool include_major_gc = false;
+  bool include_minor_gc = false;
+
+  gin_helper::Dictionary options;
+  if (args->GetNext(&options)) {
+    options.Get("samplingInterval", &sampling_interval);
+    options.Get("stackDepth", &stack_depth);
+    options.Get("includeObjectsCollectedByMajorGC", &include_major_gc);
+    options.Get("includeObjectsCollectedByMinorGC", &include_minor_gc);
+  }
+
+  if (!(sampling_interval >= 1) ||
+      sampling_interval != static_cast<uint64_t>(sampling_interval)) {
+    args->ThrowTypeError("samplingInterval must be a positive integer");
+    return false;
+  }
+  if (stack_depth < 1) {
+    args->ThrowTypeError("stackDepth must be a positive integer");
+    return false;
+  }
+
+  int flags = v8::HeapProfiler::kSamplingNoFlags;
+  if (include_major_gc)
+    flags |= v8::HeapProfiler::kSamplingIncludeObjectsCollectedByMajorGC;
+  if (include_minor_gc)
+    flags |= v8::HeapProfiler::kSamplingIncludeObjectsCollectedByMinorGC;
+
+  // Fails when the profiler is already running.
+  return args->isolate()->GetHeapProfiler()->StartSamplingHeapProfiler(
+      static_cast<uint64_t>(sampling_interval), stack_depth,
+      static_cast<v8::HeapProfiler::SamplingFlags>(flags));
+}
+
+// static
+void ElectronBindings::StopSamplingHeapProfiler(v8::Isolate* isolate) {
+  isolate->GetHeapProfiler()->StopSamplingHeapProfiler();
+}
+
+// static
+v8::Local<v8::Value> ElectronBindings::GetSamplingHeapProfile(
+    v8::Isolate* isolate) {
+  std::unique_ptr<v8::AllocationProfile> profile(
+      isolate->GetHeapProfiler()->GetAllocationProfile());
+  // The profiler isn't running.
+  if (!profile)
+    return v8::Null(isolate);
+
+  v8::Local<v8::Context> context = isolate->GetCurrentContext();
+  v8::Local<v8::Array> children;
+  v8::Local<v8::Object> head =
+      CreateProfileNode(isolate, profile->GetRootNode(), &children);
+
+  // The tree is as deep as the sampled stacks, walk it without recursion.
+  std::vector<std::pair<v8::AllocationProfile::Node*, v8::Local<v8::Array>>>
+      pending = {{profile->GetRootNode(), children}};
+  while (!pending.empty()) {
+    auto [node, node_children] = pending.back();
+    pending.pop_back();
+    for (size_t i = 0; i < node->children.size(); ++i) {
+      v8::Local<v8::Array> child_children;
+      node_children
+          ->Set(context, static_cast<uint32_t>(i),
+                CreateProfileNode(isolate, node->children[i], &child_children))
+          .Check();
+      pending.emplace_back(node->children[i], child_children);
+    }
+  }
+
+  const auto& samples = profile->GetSamples();
+  v8::Local<v8::Array> samples_array =
+      v8::Array::New(isolate, static_cast<int>(samples.size()));
+  for (size_t i = 0; i < samples.size(); ++i) {
+    gin_helper::ShapedObject sample(isolate, kSampleShape);
+    sample.Set("size",
+               static_cast<double>(uint64_t{samples[i].size} *
+                                   samples[i].count));
+    sample.Set("nodeId", samples[i].node_id);
+    sample.Set("ordinal", static_cast<double>(samples[i].sample_id));
+    samples_array->Set(context, static_cast<uint32_t>(i), sample.GetHandle())
+        .Check();
+  }
+
+  auto dict = gin_helper::Dictionary::CreateEmpty(isolate);
+  dict.Set("head", head);
+  dict.Set("samples", samples_array);
+  return dict.GetHandle();
+}
+
 }  // namespace electron
@@ -28,6 +28,10 @@ namespace node {
 class Environment;
 }
 
+namespace partition_alloc {
+class PartitionStatsDumper;
+}
+
 namespace electron {
 
 class ElectronBindings {
@@ -52,6 +56,11 @@ class ElectronBindings {
 
   static void Crash();
 
+  // Blink's partitions can only be reached from renderer code, so renderers
+  // register how they are dumped for process.getAllocatorStats().
+  using PartitionsDumper = void (*)(partition_alloc::PartitionStatsDumper*);
+  static void SetBlinkPartitionsDumper(PartitionsDumper dumper);
+
   static void DidReceiveMemoryDump(
       v8::Global<v8::Context> context,
       gin_helper::Promise<gin_helper::Dictionary> promise,
@@ -67,10 +76,16 @@ class ElectronBindings {
                                                   gin_helper::Arguments* args);
   static v8::Local<v8::Promise> GetProcessMemoryInfo(v8::Isolate* isolate);
   static v8::Local<v8::Value> GetBlinkMemoryInfo(v8::Isolate* isolate);
+  static v8::Local<v8::Value> GetNativeObjectStats(v8::Isolate* isolate);
+  static v8::Local<v8::Value> GetAllocatorStats(base::ProcessMetrics* metrics,
+                                                v8::Isolate* isolate);
   static v8::Local<v8::Value> GetCPUUsage(base::ProcessMetrics* metrics,
                                           v8::Isolate* isolate);
   static bool TakeHeapSnapshot(v8::Isolate* isolate,
                                const base::FilePath& file_path);
+  static bool StartSamplingHeapProfiler(gin_helper::Arguments* args);
+  static void StopSamplingHeapProfiler(v8::Isolate* isolate);
+  static v8::Local<v8::Value> GetSamplingHeapProfile(v8::Isolate* isolate);
 
   void ActivateUVLoop(v8::Isolate* isolate);
 
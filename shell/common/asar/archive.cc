@@ -4,6 +4,7 @@
 
 #include "shell/common/asar/archive.h"
 
+#include <algorithm>
 #include <string>
 #include <string_view>
 #include <utility>
@@ -11,16 +12,21 @@
 
 #include "base/check.h"
 #include "base/containers/span.h"
+#include "base/environment.h"
 #include "base/files/file.h"
 #include "base/files/file_util.h"
+#include "base/files/important_file_writer.h"
 #include "base/json/json_reader.h"
 #include "base/logging.h"
 #include "base/pickle.h"
+#include "base/strings/string_split.h"
 #include "base/values.h"
+#include "crypto/sha2.h"
 #include "electron/fuses.h"
 #include "shell/common/asar/asar_util.h"
 #include "shell/common/asar/scoped_temporary_file.h"
 #include "shell/common/thread_restrictions.h"
+#include "third_party/brotli/include/brotli/decode.h"
 
 #if BUILDFLAG(IS_WIN)
 #include <io.h>
@@ -36,55 +42,56 @@ const char kSeparators[] = "\\/";
 const char kSeparators[] = "/";
 #endif
 
-const base::Value::Dict* GetNodeFromPath(std::string path,
-                                         const base::Value::Dict& root);
-
-// Gets the "files" from "dir".
-const base::Value::Dict* GetFilesNode(const base::Value::Dict& root,
-                                      const base::Value::Dict& dir) {
-  // Test for symbol linked directory.
-  const std::string* link = dir.FindString("link");
-  if (link != nullptr) {
-    const base::Value::Dict* linked_node = GetNodeFromPath(*link, root);
-    if (!linked_node)
-      return nullptr;
-    return linked_node->FindDict("files");
-  }
+// Whether archives should be memory mapped so packed files can be read
+// without a syscall and a copy per read.
+bool ShouldMapArchives() {
+  static const bool should_map =
+      base::Environment::Create()->HasVar("ELECTRON_ASAR_MMAP");
+  return should_map;
+}
 
-  return dir.FindDict("files");
+// Whether the index of archives should be written to a sidecar file next to
+// them, so later processes can load it instead of parsing the JSON header.
+bool ShouldWriteIndexCache() {
+  static const bool should_write =
+      base::Environment::Create()->HasVar("ELECTRON_ASAR_INDEX_CACHE");
+  return should_write;
 }
 
-// Gets sub-file "name" from "dir".
-const base::Value::Dict* GetChildNode(const base::Value::Dict& root,
-                                      const std::string& name,
-                                      const base::Value::Dict& dir) {
-  if (name.empty())
-    return &root;
+// Bump whenever the layout written by Archive::WriteIndexCache changes.
+constexpr uint32_t kIndexCacheVersion = 3;
 
-  const base::Value::Dict* files = GetFilesNode(root, dir);
-  return files ? files->FindDict(name) : nullptr;
-}
+// Smallest number of bytes an entry takes up in the index cache: two empty
+// strings, an int, five bools (which base::Pickle stores as ints), two
+// uint32s and a uint64.
+constexpr size_t kMinIndexCacheEntrySize = 2 * 4 + 4 + 5 * 4 + 2 * 4 + 8;
 
-// Gets the node of "path" from "root".
-const base::Value::Dict* GetNodeFromPath(std::string path,
-                                         const base::Value::Dict& root) {
-  if (path.empty())
-    return &root;
+// Upper bound on the number of links followed while resolving a path, so a
+// malformed header with a link cycle can't recurse forever.
+constexpr int kMaxLinkDepth = 32;
 
-  const base::Value::Dict* dir = &root;
-  for (size_t delimiter_position = path.find_first_of(kSeparators);
-       delimiter_position != std::string::npos;
-       delimiter_position = path.find_first_of(kSeparators)) {
-    const base::Value::Dict* child =
-        GetChildNode(root, path.substr(0, delimiter_position), *dir);
-    if (!child)
-      return nullptr;
+// Number of decompressed blocks of compressed files kept per archive.
+constexpr size_t kDecompressedBlockCacheSize = 16;
 
-    dir = child;
-    path.erase(0, delimiter_position + 1);
-  }
+// Checks that |compression| describes a file of |size| bytes and fills in
+// the offset of each of its blocks.
+bool InitCompressionInfo(uint32_t size, Archive::CompressionInfo* compression) {
+  if (compression->block_size == 0)
+    return false;
+  uint64_t block_count =
+      (static_cast<uint64_t>(size) + compression->block_size - 1) /
+      compression->block_size;
+  if (compression->blocks.size() != block_count)
+    return false;
 
-  return GetChildNode(root, path, *dir);
+  compression->block_offsets.clear();
+  compression->block_offsets.reserve(compression->blocks.size());
+  uint64_t block_offset = 0;
+  for (uint32_t block : compression->blocks) {
+    compression->block_offsets.push_back(block_offset);
+    block_offset += block;
+  }
+  return true;
 }
 
 bool FillFileInfoWithNode(Archive::FileInfo* info,
@@ -116,7 +123,48 @@ bool FillFileInfoWithNode(Archive::FileInfo* info,
     info->executable = *executable;
   }
 
+  // A file compressed in a way that isn't understood can't be read at all.
+  if (const base::Value::Dict* compression = node->FindDict("compression")) {
+    const std::string* algorithm = compression->FindString("algorithm");
+    std::optional<int> block_size = compression->FindInt("blockSize");
+    const base::Value::List* blocks = compression->FindList("blocks");
+    if (!algorithm || *algorithm != "brotli" || !block_size ||
+        *block_size <= 0 || !blocks) {
+      return false;
+    }
+
+    Archive::CompressionInfo compression_info;
+    compression_info.block_size = static_cast<uint32_t>(*block_size);
+    compression_info.blocks.reserve(blocks->size());
+    for (const base::Value& value : *blocks) {
+      std::optional<int> block = value.GetIfInt();
+      if (!block || *block < 0)
+        return false;
+      compression_info.blocks.push_back(static_cast<uint32_t>(*block));
+    }
+    if (!InitCompressionInfo(info->size, &compression_info))
+      return false;
+    info->compression = std::move(compression_info);
+  }
+
+  // "codeCache" has the same shape as a file node and points at a V8 code
+  // cache that the build step stored alongside the file's contents.
+  if (const base::Value::Dict* code_cache = node->FindDict("codeCache")) {
+    Archive::FileInfo cache_info;
+    if (FillFileInfoWithNode(&cache_info, header_size, load_integrity,
+                             code_cache) &&
+        !cache_info.unpacked) {
+      Archive::CodeCacheInfo code_cache_info;
+      code_cache_info.size = cache_info.size;
+      code_cache_info.offset = cache_info.offset;
+      code_cache_info.integrity = std::move(cache_info.integrity);
+      info->code_cache = std::move(code_cache_info);
+    }
+  }
+
 #if BUILDFLAG(IS_MAC)
+  // A missing or malformed integrity payload is reported when the file is
+  // accessed, see Archive::FillFileInfo.
   if (load_integrity &&
       electron::fuses::IsEmbeddedAsarIntegrityValidationEnabled()) {
     if (const base::Value::Dict* integrity = node->FindDict("integrity")) {
@@ -134,8 +182,9 @@ bool FillFileInfoWithNode(Archive::FileInfo* info,
           if (const std::string* block = value.GetIfString()) {
             integrity_payload.blocks.push_back(*block);
           } else {
-            LOG(FATAL)
+            LOG(ERROR)
                 << "Invalid block integrity value for file in ASAR archive";
+            return true;
           }
         }
         if (*algorithm == "SHA256") {
@@ -144,10 +193,6 @@ bool FillFileInfoWithNode(Archive::FileInfo* info,
         }
       }
     }
-
-    if (!info->integrity.has_value()) {
-      LOG(FATAL) << "Failed to read integrity for file in ASAR archive";
-    }
   }
 #endif
 
@@ -161,12 +206,32 @@ IntegrityPayload::IntegrityPayload()
 IntegrityPayload::~IntegrityPayload() = default;
 IntegrityPayload::IntegrityPayload(const IntegrityPayload& other) = default;
 
+Archive::CodeCacheInfo::CodeCacheInfo() = default;
+Archive::CodeCacheInfo::CodeCacheInfo(const CodeCacheInfo& other) = default;
+Archive::CodeCacheInfo::~CodeCacheInfo() = default;
+
+Archive::CompressionInfo::CompressionInfo() = default;
+Archive::CompressionInfo::CompressionInfo(const CompressionInfo& other) =
+    default;
+Archive::CompressionInfo::~CompressionInfo() = default;
+
 Archive::FileInfo::FileInfo()
     : unpacked(false), executable(false), size(0), offset(0) {}
+Archive::FileInfo::FileInfo(const FileInfo& other) = default;
+Archive::FileInfo& Archive::FileInfo::operator=(const FileInfo& other) =
+    default;
 Archive::FileInfo::~FileInfo() = default;
 
+Archive::Entry::Entry() = default;
+Archive::Entry::~Entry() = default;
+Archive::Entry::Entry(Entry&&) = default;
+Archive::Entry& Archive::Entry::operator=(Entry&&) = default;
+
 Archive::Archive(const base::FilePath& path)
-    : initialized_(false), path_(path), file_(base::File::FILE_OK) {
+    : initialized_(false),
+      path_(path),
+      file_(base::File::FILE_OK),
+      block_cache_(kDecompressedBlockCacheSize) {
   electron::ScopedAllowBlockingForElectron allow_blocking;
   file_.Initialize(path_, base::File::FLAG_OPEN | base::File::FLAG_READ);
 #if BUILDFLAG(IS_WIN)
@@ -263,17 +328,218 @@ bool Archive::Init() {
   }
 #endif
 
+  header_size_ = 8 + size;
+  if (!LoadIndex(header))
+    return false;
+
+  if (ShouldMapArchives()) {
+    electron::ScopedAllowBlockingForElectron allow_blocking;
+    // Failing to map is not fatal, reads fall back to the fd.
+    if (!mapped_file_.Initialize(file_.Duplicate()))
+      LOG(WARNING) << "Failed to map " << path_.value();
+  }
+
+  return true;
+}
+
+bool Archive::LoadIndex(const std::string& header) {
+  // The sidecar is not covered by the integrity of the header, so it is never
+  // trusted for archives whose header has been validated.
+  const bool use_index_cache = !header_validated_;
+  const base::FilePath cache_path =
+      path_.AddExtension(FILE_PATH_LITERAL("index"));
+
+  base::MemoryMappedFile cache;
+  if (use_index_cache) {
+    electron::ScopedAllowBlockingForElectron allow_blocking;
+    base::File cache_file(cache_path,
+                          base::File::FLAG_OPEN | base::File::FLAG_READ);
+    if (cache_file.IsValid())
+      cache.Initialize(std::move(cache_file));
+  }
+
+  const bool write_cache = use_index_cache && ShouldWriteIndexCache();
+  std::string header_hash;
+  if (cache.IsValid() || write_cache)
+    header_hash = crypto::SHA256HashString(header);
+
+  if (cache.IsValid()) {
+    if (ReadIndexCache(cache.bytes(), header_hash))
+      return true;
+    entries_.clear();
+  }
+
   std::optional<base::Value> value = base::JSONReader::Read(header);
   if (!value || !value->is_dict()) {
     LOG(ERROR) << "Failed to parse header";
     return false;
   }
 
-  header_size_ = 8 + size;
-  header_ = std::move(value->GetDict());
+  // The parsed tree is only needed to build the index, drop it afterwards.
+  IndexNode(value->GetDict(), std::string());
+
+  if (write_cache)
+    WriteIndexCache(cache_path, header_hash);
   return true;
 }
 
+bool Archive::ReadIndexCache(base::span<const uint8_t> data,
+                             const std::string& header_hash) {
+  base::Pickle pickle = base::Pickle::WithUnownedBuffer(data);
+  base::PickleIterator iter(pickle);
+
+  uint32_t version;
+  std::string cached_header_hash;
+  uint64_t count;
+  if (!iter.ReadUInt32(&version) || version != kIndexCacheVersion ||
+      !iter.ReadString(&cached_header_hash) ||
+      cached_header_hash != header_hash || !iter.ReadUInt64(&count)) {
+    return false;
+  }
+
+  // Don't trust the counts in the cache for allocations, a cache that claims
+  // more entries or children than it can hold is corrupt.
+  if (count > pickle.payload_size() / kMinIndexCacheEntrySize)
+    return false;
+  entries_.reserve(count);
+  for (uint64_t i = 0; i < count; ++i) {
+    std::string path;
+    int type;
+    uint32_t children_count;
+    Entry entry;
+    if (!iter.ReadString(&path) || !iter.ReadInt(&type) ||
+        !iter.ReadBool(&entry.valid) || !iter.ReadBool(&entry.info.unpacked) ||
+        !iter.ReadBool(&entry.info.executable) ||
+        !iter.ReadUInt32(&entry.info.size) ||
+        !iter.ReadUInt64(&entry.info.offset) || !iter.ReadString(&entry.link) ||
+        !iter.ReadUInt32(&children_count)) {
+      return false;
+    }
+
+    bool has_code_cache;
+    if (!iter.ReadBool(&has_code_cache))
+      return false;
+    if (has_code_cache) {
+      CodeCacheInfo code_cache;
+      if (!iter.ReadUInt32(&code_cache.size) ||
+          !iter.ReadUInt64(&code_cache.offset)) {
+        return false;
+      }
+      entry.info.code_cache = std::move(code_cache);
+    }
+
+    bool has_compression;
+    if (!iter.ReadBool(&has_compression))
+      return false;
+    if (has_compression) {
+      CompressionInfo compression;
+      uint32_t block_count;
+      if (!iter.ReadUInt32(&compression.block_size) ||
+          !iter.ReadUInt32(&block_count) ||
+          block_count > pickle.payload_size() / sizeof(uint32_t)) {
+        return false;
+      }
+      compression.blocks.resize(block_count);
+      for (uint32_t& block : compression.blocks) {
+        if (!iter.ReadUInt32(&block))
+          return false;
+      }
+      if (!InitCompressionInfo(entry.info.size, &compression))
+        return false;
+      entry.info.compression = std::move(compression);
+    }
+
+    switch (static_cast<FileType>(type)) {
+      case FileType::kFile:
+      case FileType::kDirectory:
+      case FileType::kLink:
+        entry.type = static_cast<FileType>(type);
+        break;
+      default:
+        return false;
+    }
+
+    if (children_count > count ||
+        children_count > pickle.payload_size() / sizeof(uint32_t)) {
+      return false;
+    }
+    entry.children.resize(children_count);
+    for (std::string& child : entry.children) {
+      if (!iter.ReadString(&child))
+        return false;
+    }
+    entries_.emplace(std::move(path), std::move(entry));
+  }
+
+  // Every lookup starts from the root.
+  return entries_.contains(std::string());
+}
+
+void Archive::WriteIndexCache(const base::FilePath& cache_path,
+                              const std::string& header_hash) const {
+  base::Pickle pickle;
+  pickle.WriteUInt32(kIndexCacheVersion);
+  pickle.WriteString(header_hash);
+  pickle.WriteUInt64(entries_.size());
+  for (const auto& [path, entry] : entries_) {
+    // Integrity is only loaded for validated headers, which are never cached.
+    DCHECK(!entry.info.integrity.has_value());
+    pickle.WriteString(path);
+    pickle.WriteInt(static_cast<int>(entry.type));
+    pickle.WriteBool(entry.valid);
+    pickle.WriteBool(entry.info.unpacked);
+    pickle.WriteBool(entry.info.executable);
+    pickle.WriteUInt32(entry.info.size);
+    pickle.WriteUInt64(entry.info.offset);
+    pickle.WriteString(entry.link);
+    pickle.WriteUInt32(static_cast<uint32_t>(entry.children.size()));
+    pickle.WriteBool(entry.info.code_cache.has_value());
+    if (entry.info.code_cache) {
+      pickle.WriteUInt32(entry.info.code_cache->size);
+      pickle.WriteUInt64(entry.info.code_cache->offset);
+    }
+    pickle.WriteBool(entry.info.compression.has_value());
+    if (entry.info.compression) {
+      pickle.WriteUInt32(entry.info.compression->block_size);
+      pickle.WriteUInt32(
+          static_cast<uint32_t>(entry.info.compression->blocks.size()));
+      for (uint32_t block : entry.info.compression->blocks)
+        pickle.WriteUInt32(block);
+    }
+    for (const std::string& child : entry.children)
+      pickle.WriteString(child);
+  }
+
+  electron::ScopedAllowBlockingForElectron allow_blocking;
+  if (!base::ImportantFileWriter::WriteFileAtomically(
+          cache_path,
+          std::string_view(reinterpret_cast<const char*>(pickle.data()),
+                           pickle.size()))) {
+    LOG(WARNING) << "Failed to write asar index cache " << cache_path.value();
+  }
+}
+
+void Archive::IndexNode(const base::Value::Dict& node,
+                        const std::string& path) {
+  Entry entry;
+  if (const std::string* link = node.FindString("link")) {
+    entry.type = FileType::kLink;
+    entry.link = *link;
+  } else if (const base::Value::Dict* files = node.FindDict("files")) {
+    entry.type = FileType::kDirectory;
+    entry.children.reserve(files->size());
+    for (const auto [name, child] : *files) {
+      entry.children.push_back(name);
+      if (child.is_dict())
+        IndexNode(child.GetDict(), path.empty() ? name : path + '/' + name);
+    }
+  } else {
+    entry.valid = FillFileInfoWithNode(&entry.info, header_size_,
+                                       header_validated_, &node);
+  }
+  entries_.insert_or_assign(path, std::move(entry));
+}
+
 #if !BUILDFLAG(IS_MAC) && !BUILDFLAG(IS_WIN)
 std::optional<IntegrityPayload> Archive::HeaderIntegrity() const {
   return std::nullopt;
@@ -284,76 +550,138 @@ std::optional<base::FilePath> Archive::RelativePath() const {
 }
 #endif
 
-bool Archive::GetFileInfo(const base::FilePath& path, FileInfo* info) const {
-  if (!header_)
-    return false;
+std::optional<std::string> Archive::ResolvePath(std::string_view path,
+                                                int depth) const {
+  if (depth > kMaxLinkDepth)
+    return std::nullopt;
+
+  std::string resolved;
+  for (std::string_view segment : base::SplitStringPiece(
+           path, kSeparators, base::KEEP_WHITESPACE, base::SPLIT_WANT_ALL)) {
+    // An empty segment refers back to the root.
+    if (segment.empty()) {
+      resolved.clear();
+      continue;
+    }
 
-  const base::Value::Dict* node =
-      GetNodeFromPath(path.AsUTF8Unsafe(), *header_);
-  if (!node)
-    return false;
+    const Entry* dir = &entries_.at(resolved);
+    if (dir->type == FileType::kLink) {
+      std::optional<std::string> target = ResolvePath(dir->link, depth + 1);
+      if (!target)
+        return std::nullopt;
+      resolved = std::move(*target);
+      dir = &entries_.at(resolved);
+    }
+    if (dir->type != FileType::kDirectory)
+      return std::nullopt;
+
+    if (!resolved.empty())
+      resolved.push_back('/');
+    resolved.append(segment);
+    if (!entries_.contains(resolved))
+      return std::nullopt;
+  }
+
+  return resolved;
+}
 
-  const std::string* link = node->FindString("link");
-  if (link)
-    return GetFileInfo(base::FilePath::FromUTF8Unsafe(*link), info);
+const Archive::Entry* Archive::GetEntry(const base::FilePath& path) const {
+  if (entries_.empty())
+    return nullptr;
 
-  return FillFileInfoWithNode(info, header_size_, header_validated_, node);
+  std::string key = path.AsUTF8Unsafe();
+#if BUILDFLAG(IS_WIN)
+  std::replace(key.begin(), key.end(), '\\', '/');
+#endif
+
+  // Fast path: |path| names an entry directly.
+  if (auto it = entries_.find(key); it != entries_.end())
+    return &it->second;
+
+  // Otherwise the path might go through a linked directory.
+  std::optional<std::string> resolved = ResolvePath(key, 0);
+  if (!resolved)
+    return nullptr;
+  return &entries_.at(*resolved);
 }
 
-bool Archive::Stat(const base::FilePath& path, Stats* stats) const {
-  if (!header_)
+bool Archive::FillFileInfo(const Entry& entry, FileInfo* info) const {
+  if (!entry.valid)
     return false;
 
-  const base::Value::Dict* node =
-      GetNodeFromPath(path.AsUTF8Unsafe(), *header_);
-  if (!node)
-    return false;
+  *info = entry.info;
 
-  if (node->Find("link")) {
-    stats->type = FileType::kLink;
-    return true;
+#if BUILDFLAG(IS_MAC)
+  if (!info->unpacked && header_validated_ &&
+      electron::fuses::IsEmbeddedAsarIntegrityValidationEnabled() &&
+      !info->integrity.has_value()) {
+    LOG(FATAL) << "Failed to read integrity for file in ASAR archive";
+  }
+  // A code cache is optional, so one without integrity is ignored instead.
+  if (info->code_cache && header_validated_ &&
+      electron::fuses::IsEmbeddedAsarIntegrityValidationEnabled() &&
+      !info->code_cache->integrity.has_value()) {
+    info->code_cache.reset();
   }
+#endif
+
+  return true;
+}
+
+bool Archive::GetFileInfo(const base::FilePath& path, FileInfo* info) const {
+  const Entry* entry = GetEntry(path);
+  if (!entry)
+    return false;
+
+  if (entry->type == FileType::kLink)
+    return GetFileInfo(base::FilePath::FromUTF8Unsafe(entry->link), info);
+
+  return FillFileInfo(*entry, info);
+}
 
-  if (node->Find("files")) {
-    stats->type = FileType::kDirectory;
+bool Archive::Stat(const base::FilePath& path, Stats* stats) const {
+  const Entry* entry = GetEntry(path);
+  if (!entry)
+    return false;
+
+  if (entry->type != FileType::kFile) {
+    stats->type = entry->type;
     return true;
   }
 
-  return FillFileInfoWithNode(stats, header_size_, header_validated_, node);
+  return FillFileInfo(*entry, stats);
 }
 
 bool Archive::Readdir(const base::FilePath& path,
                       std::vector<base::FilePath>* files) const {
-  if (!header_)
+  const Entry* entry = GetEntry(path);
+  if (!entry)
     return false;
 
-  const base::Value::Dict* node =
-      GetNodeFromPath(path.AsUTF8Unsafe(), *header_);
-  if (!node)
-    return false;
+  if (entry->type == FileType::kLink) {
+    std::optional<std::string> target = ResolvePath(entry->link, 0);
+    if (!target)
+      return false;
+    entry = &entries_.at(*target);
+  }
 
-  const base::Value::Dict* files_node = GetFilesNode(*header_, *node);
-  if (!files_node)
+  if (entry->type != FileType::kDirectory)
     return false;
 
-  for (const auto iter : *files_node)
-    files->push_back(base::FilePath::FromUTF8Unsafe(iter.first));
+  files->reserve(files->size() + entry->children.size());
+  for (const std::string& name : entry->children)
+    files->push_back(base::FilePath::FromUTF8Unsafe(name));
   return true;
 }
 
 bool Archive::Realpath(const base::FilePath& path,
                        base::FilePath* realpath) const {
-  if (!header_)
-    return false;
-
-  const base::Value::Dict* node =
-      GetNodeFromPath(path.AsUTF8Unsafe(), *header_);
-  if (!node)
+  const Entry* entry = GetEntry(path);
+  if (!entry)
     return false;
 
-  const std::string* link = node->FindString("link");
-  if (link) {
-    *realpath = base::FilePath::FromUTF8Unsafe(*link);
+  if (entry->type == FileType::kLink) {
+    *realpath = base::FilePath::FromUTF8Unsafe(entry->link);
     return true;
   }
 
@@ -362,7 +690,7 @@ bool Archive::Realpath(const base::FilePath& path,
 }
 
 bool Archive::CopyFileOut(const base::FilePath& path, base::FilePath* out) {
-  if (!header_)
+  if (entries_.empty())
     return false;
 
   base::AutoLock auto_lock(external_files_lock_);
@@ -384,9 +712,19 @@ bool Archive::CopyFileOut(const base::FilePath& path, base::FilePath* out) {
 
   auto temp_file = std::make_unique<ScopedTemporaryFile>();
   base::FilePath::StringType ext = path.Extension();
-  if (!temp_file->InitFromFile(&file_, ext, info.offset, info.size,
-                               info.integrity))
+  if (info.compression) {
+    std::vector<uint8_t> contents(info.size);
+    if (!ReadDecompressed(info, 0, contents) ||
+        !temp_file->InitFromData(contents, ext, info.integrity))
+      return false;
+  } else if (std::optional<base::span<const uint8_t>> contents =
+                 GetMappedContents(info)) {
+    if (!temp_file->InitFromData(*contents, ext, info.integrity))
+      return false;
+  } else if (!temp_file->InitFromFile(&file_, ext, info.offset, info.size,
+                                      info.integrity)) {
     return false;
+  }
 
 #if BUILDFLAG(IS_POSIX)
   if (info.executable) {
@@ -400,6 +738,134 @@ bool Archive::CopyFileOut(const base::FilePath& path, base::FilePath* out) {
   return true;
 }
 
+std::optional<base::span<const uint8_t>> Archive::GetMappedContents(
+    const FileInfo& info) const {
+  if (!mapped_file_.IsValid() || info.unpacked || info.compression)
+    return std::nullopt;
+
+  base::span<const uint8_t> bytes = mapped_file_.bytes();
+  if (info.offset > bytes.size() || info.size > bytes.size() - info.offset)
+    return std::nullopt;
+
+  return bytes.subspan(info.offset, info.size);
+}
+
+bool Archive::ReadDecompressed(const FileInfo& info,
+                               uint64_t position,
+                               base::span<uint8_t> buffer) {
+  if (!info.compression || info.unpacked || position > info.size ||
+      buffer.size() > info.size - position) {
+    return false;
+  }
+
+  const CompressionInfo& compression = *info.compression;
+  size_t index = position / compression.block_size;
+  while (!buffer.empty()) {
+    if (index >= compression.blocks.size())
+      return false;
+    uint64_t offset_in_block =
+        position - static_cast<uint64_t>(index) * compression.block_size;
+    size_t read_size = std::min<uint64_t>(
+        buffer.size(), compression.block_size - offset_in_block);
+    if (!CopyFromBlock(info, index,
+                       info.offset + compression.block_offsets[index],
+                       offset_in_block, buffer.first(read_size))) {
+      return false;
+    }
+    buffer = buffer.subspan(read_size);
+    position += read_size;
+    ++index;
+  }
+  return true;
+}
+
+bool Archive::CopyFromBlock(const FileInfo& info,
+                            size_t index,
+                            uint64_t block_offset,
+                            size_t offset_in_block,
+                            base::span<uint8_t> out) {
+  {
+    base::AutoLock auto_lock(block_cache_lock_);
+    auto it = block_cache_.Get(block_offset);
+    if (it != block_cache_.end()) {
+      const std::vector<uint8_t>& block = it->second;
+      if (offset_in_block > block.size() ||
+          out.size() > block.size() - offset_in_block)
+        return false;
+      std::copy_n(block.begin() + offset_in_block, out.size(), out.begin());
+      return true;
+    }
+  }
+
+  const CompressionInfo& compression = *info.compression;
+  std::vector<uint8_t> compressed(compression.blocks[index]);
+  if (mapped_file_.IsValid()) {
+    base::span<const uint8_t> bytes = mapped_file_.bytes();
+    if (block_offset > bytes.size() ||
+        compressed.size() > bytes.size() - block_offset)
+      return false;
+    base::span<const uint8_t> source =
+        bytes.subspan(block_offset, compressed.size());
+    std::copy(source.begin(), source.end(), compressed.begin());
+  } else {
+    electron::ScopedAllowBlockingForElectron allow_blocking;
+    if (!file_.ReadAndCheck(block_offset, compressed))
+      return false;
+  }
+
+  const uint64_t block_start =
+      static_cast<uint64_t>(index) * compression.block_size;
+  std::vector<uint8_t> block(
+      std::min<uint64_t>(compression.block_size, info.size - block_start));
+  size_t decoded_size = block.size();
+  if (BrotliDecoderDecompress(compressed.size(), compressed.data(),
+                              &decoded_size, block.data()) !=
+          BROTLI_DECODER_RESULT_SUCCESS ||
+      decoded_size != block.size()) {
+    LOG(ERROR) << "Failed to decompress block " << index << " of a file in "
+               << path_.value();
+    return false;
+  }
+
+  if (offset_in_block > block.size() ||
+      out.size() > block.size() - offset_in_block)
+    return false;
+  std::copy_n(block.begin() + offset_in_block, out.size(), out.begin());
+
+  base::AutoLock auto_lock(block_cache_lock_);
+  block_cache_.Put(block_offset, std::move(block));
+  return true;
+}
+
+std::optional<std::vector<uint8_t>> Archive::ReadCodeCache(
+    const FileInfo& info) {
+  if (!info.code_cache)
+    return std::nullopt;
+
+  const CodeCacheInfo& code_cache = *info.code_cache;
+  std::vector<uint8_t> data;
+  if (mapped_file_.IsValid()) {
+    base::span<const uint8_t> bytes = mapped_file_.bytes();
+    if (code_cache.offset > bytes.size() ||
+        code_cache.size > bytes.size() - code_cache.offset)
+      return std::nullopt;
+    base::span<const uint8_t> cache =
+        bytes.subspan(code_cache.offset, code_cache.size);
+    data.assign(cache.begin(), cache.end());
+  } else {
+    electron::ScopedAllowBlockingForElectron allow_blocking;
+    data.resize(code_cache.size);
+    if (!file_.ReadAndCheck(code_cache.offset, data))
+      return std::nullopt;
+  }
+
+  if (code_cache.integrity) {
+    ValidateIntegrityOrDie(reinterpret_cast<const char*>(data.data()),
+                           data.size(), *code_cache.integrity);
+  }
+  return data;
+}
+
 int Archive::GetUnsafeFD() const {
   return fd_;
 }
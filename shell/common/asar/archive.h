@@ -8,14 +8,19 @@
 #include <memory>
 #include <optional>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <vector>
 
 #include <uv.h>
 
+#include "base/containers/lru_cache.h"
+#include "base/containers/span.h"
 #include "base/files/file.h"
 #include "base/files/file_path.h"
+#include "base/files/memory_mapped_file.h"
 #include "base/synchronization/lock.h"
+#include "base/thread_annotations.h"
 #include "base/values.h"
 
 namespace asar {
@@ -41,14 +46,48 @@ struct IntegrityPayload {
 // information from it. It is thread-safe after |Init| has been called.
 class Archive {
  public:
+  // Where a V8 code cache for a file is stored in the archive. It is stored
+  // and validated like the contents of a packed file.
+  struct CodeCacheInfo {
+    CodeCacheInfo();
+    CodeCacheInfo(const CodeCacheInfo& other);
+    ~CodeCacheInfo();
+    uint32_t size = 0;
+    uint64_t offset = 0;
+    std::optional<IntegrityPayload> integrity;
+  };
+
+  // How a compressed file is stored in the archive. Its contents are split
+  // into blocks of |block_size| bytes, the last one possibly shorter, which
+  // are compressed independently with brotli and stored back to back at the
+  // file's offset. The size and integrity of the file describe its
+  // decompressed contents.
+  struct CompressionInfo {
+    CompressionInfo();
+    CompressionInfo(const CompressionInfo& other);
+    ~CompressionInfo();
+    uint32_t block_size = 0;
+    // Compressed size of each block.
+    std::vector<uint32_t> blocks;
+    // Offset of each block from the start of the file, derived from |blocks|
+    // when the info is parsed so reads don't have to sum them up.
+    std::vector<uint64_t> block_offsets;
+  };
+
   struct FileInfo {
     FileInfo();
+    FileInfo(const FileInfo& other);
+    FileInfo& operator=(const FileInfo& other);
     ~FileInfo();
     bool unpacked;
     bool executable;
     uint32_t size;
     uint64_t offset;
     std::optional<IntegrityPayload> integrity;
+    // Set when the archive was built with a code cache for this file.
+    std::optional<CodeCacheInfo> code_cache;
+    // Set when the file is stored compressed.
+    std::optional<CompressionInfo> compression;
   };
 
   enum class FileType {
@@ -91,6 +130,28 @@ class Archive {
   // For unpacked file, this method will return its real path.
   bool CopyFileOut(const base::FilePath& path, base::FilePath* out);
 
+  // Returns the contents of a packed file as a view into the memory mapping of
+  // the archive, or std::nullopt if the archive is not mapped or |info| does
+  // not describe a packed, uncompressed file. The view is valid as long as the
+  // Archive is.
+  // Callers are responsible for integrity validation of the returned data.
+  std::optional<base::span<const uint8_t>> GetMappedContents(
+      const FileInfo& info) const;
+
+  // Copies |buffer.size()| bytes of the decompressed contents of the
+  // compressed file described by |info|, starting at |position|, into
+  // |buffer|. Recently decompressed blocks are kept in a small cache shared by
+  // all readers of the archive. Returns false if the range is out of bounds or
+  // the data can't be read or decompressed. Callers are responsible for
+  // integrity validation of the returned data.
+  bool ReadDecompressed(const FileInfo& info,
+                        uint64_t position,
+                        base::span<uint8_t> buffer);
+
+  // Reads the code cache described by |info| and validates its integrity.
+  // Returns std::nullopt if the file has no code cache or it can't be read.
+  std::optional<std::vector<uint8_t>> ReadCodeCache(const FileInfo& info);
+
   // Returns the file's fd.
   // Using this fd will not validate the integrity of any files
   // you read out of the ASAR manually.  Callers are responsible
@@ -100,13 +161,71 @@ class Archive {
   base::FilePath path() const { return path_; }
 
  private:
+  // A node of the header, flattened. The JSON header is parsed into a table
+  // of entries keyed by their full "/"-separated path once in |Init|, so a
+  // lookup is a single hash probe instead of a walk down the tree.
+  struct Entry {
+    Entry();
+    ~Entry();
+    Entry(Entry&&);
+    Entry& operator=(Entry&&);
+
+    FileType type = FileType::kFile;
+    // Whether the size and offset of a file could be parsed.
+    bool valid = false;
+    FileInfo info;
+    // Target of a link, relative to the root of the archive.
+    std::string link;
+    // Names of the direct children of a directory, in header order.
+    std::vector<std::string> children;
+  };
+
+  using EntryMap = std::unordered_map<std::string, Entry>;
+
+  // Builds |entries_| from |header|, or from the index cached next to the
+  // archive when it matches |header|.
+  bool LoadIndex(const std::string& header);
+  bool ReadIndexCache(base::span<const uint8_t> data,
+                      const std::string& header_hash);
+  void WriteIndexCache(const base::FilePath& cache_path,
+                       const std::string& header_hash) const;
+  void IndexNode(const base::Value::Dict& node, const std::string& path);
+
+  // Returns the entry for |path|, links in the middle of |path| are followed
+  // but the last component is returned as is.
+  const Entry* GetEntry(const base::FilePath& path) const;
+
+  // Resolves |path| into the key of its entry in |entries_|.
+  std::optional<std::string> ResolvePath(std::string_view path,
+                                         int depth) const;
+
+  bool FillFileInfo(const Entry& entry, FileInfo* info) const;
+
+  // Copies |out.size()| bytes starting at |offset_in_block| of the block
+  // |index| of a compressed file, whose compressed data starts at
+  // |block_offset| in the archive, into |out|.
+  bool CopyFromBlock(const FileInfo& info,
+                     size_t index,
+                     uint64_t block_offset,
+                     size_t offset_in_block,
+                     base::span<uint8_t> out);
+
   bool initialized_;
   bool header_validated_ = false;
   const base::FilePath path_;
   base::File file_;
   int fd_ = -1;
   uint32_t header_size_ = 0;
-  std::optional<base::Value::Dict> header_;
+  EntryMap entries_;
+
+  // Mapping of the whole archive, only valid when ELECTRON_ASAR_MMAP is set.
+  base::MemoryMappedFile mapped_file_;
+
+  // Recently decompressed blocks of compressed files, keyed by the offset of
+  // their compressed data in the archive.
+  base::Lock block_cache_lock_;
+  base::HashingLRUCache<uint64_t, std::vector<uint8_t>> block_cache_
+      GUARDED_BY(block_cache_lock_);
 
   // Cached external temporary files.
   base::Lock external_files_lock_;
@@ -4,10 +4,14 @@
 
 #include "shell/common/asar/asar_util.h"
 
+#include <atomic>
 #include <map>
 #include <memory>
 #include <string>
+#include <utility>
 
+#include "base/containers/lru_cache.h"
+#include "base/containers/span.h"
 #include "base/files/file_path.h"
 #include "base/files/file_util.h"
 #include "base/logging.h"
@@ -30,20 +34,81 @@ typedef std::map<base::FilePath, std::shared_ptr<Archive>> ArchiveMap;
 
 const base::FilePath::CharType kAsarExtension[] = FILE_PATH_LITERAL(".asar");
 
-bool IsDirectoryCached(const base::FilePath& path) {
-  static base::NoDestructor<std::map<base::FilePath, bool>>
-      s_is_directory_cache;
-  static base::NoDestructor<base::Lock> lock;
+// Number of paths remembered by the process-wide directory cache.
+constexpr size_t kMaxDirectoryCacheSize = 1024;
+
+// Number of paths or archives each thread remembers in front of the
+// process-wide caches before starting over.
+constexpr size_t kMaxThreadCacheSize = 128;
+
+// Bumped whenever the archive cache is cleared, so threads know to drop the
+// archives they remember.
+std::atomic<uint32_t> g_archive_cache_generation{0};
+
+// Lookups are served from a per-thread cache first, so concurrent path
+// resolutions from worker threads and the IO thread only meet on the locks
+// of the process-wide caches when a thread sees a path for the first time.
+struct ThreadCache {
+  uint32_t archive_cache_generation = 0;
+  std::map<base::FilePath, bool> is_directory;
+  ArchiveMap archives;
+};
+
+ThreadCache& GetThreadCache() {
+  static base::NoDestructor<base::ThreadLocalOwnedPointer<ThreadCache>>
+      lazy_tls;
+  ThreadCache* cache = lazy_tls->Get();
+  if (!cache) {
+    auto new_cache = std::make_unique<ThreadCache>();
+    cache = new_cache.get();
+    lazy_tls->Set(std::move(new_cache));
+  }
 
-  base::AutoLock auto_lock(*lock);
-  auto& is_directory_cache = *s_is_directory_cache;
+  const uint32_t generation =
+      g_archive_cache_generation.load(std::memory_order_acquire);
+  if (cache->archive_cache_generation != generation) {
+    cache->archives.clear();
+    cache->archive_cache_generation = generation;
+  }
+  return *cache;
+}
+
+template <typename Map, typename Value>
+void InsertIntoThreadCache(Map& map,
+                           const base::FilePath& path,
+                           Value&& value) {
+  if (map.size() >= kMaxThreadCacheSize)
+    map.clear();
+  map.emplace(path, std::forward<Value>(value));
+}
 
-  auto it = is_directory_cache.find(path);
-  if (it != is_directory_cache.end()) {
+bool IsDirectoryCached(const base::FilePath& path) {
+  ThreadCache& thread_cache = GetThreadCache();
+  if (auto it = thread_cache.is_directory.find(path);
+      it != thread_cache.is_directory.end()) {
     return it->second;
   }
-  electron::ScopedAllowBlockingForElectron allow_blocking;
-  return is_directory_cache[path] = base::DirectoryExists(path);
+
+  static base::NoDestructor<base::LRUCache<base::FilePath, bool>>
+      s_is_directory_cache(kMaxDirectoryCacheSize);
+  static base::NoDestructor<base::Lock> lock;
+
+  bool is_directory;
+  {
+    base::AutoLock auto_lock(*lock);
+    auto& is_directory_cache = *s_is_directory_cache;
+    auto it = is_directory_cache.Get(path);
+    if (it != is_directory_cache.end()) {
+      is_directory = it->second;
+    } else {
+      electron::ScopedAllowBlockingForElectron allow_blocking;
+      is_directory = base::DirectoryExists(path);
+      is_directory_cache.Put(path, is_directory);
+    }
+  }
+
+  InsertIntoThreadCache(thread_cache.is_directory, path, is_directory);
+  return is_directory;
 }
 
 }  // namespace
@@ -59,23 +124,35 @@ base::Lock& GetArchiveCacheLock() {
 }
 
 std::shared_ptr<Archive> GetOrCreateAsarArchive(const base::FilePath& path) {
-  base::AutoLock auto_lock(GetArchiveCacheLock());
-  ArchiveMap& map = GetArchiveCache();
-
-  // if we have it, return it
-  const auto lower = map.lower_bound(path);
-  if (lower != std::end(map) && !map.key_comp()(path, lower->first))
-    return lower->second;
+  ThreadCache& thread_cache = GetThreadCache();
+  if (auto it = thread_cache.archives.find(path);
+      it != thread_cache.archives.end()) {
+    return it->second;
+  }
 
-  // if we can create it, return it
-  auto archive = std::make_shared<Archive>(path);
-  if (archive->Init()) {
-    map.try_emplace(lower, path, archive);
-    return archive;
+  std::shared_ptr<Archive> archive;
+  {
+    base::AutoLock auto_lock(GetArchiveCacheLock());
+    ArchiveMap& map = GetArchiveCache();
+
+    // if we have it, return it
+    const auto lower = map.lower_bound(path);
+    if (lower != std::end(map) && !map.key_comp()(path, lower->first)) {
+      archive = lower->second;
+    } else {
+      // if we can create it, return it
+      auto new_archive = std::make_shared<Archive>(path);
+      if (!new_archive->Init()) {
+        // didn't have it, couldn't create it
+        return nullptr;
+      }
+      map.try_emplace(lower, path, new_archive);
+      archive = std::move(new_archive);
+    }
   }
 
-  // didn't have it, couldn't create it
-  return nullptr;
+  InsertIntoThreadCache(thread_cache.archives, path, archive);
+  return archive;
 }
 
 void ClearArchives() {
@@ -83,6 +160,7 @@ void ClearArchives() {
   ArchiveMap& map = GetArchiveCache();
 
   map.clear();
+  g_archive_cache_generation.fetch_add(1, std::memory_order_release);
 }
 
 bool GetAsarArchivePath(const base::FilePath& full_path,
@@ -129,15 +207,27 @@ bool ReadFileToString(const base::FilePath& path, std::string* contents) {
     return base::ReadFileToString(real_path, contents);
   }
 
-  base::File src(asar_path, base::File::FLAG_OPEN | base::File::FLAG_READ);
-  if (!src.IsValid())
-    return false;
+  if (info.compression) {
+    contents->resize(info.size);
+    if (!archive->ReadDecompressed(info, 0,
+                                   base::as_writable_byte_span(*contents))) {
+      return false;
+    }
+  } else if (std::optional<base::span<const uint8_t>> mapped =
+                 archive->GetMappedContents(info)) {
+    contents->assign(reinterpret_cast<const char*>(mapped->data()),
+                     mapped->size());
+  } else {
+    base::File src(asar_path, base::File::FLAG_OPEN | base::File::FLAG_READ);
+    if (!src.IsValid())
+      return false;
 
-  contents->resize(info.size);
-  if (static_cast<int>(info.size) !=
-      src.Read(info.offset, const_cast<char*>(contents->data()),
-               contents->size())) {
-    return false;
+    contents->resize(info.size);
+    if (static_cast<int>(info.size) !=
+        src.Read(info.offset, const_cast<char*>(contents->data()),
+                 contents->size())) {
+      return false;
+    }
   }
 
   if (info.integrity.has_value()) {
@@ -59,25 +59,34 @@ bool ScopedTemporaryFile::InitFromFile(
   if (!src->IsValid())
     return false;
 
-  if (!Init(ext))
-    return false;
-
   electron::ScopedAllowBlockingForElectron allow_blocking;
   std::vector<char> buf(size);
   int len = src->Read(offset, buf.data(), buf.size());
   if (len != static_cast<int>(size))
     return false;
 
+  return InitFromData(base::as_byte_span(buf), ext, integrity);
+}
+
+bool ScopedTemporaryFile::InitFromData(
+    base::span<const uint8_t> data,
+    const base::FilePath::StringType& ext,
+    const std::optional<IntegrityPayload>& integrity) {
+  if (!Init(ext))
+    return false;
+
   if (integrity.has_value()) {
-    ValidateIntegrityOrDie(buf.data(), buf.size(), integrity.value());
+    ValidateIntegrityOrDie(reinterpret_cast<const char*>(data.data()),
+                           data.size(), integrity.value());
   }
 
+  electron::ScopedAllowBlockingForElectron allow_blocking;
   base::File dest(path_, base::File::FLAG_OPEN | base::File::FLAG_WRITE);
   if (!dest.IsValid())
     return false;
 
-  return dest.WriteAtCurrentPos(buf.data(), buf.size()) ==
-         static_cast<int>(size);
+  return dest.WriteAtCurrentPos(reinterpret_cast<const char*>(data.data()),
+                                data.size()) == static_cast<int>(data.size());
 }
 
 }  // namespace asar
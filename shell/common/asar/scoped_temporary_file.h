@@ -7,6 +7,7 @@
 
 #include <optional>
 
+#include "base/containers/span.h"
 #include "base/files/file_path.h"
 #include "shell/common/asar/archive.h"
 
@@ -37,6 +38,11 @@ class ScopedTemporaryFile {
                     uint64_t size,
                     const std::optional<IntegrityPayload>& integrity);
 
+  // Init an temporary file and fill it with |data|.
+  bool InitFromData(base::span<const uint8_t> data,
+                    const base::FilePath::StringType& ext,
+                    const std::optional<IntegrityPayload>& integrity);
+
   base::FilePath path() const { return path_; }
 
  private:
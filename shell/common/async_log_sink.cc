@@ -0,0 +1,258 @@
+// Copyright (c) 2024 Microsoft, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#include "shell/common/async_log_sink.h"
+
+#include <stdio.h>
+
+#include <atomic>
+#include <string>
+#include <string_view>
+
+#include "base/at_exit.h"
+#include "base/logging.h"
+#include "base/no_destructor.h"
+#include "base/process/process_handle.h"
+#include "base/synchronization/lock.h"
+#include "base/synchronization/waitable_event.h"
+#include "base/threading/platform_thread.h"
+#include "base/time/time.h"
+#include "build/build_config.h"
+
+namespace logging {
+
+namespace {
+
+constexpr base::TimeDelta kFlushInterval = base::Milliseconds(250);
+// Bounds the text waiting for the flusher thread. A thread that logs faster
+// than the flusher keeps up with writes the backlog itself once it is
+// reached, instead of letting the queue grow without limit.
+constexpr size_t kMaxPendingBytes = 1024 * 1024;
+constexpr char kBinaryMagic[] = {'E', 'L', 'G', '1'};
+
+struct Record {
+  Record* next = nullptr;
+  AsyncLogSink::Format format;
+  int severity;
+  base::Time time;
+  base::ProcessId pid;
+  base::PlatformThreadId tid;
+  std::string text;
+};
+
+// The file helpers below use the C runtime directly, like base/logging.cc
+// does, so that a synchronous flush is allowed on threads that disallow
+// blocking calls.
+FILE* OpenLogFile(const base::FilePath& path, bool truncate) {
+#if BUILDFLAG(IS_WIN)
+  return _wfopen(path.value().c_str(), truncate ? L"wb" : L"ab");
+#else
+  return fopen(path.value().c_str(), truncate ? "wb" : "ab");
+#endif
+}
+
+void RenameLogFile(const base::FilePath& from, const base::FilePath& to) {
+#if BUILDFLAG(IS_WIN)
+  _wremove(to.value().c_str());
+  _wrename(from.value().c_str(), to.value().c_str());
+#else
+  rename(from.value().c_str(), to.value().c_str());
+#endif
+}
+
+int64_t GetOpenFileSize(FILE* file) {
+  fseek(file, 0, SEEK_END);
+  return ftell(file);
+}
+
+template <typename T>
+void AppendRaw(std::string* out, T value) {
+  // All supported platforms are little-endian.
+  out->append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+class Sink : public base::PlatformThread::Delegate {
+ public:
+  static Sink* Get() {
+    static base::NoDestructor<Sink> sink;
+    return sink.get();
+  }
+
+  void Configure(const AsyncLogSink::Options& options) {
+    base::AutoLock lock(file_lock_);
+    WriteLocked(TakeAll());
+    CloseLocked();
+    options_ = options;
+    format_.store(options.format, std::memory_order_relaxed);
+    pass_through_.store(options.pass_through, std::memory_order_relaxed);
+    OpenLocked(options.delete_old);
+
+    if (!thread_started_) {
+      thread_started_ = true;
+      base::PlatformThread::CreateNonJoinable(0, this);
+      base::AtExitManager::RegisterCallback(
+          [](void*) { AsyncLogSink::Flush(); }, nullptr);
+    }
+  }
+
+  void Push(int severity, const std::string& str, size_t message_start) {
+    auto* record = new Record;
+    record->format = format_.load(std::memory_order_relaxed);
+    record->severity = severity;
+    if (record->format == AsyncLogSink::Format::kBinary) {
+      record->time = base::Time::Now();
+      record->pid = base::GetCurrentProcId();
+      record->tid = base::PlatformThread::CurrentId();
+      std::string_view message{str};
+      message.remove_prefix(message_start);
+      if (!message.empty() && message.back() == '\n')
+        message.remove_suffix(1);
+      record->text = message;
+    } else {
+      record->text = str;
+    }
+
+    const size_t size = record->text.size();
+    record->next = head_.load(std::memory_order_relaxed);
+    while (!head_.compare_exchange_weak(record->next, record,
+                                        std::memory_order_release,
+                                        std::memory_order_relaxed)) {
+    }
+    const size_t pending =
+        pending_bytes_.fetch_add(size, std::memory_order_relaxed) + size;
+
+    if (severity >= LOGGING_ERROR || pending > kMaxPendingBytes)
+      Flush();
+  }
+
+  bool pass_through() const {
+    return pass_through_.load(std::memory_order_relaxed);
+  }
+
+  void Flush() {
+    base::AutoLock lock(file_lock_);
+    WriteLocked(TakeAll());
+  }
+
+  // base::PlatformThread::Delegate:
+  void ThreadMain() override {
+    base::PlatformThread::SetName("ElectronLogFlusher");
+    while (true) {
+      wake_.TimedWait(kFlushInterval);
+      Flush();
+    }
+  }
+
+ private:
+  friend class base::NoDestructor<Sink>;
+
+  Sink() = default;
+  ~Sink() override = default;
+
+  // Detaches every pending record and returns them oldest first.
+  Record* TakeAll() {
+    Record* list = head_.exchange(nullptr, std::memory_order_acquire);
+    Record* reversed = nullptr;
+    size_t size = 0;
+    while (list) {
+      Record* next = list->next;
+      size += list->text.size();
+      list->next = reversed;
+      reversed = list;
+      list = next;
+    }
+    pending_bytes_.fetch_sub(size, std::memory_order_relaxed);
+    return reversed;
+  }
+
+  void WriteLocked(Record* list) {
+    std::string buffer;
+    while (list) {
+      Record* next = list->next;
+      if (list->format == AsyncLogSink::Format::kBinary) {
+        AppendRaw(&buffer, static_cast<int8_t>(list->severity));
+        AppendRaw(&buffer,
+                  (list->time - base::Time::UnixEpoch()).InMicroseconds());
+        AppendRaw(&buffer, static_cast<uint32_t>(list->pid));
+        AppendRaw(&buffer, static_cast<uint32_t>(list->tid));
+        AppendRaw(&buffer, static_cast<uint32_t>(list->text.size()));
+      }
+      buffer.append(list->text);
+      delete list;
+      list = next;
+    }
+    if (buffer.empty() || !file_)
+      return;
+
+    if (options_.max_size > 0 && file_size_ > 0 &&
+        file_size_ + static_cast<int64_t>(buffer.size()) > options_.max_size) {
+      CloseLocked();
+      RenameLogFile(options_.path,
+                    options_.path.AddExtension(FILE_PATH_LITERAL("old")));
+      OpenLocked(true);
+      if (!file_)
+        return;
+    }
+
+    fwrite(buffer.data(), 1, buffer.size(), file_);
+    fflush(file_);
+    file_size_ += buffer.size();
+  }
+
+  void OpenLocked(bool truncate) {
+    file_ = OpenLogFile(options_.path, truncate);
+    if (!file_)
+      return;
+    file_size_ = GetOpenFileSize(file_);
+    if (file_size_ == 0 && options_.format == AsyncLogSink::Format::kBinary) {
+      fwrite(kBinaryMagic, 1, sizeof(kBinaryMagic), file_);
+      file_size_ = sizeof(kBinaryMagic);
+    }
+  }
+
+  void CloseLocked() {
+    if (file_) {
+      fclose(file_);
+      file_ = nullptr;
+    }
+  }
+
+  std::atomic<Record*> head_{nullptr};
+  std::atomic<size_t> pending_bytes_{0};
+  std::atomic<AsyncLogSink::Format> format_{AsyncLogSink::Format::kText};
+  std::atomic<bool> pass_through_{false};
+
+  base::Lock file_lock_;
+  AsyncLogSink::Options options_;
+  FILE* file_ = nullptr;
+  int64_t file_size_ = 0;
+
+  bool thread_started_ = false;
+  base::WaitableEvent wake_;
+};
+
+bool HandleLogMessage(int severity,
+                      const char* file,
+                      int line,
+                      size_t message_start,
+                      const std::string& str) {
+  Sink* sink = Sink::Get();
+  sink->Push(severity, str, message_start);
+  return !sink->pass_through();
+}
+
+}  // namespace
+
+// static
+void AsyncLogSink::Install(const Options& options) {
+  Sink::Get()->Configure(options);
+  SetLogMessageHandler(&HandleLogMessage);
+}
+
+// static
+void AsyncLogSink::Flush() {
+  Sink::Get()->Flush();
+}
+
+}  // namespace logging
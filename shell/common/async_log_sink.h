@@ -0,0 +1,61 @@
+// Copyright (c) 2024 Microsoft, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#ifndef ELECTRON_SHELL_COMMON_ASYNC_LOG_SINK_H_
+#define ELECTRON_SHELL_COMMON_ASYNC_LOG_SINK_H_
+
+#include <cstdint>
+
+#include "base/files/file_path.h"
+
+namespace logging {
+
+// Writes log messages to a file from a background thread instead of the
+// thread that logged them.
+//
+// Logging threads push their messages onto a lock-free queue and return
+// immediately; a dedicated flusher thread drains the queue periodically and
+// writes the batch to disk. Messages of severity ERROR and above are flushed
+// synchronously so they are not lost if the process is about to crash, and
+// so is the queue once it holds more than a bounded amount of text.
+//
+// When |max_size| is non-zero the file is rotated once it grows past that
+// many bytes: the current file is renamed to "<name>.old" (replacing any
+// previous one) and a new file is started.
+//
+// The binary format starts with the 4-byte magic "ELG1" and is followed by
+// one record per message, all integers little-endian:
+//   int8   severity, VLOG levels are negative
+//   int64  microseconds since the Unix epoch
+//   uint32 process id
+//   uint32 thread id
+//   uint32 message length, followed by that many bytes of UTF-8 text
+// The message text excludes the "[pid:time:severity:file(line)]" prefix,
+// which is what makes it more compact than the text format.
+class AsyncLogSink {
+ public:
+  enum class Format { kText, kBinary };
+
+  struct Options {
+    base::FilePath path;
+    Format format = Format::kText;
+    int64_t max_size = 0;
+    bool delete_old = false;
+    // Whether base/logging should still write each message to its other
+    // destinations, e.g. stderr.
+    bool pass_through = false;
+  };
+
+  // Routes all subsequent log messages of this process to |options.path|.
+  // May be called again to switch files; pending messages are written to the
+  // previous file first.
+  static void Install(const Options& options);
+
+  // Synchronously writes every pending message. Safe to call from any thread.
+  static void Flush();
+};
+
+}  // namespace logging
+
+#endif  // ELECTRON_SHELL_COMMON_ASYNC_LOG_SINK_H_
@@ -4,7 +4,11 @@
 
 #include "shell/common/crash_keys.h"
 
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <cstdint>
+#include <cstring>
 #include <deque>
 #include <map>
 #include <string>
@@ -24,6 +28,7 @@
 #include "shell/common/options_switches.h"
 #include "shell/common/process_util.h"
 #include "third_party/crashpad/crashpad/client/annotation.h"
+#include "third_party/crashpad/crashpad/client/annotation_list.h"
 
 namespace electron::crash_keys {
 
@@ -98,6 +103,71 @@ void GetCrashKeys(std::map<std::string, std::string>* keys) {
   }
 }
 
+namespace {
+
+// Each slot holds "<sequence>:<kind>:<value>" padded with spaces and
+// terminated by a newline, so the whole ring reads as plain text in a crash
+// report. The hex sequence number tells which record is the most recent.
+constexpr size_t kBreadcrumbSlotSize = 96;
+constexpr size_t kBreadcrumbSlotCount = 32;
+constexpr size_t kBreadcrumbRingSize =
+    kBreadcrumbSlotSize * kBreadcrumbSlotCount;
+static_assert(kBreadcrumbRingSize < crashpad::Annotation::kValueMaxSize,
+              "breadcrumb ring above what crashpad supports");
+
+class BreadcrumbRing {
+ public:
+  static constexpr size_t kSequenceDigits = 8;
+  static constexpr size_t kHeaderSize = kSequenceDigits + 3;
+  // Leaves room for the header and the trailing newline.
+  static constexpr size_t kMaxValueLength =
+      kBreadcrumbSlotSize - kHeaderSize - 1;
+
+  BreadcrumbRing()
+      : annotation_(crashpad::Annotation::Type::kString,
+                    "electron.breadcrumbs",
+                    buffer_.data()) {
+    buffer_.fill(' ');
+    for (size_t i = 1; i <= kBreadcrumbSlotCount; ++i)
+      buffer_[i * kBreadcrumbSlotSize - 1] = '\n';
+  }
+
+  void Record(BreadcrumbKind kind, std::string_view value) {
+    // The annotation can only be registered once crashpad has been set up.
+    if (!registered_.load(std::memory_order_acquire)) {
+      if (!crashpad::AnnotationList::Get())
+        return;
+      if (!registered_.exchange(true, std::memory_order_acq_rel))
+        annotation_.SetSize(kBreadcrumbRingSize);
+    }
+
+    const uint32_t sequence = next_.fetch_add(1, std::memory_order_relaxed);
+    const size_t index = sequence % kBreadcrumbSlotCount;
+    char* slot = buffer_.data() + index * kBreadcrumbSlotSize;
+    for (size_t i = 0; i < kSequenceDigits; ++i)
+      slot[i] = "0123456789abcdef"[(sequence >> (4 * (7 - i))) & 0xf];
+    slot[kSequenceDigits] = ':';
+    slot[kSequenceDigits + 1] = static_cast<char>(kind);
+    slot[kSequenceDigits + 2] = ':';
+    const size_t length = std::min(value.size(), kMaxValueLength);
+    memcpy(slot + kHeaderSize, value.data(), length);
+    memset(slot + kHeaderSize + length, ' ', kMaxValueLength - length);
+  }
+
+ private:
+  std::array<char, kBreadcrumbRingSize> buffer_;
+  crashpad::Annotation annotation_;
+  std::atomic<uint32_t> next_{0};
+  std::atomic<bool> registered_{false};
+};
+
+}  // namespace
+
+void RecordBreadcrumb(BreadcrumbKind kind, std::string_view value) {
+  static base::NoDestructor<BreadcrumbRing> ring;
+  ring->Record(kind, value);
+}
+
 namespace {
 bool IsRunningAsNode() {
   return electron::fuses::IsRunAsNodeEnabled() &&
@@ -7,6 +7,7 @@
 
 #include <map>
 #include <string>
+#include <string_view>
 
 namespace base {
 class CommandLine;
@@ -18,6 +19,16 @@ void SetCrashKey(const std::string& key, const std::string& value);
 void ClearCrashKey(const std::string& key);
 void GetCrashKeys(std::map<std::string, std::string>* keys);
 
+// Short records kept in a fixed-size ring that is attached to crash reports
+// as the "electron.breadcrumbs" annotation. Recording one never allocates or
+// locks, so it is cheap enough for hot paths like IPC dispatch. Values are
+// truncated to fit a slot.
+enum class BreadcrumbKind : char {
+  kIpc = 'i',
+  kUrl = 'u',  // Navigation origins only, never full URLs.
+};
+void RecordBreadcrumb(BreadcrumbKind kind, std::string_view value);
+
 void SetCrashKeysFromCommandLine(const base::CommandLine& command_line);
 void SetPlatformCrashKey();
 
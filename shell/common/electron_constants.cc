@@ -14,6 +14,14 @@ const char kDeviceProductIdKey[] = "productId";
 const char kDeviceSerialNumberKey[] = "serialNumber";
 
 const char kRunAsNode[] = "ELECTRON_RUN_AS_NODE";
+const char kRunAsNodeMinimal[] = "ELECTRON_RUN_AS_NODE_MINIMAL";
+
+const base::FilePath::CharType kShaderCacheDirname[] =
+    FILE_PATH_LITERAL("ShaderCache");
+const base::FilePath::CharType kGrShaderCacheDirname[] =
+    FILE_PATH_LITERAL("GrShaderCache");
+const base::FilePath::CharType kGraphiteDawnCacheDirname[] =
+    FILE_PATH_LITERAL("GraphiteDawnCache");
 
 #if BUILDFLAG(ENABLE_PDF_VIEWER)
 const char kPDFExtensionPluginName[] = "Chromium PDF Viewer";
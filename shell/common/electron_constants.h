@@ -21,6 +21,12 @@ extern const char kDeviceProductIdKey[];
 extern const char kDeviceSerialNumberKey[];
 
 extern const char kRunAsNode[];
+extern const char kRunAsNodeMinimal[];
+
+// Directories under sessionData that hold the browser-wide GPU shader caches.
+extern const base::FilePath::CharType kShaderCacheDirname[];
+extern const base::FilePath::CharType kGrShaderCacheDirname[];
+extern const base::FilePath::CharType kGraphiteDawnCacheDirname[];
 
 #if BUILDFLAG(ENABLE_PDF_VIEWER)
 extern const char kPDFExtensionPluginName[];
@@ -20,6 +20,7 @@
 #include "shell/common/gin_converters/std_converter.h"
 #include "shell/common/gin_converters/value_converter.h"
 #include "shell/common/gin_helper/dictionary.h"
+#include "shell/common/gin_helper/object_shape.h"
 #include "shell/common/keyboard_util.h"
 #include "shell/common/v8_value_serializer.h"
 #include "third_party/blink/public/common/context_menu_data/edit_flags.h"
@@ -317,10 +318,21 @@ int GetKeyLocationCode(const blink::WebInputEvent& key) {
   return kDomKeyLocationStandard;
 }
 
+namespace {
+
+// Keyboard events are converted for every key press that is forwarded to
+// the before-input-event listeners.
+constexpr std::string_view kKeyboardEventKeys[] = {
+    "type", "key",     "code", "isAutoRepeat", "isComposing", "shift",
+    "control", "alt", "meta", "location",     "_modifiers",  "modifiers"};
+constexpr gin_helper::ObjectShape kKeyboardEventShape{kKeyboardEventKeys};
+
+}  // namespace
+
 v8::Local<v8::Value> Converter<blink::WebKeyboardEvent>::ToV8(
     v8::Isolate* isolate,
     const blink::WebKeyboardEvent& in) {
-  auto dict = gin_helper::Dictionary::CreateEmpty(isolate);
+  gin_helper::ShapedObject dict(isolate, kKeyboardEventShape);
 
   dict.Set("type", in.GetType());
   dict.Set("key", ui::KeycodeConverter::DomKeyToKeyString(in.dom_key));
@@ -704,4 +716,10 @@ bool Converter<blink::CloneableMessage>::FromV8(v8::Isolate* isolate,
   return electron::SerializeV8Value(isolate, val, out);
 }
 
+v8::Local<v8::Value> Converter<blink::TransferableMessage>::ToV8(
+    v8::Isolate* isolate,
+    const blink::TransferableMessage& in) {
+  return electron::DeserializeV8Value(isolate, in);
+}
+
 }  // namespace gin
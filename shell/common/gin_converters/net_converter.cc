@@ -30,6 +30,7 @@
 #include "shell/common/gin_converters/gurl_converter.h"
 #include "shell/common/gin_converters/std_converter.h"
 #include "shell/common/gin_converters/value_converter.h"
+#include "shell/common/gin_helper/object_shape.h"
 #include "shell/common/gin_helper/promise.h"
 #include "shell/common/node_includes.h"
 
@@ -610,11 +611,29 @@ bool Converter<scoped_refptr<network::ResourceRequestBody>>::FromV8(
   return true;
 }
 
+namespace {
+
+constexpr std::string_view kResourceRequestKeys[] = {"method", "url",
+                                                      "referrer", "headers"};
+constexpr gin_helper::ObjectShape kResourceRequestShape{kResourceRequestKeys};
+
+constexpr std::string_view kRedirectInfoKeys[] = {
+    "statusCode",
+    "newMethod",
+    "newUrl",
+    "newSiteForCookies",
+    "newReferrer",
+    "insecureSchemeWasUpgraded",
+    "isSignedExchangeFallbackRedirect"};
+constexpr gin_helper::ObjectShape kRedirectInfoShape{kRedirectInfoKeys};
+
+}  // namespace
+
 // static
 v8::Local<v8::Value> Converter<network::ResourceRequest>::ToV8(
     v8::Isolate* isolate,
     const network::ResourceRequest& val) {
-  auto dict = gin::Dictionary::CreateEmpty(isolate);
+  gin_helper::ShapedObject dict(isolate, kResourceRequestShape);
   dict.Set("method", val.method);
   dict.Set("url", val.url.spec());
   dict.Set("referrer", val.referrer.spec());
@@ -652,7 +671,7 @@ v8::Local<v8::Value> Converter<net::HttpVersion>::ToV8(
 v8::Local<v8::Value> Converter<net::RedirectInfo>::ToV8(
     v8::Isolate* isolate,
     const net::RedirectInfo& val) {
-  auto dict = gin::Dictionary::CreateEmpty(isolate);
+  gin_helper::ShapedObject dict(isolate, kRedirectInfoShape);
 
   dict.Set("statusCode", val.status_code);
   dict.Set("newMethod", val.new_method);
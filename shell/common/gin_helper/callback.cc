@@ -4,8 +4,10 @@
 
 #include "shell/common/gin_helper/callback.h"
 
+#include <utility>
+
 #include "content/public/browser/browser_thread.h"
-#include "gin/dictionary.h"
+#include "gin/arguments.h"
 #include "shell/common/process_util.h"
 
 namespace gin_helper {
@@ -13,8 +15,12 @@ namespace gin_helper {
 namespace {
 
 struct TranslaterHolder {
-  explicit TranslaterHolder(v8::Isolate* isolate)
-      : handle(isolate, v8::External::New(isolate, this)) {
+  TranslaterHolder(v8::Isolate* isolate,
+                   const Translater& translater,
+                   bool one_time)
+      : handle(isolate, v8::External::New(isolate, this)),
+        translater(translater),
+        one_time(one_time) {
     handle.SetWeak(this, &GC, v8::WeakCallbackType::kParameter);
   }
   ~TranslaterHolder() {
@@ -30,38 +36,32 @@ struct TranslaterHolder {
 
   v8::Global<v8::External> handle;
   Translater translater;
+  // Whether the callback should only be called once.
+  bool one_time;
+  bool called = false;
 };
 
-// Cached JavaScript version of |CallTranslater|.
-v8::Persistent<v8::FunctionTemplate> g_call_translater;
+void CallTranslater(const v8::FunctionCallbackInfo<v8::Value>& info) {
+  auto* holder =
+      static_cast<TranslaterHolder*>(info.Data().As<v8::External>()->Value());
+  gin::Arguments args(info);
 
-void CallTranslater(v8::Local<v8::External> external,
-                    v8::Local<v8::Object> state,
-                    gin::Arguments* args) {
-  // Whether the callback should only be called once.
-  v8::Isolate* isolate = args->isolate();
-  auto context = isolate->GetCurrentContext();
-  bool one_time =
-      state->Has(context, gin::StringToSymbol(isolate, "oneTime")).ToChecked();
+  if (!holder->one_time) {
+    holder->translater.Run(&args);
+    return;
+  }
 
   // Check if the callback has already been called.
-  if (one_time) {
-    auto called_symbol = gin::StringToSymbol(isolate, "called");
-    if (state->Has(context, called_symbol).ToChecked()) {
-      args->ThrowTypeError("One-time callback was called more than once");
-      return;
-    } else {
-      state->Set(context, called_symbol, v8::Boolean::New(isolate, true))
-          .ToChecked();
-    }
+  if (holder->called) {
+    args.ThrowTypeError("One-time callback was called more than once");
+    return;
   }
+  holder->called = true;
 
-  auto* holder = static_cast<TranslaterHolder*>(external->Value());
-  holder->translater.Run(args);
-
-  // Free immediately for one-time callback.
-  if (one_time)
-    delete holder;
+  // Release what the one-time callback is bound to as soon as it has run, the
+  // holder itself only goes away with the function.
+  Translater translater = std::move(holder->translater);
+  translater.Run(&args);
 }
 
 }  // namespace
@@ -103,6 +103,8 @@ SafeV8Function::SafeV8Function(v8::Isolate* isolate, v8::Local<v8::Value> value)
 
 SafeV8Function::SafeV8Function(const SafeV8Function& other) = default;
 
+SafeV8Function::SafeV8Function(SafeV8Function&& other) = default;
+
 SafeV8Function::~SafeV8Function() = default;
 
 bool SafeV8Function::IsAlive() const {
@@ -116,38 +118,13 @@ v8::Local<v8::Function> SafeV8Function::NewHandle(v8::Isolate* isolate) const {
 v8::Local<v8::Value> CreateFunctionFromTranslater(v8::Isolate* isolate,
                                                   const Translater& translater,
                                                   bool one_time) {
-  // The FunctionTemplate is cached.
-  if (g_call_translater.IsEmpty())
-    g_call_translater.Reset(
-        isolate,
-        CreateFunctionTemplate(isolate, base::BindRepeating(&CallTranslater)));
-
-  v8::Local<v8::FunctionTemplate> call_translater =
-      v8::Local<v8::FunctionTemplate>::New(isolate, g_call_translater);
-  auto* holder = new TranslaterHolder(isolate);
-  holder->translater = translater;
-  auto state = gin::Dictionary::CreateEmpty(isolate);
-  if (one_time)
-    state.Set("oneTime", true);
-  auto context = isolate->GetCurrentContext();
-  return BindFunctionWith(
-      isolate, context, call_translater->GetFunction(context).ToLocalChecked(),
-      holder->handle.Get(isolate), gin::ConvertToV8(isolate, state));
-}
-
-// func.bind(func, arg1).
-// NB(zcbenz): Using C++11 version crashes VS.
-v8::Local<v8::Value> BindFunctionWith(v8::Isolate* isolate,
-                                      v8::Local<v8::Context> context,
-                                      v8::Local<v8::Function> func,
-                                      v8::Local<v8::Value> arg1,
-                                      v8::Local<v8::Value> arg2) {
-  v8::MaybeLocal<v8::Value> bind =
-      func->Get(context, gin::StringToV8(isolate, "bind"));
-  CHECK(!bind.IsEmpty());
-  v8::Local<v8::Function> bind_func = bind.ToLocalChecked().As<v8::Function>();
-  v8::Local<v8::Value> converted[] = {func, arg1, arg2};
-  return bind_func->Call(context, func, std::size(converted), converted)
+  // The function carries the holder as its data, which avoids both a
+  // FunctionTemplate per callback, as V8 caches those forever, and binding a
+  // shared function to per-callback state through Function.prototype.bind.
+  auto* holder = new TranslaterHolder(isolate, translater, one_time);
+  return v8::Function::New(isolate->GetCurrentContext(), &CallTranslater,
+                           holder->handle.Get(isolate), 0,
+                           v8::ConstructorBehavior::kThrow)
       .ToLocalChecked();
 }
 
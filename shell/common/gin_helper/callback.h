@@ -5,6 +5,7 @@
 #ifndef ELECTRON_SHELL_COMMON_GIN_HELPER_CALLBACK_H_
 #define ELECTRON_SHELL_COMMON_GIN_HELPER_CALLBACK_H_
 
+#include <array>
 #include <utility>
 #include <vector>
 
@@ -26,6 +27,7 @@ class SafeV8Function {
  public:
   SafeV8Function(v8::Isolate* isolate, v8::Local<v8::Value> value);
   SafeV8Function(const SafeV8Function& other);
+  SafeV8Function(SafeV8Function&& other);
   ~SafeV8Function();
 
   bool IsAlive() const;
@@ -53,10 +55,10 @@ struct V8FunctionInvoker<v8::Local<v8::Value>(ArgTypes...)> {
     gin_helper::MicrotasksScope microtasks_scope(
         isolate, context->GetMicrotaskQueue(), true);
     v8::Context::Scope context_scope(context);
-    std::vector<v8::Local<v8::Value>> args{
+    std::array<v8::Local<v8::Value>, sizeof...(ArgTypes)> args{
         gin::ConvertToV8(isolate, std::forward<ArgTypes>(raw))...};
     v8::MaybeLocal<v8::Value> ret = holder->Call(
-        context, holder, args.size(), args.empty() ? nullptr : &args.front());
+        context, holder, args.size(), args.data());
     if (ret.IsEmpty())
       return v8::Undefined(isolate);
     else
@@ -78,11 +80,11 @@ struct V8FunctionInvoker<void(ArgTypes...)> {
     gin_helper::MicrotasksScope microtasks_scope(
         isolate, context->GetMicrotaskQueue(), true);
     v8::Context::Scope context_scope(context);
-    std::vector<v8::Local<v8::Value>> args{
+    std::array<v8::Local<v8::Value>, sizeof...(ArgTypes)> args{
         gin::ConvertToV8(isolate, std::forward<ArgTypes>(raw))...};
     holder
         ->Call(context, holder, args.size(),
-               args.empty() ? nullptr : &args.front())
+               args.data())
         .IsEmpty();
   }
 };
@@ -102,11 +104,11 @@ struct V8FunctionInvoker<ReturnType(ArgTypes...)> {
     gin_helper::MicrotasksScope microtasks_scope(
         isolate, context->GetMicrotaskQueue(), true);
     v8::Context::Scope context_scope(context);
-    std::vector<v8::Local<v8::Value>> args{
+    std::array<v8::Local<v8::Value>, sizeof...(ArgTypes)> args{
         gin::ConvertToV8(isolate, std::forward<ArgTypes>(raw))...};
     v8::Local<v8::Value> result;
     auto maybe_result = holder->Call(context, holder, args.size(),
-                                     args.empty() ? nullptr : &args.front());
+                                     args.data());
     if (maybe_result.ToLocal(&result))
       gin::Converter<ReturnType>::FromV8(isolate, result, &ret);
     return ret;
@@ -118,11 +120,6 @@ using Translater = base::RepeatingCallback<void(gin::Arguments* args)>;
 v8::Local<v8::Value> CreateFunctionFromTranslater(v8::Isolate* isolate,
                                                   const Translater& translater,
                                                   bool one_time);
-v8::Local<v8::Value> BindFunctionWith(v8::Isolate* isolate,
-                                      v8::Local<v8::Context> context,
-                                      v8::Local<v8::Function> func,
-                                      v8::Local<v8::Value> arg1,
-                                      v8::Local<v8::Value> arg2);
 
 // Calls callback with Arguments.
 template <typename Sig>
@@ -44,6 +44,9 @@ class EventEmitter : public gin_helper::Wrappable<T> {
     v8::Local<v8::Object> wrapper = GetWrapper();
     if (wrapper.IsEmpty())
       return false;
+    // Nobody could have called preventDefault() on the event.
+    if (!gin_helper::HasEventListeners(isolate(), wrapper, name))
+      return false;
     gin::Handle<gin_helper::internal::Event> event =
         internal::Event::New(isolate());
     return EmitWithEvent(name, event, std::forward<Args>(args)...);
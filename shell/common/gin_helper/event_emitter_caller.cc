@@ -4,6 +4,7 @@
 
 #include "shell/common/gin_helper/event_emitter_caller.h"
 
+#include "base/no_destructor.h"
 #include "shell/common/gin_helper/microtasks_scope.h"
 #include "shell/common/node_includes.h"
 
@@ -40,3 +41,61 @@ v8::Local<v8::Value> CallMethodWithArgs(v8::Isolate* isolate,
 }
 
 }  // namespace gin_helper::internal
+
+namespace gin_helper {
+
+namespace {
+
+// EventEmitter.prototype.emit, as it was when the prototype was set.
+v8::Global<v8::Value>* GetStockEventEmitterEmit() {
+  static base::NoDestructor<v8::Global<v8::Value>> event_emitter_emit;
+  return event_emitter_emit.get();
+}
+
+}  // namespace
+
+void SetStockEventEmitterEmit(v8::Isolate* isolate, v8::Local<v8::Value> emit) {
+  GetStockEventEmitterEmit()->Reset(isolate, emit);
+}
+
+bool HasEventListeners(v8::Isolate* isolate,
+                       v8::Local<v8::Object> emitter,
+                       std::string_view name) {
+  // An unhandled 'error' event throws, which callers may rely on.
+  if (name == "error")
+    return true;
+
+  // Without the prototype there is no way to tell what emit() does.
+  v8::Global<v8::Value>* stock_emit = GetStockEventEmitterEmit();
+  if (stock_emit->IsEmpty())
+    return true;
+
+  v8::Local<v8::Context> context = emitter->GetCreationContextChecked();
+
+  // JS can replace emit() to forward events elsewhere (MessagePortMain and
+  // UtilityProcess do), that has to see all events.
+  v8::Local<v8::Value> emit;
+  if (!emitter->Get(context, gin::StringToSymbol(isolate, "emit"))
+           .ToLocal(&emit) ||
+      !emit->StrictEquals(stock_emit->Get(isolate)))
+    return true;
+
+  // EventEmitter keeps its listeners in |_events|, which only exists once a
+  // listener was added, and deletes the entry of an event when its last
+  // listener is removed.
+  v8::Local<v8::Value> events;
+  if (!emitter->Get(context, gin::StringToSymbol(isolate, "_events"))
+           .ToLocal(&events))
+    return true;
+  if (!events->IsObject())
+    return false;
+
+  v8::Local<v8::Value> listeners;
+  if (!events.As<v8::Object>()
+           ->Get(context, gin::StringToSymbol(isolate, name))
+           .ToLocal(&listeners))
+    return true;
+  return !listeners->IsUndefined();
+}
+
+}  // namespace gin_helper
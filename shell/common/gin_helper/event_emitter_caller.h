@@ -5,6 +5,7 @@
 #ifndef ELECTRON_SHELL_COMMON_GIN_HELPER_EVENT_EMITTER_CALLER_H_
 #define ELECTRON_SHELL_COMMON_GIN_HELPER_EVENT_EMITTER_CALLER_H_
 
+#include <string_view>
 #include <utility>
 #include <vector>
 
@@ -24,6 +25,17 @@ v8::Local<v8::Value> CallMethodWithArgs(v8::Isolate* isolate,
 
 }  // namespace internal
 
+// Remembers EventEmitter.prototype.emit, so that HasEventListeners() can tell
+// whether an emitter's emit() has been replaced.
+void SetStockEventEmitterEmit(v8::Isolate* isolate, v8::Local<v8::Value> emit);
+
+// Whether emitting |name| on |emitter| can be observed by JavaScript, that is
+// whether it has listeners for |name| or a custom emit(). Lets callers skip
+// creating the event and converting its arguments.
+bool HasEventListeners(v8::Isolate* isolate,
+                       v8::Local<v8::Object> emitter,
+                       std::string_view name);
+
 // obj.emit.apply(obj, name, args...);
 // The caller is responsible of allocating a HandleScope.
 template <typename StringType>
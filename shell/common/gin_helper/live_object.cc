@@ -0,0 +1,155 @@
+// Copyright (c) 2024 Microsoft, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#include "shell/common/gin_helper/live_object.h"
+
+#include <utility>
+
+#include "base/environment.h"
+#include "base/no_destructor.h"
+#include "base/strings/strcat.h"
+#include "base/strings/string_number_conversions.h"
+#include "base/synchronization/lock.h"
+#include "base/thread_annotations.h"
+#include "gin/converter.h"
+#include "third_party/abseil-cpp/absl/container/flat_hash_map.h"
+#include "v8/include/v8.h"
+
+namespace gin_helper {
+
+namespace {
+
+constexpr char kTrackNativeObjects[] = "ELECTRON_TRACK_NATIVE_OBJECTS";
+
+enum class Mode { kOff, kCount, kStack };
+
+Mode GetMode() {
+  static const Mode mode = [] {
+    std::string value;
+    if (!base::Environment::Create()->GetVar(kTrackNativeObjects, &value) ||
+        value.empty()) {
+      return Mode::kOff;
+    }
+    return value == "stack" ? Mode::kStack : Mode::kCount;
+  }();
+  return mode;
+}
+
+std::string GetAllocationSite() {
+  v8::Isolate* isolate = v8::Isolate::TryGetCurrent();
+  if (!isolate || !isolate->InContext())
+    return {};
+
+  v8::HandleScope scope(isolate);
+  v8::Local<v8::StackTrace> trace = v8::StackTrace::CurrentStackTrace(
+      isolate, 1, v8::StackTrace::kScriptName);
+  if (trace->GetFrameCount() == 0)
+    return {};
+
+  v8::Local<v8::StackFrame> frame = trace->GetFrame(isolate, 0);
+  std::string script_name;
+  gin::ConvertFromV8(isolate, frame->GetScriptName(), &script_name);
+  return base::StrCat({script_name, ":",
+                       base::NumberToString(frame->GetLineNumber()), ":",
+                       base::NumberToString(frame->GetColumn())});
+}
+
+struct Entry {
+  std::string type_name;
+  std::string allocation_site;
+  int64_t native_size = 0;
+};
+
+class Registry {
+ public:
+  static Registry* Get() {
+    static base::NoDestructor<Registry> registry;
+    return registry.get();
+  }
+
+  void Add(const void* object, Entry entry) {
+    base::AutoLock lock(lock_);
+    entries_[object] = std::move(entry);
+  }
+
+  void Remove(const void* object) {
+    base::AutoLock lock(lock_);
+    entries_.erase(object);
+  }
+
+  void SetNativeSize(const void* object, int64_t size) {
+    base::AutoLock lock(lock_);
+    if (auto iter = entries_.find(object); iter != entries_.end())
+      iter->second.native_size = size;
+  }
+
+  std::map<std::string, LiveObjectTracker::TypeStats> GetStats() {
+    std::map<std::string, LiveObjectTracker::TypeStats> stats;
+    base::AutoLock lock(lock_);
+    for (const auto& [object, entry] : entries_) {
+      auto& type_stats = stats[entry.type_name];
+      type_stats.count++;
+      type_stats.native_size += entry.native_size;
+      if (!entry.allocation_site.empty())
+        type_stats.allocation_sites[entry.allocation_site]++;
+    }
+    return stats;
+  }
+
+ private:
+  base::Lock lock_;
+  absl::flat_hash_map<const void*, Entry> entries_ GUARDED_BY(lock_);
+};
+
+}  // namespace
+
+// static
+bool LiveObjectTracker::IsEnabled() {
+  return GetMode() != Mode::kOff;
+}
+
+// static
+void LiveObjectTracker::Add(const void* object, std::string type_name) {
+  if (!IsEnabled())
+    return;
+  Entry entry;
+  entry.type_name = std::move(type_name);
+  if (GetMode() == Mode::kStack)
+    entry.allocation_site = GetAllocationSite();
+  Registry::Get()->Add(object, std::move(entry));
+}
+
+// static
+void LiveObjectTracker::Remove(const void* object) {
+  if (IsEnabled())
+    Registry::Get()->Remove(object);
+}
+
+// static
+void LiveObjectTracker::SetNativeSize(const void* object, int64_t size) {
+  if (IsEnabled())
+    Registry::Get()->SetNativeSize(object, size);
+}
+
+// static
+std::map<std::string, LiveObjectTracker::TypeStats>
+LiveObjectTracker::GetStats() {
+  if (!IsEnabled())
+    return {};
+  return Registry::Get()->GetStats();
+}
+
+LiveObject::LiveObject(const char* type_name) {
+  LiveObjectTracker::Add(this, type_name);
+}
+
+LiveObject::~LiveObject() {
+  LiveObjectTracker::Remove(this);
+}
+
+void LiveObject::SetNativeSize(int64_t size) {
+  LiveObjectTracker::SetNativeSize(this, size);
+}
+
+}  // namespace gin_helper
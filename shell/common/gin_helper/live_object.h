@@ -0,0 +1,57 @@
+// Copyright (c) 2024 Microsoft, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#ifndef ELECTRON_SHELL_COMMON_GIN_HELPER_LIVE_OBJECT_H_
+#define ELECTRON_SHELL_COMMON_GIN_HELPER_LIVE_OBJECT_H_
+
+#include <cstdint>
+#include <map>
+#include <string>
+
+namespace gin_helper {
+
+// Keeps count of the native objects behind JS wrappers, per type, so that a
+// leaked wrapper shows up as a growing count instead of only as growing RSS.
+//
+// Tracking is off unless ELECTRON_TRACK_NATIVE_OBJECTS is set when the process
+// starts. With the value "stack" the JS location that created each object is
+// recorded as well, which walks the stack once per object.
+class LiveObjectTracker {
+ public:
+  struct TypeStats {
+    size_t count = 0;
+    int64_t native_size = 0;
+    // "url:line:column" of the creating JS frame -> live objects created there.
+    std::map<std::string, size_t> allocation_sites;
+  };
+
+  static bool IsEnabled();
+
+  static void Add(const void* object, std::string type_name);
+  static void Remove(const void* object);
+  // Updates the native memory attributed to |object|, in bytes.
+  static void SetNativeSize(const void* object, int64_t size);
+
+  static std::map<std::string, TypeStats> GetStats();
+};
+
+// Registers the object that owns it with LiveObjectTracker for its lifetime.
+// Intended to be a member of classes that are not TrackableObjects:
+//
+//   gin_helper::LiveObject live_object_{"WebContents"};
+class LiveObject {
+ public:
+  explicit LiveObject(const char* type_name);
+  ~LiveObject();
+
+  // disable copy
+  LiveObject(const LiveObject&) = delete;
+  LiveObject& operator=(const LiveObject&) = delete;
+
+  void SetNativeSize(int64_t size);
+};
+
+}  // namespace gin_helper
+
+#endif  // ELECTRON_SHELL_COMMON_GIN_HELPER_LIVE_OBJECT_H_
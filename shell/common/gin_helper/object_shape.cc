@@ -0,0 +1,138 @@
+// Copyright (c) 2024 Microsoft, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#include "shell/common/gin_helper/object_shape.h"
+
+#include <memory>
+#include <vector>
+
+#include "base/containers/flat_map.h"
+#include "base/no_destructor.h"
+#include "base/threading/thread_local.h"
+#include "gin/per_isolate_data.h"
+#include "v8/include/v8-object.h"
+#include "v8/include/v8-template.h"
+
+namespace gin_helper {
+
+namespace {
+
+class ShapeCache;
+
+using ShapeCacheMap =
+    base::flat_map<v8::Isolate*, std::unique_ptr<ShapeCache>>;
+
+// Isolates are bound to a thread, so are their caches.
+ShapeCacheMap& GetShapeCacheMap() {
+  static base::NoDestructor<base::ThreadLocalOwnedPointer<ShapeCacheMap>>
+      tls_caches;
+  if (!tls_caches->Get())
+    tls_caches->Set(std::make_unique<ShapeCacheMap>());
+  return *tls_caches->Get();
+}
+
+// The templates and keys of every shape used in an isolate, released when
+// the isolate is disposed.
+class ShapeCache : public gin::PerIsolateData::DisposeObserver {
+ public:
+  struct Entry {
+    v8::Global<v8::ObjectTemplate> object_template;
+    std::vector<v8::Global<v8::String>> keys;
+  };
+
+  ShapeCache(v8::Isolate* isolate, gin::PerIsolateData* per_isolate_data)
+      : isolate_(isolate), per_isolate_data_(*per_isolate_data) {
+    per_isolate_data_->AddDisposeObserver(this);
+  }
+  ~ShapeCache() override { per_isolate_data_->RemoveDisposeObserver(this); }
+
+  // disable copy
+  ShapeCache(const ShapeCache&) = delete;
+  ShapeCache& operator=(const ShapeCache&) = delete;
+
+  // Returns the cache of |isolate|, or nullptr when it has no gin data to
+  // observe, e.g. in a Node.js Worker.
+  static ShapeCache* From(v8::Isolate* isolate) {
+    ShapeCacheMap& caches = GetShapeCacheMap();
+    auto iter = caches.find(isolate);
+    if (iter != caches.end())
+      return iter->second.get();
+    gin::PerIsolateData* per_isolate_data = gin::PerIsolateData::From(isolate);
+    if (!per_isolate_data)
+      return nullptr;
+    auto cache = std::make_unique<ShapeCache>(isolate, per_isolate_data);
+    return caches.emplace(isolate, std::move(cache)).first->second.get();
+  }
+
+  const Entry& Get(const ObjectShape& shape) {
+    auto iter = entries_.find(&shape);
+    if (iter != entries_.end())
+      return iter->second;
+
+    Entry entry;
+    auto object_template = v8::ObjectTemplate::New(isolate_);
+    entry.keys.reserve(shape.keys().size());
+    for (const std::string_view key : shape.keys()) {
+      v8::Local<v8::String> v8_key = gin::StringToSymbol(isolate_, key);
+      object_template->Set(v8_key, v8::Undefined(isolate_));
+      entry.keys.emplace_back(isolate_, v8_key);
+    }
+    entry.object_template.Reset(isolate_, object_template);
+    return entries_.emplace(&shape, std::move(entry)).first->second;
+  }
+
+  // gin::PerIsolateData::DisposeObserver:
+  void OnBeforeDispose(v8::Isolate* isolate) override { entries_.clear(); }
+  void OnDisposed() override {
+    // Destroys this.
+    GetShapeCacheMap().erase(isolate_);
+  }
+
+ private:
+  raw_ptr<v8::Isolate> isolate_;
+  const raw_ref<gin::PerIsolateData> per_isolate_data_;
+  base::flat_map<const ObjectShape*, Entry> entries_;
+};
+
+}  // namespace
+
+ShapedObject::ShapedObject(v8::Isolate* isolate, const ObjectShape& shape)
+    : isolate_(isolate), shape_(shape) {
+  v8::Local<v8::Context> context = isolate->GetCurrentContext();
+  if (ShapeCache* cache = ShapeCache::From(isolate)) {
+    const ShapeCache::Entry& entry = cache->Get(shape);
+    if (entry.object_template.Get(isolate)
+            ->NewInstance(context)
+            .ToLocal(&object_)) {
+      keys_ = entry.keys;
+      return;
+    }
+  }
+  object_ = v8::Object::New(isolate);
+}
+
+ShapedObject::~ShapedObject() = default;
+
+bool ShapedObject::SetValue(std::string_view key, v8::Local<v8::Value> value) {
+  v8::Local<v8::String> v8_key;
+  const auto shape_keys = shape_->keys();
+  if (!keys_.empty()) {
+    for (size_t i = 0; i < shape_keys.size(); ++i) {
+      const size_t index = (next_key_ + i) % shape_keys.size();
+      if (shape_keys[index] == key) {
+        v8_key = keys_[index].Get(isolate_);
+        next_key_ = index + 1;
+        break;
+      }
+    }
+  }
+  if (v8_key.IsEmpty())
+    v8_key = gin::StringToSymbol(isolate_, key);
+
+  v8::Maybe<bool> result = object_->CreateDataProperty(
+      isolate_->GetCurrentContext(), v8_key, value);
+  return !result.IsNothing() && result.FromJust();
+}
+
+}  // namespace gin_helper
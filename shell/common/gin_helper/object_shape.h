@@ -0,0 +1,97 @@
+// Copyright (c) 2024 Microsoft, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#ifndef ELECTRON_SHELL_COMMON_GIN_HELPER_OBJECT_SHAPE_H_
+#define ELECTRON_SHELL_COMMON_GIN_HELPER_OBJECT_SHAPE_H_
+
+#include <string_view>
+
+#include "base/containers/span.h"
+#include "base/memory/raw_ptr.h"
+#include "base/memory/raw_ref.h"
+#include "gin/converter.h"
+#include "shell/common/gin_helper/dictionary.h"
+#include "v8/include/v8-forward.h"
+
+namespace gin_helper {
+
+// The keys that an object converted on a hot path always has, in the order
+// they are set. Must have static storage duration:
+//
+//   constexpr std::string_view kRequestKeys[] = {"method", "url"};
+//   constexpr gin_helper::ObjectShape kRequestShape{kRequestKeys};
+//
+// Keys that are only set sometimes must be left out, each key of the shape
+// exists on the object even when it is never set.
+class ObjectShape {
+ public:
+  constexpr explicit ObjectShape(base::span<const std::string_view> keys)
+      : keys_(keys) {}
+
+  // disable copy
+  ObjectShape(const ObjectShape&) = delete;
+  ObjectShape& operator=(const ObjectShape&) = delete;
+
+  base::span<const std::string_view> keys() const { return keys_; }
+
+ private:
+  base::span<const std::string_view> keys_;
+};
+
+// Creates an object from an ObjectShape. The object is instantiated from a
+// template created once per isolate, so that every object of the same shape
+// starts with the same hidden class, and the keys of the shape are
+// internalized strings that are created once per isolate instead of on every
+// Set().
+class ShapedObject {
+ public:
+  ShapedObject(v8::Isolate* isolate, const ObjectShape& shape);
+  ~ShapedObject();
+
+  // disable copy
+  ShapedObject(const ShapedObject&) = delete;
+  ShapedObject& operator=(const ShapedObject&) = delete;
+
+  template <typename T>
+  bool Set(std::string_view key, const T& val) {
+    v8::Local<v8::Value> v8_value;
+    if (!gin::TryConvertToV8(isolate_, val, &v8_value))
+      return false;
+    return SetValue(key, v8_value);
+  }
+
+  // For the helpers that take a Dictionary, e.g. to set a getter.
+  Dictionary AsDictionary() const { return Dictionary(isolate_, object_); }
+
+  v8::Isolate* isolate() const { return isolate_; }
+  v8::Local<v8::Object> GetHandle() const { return object_; }
+
+ private:
+  bool SetValue(std::string_view key, v8::Local<v8::Value> value);
+
+  raw_ptr<v8::Isolate> isolate_;
+  const raw_ref<const ObjectShape> shape_;
+  v8::Local<v8::Object> object_;
+  // The interned keys of |shape_|, empty when the isolate can not cache them.
+  base::span<const v8::Global<v8::String>> keys_;
+  // Keys are usually set in the order of the shape, this is where the
+  // lookup of the next key starts.
+  size_t next_key_ = 0;
+};
+
+}  // namespace gin_helper
+
+namespace gin {
+
+template <>
+struct Converter<gin_helper::ShapedObject> {
+  static v8::Local<v8::Value> ToV8(v8::Isolate* isolate,
+                                   const gin_helper::ShapedObject& val) {
+    return val.GetHandle();
+  }
+};
+
+}  // namespace gin
+
+#endif  // ELECTRON_SHELL_COMMON_GIN_HELPER_OBJECT_SHAPE_H_
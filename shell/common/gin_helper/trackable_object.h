@@ -11,6 +11,7 @@
 #include "base/memory/weak_ptr.h"
 #include "shell/common/gin_helper/cleaned_up_at_exit.h"
 #include "shell/common/gin_helper/event_emitter.h"
+#include "shell/common/gin_helper/live_object.h"
 #include "shell/common/key_weak_map.h"
 
 namespace base {
@@ -114,13 +115,22 @@ class TrackableObject : public TrackableObjectBase, public EventEmitter<T> {
  protected:
   TrackableObject() { weak_map_id_ = ++next_id_; }
 
-  ~TrackableObject() override { RemoveFromWeakMap(); }
+  ~TrackableObject() override {
+    RemoveFromWeakMap();
+    LiveObjectTracker::Remove(this);
+  }
 
   void InitWith(v8::Isolate* isolate, v8::Local<v8::Object> wrapper) override {
     if (!weak_map_) {
       weak_map_ = new electron::KeyWeakMap<int32_t>;
     }
     weak_map_->Set(isolate, weak_map_id_, wrapper);
+    // Named after the JS class, so BrowserWindow and BaseWindow are told
+    // apart.
+    if (LiveObjectTracker::IsEnabled()) {
+      LiveObjectTracker::Add(
+          this, gin::V8ToString(isolate, wrapper->GetConstructorName()));
+    }
     gin_helper::WrappableBase::InitWith(isolate, wrapper);
   }
 
@@ -4,8 +4,15 @@
 
 #include "shell/common/heap_snapshot.h"
 
+#include <string>
+#include <utility>
+
+#include "base/containers/span.h"
 #include "base/files/file.h"
+#include "base/functional/callback.h"
 #include "base/memory/raw_ptr.h"
+#include "base/task/thread_pool.h"
+#include "base/threading/sequence_bound.h"
 #include "v8/include/v8-profiler.h"
 #include "v8/include/v8.h"
 
@@ -33,6 +40,58 @@ class HeapSnapshotOutputStream : public v8::OutputStream {
   bool is_complete_ = false;
 };
 
+// Lives on a background sequence, writes the chunks in the order they were
+// serialized.
+class HeapSnapshotFileWriter {
+ public:
+  explicit HeapSnapshotFileWriter(base::File file) : file_(std::move(file)) {}
+
+  // disable copy
+  HeapSnapshotFileWriter(const HeapSnapshotFileWriter&) = delete;
+  HeapSnapshotFileWriter& operator=(const HeapSnapshotFileWriter&) = delete;
+
+  void Write(std::string chunk) {
+    // Keeps going after a failure as the snapshot can't be aborted anymore,
+    // but skips the remaining chunks.
+    if (!succeeded_)
+      return;
+    succeeded_ = file_.WriteAtCurrentPosAndCheck(base::as_byte_span(chunk));
+  }
+
+  bool Close(bool is_complete) {
+    file_.Close();
+    return succeeded_ && is_complete;
+  }
+
+ private:
+  base::File file_;
+  bool succeeded_ = true;
+};
+
+class ChunkedHeapSnapshotOutputStream : public v8::OutputStream {
+ public:
+  explicit ChunkedHeapSnapshotOutputStream(
+      base::SequenceBound<HeapSnapshotFileWriter>* writer)
+      : writer_(writer) {}
+
+  bool IsComplete() const { return is_complete_; }
+
+  // v8::OutputStream
+  // Larger than for a synchronous write, each chunk is a task.
+  int GetChunkSize() override { return 1 << 20; }
+  void EndOfStream() override { is_complete_ = true; }
+
+  v8::OutputStream::WriteResult WriteAsciiChunk(char* data, int size) override {
+    writer_->AsyncCall(&HeapSnapshotFileWriter::Write)
+        .WithArgs(std::string(data, size));
+    return kContinue;
+  }
+
+ private:
+  raw_ptr<base::SequenceBound<HeapSnapshotFileWriter>> writer_;
+  bool is_complete_ = false;
+};
+
 }  // namespace
 
 namespace electron {
@@ -56,4 +115,36 @@ bool TakeHeapSnapshot(v8::Isolate* isolate, base::File* file) {
   return stream.IsComplete();
 }
 
+void TakeHeapSnapshotAsync(v8::Isolate* isolate,
+                           base::File file,
+                           base::OnceCallback<void(bool success)> callback) {
+  DCHECK(isolate);
+
+  if (!file.IsValid()) {
+    std::move(callback).Run(false);
+    return;
+  }
+
+  auto* snapshot = isolate->GetHeapProfiler()->TakeHeapSnapshot();
+  if (!snapshot) {
+    std::move(callback).Run(false);
+    return;
+  }
+
+  base::SequenceBound<HeapSnapshotFileWriter> writer(
+      base::ThreadPool::CreateSequencedTaskRunner(
+          {base::MayBlock(), base::TaskPriority::USER_VISIBLE,
+           base::TaskShutdownBehavior::CONTINUE_ON_SHUTDOWN}),
+      std::move(file));
+  ChunkedHeapSnapshotOutputStream stream(&writer);
+  snapshot->Serialize(&stream, v8::HeapSnapshot::kJSON);
+
+  const_cast<v8::HeapSnapshot*>(snapshot)->Delete();
+
+  // The writer is destroyed after the queued chunks have been written.
+  writer.AsyncCall(&HeapSnapshotFileWriter::Close)
+      .WithArgs(stream.IsComplete())
+      .Then(std::move(callback));
+}
+
 }  // namespace electron
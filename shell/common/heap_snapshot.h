@@ -5,6 +5,8 @@
 #ifndef ELECTRON_SHELL_COMMON_HEAP_SNAPSHOT_H_
 #define ELECTRON_SHELL_COMMON_HEAP_SNAPSHOT_H_
 
+#include "base/functional/callback_forward.h"
+
 namespace base {
 class File;
 }
@@ -17,6 +19,14 @@ namespace electron {
 
 bool TakeHeapSnapshot(v8::Isolate* isolate, base::File* file);
 
+// Like TakeHeapSnapshot(), but the serialized chunks are written to |file| on
+// a background sequence and |callback| runs once they all have been. Taking
+// and serializing the snapshot still blocks the calling thread, the chunks
+// waiting for the disk are kept in memory meanwhile.
+void TakeHeapSnapshotAsync(v8::Isolate* isolate,
+                           base::File file,
+                           base::OnceCallback<void(bool success)> callback);
+
 }  // namespace electron
 
 #endif  // ELECTRON_SHELL_COMMON_HEAP_SNAPSHOT_H_
@@ -16,12 +16,16 @@
 #include "base/strings/string_number_conversions.h"
 #include "chrome/common/chrome_paths.h"
 #include "content/public/common/content_switches.h"
+#include "shell/common/async_log_sink.h"
 #include "shell/common/electron_paths.h"
 
 namespace logging {
 
 constexpr std::string_view kLogFileName{"ELECTRON_LOG_FILE"};
 constexpr std::string_view kElectronEnableLogging{"ELECTRON_ENABLE_LOGGING"};
+constexpr std::string_view kLogAsync{"log-async"};
+constexpr std::string_view kLogFormat{"log-format"};
+constexpr std::string_view kLogMaxSize{"log-max-size"};
 
 base::FilePath GetLogFileName(const base::CommandLine& command_line) {
   std::string filename = command_line.GetSwitchValueASCII(switches::kLogFile);
@@ -49,6 +53,29 @@ bool HasExplicitLogFile(const base::CommandLine& command_line) {
   return !filename.empty();
 }
 
+// The async sink is used when any of its switches is passed. It is limited to
+// the browser process, child processes keep logging synchronously.
+bool ShouldUseAsyncSink(const base::CommandLine& command_line,
+                        const std::string& process_type) {
+  return process_type.empty() && (command_line.HasSwitch(kLogAsync) ||
+                                  command_line.HasSwitch(kLogFormat) ||
+                                  command_line.HasSwitch(kLogMaxSize));
+}
+
+AsyncLogSink::Options GetAsyncSinkOptions(
+    const base::CommandLine& command_line) {
+  AsyncLogSink::Options options;
+  if (command_line.GetSwitchValueASCII(kLogFormat) == "binary")
+    options.format = AsyncLogSink::Format::kBinary;
+  int64_t max_size = 0;
+  if (base::StringToInt64(command_line.GetSwitchValueASCII(kLogMaxSize),
+                          &max_size) &&
+      max_size > 0) {
+    options.max_size = max_size;
+  }
+  return options;
+}
+
 LoggingDestination DetermineLoggingDestination(
     const base::CommandLine& command_line,
     bool is_preinit) {
@@ -140,6 +167,20 @@ void InitElectronLogging(const base::CommandLine& command_line,
       process_type.empty() && (is_preinit || !HasExplicitLogFile(command_line))
           ? DELETE_OLD_LOG_FILE
           : APPEND_TO_OLD_LOG_FILE;
+
+  // The async sink takes over the file, base/logging keeps the rest.
+  if ((logging_dest & LOG_TO_FILE) != 0 &&
+      ShouldUseAsyncSink(command_line, process_type)) {
+    settings.logging_dest = logging_dest & ~LOG_TO_FILE;
+    settings.lock_log = DONT_LOCK_LOG_FILE;
+
+    AsyncLogSink::Options options = GetAsyncSinkOptions(command_line);
+    options.path = log_path;
+    options.delete_old = settings.delete_old == DELETE_OLD_LOG_FILE;
+    options.pass_through = settings.logging_dest != LOG_NONE;
+    AsyncLogSink::Install(options);
+  }
+
   bool success = InitLogging(settings);
   if (!success) {
     PLOG(ERROR) << "Failed to init logging";
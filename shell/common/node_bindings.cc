@@ -5,6 +5,7 @@
 #include "shell/common/node_bindings.h"
 
 #include <algorithm>
+#include <optional>
 #include <string>
 #include <string_view>
 #include <utility>
@@ -14,11 +15,16 @@
 #include "base/command_line.h"
 #include "base/containers/fixed_flat_set.h"
 #include "base/environment.h"
+#include "base/feature_list.h"
+#include "base/metrics/field_trial_params.h"
 #include "base/path_service.h"
 #include "base/run_loop.h"
 #include "base/strings/string_split.h"
 #include "base/strings/utf_string_conversions.h"
 #include "base/task/single_thread_task_runner.h"
+#include "base/task/thread_pool.h"
+#include "base/threading/scoped_blocking_call.h"
+#include "base/timer/elapsed_timer.h"
 #include "base/trace_event/trace_event.h"
 #include "chrome/common/chrome_version.h"
 #include "content/public/browser/browser_thread.h"
@@ -58,6 +64,7 @@
   V(electron_browser_global_shortcut)    \
   V(electron_browser_image_view)         \
   V(electron_browser_in_app_purchase)    \
+  V(electron_browser_ipc_main)           \
   V(electron_browser_menu)               \
   V(electron_browser_message_port)       \
   V(electron_browser_native_theme)       \
@@ -90,11 +97,14 @@
   V(electron_common_environment)      \
   V(electron_common_features)         \
   V(electron_common_native_image)     \
+  V(electron_common_shared_memory)    \
   V(electron_common_shell)            \
+  V(electron_common_trace_events)     \
   V(electron_common_v8_util)
 
 #define ELECTRON_RENDERER_BINDINGS(V) \
   V(electron_renderer_web_utils)      \
+  V(electron_renderer_code_cache)     \
   V(electron_renderer_context_bridge) \
   V(electron_renderer_crash_reporter) \
   V(electron_renderer_ipc)            \
@@ -413,24 +423,78 @@ base::FilePath GetResourcesPath() {
   return exec_path.DirName().Append(FILE_PATH_LITERAL("resources"));
 #endif
 }
+
+// Runs a piece of libuv threadpool work as a base::ThreadPool task.
+void PostUvThreadpoolWork(void* work,
+                          uv_threadpool_work_kind kind,
+                          void* data) {
+  // File system calls are usually awaited right away, whereas CPU work (crypto,
+  // zlib) and slow I/O (DNS) can wait behind them.
+  base::TaskPriority priority = kind == UV_THREADPOOL_WORK_FAST_IO
+                                    ? base::TaskPriority::USER_BLOCKING
+                                    : base::TaskPriority::USER_VISIBLE;
+  base::ThreadPool::PostTask(
+      FROM_HERE,
+      {base::MayBlock(), priority,
+       base::TaskShutdownBehavior::CONTINUE_ON_SHUTDOWN},
+      base::BindOnce(
+          [](void* work, bool may_block) {
+            // Lets the pool bring up another worker while this one waits.
+            std::optional<base::ScopedBlockingCall> scoped_blocking_call;
+            if (may_block)
+              scoped_blocking_call.emplace(FROM_HERE,
+                                           base::BlockingType::MAY_BLOCK);
+            uv_threadpool_run_work(work);
+          },
+          work, kind != UV_THREADPOOL_WORK_CPU));
+}
 }  // namespace
 
+namespace features {
+
+// When enabled, the browser process dispatches uv events from its main
+// message pump on platforms that support it, rather than having a separate
+// thread poll for them and post a task to the main thread for every event.
+const base::Feature kUvLoopInMessagePump{"UvLoopInMessagePump",
+                                         base::FEATURE_DISABLED_BY_DEFAULT};
+
+// When enabled, each UvRunOnce in the browser process keeps running uv passes
+// for as long as they handle events and more work is ready right away, until
+// |budget| has been spent. It then yields back to the message loop, and runs
+// again when the next event is polled.
+const base::Feature kUvRunTimeSlicing{"UvRunTimeSlicing",
+                                      base::FEATURE_DISABLED_BY_DEFAULT};
+const base::FeatureParam<base::TimeDelta> kUvRunTimeSliceBudget{
+    &kUvRunTimeSlicing, "budget", base::Milliseconds(8)};
+
+// When enabled, the work Node.js puts on libuv's threadpool (fs, crypto, zlib,
+// DNS) is posted to base::ThreadPool instead, so that one scheduler sees all
+// background work of the process instead of two sets of threads competing for
+// the same cores.
+const base::Feature kUvThreadpoolInThreadPool{
+    "UvThreadpoolInThreadPool", base::FEATURE_DISABLED_BY_DEFAULT};
+
+}  // namespace features
+
 NodeBindings::NodeBindings(BrowserEnvironment browser_env)
     : browser_env_{browser_env},
       uv_loop_{InitEventLoop(browser_env, &worker_loop_)} {}
 
 NodeBindings::~NodeBindings() {
-  // Quit the embed thread.
-  embed_closed_ = true;
-  uv_sem_post(&embed_sem_);
+  if (!poll_in_message_pump_) {
+    // Quit the embed thread.
+    embed_closed_ = true;
+    uv_sem_post(&embed_sem_);
+
+    WakeupEmbedThread();
 
-  WakeupEmbedThread();
+    // Wait for everything to be done.
+    uv_thread_join(&embed_thread_);
 
-  // Wait for everything to be done.
-  uv_thread_join(&embed_thread_);
+    uv_sem_destroy(&embed_sem_);
+  }
 
   // Clear uv.
-  uv_sem_destroy(&embed_sem_);
   dummy_uv_handle_.reset();
 
   // Clean up worker loop
@@ -474,6 +538,10 @@ void NodeBindings::RegisterBuiltinBindings() {
 #undef V
 }
 
+void NodeBindings::RegisterMinimalBuiltinBindings() {
+  _register_electron_common_asar();
+}
+
 bool NodeBindings::IsInitialized() {
   return g_is_initialized;
 }
@@ -528,6 +596,10 @@ void NodeBindings::Initialize(v8::Local<v8::Context> context) {
   auto env = base::Environment::Create();
   SetNodeOptions(env.get());
 
+  // Has to happen before Node.js submits any threadpool work.
+  if (base::FeatureList::IsEnabled(features::kUvThreadpoolInThreadPool))
+    uv_set_threadpool_executor(&PostUvThreadpoolWork, nullptr);
+
   // Parse and set Node.js cli flags.
   std::vector<std::string> args = ParseNodeCliFlags();
   uint64_t process_flags =
@@ -594,6 +666,8 @@ std::shared_ptr<node::Environment> NodeBindings::CreateEnvironment(
       process_type = "utility";
       break;
   }
+  TRACE_EVENT1("electron", "NodeBindings::CreateEnvironment", "process_type",
+               process_type);
 
   v8::Isolate* isolate = context->GetIsolate();
   gin_helper::Dictionary global(isolate, context->Global());
@@ -790,6 +864,7 @@ std::shared_ptr<node::Environment> NodeBindings::CreateEnvironment(
 }
 
 void NodeBindings::LoadEnvironment(node::Environment* env) {
+  TRACE_EVENT0("electron", "NodeBindings::LoadEnvironment");
   node::LoadEnvironment(env, node::StartExecutionCallback{}, &OnNodePreload);
   gin_helper::EmitEvent(env->isolate(), env->process_object(), "loaded");
 }
@@ -808,6 +883,13 @@ void NodeBindings::PrepareEmbedThread() {
   // nothing to do.
   uv_async_init(uv_loop_, dummy_uv_handle_.get(), nullptr);
 
+  if (browser_env_ == BrowserEnvironment::kBrowser &&
+      base::FeatureList::IsEnabled(features::kUvLoopInMessagePump) &&
+      WatchBackendFdInMessagePump()) {
+    poll_in_message_pump_ = true;
+    return;
+  }
+
   // Start worker that will interrupt main loop when having uv events.
   uv_sem_init(&embed_sem_, 0);
   uv_thread_create(&embed_thread_, EmbedThreadRunner, this);
@@ -825,6 +907,11 @@ void NodeBindings::StartPolling() {
   // The MessageLoop should have been created, remember the one in main thread.
   task_runner_ = base::SingleThreadTaskRunner::GetCurrentDefault();
 
+  if (browser_env_ == BrowserEnvironment::kBrowser &&
+      base::FeatureList::IsEnabled(features::kUvRunTimeSlicing)) {
+    uv_run_budget_ = features::kUvRunTimeSliceBudget.Get();
+  }
+
   // Run uv loop for once to give the uv__io_poll a chance to add all events.
   UvRunOnce();
 }
@@ -886,21 +973,67 @@ void NodeBindings::UvRunOnce() {
   if (browser_env_ != BrowserEnvironment::kBrowser)
     TRACE_EVENT_BEGIN0("devtools.timeline", "FunctionCall");
 
-  // Deal with uv events.
-  int r = uv_run(uv_loop_, UV_RUN_NOWAIT);
+  // Deal with uv events. A single pass can't be interrupted, so the budget
+  // only decides whether another pass is started. Without a budget this is
+  // always one pass. Another pass is only started while uv has work that is
+  // ready right away; anything else is left to the next poll so the message
+  // loop isn't blocked spinning on an idle uv loop.
+  const base::ElapsedTimer slice_timer;
+  uv_metrics_t metrics;
+  uv_metrics_info(uv_loop_, &metrics);
+  const uint64_t events_before = metrics.events;
+  uint64_t events = events_before;
+  bool handled_events;
+  int r;
+  do {
+    r = uv_run(uv_loop_, UV_RUN_NOWAIT);
+    uv_metrics_info(uv_loop_, &metrics);
+    handled_events = metrics.events != events;
+    events = metrics.events;
+  } while (r != 0 && handled_events && uv_backend_timeout(uv_loop_) == 0 &&
+           slice_timer.Elapsed() < uv_run_budget_);
 
   if (browser_env_ != BrowserEnvironment::kBrowser)
     TRACE_EVENT_END0("devtools.timeline", "FunctionCall");
 
+  const base::TimeDelta duration = slice_timer.Elapsed();
+  TRACE_COUNTER2("electron", "NodeBindings::UvRunOnce", "duration_us",
+                 duration.InMicroseconds(), "events", events - events_before);
+  if (uv_run_callback_)
+    uv_run_callback_.Run(duration);
+
   microtask_queue->set_microtasks_policy(old_policy);
 
   if (r == 0)
     base::RunLoop().QuitWhenIdle();  // Quit from uv.
 
+  if (poll_in_message_pump_) {
+    if (r != 0)
+      ScheduleUvTimeout();
+    return;
+  }
+
   // Tell the worker thread to continue polling.
   uv_sem_post(&embed_sem_);
 }
 
+void NodeBindings::ScheduleUvTimeout() {
+  // This is the timeout the embed thread would have passed to PollEvents(),
+  // 0 when there are pending callbacks and -1 when there are no timers.
+  int timeout = uv_backend_timeout(uv_loop_);
+  if (timeout < 0) {
+    uv_timeout_timer_.Stop();
+    return;
+  }
+  uv_timeout_timer_.Start(
+      FROM_HERE, base::Milliseconds(timeout),
+      base::BindOnce(&NodeBindings::UvRunOnce, base::Unretained(this)));
+}
+
+bool NodeBindings::WatchBackendFdInMessagePump() {
+  return false;
+}
+
 void NodeBindings::WakeupMainThread() {
   DCHECK(task_runner_);
   task_runner_->PostTask(FROM_HERE, base::BindOnce(&NodeBindings::UvRunOnce,
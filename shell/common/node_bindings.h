@@ -9,6 +9,7 @@
 #include <optional>
 #include <string>
 #include <type_traits>
+#include <utility>
 #include <vector>
 
 #include "base/files/file_path.h"
@@ -16,6 +17,8 @@
 #include "base/memory/raw_ptr.h"
 #include "base/memory/raw_ptr_exclusion.h"
 #include "base/memory/weak_ptr.h"
+#include "base/time/time.h"
+#include "base/timer/timer.h"
 #include "gin/public/context_holder.h"
 #include "gin/public/gin_embedders.h"
 #include "shell/common/node_includes.h"
@@ -82,6 +85,9 @@ class NodeBindings {
 
   static NodeBindings* Create(BrowserEnvironment browser_env);
   static void RegisterBuiltinBindings();
+  // Registers only the bindings that work without base::FeatureList and
+  // base::ThreadPool, for the minimal ELECTRON_RUN_AS_NODE bootstrap.
+  static void RegisterMinimalBuiltinBindings();
   static bool IsInitialized();
 
   virtual ~NodeBindings();
@@ -134,6 +140,12 @@ class NodeBindings {
 
   [[nodiscard]] constexpr uv_loop_t* uv_loop() { return uv_loop_; }
 
+  // Called after every UvRunOnce() with the time spent running uv passes.
+  using UvRunCallback = base::RepeatingCallback<void(base::TimeDelta)>;
+  void set_uv_run_callback(UvRunCallback callback) {
+    uv_run_callback_ = std::move(callback);
+  }
+
   // disable copy
   NodeBindings(const NodeBindings&) = delete;
   NodeBindings& operator=(const NodeBindings&) = delete;
@@ -148,6 +160,14 @@ class NodeBindings {
   // Called to poll events in new thread.
   virtual void PollEvents() = 0;
 
+  // Called on the main thread to have its message pump watch uv's backend fd
+  // and call UvRunOnce() when it is readable, instead of polling it in the
+  // embed thread. Returns false if the platform can't do that.
+  virtual bool WatchBackendFdInMessagePump();
+
+  // Run the libuv loop for once.
+  void UvRunOnce();
+
   // Make the main thread run libuv loop.
   void WakeupMainThread();
 
@@ -158,8 +178,9 @@ class NodeBindings {
   static uv_loop_t* InitEventLoop(BrowserEnvironment browser_env,
                                   uv_loop_t* worker_loop);
 
-  // Run the libuv loop for once.
-  void UvRunOnce();
+  // Runs the libuv loop again when its next timer is due, which the message
+  // pump doesn't know about.
+  void ScheduleUvTimeout();
 
   [[nodiscard]] constexpr bool in_worker_loop() const {
     return browser_env_ == BrowserEnvironment::kWorker;
@@ -201,6 +222,18 @@ class NodeBindings {
   // Whether the libuv loop has ended.
   bool embed_closed_ = false;
 
+  // Whether uv events are dispatched by the main thread's message pump, in
+  // which case there is no embed thread.
+  bool poll_in_message_pump_ = false;
+
+  // Fires when the uv loop's next timer is due, see ScheduleUvTimeout().
+  base::OneShotTimer uv_timeout_timer_;
+
+  // How long UvRunOnce() may keep running uv passes that handle events.
+  base::TimeDelta uv_run_budget_;
+
+  UvRunCallback uv_run_callback_;
+
   // Dummy handle to make uv's loop not quit.
   UvHandle<uv_async_t> dummy_uv_handle_;
 
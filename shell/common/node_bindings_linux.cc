@@ -6,6 +6,8 @@
 
 #include <sys/epoll.h>
 
+#include "base/task/current_thread.h"
+
 namespace electron {
 
 NodeBindingsLinux::NodeBindingsLinux(BrowserEnvironment browser_env)
@@ -32,6 +34,21 @@ void NodeBindingsLinux::PollEvents() {
   } while (r == -1 && errno == EINTR);
 }
 
+bool NodeBindingsLinux::WatchBackendFdInMessagePump() {
+  if (!base::CurrentUIThread::IsSet())
+    return false;
+
+  // The epoll fd is readable while it has events, just like PollEvents()
+  // would return for it.
+  return base::CurrentUIThread::Get()->WatchFileDescriptor(
+      uv_backend_fd(uv_loop()), true /* persistent */,
+      base::MessagePumpForUI::WATCH_READ, &backend_fd_controller_, this);
+}
+
+void NodeBindingsLinux::OnFileCanReadWithoutBlocking(int fd) {
+  UvRunOnce();
+}
+
 // static
 NodeBindings* NodeBindings::Create(BrowserEnvironment browser_env) {
   return new NodeBindingsLinux(browser_env);
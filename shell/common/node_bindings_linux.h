@@ -6,16 +6,26 @@
 #define ELECTRON_SHELL_COMMON_NODE_BINDINGS_LINUX_H_
 
 #include "base/compiler_specific.h"
+#include "base/message_loop/message_pump_for_ui.h"
 #include "shell/common/node_bindings.h"
 
 namespace electron {
 
-class NodeBindingsLinux : public NodeBindings {
+class NodeBindingsLinux : public NodeBindings,
+                          private base::MessagePumpForUI::FdWatcher {
  public:
   explicit NodeBindingsLinux(BrowserEnvironment browser_env);
 
  private:
   void PollEvents() override;
+  bool WatchBackendFdInMessagePump() override;
+
+  // base::MessagePumpForUI::FdWatcher:
+  void OnFileCanReadWithoutBlocking(int fd) override;
+  void OnFileCanWriteWithoutBlocking(int fd) override {}
+
+  // Watches uv's backend fd when it is polled by the message pump.
+  base::MessagePumpForUI::FdWatchController backend_fd_controller_{FROM_HERE};
 
   // Epoll to poll for uv's backend fd.
   int epoll_;
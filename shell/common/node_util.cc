@@ -5,6 +5,7 @@
 #include "shell/common/node_util.h"
 
 #include "base/logging.h"
+#include "base/trace_event/trace_event.h"
 #include "gin/converter.h"
 #include "shell/common/node_includes.h"
 
@@ -15,6 +16,7 @@ v8::MaybeLocal<v8::Value> CompileAndCall(
     const char* id,
     std::vector<v8::Local<v8::String>>* parameters,
     std::vector<v8::Local<v8::Value>>* arguments) {
+  TRACE_EVENT1("electron", "CompileAndCall", "id", id);
   v8::Isolate* isolate = context->GetIsolate();
   v8::TryCatch try_catch(isolate);
 
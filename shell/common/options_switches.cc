@@ -31,6 +31,12 @@ const char kFullscreen[] = "fullscreen";
 const char kTrafficLightPosition[] = "trafficLightPosition";
 const char kRoundedCorners[] = "roundedCorners";
 
+// Whether move and resize events are emitted at most once per frame.
+const char kCoalesceBoundsEvents[] = "coalesceBoundsEvents";
+
+// Whether pages are only loaded once the window has been shown.
+const char kDeferLoadUntilShown[] = "deferLoadUntilShown";
+
 // The color to use as the theme and symbol colors respectively for Window
 // Controls Overlay if enabled on Windows.
 const char kOverlayButtonColor[] = "color";
@@ -138,9 +144,15 @@ const char kEnableBlinkFeatures[] = "enableBlinkFeatures";
 // Disable blink features.
 const char kDisableBlinkFeatures[] = "disableBlinkFeatures";
 
+// Key of the group of windows that share renderer processes.
+const char kProcessGroup[] = "processGroup";
+
 // Enable the node integration in WebWorker.
 const char kNodeIntegrationInWorker[] = "nodeIntegrationInWorker";
 
+// Create the Node.js environment of a WebWorker when it is first used.
+const char kLazyNodeIntegrationInWorker[] = "lazyNodeIntegrationInWorker";
+
 // Enable the web view tag.
 const char kWebviewTag[] = "webviewTag";
 
@@ -156,8 +168,15 @@ const char kAllowRunningInsecureContent[] = "allowRunningInsecureContent";
 
 const char kOffscreen[] = "offscreen";
 
+const char kUseSharedTexture[] = "useSharedTexture";
+
 const char kNodeIntegrationInSubFrames[] = "nodeIntegrationInSubFrames";
 
+// Give same-origin sub-frames the main frame's Node.js environment instead of
+// creating one per frame.
+const char kSharedNodeIntegrationInSubFrames[] =
+    "sharedNodeIntegrationInSubFrames";
+
 // Disable window resizing when HTML Fullscreen API is activated.
 const char kDisableHtmlFullscreenWindowResize[] =
     "disableHtmlFullscreenWindowResize";
@@ -239,9 +258,6 @@ const char kAppPath[] = "app-path";
 // The command line switch versions of the options.
 const char kScrollBounce[] = "scroll-bounce";
 
-// Command switch passed to renderer process to control nodeIntegration.
-const char kNodeIntegrationInWorker[] = "node-integration-in-worker";
-
 // Widevine options
 // Path to Widevine CDM binaries.
 const char kWidevineCdmPath[] = "widevine-cdm-path";
@@ -254,6 +270,12 @@ const char kDiskCacheSize[] = "disk-cache-size";
 // Ignore the limit of 6 connections per host.
 const char kIgnoreConnectionsLimit[] = "ignore-connections-limit";
 
+// Number of parallel range requests used for a single download.
+const char kParallelDownloadSlices[] = "parallel-download-slices";
+
+// Smallest slice, in bytes, a parallel download is split into.
+const char kParallelDownloadMinSliceSize[] = "parallel-download-min-slice-size";
+
 // Whitelist containing servers for which Integrated Authentication is enabled.
 const char kAuthServerWhitelist[] = "auth-server-whitelist";
 
@@ -58,6 +58,8 @@ extern const char kBackgroundMaterial[];
 extern const char kVisualEffectState[];
 extern const char kTrafficLightPosition[];
 extern const char kRoundedCorners[];
+extern const char kCoalesceBoundsEvents[];
+extern const char kDeferLoadUntilShown[];
 extern const char ktitleBarOverlay[];
 extern const char kOverlayButtonColor[];
 extern const char kOverlaySymbolColor[];
@@ -72,7 +74,9 @@ extern const char kExperimentalFeatures[];
 extern const char kScrollBounce[];
 extern const char kEnableBlinkFeatures[];
 extern const char kDisableBlinkFeatures[];
+extern const char kProcessGroup[];
 extern const char kNodeIntegrationInWorker[];
+extern const char kLazyNodeIntegrationInWorker[];
 extern const char kWebviewTag[];
 extern const char kCustomArgs[];
 extern const char kPlugins[];
@@ -80,7 +84,9 @@ extern const char kSandbox[];
 extern const char kWebSecurity[];
 extern const char kAllowRunningInsecureContent[];
 extern const char kOffscreen[];
+extern const char kUseSharedTexture[];
 extern const char kNodeIntegrationInSubFrames[];
+extern const char kSharedNodeIntegrationInSubFrames[];
 extern const char kDisableHtmlFullscreenWindowResize[];
 extern const char kJavaScript[];
 extern const char kImages[];
@@ -118,13 +124,14 @@ extern const char kAppUserModelId[];
 extern const char kAppPath[];
 
 extern const char kScrollBounce[];
-extern const char kNodeIntegrationInWorker[];
 
 extern const char kWidevineCdmPath[];
 extern const char kWidevineCdmVersion[];
 
 extern const char kDiskCacheSize[];
 extern const char kIgnoreConnectionsLimit[];
+extern const char kParallelDownloadSlices[];
+extern const char kParallelDownloadMinSliceSize[];
 extern const char kAuthServerWhitelist[];
 extern const char kAuthNegotiateDelegateWhitelist[];
 extern const char kEnableAuthNegotiatePort[];
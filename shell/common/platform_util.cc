@@ -7,7 +7,9 @@
 #include <utility>
 
 #include "base/functional/bind.h"
+#include "base/task/sequenced_task_runner.h"
 #include "base/task/thread_pool.h"
+#include "base/time/time.h"
 #include "content/public/browser/browser_task_traits.h"
 #include "content/public/browser/browser_thread.h"
 #include "shell/common/platform_util_internal.h"
@@ -42,4 +44,62 @@ void TrashItem(const base::FilePath& full_path,
           std::move(callback)));
 }
 
+namespace {
+
+// Progress is reported to the caller's sequence at most this often.
+constexpr base::TimeDelta kTrashItemsProgressInterval = base::Milliseconds(100);
+
+std::vector<std::string> TrashItemsOnBlockingThread(
+    const std::vector<base::FilePath>& full_paths,
+    scoped_refptr<base::SequencedTaskRunner> reply_runner,
+    TrashItemsProgressCallback progress) {
+  base::TimeTicks last_report;
+  TrashItemsProgressCallback throttled;
+  if (progress) {
+    throttled = base::BindRepeating(
+        [](base::TimeTicks* last_report,
+           base::SequencedTaskRunner* reply_runner,
+           const TrashItemsProgressCallback& progress, size_t completed) {
+          base::TimeTicks now = base::TimeTicks::Now();
+          if (now - *last_report < kTrashItemsProgressInterval)
+            return;
+          *last_report = now;
+          reply_runner->PostTask(FROM_HERE,
+                                 base::BindOnce(progress, completed));
+        },
+        base::Unretained(&last_report), base::Unretained(reply_runner.get()),
+        progress);
+  }
+  return internal::PlatformTrashItems(full_paths, throttled);
+}
+
+}  // namespace
+
+void TrashItems(std::vector<base::FilePath> full_paths,
+                TrashItemsProgressCallback progress,
+                TrashItemsCallback callback) {
+  if (full_paths.empty()) {
+    std::move(callback).Run({});
+    return;
+  }
+
+  size_t total = full_paths.size();
+  base::ThreadPool::PostTaskAndReplyWithResult(
+      FROM_HERE,
+      {base::MayBlock(), base::WithBaseSyncPrimitives(),
+       base::TaskPriority::USER_VISIBLE,
+       base::TaskShutdownBehavior::CONTINUE_ON_SHUTDOWN},
+      base::BindOnce(&TrashItemsOnBlockingThread, std::move(full_paths),
+                     base::SequencedTaskRunner::GetCurrentDefault(), progress),
+      base::BindOnce(
+          [](TrashItemsProgressCallback progress, size_t total,
+             TrashItemsCallback callback, std::vector<std::string> errors) {
+            // The last throttled report may have been dropped.
+            if (progress)
+              progress.Run(total);
+            std::move(callback).Run(std::move(errors));
+          },
+          progress, total, std::move(callback)));
+}
+
 }  // namespace platform_util
@@ -6,6 +6,7 @@
 #define ELECTRON_SHELL_COMMON_PLATFORM_UTIL_H_
 
 #include <string>
+#include <vector>
 
 #include "base/files/file_path.h"
 #include "base/functional/callback_forward.h"
@@ -17,6 +18,13 @@ namespace platform_util {
 
 typedef base::OnceCallback<void(const std::string&)> OpenCallback;
 
+// Receives one error message per path passed to TrashItems(), empty for the
+// paths that were moved to trash.
+typedef base::OnceCallback<void(std::vector<std::string>)> TrashItemsCallback;
+
+// Receives the number of paths TrashItems() has handled so far.
+typedef base::RepeatingCallback<void(size_t)> TrashItemsProgressCallback;
+
 // Show the given file in a file manager. If possible, select the file.
 // Must be called from the UI thread.
 void ShowItemInFolder(const base::FilePath& full_path);
@@ -41,6 +49,12 @@ void OpenExternal(const GURL& url,
 void TrashItem(const base::FilePath& full_path,
                base::OnceCallback<void(bool, const std::string&)> callback);
 
+// Move several files to trash in as few OS operations as possible,
+// asynchronously. |progress| may be null.
+void TrashItems(std::vector<base::FilePath> full_paths,
+                TrashItemsProgressCallback progress,
+                TrashItemsCallback callback);
+
 void Beep();
 
 #if BUILDFLAG(IS_WIN)
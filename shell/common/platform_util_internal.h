@@ -8,6 +8,7 @@
 #include "shell/common/platform_util.h"
 
 #include <string>
+#include <vector>
 
 namespace base {
 class FilePath;
@@ -19,6 +20,14 @@ namespace platform_util::internal {
 // |path| to trash using a suitable handler.
 bool PlatformTrashItem(const base::FilePath& path, std::string* error);
 
+// Like PlatformTrashItem() for several paths, batched into as few platform
+// operations as possible. Returns one error message per path, empty for the
+// paths that were moved. |progress| is run on the calling thread whenever
+// more paths have been handled.
+std::vector<std::string> PlatformTrashItems(
+    const std::vector<base::FilePath>& paths,
+    const TrashItemsProgressCallback& progress);
+
 }  // namespace platform_util::internal
 
 #endif  // ELECTRON_SHELL_COMMON_PLATFORM_UTIL_INTERNAL_H_
@@ -7,6 +7,7 @@
 #include <fcntl.h>
 
 #include <stdio.h>
+#include <algorithm>
 #include <optional>
 #include <string>
 #include <vector>
@@ -346,7 +347,10 @@ void OpenExternal(const GURL& url,
   }
 }
 
-bool MoveItemToTrash(const base::FilePath& full_path, bool delete_on_fail) {
+// Returns the command that moves |paths| to trash, all of the trash helpers
+// accept several paths at once.
+std::vector<std::string> GetTrashCommand(
+    const std::vector<base::FilePath>& paths) {
   auto env = base::Environment::Create();
 
   // find the trash method
@@ -364,18 +368,25 @@ bool MoveItemToTrash(const base::FilePath& full_path, bool delete_on_fail) {
 
   // build the invocation
   std::vector<std::string> argv;
-  const auto& filename = full_path.value();
   if (trash == "kioclient5" || trash == "kioclient") {
-    argv = {trash, "move", filename, "trash:/"};
+    argv = {trash, "move"};
   } else if (trash == "trash-cli") {
-    argv = {"trash-put", filename};
+    argv = {"trash-put"};
   } else if (trash == "gvfs-trash") {
-    argv = {"gvfs-trash", filename};  // deprecated, but still exists
+    argv = {"gvfs-trash"};  // deprecated, but still exists
   } else {
-    argv = {"gio", "trash", filename};
+    argv = {"gio", "trash"};
   }
+  for (const auto& path : paths)
+    argv.push_back(path.value());
+  if (trash == "kioclient5" || trash == "kioclient")
+    argv.emplace_back("trash:/");
+  return argv;
+}
 
-  return XDGUtil(argv, base::FilePath(), true, platform_util::OpenCallback());
+bool MoveItemToTrash(const base::FilePath& full_path, bool delete_on_fail) {
+  return XDGUtil(GetTrashCommand({full_path}), base::FilePath(), true,
+                 platform_util::OpenCallback());
 }
 
 namespace internal {
@@ -389,6 +400,45 @@ bool PlatformTrashItem(const base::FilePath& full_path, std::string* error) {
   return true;
 }
 
+std::vector<std::string> PlatformTrashItems(
+    const std::vector<base::FilePath>& paths,
+    const TrashItemsProgressCallback& progress) {
+  // Paths are handed to the trash helper in chunks, which keeps the command
+  // line short and bounds the work redone when a chunk fails: the helpers
+  // only report one exit code, so the paths of a failed chunk are retried one
+  // at a time to find out which of them could not be moved.
+  constexpr size_t kChunkSize = 64;
+  // Dangling symlinks can be trashed too.
+  auto exists = [](const base::FilePath& path) {
+    return base::PathExists(path) || base::IsLink(path);
+  };
+
+  std::vector<std::string> errors(paths.size());
+  for (size_t begin = 0; begin < paths.size(); begin += kChunkSize) {
+    size_t end = std::min(begin + kChunkSize, paths.size());
+    // Missing paths would fail the whole chunk, and they can't be told apart
+    // from the paths the chunk did move when retrying.
+    std::vector<base::FilePath> chunk;
+    for (size_t i = begin; i < end; ++i) {
+      if (exists(paths[i]))
+        chunk.push_back(paths[i]);
+      else
+        errors[i] = "Failed to move item to trash";
+    }
+    if (!chunk.empty() &&
+        !XDGUtil(GetTrashCommand(chunk), base::FilePath(), true,
+                 platform_util::OpenCallback())) {
+      for (size_t i = begin; i < end; ++i) {
+        if (errors[i].empty() && exists(paths[i]))
+          PlatformTrashItem(paths[i], &errors[i]);
+      }
+    }
+    if (progress)
+      progress.Run(end);
+  }
+  return errors;
+}
+
 }  // namespace internal
 
 void Beep() {
@@ -6,6 +6,7 @@
 
 #include <string>
 #include <utility>
+#include <vector>
 
 #import <Carbon/Carbon.h>
 #import <Cocoa/Cocoa.h>
@@ -237,6 +238,26 @@ bool PlatformTrashItem(const base::FilePath& full_path, std::string* error) {
   return MoveItemToTrashWithError(full_path, false, error);
 }
 
+std::vector<std::string> PlatformTrashItems(
+    const std::vector<base::FilePath>& paths,
+    const TrashItemsProgressCallback& progress) {
+  // -[NSWorkspace recycleURLs:completionHandler:] reports neither progress
+  // nor which items failed, so move the items one at a time. NSFileManager
+  // does this in-process, and there is no thread hop per item.
+  std::vector<std::string> errors(paths.size());
+  for (size_t i = 0; i < paths.size(); ++i) {
+    @autoreleasepool {
+      if (!MoveItemToTrashWithError(paths[i], false, &errors[i]) &&
+          errors[i].empty()) {
+        errors[i] = "Failed to move item to trash";
+      }
+    }
+    if (progress)
+      progress.Run(i + 1);
+  }
+  return errors;
+}
+
 }  // namespace internal
 
 void Beep() {
@@ -18,10 +18,12 @@
 #include <wrl/client.h>
 
 #include "base/files/file_path.h"
+#include "base/containers/flat_map.h"
 #include "base/files/file_util.h"
 #include "base/functional/bind.h"
 #include "base/functional/callback_helpers.h"
 #include "base/logging.h"
+#include "base/memory/raw_ptr.h"
 #include "base/stl_util.h"
 #include "base/strings/escape.h"
 #include "base/strings/string_util.h"
@@ -235,6 +237,67 @@ HRESULT DeleteFileProgressSink::ResumeTimer() {
   return S_OK;
 }
 
+// The file system path of |item|, as the shell reports it to progress sinks.
+std::wstring GetShellItemPath(IShellItem* item) {
+  base::win::ScopedCoMem<wchar_t> path;
+  if (FAILED(item->GetDisplayName(SIGDN_FILESYSPATH, &path)))
+    return std::wstring();
+  return std::wstring(path.get());
+}
+
+// Records the result of each item of a batched delete operation. Like
+// DeleteFileProgressSink it cancels the operation instead of deleting an item
+// that can't be recycled, in which case the items that were not reached are
+// queued again by the caller.
+class TrashItemsProgressSink : public DeleteFileProgressSink {
+ public:
+  struct State {
+    // Item path -> index into |errors| and |handled|.
+    base::flat_map<std::wstring, size_t> indices;
+    std::vector<std::string> errors;
+    std::vector<bool> handled;
+    size_t handled_count = 0;
+    platform_util::TrashItemsProgressCallback progress;
+  };
+
+  explicit TrashItemsProgressSink(State* state) : state_(state) {}
+
+ private:
+  void SetResult(IShellItem* item, std::string error) {
+    auto iter = state_->indices.find(GetShellItemPath(item));
+    if (iter == state_->indices.end() || state_->handled[iter->second])
+      return;
+    state_->errors[iter->second] = std::move(error);
+    state_->handled[iter->second] = true;
+    if (state_->progress)
+      state_->progress.Run(++state_->handled_count);
+    else
+      ++state_->handled_count;
+  }
+
+  HRESULT STDMETHODCALLTYPE PreDeleteItem(DWORD dwFlags,
+                                          IShellItem* item) override {
+    if (!(dwFlags & TSF_DELETE_RECYCLE_IF_POSSIBLE)) {
+      SetResult(item, "Failed to move item to the Recycle Bin");
+      return E_ABORT;
+    }
+    return S_OK;
+  }
+
+  HRESULT STDMETHODCALLTYPE PostDeleteItem(DWORD,
+                                           IShellItem* item,
+                                           HRESULT hr_delete,
+                                           IShellItem*) override {
+    if (SUCCEEDED(hr_delete))
+      SetResult(item, std::string());
+    else
+      SetResult(item, "Failed to perform delete operation");
+    return S_OK;
+  }
+
+  raw_ptr<State> state_;
+};
+
 std::string OpenExternalOnWorkerThread(
     const GURL& url,
     const platform_util::OpenExternalOptions& options) {
@@ -430,6 +493,73 @@ bool PlatformTrashItem(const base::FilePath& full_path, std::string* error) {
   return MoveItemToTrashWithError(full_path, false, error);
 }
 
+std::vector<std::string> PlatformTrashItems(
+    const std::vector<base::FilePath>& paths,
+    const TrashItemsProgressCallback& progress) {
+  TrashItemsProgressSink::State state;
+  state.errors.resize(paths.size());
+  state.handled.resize(paths.size());
+  state.progress = progress;
+
+  std::vector<Microsoft::WRL::ComPtr<IShellItem>> items(paths.size());
+  std::vector<std::pair<std::wstring, size_t>> indices;
+  for (size_t i = 0; i < paths.size(); ++i) {
+    if (FAILED(SHCreateItemFromParsingName(paths[i].value().c_str(), nullptr,
+                                           IID_PPV_ARGS(&items[i])))) {
+      state.errors[i] = "Failed to parse path";
+      state.handled[i] = true;
+      ++state.handled_count;
+      continue;
+    }
+    indices.emplace_back(GetShellItemPath(items[i].Get()), i);
+  }
+  state.indices = base::flat_map<std::wstring, size_t>(std::move(indices));
+
+  // All items go through one IFileOperation. It stops at the first item that
+  // can't be recycled, so the remaining items are queued again for as long as
+  // each pass makes progress.
+  std::string pass_error;
+  while (state.handled_count < paths.size()) {
+    Microsoft::WRL::ComPtr<IFileOperation> pfo;
+    if (FAILED(::CoCreateInstance(CLSID_FileOperation, nullptr, CLSCTX_ALL,
+                                  IID_PPV_ARGS(&pfo)))) {
+      pass_error = "Failed to create FileOperation instance";
+      break;
+    }
+    if (FAILED(pfo->SetOperationFlags(
+            FOF_NO_UI | FOFX_ADDUNDORECORD | FOF_NOERRORUI | FOF_SILENT |
+            FOFX_SHOWELEVATIONPROMPT | FOFX_RECYCLEONDELETE))) {
+      pass_error = "Failed to set operation flags";
+      break;
+    }
+
+    Microsoft::WRL::ComPtr<IFileOperationProgressSink> sink(
+        new TrashItemsProgressSink(&state));
+    for (size_t i = 0; i < paths.size(); ++i) {
+      if (!state.handled[i] &&
+          FAILED(pfo->DeleteItem(items[i].Get(), sink.Get()))) {
+        pass_error = "Failed to enqueue DeleteItem command";
+        break;
+      }
+    }
+    if (!pass_error.empty())
+      break;
+
+    size_t handled_before = state.handled_count;
+    pfo->PerformOperations();
+    if (state.handled_count == handled_before) {
+      pass_error = "Operation was aborted";
+      break;
+    }
+  }
+
+  for (size_t i = 0; i < paths.size(); ++i) {
+    if (!state.handled[i])
+      state.errors[i] = pass_error;
+  }
+  return std::move(state.errors);
+}
+
 }  // namespace internal
 
 bool GetFolderPath(int key, base::FilePath* result) {
@@ -4,16 +4,27 @@
 
 #include "shell/common/v8_value_serializer.h"
 
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+#include <optional>
 #include <utility>
 #include <vector>
 
+#include "base/containers/contains.h"
 #include "base/memory/raw_ptr.h"
+#include "base/strings/string_number_conversions.h"
 #include "gin/converter.h"
+#include "mojo/public/cpp/base/big_buffer.h"
+#include "mojo/public/cpp/system/platform_handle.h"
 #include "shell/common/api/electron_api_native_image.h"
+#include "shell/common/api/electron_api_shared_memory.h"
 #include "shell/common/gin_helper/microtasks_scope.h"
 #include "skia/public/mojom/bitmap.mojom.h"
 #include "third_party/blink/public/common/messaging/cloneable_message.h"
+#include "third_party/blink/public/common/messaging/transferable_message.h"
 #include "third_party/blink/public/common/messaging/web_message_port.h"
+#include "third_party/blink/public/mojom/messaging/transferable_message.mojom.h"
 #include "ui/gfx/image/image_skia.h"
 #include "v8/include/v8.h"
 
@@ -22,9 +33,113 @@ namespace electron {
 namespace {
 enum SerializationTag {
   kNativeImageTag = 'i',
+  kSharedMemoryTag = 's',
+  // Precedes the Blink envelope when the message carries SharedMemory
+  // objects, followed by their count as a little-endian uint32. Their shared
+  // memory regions are the last entries of |array_buffer_contents_array|.
+  kSharedMemoryCountTag = 'S',
   kTrailerOffsetTag = 0xFE,
   kVersionTag = 0xFF
 };
+
+// ArrayBuffers at least this large are sent out of band when serializing into
+// a TransferableMessage.
+constexpr size_t kOutOfBandArrayBufferThreshold = 256 * 1024;
+
+// How far into arrays and objects to look for large ArrayBuffers, and how
+// many values to look at in total, to bound the cost for large messages.
+constexpr int kOutOfBandArrayBufferMaxDepth = 3;
+constexpr size_t kOutOfBandArrayBufferMaxVisited = 256;
+
+class LargeArrayBufferCollector {
+ public:
+  LargeArrayBufferCollector(v8::Isolate* isolate,
+                            v8::Local<v8::Context> context)
+      : isolate_(isolate), context_(context) {}
+
+  std::vector<v8::Local<v8::ArrayBuffer>> Collect(v8::Local<v8::Value> value) {
+    Visit(value, 0);
+    return std::move(buffers_);
+  }
+
+ private:
+  void Visit(v8::Local<v8::Value> value, int depth) {
+    if (++visited_ > kOutOfBandArrayBufferMaxVisited || !value->IsObject())
+      return;
+
+    if (value->IsArrayBuffer()) {
+      Add(value.As<v8::ArrayBuffer>());
+    } else if (value->IsArrayBufferView()) {
+      v8::Local<v8::ArrayBufferView> view = value.As<v8::ArrayBufferView>();
+      // Views onto SharedArrayBuffers are serialized by V8 itself.
+      if (view->HasBuffer() && view->Buffer()->IsArrayBuffer())
+        Add(view->Buffer());
+    } else if (depth < kOutOfBandArrayBufferMaxDepth && !value->IsProxy() &&
+               (value->IsArray() || IsPlainObject(value.As<v8::Object>()))) {
+      v8::Local<v8::Object> object = value.As<v8::Object>();
+      v8::Local<v8::Array> keys;
+      if (!object
+               ->GetOwnPropertyNames(context_, v8::ONLY_ENUMERABLE,
+                                     v8::KeyConversionMode::kConvertToString)
+               .ToLocal(&keys)) {
+        return;
+      }
+      for (uint32_t i = 0; i < keys->Length(); ++i) {
+        v8::Local<v8::Value> key;
+        v8::Local<v8::Value> child;
+        if (!keys->Get(context_, i).ToLocal(&key) || !key->IsName())
+          return;
+        if (!GetOwnDataProperty(object, key.As<v8::Name>()).ToLocal(&child))
+          continue;
+        Visit(child, depth + 1);
+        if (visited_ > kOutOfBandArrayBufferMaxVisited)
+          return;
+      }
+    }
+  }
+
+  // Returns the value of the own data property |key| of |object|, or an empty
+  // handle if it is an accessor. Getters run while V8 serializes the value, so
+  // they must not run here too.
+  v8::MaybeLocal<v8::Value> GetOwnDataProperty(v8::Local<v8::Object> object,
+                                               v8::Local<v8::Name> key) {
+    v8::Local<v8::Value> descriptor;
+    if (!object->GetOwnPropertyDescriptor(context_, key).ToLocal(&descriptor) ||
+        !descriptor->IsObject()) {
+      return {};
+    }
+    v8::Local<v8::Object> fields = descriptor.As<v8::Object>();
+    v8::Local<v8::String> value_key = gin::StringToV8(isolate_, "value");
+    bool is_data_property;
+    if (!fields->HasOwnProperty(context_, value_key).To(&is_data_property) ||
+        !is_data_property) {
+      return {};
+    }
+    return fields->Get(context_, value_key);
+  }
+
+  bool IsPlainObject(v8::Local<v8::Object> object) {
+    return object->GetConstructorName()->StringEquals(
+        gin::StringToV8(isolate_, "Object"));
+  }
+
+  void Add(v8::Local<v8::ArrayBuffer> buffer) {
+    if (buffer->ByteLength() < kOutOfBandArrayBufferThreshold ||
+        buffer->GetBackingStore()->IsResizableByUserJavaScript())
+      return;
+    for (const auto& existing : buffers_) {
+      if (existing == buffer)
+        return;
+    }
+    buffers_.push_back(buffer);
+  }
+
+  raw_ptr<v8::Isolate> isolate_;
+  v8::Local<v8::Context> context_;
+  size_t visited_ = 0;
+  std::vector<v8::Local<v8::ArrayBuffer>> buffers_;
+};
+
 }  // namespace
 
 class V8Serializer : public v8::ValueSerializer::Delegate {
@@ -59,6 +174,77 @@ class V8Serializer : public v8::ValueSerializer::Delegate {
     return true;
   }
 
+  bool Serialize(v8::Local<v8::Value> value,
+                 const std::vector<v8::Local<v8::ArrayBuffer>>& transfer,
+                 blink::TransferableMessage* out) {
+    for (size_t i = 0; i < transfer.size(); ++i) {
+      const char* error = nullptr;
+      if (transfer[i]->WasDetached())
+        error = " is already detached.";
+      else if (!transfer[i]->IsDetachable())
+        error = " could not be transferred.";
+      else if (std::find(transfer.begin(), transfer.begin() + i,
+                         transfer[i]) != transfer.begin() + i)
+        error = " is a duplicate.";
+      if (error) {
+        isolate_->ThrowException(v8::Exception::Error(gin::StringToV8(
+            isolate_,
+            "ArrayBuffer at index " + base::NumberToString(i) + error)));
+        return false;
+      }
+    }
+
+    // V8 writes a reference in place of the contents of "transferred"
+    // ArrayBuffers, the contents themselves are copied into shared memory
+    // below. Large buffers that are not in |transfer| are not detached, so
+    // the sender keeps its copy.
+    shared_memory_regions_.emplace();
+    std::vector<v8::Local<v8::ArrayBuffer>> buffers = transfer;
+    for (const auto& buffer :
+         LargeArrayBufferCollector(isolate_, isolate_->GetCurrentContext())
+             .Collect(value)) {
+      if (!base::Contains(transfer, buffer))
+        buffers.push_back(buffer);
+    }
+    for (size_t i = 0; i < buffers.size(); ++i)
+      serializer_.TransferArrayBuffer(i, buffers[i]);
+
+    if (!Serialize(value, static_cast<blink::CloneableMessage*>(out)))
+      return false;
+
+    for (const auto& buffer : buffers) {
+      auto contents = blink::mojom::SerializedArrayBufferContents::New();
+      contents->contents = mojo_base::BigBuffer(base::make_span(
+          static_cast<const uint8_t*>(buffer->Data()), buffer->ByteLength()));
+      out->array_buffer_contents_array.push_back(std::move(contents));
+    }
+
+    if (!shared_memory_regions_->empty()) {
+      // The regions are sent as they are, so the receiver maps the same
+      // memory instead of a copy.
+      for (auto& region : *shared_memory_regions_) {
+        const size_t size = region.GetSize();
+        auto contents = blink::mojom::SerializedArrayBufferContents::New();
+        contents->contents = mojo_base::BigBuffer(
+            mojo_base::internal::BigBufferSharedMemoryRegion(
+                mojo::WrapUnsafeSharedMemoryRegion(std::move(region)), size));
+        out->array_buffer_contents_array.push_back(std::move(contents));
+      }
+      const uint32_t count = shared_memory_regions_->size();
+      uint8_t prefix[1 + sizeof(count)] = {kSharedMemoryCountTag};
+      std::memcpy(prefix + 1, &count, sizeof(count));
+      out->owned_encoded_message.insert(out->owned_encoded_message.begin(),
+                                        std::begin(prefix), std::end(prefix));
+      out->encoded_message = out->owned_encoded_message;
+    }
+
+    for (const auto& buffer : transfer) {
+      if (buffer->Detach(v8::Local<v8::Value>()).IsNothing())
+        return false;
+    }
+    return true;
+  }
+
   // v8::ValueSerializer::Delegate
   void* ReallocateBufferMemory(void* old_buffer,
                                size_t size,
@@ -92,9 +278,29 @@ class V8Serializer : public v8::ValueSerializer::Delegate {
         serializer_.WriteRawBytes(bytes.data(), bytes.size());
       }
       return v8::Just(true);
-    } else {
-      return v8::ValueSerializer::Delegate::WriteHostObject(isolate, object);
     }
+
+    api::SharedMemory* shared_memory;
+    if (gin::ConvertFromV8(isolate, object, &shared_memory)) {
+      if (!shared_memory_regions_) {
+        ThrowDataCloneError(gin::StringToV8(
+            isolate, "SharedMemory can only be sent with postMessage()."));
+        return v8::Nothing<bool>();
+      }
+      base::UnsafeSharedMemoryRegion region =
+          shared_memory->region().Duplicate();
+      if (!region.IsValid()) {
+        ThrowDataCloneError(
+            gin::StringToV8(isolate, "SharedMemory could not be cloned."));
+        return v8::Nothing<bool>();
+      }
+      WriteTag(kSharedMemoryTag);
+      serializer_.WriteUint32(shared_memory_regions_->size());
+      shared_memory_regions_->push_back(std::move(region));
+      return v8::Just(true);
+    }
+
+    return v8::ValueSerializer::Delegate::WriteHostObject(isolate, object);
   }
 
   void ThrowDataCloneError(v8::Local<v8::String> message) override {
@@ -112,6 +318,10 @@ class V8Serializer : public v8::ValueSerializer::Delegate {
   }
 
   raw_ptr<v8::Isolate> isolate_;
+  // Duplicates of the regions of the SharedMemory objects in the value. Only
+  // set when serializing into a TransferableMessage, which can carry them.
+  std::optional<std::vector<base::UnsafeSharedMemoryRegion>>
+      shared_memory_regions_;
   std::vector<uint8_t> data_;
   v8::ValueSerializer serializer_;
 };
@@ -123,6 +333,15 @@ class V8Deserializer : public v8::ValueDeserializer::Delegate {
         deserializer_(isolate, data.data(), data.size(), this) {}
   V8Deserializer(v8::Isolate* isolate, const blink::CloneableMessage& message)
       : V8Deserializer(isolate, message.encoded_message) {}
+  V8Deserializer(v8::Isolate* isolate,
+                 const blink::TransferableMessage& message)
+      : V8Deserializer(isolate, message.encoded_message) {
+    array_buffer_contents_ = &message.array_buffer_contents_array;
+  }
+  V8Deserializer(v8::Isolate* isolate, blink::TransferableMessage* message)
+      : V8Deserializer(isolate, *message) {
+    shared_memory_contents_ = &message->array_buffer_contents_array;
+  }
 
   v8::Local<v8::Value> Deserialize() {
     v8::EscapableHandleScope scope(isolate_);
@@ -132,6 +351,23 @@ class V8Deserializer : public v8::ValueDeserializer::Delegate {
     if (!ReadBlinkEnvelope(&blink_version))
       return v8::Null(isolate_);
 
+    if (array_buffer_contents_) {
+      if (shared_memory_count_ > array_buffer_contents_->size())
+        return v8::Null(isolate_);
+      // The SharedMemory regions at the end are picked up by ReadHostObject.
+      const size_t array_buffer_count =
+          array_buffer_contents_->size() - shared_memory_count_;
+      for (size_t i = 0; i < array_buffer_count; ++i) {
+        const mojo_base::BigBuffer& contents =
+            (*array_buffer_contents_)[i]->contents;
+        v8::Local<v8::ArrayBuffer> buffer =
+            v8::ArrayBuffer::New(isolate_, contents.size());
+        std::copy(contents.data(), contents.data() + contents.size(),
+                  static_cast<uint8_t*>(buffer->Data()));
+        deserializer_.TransferArrayBuffer(i, buffer);
+      }
+    }
+
     bool read_header;
     if (!deserializer_.ReadHeader(context).To(&read_header))
       return v8::Null(isolate_);
@@ -151,6 +387,10 @@ class V8Deserializer : public v8::ValueDeserializer::Delegate {
         if (api::NativeImage* native_image = ReadNativeImage(isolate))
           return native_image->GetWrapper(isolate);
         break;
+      case kSharedMemoryTag:
+        if (api::SharedMemory* shared_memory = ReadSharedMemory(isolate))
+          return shared_memory->GetWrapper(isolate);
+        break;
     }
     // Throws an exception.
     return v8::ValueDeserializer::Delegate::ReadHostObject(isolate);
@@ -169,7 +409,19 @@ class V8Deserializer : public v8::ValueDeserializer::Delegate {
     // Read a dummy blink version envelope for compatibility with
     // blink::V8ScriptValueDeserializer
     uint8_t tag = 0;
-    if (!ReadTag(&tag) || tag != kVersionTag)
+    if (!ReadTag(&tag))
+      return false;
+    if (tag == kSharedMemoryCountTag) {
+      const void* count_bytes = nullptr;
+      if (!deserializer_.ReadRawBytes(sizeof(shared_memory_count_),
+                                      &count_bytes))
+        return false;
+      std::memcpy(&shared_memory_count_, count_bytes,
+                  sizeof(shared_memory_count_));
+      if (!ReadTag(&tag))
+        return false;
+    }
+    if (tag != kVersionTag)
       return false;
     if (!deserializer_.ReadUint32(blink_version))
       return false;
@@ -218,8 +470,36 @@ class V8Deserializer : public v8::ValueDeserializer::Delegate {
     return new api::NativeImage(isolate, image);
   }
 
+  api::SharedMemory* ReadSharedMemory(v8::Isolate* isolate) {
+    uint32_t index = 0;
+    if (!shared_memory_contents_ || !deserializer_.ReadUint32(&index) ||
+        index >= shared_memory_count_)
+      return nullptr;
+    mojo_base::BigBuffer& contents =
+        (*shared_memory_contents_)[shared_memory_contents_->size() -
+                                   shared_memory_count_ + index]
+            ->contents;
+    if (contents.storage_type() !=
+        mojo_base::BigBuffer::StorageType::kSharedMemory)
+      return nullptr;
+    base::UnsafeSharedMemoryRegion region =
+        mojo::UnwrapUnsafeSharedMemoryRegion(
+            contents.shared_memory().TakeBufferHandle());
+    if (!region.IsValid())
+      return nullptr;
+    return api::SharedMemory::Create(isolate, std::move(region)).get();
+  }
+
   raw_ptr<v8::Isolate> isolate_;
   v8::ValueDeserializer deserializer_;
+  // The out-of-band contents of a TransferableMessage, if that is what is
+  // being deserialized. SharedMemory objects can only be read when the message
+  // is not const, since they take their regions from it.
+  raw_ptr<const std::vector<blink::mojom::SerializedArrayBufferContentsPtr>>
+      array_buffer_contents_ = nullptr;
+  raw_ptr<std::vector<blink::mojom::SerializedArrayBufferContentsPtr>>
+      shared_memory_contents_ = nullptr;
+  uint32_t shared_memory_count_ = 0;
 };
 
 bool SerializeV8Value(v8::Isolate* isolate,
@@ -233,6 +513,29 @@ v8::Local<v8::Value> DeserializeV8Value(v8::Isolate* isolate,
   return V8Deserializer(isolate, in).Deserialize();
 }
 
+bool SerializeV8Value(v8::Isolate* isolate,
+                      v8::Local<v8::Value> value,
+                      blink::TransferableMessage* out) {
+  return V8Serializer(isolate).Serialize(value, {}, out);
+}
+
+bool SerializeV8Value(v8::Isolate* isolate,
+                      v8::Local<v8::Value> value,
+                      const std::vector<v8::Local<v8::ArrayBuffer>>& transfer,
+                      blink::TransferableMessage* out) {
+  return V8Serializer(isolate).Serialize(value, transfer, out);
+}
+
+v8::Local<v8::Value> DeserializeV8Value(v8::Isolate* isolate,
+                                        const blink::TransferableMessage& in) {
+  return V8Deserializer(isolate, in).Deserialize();
+}
+
+v8::Local<v8::Value> DeserializeV8Value(v8::Isolate* isolate,
+                                        blink::TransferableMessage* in) {
+  return V8Deserializer(isolate, in).Deserialize();
+}
+
 v8::Local<v8::Value> DeserializeV8Value(v8::Isolate* isolate,
                                         base::span<const uint8_t> data) {
   return V8Deserializer(isolate, data).Deserialize();
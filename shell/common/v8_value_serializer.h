@@ -5,10 +5,13 @@
 #ifndef ELECTRON_SHELL_COMMON_V8_VALUE_SERIALIZER_H_
 #define ELECTRON_SHELL_COMMON_V8_VALUE_SERIALIZER_H_
 
+#include <vector>
+
 #include "base/containers/span.h"
 #include "ui/gfx/image/image_skia_rep.h"
 
 namespace v8 {
+class ArrayBuffer;
 class Isolate;
 template <class T>
 class Local;
@@ -17,7 +20,8 @@ class Value;
 
 namespace blink {
 struct CloneableMessage;
-}
+struct TransferableMessage;
+}  // namespace blink
 
 namespace electron {
 
@@ -26,6 +30,31 @@ bool SerializeV8Value(v8::Isolate* isolate,
                       blink::CloneableMessage* out);
 v8::Local<v8::Value> DeserializeV8Value(v8::Isolate* isolate,
                                         const blink::CloneableMessage& in);
+
+// Same as above, but the contents of large ArrayBuffers in |value|, either
+// the value itself or in arrays and objects a few levels down, are put in
+// |out->array_buffer_contents_array| instead of the encoded message. Those
+// are sent as shared memory, which avoids copying them through the
+// serializer's buffer and the message. SharedMemory objects can only be sent
+// this way, their regions are appended to the same array.
+bool SerializeV8Value(v8::Isolate* isolate,
+                      v8::Local<v8::Value> value,
+                      blink::TransferableMessage* out);
+
+// Same as above, but |transfer| lists ArrayBuffers whose ownership moves to
+// the receiver: their contents are always sent as shared memory, whatever
+// their size, and they are detached in the sender once |value| has been
+// serialized. Throws and returns false if one of them can't be transferred.
+bool SerializeV8Value(v8::Isolate* isolate,
+                      v8::Local<v8::Value> value,
+                      const std::vector<v8::Local<v8::ArrayBuffer>>& transfer,
+                      blink::TransferableMessage* out);
+v8::Local<v8::Value> DeserializeV8Value(v8::Isolate* isolate,
+                                        const blink::TransferableMessage& in);
+// Same as above, and also reads SharedMemory objects, which take ownership of
+// the shared memory regions carried by |in|.
+v8::Local<v8::Value> DeserializeV8Value(v8::Isolate* isolate,
+                                        blink::TransferableMessage* in);
 v8::Local<v8::Value> DeserializeV8Value(v8::Isolate* isolate,
                                         base::span<const uint8_t> data);
 
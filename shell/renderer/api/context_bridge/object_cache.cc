@@ -4,12 +4,70 @@
 
 #include "shell/renderer/api/context_bridge/object_cache.h"
 
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <utility>
+
+#include "base/no_destructor.h"
+#include "base/threading/thread_local.h"
 #include "shell/common/api/object_life_monitor.h"
 
 namespace electron::api::context_bridge {
 
-ObjectCache::ObjectCache() = default;
-ObjectCache::~ObjectCache() = default;
+namespace {
+
+constexpr size_t kInitialCapacity = 16;
+
+// Tables that grew beyond this many slots are freed instead of pooled.
+constexpr size_t kMaxPooledCapacity = 16 * 1024;
+
+// Bridged calls nest (a proxied function can call back over the bridge), so
+// each level of nesting keeps its own table in the pool.
+constexpr size_t kMaxPooledTables = 8;
+
+using EntryStorage = std::vector<ObjectCache::Entry>;
+
+std::vector<EntryStorage>& GetStoragePool() {
+  static base::NoDestructor<base::ThreadLocalOwnedPointer<
+      std::vector<EntryStorage>>>
+      lazy_tls;
+  std::vector<EntryStorage>* pool = lazy_tls->Get();
+  if (!pool) {
+    auto new_pool = std::make_unique<std::vector<EntryStorage>>();
+    pool = new_pool.get();
+    lazy_tls->Set(std::move(new_pool));
+  }
+  return *pool;
+}
+
+size_t GetSlotIndex(int hash, size_t capacity) {
+  // Identity hashes are random, but spread them over the whole table anyway
+  // so that sequential ones don't cluster.
+  return (static_cast<uint32_t>(hash) * 0x9E3779B1u) & (capacity - 1);
+}
+
+}  // namespace
+
+ObjectCache::ObjectCache() {
+  std::vector<EntryStorage>& pool = GetStoragePool();
+  if (!pool.empty()) {
+    entries_ = std::move(pool.back());
+    pool.pop_back();
+  }
+}
+
+ObjectCache::~ObjectCache() {
+  if (entries_.empty() || entries_.size() > kMaxPooledCapacity)
+    return;
+  std::vector<EntryStorage>& pool = GetStoragePool();
+  if (pool.size() >= kMaxPooledTables)
+    return;
+  // Drop the handles, they are only valid in the HandleScope of this call.
+  if (size_)
+    std::fill(entries_.begin(), entries_.end(), Entry{});
+  pool.push_back(std::move(entries_));
+}
 
 void ObjectCache::CacheProxiedObject(v8::Local<v8::Value> from,
                                      v8::Local<v8::Value> proxy_value) {
@@ -17,31 +75,53 @@ void ObjectCache::CacheProxiedObject(v8::Local<v8::Value> from,
     auto obj = from.As<v8::Object>();
     int hash = obj->GetIdentityHash();
 
-    proxy_map_[hash].emplace_front(from, proxy_value);
+    // Keep the load factor at or below one half.
+    if ((size_ + 1) * 2 > entries_.size())
+      Grow();
+
+    Entry& entry = entries_[FindSlot(hash, from)];
+    if (entry.from.IsEmpty()) {
+      entry.hash = hash;
+      entry.from = from;
+      ++size_;
+    }
+    entry.proxy_value = proxy_value;
   }
 }
 
 v8::MaybeLocal<v8::Value> ObjectCache::GetCachedProxiedObject(
     v8::Local<v8::Value> from) const {
-  if (!from->IsObject() || from->IsNullOrUndefined())
+  if (size_ == 0 || !from->IsObject() || from->IsNullOrUndefined())
     return v8::MaybeLocal<v8::Value>();
 
   auto obj = from.As<v8::Object>();
   int hash = obj->GetIdentityHash();
-  auto iter = proxy_map_.find(hash);
-  if (iter == proxy_map_.end())
+  const Entry& entry = entries_[FindSlot(hash, from)];
+  if (entry.from.IsEmpty() || entry.proxy_value.IsEmpty())
     return v8::MaybeLocal<v8::Value>();
+  return entry.proxy_value;
+}
 
-  auto& list = iter->second;
-  for (const auto& pair : list) {
-    auto from_cmp = pair.first;
-    if (from_cmp == from) {
-      if (pair.second.IsEmpty())
-        return v8::MaybeLocal<v8::Value>();
-      return pair.second;
-    }
+size_t ObjectCache::FindSlot(int hash, v8::Local<v8::Value> from) const {
+  const size_t mask = entries_.size() - 1;
+  size_t index = GetSlotIndex(hash, entries_.size());
+  while (true) {
+    const Entry& entry = entries_[index];
+    if (entry.from.IsEmpty() || (entry.hash == hash && entry.from == from))
+      return index;
+    index = (index + 1) & mask;
+  }
+}
+
+void ObjectCache::Grow() {
+  const size_t capacity =
+      entries_.empty() ? kInitialCapacity : entries_.size() * 2;
+  EntryStorage old_entries = std::move(entries_);
+  entries_.assign(capacity, Entry{});
+  for (const Entry& entry : old_entries) {
+    if (!entry.from.IsEmpty())
+      entries_[FindSlot(entry.hash, entry.from)] = entry;
   }
-  return v8::MaybeLocal<v8::Value>();
 }
 
 }  // namespace electron::api::context_bridge
@@ -5,9 +5,8 @@
 #ifndef ELECTRON_SHELL_RENDERER_API_CONTEXT_BRIDGE_OBJECT_CACHE_H_
 #define ELECTRON_SHELL_RENDERER_API_CONTEXT_BRIDGE_OBJECT_CACHE_H_
 
-#include <forward_list>
-#include <unordered_map>
-#include <utility>
+#include <cstddef>
+#include <vector>
 
 #include "base/containers/linked_list.h"
 #include "content/public/renderer/render_frame.h"
@@ -17,21 +16,37 @@
 
 namespace electron::api::context_bridge {
 
-using ObjectCachePair = std::pair<v8::Local<v8::Value>, v8::Local<v8::Value>>;
-
 class ObjectCache final {
  public:
   ObjectCache();
   ~ObjectCache();
 
+  // disable copy
+  ObjectCache(const ObjectCache&) = delete;
+  ObjectCache& operator=(const ObjectCache&) = delete;
+
   void CacheProxiedObject(v8::Local<v8::Value> from,
                           v8::Local<v8::Value> proxy_value);
   v8::MaybeLocal<v8::Value> GetCachedProxiedObject(
       v8::Local<v8::Value> from) const;
 
+  struct Entry {
+    int hash = 0;
+    v8::Local<v8::Value> from;
+    v8::Local<v8::Value> proxy_value;
+  };
+
  private:
-  // object_identity ==> [from_value, proxy_value]
-  std::unordered_map<int, std::forward_list<ObjectCachePair>> proxy_map_;
+  // Returns the slot holding |from|, or the empty slot where it would go.
+  size_t FindSlot(int hash, v8::Local<v8::Value> from) const;
+  void Grow();
+
+  // Open-addressed table with linear probing, the capacity is always zero or
+  // a power of two. Slots with an empty |from| are unused. The storage is
+  // taken from, and given back to, a per-thread pool so that bridged calls
+  // don't allocate a new table every time.
+  std::vector<Entry> entries_;
+  size_t size_ = 0;
 };
 
 }  // namespace electron::api::context_bridge
@@ -0,0 +1,134 @@
+// Copyright (c) 2024 Microsoft, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#include <cstring>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "base/containers/lru_cache.h"
+#include "base/containers/span.h"
+#include "base/hash/hash.h"
+#include "base/no_destructor.h"
+#include "base/synchronization/lock.h"
+#include "base/thread_annotations.h"
+#include "gin/arguments.h"
+#include "shell/common/gin_helper/dictionary.h"
+#include "shell/common/node_includes.h"
+#include "v8/include/v8-array-buffer.h"
+
+namespace {
+
+// Bytes of code cache kept for the whole renderer process.
+constexpr size_t kMaxCodeCacheSize = 64 * 1024 * 1024;
+
+using CodeCacheData = std::shared_ptr<const std::vector<uint8_t>>;
+
+// The V8 code cache of the modules loaded by the Node.js environments of a
+// renderer process. Workers each have their own isolate, so the code they
+// compile can only be shared with the other workers as a code cache.
+class CodeCacheStore {
+ public:
+  static CodeCacheStore* Get() {
+    static base::NoDestructor<CodeCacheStore> store;
+    return store.get();
+  }
+
+  CodeCacheStore() = default;
+
+  // disable copy
+  CodeCacheStore(const CodeCacheStore&) = delete;
+  CodeCacheStore& operator=(const CodeCacheStore&) = delete;
+
+  CodeCacheData Find(const std::string& filename, size_t source_hash) {
+    base::AutoLock auto_lock(lock_);
+    auto it = entries_.Get(filename);
+    if (it == entries_.end())
+      return nullptr;
+    // The file has changed since it was cached.
+    if (it->second.source_hash != source_hash) {
+      size_ -= it->second.data->size();
+      entries_.Erase(it);
+      return nullptr;
+    }
+    return it->second.data;
+  }
+
+  void Store(const std::string& filename,
+             size_t source_hash,
+             std::vector<uint8_t> data) {
+    if (data.empty() || data.size() > kMaxCodeCacheSize)
+      return;
+    base::AutoLock auto_lock(lock_);
+    if (auto it = entries_.Peek(filename); it != entries_.end())
+      size_ -= it->second.data->size();
+    size_ += data.size();
+    auto shared_data =
+        std::make_shared<const std::vector<uint8_t>>(std::move(data));
+    entries_.Put(filename, Entry{source_hash, std::move(shared_data)});
+    while (size_ > kMaxCodeCacheSize) {
+      auto oldest = entries_.rbegin();
+      size_ -= oldest->second.data->size();
+      entries_.Erase(oldest);
+    }
+  }
+
+ private:
+  struct Entry {
+    size_t source_hash;
+    CodeCacheData data;
+  };
+
+  base::Lock lock_;
+  base::LRUCache<std::string, Entry> entries_ GUARDED_BY(lock_){
+      base::LRUCache<std::string, Entry>::NO_AUTO_EVICT};
+  size_t size_ GUARDED_BY(lock_) = 0;
+};
+
+size_t HashSource(const std::u16string& source) {
+  return base::FastHash(base::as_byte_span(source));
+}
+
+// Returns a copy of the code cache of |filename| when it was created from
+// the same |source|, undefined otherwise.
+v8::Local<v8::Value> GetCodeCache(v8::Isolate* isolate,
+                                  const std::string& filename,
+                                  const std::u16string& source) {
+  CodeCacheData data =
+      CodeCacheStore::Get()->Find(filename, HashSource(source));
+  if (!data)
+    return v8::Undefined(isolate);
+  // V8 consumes the cache from a view, the store keeps its own copy.
+  auto buffer = v8::ArrayBuffer::New(isolate, data->size());
+  memcpy(buffer->Data(), data->data(), data->size());
+  return v8::Uint8Array::New(buffer, 0, data->size());
+}
+
+void SetCodeCache(gin::Arguments* args,
+                  const std::string& filename,
+                  const std::u16string& source,
+                  v8::Local<v8::Value> cache) {
+  if (!cache->IsArrayBufferView()) {
+    args->ThrowTypeError("cache must be an ArrayBufferView");
+    return;
+  }
+  auto view = cache.As<v8::ArrayBufferView>();
+  std::vector<uint8_t> data(view->ByteLength());
+  view->CopyContents(data.data(), data.size());
+  CodeCacheStore::Get()->Store(filename, HashSource(source), std::move(data));
+}
+
+void Initialize(v8::Local<v8::Object> exports,
+                v8::Local<v8::Value> unused,
+                v8::Local<v8::Context> context,
+                void* priv) {
+  gin_helper::Dictionary dict(context->GetIsolate(), exports);
+  dict.SetMethod("get", &GetCodeCache);
+  dict.SetMethod("set", &SetCodeCache);
+}
+
+}  // namespace
+
+NODE_LINKED_BINDING_CONTEXT_AWARE(electron_renderer_code_cache, Initialize)
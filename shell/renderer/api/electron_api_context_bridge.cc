@@ -12,7 +12,9 @@
 #include <vector>
 
 #include "base/containers/contains.h"
+#include "base/containers/lru_cache.h"
 #include "base/feature_list.h"
+#include "base/memory/raw_ptr.h"
 #include "base/no_destructor.h"
 #include "base/trace_event/trace_event.h"
 #include "content/public/renderer/render_frame.h"
@@ -32,6 +34,16 @@ namespace features {
 
 const base::Feature kContextBridgeMutability{"ContextBridgeMutability",
                                              base::FEATURE_DISABLED_BY_DEFAULT};
+
+// When enabled, ArrayBuffers and their views are not copied when they cross
+// the context bridge. The other context gets an object over the same memory.
+const base::Feature kContextBridgeShareArrayBuffers{
+    "ContextBridgeShareArrayBuffers", base::FEATURE_DISABLED_BY_DEFAULT};
+
+// When enabled, nested objects and arrays on a proxied object are only passed
+// over the bridge when the other context first reads them.
+const base::Feature kContextBridgeLazyProxies{
+    "ContextBridgeLazyProxies", base::FEATURE_DISABLED_BY_DEFAULT};
 }
 
 namespace electron {
@@ -48,6 +60,10 @@ const char kProxyFunctionReceiverPrivateKey[] =
 const char kSupportsDynamicPropertiesPrivateKey[] =
     "electron_contextBridge_supportsDynamicProperties";
 const char kOriginalFunctionPrivateKey[] = "electron_contextBridge_original_fn";
+const char kLazyProxyValuePrivateKey[] = "electron_contextBridge_lazy_value";
+const char kLazyProxyParentPrivateKey[] = "electron_contextBridge_lazy_parent";
+const char kHasFrozenLazyPropertiesPrivateKey[] =
+    "electron_contextBridge_hasFrozenLazyProperties";
 
 }  // namespace context_bridge
 
@@ -60,31 +76,117 @@ inline bool IsTrue(v8::Maybe<bool> maybe) {
   return maybe.IsJust() && maybe.FromJust();
 }
 
+void SetPrivate(v8::Local<v8::Context> context,
+                v8::Local<v8::Object> target,
+                const std::string& key,
+                v8::Local<v8::Value> value);
+
 // Sourced from "extensions/renderer/v8_schema_registry.cc"
 // Recursively freezes every v8 object on |object|.
 bool DeepFreeze(const v8::Local<v8::Object>& object,
                 const v8::Local<v8::Context>& context,
-                std::set<int> frozen = std::set<int>()) {
+                std::set<int>& frozen) {
   int hash = object->GetIdentityHash();
   if (base::Contains(frozen, hash))
     return true;
   frozen.insert(hash);
 
+  bool has_lazy_properties = false;
   v8::Local<v8::Array> property_names =
       object->GetOwnPropertyNames(context).ToLocalChecked();
   for (uint32_t i = 0; i < property_names->Length(); ++i) {
-    v8::Local<v8::Value> child =
-        object->Get(context, property_names->Get(context, i).ToLocalChecked())
-            .ToLocalChecked();
+    v8::Local<v8::Value> key =
+        property_names->Get(context, i).ToLocalChecked();
+    // Reading a lazy property would pass its value over the bridge, it is
+    // frozen by LazyProxyGetter once it's read instead.
+    if (key->IsName() &&
+        IsTrue(object->HasRealNamedCallbackProperty(context,
+                                                    key.As<v8::Name>()))) {
+      has_lazy_properties = true;
+      continue;
+    }
+    v8::Local<v8::Value> child = object->Get(context, key).ToLocalChecked();
     if (child->IsObject() && !child->IsTypedArray()) {
       if (!DeepFreeze(child.As<v8::Object>(), context, frozen))
         return false;
     }
   }
+  if (has_lazy_properties) {
+    SetPrivate(context, object,
+               context_bridge::kHasFrozenLazyPropertiesPrivateKey,
+               v8::True(context->GetIsolate()));
+  }
   return IsTrue(
       object->SetIntegrityLevel(context, v8::IntegrityLevel::kFrozen));
 }
 
+bool DeepFreeze(const v8::Local<v8::Object>& object,
+                const v8::Local<v8::Context>& context) {
+  std::set<int> frozen;
+  return DeepFreeze(object, context, frozen);
+}
+
+// Objects with fewer properties than this are built property by property,
+// a template doesn't pay off for them.
+constexpr uint32_t kMinTemplatedProxyProperties = 8;
+constexpr size_t kMaxCachedProxyTemplates = 64;
+
+// The same API object shape tends to be sent over the bridge many times,
+// e.g. when a preload exposes its API into every frame or world, or a
+// function keeps returning objects with the same keys. Proxies for such
+// objects are instantiated from an ObjectTemplate that already has all the
+// keys, so V8 can create them with their final shape (and copy a cached
+// instance for later proxies in the same context) instead of transitioning
+// through a new map for every property that's added.
+class ProxyTemplateCache {
+ public:
+  // Returns an ObjectTemplate that has |keys|, in order, as data properties.
+  // Returns an empty handle if |keys| aren't all strings.
+  static v8::Local<v8::ObjectTemplate> Get(v8::Isolate* isolate,
+                                           v8::Local<v8::Context> context,
+                                           v8::Local<v8::Array> keys) {
+    static base::NoDestructor<ProxyTemplateCache> cache;
+    // The context bridge only runs on the main thread of the renderer, which
+    // has a single isolate.
+    if (cache->isolate_ != isolate) {
+      cache->templates_.Clear();
+      cache->isolate_ = isolate;
+    }
+
+    std::string shape;
+    const uint32_t length = keys->Length();
+    for (uint32_t i = 0; i < length; i++) {
+      v8::Local<v8::Value> key;
+      if (!keys->Get(context, i).ToLocal(&key) || !key->IsString())
+        return {};
+      shape.append(gin::V8ToString(isolate, key));
+      shape.push_back('\0');
+    }
+
+    auto iter = cache->templates_.Get(shape);
+    if (iter != cache->templates_.end())
+      return iter->second.Get(isolate);
+
+    v8::Local<v8::ObjectTemplate> object_template =
+        v8::ObjectTemplate::New(isolate);
+    for (uint32_t i = 0; i < length; i++) {
+      object_template->Set(
+          keys->Get(context, i).ToLocalChecked().As<v8::Name>(),
+          v8::Undefined(isolate));
+    }
+    cache->templates_.Put(
+        std::move(shape),
+        v8::Global<v8::ObjectTemplate>(isolate, object_template));
+    return object_template;
+  }
+
+  ProxyTemplateCache() : templates_(kMaxCachedProxyTemplates) {}
+
+ private:
+  raw_ptr<v8::Isolate> isolate_ = nullptr;
+  base::LRUCache<std::string, v8::Global<v8::ObjectTemplate>> templates_;
+};
+
 bool IsPlainObject(const v8::Local<v8::Value>& object) {
   if (!object->IsObject())
     return false;
@@ -133,6 +235,140 @@ v8::MaybeLocal<v8::Value> GetPrivate(v8::Local<v8::Context> context,
                           gin::StringToV8(context->GetIsolate(), key)));
 }
 
+// Both contexts live in the same isolate, so an ArrayBuffer can be handed to
+// the destination context as a new ArrayBuffer object over the same backing
+// store. Returns an empty handle for values that must be copied instead.
+v8::MaybeLocal<v8::Value> ShareArrayBufferWithContext(
+    v8::Local<v8::Context> destination_context,
+    v8::Local<v8::Value> value,
+    context_bridge::ObjectCache* object_cache) {
+  v8::Isolate* isolate = destination_context->GetIsolate();
+  v8::Context::Scope destination_context_scope(destination_context);
+
+  // SharedArrayBuffers keep being cloned by the serializer, and resizable or
+  // non-detachable (e.g. WebAssembly memory) buffers can have their memory
+  // replaced under an alias, so they are copied too.
+  auto share_buffer = [&](v8::Local<v8::ArrayBuffer> buffer,
+                          v8::Local<v8::ArrayBuffer>* out) {
+    if (buffer->IsSharedArrayBuffer() || !buffer->IsDetachable() ||
+        buffer->GetBackingStore()->IsResizableByUserJavaScript())
+      return false;
+    v8::Local<v8::Value> cached;
+    if (object_cache->GetCachedProxiedObject(buffer).ToLocal(&cached)) {
+      *out = cached.As<v8::ArrayBuffer>();
+      return true;
+    }
+    *out = v8::ArrayBuffer::New(isolate, buffer->GetBackingStore());
+    object_cache->CacheProxiedObject(buffer, *out);
+    return true;
+  };
+
+  v8::Local<v8::ArrayBuffer> buffer;
+  if (value->IsArrayBuffer()) {
+    if (!share_buffer(value.As<v8::ArrayBuffer>(), &buffer))
+      return {};
+    return v8::MaybeLocal<v8::Value>(buffer);
+  }
+
+  if (!value->IsArrayBufferView())
+    return {};
+
+  auto view = value.As<v8::ArrayBufferView>();
+  if (!share_buffer(view->Buffer(), &buffer))
+    return {};
+  const size_t offset = view->ByteOffset();
+  const size_t byte_length = view->ByteLength();
+
+  if (value->IsDataView())
+    return v8::MaybeLocal<v8::Value>(
+        v8::DataView::New(buffer, offset, byte_length));
+
+  const size_t length = value.As<v8::TypedArray>()->Length();
+#define SHARE_TYPED_ARRAY(Type) \
+  if (value->Is##Type())        \
+    return v8::MaybeLocal<v8::Value>(v8::Type::New(buffer, offset, length));
+  SHARE_TYPED_ARRAY(Uint8Array)
+  SHARE_TYPED_ARRAY(Uint8ClampedArray)
+  SHARE_TYPED_ARRAY(Int8Array)
+  SHARE_TYPED_ARRAY(Uint16Array)
+  SHARE_TYPED_ARRAY(Int16Array)
+  SHARE_TYPED_ARRAY(Uint32Array)
+  SHARE_TYPED_ARRAY(Int32Array)
+  SHARE_TYPED_ARRAY(Float32Array)
+  SHARE_TYPED_ARRAY(Float64Array)
+  SHARE_TYPED_ARRAY(BigInt64Array)
+  SHARE_TYPED_ARRAY(BigUint64Array)
+#undef SHARE_TYPED_ARRAY
+  return {};
+}
+
+// Materializes a property that CreateProxyForAPI left lazy.  V8 replaces the
+// accessor with a data property holding the returned value, so this only runs
+// once per property.
+void LazyProxyGetter(v8::Local<v8::Name> property,
+                     const v8::PropertyCallbackInfo<v8::Value>& info) {
+  TRACE_EVENT0("electron", "ContextBridge::LazyProxyGetter");
+  CHECK(info.Data()->IsObject());
+  v8::Local<v8::Object> data = info.Data().As<v8::Object>();
+  v8::Local<v8::Context> destination_context =
+      data->GetCreationContextChecked();
+
+  v8::Local<v8::Value> value;
+  v8::Local<v8::Value> parent_value;
+  if (!GetPrivate(destination_context, data,
+                  context_bridge::kLazyProxyValuePrivateKey)
+           .ToLocal(&value) ||
+      !value->IsObject() ||
+      !GetPrivate(destination_context, data,
+                  context_bridge::kLazyProxyParentPrivateKey)
+           .ToLocal(&parent_value))
+    return;
+  v8::Local<v8::Context> source_context =
+      value.As<v8::Object>()->GetCreationContextChecked();
+
+  v8::Context::Scope destination_context_scope(destination_context);
+  context_bridge::ObjectCache object_cache;
+  v8::Local<v8::Value> proxy;
+  // The property is being read from the destination context, so that's where
+  // any error has to be thrown.
+  if (!PassValueToOtherContext(source_context, destination_context, value,
+                               parent_value, &object_cache, false, 0,
+                               BridgeErrorTarget::kDestination)
+           .ToLocal(&proxy))
+    return;
+
+  v8::Local<v8::Value> frozen;
+  if (GetPrivate(destination_context, info.Holder(),
+                 context_bridge::kHasFrozenLazyPropertiesPrivateKey)
+          .ToLocal(&frozen) &&
+      frozen->IsTrue() && proxy->IsObject() && !proxy->IsTypedArray() &&
+      !DeepFreeze(proxy.As<v8::Object>(), destination_context))
+    return;
+
+  info.GetReturnValue().Set(proxy);
+}
+
+// Defines |key| on |proxy| so that |value| is only passed over the bridge when
+// the property is first read.  Returns false if |value| should be passed right
+// away instead.
+bool SetLazyProxyProperty(const v8::Local<v8::Context>& destination_context,
+                          v8::Local<v8::Object> proxy,
+                          v8::Local<v8::Value> key,
+                          v8::Local<v8::Value> value,
+                          v8::Local<v8::Object> parent_value) {
+  if (!key->IsName() || !(IsPlainObject(value) || IsPlainArray(value)))
+    return false;
+
+  v8::Isolate* isolate = destination_context->GetIsolate();
+  v8::Local<v8::Object> data = v8::Object::New(isolate);
+  SetPrivate(destination_context, data,
+             context_bridge::kLazyProxyValuePrivateKey, value);
+  SetPrivate(destination_context, data,
+             context_bridge::kLazyProxyParentPrivateKey, parent_value);
+  return IsTrue(proxy->SetLazyDataProperty(
+      destination_context, key.As<v8::Name>(), LazyProxyGetter, data));
+}
+
 }  // namespace
 
 v8::MaybeLocal<v8::Value> PassValueToOtherContext(
@@ -414,6 +650,16 @@ v8::MaybeLocal<v8::Value> PassValueToOtherContext(
     return v8::MaybeLocal<v8::Value>(passed_value.ToLocalChecked());
   }
 
+  if (base::FeatureList::IsEnabled(
+          features::kContextBridgeShareArrayBuffers)) {
+    v8::Local<v8::Value> shared_value;
+    if (ShareArrayBufferWithContext(destination_context, value, object_cache)
+            .ToLocal(&shared_value)) {
+      object_cache->CacheProxiedObject(value, shared_value);
+      return v8::MaybeLocal<v8::Value>(shared_value);
+    }
+  }
+
   // Serializable objects
   blink::CloneableMessage ret;
   {
@@ -587,16 +833,39 @@ v8::MaybeLocal<v8::Object> CreateProxyForAPI(
 
   {
     v8::Context::Scope destination_context_scope(destination_context);
-    auto proxy =
-        gin_helper::Dictionary::CreateEmpty(destination_context->GetIsolate());
-    object_cache->CacheProxiedObject(api.GetHandle(), proxy.GetHandle());
+    v8::Isolate* isolate = destination_context->GetIsolate();
     auto maybe_keys = api.GetHandle()->GetOwnPropertyNames(
         source_context, static_cast<v8::PropertyFilter>(v8::ONLY_ENUMERABLE));
-    if (maybe_keys.IsEmpty())
+    if (maybe_keys.IsEmpty()) {
+      auto proxy = gin_helper::Dictionary::CreateEmpty(isolate);
+      object_cache->CacheProxiedObject(api.GetHandle(), proxy.GetHandle());
       return v8::MaybeLocal<v8::Object>(proxy.GetHandle());
+    }
     auto keys = maybe_keys.ToLocalChecked();
 
     uint32_t length = keys->Length();
+    // Dynamic properties are read through their getters every time, so they
+    // are never lazy.
+    const bool lazy_properties =
+        !support_dynamic_properties &&
+        base::FeatureList::IsEnabled(features::kContextBridgeLazyProxies);
+    // With dynamic or lazy properties keys may become accessors, which would
+    // change the shape anyway.
+    v8::Local<v8::ObjectTemplate> proxy_template;
+    if (!support_dynamic_properties && !lazy_properties &&
+        length >= kMinTemplatedProxyProperties)
+      proxy_template =
+          ProxyTemplateCache::Get(isolate, destination_context, keys);
+    v8::Local<v8::Object> proxy_object;
+    if (proxy_template.IsEmpty() ||
+        !proxy_template->NewInstance(destination_context)
+             .ToLocal(&proxy_object)) {
+      proxy_object = v8::Object::New(isolate);
+      proxy_template.Clear();
+    }
+    gin_helper::Dictionary proxy(isolate, proxy_object);
+    object_cache->CacheProxiedObject(api.GetHandle(), proxy.GetHandle());
+
     for (uint32_t i = 0; i < length; i++) {
       v8::Local<v8::Value> key =
           keys->Get(destination_context, i).ToLocalChecked();
@@ -645,8 +914,19 @@ v8::MaybeLocal<v8::Object> CreateProxyForAPI(
         }
       }
       v8::Local<v8::Value> value;
-      if (!api.Get(key, &value))
+      if (!api.Get(key, &value)) {
+        // The key was put on the proxy by its template, but an untemplated
+        // proxy wouldn't have it.
+        if (!proxy_template.IsEmpty())
+          std::ignore = proxy.GetHandle()->Delete(destination_context, key);
         continue;
+      }
+
+      if (lazy_properties &&
+          SetLazyProxyProperty(destination_context, proxy.GetHandle(), key,
+                               value, api.GetHandle())) {
+        continue;
+      }
 
       auto passed_value = PassValueToOtherContext(
           source_context, destination_context, value, api.GetHandle(),
@@ -2,8 +2,15 @@
 // Use of this source code is governed by the MIT license that can be
 // found in the LICENSE file.
 
+#include <optional>
 #include <string>
+#include <utility>
+#include <vector>
 
+#include "base/functional/bind.h"
+#include "base/memory/weak_ptr.h"
+#include "base/task/single_thread_task_runner.h"
+#include "base/trace_event/trace_event.h"
 #include "base/values.h"
 #include "content/public/renderer/render_frame.h"
 #include "content/public/renderer/render_frame_observer.h"
@@ -11,6 +18,7 @@
 #include "gin/handle.h"
 #include "gin/object_template_builder.h"
 #include "gin/wrappable.h"
+#include "mojo/public/cpp/bindings/remote.h"
 #include "services/service_manager/public/cpp/interface_provider.h"
 #include "shell/common/api/api.mojom.h"
 #include "shell/common/gin_converters/blink_converter.h"
@@ -22,6 +30,7 @@
 #include "shell/common/node_includes.h"
 #include "shell/common/v8_value_serializer.h"
 #include "third_party/blink/public/common/associated_interfaces/associated_interface_provider.h"
+#include "third_party/blink/public/platform/task_type.h"
 #include "third_party/blink/public/web/web_local_frame.h"
 #include "third_party/blink/public/web/web_message_port_converter.h"
 
@@ -33,6 +42,9 @@ namespace {
 const char kIPCMethodCalledAfterContextReleasedError[] =
     "IPC method called after context was released";
 
+// Upper bound on how many messages sendBatched holds before sending them.
+constexpr size_t kMaxBatchedMessages = 256;
+
 RenderFrame* GetCurrentRenderFrame() {
   WebLocalFrame* frame = WebLocalFrame::FrameForCurrentContext();
   if (!frame)
@@ -62,13 +74,18 @@ class IPCRenderer : public gin::Wrappable<IPCRenderer>,
         &electron_ipc_remote_);
   }
 
-  void OnDestruct() override { electron_ipc_remote_.reset(); }
+  void OnDestruct() override {
+    FlushBatchedMessages();
+    ResetRemotes();
+  }
 
   void WillReleaseScriptContext(v8::Local<v8::Context> context,
                                 int32_t world_id) override {
     if (weak_context_.IsEmpty() ||
-        weak_context_.Get(context->GetIsolate()) == context)
-      electron_ipc_remote_.reset();
+        weak_context_.Get(context->GetIsolate()) == context) {
+      FlushBatchedMessages();
+      ResetRemotes();
+    }
   }
 
   // gin::Wrappable:
@@ -76,6 +93,7 @@ class IPCRenderer : public gin::Wrappable<IPCRenderer>,
       v8::Isolate* isolate) override {
     return gin::Wrappable<IPCRenderer>::GetObjectTemplateBuilder(isolate)
         .SetMethod("send", &IPCRenderer::SendMessage)
+        .SetMethod("sendBatched", &IPCRenderer::SendMessageBatched)
         .SetMethod("sendSync", &IPCRenderer::SendSync)
         .SetMethod("sendToHost", &IPCRenderer::SendToHost)
         .SetMethod("invoke", &IPCRenderer::Invoke)
@@ -85,38 +103,108 @@ class IPCRenderer : public gin::Wrappable<IPCRenderer>,
   const char* GetTypeName() override { return "IPCRenderer"; }
 
  private:
+  void ResetRemotes() {
+    electron_ipc_remote_.reset();
+    urgent_lane_.reset();
+    bulk_lane_.reset();
+  }
+
+  // Returns the pipe of |lane|, binding it on first use.
+  electron::mojom::ElectronApiIPCLane* GetLane(electron::mojom::IPCLane lane) {
+    auto& remote =
+        lane == electron::mojom::IPCLane::kUrgent ? urgent_lane_ : bulk_lane_;
+    if (!remote) {
+      electron_ipc_remote_->BindLane(lane,
+                                     remote.BindNewPipeAndPassReceiver());
+    }
+    return remote.get();
+  }
+
+  // Messages with a |priority| of "urgent" or "bulk" are sent over a pipe of
+  // their own, so they are not ordered with the messages of other channels.
   void SendMessage(v8::Isolate* isolate,
                    gin_helper::ErrorThrower thrower,
                    bool internal,
                    const std::string& channel,
-                   v8::Local<v8::Value> arguments) {
+                   v8::Local<v8::Value> arguments,
+                   std::optional<std::string> priority) {
+    TRACE_EVENT1("electron", "IPCRenderer::SendMessage", "channel", channel);
     if (!electron_ipc_remote_) {
       thrower.ThrowError(kIPCMethodCalledAfterContextReleasedError);
       return;
     }
-    blink::CloneableMessage message;
+    blink::TransferableMessage message;
     if (!electron::SerializeV8Value(isolate, arguments, &message)) {
       return;
     }
+    if (priority == "urgent" || priority == "bulk") {
+      GetLane(priority == "urgent" ? electron::mojom::IPCLane::kUrgent
+                                   : electron::mojom::IPCLane::kBulk)
+          ->Message(internal, channel, std::move(message));
+      return;
+    }
+    FlushBatchedMessages();
     electron_ipc_remote_->Message(internal, channel, std::move(message));
   }
 
+  // Serializes the message right away, like SendMessage, but holds it until
+  // the current task is done so that every message sent in between reaches
+  // the browser as one Mojo message and one emit in the main process.
+  void SendMessageBatched(v8::Isolate* isolate,
+                          gin_helper::ErrorThrower thrower,
+                          bool internal,
+                          const std::string& channel,
+                          v8::Local<v8::Value> arguments) {
+    if (!electron_ipc_remote_) {
+      thrower.ThrowError(kIPCMethodCalledAfterContextReleasedError);
+      return;
+    }
+    auto message = electron::mojom::BatchedMessage::New();
+    message->internal = internal;
+    message->channel = channel;
+    if (!electron::SerializeV8Value(isolate, arguments, &message->arguments)) {
+      return;
+    }
+    if (batched_messages_.empty()) {
+      render_frame()
+          ->GetTaskRunner(blink::TaskType::kInternalDefault)
+          ->PostTask(FROM_HERE,
+                     base::BindOnce(&IPCRenderer::FlushBatchedMessages,
+                                    weak_factory_.GetWeakPtr()));
+    }
+    batched_messages_.push_back(std::move(message));
+    if (batched_messages_.size() >= kMaxBatchedMessages)
+      FlushBatchedMessages();
+  }
+
+  // Sends the messages queued by SendMessageBatched. Called before any other
+  // message is sent, so batching never reorders messages from this frame.
+  void FlushBatchedMessages() {
+    if (batched_messages_.empty())
+      return;
+    if (electron_ipc_remote_)
+      electron_ipc_remote_->MessageBatch(std::move(batched_messages_));
+    batched_messages_.clear();
+  }
+
   v8::Local<v8::Promise> Invoke(v8::Isolate* isolate,
                                 gin_helper::ErrorThrower thrower,
                                 bool internal,
                                 const std::string& channel,
                                 v8::Local<v8::Value> arguments) {
+    TRACE_EVENT1("electron", "IPCRenderer::Invoke", "channel", channel);
     if (!electron_ipc_remote_) {
       thrower.ThrowError(kIPCMethodCalledAfterContextReleasedError);
       return v8::Local<v8::Promise>();
     }
-    blink::CloneableMessage message;
+    blink::TransferableMessage message;
     if (!electron::SerializeV8Value(isolate, arguments, &message)) {
       return v8::Local<v8::Promise>();
     }
     gin_helper::Promise<blink::CloneableMessage> p(isolate);
     auto handle = p.GetHandle();
 
+    FlushBatchedMessages();
     electron_ipc_remote_->Invoke(
         internal, channel, std::move(message),
         base::BindOnce(
@@ -163,6 +251,7 @@ class IPCRenderer : public gin::Wrappable<IPCRenderer>,
       ports.emplace_back(port.value());
     }
 
+    FlushBatchedMessages();
     transferable_message.ports = std::move(ports);
     electron_ipc_remote_->ReceivePostMessage(channel,
                                              std::move(transferable_message));
@@ -180,6 +269,7 @@ class IPCRenderer : public gin::Wrappable<IPCRenderer>,
     if (!electron::SerializeV8Value(isolate, arguments, &message)) {
       return;
     }
+    FlushBatchedMessages();
     electron_ipc_remote_->MessageHost(channel, std::move(message));
   }
 
@@ -188,15 +278,17 @@ class IPCRenderer : public gin::Wrappable<IPCRenderer>,
                                 bool internal,
                                 const std::string& channel,
                                 v8::Local<v8::Value> arguments) {
+    TRACE_EVENT1("electron", "IPCRenderer::SendSync", "channel", channel);
     if (!electron_ipc_remote_) {
       thrower.ThrowError(kIPCMethodCalledAfterContextReleasedError);
       return v8::Local<v8::Value>();
     }
-    blink::CloneableMessage message;
+    blink::TransferableMessage message;
     if (!electron::SerializeV8Value(isolate, arguments, &message)) {
       return v8::Local<v8::Value>();
     }
 
+    FlushBatchedMessages();
     blink::CloneableMessage result;
     electron_ipc_remote_->MessageSync(internal, channel, std::move(message),
                                       &result);
@@ -205,6 +297,11 @@ class IPCRenderer : public gin::Wrappable<IPCRenderer>,
 
   v8::Global<v8::Context> weak_context_;
   mojo::AssociatedRemote<electron::mojom::ElectronApiIPC> electron_ipc_remote_;
+  mojo::Remote<electron::mojom::ElectronApiIPCLane> urgent_lane_;
+  mojo::Remote<electron::mojom::ElectronApiIPCLane> bulk_lane_;
+  std::vector<electron::mojom::BatchedMessagePtr> batched_messages_;
+
+  base::WeakPtrFactory<IPCRenderer> weak_factory_{this};
 };
 
 gin::WrapperInfo IPCRenderer::kWrapperInfo = {gin::kEmbedderNativeGin};
@@ -5,6 +5,7 @@
 #include "shell/renderer/api/electron_api_spell_check_client.h"
 
 #include <iterator>
+#include <map>
 #include <memory>
 #include <set>
 #include <string_view>
@@ -13,9 +14,15 @@
 #include <vector>
 
 #include "base/containers/contains.h"
+#include "base/containers/lru_cache.h"
 #include "base/logging.h"
+#include "base/no_destructor.h"
 #include "base/numerics/safe_conversions.h"
+#include "base/synchronization/lock.h"
+#include "base/task/sequenced_task_runner.h"
 #include "base/task/single_thread_task_runner.h"
+#include "base/task/thread_pool.h"
+#include "base/thread_annotations.h"
 #include "components/spellcheck/renderer/spellcheck_worditerator.h"
 #include "shell/common/gin_helper/dictionary.h"
 #include "shell/common/gin_helper/function_template.h"
@@ -28,6 +35,9 @@ namespace electron::api {
 
 namespace {
 
+// Number of words whose verdict is remembered for each language.
+constexpr size_t kMaxVerdictCacheSize = 10000;
+
 bool HasWordCharacters(const std::u16string& text, int index) {
   const char16_t* data = text.data();
   int length = text.length();
@@ -47,8 +57,179 @@ struct Word {
   std::vector<std::u16string> contraction_words;
 };
 
+// Whether the words the providers were asked about are misspelled, shared by
+// all the off-thread clients of a renderer process.
+class VerdictCache {
+ public:
+  static VerdictCache* Get() {
+    static base::NoDestructor<VerdictCache> cache;
+    return cache.get();
+  }
+
+  // Splits |words| into the ones known to be misspelled and the ones that
+  // have no verdict yet.
+  void Lookup(const std::string& language,
+              const std::set<std::u16string>& words,
+              std::set<std::u16string>* unknown,
+              std::unordered_set<std::u16string>* misspelled) {
+    base::AutoLock auto_lock(lock_);
+    auto& cache = GetCache(language);
+    for (const auto& word : words) {
+      auto it = cache.Get(word);
+      if (it == cache.end())
+        unknown->insert(word);
+      else if (it->second)
+        misspelled->insert(word);
+    }
+  }
+
+  void Store(const std::string& language,
+             const std::set<std::u16string>& words,
+             const std::unordered_set<std::u16string>& misspelled) {
+    base::AutoLock auto_lock(lock_);
+    auto& cache = GetCache(language);
+    for (const auto& word : words)
+      cache.Put(word, base::Contains(misspelled, word));
+  }
+
+ private:
+  using Cache = base::LRUCache<std::u16string, bool>;
+
+  Cache& GetCache(const std::string& language)
+      EXCLUSIVE_LOCKS_REQUIRED(lock_) {
+    return caches_.try_emplace(language, kMaxVerdictCacheSize).first->second;
+  }
+
+  base::Lock lock_;
+  std::map<std::string, Cache> caches_ GUARDED_BY(lock_);
+};
+
 }  // namespace
 
+struct SpellCheckClient::TokenizedText {
+  // False when the word iterators could not be initialized.
+  bool succeeded = false;
+  std::vector<Word> word_list;
+  // The words the provider has to be asked about.
+  std::set<std::u16string> words;
+  // The words already known to be misspelled.
+  std::unordered_set<std::u16string> misspelled;
+};
+
+// Splits text into words. In the off-thread mode it is created on the main
+// thread and then only used on the tokenizer sequence.
+class SpellCheckClient::Tokenizer {
+ public:
+  explicit Tokenizer(const std::string& language) : language_(language) {
+    character_attributes_.SetDefaultLanguage(language);
+  }
+  Tokenizer(const Tokenizer&) = delete;
+  Tokenizer& operator=(const Tokenizer&) = delete;
+  ~Tokenizer() = default;
+
+  // Uses the verdict cache to leave out the words it knows when |use_cache|.
+  TokenizedText Tokenize(const std::u16string& text, bool use_cache) {
+    TokenizedText tokenized;
+    if (!text_iterator_.IsInitialized() &&
+        !text_iterator_.Initialize(&character_attributes_, true)) {
+      // We failed to initialize text_iterator_, return as spelled correctly.
+      VLOG(1) << "Failed to initialize SpellcheckWordIterator";
+      return tokenized;
+    }
+
+    if (!contraction_iterator_.IsInitialized() &&
+        !contraction_iterator_.Initialize(&character_attributes_, false)) {
+      // We failed to initialize the word iterator, return as spelled
+      // correctly.
+      VLOG(1) << "Failed to initialize contraction_iterator_";
+      return tokenized;
+    }
+
+    text_iterator_.SetText(text);
+
+    std::u16string word;
+    size_t word_start;
+    size_t word_length;
+    std::set<std::u16string> words;
+    Word word_entry;
+    for (;;) {  // Run until end of text
+      const auto status =
+          text_iterator_.GetNextWord(&word, &word_start, &word_length);
+      if (status == SpellcheckWordIterator::IS_END_OF_TEXT)
+        break;
+      if (status == SpellcheckWordIterator::IS_SKIPPABLE)
+        continue;
+
+      word_entry.result.location = base::checked_cast<int>(word_start);
+      word_entry.result.length = base::checked_cast<int>(word_length);
+      word_entry.text = word;
+      word_entry.contraction_words.clear();
+
+      words.insert(word);
+      // If the given word is a concatenated word of two or more valid words
+      // (e.g. "hello:hello"), we should treat it as a valid word.
+      if (IsContraction(word, &word_entry.contraction_words)) {
+        for (const auto& w : word_entry.contraction_words) {
+          words.insert(w);
+        }
+      }
+      tokenized.word_list.push_back(word_entry);
+    }
+
+    if (use_cache) {
+      VerdictCache::Get()->Lookup(language_, words, &tokenized.words,
+                                  &tokenized.misspelled);
+    } else {
+      tokenized.words = std::move(words);
+    }
+    tokenized.succeeded = true;
+    return tokenized;
+  }
+
+ private:
+  // Returns whether or not the given string is a contraction.
+  // This function is a fall-back when the SpellcheckWordIterator class
+  // returns a concatenated word which is not in the selected dictionary
+  // (e.g. "in'n'out") but each word is valid.
+  // Output variable contraction_words will contain individual
+  // words in the contraction.
+  bool IsContraction(const std::u16string& contraction,
+                     std::vector<std::u16string>* contraction_words) {
+    DCHECK(contraction_iterator_.IsInitialized());
+
+    contraction_iterator_.SetText(contraction);
+
+    std::u16string word;
+    size_t word_start;
+    size_t word_length;
+    for (auto status = contraction_iterator_.GetNextWord(&word, &word_start,
+                                                         &word_length);
+         status != SpellcheckWordIterator::IS_END_OF_TEXT;
+         status = contraction_iterator_.GetNextWord(&word, &word_start,
+                                                    &word_length)) {
+      if (status == SpellcheckWordIterator::IS_SKIPPABLE)
+        continue;
+
+      contraction_words->push_back(word);
+    }
+    return contraction_words->size() > 1;
+  }
+
+  const std::string language_;
+
+  // Represents character attributes used for filtering out characters which
+  // are not supported by this SpellCheck object.
+  SpellcheckCharAttribute character_attributes_;
+
+  // Represents word iterators used in this spellchecker. The |text_iterator_|
+  // splits text provided by Blink into words, contractions, or concatenated
+  // words. The |contraction_iterator_| splits a concatenated word extracted by
+  // |text_iterator_| into word components so we can treat a concatenated word
+  // consisting only of correct words as a correct word.
+  SpellcheckWordIterator text_iterator_;
+  SpellcheckWordIterator contraction_iterator_;
+};
+
 class SpellCheckClient::SpellcheckRequest {
  public:
   SpellcheckRequest(
@@ -72,13 +253,21 @@ class SpellCheckClient::SpellcheckRequest {
 
 SpellCheckClient::SpellCheckClient(const std::string& language,
                                    v8::Isolate* isolate,
-                                   v8::Local<v8::Object> provider)
-    : isolate_(isolate),
+                                   v8::Local<v8::Object> provider,
+                                   const Options& options)
+    : language_(language),
+      options_(options),
+      tokenizer_(std::make_unique<Tokenizer>(language)),
+      isolate_(isolate),
       context_(isolate, isolate->GetCurrentContext()),
       provider_(isolate, provider) {
   DCHECK(!context_.IsEmpty());
 
-  character_attributes_.SetDefaultLanguage(language);
+  if (options_.off_thread) {
+    tokenizer_task_runner_ = base::ThreadPool::CreateSequencedTaskRunner(
+        {base::TaskPriority::USER_VISIBLE,
+         base::TaskShutdownBehavior::SKIP_ON_SHUTDOWN});
+  }
 
   // Persistent the method.
   v8::Local<v8::Function> spell_check;
@@ -87,6 +276,9 @@ SpellCheckClient::SpellCheckClient(const std::string& language,
 }
 
 SpellCheckClient::~SpellCheckClient() {
+  // Runs after the tokenizing tasks still queued, which use it unretained.
+  if (tokenizer_task_runner_)
+    tokenizer_task_runner_->DeleteSoon(FROM_HERE, std::move(tokenizer_));
   context_.Reset();
 }
 
@@ -107,10 +299,22 @@ void SpellCheckClient::RequestCheckingOfText(
 
   pending_request_param_ =
       std::make_unique<SpellcheckRequest>(text, std::move(completionCallback));
+  const uint64_t request_id = ++last_request_id_;
+
+  if (tokenizer_task_runner_) {
+    tokenizer_task_runner_->PostTaskAndReplyWithResult(
+        FROM_HERE,
+        base::BindOnce(&Tokenizer::Tokenize,
+                       base::Unretained(tokenizer_.get()), std::move(text),
+                       true),
+        base::BindOnce(&SpellCheckClient::OnTextTokenized, AsWeakPtr(),
+                       request_id));
+    return;
+  }
 
   base::SingleThreadTaskRunner::GetCurrentDefault()->PostTask(
-      FROM_HERE,
-      base::BindOnce(&SpellCheckClient::SpellCheckText, AsWeakPtr()));
+      FROM_HERE, base::BindOnce(&SpellCheckClient::SpellCheckText,
+                                AsWeakPtr(), request_id));
 }
 
 bool SpellCheckClient::IsSpellCheckingEnabled() const {
@@ -126,71 +330,58 @@ bool SpellCheckClient::IsShowingSpellingUI() {
 void SpellCheckClient::UpdateSpellingUIWithMisspelledWord(
     const blink::WebString& word) {}
 
-void SpellCheckClient::SpellCheckText() {
-  const auto& text = pending_request_param_->text();
-  if (text.empty() || spell_check_.IsEmpty()) {
-    pending_request_param_->completion()->DidCancelCheckingText();
-    pending_request_param_ = nullptr;
+void SpellCheckClient::SpellCheckText(uint64_t request_id) {
+  if (!IsPendingRequest(request_id))
     return;
-  }
+  OnTextTokenized(request_id,
+                  tokenizer_->Tokenize(pending_request_param_->text(), false));
+}
 
-  if (!text_iterator_.IsInitialized() &&
-      !text_iterator_.Initialize(&character_attributes_, true)) {
-    // We failed to initialize text_iterator_, return as spelled correctly.
-    VLOG(1) << "Failed to initialize SpellcheckWordIterator";
+void SpellCheckClient::OnTextTokenized(uint64_t request_id,
+                                       TokenizedText tokenized) {
+  // A newer request has replaced this one in the meantime.
+  if (!IsPendingRequest(request_id))
     return;
-  }
 
-  if (!contraction_iterator_.IsInitialized() &&
-      !contraction_iterator_.Initialize(&character_attributes_, false)) {
-    // We failed to initialize the word iterator, return as spelled correctly.
-    VLOG(1) << "Failed to initialize contraction_iterator_";
+  if (!tokenized.succeeded || spell_check_.IsEmpty()) {
+    pending_request_param_->completion()->DidCancelCheckingText();
+    pending_request_param_ = nullptr;
     return;
   }
 
-  text_iterator_.SetText(text);
-
-  SpellCheckScope scope(*this);
-  std::u16string word;
-  size_t word_start;
-  size_t word_length;
-  std::set<std::u16string> words;
-  auto& word_list = pending_request_param_->wordlist();
-  Word word_entry;
-  for (;;) {  // Run until end of text
-    const auto status =
-        text_iterator_.GetNextWord(&word, &word_start, &word_length);
-    if (status == SpellcheckWordIterator::IS_END_OF_TEXT)
-      break;
-    if (status == SpellcheckWordIterator::IS_SKIPPABLE)
-      continue;
-
-    word_entry.result.location = base::checked_cast<int>(word_start);
-    word_entry.result.length = base::checked_cast<int>(word_length);
-    word_entry.text = word;
-    word_entry.contraction_words.clear();
-
-    word_list.push_back(word_entry);
-    words.insert(word);
-    // If the given word is a concatenated word of two or more valid words
-    // (e.g. "hello:hello"), we should treat it as a valid word.
-    if (IsContraction(scope, word, &word_entry.contraction_words)) {
-      for (const auto& w : word_entry.contraction_words) {
-        words.insert(w);
-      }
-    }
+  pending_request_param_->wordlist() = std::move(tokenized.word_list);
+  // Every word has a cached verdict, the provider has nothing to check.
+  if (tokenized.words.empty()) {
+    FinishRequest(tokenized.misspelled);
+    return;
   }
 
   // Send out all the words data to the spellchecker to check
-  SpellCheckWords(scope, words);
+  SpellCheckWords(request_id, std::move(tokenized.words),
+                  std::move(tokenized.misspelled));
 }
 
 void SpellCheckClient::OnSpellCheckDone(
+    uint64_t request_id,
+    const std::set<std::u16string>& words,
+    const std::unordered_set<std::u16string>& misspelled,
     const std::vector<std::u16string>& misspelled_words) {
-  std::vector<blink::WebTextCheckingResult> results;
-  std::unordered_set<std::u16string> misspelled(misspelled_words.begin(),
-                                                misspelled_words.end());
+  // The provider called back more than once or too late.
+  if (!IsPendingRequest(request_id))
+    return;
 
+  std::unordered_set<std::u16string> verdicts(misspelled_words.begin(),
+                                              misspelled_words.end());
+  if (options_.off_thread)
+    VerdictCache::Get()->Store(language_, words, verdicts);
+
+  verdicts.insert(misspelled.begin(), misspelled.end());
+  FinishRequest(verdicts);
+}
+
+void SpellCheckClient::FinishRequest(
+    const std::unordered_set<std::u16string>& misspelled) {
+  std::vector<blink::WebTextCheckingResult> results;
   auto& word_list = pending_request_param_->wordlist();
 
   for (const auto& word : word_list) {
@@ -215,8 +406,15 @@ void SpellCheckClient::OnSpellCheckDone(
   pending_request_param_ = nullptr;
 }
 
-void SpellCheckClient::SpellCheckWords(const SpellCheckScope& scope,
-                                       const std::set<std::u16string>& words) {
+bool SpellCheckClient::IsPendingRequest(uint64_t request_id) const {
+  return pending_request_param_ && request_id == last_request_id_;
+}
+
+void SpellCheckClient::SpellCheckWords(
+    uint64_t request_id,
+    std::set<std::u16string> words,
+    std::unordered_set<std::u16string> misspelled) {
+  SpellCheckScope scope(*this);
   DCHECK(!scope.spell_check_.IsEmpty());
 
   auto context = isolate_->GetCurrentContext();
@@ -224,46 +422,19 @@ void SpellCheckClient::SpellCheckWords(const SpellCheckScope& scope,
       isolate_, context->GetMicrotaskQueue(),
       v8::MicrotasksScope::kDoNotRunMicrotasks);
 
+  v8::Local<v8::Value> words_value = gin::ConvertToV8(isolate_, words);
   v8::Local<v8::FunctionTemplate> templ = gin_helper::CreateFunctionTemplate(
       isolate_,
-      base::BindRepeating(&SpellCheckClient::OnSpellCheckDone, AsWeakPtr()));
-  v8::Local<v8::Value> args[] = {gin::ConvertToV8(isolate_, words),
+      base::BindRepeating(&SpellCheckClient::OnSpellCheckDone, AsWeakPtr(),
+                          request_id, std::move(words),
+                          std::move(misspelled)));
+  v8::Local<v8::Value> args[] = {words_value,
                                  templ->GetFunction(context).ToLocalChecked()};
   // Call javascript with the words and the callback function
   scope.spell_check_->Call(context, scope.provider_, std::size(args), args)
       .IsEmpty();
 }
 
-// Returns whether or not the given string is a contraction.
-// This function is a fall-back when the SpellcheckWordIterator class
-// returns a concatenated word which is not in the selected dictionary
-// (e.g. "in'n'out") but each word is valid.
-// Output variable contraction_words will contain individual
-// words in the contraction.
-bool SpellCheckClient::IsContraction(
-    const SpellCheckScope& scope,
-    const std::u16string& contraction,
-    std::vector<std::u16string>* contraction_words) {
-  DCHECK(contraction_iterator_.IsInitialized());
-
-  contraction_iterator_.SetText(contraction);
-
-  std::u16string word;
-  size_t word_start;
-  size_t word_length;
-  for (auto status =
-           contraction_iterator_.GetNextWord(&word, &word_start, &word_length);
-       status != SpellcheckWordIterator::IS_END_OF_TEXT;
-       status = contraction_iterator_.GetNextWord(&word, &word_start,
-                                                  &word_length)) {
-    if (status == SpellcheckWordIterator::IS_SKIPPABLE)
-      continue;
-
-    contraction_words->push_back(word);
-  }
-  return contraction_words->size() > 1;
-}
-
 SpellCheckClient::SpellCheckScope::SpellCheckScope(
     const SpellCheckClient& client)
     : handle_scope_(client.isolate_),
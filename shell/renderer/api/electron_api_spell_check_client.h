@@ -8,17 +8,22 @@
 #include <memory>
 #include <set>
 #include <string>
+#include <unordered_set>
 #include <vector>
 
 #include "base/functional/callback.h"
 #include "base/memory/raw_ptr.h"
+#include "base/memory/scoped_refptr.h"
 #include "base/memory/weak_ptr.h"
-#include "components/spellcheck/renderer/spellcheck_worditerator.h"
 #include "third_party/blink/public/platform/web_spell_check_panel_host_client.h"
 #include "third_party/blink/public/platform/web_vector.h"
 #include "third_party/blink/public/web/web_text_check_client.h"
 #include "v8/include/v8.h"
 
+namespace base {
+class SequencedTaskRunner;
+}  // namespace base
+
 namespace blink {
 struct WebTextCheckingResult;
 class WebTextCheckingCompletion;
@@ -30,9 +35,17 @@ class SpellCheckClient : public blink::WebSpellCheckPanelHostClient,
                          public blink::WebTextCheckClient,
                          public base::SupportsWeakPtr<SpellCheckClient> {
  public:
+  struct Options {
+    // Splits the text into words on a background sequence, and only asks the
+    // provider about the words that aren't in the verdict cache shared by the
+    // clients of the same language in this process.
+    bool off_thread = false;
+  };
+
   SpellCheckClient(const std::string& language,
                    v8::Isolate* isolate,
-                   v8::Local<v8::Object> provider);
+                   v8::Local<v8::Object> provider,
+                   const Options& options);
   ~SpellCheckClient() override;
 
   // disable copy
@@ -41,6 +54,9 @@ class SpellCheckClient : public blink::WebSpellCheckPanelHostClient,
 
  private:
   class SpellcheckRequest;
+  class Tokenizer;
+  struct TokenizedText;
+
   // blink::WebTextCheckClient:
   void RequestCheckingOfText(const blink::WebString& textToCheck,
                              std::unique_ptr<blink::WebTextCheckingCompletion>
@@ -63,44 +79,47 @@ class SpellCheckClient : public blink::WebSpellCheckPanelHostClient,
     ~SpellCheckScope();
   };
 
-  // Run through the word iterator and send out requests
-  // to the JS API for checking spellings of words in the current
-  // request.
-  void SpellCheckText();
+  // Split the text of the current request into words, on the main thread.
+  void SpellCheckText(uint64_t request_id);
+
+  // Send the words of the current request that need checking to the JS API,
+  // or complete it if there are none.
+  void OnTextTokenized(uint64_t request_id, TokenizedText tokenized);
 
   // Call JavaScript to check spelling a word.
   // The javascript function will callback OnSpellCheckDone
   // with the results of all the misspelled words.
-  void SpellCheckWords(const SpellCheckScope& scope,
-                       const std::set<std::u16string>& words);
-
-  // Returns whether or not the given word is a contraction of valid words
-  // (e.g. "word:word").
-  // Output variable contraction_words will contain individual
-  // words in the contraction.
-  bool IsContraction(const SpellCheckScope& scope,
-                     const std::u16string& contraction,
-                     std::vector<std::u16string>* contraction_words);
+  void SpellCheckWords(uint64_t request_id,
+                       std::set<std::u16string> words,
+                       std::unordered_set<std::u16string> misspelled);
 
   // Callback for the JS API which returns the list of misspelled words.
-  void OnSpellCheckDone(const std::vector<std::u16string>& misspelled_words);
+  // |words| are the words it was asked about and |misspelled| the words
+  // already known to be misspelled.
+  void OnSpellCheckDone(uint64_t request_id,
+                        const std::set<std::u16string>& words,
+                        const std::unordered_set<std::u16string>& misspelled,
+                        const std::vector<std::u16string>& misspelled_words);
+
+  // Sends the misspelled ranges of the current request to Blink.
+  void FinishRequest(const std::unordered_set<std::u16string>& misspelled);
+
+  // Whether |request_id| is still the current request.
+  bool IsPendingRequest(uint64_t request_id) const;
 
-  // Represents character attributes used for filtering out characters which
-  // are not supported by this SpellCheck object.
-  SpellcheckCharAttribute character_attributes_;
+  const std::string language_;
+  const Options options_;
 
-  // Represents word iterators used in this spellchecker. The |text_iterator_|
-  // splits text provided by Blink into words, contractions, or concatenated
-  // words. The |contraction_iterator_| splits a concatenated word extracted by
-  // |text_iterator_| into word components so we can treat a concatenated word
-  // consisting only of correct words as a correct word.
-  SpellcheckWordIterator text_iterator_;
-  SpellcheckWordIterator contraction_iterator_;
+  // Splits text provided by Blink into words. Lives on
+  // |tokenizer_task_runner_| in the off-thread mode.
+  std::unique_ptr<Tokenizer> tokenizer_;
+  scoped_refptr<base::SequencedTaskRunner> tokenizer_task_runner_;
 
   // The parameters of a pending background-spellchecking request.
   // (When Blink sends two or more requests, we cancel the previous
   // requests so we do not have to use vectors.)
   std::unique_ptr<SpellcheckRequest> pending_request_param_;
+  uint64_t last_request_id_ = 0;
 
   raw_ptr<v8::Isolate> isolate_;
   v8::Global<v8::Context> context_;
@@ -4,13 +4,19 @@
 
 #include <limits>
 #include <memory>
+#include <optional>
 #include <string>
 #include <string_view>
 #include <utility>
 #include <vector>
 
 #include "base/command_line.h"
+#include "base/containers/flat_map.h"
+#include "base/containers/span.h"
+#include "base/hash/hash.h"
 #include "base/memory/memory_pressure_listener.h"
+#include "base/no_destructor.h"
+#include "base/strings/string_number_conversions.h"
 #include "base/strings/utf_string_conversions.h"
 #include "components/spellcheck/renderer/spellcheck.h"
 #include "content/public/renderer/render_frame.h"
@@ -39,8 +45,10 @@
 #include "third_party/blink/public/common/page/page_zoom.h"
 #include "third_party/blink/public/common/web_cache/web_cache_resource_type_stats.h"
 #include "third_party/blink/public/common/web_preferences/web_preferences.h"
+#include "third_party/blink/public/mojom/frame/user_activation_notification_type.mojom-shared.h"
 #include "third_party/blink/public/platform/web_cache.h"
 #include "third_party/blink/public/platform/web_isolated_world_info.h"
+#include "third_party/blink/public/platform/web_vector.h"
 #include "third_party/blink/public/web/web_custom_element.h"
 #include "third_party/blink/public/web/web_document.h"
 #include "third_party/blink/public/web/web_element.h"
@@ -55,6 +63,7 @@
 #include "third_party/blink/renderer/platform/bindings/dom_wrapper_world.h"  // nogncheck
 #include "ui/base/ime/ime_text_span.h"
 #include "url/url_util.h"
+#include "v8/include/v8-script.h"
 
 #if BUILDFLAG(ENABLE_BUILTIN_SPELLCHECKER)
 #include "components/spellcheck/renderer/spellcheck.h"
@@ -246,6 +255,123 @@ class ScriptExecutionCallback {
   CompletionCallback callback_;
 };
 
+// Scripts compiled once by webFrame.registerScript and kept for the lifetime
+// of the renderer process, so that every frame and world can run them without
+// compiling them again. Registering the same script again, e.g. from the
+// preload of the next page, returns the existing handle.
+class ScriptRegistry {
+ public:
+  static ScriptRegistry* Get() {
+    static base::NoDestructor<ScriptRegistry> instance;
+    return instance.get();
+  }
+
+  ScriptRegistry() = default;
+
+  // disable copy
+  ScriptRegistry(const ScriptRegistry&) = delete;
+  ScriptRegistry& operator=(const ScriptRegistry&) = delete;
+
+  // Returns 0 with an exception pending if |code| doesn't compile.
+  int32_t Register(v8::Isolate* isolate,
+                   const std::u16string& code,
+                   const std::u16string& url) {
+    const size_t hash = base::FastHash(base::as_byte_span(code));
+    for (const auto& [id, entry] : scripts_) {
+      if (entry.hash == hash && entry.url == url && entry.code == code)
+        return id;
+    }
+
+    // Functions are compiled eagerly as the whole script is expected to run.
+    v8::ScriptOrigin origin(gin::StringToV8(isolate, url));
+    v8::ScriptCompiler::Source source(gin::StringToV8(isolate, code), origin);
+    v8::Local<v8::UnboundScript> script;
+    if (!v8::ScriptCompiler::CompileUnboundScript(
+             isolate, &source, v8::ScriptCompiler::kEagerCompile)
+             .ToLocal(&script))
+      return 0;
+
+    const int32_t id = ++last_id_;
+    scripts_.emplace(id, Entry{hash, code, url, {isolate, script}});
+    return id;
+  }
+
+  void Unregister(int32_t id) { scripts_.erase(id); }
+
+  v8::Local<v8::UnboundScript> Find(v8::Isolate* isolate, int32_t id) const {
+    auto iter = scripts_.find(id);
+    if (iter == scripts_.end())
+      return {};
+    return iter->second.script.Get(isolate);
+  }
+
+ private:
+  struct Entry {
+    size_t hash;
+    std::u16string code;
+    std::u16string url;
+    v8::Global<v8::UnboundScript> script;
+  };
+
+  base::flat_map<int32_t, Entry> scripts_;
+  int32_t last_id_ = 0;
+};
+
+// Stylesheets registered by webFrame.registerStyleSheet, kept for the
+// lifetime of the renderer process so that the CSS text is only sent and
+// converted once however many frames it is applied to. The key of a
+// stylesheet is the key it is inserted with in each document.
+class StyleSheetRegistry {
+ public:
+  struct StyleSheet {
+    blink::WebString source;
+    blink::WebCssOrigin origin;
+  };
+
+  static StyleSheetRegistry* Get() {
+    static base::NoDestructor<StyleSheetRegistry> instance;
+    return instance.get();
+  }
+
+  StyleSheetRegistry() = default;
+
+  // disable copy
+  StyleSheetRegistry(const StyleSheetRegistry&) = delete;
+  StyleSheetRegistry& operator=(const StyleSheetRegistry&) = delete;
+
+  std::u16string Register(const std::string& css, blink::WebCssOrigin origin) {
+    const size_t hash = base::FastHash(css);
+    for (const auto& [key, entry] : style_sheets_) {
+      if (entry.hash == hash && entry.css == css &&
+          entry.style_sheet.origin == origin)
+        return key;
+    }
+
+    std::u16string key =
+        u"electron-style-sheet-" + base::NumberToString16(++last_id_);
+    style_sheets_.emplace(
+        key, Entry{hash, css, {blink::WebString::FromUTF8(css), origin}});
+    return key;
+  }
+
+  void Unregister(const std::u16string& key) { style_sheets_.erase(key); }
+
+  const StyleSheet* Find(const std::u16string& key) const {
+    auto iter = style_sheets_.find(key);
+    return iter == style_sheets_.end() ? nullptr : &iter->second.style_sheet;
+  }
+
+ private:
+  struct Entry {
+    size_t hash;
+    std::string css;
+    StyleSheet style_sheet;
+  };
+
+  base::flat_map<std::u16string, Entry> style_sheets_;
+  int last_id_ = 0;
+};
+
 class FrameSetSpellChecker : public content::RenderFrameVisitor {
  public:
   FrameSetSpellChecker(SpellCheckClient* spell_check_client,
@@ -367,12 +493,20 @@ class WebFrameRenderer : public gin::Wrappable<WebFrameRenderer>,
         .SetMethod("insertText", &WebFrameRenderer::InsertText)
         .SetMethod("insertCSS", &WebFrameRenderer::InsertCSS)
         .SetMethod("removeInsertedCSS", &WebFrameRenderer::RemoveInsertedCSS)
+        .SetMethod("registerStyleSheet", &WebFrameRenderer::RegisterStyleSheet)
+        .SetMethod("unregisterStyleSheet",
+                   &WebFrameRenderer::UnregisterStyleSheet)
+        .SetMethod("applyStyleSheet", &WebFrameRenderer::ApplyStyleSheet)
         .SetMethod("_isEvalAllowed", &WebFrameRenderer::IsEvalAllowed)
         .SetMethod("executeJavaScript", &WebFrameRenderer::ExecuteJavaScript)
         .SetMethod("executeJavaScriptInIsolatedWorld",
                    &WebFrameRenderer::ExecuteJavaScriptInIsolatedWorld)
         .SetMethod("setIsolatedWorldInfo",
                    &WebFrameRenderer::SetIsolatedWorldInfo)
+        .SetMethod("registerScript", &WebFrameRenderer::RegisterScript)
+        .SetMethod("unregisterScript", &WebFrameRenderer::UnregisterScript)
+        .SetMethod("executeRegisteredScript",
+                   &WebFrameRenderer::ExecuteRegisteredScript)
         .SetMethod("getResourceUsage", &WebFrameRenderer::GetResourceUsage)
         .SetMethod("clearCache", &WebFrameRenderer::ClearCache)
         .SetMethod("setSpellCheckProvider",
@@ -537,10 +671,12 @@ class WebFrameRenderer : public gin::Wrappable<WebFrameRenderer>,
     return render_frame->GetRoutingID();
   }
 
-  void SetSpellCheckProvider(gin_helper::ErrorThrower thrower,
-                             v8::Isolate* isolate,
-                             const std::string& language,
-                             v8::Local<v8::Object> provider) {
+  void SetSpellCheckProvider(
+      gin_helper::ErrorThrower thrower,
+      v8::Isolate* isolate,
+      const std::string& language,
+      v8::Local<v8::Object> provider,
+      const std::optional<gin_helper::Dictionary>& options) {
     auto context = isolate->GetCurrentContext();
     if (!provider->Has(context, gin::StringToV8(isolate, "spellCheck"))
              .ToChecked()) {
@@ -557,10 +693,14 @@ class WebFrameRenderer : public gin::Wrappable<WebFrameRenderer>,
     if (existing)
       existing->UnsetAndDestroy();
 
+    SpellCheckClient::Options client_options;
+    if (options)
+      options->Get("offThread", &client_options.off_thread);
+
     // Set spellchecker for all live frames in the same process or
     // in the sandbox mode for all live sub frames to this WebFrame.
-    auto spell_check_client =
-        std::make_unique<SpellCheckClient>(language, isolate, provider);
+    auto spell_check_client = std::make_unique<SpellCheckClient>(
+        language, isolate, provider, client_options);
     FrameSetSpellChecker spell_checker(spell_check_client.get(), render_frame);
 
     // Attach the spell checker to RenderFrame.
@@ -619,6 +759,63 @@ class WebFrameRenderer : public gin::Wrappable<WebFrameRenderer>,
     }
   }
 
+  std::u16string RegisterStyleSheet(const std::string& css,
+                                    gin::Arguments* args) {
+    blink::WebCssOrigin css_origin = blink::WebCssOrigin::kAuthor;
+    gin_helper::Dictionary options;
+    if (args->GetNext(&options))
+      options.Get("cssOrigin", &css_origin);
+    return StyleSheetRegistry::Get()->Register(css, css_origin);
+  }
+
+  void UnregisterStyleSheet(const std::u16string& key) {
+    StyleSheetRegistry::Get()->Unregister(key);
+  }
+
+  int ApplyStyleSheet(v8::Isolate* isolate,
+                      const std::u16string& key,
+                      gin::Arguments* args) {
+    bool subframes = false;
+    gin_helper::Dictionary options;
+    if (args->GetNext(&options))
+      options.Get("subframes", &subframes);
+
+    content::RenderFrame* render_frame;
+    if (!MaybeGetRenderFrame(isolate, "applyStyleSheet", &render_frame))
+      return 0;
+
+    const auto* style_sheet = StyleSheetRegistry::Get()->Find(key);
+    if (!style_sheet) {
+      gin_helper::ErrorThrower(isolate).ThrowError(
+          "No style sheet is registered with this key");
+      return 0;
+    }
+
+    const blink::WebString web_key = blink::WebString::FromUTF16(key);
+    int count = 0;
+    std::vector<blink::WebFrame*> frames = {render_frame->GetWebFrame()};
+    while (!frames.empty()) {
+      blink::WebFrame* frame = frames.back();
+      frames.pop_back();
+      // Frames of other processes are skipped, with their subframes.
+      if (!frame->IsWebLocalFrame())
+        continue;
+      blink::WebDocument document = frame->ToWebLocalFrame()->GetDocument();
+      // Replaces the style sheet if it was already applied to the document.
+      document.RemoveInsertedStyleSheet(web_key, style_sheet->origin);
+      document.InsertStyleSheet(style_sheet->source, &web_key,
+                                style_sheet->origin);
+      ++count;
+      if (!subframes)
+        break;
+      for (blink::WebFrame* child = frame->FirstChild(); child;
+           child = child->NextSibling()) {
+        frames.push_back(child);
+      }
+    }
+    return count;
+  }
+
   bool IsEvalAllowed(v8::Isolate* isolate) {
     content::RenderFrame* render_frame;
     if (!MaybeGetRenderFrame(isolate, "isEvalAllowed", &render_frame))
@@ -778,6 +975,91 @@ class WebFrameRenderer : public gin::Wrappable<WebFrameRenderer>,
     blink::SetIsolatedWorldInfo(world_id, info);
   }
 
+  int32_t RegisterScript(
+      v8::Isolate* isolate,
+      const std::u16string& code,
+      const std::optional<gin_helper::Dictionary>& options) {
+    std::u16string url;
+    if (options)
+      options->Get("url", &url);
+    // Compile errors are thrown to the caller.
+    return ScriptRegistry::Get()->Register(isolate, code, url);
+  }
+
+  void UnregisterScript(int32_t handle) {
+    ScriptRegistry::Get()->Unregister(handle);
+  }
+
+  v8::Local<v8::Promise> ExecuteRegisteredScript(
+      gin::Arguments* args,
+      int32_t script_handle,
+      const std::optional<gin_helper::Dictionary>& options) {
+    v8::Isolate* isolate = args->isolate();
+    gin_helper::Promise<v8::Local<v8::Value>> promise(isolate);
+    v8::Local<v8::Promise> handle = promise.GetHandle();
+
+    content::RenderFrame* render_frame;
+    std::string error_msg;
+    if (!MaybeGetRenderFrame(&error_msg, "executeRegisteredScript",
+                             &render_frame)) {
+      promise.RejectWithErrorMessage(error_msg);
+      return handle;
+    }
+
+    int world_id = blink::DOMWrapperWorld::kMainWorldId;
+    bool has_user_gesture = false;
+    if (options) {
+      options->Get("worldId", &world_id);
+      options->Get("userGesture", &has_user_gesture);
+    }
+
+    v8::Local<v8::UnboundScript> script =
+        ScriptRegistry::Get()->Find(isolate, script_handle);
+    if (script.IsEmpty()) {
+      promise.RejectWithErrorMessage("No script is registered with this handle");
+      return handle;
+    }
+
+    blink::WebLocalFrame* frame = render_frame->GetWebFrame();
+    v8::Local<v8::Context> context =
+        world_id == blink::DOMWrapperWorld::kMainWorldId
+            ? frame->MainWorldScriptContext()
+            : frame->GetScriptContextFromWorldId(isolate, world_id);
+    if (context.IsEmpty()) {
+      promise.RejectWithErrorMessage(
+          "WebFrame was removed before script could run. This normally means "
+          "the underlying frame was destroyed");
+      return handle;
+    }
+
+    if (has_user_gesture) {
+      frame->NotifyUserActivation(
+          blink::mojom::UserActivationNotificationType::kWebScriptExec);
+    }
+
+    // Deletes itself.
+    auto* self = new ScriptExecutionCallback(
+        std::move(promise), ScriptExecutionCallback::CompletionCallback());
+
+    blink::WebVector<v8::Local<v8::Value>> results(1u);
+    {
+      v8::Context::Scope context_scope(context);
+      v8::MicrotasksScope microtasks_scope(
+          isolate, context->GetMicrotaskQueue(),
+          v8::MicrotasksScope::kRunMicrotasks);
+      // Reports the exception to the console of the frame, like scripts run
+      // by executeJavaScript.
+      v8::TryCatch try_catch(isolate);
+      try_catch.SetVerbose(true);
+      v8::Local<v8::Value> result;
+      if (script->BindToCurrentContext()->Run(context).ToLocal(&result))
+        results[0] = result;
+    }
+    self->Completed(results);
+
+    return handle;
+  }
+
   blink::WebCacheResourceTypeStats GetResourceUsage(v8::Isolate* isolate) {
     blink::WebCacheResourceTypeStats stats;
     blink::WebCache::GetResourceTypeStats(&stats);
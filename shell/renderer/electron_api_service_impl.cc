@@ -5,14 +5,18 @@
 #include "electron/shell/renderer/electron_api_service_impl.h"
 
 #include <memory>
+#include <string>
 #include <tuple>
 #include <utility>
 #include <vector>
 
+#include "base/barrier_callback.h"
 #include "base/environment.h"
 #include "base/trace_event/trace_event.h"
+#include "content/public/common/isolated_world_ids.h"
 #include "gin/data_object_builder.h"
 #include "mojo/public/cpp/system/platform_handle.h"
+#include "shell/common/crash_keys.h"
 #include "shell/common/electron_constants.h"
 #include "shell/common/gin_converters/blink_converter.h"
 #include "shell/common/gin_converters/value_converter.h"
@@ -25,9 +29,15 @@
 #include "shell/renderer/renderer_client_base.h"
 #include "third_party/blink/public/mojom/frame/user_activation_notification_type.mojom-shared.h"
 #include "third_party/blink/public/platform/scheduler/web_agent_group_scheduler.h"
+#include "third_party/blink/public/platform/web_cache.h"
 #include "third_party/blink/public/web/blink.h"
+#include "third_party/blink/public/web/web_document.h"
 #include "third_party/blink/public/web/web_local_frame.h"
 #include "third_party/blink/public/web/web_message_port_converter.h"
+#include "third_party/blink/public/web/web_node.h"
+#include "third_party/blink/public/web/web_script_execution_callback.h"
+#include "third_party/blink/public/web/web_script_source.h"
+#include "v8/include/v8-statistics.h"
 
 namespace electron {
 
@@ -96,6 +106,112 @@ void EmitIPCEvent(v8::Local<v8::Context> context,
   InvokeIpcCallback(context, "onMessage", argv);
 }
 
+size_t CountDOMNodes(const blink::WebNode& root) {
+  size_t count = 0;
+  std::vector<blink::WebNode> stack = {root};
+  while (!stack.empty()) {
+    blink::WebNode node = std::move(stack.back());
+    stack.pop_back();
+    ++count;
+    for (blink::WebNode child = node.FirstChild(); !child.IsNull();
+         child = child.NextSibling()) {
+      stack.push_back(child);
+    }
+  }
+  return count;
+}
+
+// Sums the V8 heap attributed to every context (main world and isolated
+// worlds) of one frame.
+class FrameMemoryMeasurementDelegate : public v8::MeasureMemoryDelegate {
+ public:
+  using Callback = base::OnceCallback<void(uint64_t)>;
+
+  FrameMemoryMeasurementDelegate(const blink::LocalFrameToken& frame_token,
+                                 Callback callback)
+      : frame_token_(frame_token), callback_(std::move(callback)) {}
+
+  // disable copy
+  FrameMemoryMeasurementDelegate(const FrameMemoryMeasurementDelegate&) =
+      delete;
+  FrameMemoryMeasurementDelegate& operator=(
+      const FrameMemoryMeasurementDelegate&) = delete;
+
+  ~FrameMemoryMeasurementDelegate() override {
+    if (callback_)
+      std::move(callback_).Run(0);
+  }
+
+  // v8::MeasureMemoryDelegate:
+  bool ShouldMeasure(v8::Local<v8::Context> context) override {
+    blink::WebLocalFrame* frame =
+        blink::WebLocalFrame::FrameForContext(context);
+    return frame && frame->GetLocalFrameToken() == frame_token_;
+  }
+
+  void MeasurementComplete(Result result) override {
+    uint64_t total = 0;
+    for (size_t size : result.sizes_in_bytes)
+      total += size;
+    std::move(callback_).Run(total);
+  }
+
+ private:
+  const blink::LocalFrameToken frame_token_;
+  Callback callback_;
+};
+
+constexpr char kFrameRemovedError[] =
+    "WebFrame was removed before script could run. This normally means the "
+    "underlying frame was destroyed";
+
+mojom::FrameScriptResultPtr FrameScriptError(std::string error) {
+  auto result = mojom::FrameScriptResult::New();
+  result->error = std::move(error);
+  return result;
+}
+
+// Serializes what the script evaluated to in |frame| to send it to the
+// browser.
+mojom::FrameScriptResultPtr FrameScriptValue(blink::WebLocalFrame* frame,
+                                             v8::Local<v8::Value> value) {
+  v8::Isolate* isolate = frame->GetAgentGroupScheduler()->Isolate();
+  v8::HandleScope handle_scope(isolate);
+  v8::Context::Scope context_scope(frame->MainWorldScriptContext());
+  v8::TryCatch try_catch(isolate);
+  blink::CloneableMessage message;
+  if (!electron::SerializeV8Value(isolate, value, &message)) {
+    std::string error = "An object could not be cloned.";
+    if (try_catch.HasCaught() && !try_catch.Message().IsEmpty())
+      gin::ConvertFromV8(isolate, try_catch.Message()->Get(), &error);
+    return FrameScriptError(std::move(error));
+  }
+  auto result = mojom::FrameScriptResult::New();
+  result->value = std::move(message);
+  return result;
+}
+
+using IndexedFrameScriptResult = std::pair<size_t, mojom::FrameScriptResultPtr>;
+
+void OnFrameScriptExecuted(
+    size_t index,
+    const blink::LocalFrameToken& frame_token,
+    base::RepeatingCallback<void(IndexedFrameScriptResult)> barrier,
+    const blink::WebVector<v8::Local<v8::Value>>& results) {
+  blink::WebLocalFrame* frame =
+      blink::WebLocalFrame::FromFrameToken(frame_token);
+  if (!frame || results.empty()) {
+    barrier.Run({index, FrameScriptError(kFrameRemovedError)});
+  } else if (results[0].IsEmpty()) {
+    barrier.Run({index, FrameScriptError(
+                            "Script failed to execute, this normally means an "
+                            "error was thrown. Check the renderer console for "
+                            "the error.")});
+  } else {
+    barrier.Run({index, FrameScriptValue(frame, results[0])});
+  }
+}
+
 }  // namespace
 
 ElectronApiServiceImpl::~ElectronApiServiceImpl() = default;
@@ -154,6 +270,7 @@ void ElectronApiServiceImpl::OnConnectionError() {
 void ElectronApiServiceImpl::Message(bool internal,
                                      const std::string& channel,
                                      blink::CloneableMessage arguments) {
+  crash_keys::RecordBreadcrumb(crash_keys::BreadcrumbKind::kIpc, channel);
   blink::WebLocalFrame* frame = render_frame()->GetWebFrame();
   if (!frame)
     return;
@@ -182,7 +299,7 @@ void ElectronApiServiceImpl::ReceivePostMessage(
   v8::Local<v8::Context> context = renderer_client_->GetContext(frame, isolate);
   v8::Context::Scope context_scope(context);
 
-  v8::Local<v8::Value> message_value = DeserializeV8Value(isolate, message);
+  v8::Local<v8::Value> message_value = DeserializeV8Value(isolate, &message);
 
   std::vector<v8::Local<v8::Value>> ports;
   for (auto& port : message.ports) {
@@ -214,10 +331,103 @@ void ElectronApiServiceImpl::TakeHeapSnapshot(
   }
   base::File base_file(std::move(platform_file));
 
+  // The snapshot is written off the main thread, so that the renderer doesn't
+  // freeze for the time it takes to write a large heap to disk.
+  v8::Isolate* isolate = frame->GetAgentGroupScheduler()->Isolate();
+  electron::TakeHeapSnapshotAsync(isolate, std::move(base_file),
+                                  std::move(callback));
+}
+
+void ElectronApiServiceImpl::GetResourceUsage(
+    GetResourceUsageCallback callback) {
+  blink::WebLocalFrame* frame = render_frame()->GetWebFrame();
+  if (!frame) {
+    std::move(callback).Run(nullptr);
+    return;
+  }
+
+  auto usage = mojom::FrameResourceUsage::New();
+  usage->dom_node_count = CountDOMNodes(frame->GetDocument());
+
+  v8::Isolate* isolate = frame->GetAgentGroupScheduler()->Isolate();
+  v8::HandleScope handle_scope(isolate);
+  isolate->MeasureMemory(
+      std::make_unique<FrameMemoryMeasurementDelegate>(
+          frame->GetLocalFrameToken(),
+          base::BindOnce(
+              [](mojom::FrameResourceUsagePtr usage,
+                 GetResourceUsageCallback callback, uint64_t js_heap_size) {
+                usage->js_heap_size = js_heap_size;
+                std::move(callback).Run(std::move(usage));
+              },
+              std::move(usage), std::move(callback))),
+      v8::MeasureMemoryExecution::kEager);
+}
+
+void ElectronApiServiceImpl::ExecuteJavaScriptInFrames(
+    const std::vector<blink::LocalFrameToken>& frames,
+    const std::u16string& code,
+    bool user_gesture,
+    ExecuteJavaScriptInFramesCallback callback) {
+  auto barrier = base::BarrierCallback<IndexedFrameScriptResult>(
+      frames.size(),
+      base::BindOnce(
+          [](ExecuteJavaScriptInFramesCallback callback,
+             std::vector<IndexedFrameScriptResult> indexed_results) {
+            // Scripts complete in any order, promises settling last.
+            std::vector<mojom::FrameScriptResultPtr> results(
+                indexed_results.size());
+            for (auto& [index, result] : indexed_results)
+              results[index] = std::move(result);
+            std::move(callback).Run(std::move(results));
+          },
+          std::move(callback)));
+
+  const blink::WebScriptSource source{blink::WebString::FromUTF16(code)};
+  for (size_t i = 0; i < frames.size(); ++i) {
+    blink::WebLocalFrame* frame =
+        blink::WebLocalFrame::FromFrameToken(frames[i]);
+    if (!frame) {
+      barrier.Run({i, FrameScriptError(kFrameRemovedError)});
+      continue;
+    }
+    frame->RequestExecuteScript(
+        content::ISOLATED_WORLD_ID_GLOBAL, base::make_span(&source, 1u),
+        user_gesture ? blink::mojom::UserActivationOption::kActivate
+                     : blink::mojom::UserActivationOption::kDoNotActivate,
+        blink::mojom::EvaluationTiming::kSynchronous,
+        blink::mojom::LoadEventBlockingOption::kDoNotBlock,
+        base::NullCallback(),
+        base::BindOnce(&OnFrameScriptExecuted, i, frames[i], barrier),
+        blink::BackForwardCacheAware::kAllow,
+        blink::mojom::WantResultOption::kWantResult,
+        blink::mojom::PromiseResultOption::kAwait);
+  }
+}
+
+void ElectronApiServiceImpl::PurgeMemory(
+    base::MemoryPressureListener::MemoryPressureLevel level,
+    PurgeMemoryCallback callback) {
+  blink::WebLocalFrame* frame = render_frame()->GetWebFrame();
+  if (!frame ||
+      level == base::MemoryPressureListener::MEMORY_PRESSURE_LEVEL_NONE) {
+    std::move(callback).Run();
+    return;
+  }
+
+  const bool critical =
+      level == base::MemoryPressureListener::MEMORY_PRESSURE_LEVEL_CRITICAL;
+  // Same as webFrame.clearCache(), which also drops the decoded images.
+  if (critical)
+    blink::WebCache::Clear();
+  base::MemoryPressureListener::NotifyMemoryPressure(level);
+
   v8::Isolate* isolate = frame->GetAgentGroupScheduler()->Isolate();
-  bool success = electron::TakeHeapSnapshot(isolate, &base_file);
+  isolate->MemoryPressureNotification(
+      critical ? v8::MemoryPressureLevel::kCritical
+               : v8::MemoryPressureLevel::kModerate);
 
-  std::move(callback).Run(success);
+  std::move(callback).Run();
 }
 
 }  // namespace electron
@@ -6,7 +6,9 @@
 #define ELECTRON_SHELL_RENDERER_ELECTRON_API_SERVICE_IMPL_H_
 
 #include <string>
+#include <vector>
 
+#include "base/memory/memory_pressure_listener.h"
 #include "base/memory/weak_ptr.h"
 #include "content/public/renderer/render_frame.h"
 #include "content/public/renderer/render_frame_observer.h"
@@ -39,6 +41,14 @@ class ElectronApiServiceImpl : public mojom::ElectronRenderer,
                           blink::TransferableMessage message) override;
   void TakeHeapSnapshot(mojo::ScopedHandle file,
                         TakeHeapSnapshotCallback callback) override;
+  void GetResourceUsage(GetResourceUsageCallback callback) override;
+  void ExecuteJavaScriptInFrames(
+      const std::vector<blink::LocalFrameToken>& frames,
+      const std::u16string& code,
+      bool user_gesture,
+      ExecuteJavaScriptInFramesCallback callback) override;
+  void PurgeMemory(base::MemoryPressureListener::MemoryPressureLevel level,
+                   PurgeMemoryCallback callback) override;
   void ProcessPendingMessages();
 
   base::WeakPtr<ElectronApiServiceImpl> GetWeakPtr() {
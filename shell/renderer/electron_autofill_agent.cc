@@ -8,6 +8,8 @@
 #include <utility>
 #include <vector>
 
+#include "base/i18n/case_conversion.h"
+#include "base/strings/string_util.h"
 #include "content/public/renderer/render_frame.h"
 #include "third_party/blink/public/common/associated_interfaces/associated_interface_provider.h"
 #include "third_party/blink/public/common/input/web_keyboard_event.h"
@@ -37,16 +39,41 @@ void TrimStringVectorForIPC(std::vector<std::u16string>* strings) {
   }
 }
 
-// Copied from components/autofill/content/renderer/form_autofill_util.cc.
+// Based on components/autofill/content/renderer/form_autofill_util.cc.
+//
+// Blink keeps the options whose value or label contains the typed text.
+// Options that start with it are listed first, so that they are the ones
+// kept when a long datalist is trimmed to kMaxListSize.
 void GetDataListSuggestions(const blink::WebInputElement& element,
                             std::vector<std::u16string>* values,
                             std::vector<std::u16string>* labels) {
+  const std::u16string typed = base::i18n::ToLower(element.Value().Utf16());
+  std::vector<std::u16string> other_values;
+  std::vector<std::u16string> other_labels;
   for (const auto& option : element.FilteredDataListOptions()) {
-    values->push_back(option.Value().Utf16());
+    if (values->size() >= kMaxListSize)
+      break;
+    std::u16string value = option.Value().Utf16();
+    std::u16string label;
     if (option.Value() != option.Label())
-      labels->push_back(option.Label().Utf16());
-    else
-      labels->emplace_back();
+      label = option.Label().Utf16();
+
+    bool is_prefix_match =
+        base::StartsWith(base::i18n::ToLower(value), typed) ||
+        (!label.empty() && base::StartsWith(base::i18n::ToLower(label), typed));
+    if (is_prefix_match) {
+      values->push_back(std::move(value));
+      labels->push_back(std::move(label));
+    } else if (values->size() + other_values.size() < kMaxListSize) {
+      other_values.push_back(std::move(value));
+      other_labels.push_back(std::move(label));
+    }
+  }
+
+  for (size_t i = 0; i < other_values.size() && values->size() < kMaxListSize;
+       ++i) {
+    values->push_back(std::move(other_values[i]));
+    labels->push_back(std::move(other_labels[i]));
   }
 
   TrimStringVectorForIPC(values);
@@ -4,7 +4,6 @@
 
 #include "shell/renderer/electron_renderer_client.h"
 
-#include "base/command_line.h"
 #include "base/containers/contains.h"
 #include "base/debug/stack_trace.h"
 #include "content/public/renderer/render_frame.h"
@@ -15,17 +14,29 @@
 #include "shell/common/gin_helper/event_emitter_caller.h"
 #include "shell/common/node_bindings.h"
 #include "shell/common/node_includes.h"
-#include "shell/common/options_switches.h"
 #include "shell/renderer/electron_render_frame_observer.h"
 #include "shell/renderer/web_worker_observer.h"
 #include "third_party/blink/public/common/web_preferences/web_preferences.h"
+#include "third_party/blink/public/platform/web_security_origin.h"
 #include "third_party/blink/public/web/web_document.h"
 #include "third_party/blink/public/web/web_local_frame.h"
 #include "third_party/blink/renderer/core/execution_context/execution_context.h"  // nogncheck
 #include "third_party/blink/renderer/core/frame/web_local_frame_impl.h"  // nogncheck
+#include "third_party/blink/renderer/core/workers/dedicated_worker_global_scope.h"  // nogncheck
 
 namespace electron {
 
+namespace {
+
+// The globals that lib/renderer/init.ts and Node.js put on a frame's global
+// object. A sub-frame that shares the environment of its main frame gets the
+// same values.
+constexpr const char* kSharedNodeGlobals[] = {
+    "process", "require", "module",       "__filename",    "__dirname",
+    "Buffer",  "global",  "setImmediate", "clearImmediate"};
+
+}  // namespace
+
 ElectronRendererClient::ElectronRendererClient()
     : node_bindings_{NodeBindings::Create(
           NodeBindings::BrowserEnvironment::kRenderer)},
@@ -74,6 +85,22 @@ void ElectronRendererClient::UndeferLoad(content::RenderFrame* render_frame) {
 void ElectronRendererClient::DidCreateScriptContext(
     v8::Handle<v8::Context> renderer_context,
     content::RenderFrame* render_frame) {
+  // Dedicated workers started by this document get Node.js according to the
+  // web preferences the frame has now, which are delivered with the frame
+  // rather than on the command line of the process.
+  const blink::web_pref::WebPreferences& prefs =
+      render_frame->GetBlinkPreferences();
+  auto worker_node_integration = WebWorkerObserver::NodeIntegration::kDisabled;
+  if (prefs.node_integration_in_worker) {
+    worker_node_integration =
+        prefs.lazy_node_integration_in_worker
+            ? WebWorkerObserver::NodeIntegration::kLazy
+            : WebWorkerObserver::NodeIntegration::kEnabled;
+  }
+  WebWorkerObserver::SetNodeIntegrationForChildren(
+      render_frame->GetWebFrame()->GetLocalFrameToken(),
+      worker_node_integration);
+
   // TODO(zcbenz): Do not create Node environment if node integration is not
   // enabled.
 
@@ -82,6 +109,12 @@ void ElectronRendererClient::DidCreateScriptContext(
   if (!ShouldLoadPreload(renderer_context, render_frame))
     return;
 
+  if (!render_frame->IsMainFrame() &&
+      prefs.shared_node_integration_in_sub_frames &&
+      ShareMainFrameEnvironment(renderer_context, render_frame)) {
+    return;
+  }
+
   injected_frames_.insert(render_frame);
 
   if (!node_integration_initialized_) {
@@ -154,6 +187,9 @@ void ElectronRendererClient::DidCreateScriptContext(
 void ElectronRendererClient::WillReleaseScriptContext(
     v8::Handle<v8::Context> context,
     content::RenderFrame* render_frame) {
+  WebWorkerObserver::ClearNodeIntegrationForChildren(
+      render_frame->GetWebFrame()->GetLocalFrameToken());
+
   if (injected_frames_.erase(render_frame) == 0)
     return;
 
@@ -199,14 +235,23 @@ void ElectronRendererClient::WorkerScriptReadyForEvaluationOnWorkerThread(
       ec->IsMainThreadWorkletGlobalScope())
     return;
 
-  // This won't be correct for in-process child windows with webPreferences
-  // that have a different value for nodeIntegrationInWorker
-  if (base::CommandLine::ForCurrentProcess()->HasSwitch(
-          switches::kNodeIntegrationInWorker)) {
-    auto* current = WebWorkerObserver::GetCurrent();
-    if (current)
-      return;
-    WebWorkerObserver::Create()->WorkerScriptReadyForEvaluation(context);
+  // A dedicated worker follows the preferences of the frame or worker that
+  // created it, and passes them on to the workers it creates itself.
+  // Threaded worklets can't tell which frame they belong to.
+  WebWorkerObserver::NodeIntegration integration;
+  if (auto* worker = blink::DynamicTo<blink::DedicatedWorkerGlobalScope>(ec)) {
+    integration = WebWorkerObserver::GetNodeIntegrationForChildren(
+        worker->GetParentExecutionContextToken());
+    WebWorkerObserver::SetNodeIntegrationForChildren(
+        worker->GetExecutionContextToken(), integration);
+  } else {
+    integration = WebWorkerObserver::GetNodeIntegrationForProcess();
+  }
+
+  if (integration != WebWorkerObserver::NodeIntegration::kDisabled &&
+      !WebWorkerObserver::GetCurrent()) {
+    WebWorkerObserver::Create()->WorkerScriptReadyForEvaluation(context,
+                                                                integration);
   }
 }
 
@@ -217,14 +262,48 @@ void ElectronRendererClient::WillDestroyWorkerContextOnWorkerThread(
       ec->IsMainThreadWorkletGlobalScope())
     return;
 
-  // TODO(loc): Note that this will not be correct for in-process child windows
-  // with webPreferences that have a different value for nodeIntegrationInWorker
-  if (base::CommandLine::ForCurrentProcess()->HasSwitch(
-          switches::kNodeIntegrationInWorker)) {
-    auto* current = WebWorkerObserver::GetCurrent();
-    if (current)
-      current->ContextWillDestroy(context);
+  if (ec->IsDedicatedWorkerGlobalScope()) {
+    WebWorkerObserver::ClearNodeIntegrationForChildren(
+        ec->GetExecutionContextToken());
+  }
+
+  if (auto* current = WebWorkerObserver::GetCurrent())
+    current->ContextWillDestroy(context);
+}
+
+bool ElectronRendererClient::ShareMainFrameEnvironment(
+    v8::Local<v8::Context> context,
+    content::RenderFrame* render_frame) {
+  blink::WebFrame* top = render_frame->GetWebFrame()->Top();
+  if (!top || !top->IsWebLocalFrame())
+    return false;
+  blink::WebLocalFrame* main_frame = top->ToWebLocalFrame();
+
+  // Objects of the main frame can only be used from frames of the same
+  // origin, anything else gets its own environment.
+  if (!render_frame->GetWebFrame()->GetSecurityOrigin().IsSameOriginWith(
+          main_frame->GetSecurityOrigin())) {
+    return false;
+  }
+
+  node::Environment* env =
+      GetEnvironment(content::RenderFrame::FromWebFrame(main_frame));
+  if (!env)
+    return false;
+
+  v8::Isolate* isolate = env->isolate();
+  v8::Local<v8::Context> env_context = env->context();
+  v8::Local<v8::Object> source = env_context->Global();
+  v8::Local<v8::Object> target = context->Global();
+  for (const char* name : kSharedNodeGlobals) {
+    v8::Local<v8::String> key = gin::StringToV8(isolate, name);
+    v8::Local<v8::Value> value;
+    if (source->Get(env_context, key).ToLocal(&value) &&
+        !value->IsUndefined()) {
+      target->Set(context, key, value).Check();
+    }
   }
+  return true;
 }
 
 node::Environment* ElectronRendererClient::GetEnvironment(
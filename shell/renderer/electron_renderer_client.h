@@ -48,6 +48,12 @@ class ElectronRendererClient : public RendererClientBase {
 
   node::Environment* GetEnvironment(content::RenderFrame* frame) const;
 
+  // Exposes the Node.js environment of the main frame in |context| of a
+  // same-origin sub-frame instead of creating a new one. Returns false when
+  // the sub-frame needs an environment of its own.
+  bool ShareMainFrameEnvironment(v8::Local<v8::Context> context,
+                                 content::RenderFrame* render_frame);
+
   // Whether the node integration has been initialized.
   bool node_integration_initialized_ = false;
 
@@ -4,14 +4,20 @@
 
 #include "shell/renderer/electron_sandboxed_renderer_client.h"
 
+#include <cstring>
 #include <iterator>
+#include <memory>
+#include <string>
 #include <tuple>
+#include <utility>
 #include <vector>
 
 #include "base/base_paths.h"
 #include "base/command_line.h"
 #include "base/containers/contains.h"
+#include "base/containers/lru_cache.h"
 #include "base/files/file_path.h"
+#include "base/no_destructor.h"
 #include "base/path_service.h"
 #include "base/process/process_handle.h"
 #include "base/process/process_metrics.h"
@@ -39,6 +45,9 @@ namespace {
 const char kEmitProcessEventKey[] = "emit-process-event";
 const char kBindingCacheKey[] = "native-binding-cache";
 
+// Far more than the preload scripts a renderer process normally runs.
+constexpr size_t kMaxCachedPreloads = 32;
+
 v8::Local<v8::Object> GetBindingCache(v8::Isolate* isolate) {
   auto context = isolate->GetCurrentContext();
   gin_helper::Dictionary global(isolate, context->Global());
@@ -83,14 +92,128 @@ v8::Local<v8::Value> GetBinding(v8::Isolate* isolate,
   return exports;
 }
 
-v8::Local<v8::Value> CreatePreloadScript(v8::Isolate* isolate,
-                                         v8::Local<v8::String> source) {
+// Compiles |source| as the body of a function taking |params|, consuming
+// |code_cache| when it is a Uint8Array created by CreatePreloadCodeCache.
+v8::Local<v8::Value> CreatePreloadScript(
+    v8::Isolate* isolate,
+    v8::Local<v8::String> source,
+    std::vector<v8::Local<v8::String>> params,
+    v8::Local<v8::Value> code_cache) {
   auto context = isolate->GetCurrentContext();
-  auto maybe_script = v8::Script::Compile(context, source);
-  v8::Local<v8::Script> script;
-  if (!maybe_script.ToLocal(&script))
+
+  v8::ScriptCompiler::CachedData* cached_data = nullptr;
+  if (code_cache->IsArrayBufferView()) {
+    auto view = code_cache.As<v8::ArrayBufferView>();
+    cached_data = new v8::ScriptCompiler::CachedData(
+        static_cast<const uint8_t*>(view->Buffer()->Data()) +
+            view->ByteOffset(),
+        static_cast<int>(view->ByteLength()));
+  }
+  // |script_source| takes ownership of |cached_data|.
+  v8::ScriptCompiler::Source script_source(source, cached_data);
+
+  v8::Local<v8::Function> fn;
+  if (!v8::ScriptCompiler::CompileFunction(
+           context, &script_source, params.size(), params.data(), 0, nullptr,
+           cached_data ? v8::ScriptCompiler::kConsumeCodeCache
+                       : v8::ScriptCompiler::kNoCompileOptions)
+           .ToLocal(&fn))
     return v8::Local<v8::Value>();
-  return script->Run(context).ToLocalChecked();
+
+  auto result = gin_helper::Dictionary::CreateEmpty(isolate);
+  result.Set("preloadFn", fn);
+  result.Set("codeCacheRejected", cached_data && cached_data->rejected);
+  return result.GetHandle();
+}
+
+v8::Local<v8::Value> ToUint8Array(v8::Isolate* isolate,
+                                  const uint8_t* data,
+                                  size_t length) {
+  auto buffer = v8::ArrayBuffer::New(isolate, length);
+  memcpy(buffer->Data(), data, length);
+  return v8::Uint8Array::New(buffer, 0, length);
+}
+
+std::vector<uint8_t> GetBytes(v8::Local<v8::Value> value) {
+  std::vector<uint8_t> bytes;
+  if (value->IsArrayBufferView()) {
+    auto view = value.As<v8::ArrayBufferView>();
+    bytes.resize(view->ByteLength());
+    view->CopyContents(bytes.data(), bytes.size());
+  }
+  return bytes;
+}
+
+// Creates a code cache for a function returned by CreatePreloadScript. This
+// is done after the preload has run, so that the functions it called are in
+// the cache as well.
+v8::Local<v8::Value> CreatePreloadCodeCache(v8::Isolate* isolate,
+                                            v8::Local<v8::Function> fn) {
+  std::unique_ptr<v8::ScriptCompiler::CachedData> cached_data(
+      v8::ScriptCompiler::CreateCodeCacheForFunction(fn));
+  if (!cached_data)
+    return v8::Null(isolate);
+  return ToUint8Array(isolate, cached_data->data, cached_data->length);
+}
+
+// The preload scripts this process already received, by the key the browser
+// process gave them. Every frame of the process runs in the same isolate, so
+// later frames reuse the source string instead of having it sent again, and
+// consume the code cache created after the first run.
+struct CachedPreload {
+  v8::Global<v8::String> source;
+  std::vector<uint8_t> code_cache;
+};
+
+using PreloadCache = base::LRUCache<std::string, CachedPreload>;
+
+PreloadCache& GetPreloadCache() {
+  static base::NoDestructor<PreloadCache> cache(kMaxCachedPreloads);
+  return *cache;
+}
+
+std::vector<std::string> GetCachedPreloadKeys() {
+  std::vector<std::string> keys;
+  for (const auto& [key, preload] : GetPreloadCache())
+    keys.push_back(key);
+  return keys;
+}
+
+v8::Local<v8::Value> GetCachedPreload(v8::Isolate* isolate,
+                                      const std::string& key) {
+  PreloadCache& cache = GetPreloadCache();
+  auto iter = cache.Get(key);
+  if (iter == cache.end())
+    return v8::Null(isolate);
+
+  const CachedPreload& preload = iter->second;
+  auto result = gin_helper::Dictionary::CreateEmpty(isolate);
+  result.Set("preloadSrc", preload.source.Get(isolate));
+  if (preload.code_cache.empty()) {
+    result.Set("codeCache", v8::Null(isolate));
+  } else {
+    result.Set("codeCache",
+               ToUint8Array(isolate, preload.code_cache.data(),
+                            preload.code_cache.size()));
+  }
+  return result.GetHandle();
+}
+
+void SetCachedPreload(v8::Isolate* isolate,
+                      const std::string& key,
+                      v8::Local<v8::String> source,
+                      v8::Local<v8::Value> code_cache) {
+  CachedPreload preload;
+  preload.source.Reset(isolate, source);
+  preload.code_cache = GetBytes(code_cache);
+  GetPreloadCache().Put(key, std::move(preload));
+}
+
+void SetCachedPreloadCodeCache(const std::string& key,
+                               v8::Local<v8::Value> code_cache) {
+  PreloadCache& cache = GetPreloadCache();
+  if (auto iter = cache.Peek(key); iter != cache.end())
+    iter->second.code_cache = GetBytes(code_cache);
 }
 
 double Uptime() {
@@ -137,6 +260,11 @@ void ElectronSandboxedRendererClient::InitializeBindings(
   gin_helper::Dictionary b(isolate, binding);
   b.SetMethod("get", GetBinding);
   b.SetMethod("createPreloadScript", CreatePreloadScript);
+  b.SetMethod("createPreloadCodeCache", CreatePreloadCodeCache);
+  b.SetMethod("getCachedPreloadKeys", GetCachedPreloadKeys);
+  b.SetMethod("getCachedPreload", GetCachedPreload);
+  b.SetMethod("setCachedPreload", SetCachedPreload);
+  b.SetMethod("setCachedPreloadCodeCache", SetCachedPreloadCodeCache);
 
   auto process = gin_helper::Dictionary::CreateEmpty(isolate);
   b.Set("process", process);
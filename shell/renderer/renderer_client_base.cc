@@ -24,6 +24,7 @@
 #include "printing/buildflags/buildflags.h"
 #include "shell/browser/api/electron_api_protocol.h"
 #include "shell/common/api/electron_api_native_image.h"
+#include "shell/common/api/electron_bindings.h"
 #include "shell/common/color_util.h"
 #include "shell/common/gin_helper/dictionary.h"
 #include "shell/common/node_includes.h"
@@ -151,9 +152,14 @@ bool IsDevToolsExtension(content::RenderFrame* render_frame) {
       "chrome-extension");
 }
 
+void DumpBlinkPartitions(partition_alloc::PartitionStatsDumper* dumper) {
+  blink::DumpPartitionsMemoryStats(true /* is_light_dump */, dumper);
+}
+
 }  // namespace
 
 RendererClientBase::RendererClientBase() {
+  ElectronBindings::SetBlinkPartitionsDumper(&DumpBlinkPartitions);
   auto* command_line = base::CommandLine::ForCurrentProcess();
   // Parse --service-worker-schemes=scheme1,scheme2
   std::vector<std::string> service_worker_schemes_list =
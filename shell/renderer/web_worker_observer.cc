@@ -7,8 +7,12 @@
 #include <set>
 #include <utility>
 
+#include "base/check_op.h"
+#include "base/containers/flat_map.h"
 #include "base/no_destructor.h"
 #include "base/ranges/algorithm.h"
+#include "base/synchronization/lock.h"
+#include "base/thread_annotations.h"
 #include "base/threading/thread_local.h"
 #include "shell/common/api/electron_bindings.h"
 #include "shell/common/gin_helper/event_emitter_caller.h"
@@ -22,6 +26,24 @@ namespace {
 static base::NoDestructor<base::ThreadLocalOwnedPointer<WebWorkerObserver>>
     lazy_tls;
 
+// The globals that Node.js and the worker init script define on the global
+// object of a worker.
+constexpr const char* kLazyGlobals[] = {
+    "require",      "module",         "process",    "Buffer",   "global",
+    "setImmediate", "clearImmediate", "__filename", "__dirname"};
+
+struct NodeIntegrationMap {
+  base::Lock lock;
+  base::flat_map<blink::ExecutionContextToken,
+                 WebWorkerObserver::NodeIntegration>
+      map GUARDED_BY(lock);
+};
+
+NodeIntegrationMap& GetNodeIntegrationMap() {
+  static base::NoDestructor<NodeIntegrationMap> node_integration_map;
+  return *node_integration_map;
+}
+
 }  // namespace
 
 // static
@@ -37,6 +59,49 @@ WebWorkerObserver* WebWorkerObserver::Create() {
   return obs_raw;
 }
 
+// static
+void WebWorkerObserver::SetNodeIntegrationForChildren(
+    const blink::ExecutionContextToken& parent,
+    NodeIntegration integration) {
+  NodeIntegrationMap& node_integration = GetNodeIntegrationMap();
+  base::AutoLock lock(node_integration.lock);
+  node_integration.map.insert_or_assign(parent, integration);
+}
+
+// static
+void WebWorkerObserver::ClearNodeIntegrationForChildren(
+    const blink::ExecutionContextToken& parent) {
+  NodeIntegrationMap& node_integration = GetNodeIntegrationMap();
+  base::AutoLock lock(node_integration.lock);
+  node_integration.map.erase(parent);
+}
+
+// static
+WebWorkerObserver::NodeIntegration
+WebWorkerObserver::GetNodeIntegrationForChildren(
+    const blink::ExecutionContextToken& parent) {
+  NodeIntegrationMap& node_integration = GetNodeIntegrationMap();
+  base::AutoLock lock(node_integration.lock);
+  auto it = node_integration.map.find(parent);
+  return it != node_integration.map.end() ? it->second
+                                          : NodeIntegration::kDisabled;
+}
+
+// static
+WebWorkerObserver::NodeIntegration
+WebWorkerObserver::GetNodeIntegrationForProcess() {
+  NodeIntegrationMap& node_integration = GetNodeIntegrationMap();
+  base::AutoLock lock(node_integration.lock);
+  NodeIntegration result = NodeIntegration::kDisabled;
+  for (const auto& [token, integration] : node_integration.map) {
+    if (integration == NodeIntegration::kEnabled)
+      return integration;
+    if (integration == NodeIntegration::kLazy)
+      result = integration;
+  }
+  return result;
+}
+
 WebWorkerObserver::WebWorkerObserver()
     : node_bindings_(
           NodeBindings::Create(NodeBindings::BrowserEnvironment::kWorker)),
@@ -46,8 +111,53 @@ WebWorkerObserver::WebWorkerObserver()
 WebWorkerObserver::~WebWorkerObserver() = default;
 
 void WebWorkerObserver::WorkerScriptReadyForEvaluation(
-    v8::Local<v8::Context> worker_context) {
+    v8::Local<v8::Context> worker_context,
+    NodeIntegration integration) {
+  DCHECK_NE(integration, NodeIntegration::kDisabled);
   v8::Context::Scope context_scope(worker_context);
+  if (integration == NodeIntegration::kLazy) {
+    InstallLazyGlobals(worker_context);
+    return;
+  }
+  CreateEnvironment(worker_context);
+}
+
+void WebWorkerObserver::InstallLazyGlobals(v8::Local<v8::Context> context) {
+  v8::Isolate* isolate = context->GetIsolate();
+  v8::Local<v8::Object> global = context->Global();
+  for (const char* name : kLazyGlobals) {
+    global
+        ->SetLazyDataProperty(context, gin::StringToSymbol(isolate, name),
+                              &WebWorkerObserver::LazyGlobalGetter)
+        .Check();
+  }
+}
+
+// static
+void WebWorkerObserver::LazyGlobalGetter(
+    v8::Local<v8::Name> name,
+    const v8::PropertyCallbackInfo<v8::Value>& info) {
+  v8::Isolate* isolate = info.GetIsolate();
+  v8::Local<v8::Context> context = isolate->GetCurrentContext();
+  v8::Local<v8::Object> global = context->Global();
+
+  // The first lazy global to be read creates the environment, which defines
+  // the real ones in place of the others.
+  auto* observer = GetCurrent();
+  if (observer && !node::Environment::GetCurrent(context)) {
+    for (const char* lazy_name : kLazyGlobals) {
+      global->Delete(context, gin::StringToSymbol(isolate, lazy_name)).Check();
+    }
+    observer->CreateEnvironment(context);
+  }
+
+  v8::Local<v8::Value> value;
+  if (global->Get(context, name).ToLocal(&value))
+    info.GetReturnValue().Set(value);
+}
+
+void WebWorkerObserver::CreateEnvironment(
+    v8::Local<v8::Context> worker_context) {
   auto* isolate = worker_context->GetIsolate();
   v8::MicrotasksScope microtasks_scope(
       isolate, worker_context->GetMicrotaskQueue(),
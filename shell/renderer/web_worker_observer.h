@@ -8,6 +8,7 @@
 #include <memory>
 
 #include "base/containers/flat_set.h"
+#include "third_party/blink/public/common/tokens/tokens.h"
 #include "v8/include/v8.h"
 
 namespace node {
@@ -32,14 +33,41 @@ class WebWorkerObserver {
   // Creates a new WebWorkerObserver for a given context.
   static WebWorkerObserver* Create();
 
+  // How dedicated workers created by a frame or worker get Node.js.
+  enum class NodeIntegration { kDisabled, kEnabled, kLazy };
+
+  // Frames record the integration of their workers from their web
+  // preferences on the main thread, and workers look up the one of the
+  // context that created them on their own thread, so each frame of the
+  // process can have its own.
+  static void SetNodeIntegrationForChildren(
+      const blink::ExecutionContextToken& parent,
+      NodeIntegration integration);
+  static void ClearNodeIntegrationForChildren(
+      const blink::ExecutionContextToken& parent);
+  static NodeIntegration GetNodeIntegrationForChildren(
+      const blink::ExecutionContextToken& parent);
+  // The most permissive integration of any frame of the process, for workers
+  // whose creator isn't known.
+  static NodeIntegration GetNodeIntegrationForProcess();
+
   // disable copy
   WebWorkerObserver(const WebWorkerObserver&) = delete;
   WebWorkerObserver& operator=(const WebWorkerObserver&) = delete;
 
-  void WorkerScriptReadyForEvaluation(v8::Local<v8::Context> context);
+  void WorkerScriptReadyForEvaluation(v8::Local<v8::Context> context,
+                                      NodeIntegration integration);
   void ContextWillDestroy(v8::Local<v8::Context> context);
 
  private:
+  // Defines the Node.js globals of |context| as properties that create the
+  // environment when they are first read.
+  void InstallLazyGlobals(v8::Local<v8::Context> context);
+  static void LazyGlobalGetter(v8::Local<v8::Name> name,
+                               const v8::PropertyCallbackInfo<v8::Value>& info);
+
+  void CreateEnvironment(v8::Local<v8::Context> context);
+
   std::unique_ptr<NodeBindings> node_bindings_;
   std::unique_ptr<ElectronBindings> electron_bindings_;
   base::flat_set<std::shared_ptr<node::Environment>> environments_;
@@ -72,7 +72,8 @@ void NodeService::Initialize(node::mojom::NodeServiceParamsPtr params) {
   if (NodeBindings::IsInitialized())
     return;
 
-  ParentPort::GetInstance()->Initialize(std::move(params->port));
+  ParentPort::GetInstance()->Initialize(std::move(params->port),
+                                        std::move(params->shared_memory));
 
   URLLoaderBundle::GetInstance()->SetURLLoaderFactory(
       std::move(params->url_loader_factory),
@@ -5,11 +5,14 @@
 #include "shell/services/node/parent_port.h"
 
 #include <utility>
+#include <vector>
 
 #include "base/no_destructor.h"
+#include "gin/arguments.h"
 #include "gin/data_object_builder.h"
 #include "gin/handle.h"
 #include "shell/browser/api/message_port.h"
+#include "shell/common/api/electron_api_shared_memory.h"
 #include "shell/common/gin_helper/dictionary.h"
 #include "shell/common/gin_helper/event_emitter_caller.h"
 #include "shell/common/node_includes.h"
@@ -28,8 +31,10 @@ ParentPort* ParentPort::GetInstance() {
 ParentPort::ParentPort() = default;
 ParentPort::~ParentPort() = default;
 
-void ParentPort::Initialize(blink::MessagePortDescriptor port) {
+void ParentPort::Initialize(blink::MessagePortDescriptor port,
+                            base::UnsafeSharedMemoryRegion shared_memory) {
   port_ = std::move(port);
+  shared_memory_ = std::move(shared_memory);
   connector_ = std::make_unique<mojo::Connector>(
       port_.TakeHandleToEntangleWithEmbedder(),
       mojo::Connector::SINGLE_THREADED_SEND,
@@ -40,11 +45,39 @@ void ParentPort::Initialize(blink::MessagePortDescriptor port) {
       base::BindOnce(&ParentPort::Close, base::Unretained(this)));
 }
 
-void ParentPort::PostMessage(v8::Local<v8::Value> message_value) {
+void ParentPort::PostMessage(gin::Arguments* args) {
   if (!connector_closed_ && connector_ && connector_->is_valid()) {
-    v8::Isolate* isolate = JavascriptEnvironment::GetIsolate();
+    v8::Isolate* isolate = args->isolate();
+    v8::Local<v8::Value> message_value;
+    if (!args->GetNext(&message_value)) {
+      args->ThrowTypeError("Expected at least one argument to postMessage");
+      return;
+    }
+
+    std::vector<v8::Local<v8::ArrayBuffer>> array_buffers;
+    v8::Local<v8::Value> transferables;
+    if (args->GetNext(&transferables)) {
+      std::vector<v8::Local<v8::Value>> values;
+      if (!gin::ConvertFromV8(isolate, transferables, &values)) {
+        args->ThrowTypeError("transferables must be an array of ArrayBuffers");
+        return;
+      }
+      for (const auto& value : values) {
+        if (!value->IsArrayBuffer()) {
+          args->ThrowTypeError(
+              "transferables must be an array of ArrayBuffers");
+          return;
+        }
+        array_buffers.push_back(value.As<v8::ArrayBuffer>());
+      }
+    }
+
     blink::TransferableMessage transferable_message;
-    electron::SerializeV8Value(isolate, message_value, &transferable_message);
+    if (!electron::SerializeV8Value(isolate, message_value, array_buffers,
+                                    &transferable_message)) {
+      // SerializeV8Value sets an exception.
+      return;
+    }
     mojo::Message mojo_message =
         blink::mojom::TransferableMessage::WrapAsMessage(
             std::move(transferable_message));
@@ -73,6 +106,17 @@ void ParentPort::Pause() {
   }
 }
 
+v8::Local<v8::Value> ParentPort::GetSharedMemory(v8::Isolate* isolate) {
+  if (!shared_memory_object_.IsEmpty())
+    return shared_memory_object_.Get(isolate);
+  if (!shared_memory_.IsValid())
+    return v8::Null(isolate);
+  v8::Local<v8::Value> memory =
+      api::SharedMemory::Create(isolate, shared_memory_.Duplicate()).ToV8();
+  shared_memory_object_.Reset(isolate, memory);
+  return memory;
+}
+
 bool ParentPort::Accept(mojo::Message* mojo_message) {
   blink::TransferableMessage message;
   if (!blink::mojom::TransferableMessage::DeserializeFromMessage(
@@ -85,7 +129,7 @@ bool ParentPort::Accept(mojo::Message* mojo_message) {
   auto wrapped_ports =
       MessagePort::EntanglePorts(isolate, std::move(message.ports));
   v8::Local<v8::Value> message_value =
-      electron::DeserializeV8Value(isolate, message);
+      electron::DeserializeV8Value(isolate, &message);
   v8::Local<v8::Object> self;
   if (!GetWrapper(isolate).ToLocal(&self))
     return false;
@@ -108,7 +152,8 @@ gin::ObjectTemplateBuilder ParentPort::GetObjectTemplateBuilder(
   return gin::Wrappable<ParentPort>::GetObjectTemplateBuilder(isolate)
       .SetMethod("postMessage", &ParentPort::PostMessage)
       .SetMethod("start", &ParentPort::Start)
-      .SetMethod("pause", &ParentPort::Pause);
+      .SetMethod("pause", &ParentPort::Pause)
+      .SetProperty("sharedMemory", &ParentPort::GetSharedMemory);
 }
 
 const char* ParentPort::GetTypeName() {
@@ -7,16 +7,19 @@
 
 #include <memory>
 
+#include "base/memory/unsafe_shared_memory_region.h"
 #include "gin/wrappable.h"
 #include "mojo/public/cpp/bindings/connector.h"
 #include "mojo/public/cpp/bindings/message.h"
 #include "shell/browser/event_emitter_mixin.h"
+#include "v8/include/v8-persistent-handle.h"
 
 namespace v8 {
 template <class T>
 class Local;
 class Value;
 class Isolate;
+class SharedArrayBuffer;
 }  // namespace v8
 
 namespace gin {
@@ -41,7 +44,8 @@ class ParentPort : public gin::Wrappable<ParentPort>,
 
   ParentPort();
   ~ParentPort() override;
-  void Initialize(blink::MessagePortDescriptor port);
+  void Initialize(blink::MessagePortDescriptor port,
+                  base::UnsafeSharedMemoryRegion shared_memory);
 
   // gin::Wrappable
   static gin::WrapperInfo kWrapperInfo;
@@ -50,10 +54,11 @@ class ParentPort : public gin::Wrappable<ParentPort>,
   const char* GetTypeName() override;
 
  private:
-  void PostMessage(v8::Local<v8::Value> message_value);
+  void PostMessage(gin::Arguments* args);
   void Close();
   void Start();
   void Pause();
+  v8::Local<v8::Value> GetSharedMemory(v8::Isolate* isolate);
 
   // mojo::MessageReceiver
   bool Accept(mojo::Message* mojo_message) override;
@@ -61,6 +66,10 @@ class ParentPort : public gin::Wrappable<ParentPort>,
   bool connector_closed_ = false;
   std::unique_ptr<mojo::Connector> connector_;
   blink::MessagePortDescriptor port_;
+  // Memory shared with the parent process, and the SharedMemory object that
+  // is lazily created to expose it.
+  base::UnsafeSharedMemoryRegion shared_memory_;
+  v8::Global<v8::Value> shared_memory_object_;
 };
 
 }  // namespace electron
@@ -4,6 +4,7 @@ import * as https from 'node:https';
 import * as http from 'node:http';
 import * as net from 'node:net';
 import * as fs from 'fs-extra';
+import * as os from 'node:os';
 import * as path from 'node:path';
 import { promisify } from 'node:util';
 import { app, BrowserWindow, Menu, session, net as electronNet, WebContents, utilityProcess } from 'electron/main';
@@ -351,6 +352,42 @@ describe('app module', () => {
         // This is expected.
       }
     });
+
+    // The early handoff only applies to packaged apps, so this runs a copy of
+    // the executable with the fixture as its app.
+    ifit(process.platform !== 'darwin')('hands the command line off before the second instance runs any script with earlyHandoff', async function () {
+      this.timeout(120000);
+      const tmpDir = await fs.mkdtemp(path.join(app.getPath('temp'), 'electron-early-handoff-'));
+      try {
+        const exePath = path.join(tmpDir, path.basename(process.execPath));
+        await fs.copy(path.dirname(process.execPath), tmpDir);
+        await fs.copy(path.join(fixturesPath, 'api', 'singleton-early-handoff'), path.join(tmpDir, 'resources', 'app'));
+
+        const first = cp.spawn(exePath);
+        const firstExited = once(first, 'exit');
+        const firstStdoutLines = first.stdout.pipe(split());
+        while ((await once(firstStdoutLines, 'data')).toString() !== 'started') {
+          // wait.
+        }
+        const dataFromSecondInstance = once(firstStdoutLines, 'data');
+
+        const second = cp.spawn(exePath, ['--some-switch', 'some-arg']);
+        let secondStdout = '';
+        second.stdout.on('data', (data) => { secondStdout += data; });
+        const [code2] = await once(second, 'exit');
+        // Handing off early exits with 0, the script would have exited with 1.
+        expect(code2).to.equal(0);
+        expect(secondStdout).to.equal('');
+
+        const [code1] = await firstExited;
+        expect(code1).to.equal(0);
+        const [args, additionalData] = (await dataFromSecondInstance)[0].toString('ascii').split('||');
+        expect(JSON.parse(args)).to.include('some-arg');
+        expect(JSON.parse(additionalData)).to.equal(null);
+      } finally {
+        await fs.remove(tmpDir);
+      }
+    });
   });
 
   describe('app.relaunch', () => {
@@ -1033,6 +1070,22 @@ describe('app module', () => {
     });
   });
 
+  ifdescribe(process.platform === 'win32')('setJumpListAsync(categories)', () => {
+    it('rejects when categories is not null or an array', async () => {
+      await expect(app.setJumpListAsync('string' as any)).to.eventually.be.rejectedWith('Argument must be null or an array of categories');
+    });
+
+    it('resolves superseded updates with the result of the latest one', async () => {
+      const results = await Promise.all([
+        app.setJumpListAsync([{ type: 'frequent' }]),
+        app.setJumpListAsync([{ type: 'recent' }]),
+        app.setJumpListAsync(null)
+      ]);
+      expect(results[2]).to.equal('ok');
+      expect(results[1]).to.equal(results[2]);
+    });
+  });
+
   describe('getAppPath', () => {
     it('works for directories with package.json', async () => {
       const { appPath } = await runTestApp('app-path');
@@ -1427,6 +1480,22 @@ describe('app module', () => {
         expect(size.width).to.equal(sizes.large);
       });
     });
+
+    describe('getFileIcons()', () => {
+      it('fetches an icon per path in order', async () => {
+        const otherPath = path.join(__dirname, 'fixtures/assets/logo.png');
+        const icons = await app.getFileIcons([iconPath, otherPath, iconPath], { size: 'small' });
+        expect(icons).to.have.lengthOf(3);
+        for (const icon of icons) {
+          expect(icon.isEmpty()).to.equal(false);
+          expect(icon.getSize()).to.deep.equal({ width: sizes.small, height: sizes.small });
+        }
+      });
+
+      it('resolves with an empty array for no paths', async () => {
+        expect(await app.getFileIcons([])).to.deep.equal([]);
+      });
+    });
   });
 
   describe('getAppMetrics() API', () => {
@@ -1455,10 +1524,14 @@ describe('app module', () => {
           expect(entry).to.have.property('name').that.is.a('string');
         }
 
-        if (process.platform === 'win32') {
+        if (process.platform === 'win32' || process.platform === 'linux') {
           expect(entry.memory).to.have.property('privateBytes').that.is.greaterThan(0);
         }
 
+        if (process.platform === 'linux') {
+          expect(entry.memory).to.have.property('proportionalSetSize').that.is.greaterThan(0);
+        }
+
         if (process.platform !== 'linux') {
           expect(entry.sandboxed).to.be.a('boolean');
         }
@@ -1476,6 +1549,141 @@ describe('app module', () => {
     });
   });
 
+  describe('startMetricsSampling() API', () => {
+    afterEach(() => {
+      app.stopMetricsSampling();
+    });
+
+    it('throws on invalid options', () => {
+      expect(() => app.startMetricsSampling({ interval: 10 })).to.throw(/interval must be at least 100 milliseconds/);
+      expect(() => app.startMetricsSampling({ bufferSize: 0 })).to.throw(/bufferSize must be between 1 and 1000000/);
+    });
+
+    it('records samples of all running electron processes', async () => {
+      const start = Date.now();
+      app.startMetricsSampling({ interval: 100 });
+      await waitUntil(() => app.getMetricsSamples().some(sample => sample.type === 'Browser'));
+      const samples = app.getMetricsSamples();
+      for (const sample of samples) {
+        expect(sample.pid).to.be.above(0);
+        expect(sample.type).to.be.a('string').that.does.not.equal('');
+        expect(sample.timestamp).to.be.at.least(start);
+        expect(sample.cpu.percentCPUUsage).to.be.a('number');
+        expect(sample.memory.workingSetSize).to.be.greaterThan(0);
+      }
+      const timestamps = samples.map(sample => sample.timestamp);
+      expect(timestamps).to.deep.equal([...timestamps].sort((a, b) => a - b));
+
+      const last = timestamps[timestamps.length - 1];
+      for (const sample of app.getMetricsSamples(last)) {
+        expect(sample.timestamp).to.be.greaterThan(last);
+      }
+    });
+
+    it('keeps at most bufferSize samples', async () => {
+      app.startMetricsSampling({ interval: 100, bufferSize: 2 });
+      await waitUntil(() => app.getMetricsSamples().length === 2);
+      await new Promise(resolve => setTimeout(resolve, 300));
+      expect(app.getMetricsSamples()).to.have.lengthOf(2);
+    });
+  });
+
+  describe('getStartupTimeline() API', () => {
+    it('returns the startup phases in order', () => {
+      const timeline = app.getStartupTimeline();
+      const names = timeline.map(phase => phase.name);
+      expect(names).to.include.members([
+        'pre-early-initialization',
+        'node-environment-created',
+        'app-code-loaded',
+        'post-early-initialization',
+        'pre-create-threads',
+        'pre-main-message-loop-run'
+      ]);
+      expect(names.indexOf('app-code-loaded')).to.be.lessThan(names.indexOf('pre-main-message-loop-run'));
+      for (let i = 1; i < timeline.length; i++) {
+        expect(timeline[i].time).to.be.at.least(timeline[i - 1].time);
+      }
+    });
+
+    it('records when the first window finished loading', async () => {
+      const w = new BrowserWindow({ show: false });
+      try {
+        await w.loadURL('about:blank');
+        const names = app.getStartupTimeline().map(phase => phase.name);
+        expect(names).to.include('first-window-load');
+      } finally {
+        await closeWindow(w);
+      }
+    });
+  });
+
+  describe('ELECTRON_LOG_MODULE_LOADS', () => {
+    it('reports the built-in modules loaded during startup', async () => {
+      const appPath = path.join(fixturesPath, 'api', 'quit-app');
+      const appProcess = cp.spawn(process.execPath, [appPath], {
+        env: { ...process.env, ELECTRON_LOG_MODULE_LOADS: '1' }
+      });
+      let output = '';
+      appProcess.stdout.on('data', (data) => { output += data; });
+      await once(appProcess.stdout, 'end');
+      expect(output).to.match(/Electron loaded \d+ built-in modules during startup/);
+      expect(output).to.match(/^ {2}app: \d+\.\d+ms$/m);
+    });
+  });
+
+  describe('startEventLoopMonitoring() API', () => {
+    afterEach(() => {
+      app.stopEventLoopMonitoring();
+    });
+
+    it('throws on invalid options', () => {
+      expect(() => app.startEventLoopMonitoring({ sampleInterval: 1 })).to.throw(/sampleInterval must be at least 10 milliseconds/);
+      expect(() => app.startEventLoopMonitoring({ longTaskThreshold: 0 })).to.throw(/longTaskThreshold must be a positive number/);
+      expect(() => app.startEventLoopMonitoring({ maxLongTasks: 0 })).to.throw(/maxLongTasks must be between 1 and 10000/);
+    });
+
+    it('records the queue delay and uv loop runs', async () => {
+      app.startEventLoopMonitoring({ sampleInterval: 10 });
+      await waitUntil(() => {
+        const stats = app.getEventLoopStats()!;
+        return stats.queueDelay.count > 0 && stats.uvRunDuration.count > 0;
+      });
+      const stats = app.getEventLoopStats()!;
+      expect(stats.monitoring).to.be.true();
+      for (const histogram of [stats.queueDelay, stats.uvRunDuration]) {
+        const total = histogram.buckets.reduce((sum, bucket) => sum + bucket.count, 0);
+        expect(total).to.equal(histogram.count);
+        expect(histogram.buckets[histogram.buckets.length - 1].upperBound).to.equal(Infinity);
+        expect(histogram.max).to.be.at.least(histogram.mean);
+      }
+    });
+
+    it('records long tasks', async () => {
+      app.startEventLoopMonitoring({ longTaskThreshold: 100 });
+      await new Promise<void>(resolve => setTimeout(() => {
+        const end = Date.now() + 150;
+        while (Date.now() < end);
+        resolve();
+      }, 0));
+      await waitUntil(() => app.getEventLoopStats()!.longTasks.length > 0);
+      const [task] = app.getEventLoopStats()!.longTasks;
+      expect(task.duration).to.be.at.least(100);
+      expect(task.timestamp).to.be.a('number');
+      expect(task.fileName).to.be.a('string');
+      expect(task.lineNumber).to.be.a('number');
+    });
+
+    it('keeps the statistics after stopping', async () => {
+      app.startEventLoopMonitoring({ sampleInterval: 10 });
+      await waitUntil(() => app.getEventLoopStats()!.queueDelay.count > 0);
+      app.stopEventLoopMonitoring();
+      const stats = app.getEventLoopStats()!;
+      expect(stats.monitoring).to.be.false();
+      expect(stats.queueDelay.count).to.be.greaterThan(0);
+    });
+  });
+
   describe('getGPUFeatureStatus() API', () => {
     it('returns the graphic features statuses', () => {
       const features = app.getGPUFeatureStatus();
@@ -1550,6 +1758,19 @@ describe('app module', () => {
       }
     });
 
+    it('returns only the requested keys', async () => {
+      const gpuInfo: any = await app.getGPUInfo('basic', { keys: ['gpuDevice', 'doesNotExist'] });
+      expect(Object.keys(gpuInfo)).to.deep.equal(['gpuDevice']);
+      await verifyBasicGPUInfo(gpuInfo);
+    });
+
+    it('returns the same info for repeated calls', async () => {
+      const first = await app.getGPUInfo('basic');
+      const second = await app.getGPUInfo('basic');
+      expect(second).to.deep.equal(first);
+      expect(second).to.not.equal(first);
+    });
+
     it('fails for invalid info_type', () => {
       const invalidType = 'invalid';
       const expectedErrorMessage = "Invalid info type. Use 'basic' or 'complete'";
@@ -1658,6 +1879,56 @@ describe('app module', () => {
     });
   });
 
+  describe('setShaderCacheSeed() API', () => {
+    let tmpDir: string;
+    let seedPath: string;
+    let sessionDataPath: string;
+
+    beforeEach(async () => {
+      tmpDir = await fs.mkdtemp(path.join(os.tmpdir(), 'electron-shader-cache-'));
+      seedPath = path.join(tmpDir, 'seed');
+      sessionDataPath = path.join(tmpDir, 'session-data');
+      await fs.outputFile(path.join(seedPath, 'GPUCache', 'seeded-entry'), 'gpu');
+      await fs.outputFile(path.join(seedPath, 'GrShaderCache', 'seeded-entry'), 'skia');
+    });
+
+    afterEach(async () => {
+      await fs.remove(tmpDir);
+    });
+
+    const runSeedApp = () => runTestApp('shader-cache-seed', `--session-data=${sessionDataPath}`, `--seed=${seedPath}`);
+
+    it('throws when called after app is ready', () => {
+      expect(() => {
+        app.setShaderCacheSeed(path.resolve(__dirname, 'fixtures'));
+      }).to.throw(/before app is ready/);
+    });
+
+    it('copies the seeded caches into sessionData', async () => {
+      const { error } = await runSeedApp();
+      expect(error).to.be.null();
+      expect(await fs.readFile(path.join(sessionDataPath, 'GPUCache', 'seeded-entry'), 'utf8')).to.equal('gpu');
+      expect(await fs.readFile(path.join(sessionDataPath, 'GrShaderCache', 'seeded-entry'), 'utf8')).to.equal('skia');
+      const stamp = await fs.readFile(path.join(sessionDataPath, 'ShaderCacheSeed'), 'utf8');
+      expect(stamp.split('\n')).to.include(seedPath);
+    });
+
+    it('copies a seed only once', async () => {
+      await runSeedApp();
+      await fs.outputFile(path.join(seedPath, 'GPUCache', 'seeded-entry'), 'changed');
+      const { error } = await runSeedApp();
+      expect(error).to.be.null();
+      expect(await fs.readFile(path.join(sessionDataPath, 'GPUCache', 'seeded-entry'), 'utf8')).to.equal('gpu');
+    });
+
+    it('fails when the seed is not a directory', async () => {
+      await fs.remove(seedPath);
+      const { error } = await runSeedApp();
+      expect(error).to.match(/is not a directory/);
+      expect(fs.existsSync(path.join(sessionDataPath, 'ShaderCacheSeed'))).to.be.false();
+    });
+  });
+
   ifdescribe(process.platform === 'darwin')('app hide and show API', () => {
     describe('app.isHidden', () => {
       it('returns true when the app is hidden', async () => {
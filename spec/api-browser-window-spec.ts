@@ -6,7 +6,7 @@ import * as qs from 'node:querystring';
 import * as http from 'node:http';
 import * as os from 'node:os';
 import { AddressInfo } from 'node:net';
-import { app, BrowserWindow, BrowserView, dialog, ipcMain, OnBeforeSendHeadersListenerDetails, protocol, screen, webContents, webFrameMain, session, WebContents, WebFrameMain } from 'electron/main';
+import { app, BaseWindow, BrowserWindow, BrowserView, dialog, ipcMain, nativeImage, OnBeforeSendHeadersListenerDetails, protocol, screen, webContents, webFrameMain, session, WebContents, WebFrameMain } from 'electron/main';
 
 import { emittedUntil, emittedNTimes } from './lib/events-helpers';
 import { ifit, ifdescribe, defer, listen } from './lib/spec-helpers';
@@ -1593,6 +1593,53 @@ describe('BrowserWindow module', () => {
       });
     });
 
+    describe('deferLoadUntilShown option', () => {
+      it('loads the page once the window is shown', async () => {
+        const w = new BrowserWindow({ show: false, deferLoadUntilShown: true });
+        let loaded = false;
+        const load = w.loadFile(path.join(fixtures, 'pages', 'blank.html')).then(() => { loaded = true; });
+        await setTimeout(500);
+        expect(loaded).to.be.false();
+        expect(w.webContents.getURL()).to.equal('');
+        w.show();
+        await load;
+        expect(w.webContents.getURL()).to.match(/blank\.html$/);
+      });
+
+      it('only loads the last page', async () => {
+        const w = new BrowserWindow({ show: false, deferLoadUntilShown: true });
+        const first = w.loadURL('about:blank#first');
+        const last = w.loadFile(path.join(fixtures, 'pages', 'blank.html'));
+        await expect(first).to.eventually.be.rejectedWith(/ERR_ABORTED/);
+        w.show();
+        await last;
+        expect(w.webContents.getURL()).to.match(/blank\.html$/);
+      });
+
+      it('has no effect on windows that are shown', async () => {
+        const w = new BrowserWindow({ show: true, deferLoadUntilShown: true });
+        await w.loadFile(path.join(fixtures, 'pages', 'blank.html'));
+      });
+    });
+
+    describe('coalesceBoundsEvents option', () => {
+      it('emits resize and move after the last change', async () => {
+        const w = new BrowserWindow({ show: false, coalesceBoundsEvents: true });
+        let resizeCount = 0;
+        w.on('resize', () => { resizeCount++; });
+        const resize = once(w, 'resize');
+        const move = once(w, 'move');
+        w.setBounds({ x: 10, y: 10, width: 300, height: 300 });
+        w.setBounds({ x: 20, y: 20, width: 310, height: 310 });
+        w.setBounds({ x: 30, y: 30, width: 320, height: 320 });
+        await Promise.all([resize, move]);
+        expect(resizeCount).to.be.at.least(1);
+        expectBoundsEqual(w.getSize(), [320, 320]);
+        expectBoundsEqual(w.getPosition(), [30, 30]);
+        await closeWindow(w);
+      });
+    });
+
     describe('BrowserWindow.setContentSize(width, height)', () => {
       it('sets the content size', async () => {
         // NB. The CI server has a very small screen. Attempting to size the window
@@ -2382,6 +2429,37 @@ describe('BrowserWindow module', () => {
     });
   });
 
+  describe('webContents.capturePageTiles(rect)', () => {
+    afterEach(closeAllWindows);
+
+    it('delivers the requested area in tiles', async () => {
+      const w = new BrowserWindow({ width: 400, height: 600 });
+      await w.loadURL('data:text/html,<body style="margin:0;height:3000px;background:red"></body>');
+      const tiles: Electron.CapturedTile[] = [];
+      await w.webContents.capturePageTiles({ x: 0, y: 100, width: 200, height: 1000 }, { tileSize: { width: 200, height: 250 } }, (tile) => {
+        tiles.push(tile);
+      });
+      expect(tiles.map(t => t.rect)).to.deep.equal([0, 1, 2, 3].map(i => ({ x: 0, y: 100 + i * 250, width: 200, height: 250 })));
+      for (const { data } of tiles) {
+        expect((data as Electron.NativeImage).isEmpty()).to.be.false();
+      }
+      expect(await w.webContents.executeJavaScript('scrollY')).to.equal(0);
+    });
+
+    it('clamps the area to the document and encodes tiles', async () => {
+      const w = new BrowserWindow({ width: 400, height: 600 });
+      await w.loadURL('data:text/html,<body style="margin:0;height:2000px"></body>');
+      const tiles: Electron.CapturedTile[] = [];
+      await w.webContents.capturePageTiles({ x: 0, y: 0, width: 100, height: 5000 }, { format: 'png' }, async (tile) => {
+        tiles.push(tile);
+      });
+      expect(tiles.reduce((height, t) => height + t.rect.height, 0)).to.equal(2000);
+      for (const { data } of tiles) {
+        expect(nativeImage.createFromBuffer(data as Buffer).isEmpty()).to.be.false();
+      }
+    });
+  });
+
   describe('BrowserWindow.setProgressBar(progress)', () => {
     let w: BrowserWindow;
     before(() => {
@@ -2740,6 +2818,46 @@ describe('BrowserWindow module', () => {
     });
   });
 
+  describe('BaseWindow.batchUpdates(callback)', () => {
+    afterEach(closeAllWindows);
+    it('applies the changes made in the callback', () => {
+      const w1 = new BrowserWindow({ show: false });
+      const w2 = new BrowserWindow({ show: false });
+      const bounds1 = { x: 10, y: 20, width: 300, height: 200 };
+      const bounds2 = { x: 320, y: 20, width: 300, height: 200 };
+      BaseWindow.batchUpdates(() => {
+        w1.setBounds(bounds1);
+        BaseWindow.batchUpdates(() => {
+          w2.setBounds(bounds2);
+        });
+      });
+      expectBoundsEqual(w1.getBounds(), bounds1);
+      expectBoundsEqual(w2.getBounds(), bounds2);
+    });
+
+    it('combines setPosition and setSize called in the callback', () => {
+      const w = new BrowserWindow({ show: false, x: 0, y: 0, width: 200, height: 200 });
+      BaseWindow.batchUpdates(() => {
+        w.setPosition(50, 60);
+        w.setSize(300, 250);
+        expectBoundsEqual(w.getBounds(), { x: 50, y: 60, width: 300, height: 250 });
+      });
+      expectBoundsEqual(w.getBounds(), { x: 50, y: 60, width: 300, height: 250 });
+    });
+
+    it('rethrows exceptions thrown by the callback', () => {
+      expect(() => {
+        BaseWindow.batchUpdates(() => { throw new Error('oops'); });
+      }).to.throw('oops');
+    });
+
+    it('throws when the callback is not a function', () => {
+      expect(() => {
+        BaseWindow.batchUpdates(null as any);
+      }).to.throw(/callback must be a function/);
+    });
+  });
+
   describe('Opening a BrowserWindow from a link', () => {
     let appProcess: childProcess.ChildProcessWithoutNullStreams | undefined;
 
@@ -3456,6 +3574,61 @@ describe('BrowserWindow module', () => {
       });
     });
 
+    describe('"heapLimits" option', () => {
+      it('limits the V8 heap of the renderer process', async () => {
+        const w = new BrowserWindow({
+          show: false,
+          webPreferences: {
+            nodeIntegration: true,
+            contextIsolation: false,
+            heapLimits: { maxOldSpaceSize: 128 }
+          }
+        });
+        await w.loadFile(path.join(fixtures, 'api', 'blank.html'));
+        const limit = await w.webContents.executeJavaScript('require(\'node:v8\').getHeapStatistics().heap_size_limit');
+        expect(limit).to.be.lessThan(256 * 1024 * 1024);
+      });
+    });
+
+    describe('"processGroup" option', () => {
+      const createWindow = async (webPreferences: Electron.WebPreferences) => {
+        const w = new BrowserWindow({ show: false, webPreferences });
+        await w.loadFile(path.join(fixtures, 'api', 'blank.html'));
+        return w;
+      };
+
+      it('shares a renderer process between windows of the same group', async () => {
+        const w1 = await createWindow({ processGroup: 'group' });
+        const w2 = await createWindow({ processGroup: 'group' });
+        expect(w2.webContents.getOSProcessId()).to.equal(w1.webContents.getOSProcessId());
+      });
+
+      it('does not share a renderer process between windows with different security preferences', async () => {
+        const w1 = await createWindow({ processGroup: 'group' });
+        const w2 = await createWindow({ processGroup: 'group', nodeIntegration: true, contextIsolation: false });
+        const w3 = await createWindow({ processGroup: 'group', webSecurity: false });
+        const w4 = await createWindow({ processGroup: 'group', preload: path.join(fixtures, 'module', 'empty.js') });
+        const pids = [w1, w2, w3, w4].map(w => w.webContents.getOSProcessId());
+        expect(new Set(pids).size).to.equal(pids.length);
+        expect(await w2.webContents.executeJavaScript('typeof require')).to.equal('function');
+        expect(await w1.webContents.executeJavaScript('typeof require')).to.equal('undefined');
+      });
+
+      it('does not share a renderer process between groups', async () => {
+        const w1 = await createWindow({ processGroup: 'group-1' });
+        const w2 = await createWindow({ processGroup: 'group-2' });
+        const w3 = await createWindow({});
+        expect(w2.webContents.getOSProcessId()).to.not.equal(w1.webContents.getOSProcessId());
+        expect(w3.webContents.getOSProcessId()).to.not.equal(w1.webContents.getOSProcessId());
+      });
+
+      it('does not share a renderer process between windows launching different processes', async () => {
+        const w1 = await createWindow({ processGroup: 'group', sandbox: true });
+        const w2 = await createWindow({ processGroup: 'group', sandbox: false });
+        expect(w2.webContents.getOSProcessId()).to.not.equal(w1.webContents.getOSProcessId());
+      });
+    });
+
     describe('"node-integration" option', () => {
       it('disables node integration by default', async () => {
         const preload = path.join(fixtures, 'module', 'send-later.js');
@@ -4477,6 +4650,72 @@ describe('BrowserWindow module', () => {
       w.loadFile(path.join(fixtures, 'api', 'frame-subscriber.html'));
     });
 
+    it('subscribes to i420 frames with options', (done) => {
+      const w = new BrowserWindow({ show: false });
+      let called = false;
+      w.loadFile(path.join(fixtures, 'api', 'frame-subscriber.html'));
+      w.webContents.on('dom-ready', () => {
+        w.webContents.beginFrameSubscription({ frameRate: 60, pixelFormat: 'i420', size: { width: 64, height: 64 } }, (frame: any) => {
+          // This callback might be called twice.
+          if (called) return;
+          called = true;
+
+          try {
+            expect(frame.pixelFormat).to.equal('i420');
+            expect(frame.planes).to.have.lengthOf(3);
+            expect(frame.codedSize.width).to.be.at.most(64);
+            const [y, u] = frame.planes;
+            expect(y.data).to.be.an.instanceOf(Buffer);
+            expect(y.stride).to.be.at.least(frame.visibleRect.width);
+            expect(u.data.length).to.be.lessThan(y.data.length);
+            done();
+          } catch (e) {
+            done(e);
+          } finally {
+            w.webContents.endFrameSubscription();
+          }
+        });
+      });
+    });
+
+    it('subscribes to encoded frames', (done) => {
+      const w = new BrowserWindow({ show: false });
+      let called = false;
+      w.loadFile(path.join(fixtures, 'api', 'frame-subscriber.html'));
+      w.webContents.on('dom-ready', () => {
+        w.webContents.beginFrameSubscription({ codec: 'vp8', size: { width: 64, height: 64 } }, (chunk: any) => {
+          // This callback might be called twice.
+          if (called) return;
+          called = true;
+
+          try {
+            expect(chunk.codec).to.equal('vp8');
+            expect(chunk.keyFrame).to.be.true('keyFrame');
+            expect(chunk.data).to.be.an.instanceOf(Buffer);
+            expect(chunk.data.length).to.be.greaterThan(0);
+            done();
+          } catch (e) {
+            done(e);
+          } finally {
+            w.webContents.endFrameSubscription();
+          }
+        });
+      });
+    });
+
+    it('throws error when options are invalid', () => {
+      const w = new BrowserWindow({ show: false });
+      expect(() => {
+        w.webContents.beginFrameSubscription({ frameRate: 0 }, () => {});
+      }).to.throw(/'frameRate' must be between 1 and 240/);
+      expect(() => {
+        w.webContents.beginFrameSubscription({ pixelFormat: 'rgb565' as any }, () => {});
+      }).to.throw(/'pixelFormat' must be 'bgra' or 'i420'/);
+      expect(() => {
+        w.webContents.beginFrameSubscription({ codec: 'mpeg2' as any }, () => {});
+      }).to.throw(/Unsupported 'codec': mpeg2/);
+    });
+
     it('throws error when subscriber is not well defined', () => {
       const w = new BrowserWindow({ show: false });
       expect(() => {
@@ -4562,6 +4801,23 @@ describe('BrowserWindow module', () => {
       expect(fs.existsSync(savePageJsPath)).to.be.true('js path');
       expect(fs.existsSync(savePageCssPath)).to.be.true('css path');
     });
+
+    it('emits save-page-progress while saving', async () => {
+      const w = new BrowserWindow({ show: false });
+      await w.loadFile(path.join(fixtures, 'pages', 'save_page', 'index.html'));
+      const progress: [string, number, number][] = [];
+      w.webContents.on('save-page-progress', (event, fullPath, receivedBytes, totalBytes) => {
+        progress.push([fullPath, receivedBytes, totalBytes]);
+      });
+      await w.webContents.savePage(savePageHtmlPath, 'HTMLComplete');
+
+      expect(progress).to.not.be.empty();
+      for (const [fullPath, receivedBytes, totalBytes] of progress) {
+        expect(fullPath).to.equal(savePageHtmlPath);
+        expect(receivedBytes).to.be.a('number');
+        expect(totalBytes).to.be.a('number');
+      }
+    });
   });
 
   describe('BrowserWindow options argument is optional', () => {
@@ -6341,6 +6597,62 @@ describe('BrowserWindow module', () => {
       w.loadFile(path.join(fixtures, 'api', 'offscreen-rendering.html'));
     });
 
+    it('does not change the image of an earlier paint event', async () => {
+      const paint = once(w.webContents, 'paint') as Promise<[any, Electron.Rectangle, Electron.NativeImage]>;
+      w.loadFile(path.join(fixtures, 'api', 'offscreen-rendering.html'));
+      const [,, image] = await paint;
+      const pixels = image.toBitmap();
+      for (let i = 0; i < 5; i++) {
+        await once(w.webContents, 'paint');
+      }
+      expect(image.toBitmap().equals(pixels)).to.be.true('image changed');
+    });
+
+    it('holds back paint events until they are acknowledged', async () => {
+      await w.loadURL('data:text/html,<body><script>(function f (t) { document.body.style.background = `hsl(${t %25 360}, 50%25, 50%25)`; requestAnimationFrame(f); })(0)</script></body>');
+      w.webContents.setPaintAcknowledgementEnabled(true);
+      let paints = 0;
+      w.webContents.on('paint', () => { paints++; });
+      await setTimeout(500);
+      expect(paints).to.equal(1);
+
+      // The coalesced frames are painted right away.
+      w.webContents.acknowledgePaint();
+      expect(paints).to.equal(2);
+      const stats = w.webContents.getPaintStatistics();
+      expect(stats.painted).to.be.at.least(2);
+      expect(stats.coalesced).to.be.greaterThan(0);
+      expect(stats.bytesCopied).to.be.greaterThan(0);
+
+      w.webContents.setPaintAcknowledgementEnabled(false);
+      await once(w.webContents, 'paint');
+    });
+
+    it('paints shared textures or falls back to bitmaps with useSharedTexture', async () => {
+      const sw = new BrowserWindow({
+        width: 100,
+        height: 100,
+        show: false,
+        webPreferences: {
+          backgroundThrottling: false,
+          offscreen: { useSharedTexture: true }
+        }
+      });
+      expect(sw.webContents.isOffscreen()).to.be.true('isOffscreen');
+      const paint = once(sw.webContents, 'paint') as Promise<[any, Electron.Rectangle, Electron.NativeImage, Electron.OffscreenSharedTexture?]>;
+      sw.loadFile(path.join(fixtures, 'api', 'offscreen-rendering.html'));
+      const [,, image, texture] = await paint;
+      if (texture) {
+        expect(image.isEmpty()).to.be.true('image is empty');
+        const { scaleFactor } = screen.getPrimaryDisplay();
+        expect(texture.textureInfo.codedSize.width).to.be.at.least(Math.floor(100 * scaleFactor) - 2);
+        expect(texture.textureInfo.pixelFormat).to.be.oneOf(['rgba', 'bgra']);
+        texture.release();
+      } else {
+        expect(image.isEmpty()).to.be.false('image is empty');
+      }
+    });
+
     describe('window.webContents.isOffscreen()', () => {
       it('is true for offscreen type', () => {
         w.loadFile(path.join(fixtures, 'api', 'offscreen-rendering.html'));
@@ -23,6 +23,21 @@ ifdescribe(process.platform !== 'win32' || process.arch !== 'arm64')('clipboard
     });
   });
 
+  describe('clipboard.readImageAsync()', () => {
+    it('resolves with a NativeImage instance', async () => {
+      const p = path.join(fixtures, 'assets', 'logo.png');
+      const i = nativeImage.createFromPath(p);
+      clipboard.writeImage(i);
+      const readImage = await clipboard.readImageAsync();
+      expect(readImage.toDataURL()).to.equal(i.toDataURL());
+    });
+
+    it('works for empty image', async () => {
+      clipboard.writeText('Not an Image');
+      expect((await clipboard.readImageAsync()).isEmpty()).to.be.true();
+    });
+  });
+
   describe('clipboard.readText()', () => {
     it('returns unicode string correctly', () => {
       const text = '千江有水千江月，万里无云万里天';
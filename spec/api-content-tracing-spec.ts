@@ -118,6 +118,54 @@ ifdescribe(!(['arm', 'arm64'].includes(process.arch)) || (process.platform !== '
     });
   });
 
+  describe('startStreaming', function () {
+    this.timeout(10e3);
+
+    const streamFilePath = path.join(app.getPath('temp'), 'trace.pftrace');
+    afterEach(async () => {
+      await contentTracing.stopStreaming().catch(() => {});
+      if (fs.existsSync(streamFilePath)) {
+        fs.unlinkSync(streamFilePath);
+      }
+    });
+
+    it('writes the trace to disk while recording in long-trace mode', async () => {
+      await app.whenReady();
+      await contentTracing.startStreaming({ path: streamFilePath, flushPeriod: 100 });
+      await setTimeout(500);
+      expect(fs.statSync(streamFilePath).size).to.be.above(0);
+      const resultFilePath = await contentTracing.stopStreaming();
+      expect(resultFilePath).to.equal(streamFilePath);
+      expect(fs.statSync(streamFilePath).size).to.be.above(0);
+    });
+
+    it('writes the trace to disk when stopped in ring mode', async () => {
+      await app.whenReady();
+      await contentTracing.startStreaming({ path: streamFilePath, mode: 'ring', bufferSize: 1024 });
+      await setTimeout(100);
+      const resultFilePath = await contentTracing.stopStreaming();
+      expect(resultFilePath).to.equal(streamFilePath);
+      expect(fs.statSync(streamFilePath).size).to.be.above(0);
+    });
+
+    it('rejects if a trace is already being streamed', async () => {
+      await app.whenReady();
+      await contentTracing.startStreaming({ path: streamFilePath });
+      await expect(contentTracing.startStreaming({ path: streamFilePath })).to.be.rejectedWith('A trace is already being streamed');
+    });
+
+    it('rejects if no trace is being streamed', async () => {
+      await expect(contentTracing.stopStreaming()).to.be.rejectedWith('No trace is being streamed');
+    });
+
+    it('throws on invalid options', () => {
+      expect(() => contentTracing.startStreaming({ path: '' })).to.throw(/path must be a non-empty string/);
+      expect(() => contentTracing.startStreaming({ path: streamFilePath, mode: 'circular' as any })).to.throw(/mode must be 'long-trace' or 'ring'/);
+      expect(() => contentTracing.startStreaming({ path: streamFilePath, bufferSize: 1 })).to.throw(/bufferSize must be between 1024 and 4194304/);
+      expect(() => contentTracing.startStreaming({ path: streamFilePath, flushPeriod: 1 })).to.throw(/flushPeriod must be at least 100 milliseconds/);
+    });
+  });
+
   describe('captured events', () => {
     it('include V8 samples from the main process', async function () {
       this.timeout(60000);
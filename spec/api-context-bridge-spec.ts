@@ -428,6 +428,24 @@ describe('contextBridge', () => {
         expect(result).to.deep.equal([123, 123, 123]);
       });
 
+      it('should proxy many objects with the same shape', async () => {
+        await makeBindingWindow(() => {
+          const keys = Array.from({ length: 20 }, (_, i) => `key${i}`);
+          const make = (n: number) => Object.fromEntries(keys.map((key, i) => [key, i === 0 ? () => n : n + i]));
+          contextBridge.exposeInMainWorld('example', {
+            first: make(100),
+            second: make(200),
+            make
+          });
+        });
+        const result = await callWithBindings(async (root: any) => {
+          const { first, second, make } = root.example;
+          const third = make(300);
+          return [Object.keys(first).length, first.key0(), first.key19, second.key0(), second.key19, third.key0(), third.key19, Object.isFrozen(third)];
+        });
+        expect(result).to.deep.equal([20, 100, 119, 200, 219, 300, 319, false]);
+      });
+
       it('should proxy methods in the reverse direction', async () => {
         await makeBindingWindow(() => {
           contextBridge.exposeInMainWorld('example', {
@@ -1318,3 +1336,55 @@ describe('ContextBridgeMutability', () => {
     expect(output).to.include('1,2,3,4');
   });
 });
+
+describe('ContextBridgeShareArrayBuffers', () => {
+  const runApp = async (args: string[]) => {
+    const appPath = path.join(fixturesPath, 'context-bridge-share-array-buffers');
+    const appProcess = cp.spawn(process.execPath, ['--enable-logging', ...args, appPath]);
+
+    let output = '';
+    appProcess.stdout.on('data', data => { output += data; });
+    await once(appProcess, 'exit');
+    return output;
+  };
+
+  it('should share the memory of typed arrays if ContextBridgeShareArrayBuffers is on', async () => {
+    const output = await runApp(['--enable-features=ContextBridgeShareArrayBuffers']);
+    expect(output).to.include('type:Uint8Array');
+    expect(output).to.include('first:42');
+    expect(output).to.include('view:2');
+  });
+
+  it('should copy typed arrays if ContextBridgeShareArrayBuffers is off', async () => {
+    const output = await runApp([]);
+    expect(output).to.include('type:Uint8Array');
+    expect(output).to.include('first:1');
+    expect(output).to.include('view:2');
+  });
+});
+
+describe('ContextBridgeLazyProxies', () => {
+  const runApp = async (args: string[]) => {
+    const appPath = path.join(fixturesPath, 'context-bridge-lazy-proxies');
+    const appProcess = cp.spawn(process.execPath, ['--enable-logging', ...args, appPath]);
+
+    let output = '';
+    appProcess.stdout.on('data', data => { output += data; });
+    await once(appProcess, 'exit');
+    return output;
+  };
+
+  it('should pass nested objects when they are first read if ContextBridgeLazyProxies is on', async () => {
+    const output = await runApp(['--enable-features=ContextBridgeLazyProxies']);
+    expect(output).to.include('nested:2');
+    expect(output).to.include('list:2');
+    expect(output).to.include('frozen:true');
+  });
+
+  it('should pass nested objects eagerly if ContextBridgeLazyProxies is off', async () => {
+    const output = await runApp([]);
+    expect(output).to.include('nested:1');
+    expect(output).to.include('list:1');
+    expect(output).to.include('frozen:true');
+  });
+});
@@ -120,6 +120,57 @@ describe('debugger module', () => {
       expect(params.message.text).to.equal('a');
     });
 
+    it('returns response when attached with binaryMessages', async () => {
+      w.webContents.loadURL('about:blank');
+      w.webContents.debugger.attach(undefined, { binaryMessages: true });
+
+      const params = { expression: '4+2' };
+      const res = await w.webContents.debugger.sendCommand('Runtime.evaluate', params);
+
+      expect(res.wasThrown).to.be.undefined();
+      expect(res.result.value).to.equal(6);
+
+      w.webContents.debugger.detach();
+    });
+
+    it('fires binary-message event when attached with binaryMessages', async () => {
+      w.webContents.loadURL(`file://${path.join(fixtures, 'pages', 'a.html')}`);
+      w.webContents.debugger.attach(undefined, { binaryMessages: true });
+      const message = emittedUntil(w.webContents.debugger, 'binary-message',
+        (event: Electron.Event, method: string) => method === 'Console.messageAdded');
+      w.webContents.debugger.sendCommand('Console.enable');
+      const [,, data, sessionId] = await message;
+      w.webContents.debugger.detach();
+      expect(data).to.be.an.instanceOf(Buffer);
+      expect(data.length).to.be.greaterThan(0);
+      expect(sessionId).to.equal('');
+    });
+
+    it('drops events that are not allowed by the event filter', async () => {
+      w.webContents.loadURL(`file://${path.join(fixtures, 'pages', 'a.html')}`);
+      w.webContents.debugger.attach();
+      w.webContents.debugger.setEventFilter({ methods: ['Runtime.*'] });
+      const methods: string[] = [];
+      w.webContents.debugger.on('message', (event, method) => methods.push(method));
+      await w.webContents.debugger.sendCommand('Console.enable');
+      await w.webContents.debugger.sendCommand('Runtime.enable');
+      await w.webContents.debugger.sendCommand('Runtime.evaluate', { expression: 'console.log("b")' });
+      w.webContents.debugger.detach();
+      expect(methods).to.include('Runtime.consoleAPICalled');
+      expect(methods.every(method => method.startsWith('Runtime.'))).to.be.true();
+    });
+
+    it('throws for an invalid event filter', () => {
+      w.webContents.debugger.attach();
+      expect(() => {
+        w.webContents.debugger.setEventFilter({ sampleRate: 0 });
+      }).to.throw(/sampleRate must be a number in the range \(0, 1\]/);
+      expect(() => {
+        w.webContents.debugger.setEventFilter({ methods: 'Runtime.*' as any });
+      }).to.throw(/methods must be an array of strings/);
+      w.webContents.debugger.detach();
+    });
+
     it('returns error message when command fails', async () => {
       w.webContents.loadURL('about:blank');
       w.webContents.debugger.attach();
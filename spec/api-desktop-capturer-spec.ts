@@ -242,4 +242,33 @@ ifdescribe(!process.arch.includes('arm') && process.platform !== 'win32')('deskt
       destroyWindows();
     }
   });
+
+  describe('watchSources()', () => {
+    it('throws an error for invalid options', () => {
+      expect(() => desktopCapturer.watchSources(['screen'] as any, () => {})).to.throw('Invalid options');
+      expect(() => desktopCapturer.watchSources({ types: ['screen'], thumbnailUpdateInterval: 0 }, () => {})).to.throw('thumbnailUpdateInterval must be greater than 0');
+    });
+
+    it('reports the current sources as added', async () => {
+      const ids = (await desktopCapturer.getSources({ types: ['screen'] })).map(s => s.id);
+      const added: string[] = [];
+      const stop = desktopCapturer.watchSources({ types: ['screen'], thumbnailSize: { width: 0, height: 0 } }, (details) => {
+        if (details.type === 'added') added.push(details.id);
+      });
+      try {
+        while (added.length < ids.length) await setTimeout(100);
+      } finally {
+        stop();
+      }
+      expect(added.sort()).to.deep.equal(ids.sort());
+    });
+
+    it('stops reporting once stopped', async () => {
+      let calls = 0;
+      const stop = desktopCapturer.watchSources({ types: ['screen'], thumbnailUpdateInterval: 50 }, () => { calls++; });
+      stop();
+      await setTimeout(500);
+      expect(calls).to.equal(0);
+    });
+  });
 });
@@ -210,6 +210,19 @@ describe('dialog module', () => {
     });
   });
 
+  describe('prewarmDirectory', () => {
+    it('does not throw for an existing or missing directory', () => {
+      expect(() => dialog.prewarmDirectory(__dirname)).to.not.throw();
+      expect(() => dialog.prewarmDirectory('/this/path/does/not/exist')).to.not.throw();
+    });
+
+    it('throws errors when the path is invalid', () => {
+      expect(() => {
+        (dialog.prewarmDirectory as any)(3);
+      }).to.throw(/path must be a string/);
+    });
+  });
+
   describe('showCertificateTrustDialog', () => {
     it('throws errors when the options are invalid', () => {
       expect(() => {
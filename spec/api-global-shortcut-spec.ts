@@ -39,6 +39,32 @@ ifdescribe(process.platform !== 'win32')('globalShortcut module', () => {
     expect(globalShortcut.isRegistered(accelerators[1])).to.be.false('second unregistered');
   });
 
+  it('can update several accelerators at once', () => {
+    globalShortcut.registerAll(['CmdOrCtrl+1', 'CmdOrCtrl+2'], () => {});
+
+    expect(globalShortcut.update({
+      unregister: ['CmdOrCtrl+1', 'CmdOrCtrl+2'],
+      register: [
+        { accelerator: 'CmdOrCtrl+2', callback: () => {} },
+        { accelerator: 'CmdOrCtrl+3', callback: () => {} }
+      ]
+    })).to.be.true('update succeeded');
+
+    expect(globalShortcut.isRegistered('CmdOrCtrl+1')).to.be.false('first unregistered');
+    expect(globalShortcut.isRegistered('CmdOrCtrl+2')).to.be.true('second kept');
+    expect(globalShortcut.isRegistered('CmdOrCtrl+3')).to.be.true('third registered');
+  });
+
+  it('throws errors when the changes are invalid', () => {
+    expect(() => {
+      (globalShortcut.update as any)();
+    }).to.throw(/changes must be an object/);
+
+    expect(() => {
+      globalShortcut.update({ register: [{ accelerator: 'CmdOrCtrl+1' } as any] });
+    }).to.throw(/each shortcut to register must have a callback/);
+  });
+
   it('does not crash when registering media keys as global shortcuts', () => {
     const accelerators = [
       'VolumeUp',
@@ -132,6 +132,69 @@ describe('ipcRenderer module', () => {
     });
   });
 
+  describe('setChannelPriority()', () => {
+    it('delivers the messages of urgent and bulk channels', async () => {
+      const received = Promise.all([
+        once(ipcMain, 'priority-urgent'),
+        once(ipcMain, 'priority-bulk'),
+        once(ipcMain, 'priority-normal')
+      ]);
+      w.webContents.executeJavaScript(`(() => {
+        const { ipcRenderer } = require('electron')
+        ipcRenderer.setChannelPriority('priority-urgent', 'urgent')
+        ipcRenderer.setChannelPriority('priority-bulk', 'bulk')
+        ipcRenderer.setChannelPriority('priority-normal', 'normal')
+        ipcRenderer.send('priority-bulk', 'bulk')
+        ipcRenderer.send('priority-normal', 'normal')
+        ipcRenderer.send('priority-urgent', 'urgent')
+      })()`);
+      const [[urgent, urgentArg], [bulk, bulkArg], [normal, normalArg]] = await received;
+      expect(urgentArg).to.equal('urgent');
+      expect(bulkArg).to.equal('bulk');
+      expect(normalArg).to.equal('normal');
+      for (const event of [urgent, bulk, normal]) {
+        expect(event.sender).to.equal(w.webContents);
+      }
+    });
+
+    it('throws on an invalid priority', async () => {
+      await expect(w.webContents.executeJavaScript(`
+        require('electron').ipcRenderer.setChannelPriority('channel', 'high')
+      `)).to.eventually.be.rejectedWith(/priority must be one of/);
+    });
+  });
+
+  describe('setFrameAligned()', () => {
+    it('emits the messages of a channel together', async () => {
+      const result = w.webContents.executeJavaScript(`new Promise(resolve => {
+        const { ipcRenderer } = require('electron')
+        ipcRenderer.setFrameAligned('frame-aligned')
+        const received = []
+        ipcRenderer.on('frame-aligned', (event, value) => {
+          if (received.push(value) === 1) {
+            queueMicrotask(() => {
+              ipcRenderer.removeAllListeners('frame-aligned')
+              ipcRenderer.setFrameAligned('frame-aligned', false)
+              resolve(received)
+            })
+          }
+        })
+        ipcRenderer.send('frame-aligned-ready')
+      })`);
+      await once(ipcMain, 'frame-aligned-ready');
+      for (let i = 0; i < 3; i++) {
+        w.webContents.send('frame-aligned', i);
+      }
+      expect(await result).to.deep.equal([0, 1, 2]);
+    });
+
+    it('throws when the channel is not a string', async () => {
+      await expect(w.webContents.executeJavaScript(`
+        require('electron').ipcRenderer.setFrameAligned(1)
+      `)).to.eventually.be.rejectedWith(/channel must be a string/);
+    });
+  });
+
   describe('ipcRenderer.on', () => {
     it('is not used for internals', async () => {
       const result = await w.webContents.executeJavaScript(`
@@ -1,6 +1,6 @@
 import { EventEmitter, once } from 'node:events';
 import { expect } from 'chai';
-import { BrowserWindow, ipcMain, IpcMainInvokeEvent, MessageChannelMain, WebContents } from 'electron/main';
+import { BrowserWindow, ipcMain, IpcMainInvokeEvent, MessageChannelMain, utilityProcess, WebContents } from 'electron/main';
 import { closeAllWindows } from './lib/window-helpers';
 import { defer, listen } from './lib/spec-helpers';
 import * as path from 'node:path';
@@ -112,6 +112,23 @@ describe('ipc module', () => {
       }
     });
 
+    it('runs handlers registered with handleWithPool in the pool', async () => {
+      const pool = utilityProcess.createPool(path.join(fixturesPath, 'api', 'ipc-pool-worker.js'), { size: 1 });
+      defer(() => pool.close());
+      ipcMain.handleWithPool('test', pool);
+      defer(() => ipcMain.removeHandler('test'));
+      const done = new Promise<any>(resolve => ipcMain.once('result', (e, arg) => resolve(arg)));
+      await w.webContents.executeJavaScript(`(${rendererInvoke})(1, 2, 3)`);
+      const { result } = await done;
+      expect(result.channel).to.equal('test');
+      expect(result.sum).to.equal(6);
+      expect(result.pid).to.not.equal(process.pid);
+    });
+
+    it('throws when handleWithPool is not given a pool', () => {
+      expect(() => { ipcMain.handleWithPool('test', {} as any); }).to.throw(/Expected pool to be a UtilityProcessPool/);
+    });
+
     it('throws an error in the renderer if the reply callback is dropped', async () => {
       ipcMain.handleOnce('test', () => new Promise(() => {
         setTimeout(() => v8Util.requestGarbageCollectionForTesting());
@@ -123,6 +140,140 @@ describe('ipc module', () => {
     });
   });
 
+  describe('ipcMain.setSyncReply', () => {
+    let w: BrowserWindow;
+
+    before(async () => {
+      w = new BrowserWindow({ show: false, webPreferences: { nodeIntegration: true, contextIsolation: false } });
+      await w.loadURL('about:blank');
+    });
+    after(async () => {
+      ipcMain.removeSyncReply('test-sync-reply');
+      w.destroy();
+    });
+
+    it('answers sendSync without emitting an event', async () => {
+      let emitted = false;
+      ipcMain.once('test-sync-reply', (e) => { emitted = true; e.returnValue = 'from listener'; });
+      defer(() => ipcMain.removeAllListeners('test-sync-reply'));
+      ipcMain.setSyncReply('test-sync-reply', { answer: [42] });
+      const result = await w.webContents.executeJavaScript('require(\'electron\').ipcRenderer.sendSync(\'test-sync-reply\', 1)');
+      expect(result).to.deep.equal({ answer: [42] });
+      expect(emitted).to.be.false();
+    });
+
+    it('answers every webContents without calling webContents.ipc listeners', async () => {
+      const w2 = new BrowserWindow({ show: false, webPreferences: { nodeIntegration: true, contextIsolation: false, partition: 'test-sync-reply' } });
+      defer(() => w2.destroy());
+      await w2.loadURL('about:blank');
+      let emitted = false;
+      w2.webContents.ipc.once('test-sync-reply', (e) => { emitted = true; e.returnValue = 'from listener'; });
+      ipcMain.setSyncReply('test-sync-reply', 'fixed');
+      const result = await w2.webContents.executeJavaScript('require(\'electron\').ipcRenderer.sendSync(\'test-sync-reply\', 1)');
+      expect(result).to.equal('fixed');
+      expect(emitted).to.be.false();
+    });
+
+    it('emits events again after removeSyncReply', async () => {
+      ipcMain.setSyncReply('test-sync-reply', 'fixed');
+      ipcMain.removeSyncReply('test-sync-reply');
+      ipcMain.once('test-sync-reply', (e, arg) => { e.returnValue = arg + 1; });
+      const result = await w.webContents.executeJavaScript('require(\'electron\').ipcRenderer.sendSync(\'test-sync-reply\', 1)');
+      expect(result).to.equal(2);
+    });
+
+    it('is not supported on webContents.ipc', () => {
+      expect(() => w.webContents.ipc.setSyncReply('test-sync-reply', 1)).to.throw(/only supported on ipcMain/);
+    });
+  });
+
+  describe('ipcMain.getMetrics', () => {
+    let w: BrowserWindow;
+
+    before(async () => {
+      w = new BrowserWindow({ show: false, webPreferences: { nodeIntegration: true, contextIsolation: false } });
+      await w.loadURL('about:blank');
+    });
+    after(async () => {
+      w.destroy();
+    });
+
+    it('counts messages, invokes and replies per channel', async () => {
+      ipcMain.resetMetrics();
+      ipcMain.handle('test-metrics-invoke', () => 'x'.repeat(100));
+      defer(() => ipcMain.removeHandler('test-metrics-invoke'));
+      const received = once(ipcMain, 'test-metrics-message');
+      await w.webContents.executeJavaScript(`(async () => {
+        const { ipcRenderer } = require('electron');
+        ipcRenderer.send('test-metrics-message', 'a'.repeat(1000));
+        await ipcRenderer.invoke('test-metrics-invoke');
+        await ipcRenderer.invoke('test-metrics-invoke');
+      })()`);
+      await received;
+      const metrics = ipcMain.getMetrics();
+      const message = metrics.find(m => m.channel === 'test-metrics-message')!;
+      expect(message.messages).to.equal(1);
+      expect(message.bytes).to.be.at.least(1000);
+      expect(message.replies).to.equal(0);
+      const invoke = metrics.find(m => m.channel === 'test-metrics-invoke')!;
+      expect(invoke.invokes).to.equal(2);
+      expect(invoke.replies).to.equal(2);
+      expect(invoke.replyBytes).to.be.at.least(200);
+      expect(invoke.handlerTimeHistogram).to.have.lengthOf(12);
+      expect(invoke.handlerTimeHistogram.reduce((a, b) => a + b)).to.equal(2);
+      expect(invoke.maxHandlerTime).to.be.at.most(invoke.totalHandlerTime);
+
+      ipcMain.resetMetrics();
+      expect(ipcMain.getMetrics()).to.deep.equal([]);
+    });
+  });
+
+  describe('large ArrayBuffers', () => {
+    let w: BrowserWindow;
+
+    before(async () => {
+      w = new BrowserWindow({ show: false, webPreferences: { nodeIntegration: true, contextIsolation: false } });
+      await w.loadURL('about:blank');
+    });
+    after(async () => {
+      w.destroy();
+    });
+
+    it('are received intact and are not detached in the sender', async () => {
+      const received = once(ipcMain, 'large-buffer');
+      const senderByteLength = w.webContents.executeJavaScript(`(() => {
+        const { ipcRenderer } = require('electron');
+        const bytes = new Uint8Array(1024 * 1024).map((_, i) => i % 251);
+        const view = new Uint8Array(bytes.buffer, 16, 1024);
+        ipcRenderer.send('large-buffer', { bytes, nested: [view] }, bytes);
+        return bytes.byteLength;
+      })()`);
+      const [, { bytes, nested }, same] = await received;
+      expect(await senderByteLength).to.equal(1024 * 1024);
+      expect(bytes).to.be.an.instanceOf(Uint8Array);
+      expect(bytes.byteLength).to.equal(1024 * 1024);
+      expect(bytes.every((b: number, i: number) => b === i % 251)).to.be.true();
+      expect(nested[0].byteOffset).to.equal(16);
+      expect(nested[0][0]).to.equal(16);
+      expect(nested[0].buffer).to.equal(bytes.buffer);
+      expect(same.buffer).to.equal(bytes.buffer);
+    });
+
+    it('runs getters in the arguments once', async () => {
+      const received = once(ipcMain, 'large-buffer-getter');
+      const getterCalls = w.webContents.executeJavaScript(`(() => {
+        const { ipcRenderer } = require('electron');
+        let calls = 0;
+        const bytes = new Uint8Array(1024 * 1024);
+        ipcRenderer.send('large-buffer-getter', { get bytes () { calls++; return bytes; } });
+        return calls;
+      })()`);
+      const [, { bytes }] = await received;
+      expect(await getterCalls).to.equal(1);
+      expect(bytes.byteLength).to.equal(1024 * 1024);
+    });
+  });
+
   describe('ordering', () => {
     let w: BrowserWindow;
 
@@ -198,6 +349,42 @@ describe('ipc module', () => {
       expect(received).to.have.lengthOf(1000);
       expect(received).to.deep.equal([...received].sort((a, b) => a - b));
     });
+
+    it('between sendBatched, send, and sendSync is consistent', async () => {
+      const received: number[] = [];
+      ipcMain.on('test-batched', (e, i) => { received.push(i); });
+      ipcMain.on('test-async', (e, i) => { received.push(i); });
+      ipcMain.on('test-sync', (e, i) => { received.push(i); e.returnValue = null; });
+      const done = new Promise<void>(resolve => ipcMain.once('done', () => { resolve(); }));
+      function rendererStressTest () {
+        const { ipcRenderer } = require('electron');
+        for (let i = 0; i < 1000; i++) {
+          switch ((Math.random() * 4) | 0) {
+            case 0:
+            case 1:
+              ipcRenderer.sendBatched('test-batched', i);
+              break;
+            case 2:
+              ipcRenderer.send('test-async', i);
+              break;
+            case 3:
+              ipcRenderer.sendSync('test-sync', i);
+              break;
+          }
+        }
+        ipcRenderer.sendBatched('done');
+      }
+      try {
+        w.webContents.executeJavaScript(`(${rendererStressTest})()`);
+        await done;
+      } finally {
+        ipcMain.removeAllListeners('test-batched');
+        ipcMain.removeAllListeners('test-async');
+        ipcMain.removeAllListeners('test-sync');
+      }
+      expect(received).to.have.lengthOf(1000);
+      expect(received).to.deep.equal([...received].sort((a, b) => a - b));
+    });
   });
 
   describe('MessagePort', () => {
@@ -411,11 +598,6 @@ describe('ipc module', () => {
       it('throws an error when an invalid parameter is sent to postMessage', () => {
         const { port1 } = new MessageChannelMain();
 
-        expect(() => {
-          const buffer = new ArrayBuffer(10) as any;
-          port1.postMessage(null, [buffer]);
-        }).to.throw(/Port at index 0 is not a valid port/);
-
         expect(() => {
           port1.postMessage(null, ['1' as any]);
         }).to.throw(/Port at index 0 is not a valid port/);
@@ -425,6 +607,35 @@ describe('ipc module', () => {
         }).to.throw(/Port at index 0 is not a valid port/);
       });
 
+      it('throws when an ArrayBuffer cannot be transferred', () => {
+        const { port1 } = new MessageChannelMain();
+        const buffer = new ArrayBuffer(10);
+
+        expect(() => {
+          port1.postMessage(null, [buffer, buffer]);
+        }).to.throw(/ArrayBuffer at index 1 is a duplicate./);
+
+        port1.postMessage(null, [buffer]);
+        expect(() => {
+          port1.postMessage(null, [buffer]);
+        }).to.throw(/ArrayBuffer at index 0 is already detached./);
+      });
+
+      it('can transfer ArrayBuffers', async () => {
+        const { port1, port2 } = new MessageChannelMain();
+        const small = new Uint8Array([1, 2, 3]).buffer;
+        const large = new ArrayBuffer(1024 * 1024);
+        new Uint8Array(large)[large.byteLength - 1] = 42;
+        port2.postMessage({ small, large }, [small, large]);
+        expect(small.byteLength).to.equal(0);
+        expect(large.byteLength).to.equal(0);
+        port1.start();
+        const [{ data }] = await once(port1, 'message');
+        expect([...new Uint8Array(data.small)]).to.deep.equal([1, 2, 3]);
+        expect(data.large.byteLength).to.equal(1024 * 1024);
+        expect(new Uint8Array(data.large)[data.large.byteLength - 1]).to.equal(42);
+      });
+
       it('throws when postMessage transferables contains the source port', () => {
         const { port1 } = new MessageChannelMain();
 
@@ -441,6 +652,33 @@ describe('ipc module', () => {
         expect(ev.data).to.equal('hello');
       });
 
+      it('can deliver messages in batches', async () => {
+        const { port1, port2 } = new MessageChannelMain();
+        for (let i = 0; i < 100; i++) port2.postMessage(i);
+        port1.on('message', () => { throw new Error('unexpected message event'); });
+        port1.start({ batch: true });
+        const received: number[] = [];
+        while (received.length < 100) {
+          const [events] = await once(port1, 'message-batch');
+          expect(events).to.be.an('array').that.is.not.empty();
+          received.push(...events.map((e: any) => e.data));
+        }
+        expect(received).to.deep.equal([...Array(100).keys()]);
+      });
+
+      it('delivers transferred ports in batches', async () => {
+        const { port1, port2 } = new MessageChannelMain();
+        const { port1: port3, port2: port4 } = new MessageChannelMain();
+        port2.postMessage(null, [port4]);
+        port3.postMessage('hello');
+        port1.start({ batch: true });
+        const [[event]] = await once(port1, 'message-batch');
+        const [port] = event.ports;
+        port.start();
+        const [{ data }] = await once(port, 'message');
+        expect(data).to.equal('hello');
+      });
+
       it('can pass one end to a WebContents', async () => {
         const w = new BrowserWindow({ show: false, webPreferences: { nodeIntegration: true, contextIsolation: false } });
         w.loadURL('about:blank');
@@ -781,6 +781,63 @@ describe('Menu module', function () {
     });
   });
 
+  describe('Menu.remove', () => {
+    it('should throw when attempting to remove at out-of-range indices', () => {
+      const menu = Menu.buildFromTemplate([
+        { label: '1' },
+        { label: '2' }
+      ]);
+
+      expect(() => {
+        menu.remove(2);
+      }).to.throw(/Position 2 must be less than the total MenuItem count/);
+
+      expect(() => {
+        menu.remove(-1);
+      }).to.throw(/Position -1 cannot be less than 0/);
+    });
+
+    it('should remove the item at the index', () => {
+      const menu = Menu.buildFromTemplate([
+        { label: '1', id: 'one' },
+        { label: '2', id: 'two' },
+        { label: '3', id: 'three' }
+      ]);
+
+      menu.remove(1);
+      expect(menu.items.map(item => item.label)).to.deep.equal(['1', '3']);
+      expect(menu.getMenuItemById('two')).to.be.null();
+      expect((menu as any).getItemCount()).to.equal(2);
+      expect((menu as any).getLabelAt(1)).to.equal('3');
+    });
+
+    it('should update radio groups', () => {
+      const menu = Menu.buildFromTemplate([
+        { label: '1', type: 'radio', checked: true },
+        { label: '2', type: 'radio' }
+      ]);
+
+      menu.remove(0);
+      (menu as any)._menuWillShow();
+      expect(menu.items[0].checked).to.be.true();
+    });
+  });
+
+  describe('MenuItem label', () => {
+    it('updates the menu in place when changed', () => {
+      const menu = Menu.buildFromTemplate([
+        { label: '1' },
+        { label: '2', sublabel: 'a' }
+      ]);
+
+      menu.items[1].label = 'changed';
+      menu.items[1].sublabel = 'b';
+      expect(menu.items[1].label).to.equal('changed');
+      expect((menu as any).getLabelAt(1)).to.equal('changed');
+      expect((menu as any).getSublabelAt(1)).to.equal('b');
+    });
+  });
+
   describe('Menu.popup', () => {
     let w: BrowserWindow;
     let menu: Menu;
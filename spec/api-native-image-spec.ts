@@ -273,6 +273,40 @@ describe('nativeImage module', () => {
     });
   });
 
+  describe('encode()', () => {
+    it('resolves with PNG data by default', async () => {
+      const image = nativeImage.createFromPath(imageLogo.path);
+      const buffer = await image.encode();
+      expect(buffer.equals(image.toPNG())).to.be.true();
+    });
+
+    it('encodes to JPEG and WebP', async () => {
+      const image = nativeImage.createFromPath(imageLogo.path);
+
+      const jpeg = await image.encode({ format: 'jpeg', quality: 80 });
+      expect(nativeImage.createFromBuffer(jpeg).getSize()).to.deep.equal(
+        { width: imageLogo.width, height: imageLogo.height });
+
+      const webp = await image.encode({ format: 'webp' });
+      expect(webp.subarray(0, 4).toString()).to.equal('RIFF');
+      expect(webp.subarray(8, 12).toString()).to.equal('WEBP');
+    });
+
+    it('supports a scale factor', async () => {
+      const image = nativeImage.createFromPath(imageLogo.path);
+      const buffer = await image.encode({ scaleFactor: 2.0 });
+      expect(nativeImage.createFromBuffer(buffer, { scaleFactor: 2.0 }).getSize()).to.deep.equal(
+        { width: imageLogo.width / 2, height: imageLogo.height / 2 });
+    });
+
+    it('rejects for invalid options', async () => {
+      const image = nativeImage.createFromPath(imageLogo.path);
+      await expect(image.encode({ format: 'gif' as any })).to.eventually.be.rejectedWith('Unsupported format: gif');
+      await expect(image.encode({ format: 'jpeg', quality: 101 })).to.eventually.be.rejectedWith('quality must be between 0 and 100');
+      await expect(nativeImage.createEmpty().encode()).to.eventually.be.rejectedWith('Cannot encode an empty image');
+    });
+  });
+
   describe('createFromPath(path)', () => {
     it('returns an empty image for invalid paths', () => {
       expect(nativeImage.createFromPath('').isEmpty()).to.be.true();
@@ -380,6 +414,21 @@ describe('nativeImage module', () => {
     });
   });
 
+  describe('resizeAsync(sizes)', () => {
+    it('resolves with an image for each size', async () => {
+      const image = nativeImage.createFromPath(path.join(fixturesPath, 'assets', 'logo.png'));
+      const sizes = [{}, { width: 269 }, { height: 200 }, { width: 80, height: 65 }, { width: 0, height: 0 }];
+      const resized = await image.resizeAsync(sizes);
+      expect(resized.map(i => i.getSize())).to.deep.equal(sizes.map(s => image.resize(s).getSize()));
+      expect(resized[4].isEmpty()).to.be.true();
+    });
+
+    it('resolves with an empty array when no sizes are passed', async () => {
+      const image = nativeImage.createFromPath(path.join(fixturesPath, 'assets', 'logo.png'));
+      expect(await image.resizeAsync([])).to.deep.equal([]);
+    });
+  });
+
   describe('crop(bounds)', () => {
     it('returns an empty image when called on an empty image', () => {
       expect(nativeImage.createEmpty().crop({ width: 1, height: 2, x: 0, y: 0 }).isEmpty()).to.be.true();
@@ -484,6 +533,56 @@ describe('nativeImage module', () => {
     }, [path.join(fixturesPath, 'assets', 'logo.png')]);
   });
 
+  ifdescribe(process.platform !== 'linux')('createThumbnailsFromPath(paths, size)', () => {
+    it('throws when invalid size is passed', async () => {
+      await expect(
+        nativeImage.createThumbnailsFromPath(['path'], { width: -1, height: -1 })
+      ).to.eventually.be.rejectedWith('size must not be empty');
+    });
+
+    it('returns a thumbnail per path in order, empty for bad paths', async () => {
+      const logoPath = path.join(fixturesPath, 'assets', 'logo.png');
+      const badPath = process.platform === 'win32' ? '\\hey\\hi\\hello' : '/hey/hi/hello';
+      const size = { width: 64, height: 64 };
+      const results = await nativeImage.createThumbnailsFromPath([logoPath, badPath, logoPath], size);
+      expect(results).to.have.lengthOf(3);
+      expect(results[0].isEmpty()).to.be.false();
+      expect(results[1].isEmpty()).to.be.true();
+      expect(results[2].getSize()).to.deep.equal(results[0].getSize());
+    });
+
+    it('resolves with an empty array for no paths', async () => {
+      const results = await nativeImage.createThumbnailsFromPath([], { width: 64, height: 64 });
+      expect(results).to.deep.equal([]);
+    });
+  });
+
+  describe('release()', () => {
+    it('empties the image', () => {
+      const image = nativeImage.createFromPath(imageLogo.path);
+      expect(image.isEmpty()).to.be.false();
+      image.release();
+      expect(image.isEmpty()).to.be.true();
+      expect(image.getSize()).to.deep.equal({ width: 0, height: 0 });
+      expect(image.toPNG()).to.have.lengthOf(0);
+    });
+
+    it('does not affect images derived from it', () => {
+      const image = nativeImage.createFromPath(imageLogo.path);
+      const resized = image.resize({ width: 100 });
+      const cropped = image.crop({ x: 0, y: 0, width: 10, height: 10 });
+      image.release();
+      expect(resized.getSize().width).to.equal(100);
+      expect(cropped.getSize()).to.deep.equal({ width: 10, height: 10 });
+    });
+
+    it('can be called on an empty image', () => {
+      const image = nativeImage.createEmpty();
+      image.release();
+      expect(image.isEmpty()).to.be.true();
+    });
+  });
+
   describe('addRepresentation()', () => {
     it('does not add representation when the buffer is too small', () => {
       const image = nativeImage.createEmpty();
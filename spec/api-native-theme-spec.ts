@@ -57,6 +57,20 @@ describe('nativeTheme module', () => {
       expect(called).to.equal(false);
     });
 
+    it('should emit the "updated" event once when it is changed several times in a row', async () => {
+      nativeTheme.themeSource = 'light';
+      await setTimeout(20);
+      let count = 0;
+      const listener = () => { count++; };
+      nativeTheme.on('updated', listener);
+      nativeTheme.themeSource = 'dark';
+      nativeTheme.themeSource = 'light';
+      nativeTheme.themeSource = 'dark';
+      await setTimeout(20);
+      nativeTheme.off('updated', listener);
+      expect(count).to.equal(1);
+    });
+
     const getPrefersColorSchemeIsDark = async (w: Electron.BrowserWindow) => {
       const isDark: boolean = await w.webContents.executeJavaScript(
         'matchMedia("(prefers-color-scheme: dark)").matches'
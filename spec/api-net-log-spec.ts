@@ -8,6 +8,7 @@ import { session, net } from 'electron/main';
 import { Socket } from 'node:net';
 import { ifit, listen } from './lib/spec-helpers';
 import { once } from 'node:events';
+import { setTimeout } from 'node:timers/promises';
 
 const appPath = path.join(__dirname, 'fixtures', 'api', 'net-log');
 const dumpFile = path.join(os.tmpdir(), 'net_log.json');
@@ -101,6 +102,51 @@ describe('netLog module', () => {
     expect(dump).to.contain(`foo=${unique}`);
   });
 
+  describe('recording', () => {
+    afterEach(() => {
+      testNetLog().stopRecording();
+      expect(testNetLog().currentlyRecording).to.be.false('currently recording');
+    });
+
+    it('keeps recent events until they are dumped', async () => {
+      testNetLog().startRecording({ captureMode: 'includeSensitive' });
+      expect(testNetLog().currentlyRecording).to.be.true('currently recording');
+      // Let the first segment start.
+      await setTimeout(500);
+
+      const unique = require('uuid').v4();
+      await new Promise<void>((resolve) => {
+        const req = net.request(serverUrl);
+        req.setHeader('Cookie', `foo=${unique}`);
+        req.on('response', (response) => {
+          response.on('data', () => {});
+          response.on('end', () => resolve());
+        });
+        req.end();
+      });
+
+      await testNetLog().dumpRecording(dumpFileDynamic);
+      const dump = JSON.parse(fs.readFileSync(dumpFileDynamic, 'utf8'));
+      expect(dump.constants).to.be.an('object');
+      expect(dump.events).to.be.an('array').that.is.not.empty();
+      expect(JSON.stringify(dump.events)).to.contain(`foo=${unique}`);
+      expect(testNetLog().currentlyRecording).to.be.true('currently recording');
+    });
+
+    it('rejects dumps when not recording', async () => {
+      await expect(testNetLog().dumpRecording(dumpFileDynamic)).to.be.rejectedWith('No net log recording in progress');
+    });
+
+    it('throws when already recording', () => {
+      testNetLog().startRecording();
+      expect(() => testNetLog().startRecording()).to.throw(/already a net log recording/);
+    });
+
+    it('throws for an invalid maxSize', () => {
+      expect(() => testNetLog().startRecording({ maxSize: 0 })).to.throw(/Invalid value for maxSize/);
+    });
+  });
+
   it('should include socket bytes when requested', async () => {
     await testNetLog().startLogging(dumpFileDynamic, { captureMode: 'everything' });
     const unique = require('uuid').v4();
@@ -84,6 +84,61 @@ describe('net module', () => {
         expect(body).to.equal(expectedBodyData);
       });
 
+      test('should coalesce response data when responseBufferSize is set', async () => {
+        const chunks = Array.from({ length: 64 }, () => randomBuffer(kOneKiloByte));
+        const serverUrl = await respondOnce.toSingleURL(async (request, response) => {
+          for (const chunk of chunks) {
+            response.write(chunk);
+            await setTimeout(0);
+          }
+          response.end();
+        });
+        const urlRequest = net.request({ url: serverUrl, responseBufferSize: 16 * kOneKiloByte });
+        const response = await getResponse(urlRequest);
+        const received: Buffer[] = [];
+        response.on('data', (chunk: Buffer) => received.push(chunk));
+        await once(response, 'end');
+        expect(Buffer.concat(received)).to.deep.equal(Buffer.concat(chunks));
+        for (const chunk of received) {
+          expect(chunk.length).to.be.at.most(16 * kOneKiloByte);
+        }
+      });
+
+      test('should deliver buffered response data before the response ends', async () => {
+        let finishResponse: () => void = () => {};
+        const serverUrl = await respondOnce.toSingleURL((request, response) => {
+          response.write('hello');
+          finishResponse = () => response.end();
+        });
+        const urlRequest = net.request({ url: serverUrl, responseBufferSize: kOneMegaByte });
+        const response = await getResponse(urlRequest);
+        const [chunk] = await once(response, 'data');
+        expect(chunk.toString()).to.equal('hello');
+        finishResponse();
+        await collectStreamBody(response);
+      });
+
+      test('should reject an invalid responseBufferSize', () => {
+        expect(() => {
+          net.request({ url: 'https://test', responseBufferSize: -1 });
+        }).to.throw('`responseBufferSize` should be a non-negative integer');
+      });
+
+      test('should issue a request with a priority', async () => {
+        const serverUrl = await respondOnce.toSingleURL((request, response) => {
+          response.end('ok');
+        });
+        const urlRequest = net.request({ url: serverUrl, priority: 'highest' });
+        const response = await getResponse(urlRequest);
+        expect(await collectStreamBody(response)).to.equal('ok');
+      });
+
+      test('should reject an invalid priority', () => {
+        expect(() => {
+          net.request({ url: 'https://test', priority: 'urgent' as any });
+        }).to.throw("Invalid request priority 'urgent'");
+      });
+
       test('should post the correct data in a POST request', async () => {
         const bodyData = 'Hello World!';
         let postedBodyData: string = '';
@@ -1,7 +1,8 @@
 import { expect } from 'chai';
 import { Notification } from 'electron/main';
 import { once } from 'node:events';
-import { ifit } from './lib/spec-helpers';
+import { setTimeout } from 'node:timers/promises';
+import { ifdescribe, ifit } from './lib/spec-helpers';
 
 describe('Notification module', () => {
   it('sets the correct class name on the prototype', () => {
@@ -138,6 +139,53 @@ describe('Notification module', () => {
     }
   });
 
+  ifdescribe(process.platform === 'darwin')('setMaxRate()', () => {
+    afterEach(() => {
+      Notification.setMaxRate(0);
+    });
+
+    const createNotification = (title: string) => new Notification({
+      title,
+      body: 'test body',
+      silent: true
+    });
+
+    it('queues notifications over the rate and shows them later in order', async () => {
+      Notification.setMaxRate(1);
+      const notifications = ['1', '2', '3'].map(createNotification);
+      const shown: { title: string, time: number }[] = [];
+      const allShown = Promise.all(notifications.map(async (n) => {
+        await once(n, 'show');
+        shown.push({ title: n.title, time: Date.now() });
+      }));
+      for (const n of notifications) n.show();
+      await allShown;
+
+      expect(shown.map(({ title }) => title)).to.deep.equal(['1', '2', '3']);
+      // Allow for some timer slack.
+      expect(shown[1].time - shown[0].time).to.be.at.least(900);
+      expect(shown[2].time - shown[1].time).to.be.at.least(900);
+      for (const n of notifications) n.close();
+    });
+
+    it('never shows a queued notification that was closed', async () => {
+      Notification.setMaxRate(1);
+      const first = createNotification('first');
+      const queued = createNotification('queued');
+      let queuedShown = false;
+      queued.on('show', () => { queuedShown = true; });
+
+      const firstShown = once(first, 'show');
+      first.show();
+      queued.show();
+      queued.close();
+      await firstShown;
+      await setTimeout(1500);
+      expect(queuedShown).to.be.false();
+      first.close();
+    });
+  });
+
   ifit(process.platform === 'win32')('emits failed event', async () => {
     const n = new Notification({
       toastXml: 'not xml'
@@ -192,5 +192,33 @@ describe('powerMonitor', () => {
         expect(powerMonitor.isOnBatteryPower()).to.be.a('boolean');
       });
     });
+
+    describe('powerMonitor.setPowerSavingPolicy', () => {
+      afterEach(() => {
+        powerMonitor.setPowerSavingPolicy(null);
+      });
+
+      it('is inactive when the conditions do not hold', () => {
+        powerMonitor.setPowerSavingPolicy({ onBattery: false, thermalState: 'critical', frameRate: 30 });
+        expect(powerMonitor.isPowerSaving()).to.be.a('boolean');
+        powerMonitor.setPowerSavingPolicy(null);
+        expect(powerMonitor.isPowerSaving()).to.equal(false);
+      });
+
+      it('validates the policy', () => {
+        expect(() => {
+          powerMonitor.setPowerSavingPolicy({ thermalState: 'hot' as any });
+        }).to.throw("thermalState must be 'fair', 'serious' or 'critical'");
+        expect(() => {
+          powerMonitor.setPowerSavingPolicy({ speedLimit: 101 });
+        }).to.throw('speedLimit must be between 0 and 100');
+        expect(() => {
+          powerMonitor.setPowerSavingPolicy({ frameRate: 0 });
+        }).to.throw('frameRate must be a positive number');
+        expect(() => {
+          powerMonitor.setPowerSavingPolicy({ utilityProcessPoolSize: 0 });
+        }).to.throw('utilityProcessPoolSize must be a positive integer');
+      });
+    });
   });
 });
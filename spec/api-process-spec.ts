@@ -1,3 +1,5 @@
+import * as cp from 'node:child_process';
+import { once } from 'node:events';
 import * as fs from 'node:fs';
 import * as path from 'node:path';
 import { expect } from 'chai';
@@ -38,6 +40,17 @@ describe('process module', () => {
       });
     });
 
+    describe('process.getAllocatorStats()', () => {
+      it('returns allocator statistics', async () => {
+        const stats = await w.webContents.executeJavaScript('process.getAllocatorStats()');
+        expect(stats.mallocUsage).to.be.a('number');
+        expect(stats.fragmentation).to.be.within(0, 1);
+        for (const partition of Object.values<any>(stats.partitions)) {
+          expect(partition.allocated).to.be.at.most(partition.committed);
+        }
+      });
+    });
+
     describe('process.getProcessMemoryInfo()', () => {
       it('resolves promise successfully with valid data', async () => {
         const memoryInfo = await w.webContents.executeJavaScript('process.getProcessMemoryInfo()');
@@ -104,6 +117,26 @@ describe('process module', () => {
       });
     });
 
+    describe('process.startSamplingHeapProfiler()', () => {
+      it('returns a profile of the sampled allocations', async () => {
+        const profile = await w.webContents.executeJavaScript(`(() => {
+          process.startSamplingHeapProfiler({ samplingInterval: 128 });
+          globalThis.retained = Array.from({ length: 10000 }, (_, i) => ({ i }));
+          const profile = process.getSamplingHeapProfile();
+          process.stopSamplingHeapProfiler();
+          return profile;
+        })()`);
+        expect(profile.head.callFrame).to.have.property('functionName').that.is.a('string');
+        expect(profile.head.children).to.be.an('array');
+        expect(profile.samples).to.be.an('array').that.is.not.empty();
+      });
+
+      it('returns null when the profiler is not running', async () => {
+        const profile = await w.webContents.executeJavaScript('process.getSamplingHeapProfile()');
+        expect(profile).to.be.null();
+      });
+    });
+
     describe('process.contextId', () => {
       it('is a string', async () => {
         const contextId = await w.webContents.executeJavaScript('process.contextId');
@@ -128,6 +161,27 @@ describe('process module', () => {
       });
     });
 
+    describe('process.getNativeObjectStats()', () => {
+      it('returns null when tracking is disabled', () => {
+        expect(process.getNativeObjectStats()).to.be.null();
+      });
+
+      it('counts live objects per type', async () => {
+        const appPath = path.join(__dirname, 'fixtures', 'api', 'native-object-stats');
+        const appProcess = cp.spawn(process.execPath, [appPath], {
+          env: { ...process.env, ELECTRON_TRACK_NATIVE_OBJECTS: 'stack' }
+        });
+        let output = '';
+        appProcess.stdout.on('data', (data) => { output += data; });
+        await once(appProcess.stdout, 'end');
+        const stats = JSON.parse(output.trim().split('\n').pop()!);
+        expect(stats.BrowserWindow.count).to.equal(1);
+        expect(stats.WebContents.count).to.be.at.least(1);
+        expect(stats.NativeImage.count).to.be.at.least(1);
+        expect(Object.keys(stats.BrowserWindow.allocationSites)[0]).to.match(/main\.js:\d+:\d+$/);
+      });
+    });
+
     describe('process.getBlinkMemoryInfo()', () => {
       it('returns blink memory information object', () => {
         const heapStats = process.getBlinkMemoryInfo();
@@ -136,6 +190,18 @@ describe('process module', () => {
       });
     });
 
+    describe('process.getAllocatorStats()', () => {
+      it('returns allocator statistics', () => {
+        const stats = process.getAllocatorStats();
+        expect(stats.mallocUsage).to.be.a('number');
+        expect(stats.committed).to.be.at.least(stats.allocated);
+        expect(stats.fragmentation).to.be.within(0, 1);
+        for (const partition of Object.values(stats.partitions)) {
+          expect(partition.allocated).to.be.at.most(partition.committed);
+        }
+      });
+    });
+
     describe('process.getProcessMemoryInfo()', () => {
       it('resolves promise successfully with valid data', async () => {
         const memoryInfo = await process.getProcessMemoryInfo();
@@ -203,5 +269,41 @@ describe('process module', () => {
         expect(success).to.be.false();
       });
     });
+
+    describe('process.startSamplingHeapProfiler()', () => {
+      afterEach(() => {
+        process.stopSamplingHeapProfiler();
+      });
+
+      it('can only be started once', () => {
+        expect(process.startSamplingHeapProfiler()).to.be.true();
+        expect(process.startSamplingHeapProfiler()).to.be.false();
+      });
+
+      it('throws on an invalid sampling interval', () => {
+        expect(() => {
+          process.startSamplingHeapProfiler({ samplingInterval: 0 });
+        }).to.throw(/samplingInterval must be a positive integer/);
+      });
+
+      it('returns nodes with the DevTools protocol fields', () => {
+        process.startSamplingHeapProfiler({ samplingInterval: 128 });
+        const retained = Array.from({ length: 10000 }, (_, i) => ({ i }));
+        const profile = process.getSamplingHeapProfile()!;
+        expect(retained).to.have.lengthOf(10000);
+        const nodeIds = new Set<number>();
+        const nodes: any[] = [profile.head];
+        while (nodes.length) {
+          const node = nodes.pop()!;
+          expect(node.callFrame).to.have.all.keys('functionName', 'scriptId', 'url', 'lineNumber', 'columnNumber');
+          expect(node.selfSize).to.be.a('number');
+          nodeIds.add(node.id);
+          nodes.push(...node.children);
+        }
+        for (const sample of profile.samples) {
+          expect(nodeIds.has(sample.nodeId)).to.be.true();
+        }
+      });
+    });
   });
 });
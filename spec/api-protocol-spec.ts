@@ -1,6 +1,6 @@
 import { expect } from 'chai';
 import { v4 } from 'uuid';
-import { protocol, webContents, WebContents, session, BrowserWindow, ipcMain, net } from 'electron/main';
+import { protocol, webContents, WebContents, session, BrowserWindow, ipcMain, net, utilityProcess } from 'electron/main';
 import * as ChildProcess from 'node:child_process';
 import * as path from 'node:path';
 import * as url from 'node:url';
@@ -403,6 +403,14 @@ describe('protocol module', () => {
         expect(r.headers).to.have.property('x-electron', 'a, b');
       });
 
+      it('sends large responses made of small chunks', async () => {
+        const data = Buffer.alloc(4 * 1024 * 1024);
+        for (let i = 0; i < data.length; i++) data[i] = 'a'.charCodeAt(0) + (i % 26);
+        registerStreamProtocol(protocolName, (request, callback) => callback(getStream(1000, data)));
+        const r = await ajax(protocolName + '://fake-host');
+        expect(r.data).to.equal(data.toString());
+      });
+
       it('sends custom status code', async () => {
         registerStreamProtocol(protocolName, (request, callback) => callback({
           statusCode: 204,
@@ -1117,6 +1125,58 @@ describe('protocol module', () => {
       ChildProcess.spawnSync(process.execPath, [appPath, 'true', codeCachePath]);
       expect(fs.readdirSync(path.join(codeCachePath, 'js')).length).to.above(2);
     });
+
+    it('codeCache:true enables codeCache for file: URLs', async () => {
+      ChildProcess.spawnSync(process.execPath, [appPath, 'file', codeCachePath]);
+      expect(fs.readdirSync(path.join(codeCachePath, 'js')).length).to.above(2);
+    });
+  });
+
+  describe('handleDirectory', () => {
+    const directory = path.join(fixturesPath, 'pages');
+
+    afterEach(() => {
+      try { protocol.unhandle('test-directory'); } catch { /* ignore */ }
+    });
+
+    it('serves files of the directory', async () => {
+      protocol.handleDirectory('test-directory', directory);
+      const resp = await net.fetch('test-directory://app/a.html');
+      expect(resp.status).to.equal(200);
+      expect(resp.headers.get('content-type')).to.equal('text/html');
+      expect(await resp.text()).to.equal(fs.readFileSync(path.join(directory, 'a.html'), 'utf8'));
+    });
+
+    it('serves files inside asar archives', async () => {
+      protocol.handleDirectory('test-directory', path.join(fixturesPath, 'test.asar', 'a.asar'));
+      const resp = await net.fetch('test-directory://app/file1');
+      expect(await resp.text()).to.equal('file1\n');
+    });
+
+    it('does not serve files outside of the directory', async () => {
+      protocol.handleDirectory('test-directory', directory);
+      await expect(net.fetch('test-directory://app/%2e%2e/api-protocol-spec.ts')).to.eventually.be.rejectedWith(/ERR_FILE_NOT_FOUND/);
+    });
+
+    it('answers conditional and range requests', async () => {
+      protocol.handleDirectory('test-directory', directory);
+      const resp = await net.fetch('test-directory://app/a.html');
+      const etag = resp.headers.get('etag')!;
+      expect(etag).to.be.a('string');
+
+      const notModified = await net.fetch('test-directory://app/a.html', { headers: { 'If-None-Match': etag } });
+      expect(notModified.status).to.equal(304);
+
+      const partial = await net.fetch('test-directory://app/a.html', { headers: { Range: 'bytes=0-4' } });
+      expect(partial.status).to.equal(206);
+      expect(partial.headers.get('content-range')).to.match(/^bytes 0-4\//);
+      expect(await partial.text()).to.have.lengthOf(5);
+    });
+
+    it('throws when the scheme is already handled', () => {
+      protocol.handleDirectory('test-directory', directory);
+      expect(() => protocol.handleDirectory('test-directory', directory)).to.throw(/Failed to register protocol/);
+    });
   });
 
   describe('handle', () => {
@@ -1144,6 +1204,17 @@ describe('protocol module', () => {
       await expect(net.fetch('test-scheme://foo')).to.eventually.be.rejectedWith(/ERR_UNKNOWN_URL_SCHEME/);
     });
 
+    it('can be handled by a utility process pool', async () => {
+      const pool = utilityProcess.createPool(path.join(fixturesPath, 'api', 'protocol-pool-worker.js'), { size: 1 });
+      defer(() => pool.close());
+      protocol.handleWithPool('test-scheme', pool);
+      defer(() => { protocol.unhandle('test-scheme'); });
+      const resp = await net.fetch('test-scheme://foo/bar', { method: 'POST', body: 'data' });
+      expect(resp.status).to.equal(201);
+      expect(resp.headers.get('x-method')).to.equal('POST');
+      expect(await resp.text()).to.equal('test-scheme://foo/bar data');
+    });
+
     it('receives requests to the existing https scheme', async () => {
       protocol.handle('https', (req) => new Response('hello ' + req.url));
       defer(() => { protocol.unhandle('https'); });
@@ -91,6 +91,47 @@ describe('safeStorage module', () => {
     });
   });
 
+  describe('SafeStorage.encryptStringAsync()', () => {
+    it('encrypts strings that decryptString() can decrypt', async () => {
+      const encrypted = await safeStorage.encryptStringAsync('plaintext');
+      expect(Buffer.isBuffer(encrypted)).to.equal(true);
+      expect(safeStorage.decryptString(encrypted)).to.equal('plaintext');
+    });
+  });
+
+  describe('SafeStorage.decryptStringAsync()', () => {
+    it('decrypts strings encrypted by encryptString()', async () => {
+      const plaintext = '€ - utf symbol';
+      const encrypted = safeStorage.encryptString(plaintext);
+      expect(await safeStorage.decryptStringAsync(encrypted)).to.equal(plaintext);
+    });
+
+    it('rejects unencrypted input', async () => {
+      const plaintextBuffer = Buffer.from('I am unencoded!', 'utf-8');
+      await expect(safeStorage.decryptStringAsync(plaintextBuffer)).to.eventually.be.rejected();
+    });
+  });
+
+  describe('SafeStorage.encryptStringsAsync() and decryptStringsAsync()', () => {
+    it('round-trip a batch of strings in order', async () => {
+      const plaintexts = Array.from({ length: 100 }, (_, i) => `secret ${i}`);
+      const encrypted = await safeStorage.encryptStringsAsync(plaintexts);
+      expect(encrypted).to.have.lengthOf(plaintexts.length);
+      expect(await safeStorage.decryptStringsAsync(encrypted)).to.deep.equal(plaintexts);
+    });
+
+    it('handle empty batches', async () => {
+      expect(await safeStorage.encryptStringsAsync([])).to.deep.equal([]);
+      expect(await safeStorage.decryptStringsAsync([])).to.deep.equal([]);
+    });
+
+    it('reject a batch with unencrypted input', async () => {
+      const encrypted = safeStorage.encryptString('plaintext');
+      const plaintextBuffer = Buffer.from('I am unencoded!', 'utf-8');
+      await expect(safeStorage.decryptStringsAsync([encrypted, plaintextBuffer])).to.eventually.be.rejected();
+    });
+  });
+
   describe('safeStorage persists encryption key across app relaunch', () => {
     it('can decrypt after closing and reopening app', async () => {
       const fixturesPath = path.resolve(__dirname, 'fixtures');
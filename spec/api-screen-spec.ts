@@ -123,4 +123,35 @@ describe('screen module', () => {
       expect(workArea).to.have.property('height').that.is.greaterThan(0);
     });
   });
+
+  describe('display caching', () => {
+    it('returns new objects on every call', () => {
+      const displays = screen.getAllDisplays();
+      expect(screen.getAllDisplays()).to.not.equal(displays);
+      expect(screen.getAllDisplays()).to.deep.equal(displays);
+
+      const primary = screen.getPrimaryDisplay();
+      expect(Object.isFrozen(primary)).to.be.false();
+      primary.bounds.x += 1;
+      expect(screen.getPrimaryDisplay().bounds.x).to.equal(primary.bounds.x - 1);
+    });
+  });
+
+  describe('screen.getDisplayNearestPoints()', () => {
+    it('maps each point to the index of its display', () => {
+      const displays = screen.getAllDisplays();
+      const primary = screen.getPrimaryDisplay();
+      const { x, y } = primary.bounds;
+      const indices = screen.getDisplayNearestPoints(new Float64Array([x, y, x + 1, y + 1]));
+      expect(indices).to.be.an.instanceOf(Int32Array);
+      expect(indices).to.have.lengthOf(2);
+      expect(displays[indices[0]].id).to.equal(primary.id);
+      expect(displays[indices[1]].id).to.equal(primary.id);
+    });
+
+    it('throws for invalid input', () => {
+      expect(() => screen.getDisplayNearestPoints([0, 0] as any)).to.throw(/Float64Array/);
+      expect(() => screen.getDisplayNearestPoints(new Float64Array(3))).to.throw(/Float64Array/);
+    });
+  });
 });
@@ -70,6 +70,42 @@ describe('session.serviceWorkers', () => {
     });
   });
 
+  describe('startWorkerForScope()', () => {
+    it('starts the worker registered for a scope', async () => {
+      w.loadURL(`${baseUrl}/index.html`);
+      const [, details] = await once(ses.serviceWorkers, 'console-message');
+      const versionId = await ses.serviceWorkers.startWorkerForScope(`${baseUrl}/`);
+      expect(versionId).to.equal(details.versionId);
+    });
+
+    it('rejects for a scope without a registration', async () => {
+      await expect(ses.serviceWorkers.startWorkerForScope(`${baseUrl}/unregistered/`)).to.eventually.be.rejectedWith(/Failed to start service worker/);
+    });
+  });
+
+  describe('startKeepAlive()', () => {
+    it('can keep a running worker alive', async () => {
+      w.loadURL(`${baseUrl}/index.html`);
+      const [, details] = await once(ses.serviceWorkers, 'console-message');
+      expect(ses.serviceWorkers.startKeepAlive(details.versionId)).to.equal(true);
+      ses.serviceWorkers.stopKeepAlive(details.versionId);
+    });
+
+    it('fails for a worker that is not running', () => {
+      expect(ses.serviceWorkers.startKeepAlive(-1)).to.equal(false);
+    });
+  });
+
+  describe('worker-started event', () => {
+    it('reports the startup time of a worker', async () => {
+      const started = once(ses.serviceWorkers, 'worker-started');
+      w.loadURL(`${baseUrl}/index.html`);
+      const [, details] = await started;
+      expect(details).to.have.property('scope', baseUrl + '/');
+      expect(details.startupTime).to.be.a('number').that.is.at.least(0);
+    });
+  });
+
   describe('console-message event', () => {
     it('should correctly keep the source, message and level', async () => {
       const messages: Record<string, Electron.MessageDetails> = {};
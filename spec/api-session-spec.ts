@@ -4,7 +4,7 @@ import * as https from 'node:https';
 import * as path from 'node:path';
 import * as fs from 'node:fs';
 import * as ChildProcess from 'node:child_process';
-import { app, session, BrowserWindow, net, ipcMain, Session, webFrameMain, WebFrameMain } from 'electron/main';
+import { app, session, BrowserWindow, net, ipcMain, Session, webContents, webFrameMain, WebFrameMain } from 'electron/main';
 import * as send from 'send';
 import * as auth from 'basic-auth';
 import { closeAllWindows } from './lib/window-helpers';
@@ -26,6 +26,25 @@ describe('session module', () => {
     it('returns existing session with same partition', () => {
       expect(session.fromPartition('test')).to.equal(session.fromPartition('test'));
     });
+
+    it('can keep the HTTP cache of a persistent session in memory', async () => {
+      let requests = 0;
+      const server = http.createServer((req, res) => {
+        requests++;
+        res.setHeader('Cache-Control', 'max-age=3600');
+        res.end('cached');
+      });
+      const { url } = await listen(server);
+      defer(() => server.close());
+      const ses = session.fromPartition(`persist:memory-cache-${Math.random()}`, {
+        cacheBackend: 'memory',
+        maxCacheSize: 1024 * 1024
+      });
+      expect(await (await ses.fetch(url)).text()).to.equal('cached');
+      expect(await (await ses.fetch(url)).text()).to.equal('cached');
+      expect(requests).to.equal(1);
+      expect(fs.existsSync(path.join(ses.storagePath!, 'Cache'))).to.be.false();
+    });
   });
 
   describe('session.fromPath(path)', () => {
@@ -210,6 +229,83 @@ describe('session module', () => {
       expect(removeEventRemoved).to.equal(true);
     });
 
+    describe('ses.cookies.setMany()', () => {
+      it('sets many cookies at once', async () => {
+        const customSession = session.fromPartition('cookies-set-many');
+        const { cookies } = customSession;
+        const results = await cookies.setMany([
+          { url, name: 'one', value: '1' },
+          { url, name: 'two', value: '2' },
+          { name: 'missing-url' } as any,
+          { url: 'asdf', name: 'invalid-url' }
+        ]);
+        expect(results).to.deep.equal([
+          null,
+          null,
+          "Missing required option 'url'",
+          'Failed to set cookie with an invalid domain attribute'
+        ]);
+        const list = await cookies.get({ url });
+        expect(list.map(c => c.name).sort()).to.deep.equal(['one', 'two']);
+        await customSession.clearStorageData({ storages: ['cookies'] });
+      });
+    });
+
+    describe('ses.cookies.getAllInBatches()', () => {
+      it('passes all cookies in batches', async () => {
+        const customSession = session.fromPartition('cookies-get-all-in-batches');
+        const { cookies } = customSession;
+        const names = Array.from({ length: 5 }, (_, i) => `cookie${i}`);
+        await cookies.setMany(names.map(name => ({ url, name, value: 'bar' })));
+        const batches: Electron.Cookie[][] = [];
+        await cookies.getAllInBatches((batch) => { batches.push(batch); }, { batchSize: 2 });
+        expect(batches.map(batch => batch.length)).to.deep.equal([2, 2, 1]);
+        expect(batches.flat().map(c => c.name).sort()).to.deep.equal(names);
+        await customSession.clearStorageData({ storages: ['cookies'] });
+      });
+
+      it('rejects an invalid batch size', async () => {
+        await expect(session.defaultSession.cookies.getAllInBatches(() => {}, { batchSize: 0 }))
+          .to.eventually.be.rejectedWith("'batchSize' must be a positive integer");
+      });
+    });
+
+    describe('ses.cookies.setChangeFilter()', () => {
+      afterEach(() => {
+        session.defaultSession.cookies.setChangeFilter(null);
+      });
+
+      it('only emits changes matching the filter', async () => {
+        const { cookies } = session.defaultSession;
+        cookies.setChangeFilter({ name: 'wanted' });
+        const changed = once(cookies, 'changed');
+        await cookies.set({ url, name: 'ignored', value: 'bar' });
+        await cookies.set({ url, name: 'wanted', value: 'bar' });
+        const [, cookie] = await changed;
+        expect(cookie.name).to.equal('wanted');
+        await cookies.remove(url, 'ignored');
+        await cookies.remove(url, 'wanted');
+      });
+
+      it('emits batched changes', async () => {
+        const { cookies } = session.defaultSession;
+        cookies.setChangeFilter({ domain: '127.0.0.1', batchInterval: 100 });
+        const batch = once(cookies, 'changed-batch');
+        await cookies.set({ url, name: 'foo', value: 'bar' });
+        await cookies.remove(url, 'foo');
+        const [, changes] = await batch;
+        expect(changes.map((change: any) => change.removed)).to.deep.equal([false, true]);
+        expect(changes[0].cookie.name).to.equal('foo');
+        expect(changes[0].cause).to.equal('explicit');
+      });
+
+      it('throws for an invalid filter', () => {
+        expect(() => {
+          session.defaultSession.cookies.setChangeFilter({ batchInterval: -1 });
+        }).to.throw("'batchInterval' must be a non-negative number");
+      });
+    });
+
     describe('ses.cookies.flushStore()', async () => {
       it('flushes the cookies to disk', async () => {
         const name = 'foo';
@@ -264,6 +360,34 @@ describe('session module', () => {
     });
   });
 
+  describe('ses.getStorageUsage()', () => {
+    afterEach(closeAllWindows);
+    it('reports the storage used by each origin', async () => {
+      const server = http.createServer((req, res) => { res.end('<body></body>'); });
+      const { url } = await listen(server);
+      defer(() => server.close());
+      const ses = session.fromPartition(`storage-usage-${Math.random()}`);
+      const w = new BrowserWindow({ show: false, webPreferences: { session: ses } });
+      await w.loadURL(url);
+      await w.webContents.executeJavaScript(`new Promise((resolve, reject) => {
+        const request = indexedDB.open('test');
+        request.onupgradeneeded = () => request.result.createObjectStore('store');
+        request.onsuccess = () => {
+          const tx = request.result.transaction('store', 'readwrite');
+          tx.objectStore('store').put('x'.repeat(64 * 1024), 'key');
+          tx.oncomplete = resolve;
+          tx.onerror = reject;
+        };
+        request.onerror = reject;
+      })`);
+      const usages = await ses.getStorageUsage();
+      const usage = usages.find(usage => usage.origin === new URL(url).origin);
+      expect(usage).to.not.be.undefined();
+      expect(usage!.indexedDB).to.be.greaterThan(0);
+      expect(usage!.usage).to.be.at.least(usage!.indexedDB);
+    });
+  });
+
   describe('will-download event', () => {
     afterEach(closeAllWindows);
     it('can cancel default download behavior', async () => {
@@ -370,6 +494,21 @@ describe('session module', () => {
       expect(proxy).to.equal('PROXY myproxy:80');
     });
 
+    it('resolves concurrent lookups for different URLs', async () => {
+      const config = {
+        proxyRules: 'http=myproxy:80',
+        proxyBypassRules: '<local>'
+      };
+      await customSession.setProxy(config);
+      const proxies = await Promise.all([
+        customSession.resolveProxy('http://example.com/'),
+        customSession.resolveProxy('http://example/'),
+        customSession.resolveProxy('http://example.com/'),
+        customSession.resolveProxy('http://example.com/other')
+      ]);
+      expect(proxies).to.deep.equal(['PROXY myproxy:80', 'DIRECT', 'PROXY myproxy:80', 'PROXY myproxy:80']);
+    });
+
     it('allows removing the implicit bypass rules for localhost', async () => {
       const config = {
         proxyRules: 'http=myproxy:80',
@@ -530,6 +669,29 @@ describe('session module', () => {
     });
   });
 
+  describe('ses.prefetchHosts(hosts)', () => {
+    it('resolves a batch of hosts', async () => {
+      const customSession = session.fromPartition('prefetchhosts');
+      const { cacheHits, resolved, failed } = await customSession.prefetchHosts([
+        'ipv4.localhost2', 'ipv6.localhost2', 'notfound.localhost2'
+      ]);
+      expect(cacheHits + resolved).to.equal(2);
+      expect(failed).to.equal(1);
+    });
+
+    it('serves repeated hosts from the host cache', async () => {
+      const customSession = session.fromPartition('prefetchhosts');
+      await customSession.prefetchHosts(['ipv4.localhost2']);
+      const { cacheHits } = await customSession.prefetchHosts(['ipv4.localhost2']);
+      expect(cacheHits).to.equal(1);
+    });
+
+    it('resolves immediately for an empty list', async () => {
+      const result = await session.defaultSession.prefetchHosts([]);
+      expect(result).to.deep.equal({ cacheHits: 0, resolved: 0, failed: 0 });
+    });
+  });
+
   describe('ses.getBlobData()', () => {
     const scheme = 'cors-blob';
     const protocol = session.defaultSession.protocol;
@@ -621,6 +783,55 @@ describe('session module', () => {
     });
   });
 
+  describe('ses.getBlobStream()', () => {
+    const scheme = 'cors-blob-stream';
+    const protocol = session.defaultSession.protocol;
+    const url = `${scheme}://host`;
+    after(async () => {
+      await protocol.unregisterProtocol(scheme);
+    });
+    afterEach(closeAllWindows);
+
+    it('streams blob data for uuid in chunks', (done) => {
+      // Larger than one read so that the data arrives in several chunks.
+      const size = 3 * 1024 * 1024 + 1;
+      const content = `<html>
+                       <script>
+                       let fd = new FormData();
+                       fd.append("data", new Blob([new Uint8Array(${size}).fill(97)]));
+                       fetch('${url}', {method:'POST', body: fd });
+                       </script>
+                       </html>`;
+
+      protocol.registerStringProtocol(scheme, async (request, callback) => {
+        try {
+          if (request.method === 'GET') {
+            callback({ data: content, mimeType: 'text/html' });
+          } else if (request.method === 'POST') {
+            const uuid = request.uploadData![1].blobUUID;
+            const chunks: Uint8Array[] = [];
+            for await (const chunk of session.defaultSession.getBlobStream(uuid!) as any) {
+              chunks.push(chunk);
+            }
+            const data = Buffer.concat(chunks);
+            expect(chunks.length).to.be.greaterThan(1);
+            expect(data.length).to.equal(size);
+            expect(data.every(byte => byte === 97)).to.be.true();
+            done();
+          }
+        } catch (e) {
+          done(e);
+        }
+      });
+      const w = new BrowserWindow({ show: false });
+      w.loadURL(url);
+    });
+
+    it('throws for an unknown uuid', () => {
+      expect(() => session.defaultSession.getBlobStream('not-a-uuid')).to.throw('Could not get blob data handle');
+    });
+  });
+
   describe('ses.setCertificateVerifyProc(callback)', () => {
     let server: http.Server;
     let serverUrl: string;
@@ -711,6 +922,38 @@ describe('session module', () => {
       expect(numVerificationRequests).to.equal(1);
     });
 
+    const countProcCalls = async (options?: { cacheTTL?: number }) => {
+      const ses = session.fromPartition(`${Math.random()}`);
+      let numVerificationRequests = 0;
+      ses.setCertificateVerifyProc((e, callback) => {
+        if (e.hostname !== '127.0.0.1') return callback(-3);
+        numVerificationRequests++;
+        callback(0);
+      }, options);
+
+      const w = new BrowserWindow({ show: false, webPreferences: { session: ses } });
+      await w.loadURL(serverUrl);
+      await ses.closeAllConnections();
+      await w.loadURL(serverUrl + '/test');
+      expect(w.webContents.getTitle()).to.equal('hello');
+      return numVerificationRequests;
+    };
+
+    it('calls the proc for every new connection without caching', async () => {
+      expect(await countProcCalls()).to.equal(2);
+    });
+
+    it('reuses results when caching is enabled', async () => {
+      expect(await countProcCalls({ cacheTTL: 60000 })).to.equal(1);
+    });
+
+    it('throws for a negative cacheTTL', () => {
+      const ses = session.fromPartition(`${Math.random()}`);
+      expect(() => {
+        ses.setCertificateVerifyProc((e, callback) => callback(-3), { cacheTTL: -1 });
+      }).to.throw(/cacheTTL/);
+    });
+
     it('does not cancel requests in other sessions', async () => {
       const ses1 = session.fromPartition(`${Math.random()}`);
       ses1.setCertificateVerifyProc((opts, cb) => cb(0));
@@ -843,6 +1086,43 @@ describe('session module', () => {
         session.defaultSession.downloadURL(`${url}:${port}`);
       });
 
+      it('reports no slices for a download fetched with a single request', async () => {
+        const willDownload = once(session.defaultSession, 'will-download');
+        session.defaultSession.downloadURL(`${url}:${port}`);
+        const [, item] = await willDownload as [Electron.Event, Electron.DownloadItem];
+        item.savePath = downloadFilePath;
+        const [, state] = await once(item, 'done');
+        try {
+          expect(state).to.equal('completed');
+          expect(item.getReceivedSlices()).to.deep.equal([]);
+        } finally {
+          fs.unlinkSync(downloadFilePath);
+        }
+      });
+
+      it('can throttle progress updates', async () => {
+        const willDownload = once(session.defaultSession, 'will-download');
+        session.defaultSession.downloadURL(`${url}:${port}`);
+        const [, item] = await willDownload as [Electron.Event, Electron.DownloadItem];
+        expect(item.getUpdateInterval()).to.equal(0);
+        expect(() => item.setUpdateInterval(-1)).to.throw(/non-negative/);
+        item.setUpdateInterval(60000);
+        expect(item.getUpdateInterval()).to.equal(60000);
+        item.savePath = downloadFilePath;
+        let updates = 0;
+        item.on('updated', () => { updates++; });
+        const [, state] = await once(item, 'done');
+        try {
+          expect(state).to.equal('completed');
+          expect(updates).to.be.at.most(1);
+          expect(item.getPercentComplete()).to.equal(100);
+          expect(item.getCurrentBytesPerSecond()).to.be.a('number');
+          expect(item.getTimeRemaining()).to.be.a('number');
+        } finally {
+          fs.unlinkSync(downloadFilePath);
+        }
+      });
+
       it('can perform a download with a valid auth header', async () => {
         const server = http.createServer((req, res) => {
           const { authorization } = req.headers;
@@ -1341,6 +1621,23 @@ describe('session module', () => {
       expect(name).to.deep.equal('SecurityError');
     });
 
+    it('throws when the callback is called more than once', async () => {
+      const ses = session.fromPartition('' + Math.random());
+      const secondCall = new Promise<() => void>(resolve => {
+        ses.setPermissionRequestHandler(
+          (_webContents, _permission, callback) => {
+            callback(true);
+            resolve(() => callback(true));
+          }
+        );
+      });
+
+      const w = new BrowserWindow({ show: false, webPreferences: { session: ses } });
+      await w.loadURL(serverUrl);
+      w.webContents.executeJavaScript('navigator.mediaDevices.getUserMedia({ audio: true }).catch(() => {})');
+      expect(await secondCall).to.throw(/One-time callback was called more than once/);
+    });
+
     it('successfully resolves when calling legacy getUserMedia', async () => {
       const ses = session.fromPartition('' + Math.random());
       ses.setPermissionRequestHandler(
@@ -1462,6 +1759,41 @@ describe('session module', () => {
       expect(handlerDetails!.isMainFrame).to.be.false();
       expect(handlerDetails!.embeddingOrigin).to.equal('file:///');
     });
+
+    it('reuses decisions for the cacheDuration', async () => {
+      const w = new BrowserWindow({
+        show: false,
+        webPreferences: {
+          partition: 'very-temp-permission-handler'
+        }
+      });
+      const ses = w.webContents.session;
+      ses.protocol.interceptStringProtocol('https', (req, cb) => {
+        cb('<html></html>');
+      });
+      defer(() => ses.setPermissionCheckHandler(null));
+
+      let calls = 0;
+      const handler = (wc: Electron.WebContents | null, permission: string) => {
+        if (permission === 'clipboard-read') calls++;
+        return true;
+      };
+      const readClipboardPermission = () => w.webContents.executeJavaScript(`
+        navigator.permissions.query({name: 'clipboard-read'}).then(permission => permission.state);
+      `, true);
+
+      ses.setPermissionCheckHandler(handler, { cacheDuration: 60000 });
+      await w.loadURL('https://myfakesite/');
+      expect(await readClipboardPermission()).to.equal('granted');
+      const callsAfterFirstCheck = calls;
+      expect(callsAfterFirstCheck).to.be.greaterThan(0);
+      expect(await readClipboardPermission()).to.equal('granted');
+      expect(calls).to.equal(callsAfterFirstCheck);
+
+      ses.setPermissionCheckHandler(handler);
+      await readClipboardPermission();
+      expect(calls).to.be.greaterThan(callsAfterFirstCheck);
+    });
   });
 
   describe('ses.isPersistent()', () => {
@@ -1557,6 +1889,135 @@ describe('session module', () => {
     });
   });
 
+  describe('ses.setPreloadCodeCacheEnabled()', () => {
+    let ses: Session;
+    let codeCachePath: string;
+    let preloadCachePath: string;
+    let servers: http.Server[];
+
+    beforeEach(() => {
+      ses = session.fromPartition(`persist:preload-code-cache-${Math.random()}`);
+      codeCachePath = path.join(app.getPath('userData'), `electron-test-preload-code-cache-${Math.random()}`);
+      preloadCachePath = path.join(codeCachePath, 'Preload');
+      ses.setCodeCachePath(codeCachePath);
+      ses.setPreloadCodeCacheEnabled(true);
+      servers = [];
+    });
+
+    afterEach(async () => {
+      await closeAllWindows();
+      for (const server of servers) server.close();
+      fs.rmSync(codeCachePath, { recursive: true, force: true });
+    });
+
+    // Each server is a separate origin.
+    const createOrigin = async () => {
+      const server = http.createServer((req, res) => res.end('<title>hello</title>'));
+      servers.push(server);
+      return (await listen(server)).url;
+    };
+
+    const loadWindow = async (url: string) => {
+      const w = new BrowserWindow({
+        show: false,
+        webPreferences: {
+          session: ses,
+          sandbox: true,
+          preload: path.join(fixtures, 'module', 'get-global-preload.js')
+        }
+      });
+      const ranPreload = once(ipcMain, 'vars');
+      await w.loadURL(url);
+      await ranPreload;
+    };
+
+    const getCacheFiles = () => fs.existsSync(preloadCachePath)
+      ? fs.readdirSync(preloadCachePath).filter(f => !f.endsWith('.tmp'))
+      : [];
+
+    const waitForCacheFiles = async (count: number) => {
+      while (getCacheFiles().length < count) {
+        await setTimeout(50);
+      }
+      return getCacheFiles();
+    };
+
+    it('stores a code cache for sandboxed preload scripts and reuses it', async () => {
+      const url = await createOrigin();
+
+      // The first load produces the cache.
+      await loadWindow(url);
+      const cacheFiles = await waitForCacheFiles(1);
+      expect(cacheFiles).to.have.lengthOf(1);
+      const cacheFile = path.join(preloadCachePath, cacheFiles[0]);
+      const cacheStat = fs.statSync(cacheFile);
+      expect(cacheStat.size).to.be.greaterThan(0);
+
+      // The second load consumes it. A cache that was missing or rejected
+      // would be created again and replace the file.
+      await loadWindow(url);
+      await setTimeout(500);
+      expect(getCacheFiles()).to.deep.equal(cacheFiles);
+      const newCacheStat = fs.statSync(cacheFile);
+      expect(newCacheStat.ino).to.equal(cacheStat.ino);
+      expect(newCacheStat.mtimeMs).to.equal(cacheStat.mtimeMs);
+    });
+
+    it('does not share a code cache between origins', async () => {
+      await loadWindow(await createOrigin());
+      const [firstCacheFile] = await waitForCacheFiles(1);
+
+      await loadWindow(await createOrigin());
+      const cacheFiles = await waitForCacheFiles(2);
+      expect(cacheFiles).to.have.lengthOf(2);
+      expect(cacheFiles).to.include(firstCacheFile);
+    });
+
+    it('does not store a code cache for opaque origins', async () => {
+      await loadWindow('data:text/html,<title>hello</title>');
+      await setTimeout(500);
+      expect(getCacheFiles()).to.be.empty();
+    });
+  });
+
+  describe('ses.setSpareRendererEnabled()', () => {
+    afterEach(closeAllWindows);
+
+    const findSpareRendererPid = async () => {
+      const usedPids = new Set(webContents.getAllWebContents().map(wc => wc.getOSProcessId()));
+      while (true) {
+        const spare = app.getAppMetrics().find(metric => metric.type === 'Tab' && !usedPids.has(metric.pid));
+        if (spare) return spare.pid;
+        await setTimeout(50);
+      }
+    };
+
+    it('lets sandboxed windows adopt the spare renderer', async () => {
+      const ses = session.fromPartition(`spare-renderer-${Math.random()}`);
+      ses.setSpareRendererEnabled(true);
+      defer(() => ses.setSpareRendererEnabled(false));
+      const sparePid = await findSpareRendererPid();
+
+      const w = new BrowserWindow({ show: false, webPreferences: { session: ses, sandbox: true } });
+      await w.loadFile(path.join(fixtures, 'pages', 'blank.html'));
+      expect(w.webContents.getOSProcessId()).to.equal(sparePid);
+    });
+
+    it('does not let windows with additional arguments adopt the spare renderer', async () => {
+      const ses = session.fromPartition(`spare-renderer-${Math.random()}`);
+      ses.setSpareRendererEnabled(true);
+      defer(() => ses.setSpareRendererEnabled(false));
+      const sparePid = await findSpareRendererPid();
+
+      const w = new BrowserWindow({
+        show: false,
+        webPreferences: { session: ses, sandbox: true, additionalArguments: ['--spare-renderer-test'] }
+      });
+      await w.loadFile(path.join(fixtures, 'pages', 'blank.html'));
+      expect(w.webContents.getOSProcessId()).to.not.equal(sparePid);
+    });
+  });
+
   describe('ses.setSSLConfig()', () => {
     it('can disable cipher suites', async () => {
       const ses = session.fromPartition('' + Math.random());
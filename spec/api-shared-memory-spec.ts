@@ -0,0 +1,97 @@
+import { expect } from 'chai';
+import * as path from 'node:path';
+import { BrowserWindow, MessageChannelMain, ipcMain, sharedMemory, utilityProcess } from 'electron/main';
+import { once } from 'node:events';
+import { closeAllWindows } from './lib/window-helpers';
+
+const fixturesPath = path.resolve(__dirname, 'fixtures', 'api', 'shared-memory');
+
+describe('sharedMemory module', () => {
+  describe('sharedMemory.create()', () => {
+    it('creates zero-filled memory of the given size', () => {
+      const memory = sharedMemory.create(4096);
+      expect(memory.size).to.equal(4096);
+      const bytes = memory.read();
+      expect(bytes).to.be.an.instanceOf(Uint8Array);
+      expect(bytes.byteLength).to.equal(4096);
+      expect(bytes.every(b => b === 0)).to.be.true();
+    });
+
+    it('reads and writes bytes', () => {
+      const memory = sharedMemory.create(16);
+      memory.write(new Uint8Array([1, 2, 3]), 4);
+      expect([...memory.read(3, 5)]).to.deep.equal([0, 1, 2, 3, 0]);
+      expect(() => memory.write(new Uint8Array(4), 13)).to.throw(/must fit/);
+      expect(() => memory.read(10, 7)).to.throw(/must be within/);
+    });
+
+    it('loads and stores 32-bit values', () => {
+      const memory = sharedMemory.create(8);
+      memory.storeUint32(4, 0xffffffff);
+      expect(memory.loadUint32(4)).to.equal(0xffffffff);
+      expect(memory.loadUint32(0)).to.equal(0);
+      expect(() => memory.loadUint32(2)).to.throw(/multiple of 4/);
+      expect(() => memory.storeUint32(8, 1)).to.throw(/multiple of 4/);
+      expect(() => memory.storeUint32(0, -1)).to.throw(/unsigned 32-bit integer/);
+    });
+
+    it('throws for invalid sizes', () => {
+      expect(() => sharedMemory.create(0)).to.throw(/size must be a positive integer/);
+      expect(() => sharedMemory.create(-1)).to.throw(/size must be a positive integer/);
+      expect(() => sharedMemory.create(1.5)).to.throw(/size must be a positive integer/);
+    });
+  });
+
+  describe('sending', () => {
+    afterEach(closeAllWindows);
+
+    it('maps the same memory on the receiving end of a MessagePortMain', async () => {
+      const memory = sharedMemory.create(16);
+      const { port1, port2 } = new MessageChannelMain();
+      port2.postMessage({ memory });
+      port1.start();
+      const [{ data }] = await once(port1, 'message');
+      expect(data.memory).to.not.equal(memory);
+      expect(data.memory.size).to.equal(16);
+      data.memory.write(new Uint8Array([42]), 3);
+      expect(memory.read(3, 1)[0]).to.equal(42);
+    });
+
+    it('shares memory with a utility process', async () => {
+      const memory = sharedMemory.create(8);
+      memory.storeUint32(0, 21);
+      const child = utilityProcess.fork(path.join(fixturesPath, 'child.js'));
+      child.postMessage({ memory });
+      const [{ reply }] = await once(child, 'message');
+      expect(memory.loadUint32(4)).to.equal(42);
+      expect(reply.loadUint32(0)).to.equal(7);
+      const exit = once(child, 'exit');
+      child.kill();
+      await exit;
+    });
+
+    it('shares memory with a renderer', async () => {
+      const w = new BrowserWindow({ show: false, webPreferences: { nodeIntegration: true, contextIsolation: false } });
+      await w.loadURL('about:blank');
+      await w.webContents.executeJavaScript(`(${function () {
+        const { ipcRenderer } = require('electron');
+        ipcRenderer.once('memory', (e, memory) => {
+          memory.write(new Uint8Array([1]));
+          ipcRenderer.postMessage('done', null);
+        });
+      }})()`);
+      const memory = sharedMemory.create(4);
+      w.webContents.postMessage('memory', memory);
+      await once(ipcMain, 'done');
+      expect(memory.read(0, 1)[0]).to.equal(1);
+    });
+
+    it('can not be sent with webContents.send()', async () => {
+      const w = new BrowserWindow({ show: false });
+      await w.loadURL('about:blank');
+      expect(() => {
+        w.webContents.send('memory', sharedMemory.create(4));
+      }).to.throw(/could not be cloned/);
+    });
+  });
+});
@@ -98,6 +98,32 @@ describe('shell module', () => {
     });
   });
 
+  describe('shell.trashItems()', () => {
+    it('moves items to the trash and reports the result of each', async () => {
+      const dir = await fs.mkdtemp(path.resolve(app.getPath('temp'), 'electron-shell-spec-'));
+      const filenames = [0, 1, 2].map(i => path.join(dir, `temp-to-be-deleted-${i}`));
+      for (const filename of filenames) {
+        await fs.writeFile(filename, 'dummy-contents');
+      }
+      const missing = path.join(dir, 'does-not-exist');
+      let lastProgress: [number, number] | undefined;
+      const results = await shell.trashItems([...filenames, missing], (completed, total) => {
+        lastProgress = [completed, total];
+      });
+      expect(results.map(result => result.success)).to.deep.equal([true, true, true, false]);
+      expect(results[3].path).to.equal(missing);
+      expect(results[3].error).to.be.a('string');
+      expect(lastProgress).to.deep.equal([4, 4]);
+      for (const filename of filenames) {
+        expect(fs.existsSync(filename)).to.be.false();
+      }
+    });
+
+    it('resolves with an empty array for no paths', async () => {
+      expect(await shell.trashItems([])).to.deep.equal([]);
+    });
+  });
+
   const shortcutOptions = {
     target: 'C:\\target',
     description: 'description',
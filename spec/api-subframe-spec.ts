@@ -214,6 +214,67 @@ describe('renderer nodeIntegrationInSubFrames', () => {
   });
 });
 
+describe('renderer sharedNodeIntegrationInSubFrames', () => {
+  let server: http.Server;
+  let serverUrl: string;
+
+  before(async () => {
+    server = http.createServer((req, res) => {
+      if (req.url === '/frame') {
+        res.end('<p>frame</p>');
+      } else {
+        res.end('<iframe src="/frame"></iframe><iframe src="/frame"></iframe>');
+      }
+    });
+    serverUrl = (await listen(server)).url;
+  });
+
+  after(() => {
+    server.close();
+    server = null as unknown as http.Server;
+  });
+
+  let w: BrowserWindow;
+
+  afterEach(async () => {
+    await closeWindow(w);
+    w = null as unknown as BrowserWindow;
+  });
+
+  it('gives same-origin sub-frames the environment of the main frame', async () => {
+    w = new BrowserWindow({
+      show: false,
+      webPreferences: {
+        nodeIntegration: true,
+        nodeIntegrationInSubFrames: true,
+        sharedNodeIntegrationInSubFrames: true,
+        contextIsolation: false
+      }
+    });
+    await w.loadURL(serverUrl);
+    const result = await w.webContents.executeJavaScript(`
+      Array.from(frames, frame => frame.require === require && frame.process === process)
+    `);
+    expect(result).to.deep.equal([true, true]);
+  });
+
+  it('creates an environment per sub-frame when disabled', async () => {
+    w = new BrowserWindow({
+      show: false,
+      webPreferences: {
+        nodeIntegration: true,
+        nodeIntegrationInSubFrames: true,
+        contextIsolation: false
+      }
+    });
+    await w.loadURL(serverUrl);
+    const result = await w.webContents.executeJavaScript(`
+      Array.from(frames, frame => typeof frame.require === 'function' && frame.process !== process)
+    `);
+    expect(result).to.deep.equal([true, true]);
+  });
+});
+
 // app.getAppMetrics() does not return sandbox information on Linux.
 ifdescribe(process.platform !== 'linux')('cross-site frame sandboxing', () => {
   let server: http.Server;
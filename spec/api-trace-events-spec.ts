@@ -0,0 +1,69 @@
+import { expect } from 'chai';
+import { app, contentTracing, traceEvents } from 'electron/main';
+import * as fs from 'node:fs';
+import * as path from 'node:path';
+import { ifdescribe } from './lib/spec-helpers';
+
+// FIXME: The tests are skipped on linux arm/arm64, like the contentTracing ones.
+ifdescribe(!(['arm', 'arm64'].includes(process.arch)) || (process.platform !== 'linux'))('traceEvents module', () => {
+  const outputFilePath = path.join(app.getPath('temp'), 'trace-events.json');
+
+  const record = async (categories: string[], fn: () => void) => {
+    await app.whenReady();
+    await contentTracing.startRecording({ included_categories: categories, excluded_categories: ['*'] });
+    fn();
+    await contentTracing.stopRecording(outputFilePath);
+    const { traceEvents: events } = JSON.parse(fs.readFileSync(outputFilePath, 'utf8'));
+    return events as any[];
+  };
+
+  afterEach(() => {
+    if (fs.existsSync(outputFilePath)) {
+      fs.unlinkSync(outputFilePath);
+    }
+  });
+
+  it('is disabled when not tracing', () => {
+    expect(traceEvents.isEnabled('electron-spec')).to.be.false();
+    // Does nothing, but doesn't throw either.
+    traceEvents.begin('electron-spec', 'slice');
+    traceEvents.end('electron-spec');
+  });
+
+  it('records slices with args', async () => {
+    const events = await record(['electron-spec'], () => {
+      expect(traceEvents.isEnabled('electron-spec')).to.be.true();
+      traceEvents.begin('electron-spec', 'outer', { args: { key: 'value', count: 3 } });
+      traceEvents.begin('electron-spec', 'inner');
+      traceEvents.end('electron-spec');
+      traceEvents.end('electron-spec');
+    });
+    const outer = events.filter(e => e.cat === 'electron-spec' && e.name === 'outer');
+    expect(outer).to.not.be.empty();
+    expect(outer[0].args).to.deep.include({ key: 'value', count: 3 });
+    expect(events.some(e => e.cat === 'electron-spec' && e.name === 'inner')).to.be.true();
+  });
+
+  it('records instant events and counters', async () => {
+    const events = await record(['electron-spec'], () => {
+      traceEvents.instant('electron-spec', 'mark', { flowId: 42 });
+      traceEvents.counter('electron-spec', 'queued', 7);
+    });
+    expect(events.some(e => e.name === 'mark')).to.be.true();
+    expect(events.some(e => e.name === 'queued')).to.be.true();
+  });
+
+  it('skips categories that are not enabled', async () => {
+    const events = await record(['electron-spec'], () => {
+      expect(traceEvents.isEnabled('electron-spec-disabled')).to.be.false();
+      traceEvents.instant('electron-spec-disabled', 'mark');
+    });
+    expect(events.some(e => e.cat === 'electron-spec-disabled')).to.be.false();
+  });
+
+  it('throws on an invalid flowId', async () => {
+    await record(['electron-spec'], () => {
+      expect(() => traceEvents.instant('electron-spec', 'mark', { flowId: -1 })).to.throw(/flowId must be a non-negative integer/);
+    });
+  });
+});
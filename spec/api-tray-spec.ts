@@ -160,6 +160,29 @@ describe('tray module', () => {
     });
   });
 
+  describe('tray.setImageFrames(images)', () => {
+    it('throws a descriptive error for a missing file', () => {
+      const badPath = path.resolve('I', 'Do', 'Not', 'Exist');
+      expect(() => {
+        tray.setImageFrames([nativeImage.createEmpty(), badPath]);
+      }).to.throw(/Failed to load image from path (.+)/);
+    });
+
+    it('switches between the registered images', () => {
+      const image = nativeImage.createFromPath(path.join(__dirname, 'fixtures', 'assets', 'logo.png'));
+      tray.setImageFrames([image, image.resize({ width: 8 })]);
+      tray.setImageFrame(1);
+      tray.setImageFrame(0);
+    });
+
+    it('throws for an index out of range', () => {
+      tray.setImageFrames([nativeImage.createEmpty()]);
+      expect(() => {
+        tray.setImageFrame(1);
+      }).to.throw(/index must be less than the number of frames/);
+    });
+  });
+
   ifdescribe(process.platform === 'win32')('tray.displayBalloon(image)', () => {
     it('throws a descriptive error for a missing file', () => {
       const badPath = path.resolve('I', 'Do', 'Not', 'Exist');
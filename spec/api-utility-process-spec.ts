@@ -2,7 +2,7 @@ import { expect } from 'chai';
 import * as childProcess from 'node:child_process';
 import * as path from 'node:path';
 import { BrowserWindow, MessageChannelMain, utilityProcess, app } from 'electron/main';
-import { ifit } from './lib/spec-helpers';
+import { ifdescribe, ifit } from './lib/spec-helpers';
 import { closeWindow } from './lib/window-helpers';
 import { once } from 'node:events';
 import { pathToFileURL } from 'node:url';
@@ -253,6 +253,49 @@ describe('utilityProcess module', () => {
     });
   });
 
+  ifdescribe(process.platform === 'linux')('forkFromZygote option', () => {
+    // A child forked from the zygote has the zygote as its parent, while a
+    // launched one is a direct child of the browser process.
+    it('forks the child from the zygote', async () => {
+      const child = utilityProcess.fork(path.join(fixturesPath, 'ppid.js'), [], {
+        forkFromZygote: true
+      });
+      const [ppid] = await once(child, 'message');
+      expect(ppid).to.be.a('number');
+      expect(ppid).to.not.equal(process.pid);
+      const exit = once(child, 'exit');
+      expect(child.kill()).to.be.true();
+      await exit;
+    });
+
+    it('exchanges messages with a child forked from the zygote', async () => {
+      const result = 'I will be echoed.';
+      const child = utilityProcess.fork(path.join(fixturesPath, 'post-message.js'), [], {
+        forkFromZygote: true
+      });
+      await once(child, 'spawn');
+      expect(child.pid).to.be.a('number');
+      child.postMessage(result);
+      const [data] = await once(child, 'message');
+      expect(data).to.equal(result);
+      const exit = once(child, 'exit');
+      expect(child.kill()).to.be.true();
+      await exit;
+    });
+
+    it('falls back to launching the child when a custom env is passed', async () => {
+      const child = utilityProcess.fork(path.join(fixturesPath, 'ppid.js'), [], {
+        forkFromZygote: true,
+        env: { ...process.env, FOO: 'bar' }
+      });
+      const [ppid] = await once(child, 'message');
+      expect(ppid).to.equal(process.pid);
+      const exit = once(child, 'exit');
+      expect(child.kill()).to.be.true();
+      await exit;
+    });
+  });
+
   describe('postMessage() API', () => {
     it('establishes a default ipc channel with the child process', async () => {
       const result = 'I will be echoed.';
@@ -279,6 +322,22 @@ describe('utilityProcess module', () => {
       expect(child.kill()).to.be.true();
       await exit;
     });
+
+    it('transfers ArrayBuffers in both directions', async () => {
+      const child = utilityProcess.fork(path.join(fixturesPath, 'transfer-array-buffer.js'));
+      await once(child, 'spawn');
+      const buffer = new Uint8Array([1, 2, 3, 4]).buffer;
+      child.postMessage(buffer, [buffer]);
+      expect(buffer.byteLength).to.equal(0);
+      const [data] = await once(child, 'message');
+      expect(data).to.be.an.instanceOf(ArrayBuffer);
+      expect([...new Uint8Array(data)]).to.deep.equal([4, 3, 2, 1]);
+      const [lengthInChild] = await once(child, 'message');
+      expect(lengthInChild).to.equal(0);
+      const exit = once(child, 'exit');
+      expect(child.kill()).to.be.true();
+      await exit;
+    });
   });
 
   describe('behavior', () => {
@@ -467,4 +526,73 @@ describe('utilityProcess module', () => {
       await exit;
     });
   });
+
+  describe('sharedMemory property', () => {
+    it('is null by default', async () => {
+      const child = utilityProcess.fork(path.join(fixturesPath, 'empty.js'));
+      expect(child.sharedMemory).to.be.null();
+      await once(child, 'exit');
+    });
+
+    it('throws when sharedMemorySize is not valid', () => {
+      expect(() => {
+        utilityProcess.fork(path.join(fixturesPath, 'empty.js'), [], { sharedMemorySize: -1 });
+      }).to.throw(/sharedMemorySize must be a positive integer/);
+    });
+
+    it('is shared with the child process', async () => {
+      const child = utilityProcess.fork(path.join(fixturesPath, 'shared-memory.js'), [], { sharedMemorySize: 4096 });
+      const memory = child.sharedMemory!;
+      expect(memory).to.equal(child.sharedMemory);
+      expect(memory.size).to.equal(4096);
+      memory.storeUint32(0, 21);
+      child.postMessage('ring');
+      await once(child, 'message');
+      expect(memory.loadUint32(4)).to.equal(42);
+      const exit = once(child, 'exit');
+      child.kill();
+      await exit;
+    });
+  });
+
+  describe('createPool() API', () => {
+    const workerPath = path.join(fixturesPath, 'pool-worker.js');
+
+    it('throws when size is not valid', () => {
+      expect(() => utilityProcess.createPool(workerPath, { size: 0 })).to.throw(/size must be a positive integer/);
+    });
+
+    it('distributes tasks between the processes of the pool', async () => {
+      const pool = utilityProcess.createPool(workerPath, { size: 2 });
+      try {
+        expect(pool.size).to.equal(2);
+        const results = await Promise.all([1, 2, 3, 4, 5, 6].map(n => pool.run(n)));
+        expect(results.map(r => r.result)).to.deep.equal([2, 4, 6, 8, 10, 12]);
+        expect(new Set(results.map(r => r.pid)).size).to.equal(2);
+        expect(pool.pendingTasks).to.equal(0);
+      } finally {
+        pool.close();
+      }
+    });
+
+    it('replaces a process that exits', async () => {
+      const pool = utilityProcess.createPool(workerPath, { size: 1 });
+      try {
+        const exited = once(pool, 'worker-exit');
+        await expect(pool.run('crash')).to.eventually.be.rejectedWith(/exited with code 1/);
+        const [code] = await exited;
+        expect(code).to.equal(1);
+        const { result } = await pool.run(21);
+        expect(result).to.equal(42);
+      } finally {
+        pool.close();
+      }
+    });
+
+    it('rejects tasks after being closed', async () => {
+      const pool = utilityProcess.createPool(workerPath, { size: 1 });
+      pool.close();
+      await expect(pool.run(1)).to.eventually.be.rejectedWith(/has been closed/);
+    });
+  });
 });
@@ -1,3 +1,4 @@
+import { expect } from 'chai';
 import { closeWindow } from './lib/window-helpers';
 import { BaseWindow, View } from 'electron/main';
 
@@ -12,4 +13,42 @@ describe('View', () => {
     w = new BaseWindow({ show: false });
     w.setContentView(new View());
   });
+
+  describe('view.setChildLayouts()', () => {
+    it('applies bounds and visibility to every child', () => {
+      const parent = new View();
+      const a = new View();
+      const b = new View();
+      parent.addChildView(a);
+      parent.addChildView(b);
+      parent.setChildLayouts([
+        { view: a, bounds: { x: 0, y: 0, width: 10, height: 20 } },
+        { view: b, bounds: { x: 10, y: 0, width: 30, height: 20 }, visible: false }
+      ]);
+      expect(a.getBounds()).to.deep.equal({ x: 0, y: 0, width: 10, height: 20 });
+      expect(b.getBounds()).to.deep.equal({ x: 10, y: 0, width: 30, height: 20 });
+    });
+
+    it('leaves omitted properties unchanged', () => {
+      const parent = new View();
+      const child = new View();
+      parent.addChildView(child);
+      child.setBounds({ x: 1, y: 2, width: 3, height: 4 });
+      parent.setChildLayouts([{ view: child, visible: false }]);
+      expect(child.getBounds()).to.deep.equal({ x: 1, y: 2, width: 3, height: 4 });
+    });
+
+    it('applies nothing when an entry is invalid', () => {
+      const parent = new View();
+      const child = new View();
+      parent.addChildView(child);
+      expect(() => {
+        parent.setChildLayouts([
+          { view: child, bounds: { x: 0, y: 0, width: 50, height: 50 } },
+          { view: new View(), bounds: { x: 0, y: 0, width: 50, height: 50 } }
+        ]);
+      }).to.throw(/'view' must be a child of this View/);
+      expect(child.getBounds()).to.deep.equal({ x: 0, y: 0, width: 0, height: 0 });
+    });
+  });
 });
@@ -791,6 +791,46 @@ describe('webContents module', () => {
       expect(await keyDown).to.equal('b');
     });
 
+    it('receives the events of sendInputEvents in order and on time', async () => {
+      const w = new BrowserWindow({ show: false });
+      await w.loadFile(path.join(fixturesPath, 'pages', 'base-page.html'));
+      const keys: string[] = [];
+      w.webContents.on('before-input-event', (event, input) => {
+        if (input.type === 'keyDown') keys.push(input.key);
+      });
+      const start = Date.now();
+      await w.webContents.sendInputEvents([
+        { type: 'keyDown', keyCode: 'a' },
+        { type: 'keyDown', keyCode: 'b', timestamp: 50 },
+        { type: 'keyDown', keyCode: 'c', timestamp: 100 }
+      ] as any);
+      expect(Date.now() - start).to.be.at.least(95);
+      await waitUntil(() => keys.length === 3);
+      expect(keys).to.deep.equal(['a', 'b', 'c']);
+    });
+
+    it('rejects sendInputEvents with an invalid event', async () => {
+      const w = new BrowserWindow({ show: false });
+      await expect(w.webContents.sendInputEvents([
+        { type: 'keyDown', keyCode: 'a' },
+        { type: 'nonsense' }
+      ] as any)).to.eventually.be.rejectedWith(/Invalid event object at index 1/);
+      await expect(w.webContents.sendInputEvents([
+        { type: 'keyDown', keyCode: 'a', timestamp: 10 },
+        { type: 'keyDown', keyCode: 'b', timestamp: 5 }
+      ] as any)).to.eventually.be.rejectedWith(/must not decrease/);
+    });
+
+    it('rejects sendInputEvents when the WebContents is destroyed first', async () => {
+      const w = new BrowserWindow({ show: false });
+      await w.loadFile(path.join(fixturesPath, 'pages', 'base-page.html'));
+      const sent = w.webContents.sendInputEvents([
+        { type: 'keyDown', keyCode: 'a', timestamp: 1000 }
+      ] as any);
+      w.destroy();
+      await expect(sent).to.eventually.be.rejectedWith(/WebContents was destroyed/);
+    });
+
     it('has the correct properties', async () => {
       const w = new BrowserWindow({ show: false });
       await w.loadFile(path.join(fixturesPath, 'pages', 'base-page.html'));
@@ -1778,6 +1818,36 @@ describe('webContents module', () => {
     }
   });
 
+  describe('event emission', () => {
+    afterEach(closeAllWindows);
+
+    it('emits events to listeners added and removed over time', async () => {
+      const w = new BrowserWindow({ show: false });
+      const seen: string[] = [];
+      const listener = () => seen.push('first');
+      w.webContents.on('did-finish-load', listener);
+      await w.loadURL('about:blank');
+      w.webContents.removeListener('did-finish-load', listener);
+      await w.loadURL('about:blank');
+      w.webContents.prependOnceListener('did-finish-load', () => seen.push('second'));
+      await w.loadURL('about:blank');
+      await w.loadURL('about:blank');
+      expect(seen).to.deep.equal(['first', 'second']);
+    });
+
+    it('emits events without listeners to a replaced emit()', async () => {
+      const w = new BrowserWindow({ show: false });
+      const emitted: string[] = [];
+      const originalEmit = w.webContents.emit.bind(w.webContents);
+      w.webContents.emit = (name: string, ...args: any[]) => {
+        emitted.push(name);
+        return originalEmit(name, ...args);
+      };
+      await w.loadURL('about:blank');
+      expect(emitted).to.include('did-finish-load');
+    });
+  });
+
   describe('did-change-theme-color event', () => {
     afterEach(closeAllWindows);
     it('is triggered with correct theme color', (done) => {
@@ -2049,6 +2119,182 @@ describe('webContents module', () => {
     });
   });
 
+  describe('getResourceUsage()', () => {
+    afterEach(closeAllWindows);
+
+    it('reports the resources used by the page', async () => {
+      const w = new BrowserWindow({ show: false });
+      await w.loadURL('about:blank');
+      const usage = await w.webContents.getResourceUsage();
+      expect(usage.cpuTime).to.be.a('number').greaterThan(0);
+      expect(usage.processShared).to.be.false();
+      expect(usage.jsHeapSize).to.be.a('number').greaterThan(0);
+      expect(usage.domNodeCount).to.be.a('number').greaterThan(0);
+      expect(usage.frameCount).to.equal(1);
+      expect(usage.networkBytesReceived).to.be.a('number');
+      expect(usage.networkRequestCount).to.be.a('number');
+    });
+
+    it('works with sandboxed renderers', async () => {
+      const w = new BrowserWindow({ show: false, webPreferences: { sandbox: true } });
+      await w.loadURL('about:blank');
+      const usage = await w.webContents.getResourceUsage();
+      expect(usage.frameCount).to.equal(1);
+      expect(usage.domNodeCount).to.be.greaterThan(0);
+    });
+
+    it('counts the nodes of every frame', async () => {
+      const w = new BrowserWindow({ show: false });
+      await w.loadURL('about:blank');
+      const before = await w.webContents.getResourceUsage();
+      await w.webContents.executeJavaScript(`new Promise(resolve => {
+        for (let i = 0; i < 100; i++) document.body.appendChild(document.createElement('div'));
+        const iframe = document.createElement('iframe');
+        iframe.srcdoc = '<p>a</p><p>b</p>';
+        iframe.onload = resolve;
+        document.body.appendChild(iframe);
+      })`);
+      const after = await w.webContents.getResourceUsage();
+      expect(after.frameCount).to.equal(2);
+      expect(after.domNodeCount - before.domNodeCount).to.be.at.least(100);
+    });
+
+    it('fails with invalid render process', async () => {
+      const w = new BrowserWindow({ show: false });
+      w.webContents.destroy();
+      const promise = w.webContents.getResourceUsage();
+      return expect(promise).to.be.eventually.rejectedWith(Error, 'Failed to get resource usage with nonexistent render frame');
+    });
+  });
+
+  describe('purgeMemory()', () => {
+    afterEach(closeAllWindows);
+
+    it('signals memory pressure to the renderer', async () => {
+      const w = new BrowserWindow({ show: false });
+      await w.loadURL('about:blank');
+      await w.webContents.purgeMemory();
+      await w.webContents.purgeMemory({ level: 'critical' });
+      expect(await w.webContents.executeJavaScript('1 + 1')).to.equal(2);
+    });
+
+    it('resolves for a page with out-of-process frames', async () => {
+      const w = new BrowserWindow({ show: false });
+      await w.loadURL('about:blank');
+      await w.webContents.executeJavaScript(`new Promise(resolve => {
+        const iframe = document.createElement('iframe');
+        iframe.src = 'data:text/html,<p>a</p>';
+        iframe.onload = resolve;
+        document.body.appendChild(iframe);
+      })`);
+      await w.webContents.purgeMemory({ level: 'critical' });
+    });
+
+    it('throws on an invalid level', () => {
+      const w = new BrowserWindow({ show: false });
+      expect(() => {
+        w.webContents.purgeMemory({ level: 'low' as any });
+      }).to.throw("level must be 'moderate' or 'critical'");
+    });
+  });
+
+  describe('getChildWebContents()', () => {
+    afterEach(closeAllWindows);
+
+    const openChild = async (opener: WebContents, features = '') => {
+      const created = once(opener, 'did-create-window') as Promise<[BrowserWindow, Electron.DidCreateWindowDetails]>;
+      opener.executeJavaScript(`window.open('about:blank', '', '${features}') && null`);
+      const [child] = await created;
+      return child.webContents;
+    };
+
+    it('returns the windows opened by the page', async () => {
+      const w = new BrowserWindow({ show: false });
+      await w.loadURL('about:blank');
+      expect(w.webContents.getChildWebContents()).to.deep.equal([]);
+      const first = await openChild(w.webContents);
+      const second = await openChild(w.webContents, 'noopener');
+      const grandchild = await openChild(first);
+
+      const ids = (list: WebContents[]) => list.map(contents => contents.id);
+      expect(ids(w.webContents.getChildWebContents())).to.deep.equal([first.id, second.id]);
+      expect(ids(w.webContents.getChildWebContents({ recursive: true }))).to.deep.equal([first.id, second.id, grandchild.id]);
+      expect(ids(first.getChildWebContents())).to.deep.equal([grandchild.id]);
+    });
+
+    it('applies the group operations to the child windows', async () => {
+      const w = new BrowserWindow({ show: false });
+      await w.loadURL('about:blank');
+      const child = await openChild(w.webContents);
+      const grandchild = await openChild(child);
+
+      w.webContents.setBackgroundThrottlingPolicy({ freezeAfter: 1000, includeChildren: true });
+      expect(grandchild.getBackgroundThrottlingPolicy().freezeAfter).to.equal(1000);
+
+      await w.webContents.purgeMemory({ includeChildren: true });
+
+      const destroyed = Promise.all([w.webContents, child, grandchild].map(contents => once(contents, 'destroyed')));
+      w.webContents.close({ includeChildren: true });
+      await destroyed;
+    });
+  });
+
+  describe('executeJavaScriptInFrames()', () => {
+    afterEach(closeAllWindows);
+
+    const loadFrames = async () => {
+      const w = new BrowserWindow({ show: false });
+      await w.loadFile(path.join(fixturesPath, 'sub-frames', 'frame-with-frame-container.html'));
+      return w;
+    };
+
+    it('runs the script in every frame by default', async () => {
+      const w = await loadFrames();
+      const frames = w.webContents.mainFrame.framesInSubtree;
+      expect(frames).to.have.lengthOf(3);
+      const results = await w.webContents.executeJavaScriptInFrames('location.href');
+      expect(results).to.have.lengthOf(3);
+      expect(results.map(({ frame }) => frame)).to.have.members(frames);
+      for (const { frame, result, error } of results) {
+        expect(error).to.be.undefined();
+        expect(result).to.equal(frame!.url);
+      }
+    });
+
+    it('returns the results in the order of the frames', async () => {
+      const w = await loadFrames();
+      const frames = w.webContents.mainFrame.framesInSubtree.reverse();
+      const results = await w.webContents.executeJavaScriptInFrames('Promise.resolve({ depth: (() => { let d = 0; for (let f = window; f !== top; f = f.parent) d++; return d; })() })', { frames });
+      expect(results.map(({ frame }) => frame)).to.deep.equal(frames);
+      expect(results.map(({ result }) => result.depth)).to.deep.equal([2, 1, 0]);
+    });
+
+    it('reports errors per frame', async () => {
+      const w = await loadFrames();
+      const results = await w.webContents.executeJavaScriptInFrames('if (window !== top) throw new Error("nope"); 1');
+      const succeeded = results.filter(({ error }) => !error);
+      expect(succeeded).to.have.lengthOf(1);
+      expect(succeeded[0].frame).to.equal(w.webContents.mainFrame);
+      expect(succeeded[0].result).to.equal(1);
+      for (const { error } of results.filter(({ error }) => error)) {
+        expect(error).to.be.an.instanceOf(Error);
+      }
+    });
+
+    it('resolves with an empty array for no frames', async () => {
+      const w = await loadFrames();
+      const results = await w.webContents.executeJavaScriptInFrames('1', { frames: [] });
+      expect(results).to.deep.equal([]);
+    });
+
+    it('throws when frames is not an array of frames', async () => {
+      const w = await loadFrames();
+      expect(() => {
+        w.webContents.executeJavaScriptInFrames('1', { frames: [{}] as any });
+      }).to.throw('frames must be an array of WebFrameMain');
+    });
+  });
+
   describe('setBackgroundThrottling()', () => {
     afterEach(closeAllWindows);
     it('does not crash when allowing', () => {
@@ -2102,6 +2348,146 @@ describe('webContents module', () => {
     });
   });
 
+  describe('setBackgroundThrottlingPolicy()', () => {
+    afterEach(closeAllWindows);
+    it('defaults to stopping rendering and throttling timers', () => {
+      const w = new BrowserWindow({ show: false });
+      expect(w.webContents.getBackgroundThrottlingPolicy()).to.deep.equal({
+        timers: true,
+        rendering: 'stop',
+        freezeAfter: 0
+      });
+    });
+
+    it('reflects the backgroundThrottling preference', () => {
+      const w = new BrowserWindow({ show: false, webPreferences: { backgroundThrottling: false } });
+      expect(w.webContents.getBackgroundThrottlingPolicy()).to.deep.include({
+        timers: false,
+        rendering: 'full'
+      });
+    });
+
+    it('keeps omitted options', () => {
+      const w = new BrowserWindow({ show: false });
+      w.webContents.setBackgroundThrottlingPolicy({ rendering: 'throttle', freezeAfter: 1000 });
+      w.webContents.setBackgroundThrottlingPolicy({ timers: false });
+      expect(w.webContents.getBackgroundThrottlingPolicy()).to.deep.equal({
+        timers: false,
+        rendering: 'throttle',
+        freezeAfter: 1000
+      });
+      expect(w.webContents.getBackgroundThrottling()).to.equal(true);
+    });
+
+    it('is updated by setBackgroundThrottling()', () => {
+      const w = new BrowserWindow({ show: false });
+      w.webContents.setBackgroundThrottlingPolicy({ rendering: 'throttle' });
+      w.webContents.setBackgroundThrottling(false);
+      expect(w.webContents.getBackgroundThrottlingPolicy()).to.deep.include({
+        timers: false,
+        rendering: 'full'
+      });
+    });
+
+    it('throws on invalid options', () => {
+      const w = new BrowserWindow({ show: false });
+      expect(() => {
+        w.webContents.setBackgroundThrottlingPolicy({ rendering: 'slow' as any });
+      }).to.throw(/'rendering' must be one of/);
+      expect(() => {
+        w.webContents.setBackgroundThrottlingPolicy({ freezeAfter: -1 });
+      }).to.throw(/'freezeAfter' must be a non-negative number/);
+    });
+
+    it('keeps running timers in a hidden page until it is frozen', async () => {
+      const w = new BrowserWindow({ show: false });
+      await w.loadURL('about:blank');
+      w.webContents.setBackgroundThrottlingPolicy({ timers: false, rendering: 'full' });
+      const ticks = await w.webContents.executeJavaScript(`new Promise(resolve => {
+        let ticks = 0;
+        const id = setInterval(() => ticks++, 10);
+        setTimeout(() => { clearInterval(id); resolve(ticks); }, 500);
+      })`);
+      expect(ticks).to.be.greaterThan(10);
+    });
+  });
+
+  describe('setNavigationRules()', () => {
+    let server: http.Server;
+    let serverUrl: string;
+    before(async () => {
+      server = http.createServer((req, res) => {
+        res.setHeader('Content-Type', 'text/html');
+        res.end(`<title>${req.url}</title>`);
+      });
+      serverUrl = (await listen(server)).url;
+    });
+    after(() => server.close());
+    afterEach(closeAllWindows);
+
+    it('throws for invalid rules', () => {
+      const w = new BrowserWindow({ show: false });
+      expect(() => {
+        w.webContents.setNavigationRules([{ action: 'bogus' as any }]);
+      }).to.throw(/Invalid action bogus/);
+      expect(() => {
+        w.webContents.setNavigationRules([{ action: 'deny', condition: { urls: ['not a pattern'] } }]);
+      }).to.throw(/Invalid url pattern/);
+    });
+
+    it('denies matching navigations without emitting will-navigate', async () => {
+      const w = new BrowserWindow({ show: false });
+      await w.loadURL(`${serverUrl}/start`);
+      w.webContents.setNavigationRules([
+        { action: 'deny', condition: { urls: [`${serverUrl}/denied*`], isMainFrame: true } }
+      ]);
+      let emitted = false;
+      w.webContents.on('will-navigate', () => { emitted = true; });
+      const failed = once(w.webContents, 'did-fail-provisional-load');
+      w.webContents.executeJavaScript(`location.href = '${serverUrl}/denied'`);
+      const [, code] = await failed;
+      expect(code).to.equal(-3);
+      expect(emitted).to.be.false();
+      expect(w.webContents.getURL()).to.equal(`${serverUrl}/start`);
+    });
+
+    it('allows matching navigations without emitting will-navigate', async () => {
+      const w = new BrowserWindow({ show: false });
+      await w.loadURL(`${serverUrl}/start`);
+      w.webContents.setNavigationRules([
+        { action: 'allow', condition: { initiatorOrigins: [`${serverUrl}/*`] } }
+      ]);
+      let emitted = false;
+      w.webContents.on('will-navigate', (e) => {
+        emitted = true;
+        e.preventDefault();
+      });
+      const navigated = once(w.webContents, 'did-navigate');
+      w.webContents.executeJavaScript(`location.href = '${serverUrl}/allowed'`);
+      await navigated;
+      expect(emitted).to.be.false();
+      expect(w.webContents.getURL()).to.equal(`${serverUrl}/allowed`);
+    });
+
+    it('emits will-navigate for navigations that match no rule or an ask rule', async () => {
+      const w = new BrowserWindow({ show: false });
+      await w.loadURL(`${serverUrl}/start`);
+      w.webContents.setNavigationRules([
+        { action: 'ask', condition: { urls: [`${serverUrl}/ask`] } },
+        { action: 'deny', condition: { urls: [`${serverUrl}/*`] } }
+      ]);
+      const willNavigate = once(w.webContents, 'will-navigate');
+      w.webContents.executeJavaScript(`location.href = '${serverUrl}/ask'`);
+      const [event] = await willNavigate;
+      expect(event.url).to.equal(`${serverUrl}/ask`);
+
+      w.webContents.setNavigationRules(null);
+      const willNavigateAgain = once(w.webContents, 'will-navigate');
+      w.webContents.executeJavaScript(`location.href = '${serverUrl}/other'`);
+      await willNavigateAgain;
+    });
+  });
+
   ifdescribe(features.isPrintingEnabled())('getPrintersAsync()', () => {
     afterEach(closeAllWindows);
     it('can get printer list', async () => {
@@ -2200,6 +2586,44 @@ describe('webContents module', () => {
       expect(data).to.be.an.instanceof(Buffer).that.is.not.empty();
     });
 
+    it('can print a PDF straight to a file', async () => {
+      await w.loadURL('data:text/html,<h1>Hello, World!</h1>');
+
+      const filePath = path.join(app.getPath('temp'), `print-to-pdf-file-${Date.now()}.pdf`);
+      defer(() => fs.promises.rm(filePath, { force: true }));
+      await w.webContents.printToPDFFile(filePath);
+      const data = await fs.promises.readFile(filePath);
+      expect(data.subarray(0, 5).toString()).to.equal('%PDF-');
+    });
+
+    it('can print a batch of pages', async () => {
+      const results = await webContents.printToPDFBatch([
+        { url: 'data:text/html,<h1>One</h1>' },
+        { url: 'data:text/html,<h1>Two</h1>', options: { landscape: true } },
+        { url: 'data:text/html,<h1>Three</h1>' }
+      ], { concurrency: 2 });
+      expect(results).to.have.lengthOf(3);
+      for (const result of results) {
+        expect(result.error).to.be.undefined();
+        expect(result.data).to.be.an.instanceof(Buffer).that.is.not.empty();
+        expect(result.loadTime).to.be.a('number');
+        expect(result.printTime).to.be.a('number');
+      }
+    });
+
+    it('reports failed jobs in a batch without failing the others', async () => {
+      const results = await webContents.printToPDFBatch([
+        { url: 'file:///does/not/exist.html' },
+        { url: 'data:text/html,<h1>Hello, World!</h1>' }
+      ]);
+      expect(results[0].error).to.be.a('string');
+      expect(results[1].data).to.be.an.instanceof(Buffer).that.is.not.empty();
+    });
+
+    it('rejects printing to a relative path', async () => {
+      await expect(w.webContents.printToPDFFile('out.pdf')).to.eventually.be.rejectedWith(/absolute path/);
+    });
+
     type PageSizeString = Exclude<Required<Electron.PrintToPDFOptions>['pageSize'], Electron.Size>;
 
     it('with custom page sizes', async () => {
@@ -2308,6 +2732,57 @@ describe('webContents module', () => {
     });
   });
 
+  describe('startPrerendering()', () => {
+    let server: http.Server;
+    let serverUrl: string;
+    let requests: string[];
+    before(async () => {
+      server = http.createServer((req, res) => {
+        requests.push(req.url!);
+        res.setHeader('Content-Type', 'text/html');
+        res.end(`<title>${req.url}</title>`);
+      });
+      serverUrl = (await listen(server)).url;
+    });
+    beforeEach(() => { requests = []; });
+    after(() => server.close());
+    afterEach(closeAllWindows);
+
+    it('refuses URLs that are not http or https', () => {
+      const w = new BrowserWindow({ show: false });
+      expect(w.webContents.startPrerendering('file:///nonexistent')).to.equal(false);
+    });
+
+    it('refuses to prerender when the limits do not allow it', () => {
+      const w = new BrowserWindow({ show: false });
+      w.webContents.setPrerenderLimits({ maxCount: 0 });
+      expect(w.webContents.startPrerendering(`${serverUrl}/next`)).to.equal(false);
+    });
+
+    it('does not emit navigation events for the prerendered page', async () => {
+      const w = new BrowserWindow({ show: false });
+      await w.loadURL(`${serverUrl}/first`);
+      const events: string[] = [];
+      w.webContents.on('did-start-navigation', (details) => events.push(details.url));
+      w.webContents.on('did-navigate', (event, url) => events.push(url));
+      expect(w.webContents.startPrerendering(`${serverUrl}/next`)).to.equal(true);
+      await waitUntil(() => requests.includes('/next'));
+      await setTimeout(100);
+      expect(events).to.deep.equal([]);
+      w.webContents.stopPrerendering();
+    });
+
+    it('activates the prerendered page on loadURL()', async () => {
+      const w = new BrowserWindow({ show: false });
+      await w.loadURL(`${serverUrl}/first`);
+      expect(w.webContents.startPrerendering(`${serverUrl}/next`)).to.equal(true);
+      await waitUntil(() => requests.includes('/next'));
+      await w.loadURL(`${serverUrl}/next`);
+      expect(w.webContents.getURL()).to.equal(`${serverUrl}/next`);
+      expect(requests.filter(url => url === '/next')).to.have.lengthOf(1);
+    });
+  });
+
   describe('PictureInPicture video', () => {
     afterEach(closeAllWindows);
     it('works as expected', async function () {
@@ -85,6 +85,19 @@ describe('webFrameMain module', () => {
       ]);
     });
 
+    it('can query frames by url pattern', () => {
+      const urls = webFrame.queryFrames({ urls: ['file:///*/frame.html', 'file:///*/frame-with-frame.html'] })
+        .map(frame => frame.url);
+      expect(urls).to.deep.equal([
+        fileUrl('frame-with-frame.html'),
+        fileUrl('frame.html')
+      ]);
+    });
+
+    it('throws for an invalid url pattern', () => {
+      expect(() => webFrame.queryFrames({ urls: ['not a pattern'] })).to.throw(/Invalid url pattern/);
+    });
+
     describe('cross-origin', () => {
       let serverA: Server;
       let serverB: Server;
@@ -105,6 +118,14 @@ describe('webFrameMain module', () => {
         expect(webFrame.url.startsWith(serverA.url)).to.be.true();
         expect(webFrame.frames[0].url).to.equal(serverB.url);
       });
+
+      it('can query frames by origin', async () => {
+        await w.loadURL(`${serverA.url}?frameSrc=${serverB.url}`);
+        webFrame = w.webContents.mainFrame;
+        const frames = webFrame.queryFrames({ origin: new URL(serverB.url).origin });
+        expect(frames).to.have.lengthOf(1);
+        expect(frames[0]).to.equal(webFrame.frames[0]);
+      });
     });
   });
 
@@ -72,6 +72,34 @@ describe('webFrame module', () => {
     expect(callbackDefined).to.be.true();
   });
 
+  it('only asks an off-thread spellcheck provider about new words', async () => {
+    const w = new BrowserWindow({
+      show: false,
+      webPreferences: {
+        nodeIntegration: true,
+        contextIsolation: false
+      }
+    });
+    defer(() => w.close());
+    await w.loadFile(path.join(fixtures, 'pages', 'webframe-spell-check-off-thread.html'));
+    w.focus();
+    await w.webContents.executeJavaScript('document.querySelector("input").focus()', true);
+
+    const askedWords: string[] = [];
+    const spellCheckerFeedback = new Promise<void>(resolve => {
+      ipcMain.on('spec-spell-check', (e, words: string[]) => {
+        askedWords.push(...words);
+        if (words.includes('again')) resolve();
+      });
+    });
+    const inputText = 'spleling test spleling test again ';
+    for (const keyCode of inputText) {
+      w.webContents.sendInputEvent({ type: 'char', keyCode });
+    }
+    await spellCheckerFeedback;
+    expect(askedWords.sort()).to.deep.equal(['again', 'spleling', 'test']);
+  });
+
   describe('api', () => {
     let w: WebContents;
     before(async () => {
@@ -257,5 +285,95 @@ describe('webFrame module', () => {
         expect(await w.executeJavaScript('webFrame.executeJavaScriptInIsolatedWorld(999, [{code: \'1 + 1\'}])')).to.equal(2);
       });
     });
+
+    describe('registerStyleSheet()', () => {
+      it('applies a registered style sheet to frames', async () => {
+        const result = await w.executeJavaScript(`(() => {
+          const key = webFrame.registerStyleSheet('body { border-top-width: 7px; border-top-style: solid; }');
+          const color = f => getComputedStyle(f.body).borderTopWidth;
+          const child = window.frames[0].document;
+          const before = [color(document), color(child)];
+          const count = webFrame.applyStyleSheet(key, { subframes: true });
+          const applied = [color(document), color(child)];
+          webFrame.applyStyleSheet(key);
+          webFrame.removeInsertedCSS(key);
+          childFrame.removeInsertedCSS(key);
+          const removed = [color(document), color(child)];
+          webFrame.unregisterStyleSheet(key);
+          return { before, count, applied, removed };
+        })()`);
+        expect(result.count).to.equal(2);
+        expect(result.applied).to.deep.equal(['7px', '7px']);
+        expect(result.removed).to.deep.equal(result.before);
+      });
+
+      it('returns the same key for the same style sheet', async () => {
+        const [a, b, c] = await w.executeJavaScript(`[
+          webFrame.registerStyleSheet('p { color: red; }'),
+          webFrame.registerStyleSheet('p { color: red; }'),
+          webFrame.registerStyleSheet('p { color: red; }', { cssOrigin: 'user' })
+        ]`);
+        expect(a).to.be.a('string');
+        expect(b).to.equal(a);
+        expect(c).to.not.equal(a);
+      });
+
+      it('throws for unregistered keys', async () => {
+        const message = await w.executeJavaScript(`(() => {
+          try { webFrame.applyStyleSheet('not-a-key'); } catch (e) { return e.message; }
+        })()`);
+        expect(message).to.equal('No style sheet is registered with this key');
+      });
+    });
+
+    describe('registerScript()', () => {
+      it('runs a registered script in any frame and world', async () => {
+        const results = await w.executeJavaScript(`(async () => {
+          const handle = webFrame.registerScript('window.registeredRuns = (window.registeredRuns || 0) + 1', { url: 'registered.js' });
+          return [
+            await webFrame.executeRegisteredScript(handle),
+            await webFrame.executeRegisteredScript(handle),
+            await childFrame.executeRegisteredScript(handle),
+            await webFrame.executeRegisteredScript(handle, { worldId: 999 })
+          ];
+        })()`);
+        expect(results).to.deep.equal([1, 2, 1, 1]);
+      });
+
+      it('returns the same handle for the same script', async () => {
+        const [a, b, c] = await w.executeJavaScript(`[
+          webFrame.registerScript('1 + 1'),
+          webFrame.registerScript('1 + 1'),
+          webFrame.registerScript('1 + 2')
+        ]`);
+        expect(a).to.be.a('number');
+        expect(b).to.equal(a);
+        expect(c).to.not.equal(a);
+      });
+
+      it('throws when the script does not compile', async () => {
+        const message = await w.executeJavaScript(`(() => {
+          try { webFrame.registerScript('this is not valid'); } catch (e) { return e.name; }
+        })()`);
+        expect(message).to.equal('SyntaxError');
+      });
+
+      it('rejects when the script throws', async () => {
+        const error = await w.executeJavaScript(`(async () => {
+          const handle = webFrame.registerScript('thisShouldProduceAnError()');
+          try { await webFrame.executeRegisteredScript(handle); } catch (e) { return e.message; }
+        })()`);
+        expect(error).to.match(/Script failed to execute/);
+      });
+
+      it('rejects for unregistered handles', async () => {
+        const error = await w.executeJavaScript(`(async () => {
+          const handle = webFrame.registerScript('"to be unregistered"');
+          webFrame.unregisterScript(handle);
+          try { await webFrame.executeRegisteredScript(handle); } catch (e) { return e.message; }
+        })()`);
+        expect(error).to.equal('No script is registered with this handle');
+      });
+    });
   });
 });
@@ -106,6 +106,17 @@ describe('webRequest module', () => {
       await expect(ajax(`${defaultURL}filter/test`)).to.eventually.be.rejected();
     });
 
+    it('can filter URLs among many patterns', async () => {
+      const urls = [defaultURL + 'filter/*', 'file:///nothing/*'];
+      for (let i = 0; i < 100; i++) {
+        urls.push(`*://host${i}.example.com/*`, `*://*.domain${i}.example.com/*`);
+      }
+      ses.webRequest.onBeforeRequest({ urls }, cancel);
+      const { data } = await ajax(`${defaultURL}nofilter/test`);
+      expect(data).to.equal('/nofilter/test');
+      await expect(ajax(`${defaultURL}filter/test`)).to.eventually.be.rejected();
+    });
+
     it('can filter URLs and types', async () => {
       const filter1: Electron.WebRequestFilter = { urls: [defaultURL + 'filter/*'], types: ['xhr'] };
       ses.webRequest.onBeforeRequest(filter1, cancel);
@@ -119,6 +130,12 @@ describe('webRequest module', () => {
       expect((await ajax(`${defaultURL}filter/test`)).data).to.equal('/filter/test');
     });
 
+    it('cancels a request redirected to a filtered URL', async () => {
+      // /serverRedirect does not match the filter, the URL it redirects to does.
+      ses.webRequest.onBeforeRequest({ urls: [defaultURL] }, cancel);
+      await expect(ajax(`${defaultURL}serverRedirect`)).to.eventually.be.rejected();
+    });
+
     it('receives details object', async () => {
       ses.webRequest.onBeforeRequest((details, callback) => {
         expect(details.id).to.be.a('number');
@@ -137,6 +154,21 @@ describe('webRequest module', () => {
       expect(data).to.equal('/');
     });
 
+    it('receives details objects of the same shape', async () => {
+      const keys: string[][] = [];
+      ses.webRequest.onBeforeRequest((details, callback) => {
+        keys.push(Object.keys(details));
+        callback({});
+      });
+      await ajax(defaultURL);
+      await ajax(`${defaultURL}again`);
+      expect(keys).to.have.lengthOf(2);
+      expect(keys[0]).to.deep.equal(keys[1]);
+      expect(keys[0].slice(0, 5)).to.deep.equal(['id', 'url', 'method', 'timestamp', 'resourceType']);
+      expect(keys[0]).to.not.include('uploadData');
+      expect(keys[0]).to.not.include('ip');
+    });
+
     it('receives post data in details object', async () => {
       const postData = {
         name: 'post test',
@@ -582,6 +614,63 @@ describe('webRequest module', () => {
     });
   });
 
+  describe('webRequest.setDeclarativeRules', () => {
+    afterEach(() => {
+      ses.webRequest.setDeclarativeRules(null);
+      ses.webRequest.onBeforeSendHeaders(null);
+    });
+
+    it('can block requests', async () => {
+      ses.webRequest.setDeclarativeRules([
+        { condition: { urls: [defaultURL + 'allowed/*'] }, action: { type: 'allow' } },
+        { condition: { urls: [defaultURL + '*'] }, action: { type: 'block' } }
+      ]);
+      const { data } = await ajax(`${defaultURL}allowed/test`);
+      expect(data).to.equal('/allowed/test');
+      await expect(ajax(`${defaultURL}blocked/test`)).to.eventually.be.rejected();
+    });
+
+    it('can redirect requests', async () => {
+      ses.webRequest.setDeclarativeRules([
+        { condition: { urls: [defaultURL + 'from'] }, action: { type: 'redirect', redirectURL: defaultURL + 'to' } }
+      ]);
+      const { data } = await ajax(`${defaultURL}from`);
+      expect(data).to.equal('/to');
+    });
+
+    it('can modify request and response headers', async () => {
+      ses.webRequest.setDeclarativeRules([{
+        action: {
+          type: 'modifyHeaders',
+          requestHeaders: [{ header: 'Accept', operation: 'set', value: '*/*;test/header' }],
+          responseHeaders: [
+            { header: 'Custom', operation: 'remove' },
+            { header: 'X-Rule', operation: 'set', value: 'applied' }
+          ]
+        }
+      }]);
+      let accept: string | undefined;
+      ses.webRequest.onBeforeSendHeaders((details, callback) => {
+        accept = details.requestHeaders.Accept;
+        callback({});
+      });
+      const { data, headers } = await ajax(defaultURL);
+      expect(data).to.equal('/header/received');
+      expect(accept).to.equal('*/*;test/header');
+      expect(headers).to.have.property('x-rule', 'applied');
+      expect(headers).to.not.have.property('custom');
+    });
+
+    it('throws for invalid rules', () => {
+      expect(() => {
+        ses.webRequest.setDeclarativeRules([{ action: { type: 'explode' as any } }]);
+      }).to.throw('Invalid rule at index 0: Invalid action type explode');
+      expect(() => {
+        ses.webRequest.setDeclarativeRules([{ action: { type: 'redirect' } }]);
+      }).to.throw(/'action.redirectURL' must be a URL/);
+    });
+  });
+
   describe('WebSocket connections', () => {
     it('can be proxyed', async () => {
       // Setup server.
@@ -676,5 +765,79 @@ describe('webRequest module', () => {
       expect(reqHeaders['/websocket'].foo).to.equal('bar');
       expect(reqHeaders['/'].foo).to.equal('bar');
     });
+
+    describe('when listeners do not match', () => {
+      const ses = session.fromPartition('WebRequestWebSocketUnmatched');
+      const reqHeaders : { [key: string] : any } = {};
+      let server: http.Server;
+      let port: number;
+
+      before(async () => {
+        server = http.createServer((req, res) => {
+          reqHeaders[req.url!] = req.headers;
+          res.end('ok');
+        });
+        const wss = new WebSocket.Server({ noServer: true });
+        wss.on('connection', (ws) => {
+          ws.on('message', (message) => {
+            if (message === 'foo') ws.send('bar');
+          });
+        });
+        server.on('upgrade', (request, socket, head) => {
+          reqHeaders[request.url!] = request.headers;
+          wss.handleUpgrade(request, socket as Socket, head, (ws) => {
+            wss.emit('connection', ws, request);
+          });
+        });
+        ({ port } = await listen(server));
+      });
+
+      after(() => {
+        server.close();
+      });
+
+      afterEach(() => {
+        ses.webRequest.onBeforeSendHeaders(null);
+        ses.webRequest.setDeclarativeRules(null);
+      });
+
+      async function connect () {
+        const contents = (webContents as typeof ElectronInternal.WebContents).create({
+          session: ses,
+          nodeIntegration: true,
+          webSecurity: false,
+          contextIsolation: false
+        });
+        try {
+          contents.loadFile(path.join(fixturesPath, 'api', 'webrequest.html'), { query: { port: `${port}` } });
+          await once(ipcMain, 'websocket-success');
+        } finally {
+          contents.destroy();
+        }
+      }
+
+      it('connects sockets that no filter matches', async () => {
+        ses.webRequest.onBeforeSendHeaders({ urls: ['http://*/*'] }, (details, callback) => {
+          details.requestHeaders.foo = 'bar';
+          callback({ requestHeaders: details.requestHeaders });
+        });
+        await connect();
+        expect(reqHeaders['/'].foo).to.equal('bar');
+        expect(reqHeaders['/websocket'].foo).to.be.undefined();
+      });
+
+      it('applies declarative rules to the handshake', async () => {
+        ses.webRequest.setDeclarativeRules([{
+          condition: { urls: ['ws://*/*'] },
+          action: {
+            type: 'modifyHeaders',
+            requestHeaders: [{ header: 'X-Rule', operation: 'set', value: 'applied' }]
+          }
+        }]);
+        await connect();
+        expect(reqHeaders['/websocket']['x-rule']).to.equal('applied');
+        expect(reqHeaders['/']['x-rule']).to.be.undefined();
+      });
+    });
   });
 });
@@ -1,8 +1,10 @@
 import { expect } from 'chai';
+import * as cp from 'node:child_process';
 import * as path from 'node:path';
 import * as url from 'node:url';
+import * as zlib from 'node:zlib';
 import { Worker } from 'node:worker_threads';
-import { BrowserWindow, ipcMain } from 'electron/main';
+import { BrowserWindow, ipcMain, nativeImage } from 'electron/main';
 import { closeAllWindows } from './lib/window-helpers';
 import { getRemoteContext, ifdescribe, ifit, itremote, useRemoteContext } from './lib/spec-helpers';
 import * as importedFs from 'node:fs';
@@ -179,6 +181,126 @@ describe('asar package', function () {
     `
   });
 
+  describe('process.env.ELECTRON_ASAR_MMAP', () => {
+    it('reads packed files out of the mapped archive', async () => {
+      const child = cp.spawn(process.execPath, [path.join(fixtures, 'module', 'asar-read.js')], {
+        env: { ...process.env, ELECTRON_RUN_AS_NODE: '1', ELECTRON_ASAR_MMAP: '1' }
+      });
+      let output = '';
+      child.stdout.on('data', (data) => { output += data; });
+      const [code] = await once(child, 'exit');
+      expect(code).to.equal(0);
+      expect(JSON.parse(output)).to.deep.equal({
+        string: 'file1\n',
+        buffer: 'file2\n',
+        link: 'file3\n'
+      });
+    });
+  });
+
+  describe('process.env.ELECTRON_ASAR_INDEX_CACHE', () => {
+    const readArchive = async (archive: string, env: NodeJS.ProcessEnv) => {
+      const child = cp.spawn(process.execPath, [path.join(fixtures, 'module', 'asar-read.js'), archive], {
+        env: { ...process.env, ELECTRON_RUN_AS_NODE: '1', ...env }
+      });
+      let output = '';
+      child.stdout.on('data', (data) => { output += data; });
+      const [code] = await once(child, 'exit');
+      expect(code).to.equal(0);
+      return JSON.parse(output);
+    };
+
+    it('writes an index next to the archive and reads it back', async () => {
+      const temp = require('temp').track();
+      const archive = path.join(temp.mkdirSync('asar-index-cache-'), 'a.asar');
+      importedFs.copyFileSync(path.join(asarDir, 'a.asar'), archive);
+
+      const expected = { string: 'file1\n', buffer: 'file2\n', link: 'file3\n' };
+      expect(await readArchive(archive, { ELECTRON_ASAR_INDEX_CACHE: '1' })).to.deep.equal(expected);
+      expect(importedFs.existsSync(`${archive}.index`)).to.be.true();
+      expect(await readArchive(archive, {})).to.deep.equal(expected);
+    });
+
+    it('ignores an index that does not match the archive', async () => {
+      const temp = require('temp').track();
+      const archive = path.join(temp.mkdirSync('asar-index-cache-'), 'a.asar');
+      importedFs.copyFileSync(path.join(asarDir, 'a.asar'), archive);
+      importedFs.writeFileSync(`${archive}.index`, 'not an index');
+
+      expect(await readArchive(archive, {})).to.deep.equal({ string: 'file1\n', buffer: 'file2\n', link: 'file3\n' });
+    });
+  });
+
+  describe('compressed files', () => {
+    // Builds an archive holding a single brotli compressed file, see the layout
+    // in docs/tutorial/asar-archives.md.
+    const writeCompressedArchive = (contents: Buffer, blockSize: number, name = 'file.txt') => {
+      const blocks: Buffer[] = [];
+      for (let i = 0; i < contents.length; i += blockSize) {
+        blocks.push(zlib.brotliCompressSync(contents.subarray(i, i + blockSize)));
+      }
+      const header = Buffer.from(JSON.stringify({
+        files: {
+          [name]: {
+            size: contents.length,
+            offset: '0',
+            compression: { algorithm: 'brotli', blockSize, blocks: blocks.map(block => block.length) }
+          }
+        }
+      }));
+      const headerPickle = Buffer.alloc(8 + Math.ceil(header.length / 4) * 4);
+      headerPickle.writeUInt32LE(headerPickle.length - 4, 0);
+      headerPickle.writeInt32LE(header.length, 4);
+      header.copy(headerPickle, 8);
+      const sizePickle = Buffer.alloc(8);
+      sizePickle.writeUInt32LE(4, 0);
+      sizePickle.writeUInt32LE(headerPickle.length, 4);
+
+      const temp = require('temp').track();
+      const archive = path.join(temp.mkdirSync('asar-compressed-'), 'compressed.asar');
+      importedFs.writeFileSync(archive, Buffer.concat([sizePickle, headerPickle, ...blocks]));
+      return path.join(archive, name);
+    };
+
+    const contents = Buffer.from('0123456789abcdef'.repeat(1000));
+
+    it('reads a compressed file with fs.readFileSync', () => {
+      const file = writeCompressedArchive(contents, 4096);
+      expect(fs.readFileSync(file)).to.deep.equal(contents);
+      expect(fs.readFileSync(file, 'utf8')).to.equal(contents.toString());
+    });
+
+    it('reads a compressed file with fs.promises.readFile', async () => {
+      const file = writeCompressedArchive(contents, 4096);
+      expect(await fs.promises.readFile(file)).to.deep.equal(contents);
+    });
+
+    it('reads part of a compressed file through a file descriptor', () => {
+      const file = writeCompressedArchive(contents, 4096);
+      const fd = fs.openSync(file, 'r');
+      try {
+        const buffer = Buffer.alloc(100);
+        fs.readSync(fd, buffer, 0, buffer.length, 5000);
+        expect(buffer).to.deep.equal(contents.subarray(5000, 5100));
+      } finally {
+        fs.closeSync(fd);
+      }
+    });
+
+    it('reports the decompressed size', () => {
+      const file = writeCompressedArchive(contents, 4096);
+      expect(fs.statSync(file).size).to.equal(contents.length);
+    });
+
+    it('loads a compressed image with nativeImage.createFromPath', () => {
+      const png = importedFs.readFileSync(path.join(fixtures, 'assets', 'logo.png'));
+      const file = writeCompressedArchive(png, 4096, 'logo.png');
+      const image = nativeImage.createFromPath(file);
+      expect(image.isEmpty()).to.be.false();
+      expect(image.getSize()).to.deep.equal(nativeImage.createFromBuffer(png).getSize());
+    });
+  });
+
   describe('node api', function () {
     itremote('supports paths specified as a Buffer', function () {
       const file = Buffer.from(path.join(asarDir, 'a.asar', 'file1'));
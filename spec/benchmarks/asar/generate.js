@@ -0,0 +1,142 @@
+// Writes the synthetic archives used by the asar benchmark. Runs in plain
+// Node.js, from script/benchmark.js, so that writing the archives does not go
+// through Electron's asar support.
+const crypto = require('node:crypto');
+const fs = require('node:fs');
+const path = require('node:path');
+
+const kBlockSize = 4 * 1024 * 1024;
+const kBranching = 4;
+const kModuleCount = 50;
+const kPackageCount = 10;
+
+function sha256 (data) {
+  return crypto.createHash('sha256').update(data).digest('hex');
+}
+
+function makeIntegrity (content) {
+  const blocks = [];
+  for (let offset = 0; offset < content.length; offset += kBlockSize) {
+    blocks.push(sha256(content.subarray(offset, offset + kBlockSize)));
+  }
+  return { algorithm: 'SHA256', hash: sha256(content), blockSize: kBlockSize, blocks };
+}
+
+// The layout of the header is the one written by @electron/asar: a pickle
+// holding the size of a second pickle, which holds the JSON header.
+function serializeHeader (header) {
+  const json = Buffer.from(JSON.stringify(header));
+  const aligned = (json.length + 3) & ~3;
+  const headerPickle = Buffer.alloc(8 + aligned);
+  headerPickle.writeUInt32LE(4 + aligned, 0);
+  headerPickle.writeUInt32LE(json.length, 4);
+  json.copy(headerPickle, 8);
+  const sizePickle = Buffer.alloc(8);
+  sizePickle.writeUInt32LE(4, 0);
+  sizePickle.writeUInt32LE(headerPickle.length, 4);
+  return Buffer.concat([sizePickle, headerPickle]);
+}
+
+function writeArchive (archivePath, entries, integrity) {
+  const header = { files: {} };
+  const contents = [];
+  let offset = 0;
+  for (const { name, content } of entries) {
+    const segments = name.split('/');
+    let dir = header;
+    for (const segment of segments.slice(0, -1)) {
+      dir.files[segment] = dir.files[segment] || { files: {} };
+      dir = dir.files[segment];
+    }
+    const node = { size: content.length, offset: String(offset) };
+    if (integrity) node.integrity = makeIntegrity(content);
+    dir.files[segments[segments.length - 1]] = node;
+    contents.push(content);
+    offset += content.length;
+  }
+  fs.writeFileSync(archivePath, Buffer.concat([serializeHeader(header), ...contents]));
+}
+
+// Files are spread over a tree with |depth| levels of |kBranching| directories
+// each, so a lookup walks |depth| directory nodes.
+function filePath (index, depth) {
+  const segments = [];
+  for (let level = 0; level < depth; level++) {
+    segments.push(`d${Math.floor(index / kBranching ** level) % kBranching}`);
+  }
+  segments.push(`f${index}.txt`);
+  return segments.join('/');
+}
+
+// An app entry point that requires modules by relative path and packages
+// from node_modules, so require() has to resolve through the archive.
+function moduleEntries () {
+  const entries = [];
+  const requires = [];
+  for (let i = 0; i < kModuleCount; i++) {
+    const name = `app/lib/group${i % 5}/module${i}.js`;
+    entries.push({ name, content: Buffer.from(`module.exports = ${i};\n`) });
+    requires.push(`require('./lib/group${i % 5}/module${i}')`);
+  }
+  for (let i = 0; i < kPackageCount; i++) {
+    entries.push({
+      name: `app/node_modules/package${i}/package.json`,
+      content: Buffer.from(JSON.stringify({ name: `package${i}`, main: 'lib/main.js' }))
+    });
+    entries.push({
+      name: `app/node_modules/package${i}/lib/main.js`,
+      content: Buffer.from(`module.exports = 'package${i}';\n`)
+    });
+    requires.push(`require('package${i}')`);
+  }
+  entries.push({ name: 'app/index.js', content: Buffer.from(`module.exports = [\n  ${requires.join(',\n  ')}\n];\n`) });
+  return entries;
+}
+
+// Generates every combination of the given file counts, depths and
+// integrity settings under |outDir| and returns the manifest the benchmark
+// app reads. Each archive is written |copies| times, since an archive's
+// header is only parsed the first time it is opened in a process.
+function generate (outDir, {
+  fileCounts = [100, 1000, 10000],
+  depths = [2, 8],
+  copies = 5,
+  bigFileSize = 16 * 1024 * 1024,
+  sampleCount = 1000
+} = {}) {
+  fs.mkdirSync(outDir, { recursive: true });
+  const bigFile = crypto.randomBytes(bigFileSize);
+  const manifest = [];
+
+  for (const fileCount of fileCounts) {
+    for (const depth of depths) {
+      const entries = [];
+      for (let i = 0; i < fileCount; i++) {
+        entries.push({ name: filePath(i, depth), content: Buffer.from(`file ${i}\n`) });
+      }
+      entries.push({ name: 'big.bin', content: bigFile }, ...moduleEntries());
+
+      const samplePaths = [];
+      for (let i = 0; i < sampleCount; i++) {
+        samplePaths.push(filePath(crypto.randomInt(fileCount), depth));
+      }
+
+      for (const integrity of [false, true]) {
+        const name = `files-${fileCount}-depth-${depth}${integrity ? '-integrity' : ''}`;
+        const archives = [];
+        for (let copy = 0; copy < copies; copy++) {
+          const archivePath = path.join(outDir, `${name}-${copy}.asar`);
+          writeArchive(archivePath, entries, integrity);
+          archives.push(archivePath);
+        }
+        manifest.push({ name, fileCount, depth, integrity, archives, samplePaths, bigFileSize });
+      }
+    }
+  }
+
+  const manifestPath = path.join(outDir, 'manifest.json');
+  fs.writeFileSync(manifestPath, JSON.stringify(manifest));
+  return manifestPath;
+}
+
+module.exports = { generate };
@@ -0,0 +1,132 @@
+// Measures header parsing, path lookups, reads and require() inside the
+// archives written by generate.js. Run through `script/benchmark.js --asar`.
+const { app, net } = require('electron');
+
+const fs = require('node:fs');
+const path = require('node:path');
+const { finished } = require('node:stream/promises');
+const { pathToFileURL } = require('node:url');
+
+const kIterations = 5000;
+const kThroughputRuns = 5;
+
+function parseArgs (argv) {
+  const options = { manifest: null, jsonOutput: null };
+  for (const arg of argv) {
+    const [key, value] = arg.replace(/^--/, '').split('=');
+    if (key === 'manifest') options.manifest = value;
+    else if (key === 'json-output') options.jsonOutput = path.resolve(value);
+  }
+  return options;
+}
+
+function time (fn) {
+  const start = performance.now();
+  fn();
+  return performance.now() - start;
+}
+
+async function timeAsync (fn) {
+  const start = performance.now();
+  await fn();
+  return performance.now() - start;
+}
+
+// Latencies are in milliseconds, throughput in MB/s.
+function latencyStats (samples) {
+  const sorted = Float64Array.from(samples).sort();
+  const percentile = (p) => sorted[Math.min(sorted.length - 1, Math.floor(sorted.length * p))];
+  return { samples: sorted.length, p50: percentile(0.5), p90: percentile(0.9), p99: percentile(0.99), max: sorted[sorted.length - 1] };
+}
+
+function throughputStats (bytes, samples) {
+  const rates = samples.map(ms => bytes / (1024 * 1024) / (ms / 1000)).sort((a, b) => a - b);
+  return { samples: rates.length, min: rates[0], p50: rates[Math.floor(rates.length / 2)], max: rates[rates.length - 1] };
+}
+
+async function runConfig ({ archives, samplePaths, bigFileSize }) {
+  const [archive] = archives;
+  const sampleAt = (i) => path.join(archive, samplePaths[i % samplePaths.length]);
+  const bigFile = path.join(archive, 'big.bin');
+
+  // The first access to each copy opens it, which parses the header.
+  const headerParse = archives.map(copy => time(() => fs.statSync(path.join(copy, samplePaths[0]))));
+
+  const stat = [];
+  const statMissing = [];
+  const readSmall = [];
+  for (let i = 0; i < kIterations; i++) {
+    const file = sampleAt(i);
+    stat.push(time(() => fs.statSync(file)));
+    statMissing.push(time(() => fs.existsSync(`${file}.missing`)));
+    readSmall.push(time(() => fs.readFileSync(file)));
+  }
+
+  const readStream = [];
+  const urlLoader = [];
+  for (let i = 0; i < kThroughputRuns; i++) {
+    readStream.push(await timeAsync(() => finished(fs.createReadStream(bigFile).resume())));
+    urlLoader.push(await timeAsync(async () => {
+      const response = await net.fetch(pathToFileURL(bigFile).href);
+      await response.arrayBuffer();
+    }));
+  }
+
+  // Every copy has its own module paths, so each require() resolves and
+  // compiles the whole module tree again.
+  const requireTree = archives.map(copy => time(() => require(path.join(copy, 'app', 'index.js'))));
+
+  return {
+    headerParse: latencyStats(headerParse),
+    stat: latencyStats(stat),
+    statMissing: latencyStats(statMissing),
+    readSmall: latencyStats(readSmall),
+    requireTree: latencyStats(requireTree),
+    readStream: throughputStats(bigFileSize, readStream),
+    urlLoader: throughputStats(bigFileSize, urlLoader)
+  };
+}
+
+function print (name, metrics) {
+  console.log(name);
+  const us = (ms) => `${(ms * 1000).toFixed(1)}µs`.padStart(12);
+  const mbs = (value) => `${value.toFixed(0)}MB/s`.padStart(10);
+  for (const [metric, stats] of Object.entries(metrics)) {
+    if ('p99' in stats) {
+      console.log(`  ${metric.padEnd(14)} p50${us(stats.p50)}  p90${us(stats.p90)}  p99${us(stats.p99)}  max${us(stats.max)}`);
+    } else {
+      console.log(`  ${metric.padEnd(14)} min${mbs(stats.min)}  p50${mbs(stats.p50)}  max${mbs(stats.max)}`);
+    }
+  }
+}
+
+async function main () {
+  const options = parseArgs(process.argv.slice(2));
+  const manifest = JSON.parse(fs.readFileSync(options.manifest, 'utf8'));
+
+  const results = [];
+  for (const config of manifest) {
+    const metrics = await runConfig(config);
+    print(config.name, metrics);
+    const { name, fileCount, depth, integrity } = config;
+    results.push({ name, fileCount, depth, integrity, metrics });
+  }
+
+  if (options.jsonOutput) {
+    fs.mkdirSync(path.dirname(options.jsonOutput), { recursive: true });
+    fs.writeFileSync(options.jsonOutput, JSON.stringify({
+      versions: { electron: process.versions.electron, chrome: process.versions.chrome },
+      platform: process.platform,
+      arch: process.arch,
+      date: new Date().toISOString(),
+      results
+    }, null, 2));
+  }
+}
+
+app.whenReady().then(main).then(() => {
+  app.exit(0);
+}, (error) => {
+  console.error(error);
+  app.exit(1);
+});
@@ -0,0 +1,105 @@
+// Measures the IPC, context bridge and structured-clone paths end to end in a
+// real window. Run through script/benchmark.js, see docs/development/testing.md.
+const { app, BrowserWindow, ipcMain, MessageChannelMain } = require('electron');
+
+const fs = require('node:fs');
+const path = require('node:path');
+
+const benchmarks = [
+  'ipc.send',
+  'ipc.send-sync',
+  'ipc.invoke',
+  'ipc.invoke-large',
+  'message-port.echo',
+  'context-bridge.call',
+  'context-bridge.call-large',
+  'context-bridge.callback'
+];
+
+function parseArgs (argv) {
+  const options = { iterations: 5000, warmup: 500, filter: null, jsonOutput: null };
+  for (const arg of argv) {
+    const [key, value] = arg.replace(/^--/, '').split('=');
+    if (key === 'iterations' || key === 'warmup') options[key] = parseInt(value, 10);
+    else if (key === 'filter') options.filter = new RegExp(value);
+    else if (key === 'json-output') options.jsonOutput = path.resolve(value);
+  }
+  return options;
+}
+
+function summarize (name, { elapsed, samples }) {
+  const sorted = Float64Array.from(samples).sort();
+  const percentile = (p) => sorted[Math.min(sorted.length - 1, Math.floor(sorted.length * p))];
+  const mean = sorted.reduce((sum, value) => sum + value, 0) / sorted.length;
+  return {
+    name,
+    iterations: sorted.length,
+    opsPerSec: sorted.length / (elapsed / 1000),
+    // Latencies are in milliseconds.
+    mean,
+    p50: percentile(0.5),
+    p90: percentile(0.9),
+    p99: percentile(0.99),
+    max: sorted[sorted.length - 1]
+  };
+}
+
+function print (result) {
+  const us = (ms) => `${(ms * 1000).toFixed(1)}µs`.padStart(10);
+  console.log(`${result.name.padEnd(28)}${result.opsPerSec.toFixed(0).padStart(10)} ops/s` +
+    `  p50${us(result.p50)}  p90${us(result.p90)}  p99${us(result.p99)}  max${us(result.max)}`);
+}
+
+async function main () {
+  const options = parseArgs(process.argv.slice(2));
+
+  ipcMain.on('bench:send', (event) => event.reply('bench:reply'));
+  ipcMain.on('bench:send-sync', (event) => { event.returnValue = null; });
+  ipcMain.handle('bench:invoke', (event, value) => value);
+
+  const w = new BrowserWindow({
+    show: false,
+    webPreferences: {
+      contextIsolation: true,
+      sandbox: true,
+      backgroundThrottling: false,
+      preload: path.join(__dirname, 'preload.js')
+    }
+  });
+  await w.loadFile(path.join(__dirname, 'index.html'));
+
+  const { port1, port2 } = new MessageChannelMain();
+  port1.on('message', ({ data }) => port1.postMessage(data));
+  port1.start();
+  w.webContents.postMessage('bench:port', null, [port2]);
+
+  const results = [];
+  for (const name of benchmarks) {
+    if (options.filter && !options.filter.test(name)) continue;
+    const config = { iterations: options.iterations, warmup: options.warmup };
+    const raw = await w.webContents.executeJavaScript(
+      `runBenchmark(${JSON.stringify(name)}, ${JSON.stringify(config)})`);
+    const result = summarize(name, raw);
+    print(result);
+    results.push(result);
+  }
+
+  if (options.jsonOutput) {
+    fs.mkdirSync(path.dirname(options.jsonOutput), { recursive: true });
+    fs.writeFileSync(options.jsonOutput, JSON.stringify({
+      versions: { electron: process.versions.electron, chrome: process.versions.chrome },
+      platform: process.platform,
+      arch: process.arch,
+      date: new Date().toISOString(),
+      options: { iterations: options.iterations, warmup: options.warmup },
+      results
+    }, null, 2));
+  }
+}
+
+app.whenReady().then(main).then(() => {
+  app.exit(0);
+}, (error) => {
+  console.error(error);
+  app.exit(1);
+});
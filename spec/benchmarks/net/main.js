@@ -0,0 +1,199 @@
+// Measures what intercepting requests costs a page: fetch() latency and
+// throughput against a local server and through each kind of protocol
+// handler, with and without webRequest listeners. Run through
+// `script/benchmark.js --net`.
+const { app, protocol, session, BrowserWindow } = require('electron');
+
+const fs = require('node:fs');
+const http = require('node:http');
+const os = require('node:os');
+const path = require('node:path');
+const { Readable } = require('node:stream');
+
+const kScheme = 'bench';
+const kSmallSize = 1024;
+const kLargeSize = 1024 * 1024;
+
+protocol.registerSchemesAsPrivileged([
+  { scheme: kScheme, privileges: { standard: true, secure: true, supportFetchAPI: true } }
+]);
+
+function parseArgs (argv) {
+  const options = { iterations: 500, throughputRuns: 50, filter: null, jsonOutput: null };
+  for (const arg of argv) {
+    const [key, value] = arg.replace(/^--/, '').split('=');
+    if (key === 'iterations') options.iterations = parseInt(value, 10);
+    else if (key === 'throughput-runs') options.throughputRuns = parseInt(value, 10);
+    else if (key === 'filter') options.filter = new RegExp(value);
+    else if (key === 'json-output') options.jsonOutput = path.resolve(value);
+  }
+  return options;
+}
+
+// The page fetches same-origin URLs, so every scenario serves it from the
+// origin it measures.
+const page = Buffer.from(`<!DOCTYPE html>
+<script>
+  async function measure (url, iterations) {
+    const samples = new Array(iterations);
+    const start = performance.now();
+    for (let i = 0; i < iterations; i++) {
+      const before = performance.now();
+      await (await fetch(url, { cache: 'no-store' })).arrayBuffer();
+      samples[i] = performance.now() - before;
+    }
+    return { elapsed: performance.now() - start, samples };
+  }
+</script>`);
+
+const bodies = new Map([[kSmallSize, Buffer.alloc(kSmallSize, 'a')], [kLargeSize, Buffer.alloc(kLargeSize, 'b')]]);
+
+// Returns the page for "/", otherwise the body of the size given in the
+// "size" query parameter.
+function lookup (url) {
+  const { pathname, searchParams } = new URL(url);
+  if (pathname === '/') return { body: page, mimeType: 'text/html' };
+  return { body: bodies.get(parseInt(searchParams.get('size'), 10)), mimeType: 'application/octet-stream' };
+}
+
+function writeFiles () {
+  const dir = fs.mkdtempSync(path.join(os.tmpdir(), 'electron-net-benchmark-'));
+  const files = new Map([['/', path.join(dir, 'index.html')]]);
+  fs.writeFileSync(files.get('/'), page);
+  for (const [size, body] of bodies) {
+    files.set(String(size), path.join(dir, `${size}.bin`));
+    fs.writeFileSync(files.get(String(size)), body);
+  }
+  return { dir, files };
+}
+
+function addWebRequestListeners (ses) {
+  ses.webRequest.onBeforeRequest((details, callback) => callback({}));
+  ses.webRequest.onBeforeSendHeaders((details, callback) => callback({}));
+  ses.webRequest.onHeadersReceived((details, callback) => callback({}));
+  ses.webRequest.onCompleted(() => {});
+}
+
+function defineScenarios (serverOrigin, files) {
+  const handlers = {
+    http: () => {},
+    buffer: (ses) => ses.protocol.registerBufferProtocol(kScheme, (request, callback) => {
+      const { body, mimeType } = lookup(request.url);
+      callback({ data: body, mimeType });
+    }),
+    stream: (ses) => ses.protocol.registerStreamProtocol(kScheme, (request, callback) => {
+      const { body, mimeType } = lookup(request.url);
+      callback({ data: Readable.from([body]), mimeType, statusCode: 200 });
+    }),
+    file: (ses) => ses.protocol.registerFileProtocol(kScheme, (request, callback) => {
+      const { pathname, searchParams } = new URL(request.url);
+      callback({ path: files.get(pathname === '/' ? '/' : searchParams.get('size')) });
+    }),
+    handle: (ses) => ses.protocol.handle(kScheme, (request) => {
+      const { body, mimeType } = lookup(request.url);
+      return new Response(body, { headers: { 'content-type': mimeType } });
+    })
+  };
+
+  const scenarios = [];
+  for (const [type, register] of Object.entries(handlers)) {
+    const origin = type === 'http' ? serverOrigin : `${kScheme}://host`;
+    scenarios.push({ name: type, origin, setup: register });
+    scenarios.push({
+      name: `${type}+webRequest`,
+      baseline: type,
+      origin,
+      setup: (ses) => {
+        register(ses);
+        addWebRequestListeners(ses);
+      }
+    });
+  }
+  return scenarios;
+}
+
+function summarize ({ elapsed, samples }, size) {
+  const sorted = Float64Array.from(samples).sort();
+  const percentile = (p) => sorted[Math.min(sorted.length - 1, Math.floor(sorted.length * p))];
+  return {
+    requestsPerSec: sorted.length / (elapsed / 1000),
+    throughput: (size * sorted.length) / (1024 * 1024) / (elapsed / 1000),
+    // Latencies are in milliseconds.
+    p50: percentile(0.5),
+    p90: percentile(0.9),
+    p99: percentile(0.99)
+  };
+}
+
+async function runScenario (scenario, options, index) {
+  const ses = session.fromPartition(`net-benchmark-${index}`);
+  scenario.setup(ses);
+  const w = new BrowserWindow({ show: false, webPreferences: { session: ses, backgroundThrottling: false } });
+  try {
+    await w.loadURL(`${scenario.origin}/`);
+    const run = async (size, iterations) => summarize(await w.webContents.executeJavaScript(
+      `measure(${JSON.stringify(`${scenario.origin}/data?size=${size}`)}, ${iterations})`), size);
+    const small = await run(kSmallSize, options.iterations);
+    const large = await run(kLargeSize, options.throughputRuns);
+    return { name: scenario.name, baseline: scenario.baseline, small, large };
+  } finally {
+    w.destroy();
+  }
+}
+
+function print (result, baseline) {
+  const ms = (value) => `${value.toFixed(2)}ms`.padStart(9);
+  let line = `${result.name.padEnd(20)}${result.small.requestsPerSec.toFixed(0).padStart(7)} req/s` +
+    `  p50${ms(result.small.p50)}  p99${ms(result.small.p99)}` +
+    `${result.large.throughput.toFixed(0).padStart(7)} MB/s`;
+  if (baseline) line += `  overhead${ms(result.small.p50 - baseline.small.p50)}`;
+  console.log(line);
+}
+
+async function main () {
+  const options = parseArgs(process.argv.slice(2));
+
+  const server = http.createServer((request, response) => {
+    const { body, mimeType } = lookup(`http://host${request.url}`);
+    response.writeHead(200, { 'content-type': mimeType, 'content-length': body.length });
+    response.end(body);
+  });
+  await new Promise(resolve => server.listen(0, '127.0.0.1', resolve));
+  const { dir, files } = writeFiles();
+
+  const results = [];
+  try {
+    const scenarios = defineScenarios(`http://127.0.0.1:${server.address().port}`, files);
+    for (const [index, scenario] of scenarios.entries()) {
+      if (options.filter && !options.filter.test(scenario.name)) continue;
+      const result = await runScenario(scenario, options, index);
+      const baseline = results.find(r => r.name === result.baseline);
+      // Per-request overhead of the listeners, at the median.
+      if (baseline) result.overhead = result.small.p50 - baseline.small.p50;
+      print(result, baseline);
+      results.push(result);
+    }
+  } finally {
+    server.close();
+    fs.rmSync(dir, { recursive: true, force: true });
+  }
+
+  if (options.jsonOutput) {
+    fs.mkdirSync(path.dirname(options.jsonOutput), { recursive: true });
+    fs.writeFileSync(options.jsonOutput, JSON.stringify({
+      versions: { electron: process.versions.electron, chrome: process.versions.chrome },
+      platform: process.platform,
+      arch: process.arch,
+      date: new Date().toISOString(),
+      options: { iterations: options.iterations, throughputRuns: options.throughputRuns },
+      results
+    }, null, 2));
+  }
+}
+
+app.whenReady().then(main).then(() => {
+  app.exit(0);
+}, (error) => {
+  console.error(error);
+  app.exit(1);
+});
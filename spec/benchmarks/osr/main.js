@@ -0,0 +1,137 @@
+// Measures the offscreen rendering frame pipeline: the time from synthetic
+// input to the paint event that shows its effect, the frame rate achieved
+// for each requested one, and the bytes copied per frame. Run through
+// `script/benchmark.js --osr`.
+const { app, BrowserWindow } = require('electron');
+
+const fs = require('node:fs');
+const path = require('node:path');
+
+const kWidth = 800;
+const kHeight = 600;
+const kPaintTimeout = 2000;
+
+function parseArgs (argv) {
+  const options = { frameRates: [30, 60, 120], duration: 3000, clicks: 50, jsonOutput: null };
+  for (const arg of argv) {
+    const [key, value] = arg.replace(/^--/, '').split('=');
+    if (key === 'frame-rates') options.frameRates = value.split(',').map(Number);
+    else if (key === 'duration') options.duration = parseInt(value, 10);
+    else if (key === 'clicks') options.clicks = parseInt(value, 10);
+    else if (key === 'json-output') options.jsonOutput = path.resolve(value);
+  }
+  return options;
+}
+
+function isGreen (image) {
+  // The green channel is at index 1 in both BGRA and RGBA.
+  return image.crop({ x: 5, y: 5, width: 1, height: 1 }).toBitmap()[1] > 128;
+}
+
+// Resolves with the time of the first paint event that satisfies |predicate|.
+function waitForPaint (contents, predicate) {
+  return new Promise((resolve, reject) => {
+    const timeout = setTimeout(() => {
+      contents.off('paint', listener);
+      reject(new Error('Timed out waiting for a paint event'));
+    }, kPaintTimeout);
+    const listener = (event, dirtyRect, image) => {
+      const time = performance.now();
+      if (!predicate(image)) return;
+      clearTimeout(timeout);
+      contents.off('paint', listener);
+      resolve(time);
+    };
+    contents.on('paint', listener);
+  });
+}
+
+async function measureInputLatency (contents, clicks) {
+  await contents.executeJavaScript('stopAnimation()');
+  const samples = [];
+  let green = false;
+  for (let i = 0; i < clicks; i++) {
+    green = !green;
+    const expected = green;
+    const painted = waitForPaint(contents, image => isGreen(image) === expected);
+    const start = performance.now();
+    contents.sendInputEvent({ type: 'mouseDown', x: 10, y: 10, button: 'left', clickCount: 1 });
+    contents.sendInputEvent({ type: 'mouseUp', x: 10, y: 10, button: 'left', clickCount: 1 });
+    samples.push(await painted - start);
+  }
+  const sorted = Float64Array.from(samples).sort();
+  const percentile = (p) => sorted[Math.min(sorted.length - 1, Math.floor(sorted.length * p))];
+  // Latencies are in milliseconds.
+  return { clicks, p50: percentile(0.5), p90: percentile(0.9), p99: percentile(0.99), max: sorted[sorted.length - 1] };
+}
+
+async function measureFrameRate (contents, frameRate, duration) {
+  contents.setFrameRate(frameRate);
+  await contents.executeJavaScript('startAnimation()');
+  await new Promise(resolve => setTimeout(resolve, 500));
+
+  let paints = 0;
+  let dirtyBytes = 0;
+  const listener = (event, dirtyRect) => {
+    paints++;
+    dirtyBytes += dirtyRect.width * dirtyRect.height * 4;
+  };
+  const before = contents.getPaintStatistics();
+  contents.on('paint', listener);
+  await new Promise(resolve => setTimeout(resolve, duration));
+  contents.off('paint', listener);
+  const after = contents.getPaintStatistics();
+  await contents.executeJavaScript('stopAnimation()');
+
+  return {
+    requested: frameRate,
+    achieved: paints / (duration / 1000),
+    bytesCopiedPerFrame: (after.bytesCopied - before.bytesCopied) / Math.max(1, after.painted - before.painted),
+    dirtyBytesPerFrame: dirtyBytes / Math.max(1, paints)
+  };
+}
+
+async function main () {
+  const options = parseArgs(process.argv.slice(2));
+  const w = new BrowserWindow({
+    width: kWidth,
+    height: kHeight,
+    show: false,
+    webPreferences: { offscreen: true, backgroundThrottling: false }
+  });
+  await w.loadFile(path.join(__dirname, 'index.html'));
+
+  const frameRates = [];
+  for (const frameRate of options.frameRates) {
+    const result = await measureFrameRate(w.webContents, frameRate, options.duration);
+    console.log(`frame rate ${String(frameRate).padStart(4)}  achieved ${result.achieved.toFixed(1).padStart(6)} fps` +
+      `  copied ${(result.bytesCopiedPerFrame / 1024).toFixed(1).padStart(8)}KB/frame` +
+      `  dirty ${(result.dirtyBytesPerFrame / 1024).toFixed(1).padStart(8)}KB/frame`);
+    frameRates.push(result);
+  }
+
+  w.webContents.setFrameRate(60);
+  const inputLatency = await measureInputLatency(w.webContents, options.clicks);
+  const ms = (value) => `${value.toFixed(2)}ms`.padStart(9);
+  console.log(`input to paint   p50${ms(inputLatency.p50)}  p90${ms(inputLatency.p90)}` +
+    `  p99${ms(inputLatency.p99)}  max${ms(inputLatency.max)}`);
+
+  if (options.jsonOutput) {
+    fs.mkdirSync(path.dirname(options.jsonOutput), { recursive: true });
+    fs.writeFileSync(options.jsonOutput, JSON.stringify({
+      versions: { electron: process.versions.electron, chrome: process.versions.chrome },
+      platform: process.platform,
+      arch: process.arch,
+      date: new Date().toISOString(),
+      frameRates,
+      inputLatency
+    }, null, 2));
+  }
+}
+
+app.whenReady().then(main).then(() => {
+  app.exit(0);
+}, (error) => {
+  console.error(error);
+  app.exit(1);
+});
@@ -0,0 +1,74 @@
+// Runs in the isolated world. IPC benchmarks are driven from here so that
+// they measure ipcRenderer itself rather than a context bridge call.
+const { contextBridge, ipcRenderer } = require('electron');
+
+async function measure (fn, { iterations, warmup }) {
+  for (let i = 0; i < warmup; i++) await fn();
+  const samples = new Array(iterations);
+  const start = performance.now();
+  for (let i = 0; i < iterations; i++) {
+    const before = performance.now();
+    await fn();
+    samples[i] = performance.now() - before;
+  }
+  return { elapsed: performance.now() - start, samples };
+}
+
+const portReady = new Promise((resolve) => {
+  ipcRenderer.once('bench:port', (event) => resolve(event.ports[0]));
+});
+
+// Posts every message up front and records when each echo comes back, so
+// that latency includes queueing and |elapsed| reflects throughput.
+async function measurePort ({ payload, iterations, warmup }) {
+  const port = await portReady;
+  const total = warmup + iterations;
+  const sentAt = new Float64Array(total);
+  const samples = new Array(iterations);
+  let received = 0;
+  let start = 0;
+  return new Promise((resolve) => {
+    port.onmessage = ({ data }) => {
+      if (data.seq >= warmup) samples[data.seq - warmup] = performance.now() - sentAt[data.seq];
+      if (++received === warmup) sendBatch(warmup, total);
+      if (received === total) resolve({ elapsed: performance.now() - start, samples });
+    };
+    const sendBatch = (from, to) => {
+      start = performance.now();
+      for (let seq = from; seq < to; seq++) {
+        sentAt[seq] = performance.now();
+        port.postMessage({ seq, payload });
+      }
+    };
+    if (warmup > 0) {
+      sendBatch(0, warmup);
+    } else {
+      sendBatch(0, total);
+    }
+  });
+}
+
+function invokeEcho (payload) {
+  return () => ipcRenderer.invoke('bench:invoke', payload);
+}
+
+const preloadBenchmarks = {
+  'ipc.send': ({ payload }) => () => new Promise((resolve) => {
+    ipcRenderer.once('bench:reply', resolve);
+    ipcRenderer.send('bench:send', payload);
+  }),
+  'ipc.send-sync': ({ payload }) => () => ipcRenderer.sendSync('bench:send-sync', payload),
+  'ipc.invoke': ({ payload }) => invokeEcho(payload),
+  'ipc.invoke-large': ({ largePayload }) => invokeEcho(largePayload)
+};
+
+contextBridge.exposeInMainWorld('bench', {
+  echo: (value) => value,
+  callWith: (callback, value) => callback(value),
+  runInPreload: (name, options) => {
+    if (name === 'message-port.echo') return measurePort(options);
+    const factory = preloadBenchmarks[name];
+    if (!factory) throw new Error(`Unknown benchmark '${name}'`);
+    return measure(factory(options), options);
+  }
+});
@@ -0,0 +1,45 @@
+// Runs in the main world, so every call below crosses the context bridge.
+
+// A small message, roughly what an app sends per IPC call.
+const payload = {
+  id: 42,
+  channel: 'document:update',
+  flags: [true, false, true],
+  range: { start: 120, end: 164 },
+  text: 'The quick brown fox jumps over the lazy dog'
+};
+
+// A larger structured message that exercises the serializer's handling of
+// nested objects, strings and typed arrays.
+const largePayload = {
+  rows: Array.from({ length: 500 }, (_, i) => ({ ...payload, id: i, tags: ['a', 'b', String(i)] })),
+  blob: new Uint8Array(64 * 1024)
+};
+
+async function measure (fn, { iterations, warmup }) {
+  for (let i = 0; i < warmup; i++) await fn();
+  const samples = new Array(iterations);
+  const start = performance.now();
+  for (let i = 0; i < iterations; i++) {
+    const before = performance.now();
+    await fn();
+    samples[i] = performance.now() - before;
+  }
+  return { elapsed: performance.now() - start, samples };
+}
+
+const mainWorldBenchmarks = {
+  'context-bridge.call': ({ payload }) => () => window.bench.echo(payload),
+  'context-bridge.call-large': ({ largePayload }) => () => window.bench.echo(largePayload),
+  'context-bridge.callback': ({ payload }) => {
+    const callback = (value) => value;
+    return () => window.bench.callWith(callback, payload);
+  }
+};
+
+window.runBenchmark = async (name, { iterations, warmup }) => {
+  const options = { payload, largePayload, iterations, warmup };
+  const factory = mainWorldBenchmarks[name];
+  if (!factory) return window.bench.runInPreload(name, options);
+  return measure(factory(options), options);
+};
@@ -0,0 +1,47 @@
+// Launched once per run by `script/benchmark.js --startup`. Opens a single
+// window, waits until it has loaded and painted, and prints the startup
+// timeline together with the memory used for that window.
+const { app, BrowserWindow } = require('electron');
+
+const path = require('node:path');
+
+const kResultMarker = 'STARTUP BENCHMARK RESULT: ';
+const kPhaseTimeout = 10000;
+
+const userDataArg = process.argv.find(arg => arg.startsWith('--bench-user-data='));
+if (userDataArg) app.setPath('userData', userDataArg.split('=')[1]);
+
+async function waitForPhase (name) {
+  const start = Date.now();
+  while (!app.getStartupTimeline().some(phase => phase.name === name)) {
+    if (Date.now() - start > kPhaseTimeout) throw new Error(`Timed out waiting for '${name}'`);
+    await new Promise(resolve => setTimeout(resolve, 10));
+  }
+}
+
+async function main () {
+  const w = new BrowserWindow({ width: 800, height: 600 });
+  await w.loadFile(path.join(__dirname, 'index.html'));
+  await waitForPhase('first-window-paint');
+
+  const timeline = {};
+  for (const { name, time } of app.getStartupTimeline()) timeline[name] = time;
+
+  // Memory is in kilobytes.
+  const rendererPid = w.webContents.getOSProcessId();
+  let totalMemory = 0;
+  let rendererMemory = 0;
+  for (const { pid, memory } of app.getAppMetrics()) {
+    totalMemory += memory.workingSetSize;
+    if (pid === rendererPid) rendererMemory = memory.workingSetSize;
+  }
+
+  console.log(kResultMarker + JSON.stringify({ timeline, rendererMemory, totalMemory }));
+}
+
+app.whenReady().then(main).then(() => {
+  app.exit(0);
+}, (error) => {
+  console.error(error);
+  app.exit(1);
+});
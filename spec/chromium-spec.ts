@@ -1020,6 +1020,39 @@ describe('chromium features', () => {
       expect(data).to.equal('object function object function');
     });
 
+    it('Worker has node integration with lazyNodeIntegrationInWorker', async () => {
+      const w = new BrowserWindow({ show: false, webPreferences: { nodeIntegration: true, nodeIntegrationInWorker: true, lazyNodeIntegrationInWorker: true, contextIsolation: false } });
+      w.loadURL(`file://${fixturesPath}/pages/worker.html`);
+      const [, data] = await once(ipcMain, 'worker-result');
+      expect(data).to.equal('object function object function');
+    });
+
+    it('Worker follows the nodeIntegrationInWorker of an in-process child window', async () => {
+      const w = new BrowserWindow({ show: false, webPreferences: { nodeIntegration: true, nodeIntegrationInWorker: true, contextIsolation: false } });
+      w.webContents.setWindowOpenHandler(() => ({
+        action: 'allow',
+        overrideBrowserWindowOptions: { show: false, webPreferences: { nodeIntegrationInWorker: false } }
+      }));
+      await w.loadURL(`file://${fixturesPath}/pages/blank.html`);
+      const childCreated = once(app, 'browser-window-created') as Promise<[any, BrowserWindow]>;
+      w.webContents.executeJavaScript('void window.open("blank.html")');
+      const [, child] = await childCreated;
+      await once(child.webContents, 'did-finish-load');
+      expect(child.webContents.getOSProcessId()).to.equal(w.webContents.getOSProcessId());
+      const data = await child.webContents.executeJavaScript(`
+        const worker = new Worker('../workers/worker_node.js');
+        new Promise((resolve) => { worker.onmessage = e => resolve(e.data); })
+      `);
+      expect(data).to.equal('undefined undefined undefined undefined');
+    });
+
+    it('Workers with nodeIntegrationInWorker can require the same module', async () => {
+      const w = new BrowserWindow({ show: false, webPreferences: { nodeIntegration: true, nodeIntegrationInWorker: true, contextIsolation: false } });
+      w.loadURL(`file://${fixturesPath}/pages/worker-require.html`);
+      const [, data] = await once(ipcMain, 'worker-result');
+      expect(data).to.deep.equal([3, 3]);
+    });
+
     describe('SharedWorker', () => {
       it('can work', async () => {
         const w = new BrowserWindow({ show: false });
@@ -2,6 +2,7 @@ import { expect } from 'chai';
 import { app, session, BrowserWindow, ipcMain, WebContents, Extension, Session } from 'electron/main';
 import { closeAllWindows, closeWindow } from './lib/window-helpers';
 import * as http from 'node:http';
+import * as os from 'node:os';
 import * as path from 'node:path';
 import * as fs from 'node:fs/promises';
 import * as WebSocket from 'ws';
@@ -211,6 +212,55 @@ describe('chrome extensions', () => {
     expect(extension.manifest).to.deep.equal(manifest);
   });
 
+  it('loads several extensions with loadExtensions', async () => {
+    const customSession = session.fromPartition(`persist:${uuid.v4()}`);
+    const extensions = await customSession.loadExtensions([
+      path.join(fixtures, 'extensions', 'red-bg'),
+      path.join(fixtures, 'extensions', 'ui-page')
+    ]);
+    expect(extensions.map(e => e.name)).to.deep.equal(['red-bg', 'ui-page']);
+    expect(customSession.getAllExtensions()).to.have.lengthOf(2);
+  });
+
+  it('loads the same extension into several sessions', async () => {
+    const extensionPath = path.join(fixtures, 'extensions', 'red-bg');
+    const sessions = [1, 2].map(() => session.fromPartition(`persist:${uuid.v4()}`));
+    const [first, second] = await Promise.all(sessions.map(s => s.loadExtension(extensionPath)));
+    expect(second).to.deep.equal(first);
+    expect(sessions[1].getExtension(first.id)).to.deep.equal(first);
+  });
+
+  it('reloads an extension whose manifest changed without a new modification time', async () => {
+    const extensionPath = await fs.mkdtemp(path.join(os.tmpdir(), 'electron-extension-'));
+    try {
+      await fs.cp(path.join(fixtures, 'extensions', 'red-bg'), extensionPath, { recursive: true });
+      const manifestPath = path.join(extensionPath, 'manifest.json');
+      const { mtime } = await fs.stat(manifestPath);
+      const { atime: dirAtime, mtime: dirMtime } = await fs.stat(extensionPath);
+      const first = await session.fromPartition(`persist:${uuid.v4()}`).loadExtension(extensionPath);
+      expect(first.name).to.equal('red-bg');
+
+      // Same size and timestamps, only the contents differ.
+      const manifest = await fs.readFile(manifestPath, 'utf8');
+      await fs.writeFile(manifestPath, manifest.replace('"red-bg"', '"red-bb"'));
+      await fs.utimes(manifestPath, mtime, mtime);
+      await fs.utimes(extensionPath, dirAtime, dirMtime);
+
+      const second = await session.fromPartition(`persist:${uuid.v4()}`).loadExtension(extensionPath);
+      expect(second.name).to.equal('red-bb');
+    } finally {
+      await fs.rm(extensionPath, { recursive: true, force: true });
+    }
+  });
+
+  it('rejects loadExtensions when one of the extensions fails to load', async () => {
+    const customSession = session.fromPartition(`persist:${uuid.v4()}`);
+    await expect(customSession.loadExtensions([
+      path.join(fixtures, 'extensions', 'red-bg'),
+      path.join(fixtures, 'extensions', 'missing-manifest')
+    ])).to.eventually.be.rejectedWith(/Manifest file is missing or unreadable/);
+  });
+
   it('removes an extension', async () => {
     const customSession = session.fromPartition(`persist:${uuid.v4()}`);
     const { id } = await customSession.loadExtension(path.join(fixtures, 'extensions', 'red-bg'));
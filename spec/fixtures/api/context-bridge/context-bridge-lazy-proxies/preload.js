@@ -0,0 +1,10 @@
+const { contextBridge } = require('electron');
+
+const state = { nested: { value: 1 }, list: [{ value: 1 }] };
+contextBridge.exposeInMainWorld('example', {
+  state,
+  setValue: (value) => {
+    state.nested.value = value;
+    state.list[0].value = value;
+  }
+});
@@ -0,0 +1,8 @@
+const { contextBridge } = require('electron');
+
+const bytes = new Uint8Array([1, 2, 3, 4]);
+contextBridge.exposeInMainWorld('example', {
+  getBytes: () => bytes,
+  getView: () => new DataView(bytes.buffer, 1),
+  setFirst: (value) => { bytes[0] = value; }
+});
@@ -0,0 +1,5 @@
+process.parentPort.on('message', (e) => {
+  const { channel, args } = e.data;
+  const sum = args.reduce((total, value) => total + value, 0);
+  e.ports[0].postMessage({ channel, sum, pid: process.pid });
+});
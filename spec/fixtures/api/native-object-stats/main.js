@@ -0,0 +1,10 @@
+const { app, BrowserWindow, nativeImage } = require('electron');
+
+app.whenReady().then(() => {
+  const w = new BrowserWindow({ show: false });
+  const image = nativeImage.createEmpty();
+  console.log(JSON.stringify(process.getNativeObjectStats()));
+  w.destroy();
+  image.isEmpty();
+  app.quit();
+});
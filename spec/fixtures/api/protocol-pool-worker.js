@@ -0,0 +1,8 @@
+process.parentPort.on('message', (e) => {
+  const { url, method, body } = e.data;
+  e.ports[0].postMessage({
+    status: 201,
+    headers: { 'x-method': method },
+    body: `${url} ${Buffer.from(body).toString()}`
+  });
+});
@@ -0,0 +1,17 @@
+const { app } = require('electron');
+
+app.setPath('sessionData', app.commandLine.getSwitchValue('session-data'));
+
+let error = null;
+try {
+  app.setShaderCacheSeed(app.commandLine.getSwitchValue('seed'));
+} catch (e) {
+  error = e.message;
+}
+
+app.whenReady().then(() => {
+  process.stdout.write(JSON.stringify({ error }));
+  process.stdout.end();
+
+  app.quit();
+});
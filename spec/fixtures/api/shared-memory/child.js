@@ -0,0 +1,9 @@
+const { sharedMemory } = require('electron');
+
+process.parentPort.once('message', (e) => {
+  const { memory } = e.data;
+  memory.storeUint32(4, memory.loadUint32(0) * 2);
+  const reply = sharedMemory.create(8);
+  reply.storeUint32(0, 7);
+  process.parentPort.postMessage({ reply });
+});
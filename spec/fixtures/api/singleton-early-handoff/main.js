@@ -0,0 +1,20 @@
+const { app } = require('electron');
+
+// An instance that hands off early never runs this script, so the first
+// instance receives null instead of this data.
+const gotTheLock = app.requestSingleInstanceLock({ fromScript: true }, { earlyHandoff: true });
+
+if (!gotTheLock) {
+  app.exit(1);
+}
+
+app.whenReady().then(() => {
+  console.log('started'); // ping parent
+});
+
+app.on('second-instance', (event, args, workingDirectory, additionalData) => {
+  setImmediate(() => {
+    console.log([JSON.stringify(args), JSON.stringify(additionalData)].join('||'));
+    app.exit(0);
+  });
+});
@@ -0,0 +1,6 @@
+process.parentPort.on('message', (e) => {
+  if (e.data === 'crash') {
+    process.exit(1);
+  }
+  e.ports[0].postMessage({ result: e.data * 2, pid: process.pid });
+});
@@ -0,0 +1 @@
+process.parentPort.postMessage(process.ppid);
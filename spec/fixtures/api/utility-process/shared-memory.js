@@ -0,0 +1,5 @@
+process.parentPort.on('message', () => {
+  const memory = process.parentPort.sharedMemory;
+  memory.storeUint32(4, memory.loadUint32(0) * 2);
+  process.parentPort.postMessage('done');
+});
@@ -0,0 +1,6 @@
+process.parentPort.on('message', (e) => {
+  const buffer = e.data;
+  new Uint8Array(buffer).reverse();
+  process.parentPort.postMessage(buffer, [buffer]);
+  process.parentPort.postMessage(buffer.byteLength);
+});
@@ -8,14 +8,18 @@ if (process.argv.length < 4) {
   process.exit(1);
 }
 
+const useFileScheme = process.argv[2] === 'file';
+
 protocol.registerSchemesAsPrivileged([
-  {
-    scheme: 'atom',
-    privileges: {
-      standard: true,
-      codeCache: process.argv[2] === 'true'
-    }
-  }
+  useFileScheme
+    ? { scheme: 'file', privileges: { codeCache: true } }
+    : {
+        scheme: 'atom',
+        privileges: {
+          standard: true,
+          codeCache: process.argv[2] === 'true'
+        }
+      }
 ]);
 
 app.once('ready', async () => {
@@ -29,7 +33,11 @@ app.once('ready', async () => {
   });
 
   const win = new BrowserWindow({ show: false });
-  win.loadURL('atom://host/main.html');
+  if (useFileScheme) {
+    win.loadFile(path.join(__dirname, 'file.html'));
+  } else {
+    win.loadURL('atom://host/main.html');
+  }
   await once(win.webContents, 'did-finish-load');
   // Reload to generate code cache.
   win.reload();
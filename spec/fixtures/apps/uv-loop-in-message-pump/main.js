@@ -0,0 +1,29 @@
+const { app } = require('electron');
+const fs = require('node:fs/promises');
+const net = require('node:net');
+
+const echo = () => new Promise((resolve, reject) => {
+  const server = net.createServer(socket => socket.pipe(socket));
+  server.listen(0, '127.0.0.1', () => {
+    const client = net.connect(server.address().port, '127.0.0.1');
+    client.on('error', reject);
+    client.on('data', data => {
+      client.end();
+      server.close();
+      resolve(data.toString());
+    });
+    client.write('ping');
+  });
+});
+
+const failure = setTimeout(() => app.exit(1), 10000);
+
+app.whenReady().then(async () => {
+  const start = Date.now();
+  await new Promise(resolve => setTimeout(resolve, 50));
+  const elapsed = Date.now() - start;
+  const content = await fs.readFile(__filename, 'utf8');
+  const reply = await echo();
+  clearTimeout(failure);
+  app.exit(elapsed >= 50 && content.includes('ping') && reply === 'ping' ? 0 : 1);
+});
@@ -0,0 +1,12 @@
+const fs = require('node:fs');
+const path = require('node:path');
+
+const archive = process.argv[2] || path.join(__dirname, '..', 'test.asar', 'a.asar');
+
+const details = {
+  string: fs.readFileSync(path.join(archive, 'file1'), 'utf8'),
+  buffer: fs.readFileSync(path.join(archive, 'dir1', 'file2')).toString(),
+  link: fs.readFileSync(path.join(archive, 'link2', 'file3'), 'utf8')
+};
+
+console.log(JSON.stringify(details));
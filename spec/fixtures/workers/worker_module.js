@@ -0,0 +1 @@
+exports.add = (a, b) => a + b;
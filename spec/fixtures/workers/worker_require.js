@@ -0,0 +1,2 @@
+const { add } = require('./worker_module.js');
+self.postMessage(add(1, 2));
@@ -139,6 +139,32 @@ ifdescribe(isTestingBindingAvailable())('logging', () => {
     expect(contents).to.match(/TEST_LOG/);
   });
 
+  it('logs to the given file from a background thread when --log-async is passed', async () => {
+    const logFilePath = path.join(app.getPath('temp'), 'test-log-file-' + uuid.v4());
+    const rc = await startRemoteControlApp(['--enable-logging', '--log-file=' + logFilePath, '--log-async']);
+    rc.remotely(() => {
+      process._linkedBinding('electron_common_testing').log(0, 'TEST_LOG');
+      setTimeout(() => { require('electron').app.quit(); });
+    });
+    await once(rc.process, 'exit');
+    const contents = await fs.readFile(logFilePath, 'utf8');
+    expect(contents).to.match(/TEST_LOG/);
+  });
+
+  it('writes a compact log file when --log-format=binary is passed', async () => {
+    const logFilePath = path.join(app.getPath('temp'), 'test-log-file-' + uuid.v4());
+    const rc = await startRemoteControlApp(['--enable-logging', '--log-file=' + logFilePath, '--log-format=binary']);
+    rc.remotely(() => {
+      process._linkedBinding('electron_common_testing').log(0, 'TEST_LOG');
+      setTimeout(() => { require('electron').app.quit(); });
+    });
+    await once(rc.process, 'exit');
+    const contents = await fs.readFile(logFilePath);
+    expect(contents.subarray(0, 4).toString('latin1')).to.equal('ELG1');
+    expect(contents.toString('latin1')).to.match(/TEST_LOG/);
+    expect(contents.toString('latin1')).not.to.match(/\[\d+:\d+\/\d+\.\d+:INFO:/);
+  });
+
   it('does not lose early log messages when logging to a given file with --log-file', async () => {
     const logFilePath = path.join(app.getPath('temp'), 'test-log-file-' + uuid.v4());
     const rc = await startRemoteControlApp(['--enable-logging', '--log-file=' + logFilePath, '--boot-eval=process._linkedBinding(\'electron_common_testing\').log(0, \'EARLY_LOG\')']);
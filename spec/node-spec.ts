@@ -168,6 +168,15 @@ describe('node feature', () => {
     expect(code).to.equal(0);
   });
 
+  it('runs timers, fs and sockets in the browser process with UvLoopInMessagePump', async () => {
+    const appPath = path.join(mainFixturesPath, 'apps', 'uv-loop-in-message-pump');
+    const appProcess = childProcess.spawn(process.execPath, ['--enable-features=UvLoopInMessagePump', appPath], {
+      stdio: 'inherit'
+    });
+    const [code] = await once(appProcess, 'close');
+    expect(code).to.equal(0);
+  });
+
   describe('contexts', () => {
     describe('setTimeout called under Chromium event loop in browser process', () => {
       it('Can be scheduled in time', (done) => {
@@ -933,6 +942,27 @@ describe('node feature', () => {
     child.kill();
   });
 
+  it('runs scripts with the minimal ELECTRON_RUN_AS_NODE bootstrap', async () => {
+    const scriptPath = path.join(fixtures, 'module', 'node-promise-timer.js');
+    const child = childProcess.spawn(process.execPath, [scriptPath], {
+      env: { ELECTRON_RUN_AS_NODE: 'true', ELECTRON_RUN_AS_NODE_MINIMAL: '1' }
+    });
+    const [code, signal] = await once(child, 'exit');
+    expect(code).to.equal(0);
+    expect(signal).to.equal(null);
+  });
+
+  it('does not expose thread pool bindings in the minimal ELECTRON_RUN_AS_NODE bootstrap', async () => {
+    const child = childProcess.spawn(process.execPath, ['-e', "process._linkedBinding('electron_common_native_image')"], {
+      env: { ELECTRON_RUN_AS_NODE: 'true', ELECTRON_RUN_AS_NODE_MINIMAL: '1' }
+    });
+    let stderr = '';
+    child.stderr.on('data', (data) => { stderr += data; });
+    const [code] = await once(child, 'exit');
+    expect(code).to.not.equal(0);
+    expect(stderr).to.contain('No such binding');
+  });
+
   it('performs microtask checkpoint correctly', (done) => {
     let timer : NodeJS.Timeout;
     const listener = () => {
@@ -219,6 +219,40 @@ describe('<webview> tag', function () {
     });
   });
 
+  describe('webview preallocation', () => {
+    afterEach(closeAllWindows);
+    it('attaches the next webview to a guest created ahead of time', async () => {
+      const partition = 'webview-preallocation';
+      session.fromPartition(partition).setWebviewPreallocationEnabled(true);
+      defer(() => session.fromPartition(partition).setWebviewPreallocationEnabled(false));
+
+      const w = new BrowserWindow({
+        show: false,
+        webPreferences: {
+          webviewTag: true,
+          nodeIntegration: true,
+          contextIsolation: false
+        }
+      });
+      await w.loadURL('about:blank');
+
+      let didAttachWebview = once(w.webContents, 'did-attach-webview') as Promise<[any, WebContents]>;
+      await loadWebView(w.webContents, { partition, src: blankPageUrl });
+      const [, firstGuest] = await didAttachWebview;
+
+      const preallocated = once(app, 'web-contents-created') as Promise<[any, WebContents]>;
+      await w.webContents.executeJavaScript('document.getElementById("webview").remove()');
+      const [, preallocatedGuest] = await preallocated;
+      expect(preallocatedGuest.getType()).to.equal('webview');
+
+      didAttachWebview = once(w.webContents, 'did-attach-webview') as Promise<[any, WebContents]>;
+      await loadWebView(w.webContents, { partition, src: blankPageUrl });
+      const [, secondGuest] = await didAttachWebview;
+      expect(secondGuest.id).to.not.equal(firstGuest.id);
+      expect(secondGuest.id).to.equal(preallocatedGuest.id);
+    });
+  });
+
   describe('did-attach event', () => {
     afterEach(closeAllWindows);
     it('is emitted when a webview has been attached', async () => {
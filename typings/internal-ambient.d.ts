@@ -10,6 +10,7 @@ declare namespace NodeJS {
     _extensions: Record<string, (module: NodeJS.Module, filename: string) => any>;
     _cache: Record<string, NodeJS.Module>;
     wrapper: [string, string];
+    wrap(script: string): string;
   }
 
   interface FeaturesBinding {
@@ -22,7 +23,8 @@ declare namespace NodeJS {
   }
 
   interface IpcRendererBinding {
-    send(internal: boolean, channel: string, args: any[]): void;
+    send(internal: boolean, channel: string, args: any[], priority?: 'urgent' | 'bulk'): void;
+    sendBatched(internal: boolean, channel: string, args: any[]): void;
     sendSync(internal: boolean, channel: string, args: any[]): any;
     sendToHost(channel: string, args: any[]): void;
     invoke<T>(internal: boolean, channel: string, args: any[]): Promise<{ error: string, result: T }>;
@@ -60,6 +62,7 @@ declare namespace NodeJS {
     size: number;
     unpacked: boolean;
     offset: number;
+    compressed?: boolean;
     integrity?: {
       algorithm: 'SHA256';
       hash: string;
@@ -75,10 +78,16 @@ declare namespace NodeJS {
   interface AsarArchive {
     getFileInfo(path: string): AsarFileInfo | false;
     stat(path: string): AsarFileStat | false;
+    getType(path: string): number;
     readdir(path: string): string[] | false;
+    readdirWithTypes(path: string): [string[], Uint8Array] | false;
     realpath(path: string): string | false;
     copyFileOut(path: string): string | false;
+    copyFileOutAsync(path: string, callback: (newPath: string | false) => void): boolean;
     getFdAndValidateIntegrityLater(): number | -1;
+    readMapped(path: string, asUtf8: boolean): Buffer | string | undefined;
+    readCompressed(path: string, asUtf8: boolean, callback: (contents: Buffer | string | undefined) => void): boolean;
+    readCodeCache(path: string): Buffer | undefined;
   }
 
   interface AsarBinding {
@@ -105,12 +114,14 @@ declare namespace NodeJS {
 
   interface NotificationBinding {
     isSupported(): boolean;
+    setMaxRate(notificationsPerSecond: number): void;
     Notification: typeof Electron.Notification;
   }
 
-  interface PowerMonitorBinding extends Electron.PowerMonitor {
+  interface PowerMonitorBinding extends Omit<Electron.PowerMonitor, 'setPowerSavingPolicy'> {
     createPowerMonitor(): PowerMonitorBinding;
     setListeningForShutdown(listening: boolean): void;
+    setPowerSavingPolicy(policy: Electron.PowerSavingPolicy | null, onChange: (active: boolean) => void): void;
   }
 
   interface SessionBinding {
@@ -169,6 +180,8 @@ declare namespace NodeJS {
     mode?: string;
     destination?: string;
     bypassCustomProtocolHandlers?: boolean;
+    responseBufferSize?: number;
+    priority?: 'throttled' | 'idle' | 'lowest' | 'low' | 'medium' | 'highest';
   };
   type ResponseHead = {
     statusCode: number;
@@ -190,7 +203,7 @@ declare namespace NodeJS {
 
   interface URLLoader extends EventEmitter {
     cancel(): void;
-    on(eventName: 'data', listener: (event: any, data: ArrayBuffer, resume: () => void) => void): this;
+    on(eventName: 'data', listener: (event: any, data: ArrayBuffer | Uint8Array, resume: () => void) => void): this;
     on(eventName: 'response-started', listener: (event: any, finalUrl: string, responseHead: ResponseHead) => void): this;
     on(eventName: 'complete', listener: (event: any) => void): this;
     on(eventName: 'error', listener: (event: any, netErrorString: string) => void): this;
@@ -210,6 +223,8 @@ declare namespace NodeJS {
     _linkedBinding(name: 'electron_common_features'): FeaturesBinding;
     _linkedBinding(name: 'electron_common_native_image'): { nativeImage: typeof Electron.NativeImage };
     _linkedBinding(name: 'electron_common_net'): NetBinding;
+    _linkedBinding(name: 'electron_common_shared_memory'): { sharedMemory: typeof Electron.SharedMemory };
+    _linkedBinding(name: 'electron_common_trace_events'): { traceEvents: typeof Electron.TraceEvents };
     _linkedBinding(name: 'electron_common_shell'): Electron.Shell;
     _linkedBinding(name: 'electron_common_v8_util'): V8UtilBinding;
     _linkedBinding(name: 'electron_browser_app'): { app: Electron.App, App: Function };
@@ -217,6 +232,12 @@ declare namespace NodeJS {
     _linkedBinding(name: 'electron_browser_crash_reporter'): CrashReporterBinding;
     _linkedBinding(name: 'electron_browser_desktop_capturer'): { createDesktopCapturer(): ElectronInternal.DesktopCapturer; };
     _linkedBinding(name: 'electron_browser_event_emitter'): { setEventEmitterPrototype(prototype: Object): void; };
+    _linkedBinding(name: 'electron_browser_ipc_main'): {
+      setSyncReply(channel: string, value: any): void;
+      removeSyncReply(channel: string): void;
+      getMetrics(): Electron.IpcChannelMetrics[];
+      resetMetrics(): void;
+    };
     _linkedBinding(name: 'electron_browser_global_shortcut'): { globalShortcut: Electron.GlobalShortcut };
     _linkedBinding(name: 'electron_browser_image_view'): { ImageView: any };
     _linkedBinding(name: 'electron_browser_in_app_purchase'): { inAppPurchase: Electron.InAppPurchase };
@@ -235,6 +256,10 @@ declare namespace NodeJS {
     _linkedBinding(name: 'electron_browser_web_contents_view'): { WebContentsView: typeof Electron.WebContentsView };
     _linkedBinding(name: 'electron_browser_web_view_manager'): WebViewManagerBinding;
     _linkedBinding(name: 'electron_browser_web_frame_main'): WebFrameMainBinding;
+    _linkedBinding(name: 'electron_renderer_code_cache'): {
+      get(filename: string, source: string): Uint8Array | undefined;
+      set(filename: string, source: string, cache: Uint8Array): void;
+    };
     _linkedBinding(name: 'electron_renderer_crash_reporter'): Electron.CrashReporter;
     _linkedBinding(name: 'electron_renderer_ipc'): { ipc: IpcRendererBinding };
     _linkedBinding(name: 'electron_renderer_web_frame'): WebFrameBinding;
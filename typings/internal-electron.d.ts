@@ -70,6 +70,7 @@ declare namespace Electron {
 
   interface WebContents {
     _loadURL(url: string, options: ElectronInternal.LoadURLOptions): void;
+    _abortDeferredLoad(): void;
     getOwnerBrowserWindow(): Electron.BrowserWindow | null;
     getLastWebPreferences(): Electron.WebPreferences | null;
     _getProcessMemoryInfo(): Electron.ProcessMemoryInfo;
@@ -84,6 +85,7 @@ declare namespace Electron {
     _printToPDF(options: any): Promise<Buffer>;
     _print(options: any, callback?: (success: boolean, failureReason: string) => void): void;
     _getPrintersAsync(): Promise<Electron.PrinterInfo[]>;
+    _holdCapturer(options: { stayHidden?: boolean, stayAwake?: boolean }): () => void;
     _init(): void;
     _getNavigationEntryAtIndex(index: number): Electron.EntryAtIndex | null;
     _getActiveIndex(): number;
@@ -98,6 +100,11 @@ declare namespace Electron {
     _setOwnerWindow(w: BaseWindow | null): void;
   }
 
+  interface Session {
+    _getPreloadCodeCachePath(): string | null;
+    _getBlobDataPipe(identifier: string): { read(buf: Uint8Array): Promise<number> } | null;
+  }
+
   interface WebFrameMain {
     _send(internal: boolean, channel: string, args: any): void;
     _sendInternal(channel: string, ...args: any[]): void;
@@ -133,6 +140,7 @@ declare namespace Electron {
     getItemCount(): number;
     popupAt(window: BaseWindow, x: number, y: number, positioning: number, sourceType: Required<Electron.PopupOptions>['sourceType'], callback: () => void): void;
     closePopupAt(id: number): void;
+    setLabel(index: number, label: string): void;
     setSublabel(index: number, label: string): void;
     setToolTip(index: number, tooltip: string): void;
     setIcon(index: number, image: string | NativeImage): void;
@@ -142,6 +150,7 @@ declare namespace Electron {
     insertRadioItem(index: number, commandId: number, label: string, groupId: number): void;
     insertSeparator(index: number): void;
     insertSubMenu(index: number, commandId: number, label: string, submenu?: Menu): void;
+    removeItem(index: number): void;
     delegate?: any;
     _getAcceleratorTextAt(index: number): string;
   }
@@ -193,6 +202,10 @@ declare namespace ElectronInternal {
     startHandling(captureWindow: boolean, captureScreen: boolean, thumbnailSize: Electron.Size, fetchWindowIcons: boolean): void;
     _onerror?: (error: string) => void;
     _onfinished?: (sources: Electron.DesktopCapturerSource[], fetchWindowIcons: boolean) => void;
+    startWatching(captureWindow: boolean, captureScreen: boolean, thumbnailSize: Electron.Size, fetchWindowIcons: boolean, updateIntervalMs: number): boolean;
+    stopWatching(): void;
+    _onsourceupdated?: (type: 'added' | 'updated', source: Electron.DesktopCapturerSource) => void;
+    _onsourceremoved?: (id: string) => void;
   }
 
   interface GetSourcesOptions {
@@ -255,16 +268,24 @@ declare namespace ElectronInternal {
     loader: ModuleLoader;
   }
 
+  interface LoadedModule {
+    name: string;
+    // Milliseconds spent instantiating the module on first access.
+    loadTime: number;
+  }
+
   interface UtilityProcessWrapper extends NodeJS.EventEmitter {
     readonly pid: (number) | (undefined);
+    readonly sharedMemory: Electron.SharedMemory | null;
     kill(): boolean;
     postMessage(message: any, transfer?: any[]): void;
   }
 
   interface ParentPort extends NodeJS.EventEmitter {
+    readonly sharedMemory: Electron.SharedMemory | null;
     start(): void;
     pause(): void;
-    postMessage(message: any): void;
+    postMessage(message: any, transfer?: ArrayBuffer[]): void;
   }
 
   class WebViewElement extends HTMLElement {